@@ -9,11 +9,11 @@ namespace Standard
 {
 	namespace Axis
 	{
-		//! ̐sNX
+		//! 軸の制御を行うクラス
 		static Worker::CTemplate<Poling::Worker::CTemplate> _device;
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			o[W̃NX擾
+		/// @brief			バージョンのクラスを取得
 		////////////////////////////////////////////////////////////////////////////////
 		AXIS_API Version::CObject GetVersion()
 		{
@@ -21,146 +21,146 @@ namespace Standard
 
 			Version::CManager& versionManager = Version::CManager::Instance();
 
-			// o[W̃NX擾
+			// バージョンのクラスを取得
 			ret = versionManager.GetVersion();
 
 			return ret;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			Oʒm֐̓o^
-		/// @detail			O̔ɌĂяoꂽ֐w肷
-		/// @param[in]		object	Ăяoꂽ֐
+		/// @brief			例外を通知する関数の登録
+		/// @detail			例外の発生時に呼び出されたい関数を指定する
+		/// @param[in]		object	呼び出されたい関数
 		////////////////////////////////////////////////////////////////////////////////
 		AXIS_API void AttachFunctionException(std::function<void(const Exception::CObject&)> object)
 		{
-			// Oʒm֐̓o^
+			// 例外を通知する関数の登録
 			_device.AttachFunctionException(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			Oʒm֐̉
-		/// @detail			O̔ɌĂяo֐
+		/// @brief			例外を通知する関数の解除
+		/// @detail			例外の発生時に呼び出される関数を解除する
 		////////////////////////////////////////////////////////////////////////////////
 		AXIS_API void DetachFunctionException()
 		{
-			// Oʒm֐̉
+			// 例外を通知する関数の解除
 			_device.DetachFunctionException();
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			͂̕ωʒm֐̓o^
-		/// @detail			͂̕ωɌĂяoꂽ֐w肷
-		/// @param[in]		object	Ăяoꂽ֐
+		/// @brief			入力の変化を通知する関数の登録
+		/// @detail			入力の変化時に呼び出されたい関数を指定する
+		/// @param[in]		object	呼び出されたい関数
 		////////////////////////////////////////////////////////////////////////////////
 		AXIS_API void AttachFunctionInput(std::function<void(const Status::CInput&)> object)
 		{
-			// ͂̕ωʒm֐̓o^
+			// 入力の変化を通知する関数の登録
 			_device.AttachFunctionInput(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			͂̕ωʒm֐̉
-		/// @detail			͂̕ωɌĂяo֐
+		/// @brief			入力の変化を通知する関数の解除
+		/// @detail			入力の変化時に呼び出される関数を解除する
 		////////////////////////////////////////////////////////////////////////////////
 		AXIS_API void DetachFunctionInput()
 		{
-			// ͂̕ωʒm֐̉
+			// 入力の変化を通知する関数の解除
 			_device.DetachFunctionInput();
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			
-		/// @param[in]		object	ftHg̐ݒNX
+		/// @brief			初期化
+		/// @param[in]		object	デフォルトの設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		AXIS_API void Initialize(const Setting::CDefault& object)
 		{
-			// 
+			// 初期化
 			_device.Initialize(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			j
+		/// @brief			破棄
 		////////////////////////////////////////////////////////////////////////////////
 		AXIS_API void Destroy()
 		{
-			// j
+			// 破棄
 			_device.Destroy();
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ڑ
-		/// @param[in]		object	ڑ̐ݒNX
+		/// @brief			接続
+		/// @param[in]		object	接続の設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		AXIS_API void Connect(const Setting::CConnect& object)
 		{
-			// ڑ
+			// 接続
 			_device.Connect(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ؒf
+		/// @brief			切断
 		////////////////////////////////////////////////////////////////////////////////
 		AXIS_API void Disconnect()
 		{
-			// ؒf
+			// 切断
 			_device.Disconnect();
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			T[{𐧌
-		/// @param[in]		object	̃T[{(o)w肷NX
+		/// @brief			サーボを制御
+		/// @param[in]		object	軸のサーボ状態(出力)を指定するクラス
 		////////////////////////////////////////////////////////////////////////////////
 		AXIS_API void Servo(const Status::Output::CServo& object)
 		{
-			// T[{𐧌
+			// サーボを制御
 			_device.Servo(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			_As
-		/// @param[in]		object	̌_Aw肷NX
+		/// @brief			原点復帰を実行
+		/// @param[in]		object	軸の原点復帰を指定するクラス
 		////////////////////////////////////////////////////////////////////////////////
 		AXIS_API void MoveOrigin(const Status::Output::CMoveOrigin& object)
 		{
-			// _As
+			// 原点復帰を実行
 			_device.MoveOrigin(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			WOJn
-		/// @param[in]		object ̃WOsw肷NX
+		/// @brief			ジョグを開始
+		/// @param[in]		object 軸のジョグ実行を指定するクラス
 		////////////////////////////////////////////////////////////////////////////////
 		AXIS_API void StartJog(const Status::Output::CStartJog& object)
 		{
-			// WOJn
+			// ジョグを開始
 			_device.StartJog(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			WO~
-		/// @param[in]		object ̃WO~w肷NX
+		/// @brief			ジョグを停止
+		/// @param[in]		object 軸のジョグ停止を指定するクラス
 		////////////////////////////////////////////////////////////////////////////////
 		AXIS_API void StopJog(const Status::Output::CStopJog& object)
 		{
-			// WO~
+			// ジョグを停止
 			_device.StopJog(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ړJn
+		/// @brief			移動を開始
 		////////////////////////////////////////////////////////////////////////////////
 		AXIS_API void StartMove()
 		{
-			// ړJn
+			// 移動を開始
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ړ~
+		/// @brief			移動を停止
 		////////////////////////////////////////////////////////////////////////////////
 		AXIS_API void StopMove()
 		{
-			// ړ~
+			// 移動を停止
 		}
 	}
 }
\ No newline at end of file
@@ -17,49 +17,49 @@ namespace Standard
 {
 	namespace Axis
 	{
-		// o[W擾
+		// バージョンを取得
 		AXIS_API Version::CObject GetVersion() throw(...);
 
-		// Oʒm֐̓o^
+		// 例外を通知する関数の登録
 		AXIS_API void AttachFunctionException(std::function<void(const Exception::CObject&)> object);
 
-		// Oʒm֐̉
+		// 例外を通知する関数の解除
 		AXIS_API void DetachFunctionException();
 
-		// ͂̕ωʒm֐̓o^
+		// 入力の変化を通知する関数の登録
 		AXIS_API void AttachFunctionInput(std::function<void(const Status::CInput&)> object);
 
-		// ͂̕ωʒm֐̉
+		// 入力の変化を通知する関数の解除
 		AXIS_API void DetachFunctionInput();
 
-		// 
+		// 初期化
 		AXIS_API void Initialize(const Setting::CDefault& object) throw(...);
 
-		// j
+		// 破棄
 		AXIS_API void Destroy() throw(...);
 
-		// ڑ
+		// 接続
 		AXIS_API void Connect(const Setting::CConnect& object) throw(...);
 
-		// ؒf
+		// 切断
 		AXIS_API void Disconnect() throw(...);
 
-		// T[{𐧌
+		// サーボを制御
 		AXIS_API void Servo(const Status::Output::CServo& object) throw(...);
 
-		// _As
+		// 原点復帰を実行
 		AXIS_API void MoveOrigin(const Status::Output::CMoveOrigin& object) throw(...);
 
-		// WOJn
+		// ジョグを開始
 		AXIS_API void StartJog(const Status::Output::CStartJog& object) throw(...);
 
-		// WO~
+		// ジョグを停止
 		AXIS_API void StopJog(const Status::Output::CStopJog& object) throw(...);
 
-		// ړJn
+		// 移動を開始
 		AXIS_API void StartMove() throw(...);
 
-		// ړ~
+		// 移動を停止
 		AXIS_API void StopMove() throw(...);
 	}
 }
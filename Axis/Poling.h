@@ -14,15 +14,15 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CFinish
-			/// @brief      ̌ʂێNX
-			///				 ԂĎʂێev[g̃NXp
+			/// @brief      制御の結果を保持するクラス
+			///				⇒ 状態を監視した結果を保持するテンプレートのクラスから継承
 			////////////////////////////////////////////////////////////////////////////////
 			class CFinish
 				: virtual public Signal::Result::CTemplate
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CFinish() : Signal::Result::CTemplate()
 				{
@@ -30,19 +30,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CFinish& operator = (const CFinish& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CFinish()
 				{
@@ -50,18 +50,18 @@ namespace Standard
 				}
 			};
 
-			//! 䂵ʂʒm֐̒`
+			//! 制御した結果を通知する関数の定義
 			typedef void(OnWakeup)(const Execution::CFinish&);
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CSetting
-			/// @brief      sݒ̃NX
+			/// @brief      制御を実行する設定のクラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CSetting
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CSetting()
 				{
@@ -69,19 +69,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CSetting& operator = (const CSetting& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CSetting()
 				{
@@ -90,8 +90,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CSetting& object)
 				{
@@ -100,10 +100,10 @@ namespace Standard
 				}
 
 			public:
-				//! ̏(o)w肷NX
+				//! 軸の状態(出力)を指定するクラス
 				Status::COutput Output;
 
-				//! 䂵ʂ̒ʒmĂяo֐
+				//! 制御した結果の通知を呼び出す関数
 				std::weak_ptr<std::function<OnWakeup>> Wakeup;
 			};
 		}
@@ -114,22 +114,22 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CTemplate
-				/// @brief      ̐ÅĎAԂʒmev[g̃NX
-				///				 ԂĎA݁Aʒmev[g̃NXh
-				/// @detail		̐ÅĎAԂ̒ʒms
+				/// @brief      軸の制御、軸の監視、状態を通知するテンプレートのクラス
+				///				⇒ 状態を監視、書き込み、通知するテンプレートのクラスから派生
+				/// @detail		軸の制御、軸の監視、状態の通知を行う
 				////////////////////////////////////////////////////////////////////////////////
 				class CTemplate
 					: virtual public Signal::Worker::CTemplateExpand<Poling::CSetting, Status::CInput, Execution::CSetting>
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CTemplate() : Signal::Worker::CTemplateExpand<Poling::CSetting, Status::CInput, Execution::CSetting>()
 					{
 						std::string name;
 
-						// ̂XV
+						// 名称を更新
 						name = "Axis::Poling::";
 						SetName(name);
 						SetNameException(name + "Exception::");
@@ -137,7 +137,7 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					virtual ~CTemplate()
 					{
@@ -146,9 +146,9 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			̊N
-					/// @param[in]		object	sʂ̃NX
-					/// @param[in]		function sʂ̒ʒmĂяo֐
+					/// @brief			処理の完了を起床
+					/// @param[in]		object	制御を実行した結果のクラス
+					/// @param[in]		function 制御を実行した結果の通知を呼び出す関数
 					////////////////////////////////////////////////////////////////////////////////
 					void WakeupFinish(const Execution::CFinish& object, const std::weak_ptr<std::function<Execution::OnWakeup>>& function) noexcept
 					{
@@ -158,27 +158,22 @@ namespace Standard
 
 						try
 						{
-							Signal::Subject::CTemplate<Execution::CFinish> subject;
-
-							// ֐o^
-							subject.RegistrationFunction(function);
-
-							// ֐ʒm
-							subject.CallingFunction(object);
+							// 関数を通知 ⇒ 通知するクラスを生成せずに直接呼び出し
+							Signal::Subject::CTemplate<Execution::CFinish>::CallingFunction(function, object);
 						}
 						catch (const std::exception& e)
 						{
-							// Ȍ  O֒ǋL
+							// 例外の処理 ⇒ ログへ追記
 							logging.Message << e.what();
-							// Oۑ
+							// ログを保存
 							Transfer::Output(logging);
 						}
 					}
 
 					//////////////////////////////////////////////////////////////////////////////////
-					///// @brief			ރf[^̃NXmF 䂵̗L擾
-					///// @detail			䂵Ď̎Ɋ܂܂Ăꍇɂ̓f[^ȂԂ
-					///// @return			true:ރf[^ / false:ރf[^Ȃ
+					///// @brief			書き込むデータのクラスを確認 ※制御したい軸の有無を取得
+					///// @detail			制御したい軸が監視中の軸に含まれている場合にはデータなしを返す
+					///// @return			true:書き込むデータあり / false:書き込むデータなし
 					//////////////////////////////////////////////////////////////////////////////////
 					//bool IsWrite()
 					//{
@@ -192,22 +187,22 @@ namespace Standard
 
 					//	try
 					//	{
-					//		// r
+					//		// 排他制御
 					//		std::lock_guard<std::recursive_mutex> lock(m_asyncWrite);
 
-					//		// ݉\Ȏ̏NX擾
+					//		// 書き込み可能な軸の情報クラスを取得
 					//		if (GetWrite() != nullptr)
 					//		{
-					//			// ݉\Ȏ̏NX
+					//			// 書き込み可能な軸の情報クラスあり
 					//			ret = true;
 					//		}
 					//	}
 					//	catch (const std::exception& e)
 					//	{
-					//		// Ȍ
+					//		// 例外の処理
 					//		postscript << Logging::ConstSeparator << e.what();
 
-					//		// O𔭖C
+					//		// 例外を発砲
 					//		throw Exception::CObject(errorCode, deviceErrorCode, postscript.str());
 					//	}
 
@@ -215,20 +210,20 @@ namespace Standard
 					//}
 
 					//////////////////////////////////////////////////////////////////////////////////
-					///// @brief			ݒmF ̎{擾
-					///// @return			true:ݒ / false:݂Ȃ
+					///// @brief			書き込み中を確認 ※軸の実施中を取得
+					///// @return			true:書き込み中 / false:書き込みなし
 					//////////////////////////////////////////////////////////////////////////////////
 					//bool IsWriting() override
 					//{
 					//	bool ret = false;
 
-					//	// r
+					//	// 排他制御
 					//	std::lock_guard<std::recursive_mutex> lock(m_asyncSurveillances);
 
-					//	// ĎĂ鎲̏mF
+					//	// 監視している軸の情報を確認
 					//	if (0 < m_surveillances.size())
 					//	{
-					//		// Ď̎
+					//		// 監視中の軸あり
 					//		ret = true;
 					//	}
 
@@ -236,43 +231,43 @@ namespace Standard
 					//}
 
 					//////////////////////////////////////////////////////////////////////////////////
-					///// @brief			݉\Ȏ̃X[p[NX擾 䂷鎖\Ȏ̏擾
-					///// @detail			䂵ĂĎ̎Ɋ܂܂ĂꍇɂnullptrԂ
-					///// @param[in]		remove	ture:߂lɊY鏑݉\Ȏ̏NX폜 / false:߂lɊY鏑݉\Ȏ̏NX͍폜Ȃ
-					///// @return			̏NX
+					///// @brief			書き込み可能な軸のスーパークラスを取得 ※制御する事が可能な軸の情報を取得
+					///// @detail			制御したい軸あっても監視中の軸に含まれている場合にはnullptrを返す
+					///// @param[in]		remove	ture:戻り値に該当する書き込み可能な軸の情報クラスを削除 / false:戻り値に該当する書き込み可能な軸の情報クラスは削除しない
+					///// @return			軸の情報クラス
 					//////////////////////////////////////////////////////////////////////////////////
 					//std::shared_ptr<Write::CSuper> GetWrite(bool remove = false)
 					//{
 					//	std::shared_ptr<Write::CSuper> ret = nullptr;
 
-					//	// r
+					//	// 排他制御
 					//	std::lock_guard<std::recursive_mutex> lock(m_asyncWrite);
 
-					//	// ݉\Ȏ̃Ce[^
+					//	// 書き込み可能な軸のイテレータ
 					//	std::deque<std::shared_ptr<Write::CSuper>>::iterator extraction = m_writes.end();
 
-					//	// ݉\Ȏ瑖
+					//	// 書き込み可能な軸を後方から走査
 					//	for (auto write = m_writes.begin(); write != m_writes.end(); write++)
 					//	{
-					//		// ̔ԍvtO
+					//		// 軸の番号が一致フラグ
 					//		bool valid = false;
 
-					//		// r
+					//		// 排他制御
 					//		std::lock_guard<std::recursive_mutex> lock(m_asyncSurveillances);
 
-					//		// ĎĂ鎲̏𑖍
+					//		// 監視している軸の情報を走査
 					//		std::for_each(m_surveillances.begin(), m_surveillances.end(), [this, write, &valid](auto surveillance)
 					//		{
-					//			// ݉\Ȏ̔ԍ𑖍
+					//			// 書き込み可能な軸の番号を走査
 					//			for (const auto& source : (*write)->Indexs)
 					//			{
-					//				// ĎĂ鎲̔ԍ𑖍
+					//				// 監視している軸の番号を走査
 					//				for (const auto& target : surveillance->Indexs)
 					//				{
-					//					// ݉\Ȏ̔ԍƊĎĂ鎲̔ԍr
+					//					// 書き込み可能な軸の番号と監視している軸の番号を比較
 					//					if (source == target)
 					//					{
-					//						// ԍv
+					//						// 番号が一致
 					//						valid = true;
 					//						break;
 					//					}
@@ -280,24 +275,24 @@ namespace Standard
 					//			}
 					//		});
 
-					//		// ̔ԍvmF
+					//		// 軸の番号が一致を確認
 					//		if (valid == false)
 					//		{
-					//			// vԍȂ
+					//			// 一致する番号なし
 					//			extraction = write;
 					//		}
 					//	}
 
-					//	// ݉\Ȏ̃Ce[^mF
+					//	// 書き込み可能な軸のイテレータを確認
 					//	if (extraction != m_writes.end())
 					//	{
-					//		// ݉\Ȏ̏NXm
+					//		// 書き込み可能な軸の情報クラスを確定
 					//		ret = *extraction;
 
-					//		// 폜mF
+					//		// 削除を確認
 					//		if (remove)
 					//		{
-					//			// ݉\Ȏ폜
+					//			// 書き込み可能な軸を削除
 					//			m_writes.erase(extraction);
 					//		}
 					//	}
@@ -306,10 +301,10 @@ namespace Standard
 					//}
 
 				protected:
-					////! rNX(Ďf[^̃NXp)
+					////! 排他制御クラス(監視データのクラス用)
 					//std::recursive_mutex m_asyncSurveillances;
 
-					////! ĎĂ鎲̎wNX
+					////! 監視している軸の指定クラス
 					//std::vector<std::shared_ptr<Status::Output::CTemplate>> m_surveillances;
 				};
 			}
@@ -10,13 +10,13 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CSetting
-			/// @brief      ̊ĎA̐AԂʒmݒNX
+			/// @brief      軸の監視、軸の制御、状態を通知する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CSetting
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CSetting()
 				{
@@ -24,19 +24,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CSetting& operator = (const CSetting& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CSetting()
 				{
@@ -45,8 +45,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CSetting& object)
 				{
@@ -57,16 +57,16 @@ namespace Standard
 				}
 
 			public:
-				//! gC
+				//! リトライ回数
 				int Retry;
 
-				//! ̃ftHgȐݒNX
+				//! 軸のデフォルトな設定クラス
 				Setting::CDefault Default;
 
-				//! ֐ڑsݒNX
+				//! 軸へ接続を行う設定クラス
 				Setting::CConnect Connect;
 
-				//! ̑
+				//! その他
 				Variant::CManager Other;
 			};
 		}
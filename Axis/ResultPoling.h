@@ -8,20 +8,20 @@ namespace Standard
 {
 	namespace Axis
 	{
-		// Ď
+		// 軸を監視した結果
 		namespace Result
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CSuper
-			/// @brief      Ďʂ̃X[p[NX
-			///				 ԂĎʂ̊bNXp
+			/// @brief      軸を監視した結果のスーパークラス
+			///				⇒ 状態を監視した結果の基礎クラスから継承
 			////////////////////////////////////////////////////////////////////////////////
 			class CSuper
 				: virtual public Signal::Result::CBasis
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CSuper() : Signal::Result::CBasis()
 				{
@@ -29,19 +29,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CSuper& operator = (const CSuper& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CSuper()
 				{
@@ -50,12 +50,12 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CSuper& object)
 				{
-					// ̊֐
+					// 既定の関数
 					Signal::Result::CBasis::Update(object);
 				}
 			};
@@ -64,15 +64,15 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CBasis
-				/// @brief      ̃T[{𐧌䂵ʂ̊bNX
-				///				 Ďʂ̃X[p[NXp
+				/// @brief      軸のサーボを制御した結果の基礎クラス
+				///				⇒ 軸を監視した結果のスーパークラスから継承
 				////////////////////////////////////////////////////////////////////////////////
 				class CBasis
 					: virtual public Result::CSuper
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CBasis() : Result::CSuper()
 					{
@@ -80,19 +80,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CBasis& operator = (const CBasis& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					virtual ~CBasis()
 					{
@@ -101,19 +101,19 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CSuper& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CSuper::Update(object);
 					}
 				};
 			}
 		}
 
-		//! Ď̌ʂM֐
+		//! 監視の結果を受信する関数
 		typedef void(OnReceive)(std::shared_ptr<Result::CSuper>);
 	}
 }
\ No newline at end of file
@@ -11,15 +11,15 @@ namespace Standard
 	{
 		namespace Worker
 		{
-			//! ͂̕ωʒm֐̒`
+			//! 入力の変化を通知する関数の定義
 			typedef void(OnChange)(const Status::CInput&);
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CTemplate
-			/// @brief      ̐sev[g̃NX
-			///				 foCX̐sev[g̃NXh
-			/// @param[in]	CDefault	ftHgȐݒNXw
-			/// @param[in]	CConnect	ڑ̐ݒNXw
+			/// @brief      軸の制御を行うテンプレートのクラス
+			///				⇒ デバイスの制御を行うテンプレートのクラスから派生
+			/// @param[in]	CDefault	デフォルトな設定クラスを指定
+			/// @param[in]	CConnect	接続の設定クラスを指定
 			////////////////////////////////////////////////////////////////////////////////
 			template <typename CPoling>
 			class CTemplate
@@ -27,84 +27,136 @@ namespace Standard
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate() : Device::Worker::CTemplate<Setting::CDefault, Setting::CConnect>()
 				{
-					// ̂XV
+					// 名称を更新
 					SetName("Axis::");
 					m_noticeChange.SetName("Axis::Notice::");
+
+					m_noticed = 0;
+
+					// 入力の変化を統合する関数を登録 ⇒ アドレスごとに最新の値へ統合
+					m_noticeChange.AttachFunctionMerge([](Status::CInput& latest, const Status::CInput& object) { latest += object; });
+
+					// 入力の変化のキーを登録 ⇒ 未通知の変化は1つに統合して、通知時に最新の状態だけ渡す
+					m_noticeChange.AttachFunctionKey([](const Status::CInput&) { return (size_t)0; });
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CTemplate()
 				{
-					// ͂̕ωʒm֐̉
+					// 入力の変化を通知する関数の解除
 					DetachFunctionInput();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Ԃ̒ʒmJn
-				/// @detail			ʒm֐o^OɌĂяo
-				/// @param[in]		cycle	Ԃ̒ʒmĎԊu[ms]
+				/// @brief			状態の通知を開始
+				/// @detail			通知する関数を登録する前に呼び出す
+				/// @param[in]		cycle	状態の通知を監視する間隔[ms]
 				////////////////////////////////////////////////////////////////////////////////
 				void StartNotice(int cycle = 60000)
 				{
-					// Ԃ̒ʒmsݒ
+					// 状態の通知を行う周期を設定
 					m_noticeChange.SetCycle(cycle);
 
-					// Ԃ̒ʒmJn
+					// 状態の通知を開始
 					m_noticeChange.Start();
 
-					// Ԃ̒ʒmŏv
+					// 状態の通知で初期化を要求
 					m_noticeChange.RequestInitialize();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Ԃ̒ʒm~
-				/// @detail			ʒm֐ɌĂяo
+				/// @brief			状態の通知を停止
+				/// @detail			通知する関数を解除後に呼び出す
 				////////////////////////////////////////////////////////////////////////////////
 				void StopNotice()
 				{
-					// Ԃ̒ʒmŔjv
+					// 状態の通知で破棄を要求
 					m_noticeChange.RequestDestroy();
 
-					// Ԃ̒ʒm~
+					// 状態の通知を停止
 					m_noticeChange.Stop();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			͂̕ωʒm֐̓o^
-				/// @detail			͂̕ωɌĂяoꂽ֐w肷
-				/// @param[in]		object	Ăяoꂽ֐
+				/// @brief			入力の変化を通知する関数の登録
+				/// @detail			入力の変化時に呼び出されたい関数を指定する
+				/// @param[in]		object	呼び出されたい関数
 				////////////////////////////////////////////////////////////////////////////////
 				void AttachFunctionInput(std::function<void(const Status::CInput&)> object)
 				{
-					// Ԃ̒ʒmJn
+					// 状態の通知を開始
 					StartNotice();
 
-					// ͂̕ωʒm֐̓o^
+					// 入力の変化を通知する関数の登録
 					m_noticeChange.AttachFunctionCalled(object);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			͂̕ωʒm֐̉
-				/// @detail			͂̕ωɌĂяo֐
+				/// @brief			入力の変化をまとめて通知する関数の登録
+				/// @detail			溜まっている入力の変化をまとめて1回で通知する
+				/// @param[in]		object	呼び出されたい関数
+				////////////////////////////////////////////////////////////////////////////////
+				void AttachFunctionInputBatch(std::function<void(const std::vector<Status::CInput>&)> object)
+				{
+					// 状態の通知を開始
+					StartNotice();
+
+					// 入力の変化をまとめて通知する関数の登録
+					m_noticeChange.AttachFunctionBatch(object);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			入力の変化を通知する上限を更新
+				/// @detail			通知が遅れた場合に溜まる入力の変化の数を制限する
+				/// @param[in]		capacity	溜める数の上限 ※0の場合は無制限
+				/// @param[in]		overflow	上限に達した場合の動作
+				////////////////////////////////////////////////////////////////////////////////
+				void SetNoticeCapacity(size_t capacity, Notice::Worker::EnumOverflow overflow)
+				{
+					// 入力の変化を通知する上限を更新
+					m_noticeChange.SetCapacity(capacity, overflow);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			入力の変化で破棄した数を取得
+				/// @return			破棄した数
+				////////////////////////////////////////////////////////////////////////////////
+				size_t GetNoticeDropped()
+				{
+					return m_noticeChange.GetDropped();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			入力の変化で統合した数を取得
+				/// @return			統合した数
+				////////////////////////////////////////////////////////////////////////////////
+				size_t GetNoticeMerged()
+				{
+					return m_noticeChange.GetMerged();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			入力の変化を通知する関数の解除
+				/// @detail			入力の変化時に呼び出される関数を解除する
 				////////////////////////////////////////////////////////////////////////////////
 				void DetachFunctionInput()
 				{
-					// ͂̕ωʒm֐̉
+					// 入力の変化を通知する関数の解除
 					m_noticeChange.DetachFunctionCalled();
 
-					// Ԃ̒ʒm~
+					// 状態の通知を停止
 					StopNotice();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̐v
-				/// @param[in]		object	̏(o)w肷NX
+				/// @brief			軸の制御を要求
+				/// @param[in]		object	軸の状態(出力)を指定するクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Command(const Status::COutput& object)
 				{
@@ -116,35 +168,35 @@ namespace Standard
 
 					logging.Message << GetName() << "Command()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// 䂪\mF
+					// 制御が可能か確認
 					IsControllable();
 
 					try
 					{
 						Execution::CSetting setting;
 
-						// ̏(o)w肷NXXV
+						// 軸の状態(出力)を指定するクラスを更新
 						setting.Output = object;
 
-						// 𐧌o^
+						// 軸を制御を登録
 						postscript << "RequestWrite()";
 						m_poling.RequestWrite(setting);
 						postscript.str("");
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  OʒmC
+						// 例外の処理 ⇒ 例外を通知＆発砲
 						throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̐ҋ@
-				/// @param[in]		object	̏(o)w肷NX
+				/// @brief			軸の制御を待機
+				/// @param[in]		object	軸の状態(出力)を指定するクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void CommandPending(const Status::COutput& object)
 				{
@@ -156,71 +208,74 @@ namespace Standard
 
 					logging.Message << GetName() << "CommandPending()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// 䂪\mF
+					// 制御が可能か確認
 					IsControllable();
 
 					try
 					{
-						// gK[ҋ@NX
+						// トリガーを待機するクラス
 						Signal::Observer::CTemplate<Execution::CFinish> observer;
 
-						// gK[ʒm֐o^
+						// トリガーを通知をする関数を登録
 						postscript << "Subject::RegistrationFunction()";
 						std::shared_ptr<std::function<Execution::OnWakeup>> onWakeup = std::make_shared<std::function<Execution::OnWakeup>>(std::bind(&Signal::Observer::CTemplate<Execution::CFinish>::OnCalled, &observer, std::placeholders::_1));
 
-						// gK[ҋ@^CAEgXV
+						// トリガーを待機するタイムアウトを更新
 						observer.Setting.Timeout = object.Timeout;
 
 						Execution::CSetting setting;
 
-						// ̏(o)w肷NXXV
+						// 軸の状態(出力)を指定するクラスを更新
 						setting.Output = object;
 
-						// gK[ʒm֐XV
+						// トリガーを通知する関数を更新
 						setting.Wakeup = onWakeup;
 
-						// 𐧌o^
+						// 軸を制御を登録
 						postscript << "RequestWrite()";
 						m_poling.RequestWrite(setting);
 						postscript.str("");
 
-						// gK[҂
+						// トリガーを待つ
 						postscript << "Observer::Wait()";
 						observer.Wait();
-						// Oo
+						// 処理時間を追加
+						static Metrics::CHistogram& histogram = Transfer::GetHistogram("Axis::CommandPending()");
+						stopWatch.Record(histogram);
+						// ログ出力
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// ̌ʂ擾
+						// 制御の結果を取得
 						postscript << "Observer::GetArgument()";
 						Execution::CFinish result = observer.GetArgument();
 						postscript.str("");
 
-						// fmF
+						// 中断を確認
 						if (result.Suspension)
 						{
-							// f
-							postscript << "Observer::Trigger()" << Logging::ConstSeparator << "f";
+							// 中断
+							postscript << "Observer::Trigger()" << Logging::ConstSeparator << "中断";
 
-							// O𔭖C
+							// 例外を発砲
 							throw std::exception();
 						}
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  OʒmC
+						// 例外の処理 ⇒ 例外を通知＆発砲
 						throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			T[{𐧌䂵đҋ@
-				/// @param[in]		object	̃T[{(o)w肷NX
+				/// @brief			サーボを制御して待機
+				/// @param[in]		object	軸のサーボ状態(出力)を指定するクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Servo(const Status::Output::CServo& object)
 				{
@@ -230,22 +285,22 @@ namespace Standard
 
 					logging.Message << GetName() << "Servo()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
 					Status::COutput output;
 
-					// ̏(o)w肷NXXV
+					// 軸の状態(出力)を指定するクラスを更新
 					output.Command = object;
 
-					// ̐ҋ@
+					// 軸の制御を待機
 					CommandPending(output);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			_Asđҋ@
-				/// @param[in]		object	̌_Aw肷NX
+				/// @brief			原点復帰を実行して待機
+				/// @param[in]		object	軸の原点復帰を指定するクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void MoveOrigin(const Status::Output::CMoveOrigin& object)
 				{
@@ -255,22 +310,22 @@ namespace Standard
 
 					logging.Message << GetName() << "MoveOrigin()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
 					Status::COutput output;
 
-					// ̏(o)w肷NXXV
+					// 軸の状態(出力)を指定するクラスを更新
 					output.Command = object;
 
-					// ̐ҋ@
+					// 軸の制御を待機
 					CommandPending(output);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			WOJnđҋ@
-				/// @param[in]		object	̃WOsw肷NX
+				/// @brief			ジョグを開始して待機
+				/// @param[in]		object	軸のジョグ実行を指定するクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void StartJog(const Status::Output::CStartJog& object)
 				{
@@ -280,22 +335,22 @@ namespace Standard
 
 					logging.Message << GetName() << "StartJog()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
 					Status::COutput output;
 
-					// ̏(o)w肷NXXV
+					// 軸の状態(出力)を指定するクラスを更新
 					output.Command = object;
 
-					// ̐ҋ@
+					// 軸の制御を待機
 					CommandPending(output);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			WO~đҋ@
-				/// @param[in]		object	̃WO~w肷NX
+				/// @brief			ジョグを停止して待機
+				/// @param[in]		object	軸のジョグ停止を指定するクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void StopJog(const Status::Output::CStopJog& object)
 				{
@@ -305,22 +360,22 @@ namespace Standard
 
 					logging.Message << GetName() << "StopJog()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
 					Status::COutput output;
 
-					// ̏(o)w肷NXXV
+					// 軸の状態(出力)を指定するクラスを更新
 					output.Command = object;
 
-					// ̐ҋ@
+					// 軸の制御を待機
 					CommandPending(output);
 				}
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ς݂̗O𔭖C
+				/// @brief			初期化済みの例外を発砲
 				////////////////////////////////////////////////////////////////////////////////
 				void ExceptionInitialized() override
 				{
@@ -329,12 +384,12 @@ namespace Standard
 
 					logging.Message << GetName() << "ExceptionInitialized()" << Logging::ConstSeparator;
 
-					// O𔭖C
+					// 例外を発砲
 					OutputException(Exception::CodeAxisInitialized, logging, postscript.str());
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			jς݂̗O𔭖C
+				/// @brief			破棄済みの例外を発砲
 				////////////////////////////////////////////////////////////////////////////////
 				void ExceptionDiscarded() override
 				{
@@ -343,12 +398,12 @@ namespace Standard
 
 					logging.Message << GetName() << "ExceptionDiscarded()" << Logging::ConstSeparator;
 
-					// O𔭖C
+					// 例外を発砲
 					OutputException(Exception::CodeAxisDiscarded, logging, postscript.str());
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̗O𔭖C
+				/// @brief			未初期化の例外を発砲
 				////////////////////////////////////////////////////////////////////////////////
 				void ExceptionUninitialized() override
 				{
@@ -357,14 +412,14 @@ namespace Standard
 
 					logging.Message << GetName() << "ExceptionUninitialized()" << Logging::ConstSeparator;
 
-					// O𔭖C
+					// 例外を発砲
 					OutputException(Exception::CodeAxisUninitialized, logging, postscript.str());
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			
-				/// @detail			̃^C~OŌĂяo
-				///					|[O̗Oʒm֐o^A̍XVȂǍs
+				/// @brief			初期化
+				/// @detail			初期化のタイミングで呼び出される
+				///					※ポーリングの例外を通知する関数を登録、周期の更新など行う
 				////////////////////////////////////////////////////////////////////////////////
 				void InitializeDerived() override
 				{
@@ -376,58 +431,71 @@ namespace Standard
 
 					logging.Message << GetName() << "InitializeDerived()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
 					try
 					{
-						// OM֐̓o^
+						// 共有のスレッドプールでポーリングするかを更新
+						// ※通知する関数の登録で通知のスレッドが開始する為、先に更新する
+						postscript << "Poling::SetExecutor()";
+						m_poling.SetExecutor(GetDefaultSetting().Executor);
+						postscript.str("");
+
+						// 例外を受信する関数の登録
 						postscript << "Poling::AttachFunctionException()";
 						m_poling.AttachFunctionException(std::bind(&CTemplate::OnException, this, std::placeholders::_1));
 						postscript.str("");
 
-						// ͂M֐̓o^
+						// 入力を受信する関数の登録
 						postscript << "Poling::AttachFunctionCalled()";
 						m_poling.AttachFunctionCalled(std::bind(&CTemplate::OnInput, this, std::placeholders::_1));
 						postscript.str("");
 
-						// ftHg̐ݒNX擾
+						// デフォルトの設定クラスを取得
 						Setting::CDefault defaultSetting = GetDefaultSetting();
 
-						// |[O̎XV
+						// ポーリングの周期を更新
 						postscript << "Poling::SetCycle(" << defaultSetting.Cycle << ")";
 						m_poling.SetCycle(defaultSetting.Cycle);
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// |[Oׂ̐ݒ擾
+						// 変化がない間のポーリングの周期を更新
+						postscript << "Poling::SetCycleAdaptive(" << defaultSetting.CycleIdle << "," << defaultSetting.CycleHold << ")";
+						m_poling.SetCycleAdaptive(defaultSetting.CycleIdle, defaultSetting.CycleHold);
+						// ログ出力
+						Transfer::Output(Logging::Join(logging, postscript.str()));
+						postscript.str("");
+
+						// 軸をポーリングする為の設定を取得
 						postscript << "Poling::GetSetting()";
 						Poling::CSetting polingSetting = m_poling.GetSetting();
 						postscript.str("");
 
-						// ftHg̐ݒXV
+						// デフォルトの設定を更新
 						polingSetting.Default = defaultSetting;
 
-						// |[ÕgC
+						// ポーリングのリトライ回数
 						postscript << "Poling::Setting::Retry(" << polingSetting.Default.Retry << ")";
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// |[Õ^CAEg
+						// ポーリングのタイムアウト
 						postscript << "Poling::Setting::Timeout(" << polingSetting.Default.Timeout << ")";
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// |[Oׂ̐ݒXV
+						// 軸をポーリングする為の設定を更新
 						postscript << "Poling::SetSetting()";
 						m_poling.SetSetting(polingSetting);
 						postscript.str("");
 
-						// ̃|[OJn
+						// 軸のポーリングを開始
 						postscript << "Poling::Start()";
 						m_poling.Start();
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
@@ -435,15 +503,15 @@ namespace Standard
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  OʒmC
+						// 例外の処理 ⇒ 例外を通知＆発砲
 						throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			j
-				/// @detail			j̃^C~OŌĂяo
-				///					|[O̗Oʒm֐̉ȂǍs
+				/// @brief			破棄
+				/// @detail			破棄のタイミングで呼び出される
+				///					※ポーリングの例外を通知する関数の解除など行う
 				////////////////////////////////////////////////////////////////////////////////
 				void DestroyDerived() override
 				{
@@ -455,38 +523,38 @@ namespace Standard
 
 					logging.Message << GetName() << "DestroyDerived()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
 					try
 					{
-						// j
+						// 破棄
 						postscript << "Poling::Destroy()";
 						m_poling.Destroy();
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
 						postscript.str("");
 
-						// ͂M֐̉
+						// 入力を受信する関数の解除
 						postscript << "Poling::DetachFunctionCalled()";
 						m_poling.DetachFunctionCalled();
 						postscript.str("");
 
-						// OM֐̉
+						// 例外を受信する関数の解除
 						postscript << "Poling::DetachFunctionException()";
 						m_poling.DetachFunctionException();
 						postscript.str("");
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  OʒmC
+						// 例外の処理 ⇒ 例外を通知＆発砲
 						throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ڑ
-				///	@detail			ڑ̃^C~OŌĂяo
+				/// @brief			接続
+				///	@detail			接続のタイミングで呼び出される
 				////////////////////////////////////////////////////////////////////////////////
 				void ConnectDerived() override
 				{
@@ -498,34 +566,34 @@ namespace Standard
 
 					logging.Message << GetName() << "ConnectDerived()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
 					try
 					{
-						// j
+						// 破棄
 						postscript << "Poling::Destroy()";
 						m_poling.Destroy();
 						postscript.str("");
 
-						// |[Oׂ̐ݒ擾
+						// 軸をポーリングする為の設定を取得
 						postscript << "Poling::GetSetting()";
 						Poling::CSetting polingSetting = m_poling.GetSetting();
 						postscript.str("");
 
-						// ڑ̐ݒNX擾
+						// 接続の設定クラスを取得
 						Setting::CConnect connectSetting = GetConnectSetting();
 
-						// ڑ̐ݒXV
+						// 接続の設定を更新
 						polingSetting.Connect = connectSetting;
 
-						// |[Oׂ̐ݒXV
+						// 軸をポーリングする為の設定を更新
 						postscript << "Poling::SetSetting()";
 						m_poling.SetSetting(polingSetting);
 						postscript.str("");
 
-						// 
+						// 初期化
 						postscript << "Poling::Initialize()";
 						m_poling.Initialize();
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
@@ -533,14 +601,14 @@ namespace Standard
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  OʒmC
+						// 例外の処理 ⇒ 例外を通知＆発砲
 						throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ؒf
-				///	@detail			ؒf̃^C~OŌĂяo
+				/// @brief			切断
+				///	@detail			切断のタイミングで呼び出される
 				////////////////////////////////////////////////////////////////////////////////
 				void DisconnectDerived() override
 				{
@@ -552,13 +620,13 @@ namespace Standard
 
 					logging.Message << GetName() << "DisconnectDerived()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
 					try
 					{
-						// j
+						// 破棄
 						postscript << "Poling::Destroy()";
 						m_poling.Destroy();
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
@@ -566,219 +634,194 @@ namespace Standard
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  OʒmC
+						// 例外の処理 ⇒ 例外を通知＆発砲
 						throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 					}
 				}
 
 			private:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			O󂯎֐
-				/// @param[in]		object	ÕNX
+				/// @brief			例外を受け取る関数
+				/// @param[in]		object	例外のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void OnException(const Exception::CObject& object)
 				{
-					// Oʒm
+					// 例外を通知
 					NotifyException(object);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			MXV
-				/// @param[in]		logging		ÕNX
-				/// @param[in]		postscript	bZ[W
-				/// @param[in]		before		XVO̐M
-				/// @param[in]		after		XV̐M
-				/// @param[in]		target		M̔ԍ
-				/// @return			true:XV / false:XVȂ
+				/// @brief			信号を更新
+				/// @detail			変化した信号は監視で確定済みのため、有効な信号だけログ出力して更新する
+				/// @param[in]		logging		ログのクラス
+				/// @param[in]		header		ログの先頭
+				/// @param[in,out]	before		更新前の信号状態 ⇒ 更新後の信号状態
+				/// @param[in]		after		変化した信号状態
 				////////////////////////////////////////////////////////////////////////////////
-				bool UpdateInput(Logging::CObject& logging, std::stringstream& postscript, std::map<unsigned short, bool>& before, bool after, unsigned short target)
+				void UpdateInput(Logging::CObject& logging, const std::string& header, Status::Input::CSignal& before, const Status::Input::CSignal& after)
 				{
-					bool ret = false;
+					// 変化した信号を走査
+					for (unsigned short index = 0; index < Status::Input::ConstSignal; index++)
+					{
+						if (after.IsValid(index) == false)
+						{
+							continue;
+						}
+
+						std::stringstream postscript;
+
+						postscript << header << Text::Format(2, index) << Logging::ConstSeparator;
+
+						// 変化あり
+						if (before.IsValid(index))
+						{
+							postscript << (before.Get(index) ? "ON" : "OFF") << " → ";
+						}
 
-					do
+						// 新規or変化あり
+						postscript << (after.Get(index) ? "ON" : "OFF");
+						// ログ出力
+						Transfer::Output(Logging::Join(logging, postscript.str()));
+					}
+
+					// 信号を更新
+					before += after;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			座標を更新
+				/// @detail			変化した座標は監視で確定済みのため、有効な座標だけログ出力して更新する
+				/// @param[in]		logging		ログのクラス
+				/// @param[in]		header		ログの先頭
+				/// @param[in,out]	before		更新前の座標 ⇒ 更新後の座標
+				/// @param[in]		after		変化した座標
+				////////////////////////////////////////////////////////////////////////////////
+				void UpdateInput(Logging::CObject& logging, const std::string& header, Status::Input::CCoordinate& before, const Status::Input::CCoordinate& after)
+				{
+					// 変化した座標を走査
+					for (const auto& iterator : Status::Input::CoordinateIterator())
 					{
-						// Mo^ς݂mF
-						if (0 < before.count(target))
+						if (after.IsValid(iterator) == false)
 						{
-							// f[^  i[ς݂̒lƔr
-							if (before[target] == after)
-							{
-								// l̕ωȂ  𔲂
-								break;
-							}
-
-							// ω
-							postscript << (before[target] ? "ON" : "OFF") << "  ";
+							continue;
 						}
 
-						// VKorω
-						postscript << (after ? "ON" : "OFF");
-						before[target] = after;
+						std::stringstream postscript;
 
-						ret = true;
-					} while (false);
+						postscript << header << Text::Format(2, iterator) << Logging::ConstSeparator;
 
-					return ret;
+						// 変化あり
+						if (before.IsValid(iterator))
+						{
+							postscript << before.Get(iterator) << " → ";
+						}
+
+						// 新規or変化あり
+						postscript << after.Get(iterator);
+						// ログ出力
+						Transfer::Output(Logging::Join(logging, postscript.str()));
+					}
+
+					// 座標を更新
+					before += after;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			͂̃Cxg
-				/// @param[in]		object	IȌ()̃NX
+				/// @brief			入力のイベント
+				/// @detail			監視で変化した状態だけ通知されるが、取りこぼし後や読み込みの失敗後は全て通知されるため、
+				///					格納済みの状態と比較して変化した状態だけ更新・通知する
+				/// @param[in]		object	軸の状態(入力)のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void OnInput(const Status::CInput& object)
 				{
 					Logging::CObject logging;
-					std::stringstream postscript;
 
 					logging.Message << GetName() << "OnInput()" << Logging::ConstSeparator;
 
 					Status::CInput changedInput;
-					bool notify = false;
 
-					// 𑖍
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncData);
+
+					// 通知の取りこぼしを確認
+					if (object.Previous != m_input.Sequence)
+					{
+						std::stringstream postscript;
+
+						postscript << "連番の欠落:" << m_input.Sequence << " → " << object.Previous;
+						// ログ出力
+						Transfer::Output(Logging::Join(logging, postscript.str()));
+
+						// 取りこぼした変化を補うため、全ての状態の通知を要求
+						m_poling.RequestSnapshot();
+					}
+
+					// 軸を走査
 					for (const auto& driver : object.Drivers)
 					{
-						// 𑖍
-						for (const auto& motion : driver.second.Motion)
-						{
-							postscript << driver.second.Name;
-							postscript << Logging::ConstSeparator << "Xe[^X:" << Text::Format(2, motion.first);
-							postscript << Logging::ConstSeparator;
-
-							// r
-							std::lock_guard<std::recursive_mutex> lock(m_asyncData);
-
-							// MXV
-							if (UpdateInput(logging, postscript, m_input.Drivers[driver.first].Motion, motion.second, motion.first) == false)
-							{
-								// l̕ωȂ  ̐M
-								postscript.str("");
-								continue;
-							}
-
-							// VKorω
-							changedInput.Drivers[driver.first].Motion[motion.first] = motion.second;
-							// Oo
-							Transfer::Output(Logging::Join(logging, postscript.str()));
-							postscript.str("");
-
-							// l
-							notify = true;
-						}
+						auto& before = m_input.AddDriver(driver.Id);
 
-						// [jO𑖍
-						for (const auto& warning : driver.second.Warning)
-						{
-							postscript << driver.second.Name;
-							postscript << Logging::ConstSeparator << "[jO:" << Text::Format(2, warning.first);
-							postscript << Logging::ConstSeparator;
-
-							// r
-							std::lock_guard<std::recursive_mutex> lock(m_asyncData);
-
-							// MXV
-							if (UpdateInput(logging, postscript, m_input.Drivers[driver.first].Warning, warning.second, warning.first) == false)
-							{
-								// l̕ωȂ  ̐M
-								postscript.str("");
-								continue;
-							}
-
-							// VKorω
-							changedInput.Drivers[driver.first].Warning[warning.first] = warning.second;
-							// Oo
-							Transfer::Output(Logging::Join(logging, postscript.str()));
-							postscript.str("");
-
-							// l
-							notify = true;
-						}
+						before.Name = driver.Name;
 
-						// A[𑖍
-						for (const auto& alarm : driver.second.Alarm)
-						{
-							postscript << driver.second.Name;
-							postscript << Logging::ConstSeparator << "A[:" << Text::Format(2, alarm.first);
-							postscript << Logging::ConstSeparator;
-
-							// r
-							std::lock_guard<std::recursive_mutex> lock(m_asyncData);
-
-							// MXV
-							if (UpdateInput(logging, postscript, m_input.Drivers[driver.first].Alarm, alarm.second, alarm.first) == false)
-							{
-								// l̕ωȂ  ̐M
-								postscript.str("");
-								continue;
-							}
-
-							// VKorω
-							changedInput.Drivers[driver.first].Alarm[alarm.first] = alarm.second;
-							// Oo
-							Transfer::Output(Logging::Join(logging, postscript.str()));
-							postscript.str("");
-
-							// l
-							notify = true;
-						}
+						// 格納済みの状態と比較
+						auto change = driver.GetChange(before);
 
-						// W𑖍
-						for (const auto& coordinate : driver.second.Coordinate)
+						if (change.IsValid() == false)
 						{
-							postscript << driver.second.Name;
-							postscript << Logging::ConstSeparator << "W:" << Text::Format(2, coordinate.first);
-							postscript << Logging::ConstSeparator;
-
-							// r
-							std::lock_guard<std::recursive_mutex> lock(m_asyncData);
-
-							// Wo^ς݂mF
-							if (0 < m_input.Drivers[driver.first].Coordinate.count(coordinate.first))
-							{
-								// f[^  i[ς݂̒lƔr
-								if (::fabs(coordinate.second - m_input.Drivers[driver.first].Coordinate[coordinate.first]) <= 0)
-								{
-									// l̕ωȂ  ̈ʒu
-									postscript.str("");
-									continue;
-								}
-
-								// ω
-								postscript << m_input.Drivers[driver.first].Coordinate[coordinate.first] << "  ";
-							}
-
-							// VKorω
-							postscript << coordinate.second;
-							m_input.Drivers[driver.first].Coordinate[coordinate.first] = coordinate.second;
-							changedInput.Drivers[driver.first].Coordinate[coordinate.first] = coordinate.second;
-							// Oo
-							Transfer::Output(Logging::Join(logging, postscript.str()));
-							postscript.str("");
-
-							// l
-							notify = true;
+							// 変化なし ⇒ 次の軸へ
+							continue;
 						}
+
+						std::string header = driver.Name + Logging::ConstSeparator;
+
+						// 動作を更新
+						UpdateInput(logging, header + "動作ステータス:", before.Motion, change.Motion);
+
+						// ワーニングを更新
+						UpdateInput(logging, header + "ワーニング:", before.Warning, change.Warning);
+
+						// アラームを更新
+						UpdateInput(logging, header + "アラーム:", before.Alarm, change.Alarm);
+
+						// 座標を更新
+						UpdateInput(logging, header + "座標:", before.Coordinate, change.Coordinate);
+
+						changedInput.Drivers.emplace_back(change);
 					}
 
-					// ʒmf[^mF
-					if (notify)
+					// 連番と時刻を更新
+					m_input.Sequence = object.Sequence;
+					m_input.Timestamp = object.Timestamp;
+
+					// 通知するデータを確認
+					if (changedInput.Drivers.empty() == false)
 					{
-						// ʒmf[^  ͒l̕ωʒm
-						m_noticeChange.RequestNotice(changedInput);
+						// 通知する連番を確定 ※直前の連番は変化を通知した連番
+						changedInput.Sequence = object.Sequence;
+						changedInput.Previous = m_noticed;
+						changedInput.Timestamp = object.Timestamp;
+
+						m_noticed = object.Sequence;
+
+						// 通知するデータがある ⇒ 入力値の変化を通知 ※ポーリングを止めないように待機しない
+						m_noticeChange.RequestNotice(changedInput, false);
 					}
 				}
 
 			private:
-				//! rNX(f[^p)
+				//! 排他制御クラス(データ用)
 				std::recursive_mutex m_asyncData;
 
-				//! ̏()̃NX
+				//! 軸の状態(入力)のクラス
 				Status::CInput m_input;
 
-				//! ̊ĎA̐AԂʒmNX
+				//! 入力の変化を最後に通知した連番
+				uint64_t m_noticed;
+
+				//! 軸の監視、軸の制御、状態を通知するクラス
 				CPoling m_poling;
 
-				//! ͂̕ωʒmNX
+				//! 入力の変化を通知するクラス
 				Notice::Worker::CTemplate<OnChange, Status::CInput> m_noticeChange;
 			};
 		}
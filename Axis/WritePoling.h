@@ -8,20 +8,20 @@ namespace Standard
 {
 	namespace Axis
 	{
-		// ̐s
+		// 軸の制御を行う情報
 		namespace Write
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CSuper
-			/// @brief      𐧌䂷̃X[p[NX
-			///				 ԂĎ̊bNXp
+			/// @brief      軸を制御する情報のスーパークラス
+			///				⇒ 状態を監視する情報の基礎クラスから継承
 			////////////////////////////////////////////////////////////////////////////////
 			class CSuper
 				: virtual public Signal::Write::CBasis<Result::CSuper, Axis::OnReceive>
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CSuper() : Signal::Write::CBasis<Result::CSuper, Axis::OnReceive>()
 				{
@@ -29,19 +29,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CSuper& operator = (const CSuper& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CSuper()
 				{
@@ -50,12 +50,12 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CSuper& object)
 				{
-					// ̊֐
+					// 既定の関数
 					Signal::Write::CBasis<Result::CSuper, Axis::OnReceive>::Update(object);
 
 					this->Indexs.clear();
@@ -63,7 +63,7 @@ namespace Standard
 				}
 
 			public:
-				//! gp鎲̔ԍ
+				//! 使用する軸の番号
 				std::vector<int> Indexs;
 			};
 
@@ -71,15 +71,15 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CSuper
-				/// @brief      ̃T[{𐧌䂷̊bNX
-				///				 𐧌䂷̃X[p[NXp
+				/// @brief      軸のサーボを制御する情報の基礎クラス
+				///				⇒ 軸を制御する情報のスーパークラスから継承
 				////////////////////////////////////////////////////////////////////////////////
 				class CBasis
 					: virtual public Write::CSuper
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CBasis() : Write::CSuper()
 					{
@@ -87,19 +87,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CBasis& operator = (const CBasis& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					virtual ~CBasis()
 					{
@@ -108,8 +108,8 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CBasis& object)
 					{
@@ -117,7 +117,7 @@ namespace Standard
 					}
 
 				public:
-					//! T[{̏
+					//! サーボの状態
 					Signal::EnumStatus Mode;
 				};
 			}
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "Poling.h"
+
+#include "WrapperMotionApi/Status.h"
+
+namespace Standard
+{
+	namespace Axis
+	{
+		namespace Poling
+		{
+			namespace Convert
+			{
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			入力レジスタの値を機器の状態を保持するクラスへ変換
+				/// @param[in]		object	レジスタの値クラス
+				/// @param[in]		offset	軸の先頭からのワード数
+				/// @return			機器の状態を保持するクラス
+				////////////////////////////////////////////////////////////////////////////////
+				inline Axis::Status::Input::CDriver Input(const Plc::Register::Result::CContent& object, unsigned long offset)
+				{
+					Axis::Status::Input::CDriver ret;
+
+					unsigned long warning = 0;
+					unsigned long alarm = 0;
+					unsigned long coordinate = 0;
+
+					// レジスタの値を格納
+					for (size_t index = 0; index < ConstRegisterSize && offset + index < object.Words.size(); index++)
+					{
+						// ワード型のデータ ※番号は軸の先頭からのオフセット
+						short numeric = object.Words[offset + index];
+
+						switch (index)
+						{
+						case 0x00:
+							// 運転ステータス ⇒ 運転ステータスの信号を走査
+							for (const auto& iterator : MotionApi::Status::RunningIterator())
+							{
+								// 信号を分解
+								bool buffer = ((unsigned short)numeric >> iterator & 0x01 ? true : false);
+
+								switch (iterator)
+								{
+								case MotionApi::Status::RunningServo:
+									// 運転中(サーボON) ⇒ サーボON
+									ret.Motion.Set(Status::Input::MotionServo, buffer);
+									break;
+								}
+							}
+							break;
+
+						case 0x02:
+							// ワーニング ⇒ 下位を更新
+							warning = (unsigned long)numeric & 0x0000FFFF;
+							break;
+
+						case 0x03:
+							// ワーニング ⇒ 上位を更新
+							warning |= (unsigned long)numeric << 16 & 0xFFFF0000;
+
+							// ワーニングの信号を走査
+							for (const auto& iterator : MotionApi::Status::WarningIterator())
+							{
+								// ワーニングを更新
+								ret.Warning.Set(iterator, (warning >> iterator & 0x01 ? true : false));
+							}
+							break;
+
+						case 0x04:
+							// アラーム ⇒ 下位を更新
+							alarm = (unsigned long)numeric & 0x0000FFFF;
+							break;
+
+						case 0x05:
+							// アラーム ⇒ 上位を更新
+							alarm |= (unsigned long)numeric << 16 & 0xFFFF0000;
+
+							// アラームの信号を走査
+							for (const auto& iterator : MotionApi::Status::AlarmIterator())
+							{
+								// アラームを更新
+								ret.Alarm.Set(iterator, (alarm >> iterator & 0x01 ? true : false));
+							}
+							break;
+
+						case 0x09:
+							// モーションコマンドステータス	⇒ コマンドステータスの信号を走査
+							for (const auto& iterator : MotionApi::Status::CommandIterator())
+							{
+								// 信号を分解
+								bool buffer = ((unsigned short)numeric >> iterator & 0x01 ? true : false);
+
+								switch (iterator)
+								{
+								case MotionApi::Status::CommandRunning:
+									// 実行中 ⇒ 実行中
+									ret.Motion.Set(Status::Input::MotionRunning, buffer);
+									break;
+
+								case MotionApi::Status::CommandAbnormalFinish:
+									// 異常終了状態 ⇒ 異常
+									ret.Motion.Set(Status::Input::MotionAbnormal, buffer);
+									break;
+
+								case MotionApi::Status::CommandCompleted:
+									// 実行完了 ⇒ 実行完了
+									ret.Motion.Set(Status::Input::MotionCompleted, buffer);
+									break;
+								}
+							}
+							break;
+
+						case 0x0C:
+							// 位置ステータス ⇒ 位置ステータスの信号を走査
+							for (const auto& iterator : MotionApi::Status::PositionIterator())
+							{
+								// 信号を分解
+								bool buffer = ((unsigned short)numeric >> iterator & 0x01 ? true : false);
+
+								switch (iterator)
+								{
+								case MotionApi::Status::PositionOriginCompleted:
+									// 原点復帰完了 ⇒ 原点復帰完了
+									ret.Motion.Set(Status::Input::MotionOrigin, buffer);
+									break;
+								}
+							}
+							break;
+
+						case 0x16:
+							// 機械座標系フィードバック位置(APOS) ⇒ 下位を更新
+							coordinate = (unsigned long)numeric & 0x0000FFFF;
+							break;
+
+						case 0x17:
+							// 機械座標系フィードバック位置(APOS) ⇒ 上位を更新
+							coordinate |= (unsigned long)numeric << 16 & 0xFFFF0000;
+
+							// 現在の座標を更新
+							ret.Coordinate.Set(Status::Input::CoordinateCurrent, (double)(signed long)coordinate);
+							break;
+						}
+					}
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			出力レジスタの値を機器の状態を保持するクラスへ変換
+				/// @param[in]		object	レジスタの値クラス
+				/// @param[in]		offset	軸の先頭からのワード数
+				/// @return			機器の状態を保持するクラス
+				////////////////////////////////////////////////////////////////////////////////
+				inline Axis::Status::Input::CDriver Output(const Plc::Register::Result::CContent& object, unsigned long offset)
+				{
+					Axis::Status::Input::CDriver ret;
+
+					unsigned long negativeLimit = 0;
+					unsigned long positiveLimit = 0;
+
+					// レジスタの値を格納
+					for (size_t index = 0; index < ConstRegisterSize && offset + index < object.Words.size(); index++)
+					{
+						// ワード型のデータ ※番号は軸の先頭からのオフセット
+						short numeric = object.Words[offset + index];
+
+						switch (index)
+						{
+						case 0x66:
+							// 正方向ソフトリミット ⇒ 下位を更新
+							positiveLimit = (unsigned long)numeric & 0x0000FFFF;
+							break;
+
+						case 0x67:
+							// 正方向ソフトリミット ⇒ 上位を更新
+							positiveLimit |= (unsigned long)numeric << 16 & 0xFFFF0000;
+
+							// 正方向ソフトリミットを更新
+							ret.Coordinate.Set(Status::Input::CoordinatePositiveLimit, (double)(signed long)positiveLimit);
+							break;
+
+						case 0x68:
+							// 負方向ソフトリミット ⇒ 下位を更新
+							negativeLimit = (unsigned long)numeric & 0x0000FFFF;
+							break;
+
+						case 0x69:
+							// 負方向ソフトリミット ⇒ 上位を更新
+							negativeLimit |= (unsigned long)numeric << 16 & 0xFFFF0000;
+
+							// 負方向ソフトリミットを更新
+							ret.Coordinate.Set(Status::Input::CoordinateNegativeLimit, (double)(signed long)negativeLimit);
+							break;
+						}
+					}
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			軸の状態をまとめて読み込むレジスタの範囲へ変換
+				/// @detail			軸の先頭アドレス順に走査して、隣接・重複するレジスタを1つの範囲にまとめる
+				///					※範囲は最大ワード数まで ⇒ 離れている場合と最大ワード数を超える場合は範囲を分ける
+				/// @param[in]		object	軸の識別子ごとの状態
+				/// @return			まとめて読み込むレジスタの範囲(先頭アドレス順)
+				////////////////////////////////////////////////////////////////////////////////
+				inline std::vector<CScan> Scan(const std::map<int, CStatus>& object)
+				{
+					std::vector<CScan> ret;
+
+					std::vector<std::pair<unsigned long, int>> addresses;
+
+					// 全軸を走査
+					for (const auto& status : object)
+					{
+						addresses.emplace_back(status.second.Address, status.first);
+					}
+
+					// 先頭アドレス順に並び替え
+					std::sort(addresses.begin(), addresses.end());
+
+					// 先頭アドレスを走査
+					for (const auto& address : addresses)
+					{
+						// 直前の範囲から離れているか、まとめると最大ワード数を超えるか確認
+						if (ret.empty() || ret.back().Address + ret.back().Size < address.first || ConstScanMaximum < address.first + ConstRegisterSize - ret.back().Address)
+						{
+							CScan scan;
+
+							// 範囲を追加
+							scan.Address = (unsigned short)address.first;
+							ret.emplace_back(scan);
+						}
+
+						auto& scan = ret.back();
+						unsigned long offset = address.first - scan.Address;
+
+						// 範囲を更新
+						scan.Size = (std::max)(scan.Size, offset + ConstRegisterSize);
+						scan.Offsets[address.second] = offset;
+					}
+
+					return ret;
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -1,4 +1,8 @@
+#include <chrono>
+#include <cstring>
+
 #include "Poling.h"
+#include "Convert.h"
 #include "Common/Tool/Variant.h"
 
 #include "WrapperMotionApi/Status.h"
@@ -15,15 +19,29 @@ namespace Standard
 		namespace Poling
 		{
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			軸のレジスタが前回と同じ値か確認
+			/// @detail			1軸分のレジスタの値をまとめて比較する
+			/// @param[in]		before	前回の値
+			/// @param[in]		after	今回の値
+			/// @param[in]		offset	軸の先頭からのワード数
+			/// @return			true:同じ / false:新規or変化あり
+			////////////////////////////////////////////////////////////////////////////////
+			static bool IsSame(const std::vector<short>& before, const std::vector<short>& after, unsigned long offset)
+			{
+				return offset + ConstRegisterSize <= before.size() && offset + ConstRegisterSize <= after.size() && std::memcmp(&before[offset], &after[offset], ConstRegisterSize * sizeof(short)) == 0;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CWorker::CWorker() : Worker::CTemplate()
 			{
 				m_controller.Handle = MotionApi::ConstDisconnected;
+				m_sequence = 0;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CWorker::~CWorker()
 			{
@@ -31,17 +49,17 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			ڑ̏Ԃ擾
-			/// @return			true:ڑς / false:ڑ
+			/// @brief			接続の状態を取得
+			/// @return			true:接続済み / false:未接続
 			////////////////////////////////////////////////////////////////////////////////
 			bool CWorker::GetConnected()
 			{
 				bool ret = false;
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncController);
 
-				// nhmF
+				// ハンドルを確認
 				if (m_controller.Handle != MotionApi::ConstDisconnected)
 				{
 					ret = true;
@@ -51,7 +69,7 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			ڑς݂mF
+			/// @brief			接続済みを確認
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::IsConnected()
 			{
@@ -64,26 +82,26 @@ namespace Standard
 
 				try
 				{
-					// ڑ̏Ԃ擾
+					// 接続の状態を取得
 					postscript << "GetConnected()";
 					if (GetConnected() == false)
 					{
-						// ڑ  O𔭖C
-						throw std::exception("ڑ");
+						// 未接続 ⇒ 例外を発砲
+						throw std::exception("未接続");
 					}
 					postscript.str("");
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  OʒmC
+					// 例外の処理 ⇒ 例外を通知＆発砲
 					throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			
-			/// @detail			CXbh珉̃^C~OŌĂяo
-			///					p֐
+			/// @brief			初期化
+			/// @detail			メインスレッドから初期化のタイミングで呼び出される
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::InitializeDerived()
 			{
@@ -101,126 +119,131 @@ namespace Standard
 					Poling::CSetting polingSetting = GetSetting();
 					Plc::Controller::Setting::CInitialize settingController;
 
-					// ̂XV
+					// 名称を更新
 					settingController.Name = GetName();
 
-					// Rg[Jݒ擾
+					// コントローラを開く設定を取得
 					postscript << "OpenController";
 					auto buffer = polingSetting.Connect.Other.GetValue<Plc::EnumParameter>(Plc::ParameterOpenController);
 
-					// Rg[Jݒ肪LmF
+					// コントローラを開く設定が有効か確認
 					if (Variant::IsValue<std::string>(buffer))
 					{
-						// Rg[JݒXV
+						// コントローラを開く設定を更新
 						settingController.Open.Input(Variant::Convert<std::string>(buffer));
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 					}
 					postscript.str("");
 
-					// Apĩ^CAEg擾
+					// Apiのタイムアウトを取得
 					postscript << "ApiTimeout";
 					buffer = polingSetting.Connect.Other.GetValue<Plc::EnumParameter>(Plc::ParameterApiTimeout);
 
-					// Apĩ^CAEgLmF
+					// Apiのタイムアウトが有効か確認
 					if (Variant::IsValue<std::string>(buffer))
 					{
-						// Apĩ^CAEgXV
+						// Apiのタイムアウトを更新
 						settingController.ApiTimeout.Input(Variant::Convert<std::string>(buffer));
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 					}
 
-					// Rg[
+					// コントローラを初期化
 					postscript << "Plc::Controller::Initialize()";
 					auto resultInitialize = Plc::Controller::Initialize(settingController);
 					postscript.str("");
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncController);
 
-					// Rg[̏XV
+					// コントローラの情報を更新
 					m_controller = resultInitialize.Controller;
 
-					// j
+					// 軸を破棄
 					postscript << "Clear()";
 					Clear();
 					postscript.str("");
 
-					// 
+					// 軸を初期化
 					for (auto& driver : polingSetting.Connect.Drivers)
 					{
-						postscript << "No:" << driver.first;
-						postscript << Logging::ConstSeparator << ":" << driver.second.Name;
+						postscript << "識別No:" << driver.first;
+						postscript << Logging::ConstSeparator << "名称:" << driver.second.Name;
 
-						// ̃nh쐬ݒ擾
+						// 軸のハンドルを作成する設定を取得
 						buffer = driver.second.Other.GetValue<Plc::EnumParameter>(Plc::ParameterDeclareAxis);
 
-						// ̃nh쐬ݒ肪LmF
+						// 軸のハンドルを作成する設定が有効か確認
 						if (Variant::IsValue<MotionApi::Axis::Setting::CDeclare>(buffer) == false)
 						{
-							// ̃nh쐬ݒ肪
-							throw std::exception("ݒȂ");
+							// 軸のハンドルを作成する設定が無効
+							throw std::exception("設定なし");
 						}
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
 						Plc::Axis::Setting::CInitialize settingAxis;
 						CStatus status;
 
-						// ̂XV
+						// 名称を更新
 						settingAxis.Name = GetName();
 
-						// ̃nh쐬NXɕϊ
+						// 軸のハンドルを作成するクラスに変換
 						postscript << "Variant::Convert()";
 						settingAxis.Declare = Variant::Convert<MotionApi::Axis::Setting::CDeclare>(buffer);
 						postscript.str("");
 
-						// 
+						// 軸を初期化
 						postscript << "Plc::Axis::Initialize()";
 						auto result = Plc::Axis::Initialize(settingAxis);
 						postscript.str("");
 
-						// ̖̂XV
+						// 軸の名称を更新
 						status.Name = driver.second.Name;
 
-						// ̃nhXV
+						// 軸のハンドルを更新
 						status.Handle = result.Axis.Handle;
 
-						// 擪AhXXV
+						// 先頭アドレスを更新
 						status.Address = settingAxis.Declare.Address;
 
-						// \XV
+						// 分解能を更新
 						status.Resolution = settingAxis.Declare.Resolution;
 
-						// ̏Ԃǉ
+						// 軸の状態を追加
 						postscript << "Addition()";
 						AdditionStatus(driver.first, status);
 						postscript.str("");
 					}
 
-					// ̊N
+					// まとめて読み込むレジスタの範囲を作成
+					postscript << "Plan()";
+					Plan();
+					postscript.str("");
+
+					// 初期化の完了を起床
 					postscript << "WakeupInitializeComplete()" << Logging::ConstSeparator << stopWatch.Format(true);
 					WakeupInitializeComplete(trigger);
 					postscript.str("");
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  ̊N
+					// 例外の処理 ⇒ 初期化の完了を起床
 					trigger.Suspension = true;
 					trigger.Message = e.what();
 					WakeupInitializeComplete(trigger);
 
-					// O𔭖C
+					// 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			j
-			/// @detail			CXbhj̃^C~OŌĂяo
-			///					p֐
+			/// @brief			破棄
+			/// @detail			メインスレッドから破棄のタイミングで呼び出される
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::DestroyDerived()
 			{
@@ -237,15 +260,15 @@ namespace Standard
 				{
 					do
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncController);
 
-						// ڑ̏ԂmF
+						// 接続の状態を確認
 						if (GetConnected() == false)
 						{
-							// ڑ
-							postscript << "ڑ";
-							// Oo
+							// 未接続
+							postscript << "未接続";
+							// ログ出力
 							Transfer::Output(Logging::Join(logging, postscript.str()));
 							postscript.str("");
 							break;
@@ -253,53 +276,53 @@ namespace Standard
 
 						Plc::Axis::Setting::CDestroy settingAxis;
 
-						// ̂XV
+						// 名称を更新
 						settingAxis.Name = GetName();
 
-						// 
+						// 軸を解放
 						postscript << "Clear()";
 						Clear();
 						postscript.str("");
 
 						Plc::Controller::Setting::CDestroy settingController;
 
-						// ̂XV
+						// 名称を更新
 						settingController.Name = GetName();
 
-						// nhXV
+						// ハンドルを更新
 						settingController.Close.Handle = m_controller.Handle;
 
-						// Rg[j
+						// コントローラを破棄
 						postscript << "Plc::Controller::Destroy()";
 						Plc::Controller::Destroy(settingController);
 						postscript.str("");
 
-						// nh
+						// ハンドルを初期化
 						m_controller.Handle = MotionApi::ConstDisconnected;
 					} while (false);
 
-					// j̊N
+					// 破棄の完了を起床
 					postscript << "WakeupDestroyComplete()" << Logging::ConstSeparator << stopWatch.Format(true);
 					WakeupDestroyComplete(trigger);
 					postscript.str("");
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  j̊N
+					// 例外の処理 ⇒ 破棄の完了を起床
 					trigger.Suspension = true;
 					trigger.Message = e.what();
 					WakeupDestroyComplete(trigger);
 
-					// O𔭖C
+					// 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			gCmF
-			///	@detail			gC̔hŋLq
-			///					p֐
-			/// @return			true:gCL / false:gC
+			/// @brief			リトライを確認
+			///	@detail			リトライの判定を派生先で記述する
+			///					★継承した関数
+			/// @return			true:リトライが有効 / false:リトライが無効
 			////////////////////////////////////////////////////////////////////////////////
 			bool CWorker::IsRetry()
 			{
@@ -313,21 +336,21 @@ namespace Standard
 				Poling::CSetting polingSetting = GetSetting();
 				int retry = GetRetry();
 
-				logging.Message << "gC" << retry << "" << Logging::ConstSeparator;
+				logging.Message << "リトライ" << retry << "回目" << Logging::ConstSeparator;
 
-				// gC񐔂𔻒
+				// リトライ回数を判定
 				if (retry <= polingSetting.Retry)
 				{
-					// gC񐔂ݒȉ  gCL
+					// リトライ回数が設定以下 ⇒ リトライを有効
 					ret = true;
-					logging.Message << "L";
+					logging.Message << "有効";
 				}
 				else
 				{
-					// gC񐔂ݒ傫
-					logging.Message << "";
+					// リトライ回数が設定より大きい
+					logging.Message << "無効";
 				}
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
@@ -335,25 +358,44 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			gC̒xԂ擾
-			///	@detail			gC̒xԂ擾
-			///					p֐
-			/// @return			gC̒x[ms]
+			/// @brief			リトライの遅延時間を取得
+			///	@detail			リトライの遅延時間を取得する
+			///					★継承した関数
+			/// @return			リトライの遅延時間[ms]
 			////////////////////////////////////////////////////////////////////////////////
 			int CWorker::GetDelayRetry()
 			{
 				int ret = 0;
 
-				// gC̒x
+				// リトライの遅延時間
 				ret = 1000;
 
 				return ret;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			ǂݍ
-			/// @detail			CXbhǂݍ݂̃^C~OŌĂяo
-			///					p֐
+			/// @brief			短い周期の読み込みが必要か確認
+			///	@detail			軸の完了を監視中は短い周期で読み込む
+			///					★継承した関数
+			/// @return			true:必要 / false:不要
+			////////////////////////////////////////////////////////////////////////////////
+			bool CWorker::IsActive()
+			{
+				bool ret = false;
+
+				// 軸を監視する数を確認
+				if (0 < GetSurveillanceSize())
+				{
+					ret = true;
+				}
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			読み込み
+			/// @detail			メインスレッドから読み込みのタイミングで呼び出される
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::ReadDerived()
 			{
@@ -363,18 +405,22 @@ namespace Standard
 				int deviceErrorCode = Exception::DeviceCodeSuccess;
 				Utility::CStopWatch stopWatch;
 
+				// 処理時間を計測
+				static Metrics::CHistogram& histogram = Transfer::GetHistogram("Axis::ReadDerived()");
+				Metrics::CScope scope(histogram);
+
 				logging.Message << GetName() << "ReadDerived()" << Logging::ConstSeparator;
 
-				// Oo
+				// ログ出力
 				//@@@Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
 				try
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncController);
 
-					// ڑς݂mF
+					// 接続済みを確認
 					postscript << "IsConnected()";
 					IsConnected();
 					postscript.str("");
@@ -383,137 +429,204 @@ namespace Standard
 
 					Axis::Status::CInput input;
 
-					// S̏Ԃ擾
+					// 全ての状態の通知の要求を確認
+					if (IsRequestSnapshot())
+					{
+						// 要求あり ⇒ 前回の値を破棄
+						ClearImage();
+					}
+
+					// 全軸の状態を取得
 					postscript << "GetStatus()";
 					auto statuses = GetStatus();
 					postscript.str("");
 
-					// Ďԍ擾
+					// 監視する番号を取得
 					auto size = GetSurveillanceSize();
 					std::map<size_t, bool> completes;
 
-					// Ď𑖍
+					// 監視を走査
 					for (size_t index = 0; index < size; index++)
 					{
-						// Ďɐݒ
+						// 監視を完了に設定
 						completes[index] = true;
 					}
 
-					// S𑖍
-					for (const auto& status : statuses)
+					// 機器の状態の領域を確保
+					input.Drivers.reserve(statuses.size());
+
+					// まとめて読み込むレジスタの範囲を走査
+					for (size_t range = 0; range < m_scans.size(); range++)
 					{
+						const auto& scan = m_scans[range];
+
 						Plc::Register::Setting::CGetContent content;
 
-						// ̂XV
+						// 名称を更新
 						content.Name = GetName();
 
-						// WX^̎ʂm
+						// レジスタの種別を確定
 						content.Category = Plc::Register::ConstCategoryI;
 						content.Category += Plc::Register::ConstTypeWord;
-						// WX^̔ԍm
-						content.Index = status.second.Address;
-						// WX^͈̔͂m
-						content.Size = 0x80;
+						// レジスタの番号を確定
+						content.Index = scan.Address;
+						// レジスタの範囲を確定
+						content.Size = scan.Size;
 
-						// ̓WX^̓ǂݍ
+						// 入力レジスタの読み込み
 						postscript << "Plc::Register::Get()";
-						auto result = Plc::Register::Get(content);
+						auto inputs = Plc::Register::Get(content);
 						postscript.str("");
 
-						// ̓WX^̒l@̏ԂێNX֕ϊ
-						auto driver = ConvertInput(result);
-
-						// WX^̎ʂXV
+						// レジスタの種別を更新
 						content.Category = Plc::Register::ConstCategoryO;
 						content.Category += Plc::Register::ConstTypeWord;
 
-						// o̓WX^̓ǂݍ
+						// 出力レジスタの読み込み
 						postscript << "Plc::Register::Get()";
-						result = Plc::Register::Get(content);
+						auto outputs = Plc::Register::Get(content);
 						postscript.str("");
 
-						// o̓WX^̒l@̏ԂێNX֕ϊ
-						driver += ConvertOutput(result);
+						// 範囲内の軸を走査
+						for (const auto& offset : scan.Offsets)
+						{
+							// 軸の状態を確認
+							if (statuses.count(offset.first) <= 0)
+							{
+								// 軸の状態なし
+								continue;
+							}
+
+							const auto& status = statuses[offset.first];
 
-						// ̂XV
-						driver.Name = status.second.Name;
+							// 前回の機器の状態
+							auto& previous = m_previous.AddDriver(offset.first);
 
-						// ʒu̒Pʂϊ
-						driver.Coordinate[Status::Input::CoordinateNegativeLimit] *= status.second.Resolution;
-						driver.Coordinate[Status::Input::CoordinatePositiveLimit] *= status.second.Resolution;
-						driver.Coordinate[Status::Input::CoordinateCurrent] *= status.second.Resolution;
+							// 軸のレジスタが前回と同じか確認 ⇒ 同じ場合は変換しない
+							if (IsSame(m_images[range * 2].Words, inputs.Words, offset.second) == false || IsSame(m_images[range * 2 + 1].Words, outputs.Words, offset.second) == false)
+							{
+								// 入力レジスタの値を機器の状態を保持するクラスへ変換
+								auto driver = Convert::Input(inputs, offset.second);
 
-						// @̏ԂێNXXV
-						input.Drivers[status.first] = driver;
+								// 出力レジスタの値を機器の状態を保持するクラスへ変換
+								driver += Convert::Output(outputs, offset.second);
 
-						// Ď𑖍
-						for (int index = 0; index < size; index++)
-						{
-							// Ď擾
-							auto surveillance = GetSurveillance(index);
+								// 名称を更新
+								driver.Name = status.Name;
+
+								// 位置の単位を変換
+								for (const auto& iterator : Status::Input::CoordinateIterator())
+								{
+									if (driver.Coordinate.IsValid(iterator))
+									{
+										driver.Coordinate.Set(iterator, driver.Coordinate.Get(iterator) * status.Resolution);
+									}
+								}
+
+								// 軸の識別子を更新
+								driver.Id = offset.first;
 
-							// Ď̎𑖍
-							for (const auto& id : surveillance.Ids)
+								// 変化した状態を取得
+								auto change = driver.GetChange(previous);
+
+								// 変化を確認
+								if (change.IsValid())
+								{
+									// 変化した状態だけ追加
+									input.Drivers.emplace_back(change);
+								}
+
+								// 前回の機器の状態を更新
+								previous = driver;
+							}
+
+							const auto& driver = previous;
+
+							// 監視を走査
+							for (int index = 0; index < size; index++)
 							{
-								// Ď̏ԂmF
-								switch (surveillance.Status)
+								// 監視を取得
+								auto surveillance = GetSurveillance(index);
+
+								// 監視の軸を走査
+								for (const auto& id : surveillance.Ids)
 								{
-								case CSurveillance::StatusFinish:
-									// I
-									if (driver.Motion[Status::Input::MotionCompleted] == false && driver.Motion[Status::Input::MotionAbnormal] == false)
+									// 監視の状態を確認
+									switch (surveillance.Status)
 									{
-										// ُIƎsOFF
-										completes[index] = false;
+									case CSurveillance::StatusFinish:
+										// 終了
+										if (driver.Motion.Get(Status::Input::MotionCompleted) == false && driver.Motion.Get(Status::Input::MotionAbnormal) == false)
+										{
+											// 異常終了と実行完了が共にOFF
+											completes[index] = false;
+										}
+										break;
 									}
-									break;
 								}
 							}
 						}
+
+						// 前回の値を更新
+						m_images[range * 2] = inputs;
+						m_images[range * 2 + 1] = outputs;
 					}
 
 					std::vector<size_t> indexs;
 
-					// Ď̏Ԃ𑖍
+					// 監視の状態を走査
 					for (const auto& complete : completes)
 					{
-						// Ď̊mF
+						// 監視の完了を確認
 						if (complete.second)
 						{
-							// Ď  Ď擾
+							// 監視を完了 ⇒ 監視を取得
 							auto surveillance = GetSurveillance(complete.first);
 
 							Execution::CFinish finish;
 
-							// Ď̊ʒm
+							// 監視の完了を通知
 							WakeupFinish(finish, surveillance.Wakeup);
 
-							// Ď̍폜ɓo^
+							// 監視の削除に登録
 							indexs.emplace_back(complete.first);
 						}
 					}
 
-					// Ď폜
+					// 監視を削除
 					EraseSurveillance(indexs);
 
-					// ǂݍ݂ʒm
-					NotifyArgument(input);
+					// 変化を確認
+					if (input.Drivers.empty() == false)
+					{
+						// 連番と時刻を更新 ※時刻はGrabber::Frame::Now()と同じ時計
+						input.Sequence = ++m_sequence;
+						input.Previous = input.Sequence - 1;
+						input.Timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+						// 読み込みを通知
+						NotifyArgument(input);
+					}
 
-					// Oo
+					// ログ出力
 					postscript << Logging::ConstSeparator << stopWatch.Format(true);
 					//@@@Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  O𔭖C
+					// 前回の値を破棄 ⇒ 更新済みの値が通知されていないため、次の読み込みは全て通知
+					ClearImage();
+
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			
-			/// @detail			CXbh珑݂̃^C~OŌĂяo
-			///					p֐
+			/// @brief			書き込み
+			/// @detail			メインスレッドから書き込みのタイミングで呼び出される
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::WriteDerived()
 			{
@@ -525,7 +638,7 @@ namespace Standard
 
 				logging.Message << GetName() << "WriteDerived()" << Logging::ConstSeparator;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
@@ -533,66 +646,57 @@ namespace Standard
 				{
 					std::lock_guard<std::recursive_mutex> lock(m_asyncController);
 
-					// ڑς݂mF
+					// 接続済みを確認
 					postscript << "IsConnected()";
 					IsConnected();
 					postscript.str("");
 
 					do
 					{
-						std::vector<size_t> erases;
+						// 書き込むクラスをまとめて取得
+						TakeWrites(m_takeWrites);
 
-						// ރNX擾
-						auto size = GetWriteSize();
+						// 実行できなかったクラス
+						m_restoreWrites.clear();
 
-						for (int index = 0; index < size; index++)
+						for (auto& write : m_takeWrites)
 						{
-							// ރNX擾
-							auto write = GetWrite(index);
-
-							// ݃NXmF
-							if (write == nullptr)
-							{
-								// ރNXȂ  ̃NX
-								continue;
-							}
-
 							bool valid = true;
 
-							// ̎w߂𔻒
-							if (write->Output.Command.type() == typeid(Status::Output::CServo))
+							// 軸の指令を判定
+							if (write.Output.Command.type() == typeid(Status::Output::CServo))
 							{
-								// T[{𐧌
-								valid = Servo(*write);
+								// サーボを制御
+								valid = Servo(write);
 							}
-							else if (write->Output.Command.type() == typeid(Status::Output::CMoveOrigin))
+							else if (write.Output.Command.type() == typeid(Status::Output::CMoveOrigin))
 							{
-								// _A
-								valid = MoveOrigin(*write);
+								// 原点復帰
+								valid = MoveOrigin(write);
 							}
-							else if (write->Output.Command.type() == typeid(Status::Output::CStartJog))
+							else if (write.Output.Command.type() == typeid(Status::Output::CStartJog))
 							{
-								// WOs
-								valid = StartJog(*write);
+								// ジョグを実行
+								valid = StartJog(write);
 							}
-							else if (write->Output.Command.type() == typeid(Status::Output::CStopJog))
+							else if (write.Output.Command.type() == typeid(Status::Output::CStopJog))
 							{
-								// WO~
-								valid = StopJog(*write);
+								// ジョグを停止
+								valid = StopJog(write);
 							}
 
-							// s̊JnmF
-							if (valid)
+							// 実行の開始を確認
+							if (valid == false)
 							{
-								// 폜f[^ǉ
-								erases.emplace_back(index);
+								// 実行できなかったデータを追加
+								m_restoreWrites.emplace_back(std::move(write));
 							}
 						}
 
-						// o^Ăf[^폜
-						PopWrite(erases);
+						// 実行できなかったデータを戻す
+						RestoreWrites(m_restoreWrites);
 
-						// Oo
+						// ログ出力
 						postscript << "Write()" << Logging::ConstSeparator << stopWatch.Format(true);
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
@@ -600,13 +704,13 @@ namespace Standard
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			J
+			/// @brief			軸を開放
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::Clear()
 			{
@@ -617,25 +721,32 @@ namespace Standard
 
 				Plc::Axis::Setting::CDestroy setting;
 
-				// ̂XV
+				// 名称を更新
 				setting.Name = GetName();
 
-				// j
+				// 軸を破棄
 				postscript << "Plc::Axis::Destroy()";
 				Plc::Axis::Destroy(setting);
 				postscript.str("");
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncAxisStatus);
 
-				// ̏ԂNA
+				// 軸の状態をクリア
 				m_axisStatuses.clear();
+
+				// 排他制御
+				std::lock_guard<std::recursive_mutex> lockController(m_asyncController);
+
+				// まとめて読み込むレジスタの範囲をクリア
+				m_scans.clear();
+				m_images.clear();
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			̏Ԃǉ
-			/// @param[in]		id		̎ʎq
-			/// @param[in]		object	̏ԃNX
+			/// @brief			軸の状態を追加
+			/// @param[in]		id		軸の識別子
+			/// @param[in]		object	軸の状態クラス
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::AdditionStatus(int id, const CStatus& object)
 			{
@@ -644,112 +755,159 @@ namespace Standard
 
 				logging.Message << GetName() << "AdditionStatus()" << Logging::ConstSeparator;
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncAxisStatus);
 
-				// ̏Ԃǉ
+				// 軸の状態を追加
 				postscript << "ID:" << id;
-				postscript << Logging::ConstSeparator << ":" << object.Name;
-				postscript << Logging::ConstSeparator << "nh:" << Plc::FormatHandle(object.Handle);
-				postscript << Logging::ConstSeparator << "AhX:" << Text::FormatX(4, object.Address);
-				postscript << Logging::ConstSeparator << "\:" << object.Resolution;
+				postscript << Logging::ConstSeparator << "名称:" << object.Name;
+				postscript << Logging::ConstSeparator << "ハンドル:" << Plc::FormatHandle(object.Handle);
+				postscript << Logging::ConstSeparator << "アドレス:" << Text::FormatX(4, object.Address);
+				postscript << Logging::ConstSeparator << "分解能:" << object.Resolution;
 				m_axisStatuses[id] = object;
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			̏Ԃ擾
-			/// @param[in]		id	̎ʎq
-			/// @return			̏ԃNX
+			/// @brief			軸の状態を取得
+			/// @param[in]		id	軸の識別子
+			/// @return			軸の状態クラス
 			////////////////////////////////////////////////////////////////////////////////
 			CStatus CWorker::GetStatus(int id)
 			{
 				CStatus ret;
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncAxisStatus);
 
-				// ̏ԂmF
+				// 軸の状態を確認
 				if (m_axisStatuses.count(id) <= 0)
 				{
-					// ̏ԂȂ
+					// 軸の状態なし
 					std::stringstream message;
-					message << "̎ʎq͈͊O:" << id;
+					message << "軸の識別子が範囲外:" << id;
 					throw std::exception(message.str().c_str());
 				}
 
-				// ̏Ԃ擾
+				// 軸の状態を取得
 				ret = m_axisStatuses.at(id);
 
 				return ret;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			S̏Ԃ擾
-			/// @return			S̏ԃNX
+			/// @brief			全軸の状態を取得
+			/// @return			全軸の状態クラス
 			////////////////////////////////////////////////////////////////////////////////
 			std::map<int, CStatus> CWorker::GetStatus()
 			{
 				std::map<int, CStatus> ret;
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncAxisStatus);
 
-				// ̏Ԃ擾
+				// 軸の状態を取得
 				ret = m_axisStatuses;
 
 				return ret;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			Ď鐔擾
-			/// @return			Ď鐔
+			/// @brief			まとめて読み込むレジスタの範囲を作成
+			/// @detail			隣接・重複するレジスタを1つの範囲にまとめて、前回の値を破棄する
+			////////////////////////////////////////////////////////////////////////////////
+			void CWorker::Plan()
+			{
+				Logging::CObject logging;
+				std::stringstream postscript;
+
+				logging.Message << GetName() << "Plan()" << Logging::ConstSeparator;
+
+				// 隣接する軸をまとめた範囲
+				std::vector<CScan> scans = Convert::Scan(GetStatus());
+
+				// 排他制御
+				std::lock_guard<std::recursive_mutex> lock(m_asyncController);
+
+				m_scans = scans;
+
+				// 前回の値を破棄 ⇒ 最初の読み込みは全て通知
+				ClearImage();
+
+				// ログ出力
+				for (const auto& scan : m_scans)
+				{
+					postscript << "アドレス:" << Text::FormatX(4, scan.Address);
+					postscript << Logging::ConstSeparator << "サイズ:" << Text::FormatX(4, (int)scan.Size);
+					postscript << Logging::ConstSeparator << "軸数:" << scan.Offsets.size();
+					Transfer::Output(Logging::Join(logging, postscript.str()));
+					postscript.str("");
+				}
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			前回の値を破棄
+			/// @detail			次の読み込みは変化していない軸も含めて全て通知する
+			////////////////////////////////////////////////////////////////////////////////
+			void CWorker::ClearImage()
+			{
+				// 排他制御
+				std::lock_guard<std::recursive_mutex> lock(m_asyncController);
+
+				m_images.clear();
+				m_images.resize(m_scans.size() * 2);
+				m_previous = Axis::Status::CInput();
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			軸を監視する数を取得
+			/// @return			軸を監視する数
 			////////////////////////////////////////////////////////////////////////////////
 			size_t CWorker::GetSurveillanceSize()
 			{
 				size_t ret = 0;
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncSurveillance);
 
-				// Ď鐔擾
+				// 軸を監視する数を取得
 				ret = m_surveillances.size();
 
 				return ret;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			̊Ď擾
-			/// @param[in]		index	Ďԍ
-			/// @return			ĎݒNX
+			/// @brief			軸の監視を取得
+			/// @param[in]		index	軸を監視する番号
+			/// @return			軸を監視する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			CSurveillance CWorker::GetSurveillance(size_t index)
 			{
 				CSurveillance ret;
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncSurveillance);
 
-				// Ď鐔mF
+				// 軸を監視する数を確認
 				if (index < 0 || m_surveillances.size() <= index)
 				{
-					// ̊Ďԍ͈͊O
+					// 軸の監視する番号が範囲外
 					std::stringstream message;
-					message << "Ďԍ͈͊O:" << index;
+					message << "軸を監視する番号が範囲外:" << index;
 					throw std::exception(message.str().c_str());
 				}
 
-				// ĎݒNX擾
+				// 軸を監視する設定クラスを取得
 				ret = m_surveillances.at(index);
 
 				return ret;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			Ďǉ
-			/// @param[in]		object		ĎݒNX
+			/// @brief			軸を監視を追加
+			/// @param[in]		object		軸を監視する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::AdditionSurveillance(const CSurveillance& object)
 			{
@@ -758,23 +916,23 @@ namespace Standard
 
 				logging.Message << GetName() << "AdditionSurveillance()" << Logging::ConstSeparator;
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncSurveillance);
 
-				// ̊Ďǉ
+				// 軸の監視を追加
 				for (const auto& id : object.Ids)
 				{
-					// ̏Ԃ擾
+					// 軸の状態を取得
 					auto status = GetStatus(id);
 
-					postscript << status.Name << Logging::ConstSeparator << "ĎJn";
+					postscript << status.Name << Logging::ConstSeparator << "監視を開始";
 					switch (object.Status)
 					{
 					case CSurveillance::StatusFinish:
-						postscript << "()";
+						postscript << "(完了)";
 						break;
 					}
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 				}
@@ -782,8 +940,8 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			Ď폜
-			/// @param[in]		indexs		Ďԍ
+			/// @brief			軸を監視を削除
+			/// @param[in]		indexs		軸を監視する番号
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::EraseSurveillance(const std::vector<size_t>& indexs)
 			{
@@ -794,224 +952,45 @@ namespace Standard
 
 				std::vector<size_t> targets;
 
-				// CfbNXԍRs[
+				// インデックス番号をコピー
 				std::copy(indexs.begin(), indexs.end(), std::back_inserter(targets));
 
-				// CfbNXԍ~Ń\[g
+				// インデックス番号を降順でソート
 				std::sort(targets.begin(), targets.end(), std::greater<size_t>());
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncSurveillance);
 
-				// CfbNXԍ𑖍
+				// インデックス番号を走査
 				for (const auto& index : targets)
 				{
-					// ރf[^̃NXmF
+					// 書き込むデータのクラス数を確認
 					if (m_surveillances.size() <= index)
 					{
-						// ރf[^͈̔͊O
+						// 書き込むデータの範囲外
 						continue;
 					}
 
 					for (const auto& id : m_surveillances.at(index).Ids)
 					{
-						// ̏Ԃ擾
+						// 軸の状態を取得
 						auto status = GetStatus(id);
 
-						postscript << status.Name << Logging::ConstSeparator << "ĎI";
-						// Oo
+						postscript << status.Name << Logging::ConstSeparator << "監視を終了";
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 					}
 
-					// f[^폜
+					// データを削除
 					m_surveillances.erase(m_surveillances.begin() + index);
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			̓WX^̒l@̏ԂێNX֕ϊ
-			/// @param[in]		object	WX^̒lNX
-			/// @return			@̏ԂێNX
-			////////////////////////////////////////////////////////////////////////////////
-			Axis::Status::Input::CDriver CWorker::ConvertInput(const Plc::Register::Result::CContent& object)
-			{
-				Axis::Status::Input::CDriver ret;
-
-				unsigned long warning = 0;
-				unsigned long alarm = 0;
-				unsigned long coordinate = 0;
-
-				// WX^̒li[
-				for (const auto& numeric : object.Words)
-				{
-					switch (numeric.first)
-					{
-					case 0x00:
-						// ^]Xe[^X  ^]Xe[^X̐M𑖍
-						for (const auto& iterator : MotionApi::Status::RunningIterator())
-						{
-							// M𕪉
-							bool buffer = ((unsigned short)numeric.second >> iterator & 0x01 ? true : false);
-
-							switch (iterator)
-							{
-							case MotionApi::Status::RunningServo:
-								// ^](T[{ON)  T[{ON
-								ret.Motion[Status::Input::MotionServo] = buffer;
-								break;
-							}
-						}
-						break;
-
-					case 0x02:
-						// [jO  ʂXV
-						warning = (unsigned long)numeric.second & 0x0000FFFF;
-						break;
-
-					case 0x03:
-						// [jO  ʂXV
-						warning |= (unsigned long)numeric.second << 16 & 0xFFFF0000;
-
-						// [jO̐M𑖍
-						for (const auto& iterator : MotionApi::Status::WarningIterator())
-						{
-							// [jOXV
-							ret.Warning[iterator] = (warning >> iterator & 0x01 ? true : false);
-						}
-						break;
-
-					case 0x04:
-						// A[  ʂXV
-						alarm = (unsigned long)numeric.second & 0x0000FFFF;
-						break;
-
-					case 0x05:
-						// A[  ʂXV
-						alarm |= (unsigned long)numeric.second << 16 & 0xFFFF0000;
-
-						// A[̐M𑖍
-						for (const auto& iterator : MotionApi::Status::AlarmIterator())
-						{
-							// A[XV
-							ret.Alarm[iterator] = (alarm >> iterator & 0x01 ? true : false);
-						}
-						break;
-
-					case 0x09:
-						// [VR}hXe[^X	 R}hXe[^X̐M𑖍
-						for (const auto& iterator : MotionApi::Status::CommandIterator())
-						{
-							// M𕪉
-							bool buffer = ((unsigned short)numeric.second >> iterator & 0x01 ? true : false);
-
-							switch (iterator)
-							{
-							case MotionApi::Status::CommandRunning:
-								// s  s
-								ret.Motion[Status::Input::MotionRunning] = buffer;
-								break;
-
-							case MotionApi::Status::CommandAbnormalFinish:
-								// ُI  ُ
-								ret.Motion[Status::Input::MotionAbnormal] = buffer;
-								break;
-
-							case MotionApi::Status::CommandCompleted:
-								// s  s
-								ret.Motion[Status::Input::MotionCompleted] = buffer;
-								break;
-							}
-						}
-						break;
-
-					case 0x0C:
-						// ʒuXe[^X  ʒuXe[^X̐M𑖍
-						for (const auto& iterator : MotionApi::Status::PositionIterator())
-						{
-							// M𕪉
-							bool buffer = ((unsigned short)numeric.second >> iterator & 0x01 ? true : false);
-
-							switch (iterator)
-							{
-							case MotionApi::Status::PositionOriginCompleted:
-								// _A  _A
-								ret.Motion[Status::Input::MotionOrigin] = buffer;
-								break;
-							}
-						}
-						break;
-
-					case 0x16:
-						// @BWntB[hobNʒu(APOS)  ʂXV
-						coordinate = (unsigned long)numeric.second & 0x0000FFFF;
-						break;
-
-					case 0x17:
-						// @BWntB[hobNʒu(APOS)  ʂXV
-						coordinate |= (unsigned long)numeric.second << 16 & 0xFFFF0000;
-
-						// ݂̍WXV
-						ret.Coordinate[Status::Input::CoordinateCurrent] = (double)(signed long)coordinate;
-						break;
-					}
-				}
-
-				return ret;
-			}
-
-			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			o̓WX^̒l@̏ԂێNX֕ϊ
-			/// @param[in]		object	WX^̒lNX
-			/// @return			@̏ԂێNX
-			////////////////////////////////////////////////////////////////////////////////
-			Axis::Status::Input::CDriver CWorker::ConvertOutput(const Plc::Register::Result::CContent& object)
-			{
-				Axis::Status::Input::CDriver ret;
-
-				unsigned long negativeLimit = 0;
-				unsigned long positiveLimit = 0;
-
-				// WX^̒li[
-				for (const auto& numeric : object.Words)
-				{
-					switch (numeric.first)
-					{
-					case 0x66:
-						// \tg~bg  ʂXV
-						positiveLimit = (unsigned long)numeric.second & 0x0000FFFF;
-						break;
-
-					case 0x67:
-						// \tg~bg  ʂXV
-						positiveLimit |= (unsigned long)numeric.second << 16 & 0xFFFF0000;
-
-						// \tg~bgXV
-						ret.Coordinate[Status::Input::CoordinatePositiveLimit] = (double)(signed long)positiveLimit;
-						break;
-
-					case 0x68:
-						// \tg~bg  ʂXV
-						negativeLimit = (unsigned long)numeric.second & 0x0000FFFF;
-						break;
-
-					case 0x69:
-						// \tg~bg  ʂXV
-						negativeLimit |= (unsigned long)numeric.second << 16 & 0xFFFF0000;
-
-						// \tg~bgXV
-						ret.Coordinate[Status::Input::CoordinateNegativeLimit] = (double)(signed long)negativeLimit;
-						break;
-					}
-				}
-
-				return ret;
-			}
-
-			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			~
-			/// @param[in]		object	sݒ̃NX
-			/// @return			true:sJn
+			/// @brief			制御を停止
+			/// @param[in]		object	制御を実行する設定のクラス
+			/// @return			true:実行を開始
 			////////////////////////////////////////////////////////////////////////////////
 			bool CWorker::Suspend(const Execution::CSetting& object)
 			{
@@ -1026,73 +1005,73 @@ namespace Standard
 
 				logging.Message << GetName() << "Suspend()" << Logging::ConstSeparator;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
 				try
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncController);
 
-					// ڑς݂mF
+					// 接続済みを確認
 					postscript << "IsConnected()";
 					IsConnected();
 					postscript.str("");
 
-					// ̒~mF
+					// 制御の停止か確認
 					if (object.Output.Command.type() != typeid(Status::Output::CSuspend))
 					{
-						// T[{̐ł͂Ȃ
-						postscript << "̐NXƕsvF" << object.Output.Command.type().name();
+						// サーボの制御ではない
+						postscript << "軸の制御クラスと不一致：" << object.Output.Command.type().name();
 						throw std::exception(postscript.str().c_str());
 					}
 
-					// Ԃ̒~w肷NXɕϊ
+					// 状態の停止を指定するクラスに変換
 					auto output = boost::any_cast<Status::Output::CSuspend>(object.Output.Command);
 
 					Plc::Device::Setting::CSuspend setting;
 
-					// ̂XV
+					// 名称を更新
 					setting.Name = GetName();
 
-					// 𑖍
+					// 軸を走査
 					for (const auto& driver : output.Drivers)
 					{
 						MotionApi::Device::Setting::Suspend::CAxis axis;
 
-						// ̏Ԃ擾
+						// 軸の状態を取得
 						auto status = GetStatus(driver.first);
 
-						// ̃nhXV
+						// 軸のハンドルを更新
 						axis.Handle = status.Handle;
 
-						// ̃WX^擪AhXXV
+						// 軸のレジスタ先頭アドレスを更新
 						axis.Address = status.Address;
 
-						// ǉ
+						// 軸を追加
 						setting.Axises.emplace_back(axis);
 					}
 
-					// ^CAEg[ms]擾
+					// タイムアウト[ms]を取得
 					auto buffer = output.Other.GetValue<Plc::EnumParameter>(Plc::ParameterSuspendTimeout);
 
-					// ^CAEg[ms]LmF
+					// タイムアウト[ms]が有効か確認
 					if (Variant::IsIntValue(buffer))
 					{
-						// ^CAEg[ms]XV
+						// タイムアウト[ms]を更新
 						setting.Timeout = Variant::ConvertInt(buffer);
 					}
 
-					// ~
+					// 制御を停止
 					postscript << "Plc::Device::Suspend()";
 					Plc::Device::Suspend(setting);
 					postscript.str("");
 
-					// ̊N
+					// 処理の完了を起床
 					postscript << "WakeupFinish()";
 					WakeupFinish(finish, object.Wakeup);
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
@@ -1100,13 +1079,13 @@ namespace Standard
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  ̊G[
+					// 例外の処理 ⇒ 処理の完了をエラー
 					finish.Suspension = true;
 					finish.Message = e.what();
-					// ̊N
+					// 処理の完了を起床
 					WakeupFinish(finish, object.Wakeup);
 
-					// O𔭖C
+					// 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 
@@ -1114,9 +1093,9 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			T[{𐧌
-			/// @param[in]		object	sݒ̃NX
-			/// @return			true:sJn
+			/// @brief			サーボを制御
+			/// @param[in]		object	制御を実行する設定のクラス
+			/// @return			true:実行を開始
 			////////////////////////////////////////////////////////////////////////////////
 			bool CWorker::Servo(const Execution::CSetting& object)
 			{
@@ -1131,74 +1110,74 @@ namespace Standard
 
 				logging.Message << GetName() << "Servo()" << Logging::ConstSeparator;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
 				try
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncController);
 
-					// ڑς݂mF
+					// 接続済みを確認
 					postscript << "IsConnected()";
 					IsConnected();
 					postscript.str("");
 
-					// T[{̐䂩mF
+					// サーボの制御か確認
 					if (object.Output.Command.type() != typeid(Status::Output::CServo))
 					{
-						// T[{̐ł͂Ȃ
-						postscript << "̐NXƕsvF" << object.Output.Command.type().name();
+						// サーボの制御ではない
+						postscript << "軸の制御クラスと不一致：" << object.Output.Command.type().name();
 						throw std::exception(postscript.str().c_str());
 					}
 
-					// T[{̏Ԃw肷NXɕϊ
+					// サーボの状態を指定するクラスに変換
 					auto output = boost::any_cast<Status::Output::CServo>(object.Output.Command);
 
 					Plc::Device::Setting::CServo setting;
 
-					// ̂XV
+					// 名称を更新
 					setting.Name = GetName();
 
-					// XV
+					// 制御を更新
 					setting.Mode = output.Mode;
 
-					// 𑖍
+					// 軸を走査
 					for (const auto& driver : output.Drivers)
 					{
-						// ̏Ԃ擾
+						// 軸の状態を取得
 						auto status = GetStatus(driver.first);
 
-						// ̃nhǉ
+						// 軸のハンドルを追加
 						setting.Handles.emplace_back(status.Handle);
 
-						postscript << status.Name << Logging::ConstSeparator << "T[{:";
+						postscript << status.Name << Logging::ConstSeparator << "サーボ:";
 						postscript << (setting.Mode == Signal::EnumStatus::StatusOn ? "ON" : "OFF");
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 					}
 
-					// ^CAEg[ms]擾
+					// タイムアウト[ms]を取得
 					auto buffer = output.Other.GetValue<Plc::EnumParameter>(Plc::ParameterServoTimeout);
 
-					// ^CAEg[ms]LmF
+					// タイムアウト[ms]が有効か確認
 					if (Variant::IsIntValue(buffer))
 					{
-						// ^CAEg[ms]XV
+						// タイムアウト[ms]を更新
 						setting.Timeout = Variant::ConvertInt(buffer);
 					}
 
-					// T[{𐧌
+					// サーボを制御
 					postscript << "Plc::Device::Servo()";
 					Plc::Device::Servo(setting);
 					postscript.str("");
 
-					// ̊N
+					// 処理の完了を起床
 					postscript << "WakeupFinish()";
 					WakeupFinish(finish, object.Wakeup);
-					// Oo
+					// ログ出力
 					postscript << Logging::ConstSeparator << stopWatch.Format(true);
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
@@ -1207,13 +1186,13 @@ namespace Standard
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  ̊G[
+					// 例外の処理 ⇒ 処理の完了をエラー
 					finish.Suspension = true;
 					finish.Message = e.what();
-					// ̊N
+					// 処理の完了を起床
 					WakeupFinish(finish, object.Wakeup);
 
-					// O𔭖C
+					// 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 
@@ -1221,9 +1200,9 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			_As
-			/// @param[in]		object	sݒ̃NX
-			/// @return			true:sJn
+			/// @brief			原点復帰を実行
+			/// @param[in]		object	制御を実行する設定のクラス
+			/// @return			true:実行を開始
 			////////////////////////////////////////////////////////////////////////////////
 			bool CWorker::MoveOrigin(const Execution::CSetting& object)
 			{
@@ -1238,115 +1217,115 @@ namespace Standard
 
 				logging.Message << GetName() << "MoveOrigin()" << Logging::ConstSeparator;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
 				try
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncController);
 
-					// ڑς݂mF
+					// 接続済みを確認
 					postscript << "IsConnected()";
 					IsConnected();
 					postscript.str("");
 
-					// _A̎smF
+					// 原点復帰の実行か確認
 					if (object.Output.Command.type() != typeid(Status::Output::CMoveOrigin))
 					{
-						// _A̎sł͂Ȃ
-						postscript << "̐NXƕsvF" << object.Output.Command.type().name();
+						// 原点復帰の実行ではない
+						postscript << "軸の制御クラスと不一致：" << object.Output.Command.type().name();
 						throw std::exception(postscript.str().c_str());
 					}
 
-					// _Aw肷NXɕϊ
+					// 原点復帰を指定するクラスに変換
 					auto output = boost::any_cast<Status::Output::CMoveOrigin>(object.Output.Command);
 
 					Plc::Device::Setting::CMoveOrigin setting;
 					CSurveillance surveillance;
 
-					// ̂XV
+					// 名称を更新
 					setting.Name = GetName();
 
-					// 𑖍
+					// 軸を走査
 					for (auto& driver : output.Drivers)
 					{
 						MotionApi::Device::Setting::Origin::CAxis axis;
 
-						// ̌_AsݒNX擾
+						// 軸の原点復帰を行う設定クラスを取得
 						auto buffer = driver.second.Other.GetValue<Plc::EnumParameter>(Plc::ParameterOriginAxis);
 
-						// ̌_AsݒNXLmF
+						// 軸の原点復帰を行う設定クラスが有効か確認
 						if (Variant::IsValue<MotionApi::Device::Setting::Origin::CAxis>(buffer))
 						{
-							// ̌_AsݒNXXV
+							// 軸の原点復帰を行う設定クラスを更新
 							axis = Variant::Convert<MotionApi::Device::Setting::Origin::CAxis>(buffer);
 						}
 
-						// ̏Ԃ擾
+						// 軸の状態を取得
 						auto status = GetStatus(driver.first);
 
-						// ̃nhXV
+						// 軸のハンドルを更新
 						axis.Handle = status.Handle;
 
-						// ֐ߎw̃f[^WX^̐擪AhX̒lɍXV
+						// 関節指定のデータをレジスタの先頭アドレスからの値に更新
 						axis.Reflection(status.Address);
 
-						// |WṼ^CvmF
+						// ポジションのタイプを確認
 						if (axis.PositionType == MotionApi::Device::PositionIndirect)
 						{
-							// |WV֐ߎw  _AŏIs̃AhX֍XV
+							// ポジションが関節指定 ⇒ 原点復帰最終走行距離のアドレスへ更新
 							axis.PositionData = status.Address + 0x42;
 						}
 
-						// ̐ݒǉ
+						// 軸の設定を追加
 						setting.Axises.emplace_back(axis);
 
-						// Ď鎲̎ʎqǉ
+						// 監視する軸の識別子を追加
 						surveillance.Ids.emplace_back(driver.first);
 
-						postscript << status.Name << Logging::ConstSeparator << "_A";
-						// Oo
+						postscript << status.Name << Logging::ConstSeparator << "原点復帰";
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 					}
 
-					// ^CAEg[ms]擾
+					// タイムアウト[ms]を取得
 					auto buffer = output.Other.GetValue<Plc::EnumParameter>(Plc::ParameterMoveOriginTimeout);
 
-					// ^CAEg[ms]LmF
+					// タイムアウト[ms]が有効か確認
 					if (Variant::IsIntValue(buffer))
 					{
-						// ^CAEg[ms]XV
+						// タイムアウト[ms]を更新
 						setting.Timeout = Variant::ConvertInt(buffer);
 					}
 
-					// _As
+					// 原点復帰を実行
 					postscript << "Plc::Device::MoveOrigin()";
 					Plc::Device::MoveOrigin(setting);
 					postscript.str("");
 
-					// Ď̎ނXV
+					// 監視の種類を更新
 					surveillance.Status = CSurveillance::StatusFinish;
 
-					// 䂵ʂ̒ʒmĂяo֐XV
+					// 制御した結果の通知を呼び出す関数を更新
 					surveillance.Wakeup = object.Wakeup;
 
-					// ̊Ďo^
+					// 軸の監視を登録
 					AdditionSurveillance(surveillance);
 
 					ret = true;
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  ̊G[
+					// 例外の処理 ⇒ 処理の完了をエラー
 					finish.Suspension = true;
 					finish.Message = e.what();
-					// ̊N
+					// 処理の完了を起床
 					WakeupFinish(finish, object.Wakeup);
 
-					// O𔭖C
+					// 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 
@@ -1354,9 +1333,9 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			WOJn
-			/// @param[in]		object	sݒ̃NX
-			/// @return			true:sJn
+			/// @brief			ジョグを開始
+			/// @param[in]		object	制御を実行する設定のクラス
+			/// @return			true:実行を開始
 			////////////////////////////////////////////////////////////////////////////////
 			bool CWorker::StartJog(const Execution::CSetting& object)
 			{
@@ -1371,67 +1350,67 @@ namespace Standard
 
 				logging.Message << GetName() << "StartJog()" << Logging::ConstSeparator;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
 				try
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncController);
 
-					// ڑς݂mF
+					// 接続済みを確認
 					postscript << "IsConnected()";
 					IsConnected();
 					postscript.str("");
 
-					// WO̊JnmF
+					// ジョグの開始か確認
 					if (object.Output.Command.type() != typeid(Status::Output::CStartJog))
 					{
-						// WO̊Jnł͂Ȃ
-						postscript << "̐NXƕsvF" << object.Output.Command.type().name();
+						// ジョグの開始ではない
+						postscript << "軸の制御クラスと不一致：" << object.Output.Command.type().name();
 						throw std::exception(postscript.str().c_str());
 					}
 
-					// WO̊Jnw肷NXɕϊ
+					// ジョグの開始を指定するクラスに変換
 					auto output = boost::any_cast<Status::Output::CStartJog>(object.Output.Command);
 
 					Plc::Device::Setting::CStartJog setting;
 
-					// ̂XV
+					// 名称を更新
 					setting.Name = GetName();
 
-					// 𑖍
+					// 軸を走査
 					for (const auto& driver : output.Drivers)
 					{
 						MotionApi::Device::Setting::Jog::CStart axis;
 
-						// ̃WOssݒNX擾
+						// 軸のジョグ実行を行う設定クラスを取得
 						auto buffer = output.Other.GetValue<Plc::EnumParameter>(Plc::ParameterStartJog);
 
-						// ̃WOssݒNXLmF
+						// 軸のジョグ実行を行う設定クラスが有効か確認
 						if (Variant::IsValue<MotionApi::Device::Setting::Jog::CStart>(buffer))
 						{
-							// ̃WOssݒNXXV
+							// 軸のジョグ実行を行う設定クラスを更新
 							axis = Variant::Convert<MotionApi::Device::Setting::Jog::CStart>(buffer);
 						}
 
-						// ̃nhXV
+						// 軸のハンドルを更新
 						axis.Handle = GetStatus(driver.first).Handle;
 
-						// ̐ݒǉ
+						// 軸の設定を追加
 						setting.Axises.emplace_back(axis);
 					}
 
-					// WOs
+					// ジョグを実行
 					postscript << "Plc::Device::StartJog()";
 					Plc::Device::StartJog(setting);
 					postscript.str("");
 
-					// ̊N
+					// 処理の完了を起床
 					postscript << "WakeupFinish()";
 					WakeupFinish(finish, object.Wakeup);
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
@@ -1439,13 +1418,13 @@ namespace Standard
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  ̊G[
+					// 例外の処理 ⇒ 処理の完了をエラー
 					finish.Suspension = true;
 					finish.Message = e.what();
-					// ̊N
+					// 処理の完了を起床
 					WakeupFinish(finish, object.Wakeup);
 
-					// O𔭖C
+					// 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 
@@ -1453,9 +1432,9 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			WO~
-			/// @param[in]		object	sݒ̃NX
-			/// @return			true:sJn
+			/// @brief			ジョグを停止
+			/// @param[in]		object	制御を実行する設定のクラス
+			/// @return			true:実行を開始
 			////////////////////////////////////////////////////////////////////////////////
 			bool CWorker::StopJog(const Execution::CSetting& object)
 			{
@@ -1470,67 +1449,67 @@ namespace Standard
 
 				logging.Message << GetName() << "StopJog()" << Logging::ConstSeparator;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
 				try
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncController);
 
-					// ڑς݂mF
+					// 接続済みを確認
 					postscript << "IsConnected()";
 					IsConnected();
 					postscript.str("");
 
-					// WO̒~mF
+					// ジョグの停止か確認
 					if (object.Output.Command.type() != typeid(Status::Output::CStopJog))
 					{
-						// WO̒~ł͂Ȃ
-						postscript << "̐NXƕsvF" << object.Output.Command.type().name();
+						// ジョグの停止ではない
+						postscript << "軸の制御クラスと不一致：" << object.Output.Command.type().name();
 						throw std::exception(postscript.str().c_str());
 					}
 
-					// WO̒~w肷NXɕϊ
+					// ジョグの停止を指定するクラスに変換
 					auto output = boost::any_cast<Status::Output::CStopJog>(object.Output.Command);
 
 					Plc::Device::Setting::CStopJog setting;
 
-					// ̂XV
+					// 名称を更新
 					setting.Name = GetName();
 
-					// 𑖍
+					// 軸を走査
 					for (const auto& driver : output.Drivers)
 					{
 						MotionApi::Device::Setting::Jog::CStop axis;
 
-						// ̃WO~sݒNX擾
+						// 軸のジョグ停止を行う設定クラスを取得
 						auto buffer = output.Other.GetValue<Plc::EnumParameter>(Plc::ParameterStopJog);
 
-						// ̃WO~sݒNXLmF
+						// 軸のジョグ停止を行う設定クラスが有効か確認
 						if (Variant::IsValue<std::string>(buffer))
 						{
-							// ̃WO~sݒNXXV
+							// 軸のジョグ停止を行う設定クラスを更新
 							axis = Variant::Convert<MotionApi::Device::Setting::Jog::CStop>(buffer);
 						}
 
-						// ̃nhXV
+						// 軸のハンドルを更新
 						axis.Handle = GetStatus(driver.first).Handle;
 
-						// ̐ݒǉ
+						// 軸の設定を追加
 						setting.Axises.emplace_back(axis);
 					}
 
-					// WO~
+					// ジョグを停止
 					postscript << "Plc::Device::StopJog()";
 					Plc::Device::StopJog(setting);
 					postscript.str("");
 
-					// ̊N
+					// 処理の完了を起床
 					postscript << "WakeupFinish()";
 					WakeupFinish(finish, object.Wakeup);
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
@@ -1538,13 +1517,13 @@ namespace Standard
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  ̊G[
+					// 例外の処理 ⇒ 処理の完了をエラー
 					finish.Suspension = true;
 					finish.Message = e.what();
-					// ̊N
+					// 処理の完了を起床
 					WakeupFinish(finish, object.Wakeup);
 
-					// O𔭖C
+					// 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 
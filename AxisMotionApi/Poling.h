@@ -10,15 +10,21 @@ namespace Standard
 	{
 		namespace Poling
 		{
+			//! 1軸分のレジスタのワード数
+			const unsigned long ConstRegisterSize = 0x80;
+
+			//! まとめて読み込むレジスタの最大ワード数 ※16軸分
+			const unsigned long ConstScanMaximum = ConstRegisterSize * 16;
+
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CStatus
-			/// @brief      ̏ԃNX
+			/// @brief      軸の状態クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CStatus
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CStatus()
 				{
@@ -29,19 +35,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CStatus& operator = (const CStatus& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CStatus()
 				{
@@ -50,8 +56,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CStatus& object)
 				{
@@ -62,37 +68,97 @@ namespace Standard
 				}
 
 			public:
-				//! ̖
+				//! 軸の名称
 				std::string Name;
 
-				//! ̃nh
+				//! 軸のハンドル
 				unsigned long Handle;
 
-				//! ̃WX^擪AhX
+				//! 軸のレジスタ先頭アドレス
 				unsigned short Address;
 
-				//! ʒu̕\
+				//! 位置の分解能
 				double Resolution;
 			};
 
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CScan
+			/// @brief      まとめて読み込むレジスタの範囲クラス
+			/// @detail		隣接する軸のレジスタを1回で読み込み、読み込んだ値を軸ごとに切り出す
+			////////////////////////////////////////////////////////////////////////////////
+			class CScan
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CScan()
+				{
+					Address = 0x8000;
+					Size = 0;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				CScan& operator = (const CScan& object) noexcept
+				{
+					// 更新
+					Update(object);
+
+					return *this;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				~CScan()
+				{
+
+				}
+
+			protected:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				void Update(const CScan& object)
+				{
+					this->Address = object.Address;
+					this->Size = object.Size;
+					this->Offsets = object.Offsets;
+				}
+
+			public:
+				//! レジスタの先頭アドレス
+				unsigned short Address;
+
+				//! 読み込むワード数
+				unsigned long Size;
+
+				//! 軸の識別子ごとの先頭からのワード数
+				std::map<int, unsigned long> Offsets;
+			};
+
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CSurveillance
-			/// @brief      ĎݒNX
+			/// @brief      軸を監視する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CSurveillance
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @enum			Ď̎
+				/// @enum			監視の種類
 				////////////////////////////////////////////////////////////////////////////////
 				enum EnumStatus
 				{
-					StatusFinish		// IĎ
+					StatusFinish		// 終了を監視
 				};
 
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CSurveillance()
 				{
@@ -101,19 +167,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CSurveillance& operator = (const CSurveillance& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CSurveillance()
 				{
@@ -122,8 +188,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CSurveillance& object)
 				{
@@ -134,122 +200,144 @@ namespace Standard
 				}
 
 			public:
-				//! Ď̎
+				//! 監視の種類
 				EnumStatus Status;
 
-				//! ̎ʎq
+				//! 軸の識別子
 				std::vector<int> Ids;
 
-				//! 䂵ʂ̒ʒmĂяo֐
+				//! 制御した結果の通知を呼び出す関数
 				std::weak_ptr<std::function<Execution::OnWakeup>> Wakeup;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CWorker
-			/// @brief      ̐ÅĎAԂʒmNX
-			///				 ̐ÅĎAԂʒmev[g̃NXp
-			/// @detail		̐ÅĎAԂ̒ʒms
+			/// @brief      軸の制御、軸の監視、状態を通知するクラス
+			///				⇒ 軸の制御、軸の監視、状態を通知するテンプレートのクラスから継承
+			/// @detail		軸の制御、軸の監視、状態の通知を行う
 			////////////////////////////////////////////////////////////////////////////////
 			class CWorker
 				: virtual public Worker::CTemplate
 			{
 			public:
-				// RXgN^
+				// コンストラクタ
 				CWorker();
 
-				// fXgN^
+				// デストラクタ
 				~CWorker() override;
 
 			protected:
-				// 
+				// 初期化
 				void InitializeDerived() override;
 
-				// j
+				// 破棄
 				void DestroyDerived() override;
 
-				// gCmF
+				// リトライを確認
 				bool IsRetry() override;
 
-				// gC̒xԂ擾
+				// リトライの遅延時間を取得
 				int GetDelayRetry() override;
 
-				// ǂݍ
+				// 短い周期の読み込みが必要か確認
+				bool IsActive() override;
+
+				// 読み込み
 				void ReadDerived() override;
 
-				// 
+				// 書き込み
 				void WriteDerived() override;
 
 			public:
-				// ڑ̏Ԃ擾
+				// 接続の状態を取得
 				bool GetConnected();
 
 			private:
-				// ڑς݂mF
+				// 接続済みを確認
 				void IsConnected();
 
-				// J
+				// 軸を開放
 				void Clear();
 
-				// ̏Ԃǉ
+				// 軸の状態を追加
 				void AdditionStatus(int id, const CStatus& object);
 
-				// ̏Ԃ擾
+				// 軸の状態を取得
 				CStatus GetStatus(int id);
 
-				// S̏Ԃ擾
+				// 全軸の状態を取得
 				std::map<int, CStatus> GetStatus();
 
-				// Ď鐔擾
+				// まとめて読み込むレジスタの範囲を作成
+				void Plan();
+
+				// 前回の値を破棄
+				void ClearImage();
+
+				// 軸を監視する数を取得
 				size_t GetSurveillanceSize();
 
-				// ̊Ď擾
+				// 軸の監視を取得
 				CSurveillance GetSurveillance(size_t index);
 
-				// ̊Ďǉ
+				// 軸の監視を追加
 				void AdditionSurveillance(const CSurveillance& object);
 
-				// ̊Ď폜
+				// 軸の監視を削除
 				void EraseSurveillance(const std::vector<size_t>& indexs);
 
-				// ̓WX^̒l@̏ԂێNX֕ϊ
-				Axis::Status::Input::CDriver ConvertInput(const Plc::Register::Result::CContent& object);
-
-				// o̓WX^̒l@̏ԂێNX֕ϊ
-				Axis::Status::Input::CDriver ConvertOutput(const Plc::Register::Result::CContent& object);
-
-				// ~
+				// 制御を停止
 				bool Suspend(const Execution::CSetting& object);
 
-				// T[{𐧌
+				// サーボを制御
 				bool Servo(const Execution::CSetting& object);
 
-				// _As
+				// 原点復帰を実行
 				bool MoveOrigin(const Execution::CSetting& object);
 
-				// WOJn
+				// ジョグを開始
 				bool StartJog(const Execution::CSetting& object);
 
-				// WO~
+				// ジョグを停止
 				bool StopJog(const Execution::CSetting& object);
 
 			private:
-				//! rNX(Rg[̏NXp)
+				//! 排他制御クラス(コントローラの情報クラス用)
 				std::recursive_mutex m_asyncController;
 
-				//! Rg[JʃNX
+				//! コントローラを開いた結果クラス
 				MotionApi::Controller::Result::COpen m_controller;
 
-				//! rNX(̏ԗp)
+				//! 排他制御クラス(軸の状態用)
 				std::recursive_mutex m_asyncAxisStatus;
 
-				//! ̏ԃNX
+				//! 軸の状態クラス
 				std::map<int, CStatus> m_axisStatuses;
 
-				//! rNX(Ďݒ̃NXp)
+				//! まとめて読み込むレジスタの範囲クラス ※コントローラの情報クラス用の排他制御で参照・更新
+				std::vector<CScan> m_scans;
+
+				//! 前回読み込んだレジスタの値 ※範囲ごとに入力・出力の順、コントローラの情報クラス用の排他制御で参照・更新
+				std::vector<Plc::Register::Result::CContent> m_images;
+
+				//! 前回の機器の状態 ※変化を確認する基準
+				Axis::Status::CInput m_previous;
+
+				//! 通知の連番
+				uint64_t m_sequence;
+
+				//! 排他制御クラス(制御を監視する設定のクラス用)
 				std::recursive_mutex m_asyncSurveillance;
 
-				//! Ďݒ̃NX
+				//! 制御を監視する設定のクラス
 				std::vector<CSurveillance> m_surveillances;
+
+				//! まとめて取得した書き込むクラス
+				//! ※確保済みの領域を使い回す
+				std::vector<Execution::CSetting> m_takeWrites;
+
+				//! 実行できなかった書き込むクラス
+				std::vector<Execution::CSetting> m_restoreWrites;
 			};
 		}
 	}
@@ -10,15 +10,15 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CServo
-			/// @brief      T[{̌ʃNX
-			///				 ԂĎʂ̊bNXp
+			/// @brief      サーボ制御の結果クラス
+			///				⇒ 状態を監視した結果の基礎クラスから継承
 			////////////////////////////////////////////////////////////////////////////////
 			class CServo
 				: virtual public Signal::Result::CBasis
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CServo() : Signal::Result::CBasis()
 				{
@@ -26,8 +26,8 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CServo& operator = (const CServo& object) noexcept
 				{
@@ -35,7 +35,7 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CServo()
 				{
@@ -44,7 +44,7 @@ namespace Standard
 			};
 		}
 
-		//! T[{̊ɔ֐
+		//! サーボ制御の完了時に発生する関数
 		typedef void(OnServo)(std::shared_ptr<Result::CServo>);
 	}
 }
\ No newline at end of file
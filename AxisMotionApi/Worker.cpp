@@ -5,7 +5,7 @@ namespace Standard
 	namespace Axis
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			RXgN^
+		/// @brief			コンストラクタ
 		////////////////////////////////////////////////////////////////////////////////
 		CWorker::CWorker() : CTemplate()
 		{
@@ -13,7 +13,7 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fXgN^
+		/// @brief			デストラクタ
 		////////////////////////////////////////////////////////////////////////////////
 		CWorker::~CWorker()
 		{
@@ -21,8 +21,8 @@ namespace Standard
 		}
 
 		//////////////////////////////////////////////////////////////////////////////////
-		///// @brief			̐ÅĎAԂʒmbNX̗O󂯎֐
-		///// @param[in]		object	ÕNX
+		///// @brief			軸の制御、軸の監視、状態を通知する基礎クラスの例外を受け取る関数
+		///// @param[in]		object	例外のクラス
 		//////////////////////////////////////////////////////////////////////////////////
 		//void CWorker::OnPolingException(const Exception::CObject& object)
 		//{
@@ -30,8 +30,8 @@ namespace Standard
 		//}
 
 		//////////////////////////////////////////////////////////////////////////////////
-		///// @brief			foCX擾 hŋLq
-		///// @return			foCX
+		///// @brief			デバイス名を取得 ※派生先で記述
+		///// @return			デバイス名
 		//////////////////////////////////////////////////////////////////////////////////
 		//std::string CWorker::GetName()
 		//{
@@ -41,22 +41,22 @@ namespace Standard
 		//}
 
 		//////////////////////////////////////////////////////////////////////////////////
-		///// @brief			ڑ̏Ԃ擾
-		///// @return			true:ڑς / false:ڑ
+		///// @brief			接続の状態を取得
+		///// @return			true:接続済み / false:未接続
 		//////////////////////////////////////////////////////////////////////////////////
 		//bool CWorker::GetConnected()
 		//{
 		//	bool ret = false;
 
-		//	// ڑ̏Ԃ擾
+		//	// 接続の状態を取得
 		//	ret = m_poling.GetConnected();
 
 		//	return ret;
 		//}
 
 		//////////////////////////////////////////////////////////////////////////////////
-		///// @brief			
-		///// @detail			̃^C~OŌĂяo ̐ÅĎAԂʒmNX̗Oʒm֐o^A̍XVȂǍs
+		///// @brief			初期化
+		///// @detail			初期化のタイミングで呼び出される ※軸の制御、軸の監視、状態を通知するクラスの例外を通知する関数を登録、周期の更新など行う
 		//////////////////////////////////////////////////////////////////////////////////
 		//void CWorker::InitializeDerived()
 		//{
@@ -70,55 +70,55 @@ namespace Standard
 
 		//	try
 		//	{
-		//		// ftHg̐ݒNX擾
+		//		// デフォルトの設定クラスを取得
 		//		Setting::CDefault defaultSetting = GetDefaultSetting();
 
-		//		// Oʒm֐̓o^
+		//		// 例外を通知する関数の登録
 		//		postscript << "Poling::AttachFunctionException()";
 		//		m_poling.AttachFunctionException(std::bind(&CWorker::OnPolingException, this, std::placeholders::_1));
 		//		postscript.str("");
 
-		//		// |[O̎XV
+		//		// ポーリングの周期を更新
 		//		postscript << "Poling::SetCycle(" << defaultSetting.Cycle << ")";
 		//		m_poling.SetCycle(defaultSetting.Cycle);
-		//		// Oo
+		//		// ログ出力
 		//		postscript << Logging::ConstSeparator << stopWatch.Format(true);
 		//		Transfer::Output(Logging::Join(logging, postscript.str()));
 		//		postscript.str("");
 
-		//		// |[Oׂ̐ݒ擾
+		//		// 軸をポーリングする為の設定を取得
 		//		postscript << "Poling::GetSetting()";
 		//		Setting::CPoling polingSetting = m_poling.GetSetting();
 		//		postscript.str("");
 
-		//		// gC񐔂XV
+		//		// リトライ回数を更新
 		//		postscript << "Poling::Setting::Retry(" << defaultSetting.Retry << ")";
 		//		polingSetting.Retry = defaultSetting.Retry;
-		//		// Oo
+		//		// ログ出力
 		//		postscript << Logging::ConstSeparator << stopWatch.Format(true);
 		//		Transfer::Output(Logging::Join(logging, postscript.str()));
 		//		postscript.str("");
 
-		//		// |[Oׂ̐ݒXV
+		//		// 軸をポーリングする為の設定を更新
 		//		postscript << "Poling::SetSetting()";
 		//		m_poling.SetSetting(polingSetting);
 		//		postscript.str("");
 
-		//		// ̃|[OJn
+		//		// 軸のポーリングを開始
 		//		postscript << "Poling::Start()";
 		//		m_poling.Start();
 		//		postscript.str("");
 		//	}
 		//	catch (const std::exception& e)
 		//	{
-		//		// Ȍ  OʒmC
+		//		// 例外の処理 ⇒ 例外を通知＆発砲
 		//		throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 		//	}
 		//}
 
 		//////////////////////////////////////////////////////////////////////////////////
-		///// @brief			j
-		///// @detail			j̃^C~OŌĂяo ̐ÅĎAԂʒmNX̗Oʒm֐̉ȂǍs
+		///// @brief			破棄
+		///// @detail			破棄のタイミングで呼び出される ※軸の制御、軸の監視、状態を通知するクラスの例外を通知する関数の解除など行う
 		//////////////////////////////////////////////////////////////////////////////////
 		//void CWorker::DestroyDerived()
 		//{
@@ -130,27 +130,27 @@ namespace Standard
 
 		//	logging.Message << GetName() << "DestroyDerived()" << Logging::ConstSeparator;
 
-		//	// j
+		//	// 破棄
 		//	try
 		//	{
-		//		// Oʒm֐̉
+		//		// 例外を通知する関数の解除
 		//		postscript << "Poling::DetachFunctionException()";
 		//		m_poling.DetachFunctionException();
-		//		// Oo
+		//		// ログ出力
 		//		postscript << Logging::ConstSeparator << stopWatch.Format(true);
 		//		Transfer::Output(Logging::Join(logging, postscript.str()));
 		//		postscript.str("");
 		//	}
 		//	catch (const std::exception& e)
 		//	{
-		//		// Ȍ  OʒmC
+		//		// 例外の処理 ⇒ 例外を通知＆発砲
 		//		throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 		//	}
 		//}
 
 		//////////////////////////////////////////////////////////////////////////////////
-		///// @brief			ڑ
-		///// @detail			ڑ̃^C~OŌĂяo ̐ÅĎAԂʒmNXŐڑ̂ҋ@ȂǍs
+		///// @brief			接続
+		///// @detail			接続のタイミングで呼び出される ※軸の制御、軸の監視、状態を通知するクラスで接続が完了するのを待機など行う
 		//////////////////////////////////////////////////////////////////////////////////
 		//void CWorker::ConnectDerived()
 		//{
@@ -166,53 +166,53 @@ namespace Standard
 		//	{
 		//		do
 		//		{
-		//			// ̐ÅĎAԂʒmݒ擾
+		//			// 軸の制御、軸の監視、状態を通知する設定を取得
 		//			postscript << "Poling::GetSetting()";
 		//			Setting::CPoling polingSetting = m_poling.GetSetting();
 		//			postscript.str("");
 
-		//			// ֐ڑsݒNXXV
+		//			// 軸へ接続を行う設定クラスを更新
 		//			postscript << "Poling::Setting::Connect()";
 		//			polingSetting.Connect = GetConnectSetting();
 		//			postscript.str("");
 
-		//			// ̐ÅĎAԂʒmݒXV
+		//			// 軸の制御、軸の監視、状態を通知する設定を更新
 		//			postscript << "Poling::SetSetting()";
 		//			m_poling.SetSetting(polingSetting);
 		//			postscript.str("");
 
-		//			// ̏𐧌䂷NX
+		//			// 軸の初期化を制御する情報クラス
 		//			std::shared_ptr<Write::CInitialize> initializeWrite = std::make_shared<Write::CInitialize>();
 
-		//			// ڑҋ@NX
+		//			// 接続を待機するクラス
 		//			Signal::CObserver<Plc::Result::CConnect> observer;
 
-		//			// ڑʒm֐o^
+		//			// 接続を通知をする関数を登録
 		//			postscript << "Subject::RegistrationFunctionConnect()";
 		//			std::shared_ptr<std::function<Plc::OnConnect>> onCalled = std::make_shared<std::function<Plc::OnConnect>>(std::bind(&Signal::CObserver<Plc::Result::CConnect>::OnCalled, &observer, std::placeholders::_1));
 		//			m_poling.RegistrationFunctionConnect(onCalled);
 		//			postscript.str("");
 
-		//			// v
+		//			// 初期化を要求
 		//			postscript << "Poling::RequestInitialize()";
 		//			m_poling.RequestInitialize(initializeWrite);
 		//			postscript.str("");
 
-		//			// ڑ҂
+		//			// 接続を待つ
 		//			postscript << "Observer::Wait()";
 		//			observer.Wait();
 		//			postscript.str("");
 
-		//			// ڑ̌ʂ擾
+		//			// 接続の結果を取得
 		//			postscript << "Observer::GetArgument()";
 		//			std::shared_ptr<Plc::Result::CConnect> result = observer.GetArgument();
 		//			postscript.str("");
 
-		//			// fmF
+		//			// 中断を確認
 		//			if (result->Suspension)
 		//			{
-		//				postscript << "Observer::Initialize()" << Logging::ConstSeparator << "f";
-		//				// Oo
+		//				postscript << "Observer::Initialize()" << Logging::ConstSeparator << "中断";
+		//				// ログ出力
 		//				postscript << Logging::ConstSeparator << stopWatch.Format(true);
 		//				Transfer::Output(Logging::Join(logging, postscript.str()));
 		//				postscript.str("");
@@ -222,14 +222,14 @@ namespace Standard
 		//	}
 		//	catch (const std::exception& e)
 		//	{
-		//		// Ȍ  OʒmC
+		//		// 例外の処理 ⇒ 例外を通知＆発砲
 		//		throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 		//	}
 		//}
 
 		//////////////////////////////////////////////////////////////////////////////////
-		///// @brief			ؒf
-		///// @detail			ؒf̃^C~OŌĂяo ̐ÅĎAԂʒmNXŐؒf̂ҋ@ȂǍs
+		///// @brief			切断
+		///// @detail			切断のタイミングで呼び出される ※軸の制御、軸の監視、状態を通知するクラスで切断が完了するのを待機など行う
 		//////////////////////////////////////////////////////////////////////////////////
 		//void CWorker::DisconnectDerived()
 		//{
@@ -245,38 +245,38 @@ namespace Standard
 		//	{
 		//		do
 		//		{
-		//			// ؒfҋ@NX
+		//			// 切断を待機するクラス
 		//			Signal::CObserver<Plc::Result::CDisconnect> observer;
 
-		//			// ؒfʒm֐o^
+		//			// 切断を通知をする関数を登録
 		//			postscript << "Subject::RegistrationFunctionDisconnect()";
 		//			std::shared_ptr<std::function<Plc::OnDisconnect>> onCalled = std::make_shared<std::function<Plc::OnDisconnect>>(std::bind(&Signal::CObserver<Plc::Result::CDisconnect>::OnCalled, &observer, std::placeholders::_1));
 		//			m_poling.RegistrationFunctionDisconnect(onCalled);
 		//			postscript.str("");
 
-		//			// ̔j𐧌䂷NX
+		//			// 軸の破棄を制御する情報クラス
 		//			std::shared_ptr<Write::CDestroy> destroyWrite = std::make_shared<Write::CDestroy>();
 
-		//			// jv
+		//			// 破棄を要求
 		//			postscript << "Poling::RequestDestroy()";
 		//			m_poling.RequestDestroy(destroyWrite);
 		//			postscript.str("");
 
-		//			// j҂
+		//			// 破棄を待つ
 		//			postscript << "Observer::Wait()";
 		//			observer.Wait();
 		//			postscript.str("");
 
-		//			// ڑ̌ʂ擾
+		//			// 接続の結果を取得
 		//			postscript << "Observer::GetArgument()";
 		//			std::shared_ptr<Plc::Result::CDisconnect> result = observer.GetArgument();
 		//			postscript.str("");
 
-		//			// fmF
+		//			// 中断を確認
 		//			if (result->Suspension)
 		//			{
-		//				postscript << "Observer::Destroy()" << Logging::ConstSeparator << "f";
-		//				// Oo
+		//				postscript << "Observer::Destroy()" << Logging::ConstSeparator << "中断";
+		//				// ログ出力
 		//				postscript << Logging::ConstSeparator << stopWatch.Format(true);
 		//				Transfer::Output(Logging::Join(logging, postscript.str()));
 		//				postscript.str("");
@@ -286,14 +286,14 @@ namespace Standard
 		//	}
 		//	catch (const std::exception& e)
 		//	{
-		//		// Ȍ  OʒmC
+		//		// 例外の処理 ⇒ 例外を通知＆発砲
 		//		throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 		//	}
 		//}
 
 		//////////////////////////////////////////////////////////////////////////////////
-		///// @brief			T[{𐧌
-		///// @param[in]		object	T[{𐧌䂷ݒNX
+		///// @brief			サーボを制御
+		///// @param[in]		object	サーボを制御する設定クラス
 		//////////////////////////////////////////////////////////////////////////////////
 		//void CWorker::Servo(const Setting::CServo& setting)
 		//{
@@ -309,49 +309,49 @@ namespace Standard
 		//	{
 		//		do
 		//		{
-		//			// T[{̐ҋ@NX
+		//			// サーボの制御を待機するクラス
 		//			Signal::CObserver<Result::CSuper> observer;
 
-		//			// T[{𐧌䂷NX
+		//			// サーボを制御する情報クラス
 		//			std::shared_ptr<Write::CServo> servoWrite = std::make_shared<Write::CServo>();
 
-		//			// T[{̏ԂXV
+		//			// サーボの状態を更新
 		//			servoWrite->Mode = setting.Mode;
 
-		//			// ̋@𑖍
+		//			// 軸の機器を走査
 		//			for (const auto& driver : setting.Drivers)
 		//			{
-		//				// ̔ԍXV
+		//				// 軸の番号を更新
 		//				servoWrite->Indexs.emplace_back(driver.first);
 		//			}
 
-		//			// T[{̐ʒm֐o^
+		//			// サーボの制御を通知をする関数を登録
 		//			postscript << "Write::_Funtion";
 		//			//std::shared_ptr<std::function<Axis::OnServo>> onCalled = std::make_shared<std::function<Axis::OnServo>>(std::bind(&Signal::CObserver<Axis::Result::CServo>::OnCalled, &observer, std::placeholders::_1));
 		//			//servoWrite._Function_ = onCalled;
 		//			servoWrite->Subject.RegistrationFunction(std::make_shared<std::function<OnReceive>>(std::bind(&Signal::CObserver<Result::CSuper>::OnCalled, &observer, std::placeholders::_1)));
 		//			postscript.str("");
 
-		//			// ݂v
+		//			// 書き込みを要求
 		//			postscript << "Poling::RequestWrite()";
 		//			m_poling.RequestWrite(servoWrite);
 		//			postscript.str("");
 
-		//			// ҂
+		//			// 制御を待つ
 		//			postscript << "Observer::Wait()";
 		//			observer.Wait();
 		//			postscript.str("");
 
-		//			// ̌ʂ擾
+		//			// 制御の結果を取得
 		//			postscript << "Observer::GetArgument()";
 		//			auto result = std::dynamic_pointer_cast<Result::CSuper>(observer.GetArgument());
 		//			postscript.str("");
 
-		//			// fmF
+		//			// 中断を確認
 		//			if (result->Suspension)
 		//			{
-		//				postscript << "Observer::Write()" << Logging::ConstSeparator << "f";
-		//				// Oo
+		//				postscript << "Observer::Write()" << Logging::ConstSeparator << "中断";
+		//				// ログ出力
 		//				postscript << Logging::ConstSeparator << stopWatch.Format(true);
 		//				Transfer::Output(Logging::Join(logging, postscript.str()));
 		//				postscript.str("");
@@ -361,7 +361,7 @@ namespace Standard
 		//	}
 		//	catch (const std::exception& e)
 		//	{
-		//		// Ȍ  OʒmC
+		//		// 例外の処理 ⇒ 例外を通知＆発砲
 		//		throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 		//	}
 		//}
@@ -9,17 +9,17 @@ namespace Standard
 	{
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CWorker
-		/// @brief      ̐sNX
-		///				 ̊ĎA̐AԂʒmev[g̃NXh
+		/// @brief      軸の制御を行うクラス
+		///				⇒ 軸の監視、軸の制御、状態を通知するテンプレートのクラスから派生
 		////////////////////////////////////////////////////////////////////////////////
 		class CWorker
 			: virtual public Axis::Worker::CTemplate<Poling::CWorker>
 		{
 		public:
-			// RXgN^
+			// コンストラクタ
 			CWorker();
 
-			// fXgN^
+			// デストラクタ
 			~CWorker() override;
 		};
 	}
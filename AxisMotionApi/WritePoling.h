@@ -10,15 +10,15 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CBasis
-			/// @brief      Ďʂ̊bNX
-			///				 Ďʂ̃X[p[NXp
+			/// @brief      軸を監視した結果の基礎クラス
+			///				⇒ 軸を監視した結果のスーパークラスから継承
 			////////////////////////////////////////////////////////////////////////////////
 			class CBasis
 				: virtual public CSuper
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CBasis()
 				{
@@ -26,19 +26,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CBasis& operator = (const CBasis& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CBasis()
 				{
@@ -47,33 +47,33 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CBasis& object)
 				{
-					// ̊֐
+					// 既定の関数
 					CSuper::Update(object);
 
 					this->DeviceHandle = object.DeviceHandle;
 				}
 
 			public:
-				//! foCX̃nh
+				//! デバイスのハンドル
 				unsigned long DeviceHandle;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CInitialize
-			/// @brief      ̏𐧌䂷NX
-			///				 Ďʂ̊bNXp
+			/// @brief      軸の初期化を制御する情報クラス
+			///				⇒ 軸を監視した結果の基礎クラスから継承
 			////////////////////////////////////////////////////////////////////////////////
 			class CInitialize
 				: virtual public CBasis
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CInitialize()
 				{
@@ -81,19 +81,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CInitialize& operator = (const CInitialize& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CInitialize()
 				{
@@ -102,27 +102,27 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CInitialize& object)
 				{
-					// ̊֐
+					// 既定の関数
 					CBasis::Update(object);
 				}
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CDestroy
-			/// @brief      ̔j𐧌䂷NX
-			///				 Ďʂ̊bNXp
+			/// @brief      軸の破棄を制御する情報クラス
+			///				⇒ 軸を監視した結果の基礎クラスから継承
 			////////////////////////////////////////////////////////////////////////////////
 			class CDestroy
 				: virtual public CBasis
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CDestroy()
 				{
@@ -130,19 +130,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CDestroy& operator = (const CDestroy& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CDestroy()
 				{
@@ -151,27 +151,27 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CDestroy& object)
 				{
-					// ̊֐
+					// 既定の関数
 					CBasis::Update(object);
 				}
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CServo
-			/// @brief      ̃T[{𐧌䂷NX
-			///				 𐧌䂷̊bNXp
+			/// @brief      軸のサーボを制御する情報クラス
+			///				⇒ 軸を制御する情報の基礎クラスから継承
 			////////////////////////////////////////////////////////////////////////////////
 			class CServo
 				: virtual public CBasis
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CServo() : CBasis()
 				{
@@ -179,19 +179,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CServo& operator = (const CServo& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CServo() override
 				{
@@ -200,19 +200,19 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CServo& object)
 				{
-					// ̊֐
+					// 既定の関数
 					CBasis::Update(object);
 
 					this->Mode = object.Mode;
 				}
 
 			public:
-				//! T[{̏
+				//! サーボの状態
 				Signal::EnumStatus Mode;
 			};
 		}
@@ -4,13 +4,13 @@ namespace Standard
 {
 	namespace Axis
 	{
-		//! p[^̒`
+		//! パラメータの定義
 		enum EnumParameter
 		{
-			ParameterConnectTimeout,		// ڑ̃^CAEg[ms]
-			ParameterDisconnectTimeout,		// ؒf̃^CAEg[ms]
-			ParameterWriteTimeout,			// 䎞̃^CAEg[ms]
-			ParameterReadTimeout			// Ď̃^CAEg[ms]
+			ParameterConnectTimeout,		// 接続時のタイムアウト[ms]
+			ParameterDisconnectTimeout,		// 切断時のタイムアウト[ms]
+			ParameterWriteTimeout,			// 制御時のタイムアウト[ms]
+			ParameterReadTimeout			// 監視時のタイムアウト[ms]
 		};
 	}
 }
\ No newline at end of file
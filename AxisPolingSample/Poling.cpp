@@ -7,7 +7,7 @@ namespace Standard
 		namespace Poling
 		{
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CWorker::CWorker() : Worker::CTemplate()
 			{
@@ -15,7 +15,7 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CWorker::~CWorker()
 			{
@@ -23,9 +23,9 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			ʒm
-			/// @param[in]		object	ʒm̃NX(ev[gŎw)
-			/// @param[in]		remove	true:ʒmɍ폜 / false:ʒmɍ폜Ȃ
+			/// @brief			完了を通知
+			/// @param[in]		object	通知する情報のクラス(テンプレートで指定)
+			/// @param[in]		remove	true:通知後に削除 / false:通知後に削除しない
 			////////////////////////////////////////////////////////////////////////////////
 			template <typename CWrite, typename CArgument>
 			void CWorker::NotifyComplete(std::shared_ptr<CArgument> object, bool remove/*=true*/)
@@ -40,56 +40,56 @@ namespace Standard
 
 				try
 				{
-					//// r
+					//// 排他制御
 					//std::lock_guard<std::recursive_mutex> lock(m_asyncSurveillances);
 
-					//// ʒmĎĂ鎲̏NX
+					//// 通知した監視している軸の情報クラス
 					//std::vector<std::vector<std::shared_ptr<Write::CSuper>>::iterator> notifieds;
 
-					//// ĎĂ鎲𑖍
+					//// 監視している軸を走査
 					//for (std::vector<std::shared_ptr<Write::CSuper>>::iterator surveillance = m_surveillances.begin(); surveillance != m_surveillances.end(); surveillance++)
 					//{
-					//	// 䂷NXmF
+					//	// 制御する情報クラスを確認
 					//	if (typeid(CWrite) != typeid(surveillance))
 					//	{
-					//		// 䂷NXsv
+					//		// 制御する情報クラスが不一致
 					//		continue;
 					//	}
 
-					//	// ʒmĂяo
+					//	// 通知を呼び出し
 					//	if ((*surveillance)->Subject.CallingFunction(object))
 					//	{
-					//		// Ăяo𐬌
+					//		// 呼び出しを成功
 					//		notifieds.emplace_back(surveillance);
 					//	}
 					//}
 
-					//// 폜tOmF
+					//// 削除フラグを確認
 					//if (remove)
 					//{
 					//	for (const auto& notified : notifieds)
 					//	{
-					//		// ĎĂ鎲폜
+					//		// 監視している軸を削除
 					//		m_surveillances.erase(notified);
 					//	}
 					//}
 
-					//// Oo
+					//// ログ出力
 					//postscript << "Count:" << notifieds.size() << Logging::ConstSeparator << stopWatch.Format(true);
 					//Transfer::Output(Logging::Join(logging, postscript.str()));
 					//postscript.str("");
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  OʒmC
+					// 例外の処理 ⇒ 例外を通知＆発砲
 					throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			
-			/// @detail			CXbh珉̃^C~OŌĂяo
-			///					p֐
+			/// @brief			初期化
+			/// @detail			メインスレッドから初期化のタイミングで呼び出される
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::InitializeDerived()
 			{
@@ -104,33 +104,33 @@ namespace Standard
 
 				try
 				{
-					//@@@ ^Iȑ҂
+					//@@@ 疑似的な待ち時間
 					std::this_thread::sleep_for(std::chrono::milliseconds(100));
 
-					// K{
-					//@@@ ڑ鏈Ȃ񂩂Lq
+					// ★必須
+					//@@@ 接続する処理なんかを記述する
 
-					// K{
-					// ̊N
+					// ★必須
+					// 初期化の完了を起床
 					postscript << "WakeupInitializeComplete()" << Logging::ConstSeparator << stopWatch.Format(true);
 					WakeupInitializeComplete(trigger);
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  ̊N
+					// 例外の処理 ⇒ 初期化の完了を起床
 					trigger.Suspension = true;
 					trigger.Message = e.what();
 					WakeupInitializeComplete(trigger);
 
-					// OʒmC
+					// 例外を通知＆発砲
 					throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			j
-			/// @detail			CXbhj̃^C~OŌĂяo
-			///					p֐
+			/// @brief			破棄
+			/// @detail			メインスレッドから破棄のタイミングで呼び出される
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::DestroyDerived()
 			{
@@ -145,33 +145,33 @@ namespace Standard
 
 				try
 				{
-					//@@@ ^Iȑ҂
+					//@@@ 疑似的な待ち時間
 					std::this_thread::sleep_for(std::chrono::milliseconds(700));
 
-					// K{
-					//@@@ ؒf鏈Ȃ񂩂Lq
+					// ★必須
+					//@@@ 切断する処理なんかを記述する
 
-					// K{
-					// j̊N
+					// ★必須
+					// 破棄の完了を起床
 					postscript << "WakeupDestroyComplete()" << Logging::ConstSeparator << stopWatch.Format(true);
 					WakeupDestroyComplete(trigger);
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  j̊N
+					// 例外の処理 ⇒ 破棄の完了を起床
 					trigger.Suspension = true;
 					trigger.Message = e.what();
 					WakeupDestroyComplete(trigger);
 
-					// OʒmC
+					// 例外を通知＆発砲
 					throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			ǂݍ
-			/// @detail			̏ԂmF
-			///					p֐
+			/// @brief			読み込み
+			/// @detail			軸の状態を確認する
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::ReadDerived()
 			{
@@ -187,77 +187,77 @@ namespace Standard
 				{
 					size_t index = 0;
 
-					//// r
+					//// 排他制御
 					//std::lock_guard<std::recursive_mutex> lock(m_asyncSurveillances);
 
-					//// ĎĂ鎲̏𑖍
+					//// 監視している軸の情報を走査
 					//while (index < m_surveillances.size())
 					//{
-					//	// tO
+					//	// 完了フラグ
 					//	bool complete = false;
 
-					//	// 𐧌䂷̃X[p[NX
+					//	// 軸を制御する情報のスーパークラス
 					//	std::shared_ptr<Write::CSuper> super = m_surveillances.at(index);
 
-					//	// ̃T[{𐧌䂷bNXɕϊ
+					//	// 軸のサーボを制御する基礎クラスに変換
 					//	auto basis = std::dynamic_pointer_cast<Write::CBasis>(super);
 
 					//	try
 					//	{
-					//		// 䂷ݒNXmF
+					//		// 軸制御する設定クラスを確認
 					//		if (typeid(Write::CServo) == typeid(*basis))
 					//		{
-					//			// T[{𐧌䂷ݒ
+					//			// サーボを制御する設定
 					//			MotionApi::Setting::CServoControl servoSetting;
 
-					//			// foCX̃nhݒ
+					//			// デバイスのハンドルを設定
 					//			servoSetting.DeviceHandle = basis->DeviceHandle;
 
-					//			// T[{𐧌
-					//			postscript << "Plc::Servo()" << Logging::ConstSeparator << "foCX̃nh:" << basis->DeviceHandle;
+					//			// サーボを制御
+					//			postscript << "Plc::Servo()" << Logging::ConstSeparator << "デバイスのハンドル:" << basis->DeviceHandle;
 					//			Plc::Servo(GetName(), servoSetting);
 					//			postscript.str("");
 
-					//			// tOݒ
+					//			// 完了フラグを設定
 					//			complete = true;
 					//		}
 					//	}
 					//	catch (const Exception::CObject& e)
 					//	{
-					//		// Ȍ  foCX̃nhj
+					//		// 例外の処理 ⇒ デバイスのハンドルを破棄
 					//		postscript << "GetDeviceHandle()";
 					//		Plc::DestroyDevice(GetName(), basis->DeviceHandle);
 					//		postscript.str("");
 
 					//		deviceErrorCode = e.DeviceErrorCode;
 
-					//		// O𔭖C
+					//		// 例外を発砲
 					//		throw std::exception(e.what());
 					//	}
 
-					//	// tOmF
+					//	// 完了フラグを確認
 					//	if (complete)
 					//	{
-					//		// ĎĂ鎲̏폜 擪
+					//		// 監視している軸の情報を削除 ※先頭
 					//		m_surveillances.erase(m_surveillances.begin());
 					//		continue;
 					//	}
 
-					//	// ̃foCX
+					//	// 次のデバイスへ
 					//	index += 1;
 					//}
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  OʒmC
+					// 例外の処理 ⇒ 例外を通知＆発砲
 					throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			
-			/// @detail			̐Jn
-			///					p֐
+			/// @brief			書き込み
+			/// @detail			軸の制御を開始する
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::WriteDerived()
 			{
@@ -273,38 +273,38 @@ namespace Standard
 				{
 					//bool run = true;
 
-					//// ݉\Ȏ
+					//// 書き込み可能な軸だけ制御
 					//while (run)
 					//{
-					//	// ݉\Ȏ̃X[p[NX擾
+					//	// 書き込み可能な軸のスーパークラスを取得
 					//	auto super = GetWrite(true);
 
-					//	// ݉\Ȏ̃X[p[NXmF
+					//	// 書き込み可能な軸のスーパークラスを確認
 					//	if (super == nullptr)
 					//	{
-					//		// YȂ
+					//		// 該当なし
 					//		run = false;
 					//		continue;
 					//	}
 
-					//	//// ̃T[{𐧌䂷bNXɕϊ
+					//	//// 軸のサーボを制御する基礎クラスに変換
 					//	//auto basis = std::dynamic_pointer_cast<Write::CBasis>(super);
 
-					//	//// foCX̃nh擾
+					//	//// デバイスのハンドルを取得
 					//	//postscript << "GetDeviceHandle()";
 					//	//basis->DeviceHandle = GetDeviceHandle(basis->Indexs);
 					//	//postscript.str("");
 
-					//	//// r
+					//	//// 排他制御
 					//	//std::lock_guard<std::recursive_mutex> lock(m_asyncSurveillances);
 
-					//	//// ĎĂ鎲̏NXɒǉ
+					//	//// 監視している軸の情報クラスに追加
 					//	//m_surveillances.push_back(basis);
 					//}
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  OʒmC
+					// 例外の処理 ⇒ 例外を通知＆発砲
 					throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 				}
 			}
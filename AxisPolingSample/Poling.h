@@ -10,34 +10,34 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CWorker
-			/// @brief      ̐ÅĎAԂʒmNX
-			///				 ̐ÅĎAԂʒmev[g̃NXp
-			/// @detail		̐ÅĎAԂ̒ʒms
+			/// @brief      軸の制御、軸の監視、状態を通知するクラス
+			///				⇒ 軸の制御、軸の監視、状態を通知するテンプレートのクラスから継承
+			/// @detail		軸の制御、軸の監視、状態の通知を行う
 			////////////////////////////////////////////////////////////////////////////////
 			class CWorker
 				: virtual public Worker::CTemplate
 			{
 			public:
-				// RXgN^
+				// コンストラクタ
 				CWorker();
 
-				// fXgN^
+				// デストラクタ
 				~CWorker() override;
 
 			protected:
-				// 
+				// 初期化
 				void InitializeDerived() override;
 
-				// j
+				// 破棄
 				void DestroyDerived() override;
 
-				// ǂݍ
+				// 読み込み
 				void ReadDerived() override;
 
-				// 
+				// 書き込み
 				void WriteDerived() override;
 
-				// ʒm
+				// 完了を通知
 				template <typename CWrite, typename CArgument>
 				void NotifyComplete(std::shared_ptr<CArgument> object, bool remove = true);
 			};
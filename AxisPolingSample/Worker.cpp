@@ -5,7 +5,7 @@ namespace Standard
 	namespace Axis
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			RXgN^
+		/// @brief			コンストラクタ
 		////////////////////////////////////////////////////////////////////////////////
 		CWorker::CWorker() : CTemplate()
 		{
@@ -13,7 +13,7 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fXgN^
+		/// @brief			デストラクタ
 		////////////////////////////////////////////////////////////////////////////////
 		CWorker::~CWorker()
 		{
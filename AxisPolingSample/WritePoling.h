@@ -10,15 +10,15 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CInitialize
-			/// @brief      ̏𐧌䂷NX
-			///				 𐧌䂷̃X[p[NXp
+			/// @brief      軸の初期化を制御する情報クラス
+			///				⇒ 軸を制御する情報のスーパークラスから継承
 			////////////////////////////////////////////////////////////////////////////////
 			class CInitialize
 				: virtual public Write::CSuper
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CInitialize()
 				{
@@ -26,19 +26,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CInitialize& operator = (const CInitialize& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CInitialize()
 				{
@@ -47,27 +47,27 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CInitialize& object)
 				{
-					// ̊֐
+					// 既定の関数
 					CSuper::Update(object);
 				}
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CServo
-			/// @brief      ̃T[{𐧌䂷NX
-			///				 ̃T[{𐧌䂷̊bNXp
+			/// @brief      軸のサーボを制御する情報クラス
+			///				⇒ 軸のサーボを制御する情報の基礎クラスから継承
 			////////////////////////////////////////////////////////////////////////////////
 			class CServo
 				: virtual public Write::Servo::CBasis
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CServo() : CBasis()
 				{
@@ -75,19 +75,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CServo& operator = (const CServo& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CServo() override
 				{
@@ -96,12 +96,12 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CServo& object)
 				{
-					// ̊֐
+					// 既定の関数
 					Write::Servo::CBasis::Update(object);
 				}
 			};
@@ -8,9 +8,9 @@ namespace Standard
 	namespace Archive
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			NXɕϊ
-		/// @param[in]		title	NX̃^Cg
-		/// @param[in]		object	ϊ镶
+		/// @brief			文字列をクラスに変換
+		/// @param[in]		title	クラスのタイトル
+		/// @param[in]		object	変換する文字列
 		////////////////////////////////////////////////////////////////////////////////
 		template<class T>
 		inline const T& Input(const std::string& title, const std::string& object)
@@ -23,16 +23,16 @@ namespace Standard
 
 			cereal::JSONInputArchive archive(buffer);
 
-			// fVACY
+			// デシリアライズ
 			archive(cereal::make_nvp(title, ret));
 
 			return ret;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			NX𕶎ɕϊ
-		/// @param[in]		title	NX̃^Cg
-		/// @param[in]		object	ϊNX
+		/// @brief			クラスを文字列に変換
+		/// @param[in]		title	クラスのタイトル
+		/// @param[in]		object	変換するクラス
 		////////////////////////////////////////////////////////////////////////////////
 		template<class T>
 		inline std::string Output(const std::string& title, const T& object)
@@ -42,7 +42,7 @@ namespace Standard
 			{
 				cereal::JSONOutputArchive archive(ret);
 
-				// VACY
+				// シリアライズ
 				archive(cereal::make_nvp(title, object));
 			}
 
@@ -13,35 +13,38 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CDefault
-			/// @brief      ̃ftHgȐݒNX
+			/// @brief      軸のデフォルトな設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CDefault
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CDefault()
 				{
 					Timeout = 5000;
 					Cycle = 10;
+					CycleIdle = 0;
+					CycleHold = 1000;
 					Retry = 3;
+					Executor = false;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CDefault& operator = (const CDefault& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CDefault()
 				{
@@ -50,40 +53,57 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CDefault& object)
 				{
 					this->Timeout = object.Timeout;
 					this->Cycle = object.Cycle;
+					this->CycleIdle = object.CycleIdle;
+					this->CycleHold = object.CycleHold;
 					this->Retry = object.Retry;
+					this->Executor = object.Executor;
 					this->Other = object.Other;
 				}
 
 			public:
-				//! ^CAEg[ms]
+				//! タイムアウト[ms]
 				int Timeout;
 
-				//! |[O̎[ms]
+				//! ポーリングの周期[ms]
+				//! ※トリガーの待機中・監視中か値の変化後の周期
 				int Cycle;
 
-				//! gC
+				//! 変化がない間のポーリングの周期の上限[ms]
+				//! ※Cycleから読み込みごとに2倍して延ばす / Cycle以下:Cycleで固定(既定は0 ⇒ 延ばさない)
+				//! ※延ばすと変化がない間の最初の変化の検出が最大でこの周期まで遅れるため、変化の少ない機器だけ設定する
+				//!   例:サンプル(SamplePlc)のIOはCycle:100msに対して1000msまで延ばす
+				int CycleIdle;
+
+				//! 値の変化後にCycleの周期を続ける時間[ms]
+				int CycleHold;
+
+				//! リトライ回数
 				int Retry;
 
-				//! ̑
+				//! 共有のスレッドプールでポーリングするか
+				//! ※true:CPUのコア数のスレッドを複数の機器で共有 / false:機器ごとに専用のスレッド
+				bool Executor;
+
+				//! その他
 				Variant::CManager Other;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CDriver
-			/// @brief      @̐ݒNX
+			/// @brief      機器の設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CDriver
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CDriver()
 				{
@@ -91,19 +111,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CDriver& operator = (const CDriver& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CDriver()
 				{
@@ -112,8 +132,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CDriver& object)
 				{
@@ -122,22 +142,22 @@ namespace Standard
 				}
 
 			public:
-				//! hCo̖O
+				//! ドライバの名前
 				std::string Name;
 
-				//! ̑
+				//! その他
 				Variant::CManager Other;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CConnect
-			/// @brief      ɐڑݒNX
+			/// @brief      軸に接続する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CConnect
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CConnect()
 				{
@@ -145,19 +165,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CConnect& operator = (const CConnect& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CConnect()
 				{
@@ -166,8 +186,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CConnect& object)
 				{
@@ -176,10 +196,10 @@ namespace Standard
 				}
 
 			public:
-				//! @̐ݒNX
+				//! 機器の設定クラス
 				std::map<int, CDriver> Drivers;
 
-				//! ̑
+				//! その他
 				Variant::CManager Other;
 			};
 		}
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <map>
+#include <sstream>
+#include <vector>
 
 #include "Common/Signal/Define.h"
 #include "Common/Axis/Setting.h"
@@ -15,83 +19,389 @@ namespace Standard
 			namespace Input
 			{
 				////////////////////////////////////////////////////////////////////////////////
-				/// @enum			
+				/// @enum			動作
 				////////////////////////////////////////////////////////////////////////////////
 				enum EnumMotion
 				{
-					MotionAbnormal,					// ُ
-					MotionServo,					// T[{ON
-					MotionOrigin,					// _A
-					MotionRunning,					// s
-					MotionCompleted					// s
+					MotionAbnormal,					// 異常
+					MotionServo,					// サーボON
+					MotionOrigin,					// 原点復帰完了
+					MotionRunning,					// 実行中
+					MotionCompleted					// 実行完了
 				};
 				typedef Iterator::CWorker<EnumMotion, MotionServo, MotionCompleted> MotionIterator;
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @enum			W
+				/// @enum			座標
 				////////////////////////////////////////////////////////////////////////////////
 				enum EnumCoordinate
 				{
-					CoordinatePositiveLimit,			// \tg~bg
-					CoordinateNegativeLimit,			// \tg~bg
-					CoordinateCurrent					// ݂̍W
+					CoordinatePositiveLimit,			// 負方向ソフトリミット
+					CoordinateNegativeLimit,			// 正方向ソフトリミット
+					CoordinateCurrent					// 現在の座標
 				};
 				typedef Iterator::CWorker<EnumCoordinate, CoordinatePositiveLimit, CoordinateCurrent> CoordinateIterator;
 
+				//! 信号の数 ※32bitのレジスタのビット番号
+				const unsigned short ConstSignal = 32;
+
+				//! 座標の数
+				const size_t ConstCoordinate = CoordinateCurrent + 1;
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @class      CSignal
+				/// @brief      信号の状態を保持するクラス
+				/// @detail		信号の番号をビット番号として、値と有効(取得済み)をビットで保持する
+				////////////////////////////////////////////////////////////////////////////////
+				class CSignal
+				{
+				public:
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			コンストラクタ
+					////////////////////////////////////////////////////////////////////////////////
+					CSignal()
+					{
+						Values = 0;
+						Valid = 0;
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
+					////////////////////////////////////////////////////////////////////////////////
+					CSignal& operator = (const CSignal& object) noexcept
+					{
+						// 更新
+						Update(object);
+
+						return *this;
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			コピー代入演算子
+					/// @detail			有効な信号だけ更新
+					/// @return			自クラス
+					////////////////////////////////////////////////////////////////////////////////
+					CSignal& operator += (const CSignal& object) noexcept
+					{
+						// 追加
+						Insert(object);
+
+						return *this;
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			デストラクタ
+					////////////////////////////////////////////////////////////////////////////////
+					~CSignal()
+					{
+
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			信号が有効か確認
+					/// @param[in]		index	信号の番号
+					/// @return			true:有効 / false:無効
+					////////////////////////////////////////////////////////////////////////////////
+					bool IsValid(unsigned short index) const
+					{
+						return (index < ConstSignal) && (Valid >> index & 0x01) != 0;
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			信号を取得
+					/// @param[in]		index	信号の番号
+					/// @return			true:ON / false:OFF ※無効な信号はOFF
+					////////////////////////////////////////////////////////////////////////////////
+					bool Get(unsigned short index) const
+					{
+						return (index < ConstSignal) && (Values >> index & 0x01) != 0;
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			信号を更新
+					/// @param[in]		index	信号の番号
+					/// @param[in]		value	true:ON / false:OFF
+					////////////////////////////////////////////////////////////////////////////////
+					void Set(unsigned short index, bool value)
+					{
+						if (index < ConstSignal)
+						{
+							uint32_t bit = (uint32_t)1 << index;
+
+							Values = value ? (Values | bit) : (Values & ~bit);
+							Valid |= bit;
+						}
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			変化した信号を取得
+					/// @detail			排他的論理和で変化した信号をまとめて求める
+					/// @param[in]		before	変化前の信号
+					/// @return			新規or変化ありの信号だけ有効にした信号
+					////////////////////////////////////////////////////////////////////////////////
+					CSignal GetChange(const CSignal& before) const
+					{
+						CSignal ret;
+
+						ret.Valid = ((before.Values ^ Values) | ~before.Valid) & Valid;
+						ret.Values = Values & ret.Valid;
+
+						return ret;
+					}
+
+				protected:
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
+					////////////////////////////////////////////////////////////////////////////////
+					void Update(const CSignal& object)
+					{
+						this->Values = object.Values;
+						this->Valid = object.Valid;
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			自クラスを追加
+					/// @param[in]		object	自クラス
+					////////////////////////////////////////////////////////////////////////////////
+					void Insert(const CSignal& object)
+					{
+						this->Values = (this->Values & ~object.Valid) | (object.Values & object.Valid);
+						this->Valid |= object.Valid;
+					}
+
+				public:
+					//! 信号の値 ※ビットごとにON/OFF
+					uint32_t Values;
+
+					//! 有効な信号 ※ビットごとに有効/無効
+					uint32_t Valid;
+				};
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @class      CCoordinate
+				/// @brief      座標を保持するクラス
+				/// @detail		座標の列挙子を番号とした配列で保持し、有効(取得済み)をビットで保持する
+				////////////////////////////////////////////////////////////////////////////////
+				class CCoordinate
+				{
+				public:
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			コンストラクタ
+					////////////////////////////////////////////////////////////////////////////////
+					CCoordinate()
+					{
+						Values.fill(0);
+						Valid = 0;
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
+					////////////////////////////////////////////////////////////////////////////////
+					CCoordinate& operator = (const CCoordinate& object) noexcept
+					{
+						// 更新
+						Update(object);
+
+						return *this;
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			コピー代入演算子
+					/// @detail			有効な座標だけ更新
+					/// @return			自クラス
+					////////////////////////////////////////////////////////////////////////////////
+					CCoordinate& operator += (const CCoordinate& object) noexcept
+					{
+						// 追加
+						Insert(object);
+
+						return *this;
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			デストラクタ
+					////////////////////////////////////////////////////////////////////////////////
+					~CCoordinate()
+					{
+
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			座標が有効か確認
+					/// @param[in]		index	座標の種類
+					/// @return			true:有効 / false:無効
+					////////////////////////////////////////////////////////////////////////////////
+					bool IsValid(EnumCoordinate index) const
+					{
+						return ((size_t)index < ConstCoordinate) && (Valid >> index & 0x01) != 0;
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			座標を取得
+					/// @param[in]		index	座標の種類
+					/// @return			座標 ※無効な座標は0
+					////////////////////////////////////////////////////////////////////////////////
+					double Get(EnumCoordinate index) const
+					{
+						return ((size_t)index < ConstCoordinate) ? Values[index] : 0;
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			座標を更新
+					/// @param[in]		index	座標の種類
+					/// @param[in]		value	座標
+					////////////////////////////////////////////////////////////////////////////////
+					void Set(EnumCoordinate index, double value)
+					{
+						if ((size_t)index < ConstCoordinate)
+						{
+							Values[index] = value;
+							Valid |= (uint32_t)1 << index;
+						}
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			変化した座標を取得
+					/// @param[in]		before	変化前の座標
+					/// @return			新規or変化ありの座標だけ有効にした座標
+					////////////////////////////////////////////////////////////////////////////////
+					CCoordinate GetChange(const CCoordinate& before) const
+					{
+						CCoordinate ret;
+
+						uint32_t bits = 0;
+
+						// 座標を走査 ⇒ 変化ありを確認
+						for (size_t index = 0; index < ConstCoordinate; index++)
+						{
+							bits |= (uint32_t)(before.Values[index] != Values[index]) << index;
+						}
+
+						ret.Valid = (bits | ~before.Valid) & Valid;
+						ret.Values = Values;
+
+						return ret;
+					}
+
+				protected:
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
+					////////////////////////////////////////////////////////////////////////////////
+					void Update(const CCoordinate& object)
+					{
+						this->Values = object.Values;
+						this->Valid = object.Valid;
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			自クラスを追加
+					/// @param[in]		object	自クラス
+					////////////////////////////////////////////////////////////////////////////////
+					void Insert(const CCoordinate& object)
+					{
+						for (size_t index = 0; index < ConstCoordinate; index++)
+						{
+							this->Values[index] = (object.Valid >> index & 0x01) ? object.Values[index] : this->Values[index];
+						}
+						this->Valid |= object.Valid;
+					}
+
+				public:
+					//! 座標
+					std::array<double, ConstCoordinate> Values;
+
+					//! 有効な座標 ※ビットごとに有効/無効
+					uint32_t Valid;
+				};
+
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CDriver
-				/// @brief      @̏ԂێNX
+				/// @brief      機器の状態を保持するクラス
 				////////////////////////////////////////////////////////////////////////////////
 				class CDriver
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CDriver()
 					{
+						Id = 0;
 						Name = "";
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CDriver& operator = (const CDriver& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CDriver& operator += (const CDriver& object) noexcept
 					{
-						// ǉ
+						// 追加
 						Insert(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CDriver()
 					{
 
 					}
 
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			変化した状態を取得
+					/// @param[in]		before	変化前の状態
+					/// @return			新規or変化ありの状態だけ有効にした状態
+					////////////////////////////////////////////////////////////////////////////////
+					CDriver GetChange(const CDriver& before) const
+					{
+						CDriver ret;
+
+						ret.Id = Id;
+						ret.Name = Name;
+						ret.Motion = Motion.GetChange(before.Motion);
+						ret.Warning = Warning.GetChange(before.Warning);
+						ret.Alarm = Alarm.GetChange(before.Alarm);
+						ret.Coordinate = Coordinate.GetChange(before.Coordinate);
+
+						return ret;
+					}
+
+					////////////////////////////////////////////////////////////////////////////////
+					/// @brief			有効な状態があるか確認
+					/// @return			true:あり / false:なし
+					////////////////////////////////////////////////////////////////////////////////
+					bool IsValid() const
+					{
+						return (Motion.Valid | Warning.Valid | Alarm.Valid | Coordinate.Valid) != 0;
+					}
+
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CDriver& object)
 					{
+						this->Id = object.Id;
 						this->Name = object.Name;
 						this->Motion = object.Motion;
 						this->Warning = object.Warning;
@@ -100,134 +410,218 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXǉ
-					/// @param[in]		object	NX
+					/// @brief			自クラスを追加
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Insert(const CDriver& object)
 					{
+						this->Id = object.Id;
 						this->Name = object.Name;
-						for (const auto& motion : object.Motion)
-						{
-							this->Motion[motion.first] = motion.second;
-						}
-						for (const auto& warning : object.Warning)
-						{
-							this->Warning[warning.first] = warning.second;
-						}
-						for (const auto& alarm : object.Alarm)
-						{
-							this->Alarm[alarm.first] = alarm.second;
-						}
-						for (const auto& coordinate : object.Coordinate)
-						{
-							this->Coordinate[coordinate.first] = coordinate.second;
-						}
+						this->Motion += object.Motion;
+						this->Warning += object.Warning;
+						this->Alarm += object.Alarm;
+						this->Coordinate += object.Coordinate;
 					}
 
 				public:
-					//! 
+					//! 軸の識別子
+					int Id;
+
+					//! 名称
 					std::string Name;
 
-					//! 
-					std::map<unsigned short, bool> Motion;
+					//! 動作 ※番号はEnumMotion
+					CSignal Motion;
 
-					//! [jO
-					std::map<unsigned short, bool> Warning;
+					//! ワーニング
+					CSignal Warning;
 
-					//! A[
-					std::map<unsigned short, bool> Alarm;
+					//! アラーム
+					CSignal Alarm;
 
-					//! W
-					std::map<EnumCoordinate, double> Coordinate;
+					//! 座標
+					CCoordinate Coordinate;
 				};
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CInput
-			/// @brief      ̏()ێNX
+			/// @brief      軸の状態(入力)を保持するクラス
+			/// @detail		機器の状態は軸の識別子を含めて連続した領域に保持する
+			///				監視で通知する場合は変化した状態だけ格納する
+			///				通知ごとの連番と直前の連番を比較すると、取りこぼした通知を検出できる
 			////////////////////////////////////////////////////////////////////////////////
 			class CInput
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CInput()
 				{
-
+					Sequence = 0;
+					Previous = 0;
+					Timestamp = 0;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CInput& operator = (const CInput& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CInput& operator += (const CInput& object) noexcept
 				{
-					// ǉ
+					// 追加
 					Insert(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CInput()
 				{
 
 				}
 
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			機器の状態を追加
+				/// @detail			登録済みの場合は登録済みの機器の状態を取得
+				/// @param[in]		id	軸の識別子
+				/// @return			機器の状態を保持するクラス
+				////////////////////////////////////////////////////////////////////////////////
+				Input::CDriver& AddDriver(int id)
+				{
+					// 機器の状態の番号を取得
+					size_t index = FindDriver(id);
+
+					// 登録済みを確認
+					if (Drivers.size() <= index)
+					{
+						// 未登録 ⇒ 追加
+						Drivers.emplace_back();
+						Drivers.back().Id = id;
+					}
+
+					return Drivers[index];
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			機器の状態を取得
+				/// @param[in]		id	軸の識別子
+				/// @return			機器の状態を保持するクラス
+				////////////////////////////////////////////////////////////////////////////////
+				const Input::CDriver& GetDriver(int id) const throw(...)
+				{
+					// 機器の状態の番号を取得
+					size_t index = FindDriver(id);
+
+					// 登録済みを確認
+					if (Drivers.size() <= index)
+					{
+						// 機器の状態なし
+						std::stringstream message;
+						message << "軸の識別子が範囲外:" << id;
+						throw std::exception(message.str().c_str());
+					}
+
+					return Drivers[index];
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			機器の状態の番号を取得
+				/// @param[in]		id	軸の識別子
+				/// @return			機器の状態の番号 ※未登録の場合は機器の状態の数
+				////////////////////////////////////////////////////////////////////////////////
+				size_t FindDriver(int id) const
+				{
+					size_t ret = 0;
+
+					// 機器の状態を走査
+					for (; ret < Drivers.size(); ret++)
+					{
+						if (Drivers[ret].Id == id)
+						{
+							break;
+						}
+					}
+
+					return ret;
+				}
+
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CInput& object)
 				{
-					this->Drivers.clear();
 					this->Drivers = object.Drivers;
+					this->Sequence = object.Sequence;
+					this->Previous = object.Previous;
+					this->Timestamp = object.Timestamp;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXǉ
-				/// @param[in]		object	NX
+				/// @brief			自クラスを追加
+				/// @detail			連番と時刻は追加したクラスに更新し、直前の連番は最初のクラスを保持する
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Insert(const CInput& object)
 				{
 					for (const auto& driver : object.Drivers)
 					{
-						this->Drivers[driver.first] += driver.second;
+						this->AddDriver(driver.Id) += driver;
+					}
+
+					// 統合前の通知を確認
+					if (this->Sequence == 0)
+					{
+						// 最初の通知 ⇒ 直前の連番を更新
+						this->Previous = object.Previous;
 					}
+
+					this->Sequence = object.Sequence;
+					this->Timestamp = object.Timestamp;
 				}
 
 			public:
-				//! @̏ԂێNX
-				std::map<int, Input::CDriver> Drivers;
+				//! 機器の状態を保持するクラス ※軸の識別子はInput::CDriver::Id
+				std::vector<Input::CDriver> Drivers;
+
+				//! 通知の連番 ※1から開始
+				uint64_t Sequence;
+
+				//! 直前に通知した連番 ※通知を統合した場合は統合した最初の通知の直前
+				uint64_t Previous;
+
+				//! 読み込んだ時刻[us] ※Grabber::Frame::Now()と同じ時計
+				int64_t Timestamp;
 			};
 
 			namespace Output
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CTemplate
-				/// @brief      ̏(o)w肷ev[g̃NX
+				/// @brief      軸の状態(出力)を指定するテンプレートのクラス
 				////////////////////////////////////////////////////////////////////////////////
 				class CTemplate
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CTemplate()
 					{
@@ -235,19 +629,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CTemplate& operator = (const CTemplate& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					virtual ~CTemplate()
 					{
@@ -256,8 +650,8 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CTemplate& object)
 					{
@@ -266,24 +660,24 @@ namespace Standard
 					}
 
 				public:
-					//! @̐ݒNX
+					//! 機器の設定クラス
 					std::map<int, Axis::Setting::CDriver> Drivers;
 
-					//! ̑
+					//! その他
 					Variant::CManager Other;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CSuspend
-				/// @brief      ̒~w肷NX
-				///				 ̏(o)w肷ev[g̃NXh
+				/// @brief      制御の停止を指定するクラス
+				///				⇒ 軸の状態(出力)を指定するテンプレートのクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CSuspend
 					: virtual public CTemplate
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CSuspend() : CTemplate()
 					{
@@ -291,19 +685,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CSuspend& operator = (const CSuspend& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CSuspend()
 					{
@@ -312,27 +706,27 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CSuspend& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 					}
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CServo
-				/// @brief      T[{̏Ԃw肷NX
-				///				 ̏(o)w肷ev[g̃NXh
+				/// @brief      サーボの状態を指定するクラス
+				///				⇒ 軸の状態(出力)を指定するテンプレートのクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CServo
 					: virtual public CTemplate
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CServo() : CTemplate()
 					{
@@ -340,19 +734,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CServo& operator = (const CServo& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CServo()
 					{
@@ -361,33 +755,33 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CServo& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 
 						this->Mode = object.Mode;
 					}
 
 				public:
-					//! 
+					//! 状態
 					Signal::EnumStatus Mode;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CMoveOrigin
-				/// @brief      _A̎sw肷NX
-				///				 ̏(o)w肷ev[g̃NXh
+				/// @brief      原点復帰の実行を指定するクラス
+				///				⇒ 軸の状態(出力)を指定するテンプレートのクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CMoveOrigin
 					: virtual public CTemplate
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CMoveOrigin() : CTemplate()
 					{
@@ -395,19 +789,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CMoveOrigin& operator = (const CMoveOrigin& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CMoveOrigin()
 					{
@@ -416,27 +810,27 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CMoveOrigin& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 					}
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CStartJog
-				/// @brief      WO̊Jnw肷NX
-				///				 ̏(o)w肷ev[g̃NXh
+				/// @brief      ジョグの開始を指定するクラス
+				///				⇒ 軸の状態(出力)を指定するテンプレートのクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CStartJog
 					: virtual public CTemplate
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CStartJog() : CTemplate()
 					{
@@ -444,19 +838,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CStartJog& operator = (const CStartJog& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CStartJog()
 					{
@@ -465,27 +859,27 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CStartJog& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 					}
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CStopJog
-				/// @brief      WO̒~w肷NX
-				///				 ̏(o)w肷ev[g̃NXh
+				/// @brief      ジョグの停止を指定するクラス
+				///				⇒ 軸の状態(出力)を指定するテンプレートのクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CStopJog
 					: virtual public CTemplate
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CStopJog() : CTemplate()
 					{
@@ -493,19 +887,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CStopJog& operator = (const CStopJog& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CStopJog()
 					{
@@ -514,12 +908,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CStopJog& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 					}
 				};
@@ -527,13 +921,13 @@ namespace Standard
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      COutput
-			/// @brief      ̏(o)w肷NX
+			/// @brief      軸の状態(出力)を指定するクラス
 			////////////////////////////////////////////////////////////////////////////////
 			class COutput
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				COutput()
 				{
@@ -541,19 +935,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				COutput& operator = (const COutput& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~COutput()
 				{
@@ -562,8 +956,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const COutput& object)
 				{
@@ -572,10 +966,10 @@ namespace Standard
 				}
 
 			public:
-				//! ^CAEg[ms]
+				//! タイムアウト[ms]
 				int Timeout;
 
-				//! w肷NX
+				//! 制御を指定するクラス
 				boost::any Command;
 			};
 		}
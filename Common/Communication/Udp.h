@@ -17,9 +17,9 @@ namespace Standard
 	namespace Communication
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			Shift-JIS  UTF8֕ϊ CC֐
-		/// @param[in]		value	f[^
-		/// @return         UTF8ɕϊꂽ
+		/// @brief			Shift-JIS → UTF8へ変換 ※インライン関数
+		/// @param[in]		value	元データ
+		/// @return         UTF8に変換された文字列
 		////////////////////////////////////////////////////////////////////////////////
 		inline std::string ShiftJisToUtf8(const std::string& value)
 		{
@@ -27,7 +27,7 @@ namespace Standard
 
 			std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
 
-			// Shift-JIS  UTF8֕ϊ
+			// Shift-JIS → UTF8へ変換
 			ret = converter.to_bytes(Text::Convert(value));
 
 			return ret;
@@ -39,14 +39,14 @@ namespace Standard
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CWorker
-			/// @brief      UDPʐMsNX
-			/// @detail		Mf[^̓o^A񓯊őMs
+			/// @brief      UDP通信を行うクラス
+			/// @detail		送信データの登録、非同期で送信を行う
 			////////////////////////////////////////////////////////////////////////////////
 			class CWorker
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CWorker() :
 					  m_sequentialAsync(m_io_service, 1)
@@ -58,7 +58,7 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CWorker()
 				{
@@ -69,82 +69,82 @@ namespace Standard
 
 					try
 					{
-						// j
+						// 破棄
 						postscript << "Destroy()";
 						Destroy();
 						postscript.str("");
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  fobOo
+						// 例外の処理 ⇒ デバッグ出力
 						Exception::OutputDebug(logging, postscript.str(), e);
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			j
+				/// @brief			破棄
 				////////////////////////////////////////////////////////////////////////////////
 				void Destroy()
 				{
-					// 񓯊~
+					// 順次非同期処理を停止
 					m_sequentialAsync.Stop();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Oʒm֐̓o^
-				/// @detail			O̔ɌĂяoꂽ֐w肷
-				/// @param[in]		object	Ăяoꂽ֐
+				/// @brief			例外を通知する関数の登録
+				/// @detail			例外の発生時に呼び出されたい関数を指定する
+				/// @param[in]		object	呼び出されたい関数
 				////////////////////////////////////////////////////////////////////////////////
 				void AttachFunctionException(std::function<void(const Exception::CObject&)> object)
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncException);
 
-					// O̒ʒmo^
+					// 例外の通知を登録
 					_FunctionException = object;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Oʒm֐̉
-				/// @detail			O̔ɌĂяo֐
+				/// @brief			例外を通知する関数の解除
+				/// @detail			例外の発生時に呼び出される関数を解除する
 				////////////////////////////////////////////////////////////////////////////////
 				void DetachFunctionException()
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncException);
 
-					// O̒ʒm
+					// 例外の通知を解除
 					_FunctionException = nullptr;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			M֐ڑ
-				/// @detail			ڑ֐񓯊ŌĂяo
-				/// @param[in]		address	IPAhX
-				/// @param[in]		port	|[g(ڑ)
+				/// @brief			送信先へ接続
+				/// @detail			接続する関数を非同期で呼び出す
+				/// @param[in]		address	IPアドレス
+				/// @param[in]		port	ポート(接続先)
 				////////////////////////////////////////////////////////////////////////////////
 				void AsyncConnect(const std::string& address, unsigned short port)
 				{
-					// ڑ
+					// 接続
 					m_strand.post(boost::bind(&CWorker::Connect, this, address, port));
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Mf[^ǉ
-				/// @detail			ǉ֐񓯊ŌĂяo
-				/// @param[in]		value	bZ[W
+				/// @brief			送信データを追加
+				/// @detail			追加する関数を非同期で呼び出す
+				/// @param[in]		value	メッセージ
 				////////////////////////////////////////////////////////////////////////////////
 				void AsyncMessagePush(const std::string& value)
 				{
-					// Mf[^ǉ
+					// 送信データを追加
 					m_strand.post(boost::bind(&CWorker::MessagePush, this, value));
 				}
 
 			private:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			O̒ʒm]
-				/// @detail			ʒm̓]͔񓯊̊֐gp鎖
-				/// @param[in]		object	ÕNX
+				/// @brief			例外の通知を転送
+				/// @detail			通知の転送は非同期の関数を使用する事
+				/// @param[in]		object	例外のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void TransferException(const Exception::CObject& object)
 				{
@@ -155,30 +155,30 @@ namespace Standard
 
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncException);
 
 						postscript << "_FunctionException()";
 						if (_FunctionException != nullptr)
 						{
-							// Oʒm֐L  Oʒm
+							// 例外を通知する関数が有効 ⇒ 例外を通知
 							_FunctionException(object);
 						}
 						postscript.str("");
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  fobOo
+						// 例外の処理 ⇒ デバッグ出力
 						Exception::OutputDebug(logging, postscript.str(), e);
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			O̒ʒm]
-				/// @param[in]		errorCode	G[R[h
-				/// @param[in]		logging	ÕNX
-				/// @param[in]		postscript	ǉ̕
-				/// @param[in]		e	O
+				/// @brief			例外の通知を転送
+				/// @param[in]		errorCode	エラーコード
+				/// @param[in]		logging	ログのクラス
+				/// @param[in]		postscript	追加の文字列
+				/// @param[in]		e	例外
 				////////////////////////////////////////////////////////////////////////////////
 				void TransferException(Exception::EnumCode errorCode, const Logging::CObject& logging, const std::string& postscript, const std::exception& e)
 				{
@@ -190,15 +190,15 @@ namespace Standard
 					message << logging.Message.str() << postscript << Logging::ConstSeparator << e.what();
 					object.Message = message.str();
 
-					// O̒ʒm]
+					// 例外の通知を転送
 					TransferException(object);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			M֐ڑ
-				/// @detail			Mւ̐ڑ͔񓯊̊֐gp鎖
-				/// @param[in]		address		IPAhX
-				/// @param[in]		port	|[g(ڑ)
+				/// @brief			送信先へ接続
+				/// @detail			送信先への接続は非同期の関数を使用する事
+				/// @param[in]		address		IPアドレス
+				/// @param[in]		port	ポート(接続先)
 				////////////////////////////////////////////////////////////////////////////////
 				void Connect(const std::string& address, unsigned short port)
 				{
@@ -209,7 +209,7 @@ namespace Standard
 
 					try
 					{
-						// ڑmF
+						// 接続を確認
 						postscript << "m_socket.is_open()";
 						if (m_socket.is_open())
 						{
@@ -221,32 +221,32 @@ namespace Standard
 
 						boost::system::error_code error;
 
-						// ڑ
+						// 接続
 						postscript << "m_socket.connet()";
 						m_socket.connect(boost::asio::ip::udp::endpoint(boost::asio::ip::address::from_string(address), port), error);
 
-						// G[mF
+						// エラーを確認
 						if (error)
 						{
 							std::stringstream message;
 							message << "Error:" << error;
 
-							// O𔭖C
+							// 例外を発砲
 							throw std::runtime_error(message.str());
 						}
 						postscript.str("");
 					}
 					catch (const std::exception & e)
 					{
-						// Ȍ  O]
+						// 例外の処理 ⇒ 例外を転送
 						TransferException(Exception::CodeUdpConnect, logging, postscript.str(), e);
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Mf[^ǉ
-				/// @detail			Mf[^̒ǉ͔񓯊̊֐gp鎖
-				/// @param[in]		value	bZ[W
+				/// @brief			送信データを追加
+				/// @detail			送信データの追加は非同期の関数を使用する事
+				/// @param[in]		value	メッセージ
 				////////////////////////////////////////////////////////////////////////////////
 				void MessagePush(const std::string& value)
 				{
@@ -257,7 +257,7 @@ namespace Standard
 
 					try
 					{
-						// Mf[^𕪊鐔vZ
+						// 送信データを分割する数を計算
 						postscript << "size()";
 						size_t size = m_buffers.size();
 						size_t block = 10000;
@@ -266,32 +266,32 @@ namespace Standard
 						size_t last = 0;
 						postscript.str("");
 
-						// Mf[^𕪊đ
+						// 送信データを分割して走査
 						postscript << "m_buffers.push_back()";
 						for (size_t index = 0; index < split; index++)
 						{
-							// Mf[^𕪊ăobt@֒ǉ
+							// 送信データを分割してバッファへ追加
 							m_buffers.push_back(value.substr(last, block));
 							last += block;
 						}
 
-						// Mf[^̗]obt@Ɋi[
+						// 送信データの余りをバッファに格納
 						if (remainder)
 						{
-							// obt@[֒ǉ
+							// バッファーへ追加
 							m_buffers.push_back(value.substr(last, remainder));
 						}
 						postscript.str("");
 
 						do
 						{
-							// M̃obt@[邩mF
+							// 未送信のバッファーがあるか確認
 							if (0 < size)
 							{
 								break;
 							}
 
-							// M̎葱
+							// 送信の手続き
 							postscript << "AsyncWriteProdure()";
 							AsyncWriteProcedure();
 							postscript.str("");
@@ -299,29 +299,29 @@ namespace Standard
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O]
+						// 例外の処理 ⇒ 例外を転送
 						TransferException(Exception::CodeUdpWrite, logging, postscript.str(), e);
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			M̎葱
-				/// @detail			M̎葱񓯊ŌĂяo
+				/// @brief			送信の手続き
+				/// @detail			送信の手続きを非同期で呼び出す
 				////////////////////////////////////////////////////////////////////////////////
 				void AsyncWriteProcedure()
 				{
-					// 擪̃obt@擾
+					// 先頭のバッファを取得
 					const std::string& value = ShiftJisToUtf8(m_buffers.front());
 
-					// 񓯊őM
+					// 非同期で送信
 					m_socket.async_send(boost::asio::buffer(value.c_str(), value.size()), m_strand.wrap(boost::bind(&CWorker::OnWriteCompleted, this, boost::asio::placeholders::error, boost::asio::placeholders::bytes_transferred)));
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			M̃Cxg
-				/// @detail			M^C~OŔ
-				/// @param[in]		error	G[
-				/// @param[in]		size	MTCY
+				/// @brief			送信後のイベント
+				/// @detail			送信が完了したタイミングで発生する
+				/// @param[in]		error	エラー
+				/// @param[in]		size	送信サイズ
 				////////////////////////////////////////////////////////////////////////////////
 				void OnWriteCompleted(const boost::system::error_code& error, const size_t size)
 				{
@@ -329,56 +329,56 @@ namespace Standard
 
 					logging.Message << "Communication::CUdp::OnWriteCompleted()" << Logging::ConstSeparator;
 
-					// obt@[̐擪폜
+					// バッファーの先頭を削除
 					m_buffers.pop_front();
 
 					do
 					{
-						// G[mF
+						// エラーを確認
 						if (error)
 						{
 							logging.Level = Logging::LevelError;
 							logging.Message << "Error:" << error;
 
-							// O]
+							// 例外を転送
 							TransferException(Exception::CObject(Exception::CodeUdpWrite, logging.Message.str()));
 							break;
 						}
 
-						// M̃obt@[邩mF
+						// 未送信のバッファーがあるか確認
 						if (m_buffers.empty())
 						{
 							break;
 						}
 
-						// M̎葱
+						// 送信の手続き
 						AsyncWriteProcedure();
 					} while (false);
 				}
 
 			private:
-				//! rNX(Oʒm֐p)
+				//! 排他制御クラス(例外を通知する関数用)
 				std::recursive_mutex m_asyncException;
 
-				//! Oʒm֐
+				//! 例外を通知する関数
 				std::function<void(const Exception::CObject&)> _FunctionException;
 
-				//! IOT[rX
+				//! IOサービス
 				boost::asio::io_service m_io_service;
 
-				//! 񓯊̃NX
+				//! 順次非同期処理のクラス
 				Utility::CSequentialAsync m_sequentialAsync;
 
-				//! r̃NX
+				//! 順次排他制御のクラス
 				boost::asio::io_service::strand m_strand;
 
-				//! \Pbg̃NX
+				//! ソケットのクラス
 				boost::asio::ip::udp::socket m_socket;
 
-				//! MIPAhX
+				//! 送信先のIPアドレス
 				std::string m_address;
 
-				//! M̃obt@
+				//! 送信文字列のバッファ
 				std::deque<std::string> m_buffers;
 			};
 		}
@@ -7,10 +7,10 @@ namespace Standard
 	namespace Dll
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			AvP[ṼGg|Cg
-		/// @param[in]		hModule	nh
-		/// @param[in]		ul_reason_for_call	Ăяo
-		/// @param[in]		lpReserved	߂l
+		/// @brief			アプリケーションのエントリポイントを処理
+		/// @param[in]		hModule	ハンドル
+		/// @param[in]		ul_reason_for_call	呼び出し
+		/// @param[in]		lpReserved	戻り値
 		////////////////////////////////////////////////////////////////////////////////
 		inline void Main(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserved)
 		{
@@ -19,21 +19,21 @@ namespace Standard
 			switch (ul_reason_for_call)
 			{
 			case DLL_PROCESS_ATTACH:
-				// DLLvZX̃AhXԂɃ}bsOꂽB  W[IDŏ
+				// DLLがプロセスのアドレス空間にマッピングされた。 ⇒ モジュールIDで初期化
 				versionManager.Initialize(hModule);
 				break;
 
 			case DLL_THREAD_ATTACH:
-				// Xbh쐬悤ƂĂB
+				// スレッドが作成されようとしている。
 				break;
 
 			case DLL_THREAD_DETACH:
-				// Xbhj悤ƂĂB  j
+				// スレッドが破棄されようとしている。 ⇒ 破棄
 				versionManager.Destroy();
 				break;
 
 			case DLL_PROCESS_DETACH:
-				// DLL̃}bsO悤ƂĂB
+				// DLLのマッピングが解除されようとしている。
 				break;
 			}
 		}
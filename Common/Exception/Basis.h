@@ -11,15 +11,15 @@ namespace Standard
 	{
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CObject
-		/// @brief      ȌێNX
-		///				 std::exceptionh
+		/// @brief      例外の情報を保持するクラス
+		///				⇒ std::exceptionから派生
 		////////////////////////////////////////////////////////////////////////////////
 		class CObject
 			: virtual public std::exception
 		{
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CObject() : std::exception("")
 			{
@@ -29,52 +29,52 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
-			/// @param[in]		errorCode	G[R[h
+			/// @brief			コンストラクタ
+			/// @param[in]		errorCode	エラーコード
 			////////////////////////////////////////////////////////////////////////////////
 			CObject(int errorCode) : std::exception("")
 			{
-				// XV
+				// 更新
 				Update(errorCode, DeviceCodeSuccess, "");
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
-			/// @param[in]		errorCode	G[R[h
-			/// @param[in]		message	bZ[W
+			/// @brief			コンストラクタ
+			/// @param[in]		errorCode	エラーコード
+			/// @param[in]		message	メッセージ
 			////////////////////////////////////////////////////////////////////////////////
 			CObject(int errorCode, const std::string& message) : std::exception(message.c_str())
 			{
-				// XV
+				// 更新
 				Update(errorCode, DeviceCodeSuccess, message);
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
-			/// @param[in]		errorCode	G[R[h
-			/// @param[in]		deviceErrorCode	@̃G[R[h
-			/// @param[in]		message	bZ[W
+			/// @brief			コンストラクタ
+			/// @param[in]		errorCode	エラーコード
+			/// @param[in]		deviceErrorCode	機器のエラーコード
+			/// @param[in]		message	メッセージ
 			////////////////////////////////////////////////////////////////////////////////
 			CObject(int errorCode, int deviceErrorCode, const std::string& message) : std::exception(message.c_str())
 			{
-				// XV
+				// 更新
 				Update(errorCode, deviceErrorCode, message);
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			Rs[Zq
-			/// @return			NX
+			/// @brief			コピー代入演算子
+			/// @return			自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			CObject& operator = (const CObject& object) noexcept
 			{
-				// XV
+				// 更新
 				Update(object.ErrorCode, object.DeviceErrorCode, object.Message);
 
 				return *this;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			~CObject()
 			{
@@ -82,9 +82,9 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			bZ[W擾
-			///					p֐
-			/// @return			bZ[W
+			/// @brief			メッセージを取得
+			///					★継承した関数
+			/// @return			メッセージ
 			////////////////////////////////////////////////////////////////////////////////
 			virtual const char* what() const throw()
 			{
@@ -93,21 +93,21 @@ namespace Standard
 
 		protected:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			NXXV
-			/// @param[in]		object	NX
+			/// @brief			自クラスを更新
+			/// @param[in]		object	自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			void Update(const CObject& object)
 			{
-				// XV
+				// 更新
 				Update(object.ErrorCode, object.DeviceErrorCode, object.Message);
 			}
 
 		private:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			NXXV
-			/// @param[in]		errorCode	G[R[h
-			/// @param[in]		deviceErrorCode	@̃G[R[h
-			/// @param[in]		message	bZ[W
+			/// @brief			自クラスを更新
+			/// @param[in]		errorCode	エラーコード
+			/// @param[in]		deviceErrorCode	機器のエラーコード
+			/// @param[in]		message	メッセージ
 			////////////////////////////////////////////////////////////////////////////////
 			void Update(int errorCode, int deviceErrorCode, const std::string& message)
 			{
@@ -117,13 +117,13 @@ namespace Standard
 			}
 
 		public:
-			//! G[R[h
+			//! エラーコード
 			int ErrorCode;
 
-			//! @̃G[R[h
+			//! 機器のエラーコード
 			int DeviceErrorCode;
 
-			//! bZ[W
+			//! メッセージ
 			std::string Message;
 		};
 	}
@@ -5,91 +5,102 @@ namespace Standard
 	namespace Exception
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @enum			OR[h
+		/// @enum			例外コード
 		////////////////////////////////////////////////////////////////////////////////
 		enum EnumCode
 		{
-			CodeSuccess = 0,							//! 
-#pragma region o[W(0x7000`)
-			CodeVersion = 0x7000,						//! o[W̎擾Ɏs
+			CodeSuccess = 0,							//! 正常
+#pragma region バージョン(0x7000～)
+			CodeVersion = 0x7000,						//! バージョンの取得に失敗
 #pragma endregion
-#pragma region O(0x7100`0x71FF)
-			CodeTransferInitialized = 0x7100,			//! O]̏{ς
-			CodeTransferDiscarded = 0x7101,				//! O]̔j{ς
+#pragma region ログ(0x7100～0x71FF)
+			CodeTransferInitialized = 0x7100,			//! ログ転送の初期化が実施済み
+			CodeTransferDiscarded = 0x7101,				//! ログ転送の破棄が実施済み
+			CodeTransferFileOpen = 0x7110,				//! ログファイルの作成に失敗
+			CodeTransferFileWrite = 0x7111,				//! ログファイルの書き込みに失敗
 #pragma endregion
-#pragma region J(0x7200`0x72FF)
-			CodeGrabberDeviceLost = 0x7200,				//! J̐ؒf
-			CodeGrabberInitialized = 0x7201,			//! J̏{ς
-			CodeGrabberUninitialized = 0x7202,			//! J̖
-			CodeGrabberDiscarded = 0x7203,				//! J̔j{ς
-			CodeGrabberInterface = 0x7204,				//! J̃C^[tF[XȂ
-			CodeGrabberDataStream = 0x7205,				//! J̃f[^Xg[Ȃ
-			CodeGrabberDevice = 0x7206,					//! J̐ڑȂ
-			CodeGrabberInitialize = 0x7210,				//! J̏Ɏs
-			CodeGrabberDestroy = 0x7220,				//! J̔jɎs
-			CodeGrabberConnect = 0x7230,				//! J̐ڑɎs
-			CodeGrabberDisconnect = 0x7240,				//! J̐ؒfɎs
-			CodeGrabberParameterGet = 0x7250,			//! J̃p[^擾Ɏs
-			CodeGrabberParameterSet = 0x7260,			//! J̃p[^XVɎs
-			CodeGrabberCapture = 0x7270,				//! J̎荞݂Ɏs
-			CodeGrabberCaptureNotStart = 0x7271,		//! J̎荞݂{
-			CodeGrabberCaptureTimeout = 0x7272,			//! J̎荞݃^CAEg
-			CodeGrabberCaptureNotImage = 0x7273,		//! J̎荞݂ŉ摜f[^Ȃ
-			CodeGrabberCaptureNotFormat = 0x7274,		//! J̎荞݂ŉ摜tH[}bgΉ
+#pragma region カメラ(0x7200～0x72FF)
+			CodeGrabberDeviceLost = 0x7200,				//! カメラの切断
+			CodeGrabberInitialized = 0x7201,			//! カメラの初期化が実施済み
+			CodeGrabberUninitialized = 0x7202,			//! カメラの未初期化
+			CodeGrabberDiscarded = 0x7203,				//! カメラの破棄が実施済み
+			CodeGrabberInterface = 0x7204,				//! カメラのインターフェースなし
+			CodeGrabberDataStream = 0x7205,				//! カメラのデータストリームなし
+			CodeGrabberDevice = 0x7206,					//! カメラの接続なし
+			CodeGrabberHandle = 0x7207,					//! カメラのハンドルなし
+			CodeGrabberInitialize = 0x7210,				//! カメラの初期化に失敗
+			CodeGrabberDestroy = 0x7220,				//! カメラの破棄に失敗
+			CodeGrabberConnect = 0x7230,				//! カメラの接続に失敗
+			CodeGrabberDisconnect = 0x7240,				//! カメラの切断に失敗
+			CodeGrabberParameterGet = 0x7250,			//! カメラのパラメータ取得に失敗
+			CodeGrabberParameterSet = 0x7260,			//! カメラのパラメータ更新に失敗
+			CodeGrabberCapture = 0x7270,				//! カメラの取り込みに失敗
+			CodeGrabberCaptureNotStart = 0x7271,		//! カメラの取り込みが未実施
+			CodeGrabberCaptureTimeout = 0x7272,			//! カメラの取り込みタイムアウト
+			CodeGrabberCaptureNotImage = 0x7273,		//! カメラの取り込みで画像データなし
+			CodeGrabberCaptureNotFormat = 0x7274,		//! カメラの取り込みで画像フォーマット未対応
+			CodeGrabberTriggerDisabled = 0x7275,		//! カメラのトリガが無効
 #pragma endregion
-#pragma region IO(0x7300`0x73FF)
-			CodeIoInitialized = 0x7301,					//! IȌ{ς
-			CodeIoUninitialized = 0x7302,				//! IO̖
-			CodeIoDiscarded = 0x7303,					//! IO̔j{ς
-			CodeIoInitialize = 0x7310,					//! IȌɎs
-			CodeIoDestroy = 0x7320,						//! IO̔jɎs
-			CodeIoConnect = 0x7330,						//! IO̐ڑɎs
-			CodeIoDisconnect = 0x7340,					//! IO̐ؒfɎs
-			CodeIoRead = 0x7350,						//! IO̓ǂݍ݂Ɏs
-			CodeIoWrite = 0x7360,						//! IȌ݂Ɏs
+#pragma region IO(0x7300～0x73FF)
+			CodeIoInitialized = 0x7301,					//! IOの初期化が実施済み
+			CodeIoUninitialized = 0x7302,				//! IOの未初期化
+			CodeIoDiscarded = 0x7303,					//! IOの破棄が実施済み
+			CodeIoInitialize = 0x7310,					//! IOの初期化に失敗
+			CodeIoDestroy = 0x7320,						//! IOの破棄に失敗
+			CodeIoConnect = 0x7330,						//! IOの接続に失敗
+			CodeIoDisconnect = 0x7340,					//! IOの切断に失敗
+			CodeIoRead = 0x7350,						//! IOの読み込みに失敗
+			CodeIoWrite = 0x7360,						//! IOの書き込みに失敗
 #pragma endregion
-#pragma region (0x7400`0x74FF)
-			CodeAxisInitialized = 0x7401,				//! ̏{ς
-			CodeAxisUninitialized = 0x7402,				//! ̖
-			CodeAxisDiscarded = 0x7403,					//! ̔j{ς
-			CodeAxisInitialize = 0x7410,				//! ̏Ɏs
-			CodeAxisDestroy = 0x7420,					//! ̔jɎs
-			CodeAxisConnect = 0x7430,					//! ̐ڑɎs
-			CodeAxisDisconnect = 0x7440,				//! ̐ؒfɎs
-			CodeAxisRead = 0x7450,						//! ̏ԊmFɎs
-			CodeAxisWrite = 0x7460,						//! ̐Ɏs
+#pragma region 軸(0x7400～0x74FF)
+			CodeAxisInitialized = 0x7401,				//! 軸の初期化が実施済み
+			CodeAxisUninitialized = 0x7402,				//! 軸の未初期化
+			CodeAxisDiscarded = 0x7403,					//! 軸の破棄が実施済み
+			CodeAxisInitialize = 0x7410,				//! 軸の初期化に失敗
+			CodeAxisDestroy = 0x7420,					//! 軸の破棄に失敗
+			CodeAxisConnect = 0x7430,					//! 軸の接続に失敗
+			CodeAxisDisconnect = 0x7440,				//! 軸の切断に失敗
+			CodeAxisRead = 0x7450,						//! 軸の状態確認に失敗
+			CodeAxisWrite = 0x7460,						//! 軸の制御に失敗
 #pragma endregion
-#pragma region Plc(0x7500`0x75FF)
-			CodePlcInitialized = 0x7501,				//! PLC̏{ς
-			CodePlcUninitialized = 0x7502,				//! PLC̖
-			CodePlcDiscarded = 0x7503,					//! PLC̔j{ς
-			CodePlcInitialize = 0x7510,					//! PLC̏Ɏs
-			CodePlcDestroy = 0x7520,					//! PLC̔jɎs
-			CodePlcConnect = 0x7530,					//! PLC̐ڑɎs
-			CodePlcDisconnect = 0x7540,					//! PLC̐ؒfɎs
-			CodePlcRead = 0x7550,						//! PLC̏ԊmFɎs
-			CodePlcWrite = 0x7560,						//! PLC̐Ɏs
+#pragma region Plc(0x7500～0x75FF)
+			CodePlcInitialized = 0x7501,				//! PLCの初期化が実施済み
+			CodePlcUninitialized = 0x7502,				//! PLCの未初期化
+			CodePlcDiscarded = 0x7503,					//! PLCの破棄が実施済み
+			CodePlcInitialize = 0x7510,					//! PLCの初期化に失敗
+			CodePlcDestroy = 0x7520,					//! PLCの破棄に失敗
+			CodePlcConnect = 0x7530,					//! PLCの接続に失敗
+			CodePlcDisconnect = 0x7540,					//! PLCの切断に失敗
+			CodePlcRead = 0x7550,						//! PLCの状態確認に失敗
+			CodePlcWrite = 0x7560,						//! PLCの制御に失敗
 #pragma endregion
-#pragma region 摜(0x9000`0x901F)
-			CodeImageUpdateDepth = 0x9000,				//! 摜̍XVɎs(rbg[xُ)
-			CodeImageUpdateHeight = 0x9001,				//! 摜̍XVɎs(ُ)
-			CodeImageUpdateWidth = 0x9002,				//! 摜̍XVɎs(ُ)
-			CodeImageUpdateMat = 0x9003,				//! 摜̍XVɎs(Mat)
-			CodeImageConvertEmpty = 0x9004,				//! 摜̕ϊɎs(摜f[^)
+#pragma region 推論(0x7600～0x76FF)
+			CodeOnnxUnloaded = 0x7602,					//! 推論のモデル未読み込み
+			CodeOnnxLoad = 0x7610,						//! 推論のモデル読み込みに失敗
+			CodeOnnxLoadNotFormat = 0x7611,				//! 推論のモデルの入出力が未対応
+			CodeOnnxSearch = 0x7620,					//! 推論に失敗
+			CodeOnnxSearchImage = 0x7621,				//! 推論の画像が異常
 #pragma endregion
-#pragma region Udp(0x9020`0x902F)
-			CodeUdpConnect = 0x9020,					//! Udp̐ڑɎs
-			CodeUdpWrite = 0x9021,						//! Udp̑MɎs
+#pragma region 画像(0x9000～0x901F)
+			CodeImageUpdateDepth = 0x9000,				//! 画像の更新に失敗(ビット深度が異常)
+			CodeImageUpdateHeight = 0x9001,				//! 画像の更新に失敗(高さが異常)
+			CodeImageUpdateWidth = 0x9002,				//! 画像の更新に失敗(幅が異常)
+			CodeImageUpdateMat = 0x9003,				//! 画像の更新に失敗(Matが空)
+			CodeImageConvertEmpty = 0x9004,				//! 画像の変換に失敗(画像データが空)
 #pragma endregion
-			CodeUnknown = 0x9999						//! sȃG[
+#pragma region Udp(0x9020～0x902F)
+			CodeUdpConnect = 0x9020,					//! Udpの接続に失敗
+			CodeUdpWrite = 0x9021,						//! Udpの送信に失敗
+#pragma endregion
+			CodeUnknown = 0x9999						//! 不明なエラー
 		};
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @enum			@̗OR[h
+		/// @enum			機器の例外コード
 		////////////////////////////////////////////////////////////////////////////////
 		enum EnumDeviceCode
 		{
-			DeviceCodeSuccess = 0,			//! 
+			DeviceCodeSuccess = 0,			//! 正常
 		};
 	}
 }
\ No newline at end of file
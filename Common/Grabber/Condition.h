@@ -8,13 +8,13 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CRangeDouble
-			/// @brief      l͈̔͂ێNX
+			/// @brief      実数値の範囲を保持するクラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CRangeDouble
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CRangeDouble()
 				{
@@ -24,19 +24,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CRangeDouble& operator = (const CRangeDouble& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CRangeDouble()
 				{
@@ -45,8 +45,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CRangeDouble& object)
 				{
@@ -56,25 +56,25 @@ namespace Standard
 				}
 
 			public:
-				//! ŏl
+				//! 最小値
 				double Minimum;
 
-				//! ől
+				//! 最大値
 				double Maximum;
 
-				//! CNg
+				//! インクリメント
 				double Increment;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CCapture
-			/// @brief      B̏ێNX
+			/// @brief      撮像の条件を保持するクラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CCapture
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CCapture()
 				{
@@ -87,19 +87,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CCapture& operator = (const CCapture& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CCapture()
 				{
@@ -108,8 +108,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CCapture& object)
 				{
@@ -121,19 +121,19 @@ namespace Standard
 				}
 
 			public:
-				//! 摜̍ő啝
+				//! 画像の最大幅
 				int WidthMaximum;
 
-				//! 摜̍ő卂
+				//! 画像の最大高さ
 				int HeightMaximum;
 
-				//! AiOQC͈̔
+				//! アナログゲインの範囲
 				CRangeDouble AnalogGain;
 
-				//! fW^QC͈̔
+				//! デジタルゲインの範囲
 				CRangeDouble DigitalGain;
 
-				//! IԂ͈̔
+				//! 露光時間の範囲
 				CRangeDouble ExposureTime;
 			};
 		}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "Common/Image/Basis.h"
+
+namespace Standard
+{
+	namespace Grabber
+	{
+		// 画像
+		namespace Frame
+		{
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			ホストの時刻を取得 ※インライン関数
+			/// @detail			単調増加する時計の時刻で、IOの入力など他の時刻との比較に使用する
+			/// @return			ホストの時刻[us]
+			////////////////////////////////////////////////////////////////////////////////
+			inline int64_t Now()
+			{
+				int64_t ret = 0;
+
+				ret = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CInformation
+			/// @brief      画像の付帯情報を保持するクラス
+			////////////////////////////////////////////////////////////////////////////////
+			class CInformation
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CInformation()
+				{
+					FrameId = 0;
+					DeviceTimestamp = 0;
+					HostTimestamp = 0;
+					Lost = 0;
+					Trigger = false;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				CInformation& operator = (const CInformation& object) noexcept
+				{
+					// 更新
+					Update(object);
+
+					return *this;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				~CInformation()
+				{
+
+				}
+
+			protected:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				void Update(const CInformation& object)
+				{
+					this->FrameId = object.FrameId;
+					this->DeviceTimestamp = object.DeviceTimestamp;
+					this->HostTimestamp = object.HostTimestamp;
+					this->Lost = object.Lost;
+					this->Trigger = object.Trigger;
+				}
+
+			public:
+				//! カメラの画像の番号
+				uint64_t FrameId;
+
+				//! カメラのタイムスタンプ ※単位はカメラに依存
+				uint64_t DeviceTimestamp;
+
+				//! ホストで受け取った時刻[us] ※Now()と同じ時計
+				int64_t HostTimestamp;
+
+				//! 受け取れなかった画像の累計
+				uint64_t Lost;
+
+				//! トリガで取り込んだ画像か
+				bool Trigger;
+			};
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CObject
+			/// @brief      画像と付帯情報を保持するクラス
+			////////////////////////////////////////////////////////////////////////////////
+			class CObject
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CObject()
+				{
+
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				CObject& operator = (const CObject& object) noexcept
+				{
+					// 更新
+					Update(object);
+
+					return *this;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				~CObject()
+				{
+
+				}
+
+			protected:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				void Update(const CObject& object)
+				{
+					this->Value = object.Value;
+					this->Information = object.Information;
+				}
+
+			public:
+				//! 画像 ※画像のデータはコピーせずに共有
+				Image::CObject Value;
+
+				//! 付帯情報
+				CInformation Information;
+			};
+		}
+	}
+}
\ No newline at end of file
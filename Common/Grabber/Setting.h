@@ -1,47 +1,53 @@
 #pragma once
 
+#include "Common/Image/Format.h"
 #include "Common/Variant/Basis.h"
 
 namespace Standard
 {
 	namespace Grabber
 	{
-		// ݒ
+		// 設定
 		namespace Setting
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CDefault
-			/// @brief      J̃ftHgȐݒNX
+			/// @brief      カメラのデフォルトな設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CDefault
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CDefault()
 				{
 					ImageWidth = 640;
 					ImageHeight = 480;
-					HeartbeatTimeout = 3000000;		// 3b
-					CaptureTimeout = 1000;			// 1b
+					HeartbeatTimeout = 3000000;		// 3秒
+					CaptureTimeout = 1000;			// 1秒
 					CaptureRetry = 3;
+					Streaming = false;
+					StreamingBuffer = 8;
+					Trigger = false;
+					TriggerSource = "Software";
+					OutputFormat = Image::Format::OutputAuto;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CDefault& operator = (const CDefault& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CDefault()
 				{
@@ -50,8 +56,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CDefault& object)
 				{
@@ -60,38 +66,58 @@ namespace Standard
 					this->HeartbeatTimeout = object.HeartbeatTimeout;
 					this->CaptureTimeout = object.CaptureTimeout;
 					this->CaptureRetry = object.CaptureRetry;
+					this->Streaming = object.Streaming;
+					this->StreamingBuffer = object.StreamingBuffer;
+					this->Trigger = object.Trigger;
+					this->TriggerSource = object.TriggerSource;
+					this->OutputFormat = object.OutputFormat;
 					this->Other = object.Other;
 				}
 
 			public:
-				//! 摜̕
+				//! 画像の幅
 				int ImageWidth;
 
-				//! 摜̍
+				//! 画像の高さ
 				int ImageHeight;
 
-				//! HeartbeatTimeout^CAEg[us]
+				//! HeartbeatTimeoutタイムアウト[us]
 				double HeartbeatTimeout;
 
-				//! 荞݂̃^CAEg[ms]
+				//! 取り込みのタイムアウト[ms]
 				double CaptureTimeout;
 
-				//! 荞݂̃gC
+				//! 取り込みのリトライ回数
 				int CaptureRetry;
 
-				//! ̑
+				//! 連続取り込み(true:連続取り込み / false:1枚ずつ取り込み)
+				bool Streaming;
+
+				//! 連続取り込みで保持する画像の数
+				int StreamingBuffer;
+
+				//! トリガ(true:トリガで取り込み / false:フリーラン)
+				bool Trigger;
+
+				//! トリガの入力元(Software、Line0など)
+				std::string TriggerSource;
+
+				//! 出力の画素フォーマット(自動:モノクロはMono8、カラーはBgr8)
+				Image::Format::EnumOutput OutputFormat;
+
+				//! その他
 				Variant::CManager Other;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CConnect
-			/// @brief      JɐڑݒNX
+			/// @brief      カメラに接続する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CConnect
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CConnect()
 				{
@@ -99,19 +125,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CConnect& operator = (const CConnect& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CConnect()
 				{
@@ -120,8 +146,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CConnect& object)
 				{
@@ -130,12 +156,93 @@ namespace Standard
 				}
 
 			public:
-				//! J̎ʎq
+				//! カメラの識別子
 				std::string Identifier;
 
-				//! ̑
+				//! その他
 				Variant::CManager Other;
 			};
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CParameter
+			/// @brief      カメラのパラメータを一括で書き込む設定クラス
+			/// @detail		負の値の項目は書き込まない
+			////////////////////////////////////////////////////////////////////////////////
+			class CParameter
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CParameter()
+				{
+					AnalogGain = -1;
+					DigitalGain = -1;
+					ExposureTime = -1;
+					OffsetX = -1;
+					OffsetY = -1;
+					Width = -1;
+					Height = -1;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				CParameter& operator = (const CParameter& object) noexcept
+				{
+					// 更新
+					Update(object);
+
+					return *this;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				~CParameter()
+				{
+
+				}
+
+			protected:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				void Update(const CParameter& object)
+				{
+					this->AnalogGain = object.AnalogGain;
+					this->DigitalGain = object.DigitalGain;
+					this->ExposureTime = object.ExposureTime;
+					this->OffsetX = object.OffsetX;
+					this->OffsetY = object.OffsetY;
+					this->Width = object.Width;
+					this->Height = object.Height;
+				}
+
+			public:
+				//! アナログゲイン値
+				double AnalogGain;
+
+				//! デジタルゲイン値
+				double DigitalGain;
+
+				//! 露光時間
+				double ExposureTime;
+
+				//! 画像のオフセットX
+				int OffsetX;
+
+				//! 画像のオフセットY
+				int OffsetY;
+
+				//! 画像の幅 ※取り込みを停止中のみ変更可能
+				int Width;
+
+				//! 画像の高さ ※取り込みを停止中のみ変更可能
+				int Height;
+			};
 		}
 	}
 }
\ No newline at end of file
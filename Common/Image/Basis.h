@@ -3,16 +3,18 @@
 #include "opencv2/opencv.hpp"
 
 #include "Common/Exception/Basis.h"
+#include "Common/Image/Pool.h"
+#include "Common/Singleton/Worker.h"
 
 namespace Standard
 {
 	namespace Image
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			1C̃ACgTCY(4oCg)擾 CC֐
-		/// @param[in]		depth	rbg[x
-		/// @param[in]		width	摜̕
-		/// @return         1C̃ACgTCY(4oCg)
+		/// @brief			1ラインのアライメントサイズ(4バイト)を取得 ※インライン関数
+		/// @param[in]		depth	ビット深度
+		/// @param[in]		width	画像の幅
+		/// @return         1ラインのアライメントサイズ(4バイト)
 		////////////////////////////////////////////////////////////////////////////////
 		inline int Stride(int depth, int width)
 		{
@@ -24,11 +26,11 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			摜̃TCY擾 CC֐
-		/// @param[in]		depth	rbg[x
-		/// @param[in]		height	摜̍
-		/// @param[in]		width	摜̕
-		/// @return			摜̃TCY
+		/// @brief			画像のサイズを取得 ※インライン関数
+		/// @param[in]		depth	ビット深度
+		/// @param[in]		height	画像の高さ
+		/// @param[in]		width	画像の幅
+		/// @return			画像のサイズ
 		////////////////////////////////////////////////////////////////////////////////
 		inline int Size(int depth, int height, int width)
 		{
@@ -39,154 +41,253 @@ namespace Standard
 			return ret;
 		}
 
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CAllocator
+		/// @brief      画像のデータの参照をOpenCVのMatクラスに持たせるアロケータのクラス
+		///				⇒ シングルトン化するテンプレートのクラスから継承
+		///	@detail		Matクラス(とコピー)が破棄されるまで画像のデータをプールへ戻さない
+		///				Matクラスで新たに確保する場合は標準のアロケータに任せる
+		////////////////////////////////////////////////////////////////////////////////
+		class CAllocator
+			: public cv::MatAllocator
+			, virtual public Singleton::Worker::CTemplate<CAllocator>
+		{
+		public:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			コンストラクタ
+			////////////////////////////////////////////////////////////////////////////////
+			CAllocator()
+			{
+
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			デストラクタ
+			////////////////////////////////////////////////////////////////////////////////
+			virtual ~CAllocator()
+			{
+
+			}
+
+		public:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			画像のデータを参照するMatクラスを構築
+			/// @detail			画像のデータの参照をMatクラスの参照カウントに持たせる(コピーなし)
+			/// @param[in]		value	画像のデータ
+			/// @param[in]		height	画像の高さ
+			/// @param[in]		width	画像の幅
+			/// @param[in]		type	Matクラスの型
+			/// @param[in]		stride	1ラインのサイズ
+			/// @return			Matクラス
+			////////////////////////////////////////////////////////////////////////////////
+			cv::Mat Wrap(const std::shared_ptr<CBuffer>& value, int height, int width, int type, size_t stride) const
+			{
+				cv::Mat ret(height, width, type, value->data(), stride);
+
+				// 画像のデータの参照を保持 ⇒ Matクラスの参照がなくなればdeallocate()で解放
+				std::unique_ptr<cv::UMatData> data(new cv::UMatData(this));
+
+				data->data = value->data();
+				data->origdata = value->data();
+				data->size = stride * height;
+				data->userdata = new std::shared_ptr<CBuffer>(value);
+				data->refcount = 1;
+
+				ret.allocator = this;
+				ret.u = data.release();
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			Matクラスのデータを確保
+			/// @detail			標準のアロケータに任せる
+			////////////////////////////////////////////////////////////////////////////////
+			cv::UMatData* allocate(int dims, const int* sizes, int type, void* data, size_t* step, cv::AccessFlag flags, cv::UMatUsageFlags usageFlags) const override
+			{
+				return cv::Mat::getStdAllocator()->allocate(dims, sizes, type, data, step, flags, usageFlags);
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			Matクラスのデータを確保
+			/// @detail			標準のアロケータに任せる
+			////////////////////////////////////////////////////////////////////////////////
+			bool allocate(cv::UMatData* data, cv::AccessFlag flags, cv::UMatUsageFlags usageFlags) const override
+			{
+				return cv::Mat::getStdAllocator()->allocate(data, flags, usageFlags);
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			Matクラスのデータを解放
+			/// @detail			Wrap()で保持した画像のデータの参照を解放する ⇒ 他に参照がなければプールへ戻る
+			/// @param[in]		data	Matクラスのデータ
+			////////////////////////////////////////////////////////////////////////////////
+			void deallocate(cv::UMatData* data) const override
+			{
+				if (data != nullptr)
+				{
+					delete (std::shared_ptr<CBuffer>*)data->userdata;
+					data->userdata = nullptr;
+
+					delete data;
+				}
+			}
+		};
+
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CObject
-		/// @brief      摜̏ێNX
-		/// @detail		tH[}bg֕ϊȂǂs
+		/// @brief      画像の情報を保持するクラス
+		/// @detail		他フォーマットへ変換なども行う
+		///				画像のデータはプールから取得してコピーしたクラス間で共有する
 		////////////////////////////////////////////////////////////////////////////////
 		class CObject
 		{
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CObject()
 			{
 				m_depth = 0;
 				m_height = 0;
 				m_width = 0;
-				m_value = nullptr;
+				m_value.reset();
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
-			/// @param[in]		depth	rbg[x
-			/// @param[in]		height	摜̍
-			/// @param[in]		width	摜̕
-			/// @param[in]		value	摜̃f[^
+			/// @brief			コンストラクタ
+			/// @param[in]		depth	ビット深度
+			/// @param[in]		height	画像の高さ
+			/// @param[in]		width	画像の幅
+			/// @param[in]		value	画像のデータ
 			////////////////////////////////////////////////////////////////////////////////
 			CObject(int depth, int height, int width, const unsigned char* value) : CObject()
 			{
-				// XV
+				// 更新
 				Update(depth, height, width, value);
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			Rs[RXgN^
-			/// @param[in]		object	NX
+			/// @brief			コピーコンストラクタ
+			/// @param[in]		object	自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			CObject(const CObject& object) : CObject()
 			{
-				// XV
-				Update(object.m_depth, object.m_height, object.m_width, object.m_value);
+				// 共有
+				Share(object);
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			Rs[Zq
-			/// @return			NX
+			/// @brief			コピー代入演算子
+			/// @return			自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			CObject& operator = (const CObject& object) noexcept
 			{
-				// XV
-				Update(object);
+				// 共有
+				Share(object);
 
 				return *this;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			~CObject()
 			{
-				// NA
+				// クリア
 				Clear();
 			}
 
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			ϐ
+			/// @brief			変数を初期化
 			////////////////////////////////////////////////////////////////////////////////
 			void Clear()
 			{
 				m_depth = 0;
 				m_height = 0;
 				m_width = 0;
-				if (m_value != nullptr)
-				{
-					delete[] m_value;
-				}
-				m_value = nullptr;
+				m_value.reset();
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			NXXV
-			/// @detail			ϐXVĉ摜̃f[^\z
-			/// @param[in]		depth	rbg[x
-			/// @param[in]		height	摜̍
-			/// @param[in]		width	摜̕
-			/// @param[in]		value	摜̃f[^
+			/// @brief			画像のデータを確保
+			/// @detail			変数を更新してプールから画像のデータを取得する
+			///					1ラインはStride()でアライメントされる
+			///					画像のデータを直接書き込む場合に使用する
+			/// @param[in]		depth	ビット深度
+			/// @param[in]		height	画像の高さ
+			/// @param[in]		width	画像の幅
+			/// @return			書き込み先の画像のデータ
 			////////////////////////////////////////////////////////////////////////////////
-			void Update(int depth, int height, int width, const unsigned char* value)
+			unsigned char* Reserve(int depth, int height, int width)
 			{
+				unsigned char* ret = nullptr;
+
 				do
 				{
 					std::stringstream message;
 
-					// rbg[xmF
+					// ビット深度を確認
 					if (depth <= 0 || depth % 8)
 					{
-						// rbg[xُ
-						message << "rbg[xُ:" << depth;
+						// ビット深度が異常
+						message << "ビット深度が異常:" << depth;
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(Exception::CodeImageUpdateDepth, message.str());
 					}
 
-					// mF
+					// 高さを確認
 					if (height <= 0)
 					{
-						// ُ
-						message << "ُ:" << height;
+						// 高さが異常
+						message << "高さが異常:" << height;
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(Exception::CodeImageUpdateHeight, message.str());
 					}
 
-					// mF
+					// 幅を確認
 					if (width <= 0)
 					{
-						// ُ
-						message << "ُ:" << width;
+						// 幅が異常
+						message << "幅が異常:" << width;
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(Exception::CodeImageUpdateWidth, message.str());
 					}
 
-					int size;
+					// 画像のデータを取得
+					Prepare(depth, height, width);
 
-					size = Size(depth, height, width);
+					ret = m_value->data();
+				} while (false);
 
-					// f[^Ȃ or TCYقȂĂ邩mF
-					if (m_value == nullptr || ((m_value != nullptr) && size != Size(m_depth, m_height, m_width)))
-					{
-						if (m_value != nullptr)
-						{
-							delete[] m_value;
-						}
-						m_value = new unsigned char[size];
-					}
+				return ret;
+			}
 
-					this->m_depth = depth;
-					this->m_height = height;
-					this->m_width = width;
-					::memcpy(this->m_value, value, sizeof(unsigned char) * size);
-				} while (false);
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			自クラスを更新
+			/// @detail			変数を更新して画像のデータを構築する
+			///					画像のデータはプールから取得してコピーする
+			/// @param[in]		depth	ビット深度
+			/// @param[in]		height	画像の高さ
+			/// @param[in]		width	画像の幅
+			/// @param[in]		value	画像のデータ ※1ラインはStride()でアライメント済み
+			////////////////////////////////////////////////////////////////////////////////
+			void Update(int depth, int height, int width, const unsigned char* value)
+			{
+				// 画像のデータを確保
+				unsigned char* buffer = Reserve(depth, height, width);
+
+				::memcpy(buffer, value, sizeof(unsigned char) * Size(depth, height, width));
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			NXXV
-			/// @detail			OpenCVMatNX摜̃f[^\z
-			/// @param[in]		object	MatNX
+			/// @brief			自クラスを更新
+			/// @detail			OpenCVのMatクラスから画像のデータを構築する
+			/// @param[in]		object	Matクラス
 			////////////////////////////////////////////////////////////////////////////////
 			void Update(const cv::Mat& object)
 			{
@@ -196,27 +297,46 @@ namespace Standard
 
 					if (object.empty())
 					{
-						// MatNX
-						message << "MatNX";
+						// Matクラスが空
+						message << "Matクラスが空";
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(Exception::CodeImageUpdateMat, message.str());
 					}
 
 					cv::Size size = object.size();
 					int depth = 8 * object.channels();
 
-					// XV
-					Update(depth, size.height, size.width, object.data);
+					// 連続したメモリでアライメントが一致 ⇒ まとめて更新
+					if (object.isContinuous() && (int)object.step == Stride(depth, size.width))
+					{
+						// 更新
+						Update(depth, size.height, size.width, object.data);
+						break;
+					}
+
+					// 画像のデータを確保
+					unsigned char* buffer = Reserve(depth, size.height, size.width);
+
+					int stride = Stride(depth, size.width);
+					int length = (depth / 8) * size.width;
+
+					// 1ラインずつコピー
+					for (int row = 0; row < size.height; row++)
+					{
+						::memcpy(buffer + stride * row, object.ptr(row), sizeof(unsigned char) * length);
+					}
 				} while (false);
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			OpenCVMatNX擾
-			/// @detail			NX̉摜f[^OpenCVMatNX\zĕԂ
-			/// @return			OpenCVCMatNX
+			/// @brief			OpenCVのMatクラスを取得
+			/// @detail			自クラスの画像データを参照するOpenCVのMatクラスを返す(コピーなし)
+			///					Matクラスも画像のデータの参照を保持するため、自クラスより長く使用できる
+			///					※書き換えると共有するクラスにも反映されるため、必要な場合はclone()する
+			/// @return			OpenCVCのMatクラス
 			////////////////////////////////////////////////////////////////////////////////
-			// ϊ
+			// 変換
 			cv::Mat Convert() const
 			{
 				cv::Mat ret;
@@ -225,27 +345,26 @@ namespace Standard
 				{
 					std::stringstream message;
 
-					// f[^mF
+					// データを確認
 					if (m_value == nullptr)
 					{
-						// 摜f[^
-						message << "摜f[^";
+						// 画像データが空
+						message << "画像データが空";
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(Exception::CodeImageConvertEmpty, message.str());
 					}
 
-					ret.create(m_height, m_width, CV_MAKETYPE(m_depth, (m_depth / 8)));
-
-					::memcpy(ret.data, m_value, sizeof(unsigned char) * Size(m_depth, m_height, m_width));
+					// 画像のデータの参照をMatクラスに持たせる ⇒ Matクラスの使用中はプールで使い回さない
+					ret = CAllocator::Instance().Wrap(m_value, m_height, m_width, CV_MAKETYPE(m_depth, (m_depth / 8)), Stride(m_depth, m_width));
 				} while (false);
 
 				return ret;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			摜t@Cǂݍ
-			/// @param[in]		path	t@CpX
+			/// @brief			画像ファイルを読み込む
+			/// @param[in]		path	ファイルパス
 			////////////////////////////////////////////////////////////////////////////////
 			//void Load(const std::string& path)
 			//{
@@ -259,44 +378,103 @@ namespace Standard
 
 			//		if (object.empty())
 			//		{
-			//			// MatNX
-			//			message << "MatNX";
+			//			// Matクラスが空
+			//			message << "Matクラスが空";
 
-			//			// O𔭖C
+			//			// 例外を発砲
 			//			throw Exception::CObject(0x9012, Exception::ConstSuccess, message.str());
 			//		}
 
 			//		cv::Size size = object.size();
 			//		int depth = 8 * object.channels();
 
-			//		// XV
+			//		// 更新
 			//		Update(depth, size.height, size.width, object.data);
 			//	} while (false);
 			//}
 
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			ビット深度を取得
+			/// @return			ビット深度
+			////////////////////////////////////////////////////////////////////////////////
+			int GetDepth() const
+			{
+				return m_depth;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			画像の高さを取得
+			/// @return			画像の高さ
+			////////////////////////////////////////////////////////////////////////////////
+			int GetHeight() const
+			{
+				return m_height;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			画像の幅を取得
+			/// @return			画像の幅
+			////////////////////////////////////////////////////////////////////////////////
+			int GetWidth() const
+			{
+				return m_width;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			画像のデータを取得
+			/// @return			画像のデータ(空の場合はnullptr)
+			////////////////////////////////////////////////////////////////////////////////
+			const unsigned char* GetValue() const
+			{
+				return (m_value != nullptr) ? m_value->data() : nullptr;
+			}
+
 		protected:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			NXXV
-			/// @param[in]		object	NX
+			/// @brief			自クラスを共有
+			/// @detail			画像のデータはコピーせずに参照を共有する
+			/// @param[in]		object	自クラス
+			////////////////////////////////////////////////////////////////////////////////
+			void Share(const CObject& object)
+			{
+				if (this != &object)
+				{
+					m_depth = object.m_depth;
+					m_height = object.m_height;
+					m_width = object.m_width;
+					m_value = object.m_value;
+				}
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			画像のデータを準備
+			/// @detail			共有している他のクラスに影響しないように、常にプールから取得し直す
+			/// @param[in]		depth	ビット深度
+			/// @param[in]		height	画像の高さ
+			/// @param[in]		width	画像の幅
 			////////////////////////////////////////////////////////////////////////////////
-			void Update(const CObject& object)
+			void Prepare(int depth, int height, int width)
 			{
-				// XV
-				Update(object.m_depth, object.m_height, object.m_width, object.m_value);
+				// プールから取得 ⇒ 保持していた画像のデータは参照がなくなればプールへ戻る
+				m_value = CPool::Instance().Take(depth, height, width, Size(depth, height, width));
+
+				this->m_depth = depth;
+				this->m_height = height;
+				this->m_width = width;
 			}
 
 		private:
-			//! 摜̃rbg[
+			//! 画像のビット深さ
 			int m_depth;
 
-			//! 摜̍
+			//! 画像の高さ
 			int m_height;
 
-			//! 摜̕
+			//! 画像の幅
 			int m_width;
 
-			//! 摜̃f[^
-			unsigned char* m_value;
+			//! 画像のデータ(プールから取得して共有)
+			std::shared_ptr<CBuffer> m_value;
 		};
 	}
 }
\ No newline at end of file
@@ -0,0 +1,481 @@
+#pragma once
+
+#include <intrin.h>
+#include <cstdint>
+
+#include "opencv2/opencv.hpp"
+
+#include "Common/Image/Basis.h"
+
+namespace Standard
+{
+	namespace Image
+	{
+		// 画素フォーマットの変換
+		namespace Format
+		{
+			//! 入力の画素フォーマット
+			enum EnumPixel
+			{
+				PixelUnknown,			//!< 不明
+				PixelMono8,				//!< モノクロ8ビット
+				PixelMono10p,			//!< モノクロ10ビット(パック)
+				PixelMono12p,			//!< モノクロ12ビット(パック)
+				PixelBayerRG8,			//!< ベイヤーRG8ビット
+				PixelBayerGR8,			//!< ベイヤーGR8ビット
+				PixelBayerBG8,			//!< ベイヤーBG8ビット
+				PixelBayerGB8,			//!< ベイヤーGB8ビット
+				PixelRgb8,				//!< カラーRGB8ビット
+				PixelBgr8,				//!< カラーBGR8ビット
+			};
+
+			//! 出力の画素フォーマット
+			enum EnumOutput
+			{
+				OutputAuto,				//!< 自動(モノクロ ⇒ Mono8 / カラー ⇒ Bgr8)
+				OutputMono8,			//!< モノクロ8ビット
+				OutputBgr8,				//!< カラーBGR8ビット
+			};
+
+			//! 使用できるSIMD命令
+			enum EnumSimd
+			{
+				SimdNone,				//!< なし ⇒ スカラー
+				SimdSsse3,				//!< SSSE3
+				SimdAvx2,				//!< AVX2
+			};
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			CPUが対応するSIMD命令を判定 ※インライン関数
+			/// @return			使用できるSIMD命令
+			////////////////////////////////////////////////////////////////////////////////
+			inline EnumSimd DetectSimd()
+			{
+				EnumSimd ret = SimdNone;
+
+				do
+				{
+					int info[4] = { 0 };
+
+					__cpuid(info, 0);
+					int count = info[0];
+
+					if (count < 1)
+					{
+						break;
+					}
+
+					__cpuid(info, 1);
+
+					// SSSE3を確認
+					if ((info[2] & (1 << 9)) == 0)
+					{
+						break;
+					}
+
+					ret = SimdSsse3;
+
+					// OSXSAVE、AVXを確認
+					if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 || count < 7)
+					{
+						break;
+					}
+
+					// OSがYMMレジスタを退避するか確認
+					if ((_xgetbv(0) & 0x6) != 0x6)
+					{
+						break;
+					}
+
+					__cpuidex(info, 7, 0);
+
+					// AVX2を確認
+					if ((info[1] & (1 << 5)) == 0)
+					{
+						break;
+					}
+
+					ret = SimdAvx2;
+				} while (false);
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			使用するSIMD命令を取得 ※インライン関数
+			/// @detail			初回だけ判定してキャッシュする
+			/// @return			使用するSIMD命令
+			////////////////////////////////////////////////////////////////////////////////
+			inline EnumSimd GetSimd()
+			{
+				static const EnumSimd simd = DetectSimd();
+
+				return simd;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			パックされた画素を8ビットに展開 ※インライン関数
+			/// @detail			スカラーの処理で、SIMD命令の端数と検証の基準に使用する
+			///					GenICamのパック(LSBファースト)から上位8ビットを取り出す
+			/// @param[in]		src		パックされた画素
+			/// @param[in]		bit		先頭の画素のビット位置
+			/// @param[out]		dst		8ビットの画素
+			/// @param[in]		count	画素の数
+			/// @param[in]		bits	1画素のビット数(10 or 12)
+			////////////////////////////////////////////////////////////////////////////////
+			inline void UnpackScalar(const unsigned char* src, int64_t bit, unsigned char* dst, int count, int bits)
+			{
+				// 画素の数だけ走査
+				for (int index = 0; index < count; index++, bit += bits)
+				{
+					int64_t offset = bit >> 3;
+					int shift = (int)(bit & 7);
+
+					// 1画素は必ず2バイトに収まる(シフト + ビット数 <= 16)
+					unsigned int word = (unsigned int)src[offset] | ((unsigned int)src[offset + 1] << 8);
+
+					dst[index] = (unsigned char)((word >> (shift + bits - 8)) & 0xFF);
+				}
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			8画素分の並び替えと乗数を取得 ※インライン関数
+			/// @detail			並び替えで画素を含む2バイトを16ビットに揃え、
+			///					乗数の上位16ビットで右シフトを代用する
+			/// @param[in]		bits		1画素のビット数(10 or 12)
+			/// @param[out]		shuffle		並び替え
+			/// @param[out]		multiplier	乗数
+			////////////////////////////////////////////////////////////////////////////////
+			inline void UnpackTable(int bits, __m128i& shuffle, __m128i& multiplier)
+			{
+				if (bits == 10)
+				{
+					// 5バイトに4画素 ⇒ 右シフトは2、4、6、8
+					shuffle = _mm_setr_epi8(0, 1, 1, 2, 2, 3, 3, 4, 5, 6, 6, 7, 7, 8, 8, 9);
+					multiplier = _mm_setr_epi16(1 << 14, 1 << 12, 1 << 10, 1 << 8, 1 << 14, 1 << 12, 1 << 10, 1 << 8);
+				}
+				else
+				{
+					// 3バイトに2画素 ⇒ 右シフトは4、8
+					shuffle = _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+					multiplier = _mm_setr_epi16(1 << 12, 1 << 8, 1 << 12, 1 << 8, 1 << 12, 1 << 8, 1 << 12, 1 << 8);
+				}
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			パックされた画素を8ビットに展開(SSSE3) ※インライン関数
+			/// @detail			16画素ずつ処理して、端数はスカラーで処理する
+			/// @param[in]		src		パックされた画素 ※バイト境界から開始
+			/// @param[out]		dst		8ビットの画素
+			/// @param[in]		count	画素の数
+			/// @param[in]		bits	1画素のビット数(10 or 12)
+			/// @return			処理した画素の数
+			////////////////////////////////////////////////////////////////////////////////
+			inline int UnpackSsse3(const unsigned char* src, unsigned char* dst, int count, int bits)
+			{
+				int ret = 0;
+
+				__m128i shuffle;
+				__m128i multiplier;
+				__m128i mask = _mm_set1_epi16(0x00FF);
+
+				UnpackTable(bits, shuffle, multiplier);
+
+				// 8画素のバイト数
+				int chunk = bits;
+				int bytes = (count * bits) >> 3;
+				int offset = 0;
+
+				// 読み込みがバッファを超えない範囲で走査
+				for (; ret + 16 <= count && offset + chunk + 16 <= bytes; ret += 16, offset += chunk * 2)
+				{
+					__m128i low = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + offset)), shuffle);
+					__m128i high = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + offset + chunk)), shuffle);
+
+					low = _mm_and_si128(_mm_mulhi_epu16(low, multiplier), mask);
+					high = _mm_and_si128(_mm_mulhi_epu16(high, multiplier), mask);
+
+					_mm_storeu_si128((__m128i*)(dst + ret), _mm_packus_epi16(low, high));
+				}
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			パックされた画素を8ビットに展開(AVX2) ※インライン関数
+			/// @detail			32画素ずつ処理して、端数は呼び出し元で処理する
+			/// @param[in]		src		パックされた画素 ※バイト境界から開始
+			/// @param[out]		dst		8ビットの画素
+			/// @param[in]		count	画素の数
+			/// @param[in]		bits	1画素のビット数(10 or 12)
+			/// @return			処理した画素の数
+			////////////////////////////////////////////////////////////////////////////////
+			inline int UnpackAvx2(const unsigned char* src, unsigned char* dst, int count, int bits)
+			{
+				int ret = 0;
+
+				__m128i shuffle128;
+				__m128i multiplier128;
+
+				UnpackTable(bits, shuffle128, multiplier128);
+
+				__m256i shuffle = _mm256_broadcastsi128_si256(shuffle128);
+				__m256i multiplier = _mm256_broadcastsi128_si256(multiplier128);
+				__m256i mask = _mm256_set1_epi16(0x00FF);
+
+				// 8画素のバイト数
+				int chunk = bits;
+				int bytes = (count * bits) >> 3;
+				int offset = 0;
+
+				// 読み込みがバッファを超えない範囲で走査
+				for (; ret + 32 <= count && offset + chunk * 3 + 16 <= bytes; ret += 32, offset += chunk * 4)
+				{
+					// レーンごとに8画素(0-7、8-15 / 16-23、24-31)
+					__m256i low = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(src + offset))), _mm_loadu_si128((const __m128i*)(src + offset + chunk)), 1);
+					__m256i high = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(src + offset + chunk * 2))), _mm_loadu_si128((const __m128i*)(src + offset + chunk * 3)), 1);
+
+					low = _mm256_and_si256(_mm256_mulhi_epu16(_mm256_shuffle_epi8(low, shuffle), multiplier), mask);
+					high = _mm256_and_si256(_mm256_mulhi_epu16(_mm256_shuffle_epi8(high, shuffle), multiplier), mask);
+
+					// レーンごとのパックで並んだ(0-7、16-23、8-15、24-31)を並び替え
+					__m256i value = _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), 0xD8);
+
+					_mm256_storeu_si256((__m256i*)(dst + ret), value);
+				}
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			パックされた画素を8ビットに展開 ※インライン関数
+			/// @detail			バイト境界から開始する場合はSIMD命令で処理する
+			/// @param[in]		src		パックされた画素
+			/// @param[in]		bit		先頭の画素のビット位置
+			/// @param[out]		dst		8ビットの画素
+			/// @param[in]		count	画素の数
+			/// @param[in]		bits	1画素のビット数(10 or 12)
+			////////////////////////////////////////////////////////////////////////////////
+			inline void Unpack(const unsigned char* src, int64_t bit, unsigned char* dst, int count, int bits)
+			{
+				int done = 0;
+
+				// バイト境界を確認
+				if ((bit & 7) == 0)
+				{
+					const unsigned char* begin = src + (bit >> 3);
+
+					switch (GetSimd())
+					{
+					case SimdAvx2:
+						done = UnpackAvx2(begin, dst, count, bits);
+						done += UnpackSsse3(begin + (((int64_t)done * bits) >> 3), dst + done, count - done, bits);
+						break;
+
+					case SimdSsse3:
+						done = UnpackSsse3(begin, dst, count, bits);
+						break;
+
+					default:
+						break;
+					}
+				}
+
+				// 端数をスカラーで処理
+				UnpackScalar(src, bit + (int64_t)done * bits, dst + done, count - done, bits);
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			モノクロの画素フォーマットか判定 ※インライン関数
+			/// @param[in]		pixel	入力の画素フォーマット
+			/// @return			判定結果(true:モノクロ / false:カラー)
+			////////////////////////////////////////////////////////////////////////////////
+			inline bool IsMono(EnumPixel pixel)
+			{
+				bool ret = false;
+
+				switch (pixel)
+				{
+				case PixelMono8:
+				case PixelMono10p:
+				case PixelMono12p:
+					ret = true;
+					break;
+
+				default:
+					break;
+				}
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			モノクロの画素を8ビットに変換 ※インライン関数
+			/// @param[in]		pixel	入力の画素フォーマット(モノクロ)
+			/// @param[in]		height	画像の高さ
+			/// @param[in]		width	画像の幅
+			/// @param[in]		src		入力の画素 ※1ラインのパディングなし
+			/// @param[out]		dst		出力の画素
+			/// @param[in]		stride	出力の1ラインのバイト数
+			////////////////////////////////////////////////////////////////////////////////
+			inline void ConvertMono(EnumPixel pixel, int height, int width, const unsigned char* src, unsigned char* dst, int stride)
+			{
+				int bits = 8;
+
+				switch (pixel)
+				{
+				case PixelMono10p:
+					bits = 10;
+					break;
+
+				case PixelMono12p:
+					bits = 12;
+					break;
+
+				default:
+					break;
+				}
+
+				// 1ラインだけ走査
+				for (int row = 0; row < height; row++)
+				{
+					if (bits == 8)
+					{
+						::memcpy(dst + (int64_t)stride * row, src + (int64_t)width * row, sizeof(unsigned char) * width);
+					}
+					else
+					{
+						Unpack(src, (int64_t)width * bits * row, dst + (int64_t)stride * row, width, bits);
+					}
+				}
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			カラーの画素の変換コードを取得 ※インライン関数
+			/// @detail			GenICamのベイヤーはOpenCVと2行目の並びで名称が異なる
+			/// @param[in]		pixel	入力の画素フォーマット(カラー)
+			/// @param[in]		mono	モノクロに変換するか
+			/// @return			OpenCVの変換コード ※-1は未対応
+			////////////////////////////////////////////////////////////////////////////////
+			inline int ColorCode(EnumPixel pixel, bool mono)
+			{
+				int ret = -1;
+
+				switch (pixel)
+				{
+				case PixelBayerRG8:
+					ret = mono ? cv::COLOR_BayerBG2GRAY : cv::COLOR_BayerBG2BGR;
+					break;
+
+				case PixelBayerGR8:
+					ret = mono ? cv::COLOR_BayerGB2GRAY : cv::COLOR_BayerGB2BGR;
+					break;
+
+				case PixelBayerBG8:
+					ret = mono ? cv::COLOR_BayerRG2GRAY : cv::COLOR_BayerRG2BGR;
+					break;
+
+				case PixelBayerGB8:
+					ret = mono ? cv::COLOR_BayerGR2GRAY : cv::COLOR_BayerGR2BGR;
+					break;
+
+				case PixelRgb8:
+					ret = mono ? cv::COLOR_RGB2GRAY : cv::COLOR_RGB2BGR;
+					break;
+
+				case PixelBgr8:
+					ret = mono ? cv::COLOR_BGR2GRAY : -1;
+					break;
+
+				default:
+					break;
+				}
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			画素フォーマットを変換して画像を更新 ※インライン関数
+			/// @detail			画像のデータはプールから取得して直接書き込む
+			///					パックの展開はSIMD命令、ベイヤーとカラーはOpenCVで変換する
+			/// @param[in]		pixel	入力の画素フォーマット
+			/// @param[in]		height	画像の高さ
+			/// @param[in]		width	画像の幅
+			/// @param[in]		src		入力の画素 ※1ラインのパディングなし
+			/// @param[in]		output	出力の画素フォーマット
+			/// @param[out]		image	画像のクラス
+			/// @return			変換結果(true:成功 / false:未対応)
+			////////////////////////////////////////////////////////////////////////////////
+			inline bool Convert(EnumPixel pixel, int height, int width, const unsigned char* src, EnumOutput output, CObject& image)
+			{
+				bool ret = false;
+
+				do
+				{
+					if (pixel == PixelUnknown)
+					{
+						break;
+					}
+
+					bool mono = IsMono(pixel);
+
+					// 出力を確定
+					if (output == OutputAuto)
+					{
+						output = mono ? OutputMono8 : OutputBgr8;
+					}
+
+					if (mono)
+					{
+						if (output == OutputMono8)
+						{
+							// モノクロ ⇒ モノクロ
+							unsigned char* dst = image.Reserve(8, height, width);
+
+							ConvertMono(pixel, height, width, src, dst, Stride(8, width));
+						}
+						else
+						{
+							// モノクロ ⇒ カラー(8ビットに変換してから展開)
+							CObject temporary;
+							unsigned char* gray = temporary.Reserve(8, height, width);
+
+							ConvertMono(pixel, height, width, src, gray, Stride(8, width));
+
+							unsigned char* dst = image.Reserve(24, height, width);
+							cv::Mat input(height, width, CV_8UC1, gray, Stride(8, width));
+							cv::Mat result(height, width, CV_8UC3, dst, Stride(24, width));
+
+							cv::cvtColor(input, result, cv::COLOR_GRAY2BGR);
+						}
+					}
+					else
+					{
+						int channel = (pixel == PixelRgb8 || pixel == PixelBgr8) ? 3 : 1;
+						int depth = (output == OutputMono8) ? 8 : 24;
+						int code = ColorCode(pixel, output == OutputMono8);
+
+						unsigned char* dst = image.Reserve(depth, height, width);
+						cv::Mat input(height, width, CV_MAKETYPE(CV_8U, channel), (void*)src, (size_t)width * channel);
+						cv::Mat result(height, width, CV_MAKETYPE(CV_8U, depth / 8), dst, Stride(depth, width));
+
+						if (code < 0)
+						{
+							// 変換なし ⇒ コピー
+							input.copyTo(result);
+						}
+						else
+						{
+							// 出力先は同じサイズのため再確保されない
+							cv::cvtColor(input, result, code);
+						}
+					}
+
+					ret = true;
+				} while (false);
+
+				return ret;
+			}
+		}
+	}
+}
\ No newline at end of file
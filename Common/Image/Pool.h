@@ -0,0 +1,196 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include "Common/Singleton/Worker.h"
+
+namespace Standard
+{
+	namespace Image
+	{
+		//! 画像のデータ
+		typedef std::vector<unsigned char> CBuffer;
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CPool
+		/// @brief      画像のデータを使い回すプールのクラス
+		///				⇒ シングルトン化するテンプレートのクラスから継承
+		///	@detail		ビット深度、高さ、幅ごとに画像のデータを保持する
+		///				プールだけが参照している画像のデータを未使用として貸し出す
+		////////////////////////////////////////////////////////////////////////////////
+		class CPool
+			: virtual public Singleton::Worker::CTemplate<CPool>
+		{
+		private:
+			//! 画像のデータの種類(ビット深度、高さ、幅)
+			typedef std::tuple<int, int, int> CKey;
+
+		public:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			コンストラクタ
+			////////////////////////////////////////////////////////////////////////////////
+			CPool()
+			{
+				m_capacity = 8;
+				m_allocated.store(0);
+				m_reused.store(0);
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			デストラクタ
+			////////////////////////////////////////////////////////////////////////////////
+			virtual ~CPool()
+			{
+
+			}
+
+		public:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			画像のデータを取得
+			/// @detail			未使用の画像のデータがあれば使い回し、なければ確保する
+			///					参照がなくなるとプールへ戻る
+			/// @param[in]		depth	ビット深度
+			/// @param[in]		height	画像の高さ
+			/// @param[in]		width	画像の幅
+			/// @param[in]		size	画像のサイズ
+			/// @return			画像のデータ
+			////////////////////////////////////////////////////////////////////////////////
+			std::shared_ptr<CBuffer> Take(int depth, int height, int width, int size)
+			{
+				std::shared_ptr<CBuffer> ret;
+
+				do
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncBuffers);
+
+					std::vector<std::shared_ptr<CBuffer>>& buffers = m_buffers[CKey(depth, height, width)];
+
+					// 未使用の画像のデータを検索
+					for (auto& buffer : buffers)
+					{
+						// プールだけが参照 ⇒ 他スレッドからは参照を増やせないため未使用
+						if (buffer.use_count() == 1)
+						{
+							// 参照を解放したスレッドの書き込みを確定
+							std::atomic_thread_fence(std::memory_order_acquire);
+
+							ret = buffer;
+							break;
+						}
+					}
+
+					if (ret != nullptr)
+					{
+						m_reused.fetch_add(1);
+						break;
+					}
+
+					// 画像のデータを確保
+					ret = std::make_shared<CBuffer>(size);
+					m_allocated.fetch_add(1);
+
+					// 上限までプールに保持
+					if (buffers.size() < m_capacity)
+					{
+						buffers.push_back(ret);
+					}
+				} while (false);
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			未使用の画像のデータを解放
+			////////////////////////////////////////////////////////////////////////////////
+			void Clear()
+			{
+				// 排他制御
+				std::lock_guard<std::recursive_mutex> lock(m_asyncBuffers);
+
+				// 種類だけ走査
+				for (auto iterator = m_buffers.begin(); iterator != m_buffers.end();)
+				{
+					std::vector<std::shared_ptr<CBuffer>>& buffers = iterator->second;
+
+					// プールだけが参照している画像のデータを削除
+					buffers.erase(std::remove_if(buffers.begin(), buffers.end(), [](const std::shared_ptr<CBuffer>& buffer) { return buffer.use_count() == 1; }), buffers.end());
+
+					if (buffers.empty())
+					{
+						iterator = m_buffers.erase(iterator);
+					}
+					else
+					{
+						iterator++;
+					}
+				}
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			種類ごとに保持する画像のデータの上限を設定
+			/// @param[in]		capacity	上限
+			////////////////////////////////////////////////////////////////////////////////
+			void SetCapacity(size_t capacity)
+			{
+				// 排他制御
+				std::lock_guard<std::recursive_mutex> lock(m_asyncBuffers);
+
+				m_capacity = capacity;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			種類ごとに保持する画像のデータの上限を取得
+			/// @return			上限
+			////////////////////////////////////////////////////////////////////////////////
+			size_t GetCapacity()
+			{
+				// 排他制御
+				std::lock_guard<std::recursive_mutex> lock(m_asyncBuffers);
+
+				return m_capacity;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			画像のデータを確保した数を取得
+			/// @detail			定常状態で増えなければ確保なしで動作している
+			/// @return			確保した数
+			////////////////////////////////////////////////////////////////////////////////
+			size_t GetAllocated() const
+			{
+				return m_allocated.load();
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			画像のデータを使い回した数を取得
+			/// @return			使い回した数
+			////////////////////////////////////////////////////////////////////////////////
+			size_t GetReused() const
+			{
+				return m_reused.load();
+			}
+
+		private:
+			//! 排他制御(画像のデータ)
+			std::recursive_mutex m_asyncBuffers;
+
+			//! 種類ごとの画像のデータ
+			std::map<CKey, std::vector<std::shared_ptr<CBuffer>>> m_buffers;
+
+			//! 種類ごとに保持する画像のデータの上限
+			size_t m_capacity;
+
+			//! 画像のデータを確保した数
+			std::atomic<size_t> m_allocated;
+
+			//! 画像のデータを使い回した数
+			std::atomic<size_t> m_reused;
+		};
+	}
+}
\ No newline at end of file
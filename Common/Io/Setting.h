@@ -11,13 +11,13 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CAddressRange
-			/// @brief      AhX͈̔̓NX
+			/// @brief      アドレスの範囲クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CAddressRange
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CAddressRange()
 				{
@@ -25,19 +25,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CAddressRange& operator = (const CAddressRange& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CAddressRange()
 				{
@@ -46,8 +46,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CAddressRange& object)
 				{
@@ -56,44 +56,47 @@ namespace Standard
 				}
 
 			public:
-				//! AhX̃NX(擪̃AhX)
+				//! アドレスのクラス(先頭のアドレス)
 				Specify::CAddress Start;
 
-				//! f[^
+				//! データ数
 				int Size;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CDefault
-			/// @brief      IõftHgȐݒNX
+			/// @brief      Ioのデフォルトな設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CDefault
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CDefault()
 				{
 					Timeout = 5000;
 					Cycle = 10;
+					CycleIdle = 0;
+					CycleHold = 1000;
 					Retry = 3;
+					Executor = false;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CDefault& operator = (const CDefault& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CDefault()
 				{
@@ -102,40 +105,57 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CDefault& object)
 				{
 					this->Timeout = object.Timeout;
 					this->Cycle = object.Cycle;
+					this->CycleIdle = object.CycleIdle;
+					this->CycleHold = object.CycleHold;
 					this->Retry = object.Retry;
+					this->Executor = object.Executor;
 					this->Other = object.Other;
 				}
 
 			public:
-				//! ^CAEg[ms]
+				//! タイムアウト[ms]
 				int Timeout;
 
-				//! |[O̎[ms]
+				//! ポーリングの周期[ms]
+				//! ※トリガーの待機中・監視中か値の変化後の周期
 				int Cycle;
 
-				//! gC
+				//! 変化がない間のポーリングの周期の上限[ms]
+				//! ※Cycleから読み込みごとに2倍して延ばす / Cycle以下:Cycleで固定(既定は0 ⇒ 延ばさない)
+				//! ※延ばすと変化がない間の最初の変化の検出が最大でこの周期まで遅れるため、変化の少ない機器だけ設定する
+				//!   例:サンプル(SamplePlc)のIOはCycle:100msに対して1000msまで延ばす
+				int CycleIdle;
+
+				//! 値の変化後にCycleの周期を続ける時間[ms]
+				int CycleHold;
+
+				//! リトライ回数
 				int Retry;
 
-				//! ̑
+				//! 共有のスレッドプールでポーリングするか
+				//! ※true:CPUのコア数のスレッドを複数の機器で共有 / false:機器ごとに専用のスレッド
+				bool Executor;
+
+				//! その他
 				Variant::CManager Other;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CConnect
-			/// @brief      IoɐڑݒNX
+			/// @brief      Ioに接続する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CConnect
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CConnect()
 				{
@@ -143,19 +163,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CConnect& operator = (const CConnect& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CConnect()
 				{
@@ -164,8 +184,8 @@ namespace Standard
 
 			private:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CConnect& object)
 				{
@@ -176,25 +196,25 @@ namespace Standard
 				}
 
 			public:
-				//! @̎ʎq
+				//! 機器の識別子
 				std::string Identifier;
 
-				//! ǂݍރAhX͈̔
+				//! 読み込むアドレスの範囲
 				std::vector<CAddressRange> AddressRanges;
 
-				//! ̑
+				//! その他
 				Variant::CManager Other;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CInput
-			/// @brief      ͂̐ݒNX
+			/// @brief      入力の設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CInput
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CInput()
 				{
@@ -202,19 +222,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CInput& operator = (const CInput& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CInput()
 				{
@@ -223,8 +243,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CInput& object)
 				{
@@ -233,19 +253,19 @@ namespace Standard
 				}
 
 			public:
-				//! ǂݍރAhX
+				//! 読み込むアドレス
 				std::vector<Specify::CAddress> Addresses;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CTrigger
-			/// @brief      gK[̐ݒNX
+			/// @brief      トリガーの設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CTrigger
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CTrigger()
 				{
@@ -253,19 +273,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CTrigger& operator = (const CTrigger& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CTrigger()
 				{
@@ -274,8 +294,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CTrigger& object)
 				{
@@ -284,22 +304,22 @@ namespace Standard
 				}
 
 			public:
-				//! AhX
+				//! アドレス
 				Specify::CAddress Address;
 
-				//! rbg̕
+				//! ビットの方向
 				Status::EnumDirection Direction;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CInputPending
-			/// @brief      IO̓͂ω̂҂ݒNX
+			/// @brief      IOの入力が変化するのを待つ設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CInputPending
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CInputPending()
 				{
@@ -307,19 +327,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CInputPending& operator = (const CInputPending& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CInputPending()
 				{
@@ -328,8 +348,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CInputPending& object)
 				{
@@ -339,13 +359,13 @@ namespace Standard
 				}
 
 			public:
-				//! gK[̐ݒNX
+				//! トリガーの設定クラス
 				CTrigger Trigger;
 
-				//! ^CAEg[ms]
+				//! タイムアウト[ms]
 				int Timeout;
 
-				//! ̑
+				//! その他
 				Variant::CManager Other;
 			};
 		}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <map>
 
@@ -15,13 +16,13 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CAddress
-			/// @brief      AhX̃NX
+			/// @brief      アドレスのクラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CAddress
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CAddress()
 				{
@@ -32,20 +33,20 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CAddress& operator = (const CAddress& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			rZq
-				/// @return			NX
+				/// @brief			比較演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				bool operator == (const CAddress& object) const
 				{
@@ -53,8 +54,8 @@ namespace Standard
 				}
 
 				//////////////////////////////////////////////////////////////////////////////////
-				///// @brief			rZq
-				///// @return			NX
+				///// @brief			比較演算子
+				///// @return			自クラス
 				//////////////////////////////////////////////////////////////////////////////////
 				//bool operator != (const CAddress& value) const
 				//{
@@ -62,8 +63,8 @@ namespace Standard
 				//}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			rZq
-				/// @return			NX
+				/// @brief			比較演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				bool operator < (const CAddress& object) const
 				{
@@ -71,7 +72,7 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CAddress()
 				{
@@ -80,8 +81,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CAddress& object)
 				{
@@ -92,40 +93,40 @@ namespace Standard
 				}
 
 			public:
-				//! f[^̎
+				//! データの種別
 				std::string Category;
 
-				//! ԍ
+				//! 番号
 				int Index;
 
-				//! tH[}bǧ^
+				//! フォーマットの型
 				bool Hex;
 
-				//! tH[}bǧ
+				//! フォーマットの桁数
 				int Margin;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			ɕϊ
-			/// @param[in]		AhX̃NX
-			/// @return			ɕϊAhX
+			/// @brief			文字列に変換
+			/// @param[in]		アドレスのクラス
+			/// @return			文字列に変換したアドレス
 			////////////////////////////////////////////////////////////////////////////////
 			inline std::string Format(const CAddress& object)
 			{
 				std::stringstream ret;
 
-				// f[^̎ʂt
+				// データの種別を付加
 				ret << object.Category;
 
-				// tH[}bǧ^mF
+				// フォーマットの型を確認
 				if (object.Hex)
 				{
-					// 16iŕϊ
+					// 16進数で変換
 					ret << Text::FormatX(object.Margin, object.Index, "");
 				}
 				else
 				{
-					// 10iŕϊ
+					// 10進数で変換
 					ret << Text::Format(object.Margin, object.Index);
 				}
 
@@ -136,25 +137,25 @@ namespace Standard
 		namespace Status
 		{
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			rbg̕
+			/// @enum			ビットの方向
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumDirection
 			{
-				DirectionRise,		// オ
-				DirectionFall		// 
+				DirectionRise,		// 立ち上がり
+				DirectionFall		// 立ち下がり
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CEntity
-			/// @brief      ԂێNX
-			///				 AhX̃NXh
+			/// @brief      状態を保持するクラス
+			///				⇒ アドレスのクラスから派生
 			////////////////////////////////////////////////////////////////////////////////
 			class CEntity
 				: virtual public Specify::CAddress
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CEntity() : Specify::CAddress()
 				{
@@ -162,32 +163,32 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
-				/// @param[in]		address	AhX̃NX
-				/// @param[in]		value	f[^
+				/// @brief			コンストラクタ
+				/// @param[in]		address	アドレスのクラス
+				/// @param[in]		value	データ
 				////////////////////////////////////////////////////////////////////////////////
 				CEntity(const Specify::CAddress& address, const boost::any& value) : CEntity()
 				{
-					// ̊֐
+					// 既定の関数
 					Specify::CAddress::Update(address);
 
 					this->Value = value;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CEntity& operator = (const CEntity& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CEntity()
 				{
@@ -196,63 +197,67 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CEntity& object)
 				{
-					// ̊֐
+					// 既定の関数
 					CAddress::Update(object);
 
 					this->Value = object.Value;
 				}
 
 			public:
-				//! l
+				//! 値
 				boost::any Value;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CInput
-			/// @brief      IȌ()̃NX
+			/// @brief      IOの状態(入力)のクラス
+			/// @detail		監視で通知する場合は変化したアドレスだけ格納する
+			///				通知ごとの連番と直前の連番を比較すると、取りこぼした通知を検出できる
 			////////////////////////////////////////////////////////////////////////////////
 			class CInput
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CInput()
 				{
-
+					Sequence = 0;
+					Previous = 0;
+					Timestamp = 0;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CInput& operator = (const CInput& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CInput& operator += (const CInput& object) noexcept
 				{
-					// ǉ
+					// 追加
 					Insert(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CInput()
 				{
@@ -261,20 +266,22 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CInput& object)
 				{
 					this->Values.clear();
+					this->Sequence = 0;
 
-					// NXǉ
+					// 自クラスを追加
 					Insert(object);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXǉ
-				/// @param[in]		object	NX
+				/// @brief			自クラスを追加
+				/// @detail			連番と時刻は追加したクラスに更新し、直前の連番は最初のクラスを保持する
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Insert(const CInput& object)
 				{
@@ -282,22 +289,41 @@ namespace Standard
 					{
 						this->Values[value.first] = value.second;
 					}
+
+					// 統合前の通知を確認
+					if (this->Sequence == 0)
+					{
+						// 最初の通知 ⇒ 直前の連番を更新
+						this->Previous = object.Previous;
+					}
+
+					this->Sequence = object.Sequence;
+					this->Timestamp = object.Timestamp;
 				}
 
 			public:
-				//! ͂̏
+				//! 入力の状態
 				std::map<Specify::CAddress, boost::any> Values;
+
+				//! 通知の連番 ※1から開始
+				uint64_t Sequence;
+
+				//! 直前に通知した連番 ※通知を統合した場合は統合した最初の通知の直前
+				uint64_t Previous;
+
+				//! 読み込んだ時刻[us] ※Grabber::Frame::Now()と同じ時計
+				int64_t Timestamp;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      COutput
-			/// @brief      IȌ(o)̃NX
+			/// @brief      IOの状態(出力)のクラス
 			////////////////////////////////////////////////////////////////////////////////
 			class COutput
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				COutput()
 				{
@@ -305,19 +331,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				COutput& operator = (const COutput& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~COutput()
 				{
@@ -326,8 +352,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const COutput& object)
 				{
@@ -336,7 +362,7 @@ namespace Standard
 				}
 
 			public:
-				//! ԂێNX
+				//! 状態を保持するクラス
 				std::vector<CEntity> Entitys;
 			};
 		}
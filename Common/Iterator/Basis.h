@@ -8,20 +8,20 @@ namespace Standard
 	{
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      COpenController
-		/// @brief      񋓎q̑sNX
+		/// @brief      列挙子の走査を行うクラス
 		////////////////////////////////////////////////////////////////////////////////
 		template <typename Enum, Enum first, Enum last>
 		class CWorker
 		{
-			//! 񋓌^̊^
+			//! 列挙型の基底型
 			typedef typename std::underlying_type<Enum>::type target;
 
-			//! Ce[^̌ݒl
+			//! イテレータの現在値
 			int value;
 
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CWorker(const Enum& f) : value(static_cast<target>(f))
 			{
@@ -29,7 +29,7 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CWorker() : value(static_cast<target>(first))
 			{
@@ -37,8 +37,8 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			CNgZq
-			/// @return			NX
+			/// @brief			インクリメント演算子
+			/// @return			自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			CWorker operator++()
 			{
@@ -48,8 +48,8 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			֐ߎQƉZq
-			/// @return			NX
+			/// @brief			関節参照演算子
+			/// @return			自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			Enum operator*()
 			{
@@ -57,9 +57,9 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			񍀓lZq
-			/// @param[in]		object	񋓎q̃Ce[^sbNX
-			/// @return			true:Ȃ / false:
+			/// @brief			二項等値演算子
+			/// @param[in]		object	列挙子のイテレータを行う基礎クラス
+			/// @return			true:等しくない / false:等しい
 			////////////////////////////////////////////////////////////////////////////////
 			bool operator!=(const CWorker& object)
 			{
@@ -67,8 +67,8 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			擪̗vf擾
-			/// @return			NX
+			/// @brief			先頭の要素を取得
+			/// @return			自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			CWorker begin()
 			{
@@ -76,8 +76,8 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			Ō̗vf擾
-			/// @return			NX
+			/// @brief			最後尾の要素を取得
+			/// @return			自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			CWorker end()
 			{
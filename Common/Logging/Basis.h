@@ -6,29 +6,29 @@ namespace Standard
 {
 	namespace Logging
 	{
-		//! ؂蕶
+		//! 区切り文字
 		const char ConstSeparator = '\t';
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @enum			Õx
+		/// @enum			ログのレベル
 		////////////////////////////////////////////////////////////////////////////////
 		enum EnumLevel
 		{
-			LevelTrace,			// g[X DebugڍׂȏȂ(摜őPxlc)
-			LevelDebug,			// fobO VXe̓󋵂ɊւڍׂȏȂ(PLC̃WX^ύXc)
-			LevelInfomation,	//  Ȃ(J̐ڑA{^̃NbNc)
-			LevelError			// G[ \ȂG[Ȃ(J̐ؒfAsANZXc)
+			LevelTrace,			// トレース ※Debugよりも詳細な情報など(画像検出時の輝度値…)
+			LevelDebug,			// デバッグ ※システムの動作状況に関する詳細な情報など(PLCのレジスタ変更時…)
+			LevelInfomation,	// 情報 ※情報など(カメラの接続、ボタンのクリック…)
+			LevelError			// エラー ※予期しないエラーなど(カメラの切断、不正アクセス…)
 		};
 
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CObject
-		/// @brief      ȌێNX
+		/// @brief      ログの情報を保持するクラス
 		////////////////////////////////////////////////////////////////////////////////
 		class CObject
 		{
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CObject()
 			{
@@ -37,40 +37,40 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
-			/// @param[in]		object	NX
+			/// @brief			コンストラクタ
+			/// @param[in]		object	自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			CObject(const CObject& object)
 			{
-				// XV
+				// 更新
 				Update(object.Level, object.Message.str());
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
-			/// @param[in]		level	Õx
-			/// @param[in]		message	ÕbZ[W
+			/// @brief			コンストラクタ
+			/// @param[in]		level	ログのレベル
+			/// @param[in]		message	ログのメッセージ
 			////////////////////////////////////////////////////////////////////////////////
 			CObject(EnumLevel level, const std::string& message)
 			{
-				// XV
+				// 更新
 				Update(level, message);
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			Rs[Zq
-			/// @return			NX
+			/// @brief			コピー代入演算子
+			/// @return			自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			CObject& operator = (const CObject& object) noexcept
 			{
-				// XV
+				// 更新
 				Update(object);
 
 				return *this;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			~CObject()
 			{
@@ -79,20 +79,20 @@ namespace Standard
 
 		protected:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			NXXV
-			/// @param[in]		object	NX
+			/// @brief			自クラスを更新
+			/// @param[in]		object	自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			void Update(const CObject& object)
 			{
-				// XV
+				// 更新
 				Update(object.Level, object.Message.str());
 			}
 
 		private:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			NXXV
-			/// @param[in]		level	Õx
-			/// @param[in]		message	ÕbZ[W
+			/// @brief			自クラスを更新
+			/// @param[in]		level	ログのレベル
+			/// @param[in]		message	ログのメッセージ
 			////////////////////////////////////////////////////////////////////////////////
 			void Update(EnumLevel level, const std::string& message)
 			{
@@ -102,10 +102,10 @@ namespace Standard
 			}
 
 		public:
-			//! Õx
+			//! ログのレベル
 			EnumLevel Level;
 
-			//! ÕbZ[W
+			//! ログのメッセージ
 			std::stringstream Message;
 		};
 	}
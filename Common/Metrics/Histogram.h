@@ -0,0 +1,322 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <intrin.h>
+
+#include "Snapshot.h"
+
+namespace Standard
+{
+	namespace Metrics
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CHistogram
+		/// @brief      処理時間の分布を保持するクラス
+		/// @detail		2のべき乗ごとに16分割した区間(相対誤差は約3%)で回数を数える ※32[us]までは1[us]ごと
+		///				スレッドごとに分けた区間へ追加して、排他制御とキャッシュラインの競合をしない
+		///				集計は全スレッド分を合計する ※集計中に追加した処理時間は次の集計に含まれる場合がある
+		////////////////////////////////////////////////////////////////////////////////
+		class CHistogram
+		{
+		public:
+			//! 分割する区間の数 ※2のべき乗の1区間を16分割
+			static const int ConstLinear = 32;
+
+			//! 計測できる最大のビット数 ⇒ 約25日[us]
+			static const int ConstMagnitude = 41;
+
+			//! 区間の数
+			static const int ConstBucket = ConstLinear + (ConstMagnitude - 5) * (ConstLinear / 2);
+
+			//! スレッドごとに分ける数
+			static const int ConstShard = 8;
+
+		public:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			コンストラクタ
+			////////////////////////////////////////////////////////////////////////////////
+			CHistogram()
+			{
+				// スレッドごとに走査
+				for (auto& shard : m_shards)
+				{
+					for (auto& count : shard.Counts)
+					{
+						count.store(0, std::memory_order_relaxed);
+					}
+
+					shard.Sum.store(0, std::memory_order_relaxed);
+					shard.Minimum.store(UINT64_MAX, std::memory_order_relaxed);
+					shard.Maximum.store(0, std::memory_order_relaxed);
+				}
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			デストラクタ
+			////////////////////////////////////////////////////////////////////////////////
+			~CHistogram()
+			{
+
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			処理時間を追加
+			/// @detail			複数スレッドから呼び出し可能で、排他制御で待機しない
+			/// @param[in]		microseconds	処理時間[us]
+			////////////////////////////////////////////////////////////////////////////////
+			void Record(uint64_t microseconds)
+			{
+				CShard& shard = m_shards[GetShard()];
+
+				shard.Counts[GetIndex(microseconds)].fetch_add(1, std::memory_order_relaxed);
+				shard.Sum.fetch_add(microseconds, std::memory_order_relaxed);
+
+				// 最小値を更新
+				uint64_t minimum = shard.Minimum.load(std::memory_order_relaxed);
+				while (microseconds < minimum && shard.Minimum.compare_exchange_weak(minimum, microseconds, std::memory_order_relaxed) == false);
+
+				// 最大値を更新
+				uint64_t maximum = shard.Maximum.load(std::memory_order_relaxed);
+				while (maximum < microseconds && shard.Maximum.compare_exchange_weak(maximum, microseconds, std::memory_order_relaxed) == false);
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			集計
+			/// @param[in]		reset	true:集計した分を破棄 / false:保持
+			/// @return			集計結果 ※名称は未設定
+			////////////////////////////////////////////////////////////////////////////////
+			Snapshot::CObject GetSnapshot(bool reset)
+			{
+				Snapshot::CObject ret;
+
+				uint64_t counts[ConstBucket] = {};
+				uint64_t sum = 0;
+				uint64_t minimum = UINT64_MAX;
+				uint64_t maximum = 0;
+
+				// スレッドごとに走査
+				for (auto& shard : m_shards)
+				{
+					for (int index = 0; index < ConstBucket; index++)
+					{
+						counts[index] += reset ? shard.Counts[index].exchange(0, std::memory_order_relaxed) : shard.Counts[index].load(std::memory_order_relaxed);
+					}
+
+					sum += reset ? shard.Sum.exchange(0, std::memory_order_relaxed) : shard.Sum.load(std::memory_order_relaxed);
+
+					uint64_t value = reset ? shard.Minimum.exchange(UINT64_MAX, std::memory_order_relaxed) : shard.Minimum.load(std::memory_order_relaxed);
+					minimum = (value < minimum) ? value : minimum;
+
+					value = reset ? shard.Maximum.exchange(0, std::memory_order_relaxed) : shard.Maximum.load(std::memory_order_relaxed);
+					maximum = (maximum < value) ? value : maximum;
+				}
+
+				uint64_t count = 0;
+
+				for (auto value : counts)
+				{
+					count += value;
+				}
+
+				ret.Kind = Snapshot::KindHistogram;
+				ret.Count = (int64_t)count;
+
+				if (0 < count)
+				{
+					ret.Average = (double)sum / count / 1000.0;
+					ret.Minimum = minimum / 1000.0;
+					ret.Maximum = maximum / 1000.0;
+					ret.P50 = GetPercentile(counts, count, 0.5, minimum, maximum) / 1000.0;
+					ret.P90 = GetPercentile(counts, count, 0.9, minimum, maximum) / 1000.0;
+					ret.P99 = GetPercentile(counts, count, 0.99, minimum, maximum) / 1000.0;
+					ret.P999 = GetPercentile(counts, count, 0.999, minimum, maximum) / 1000.0;
+				}
+
+				return ret;
+			}
+
+		private:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			追加するスレッドの番号を取得
+			/// @detail			スレッドごとに最初の呼び出しで順番に割り当てる
+			/// @return			スレッドの番号
+			////////////////////////////////////////////////////////////////////////////////
+			static size_t GetShard()
+			{
+				static std::atomic<size_t> next(0);
+				thread_local size_t ret = next.fetch_add(1, std::memory_order_relaxed) % ConstShard;
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			処理時間の区間を取得
+			/// @param[in]		value	処理時間[us]
+			/// @return			区間の番号
+			////////////////////////////////////////////////////////////////////////////////
+			static int GetIndex(uint64_t value)
+			{
+				int ret = 0;
+
+				if (value < ConstLinear)
+				{
+					// 1[us]ごと
+					ret = (int)value;
+				}
+				else
+				{
+					unsigned long magnitude = 0;
+
+					// 最上位ビットを取得 ⇒ 上限を超える場合は最後の区間
+					_BitScanReverse64(&magnitude, value);
+
+					if (ConstMagnitude <= (int)magnitude)
+					{
+						ret = ConstBucket - 1;
+					}
+					else
+					{
+						// 上位5ビットで区間を確定
+						int shift = (int)magnitude - 4;
+
+						ret = ConstLinear + ((int)magnitude - 5) * (ConstLinear / 2) + (int)(value >> shift) - (ConstLinear / 2);
+					}
+				}
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			区間の中央の値を取得
+			/// @param[in]		index	区間の番号
+			/// @return			処理時間[us]
+			////////////////////////////////////////////////////////////////////////////////
+			static double GetValue(int index)
+			{
+				double ret = 0;
+
+				if (index < ConstLinear)
+				{
+					ret = index;
+				}
+				else
+				{
+					int offset = index - ConstLinear;
+					int shift = offset / (ConstLinear / 2) + 1;
+					uint64_t lower = (uint64_t)(offset % (ConstLinear / 2) + (ConstLinear / 2)) << shift;
+
+					ret = lower + ((uint64_t)1 << shift) / 2.0;
+				}
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			パーセンタイルを取得
+			/// @param[in]		counts	区間ごとの回数
+			/// @param[in]		count	回数の合計
+			/// @param[in]		rate	割合(0～1)
+			/// @param[in]		minimum	最小値[us]
+			/// @param[in]		maximum	最大値[us]
+			/// @return			処理時間[us] ※最小値～最大値に制限
+			////////////////////////////////////////////////////////////////////////////////
+			static double GetPercentile(const uint64_t* counts, uint64_t count, double rate, uint64_t minimum, uint64_t maximum)
+			{
+				double ret = (double)maximum;
+
+				uint64_t target = (uint64_t)(rate * count + 0.5);
+				uint64_t total = 0;
+
+				target = (target < 1) ? 1 : target;
+
+				// 区間だけ走査
+				for (int index = 0; index < ConstBucket; index++)
+				{
+					total += counts[index];
+
+					if (target <= total)
+					{
+						ret = GetValue(index);
+						break;
+					}
+				}
+
+				ret = (ret < minimum) ? minimum : ret;
+				ret = (maximum < ret) ? maximum : ret;
+
+				return ret;
+			}
+
+		private:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CShard
+			/// @brief      スレッドごとの回数を保持するクラス
+			/// @detail		キャッシュラインを共有しないように整列する
+			////////////////////////////////////////////////////////////////////////////////
+			class alignas(64) CShard
+			{
+			public:
+				//! 区間ごとの回数
+				std::atomic<uint64_t> Counts[ConstBucket];
+
+				//! 処理時間の合計[us]
+				std::atomic<uint64_t> Sum;
+
+				//! 最小値[us]
+				std::atomic<uint64_t> Minimum;
+
+				//! 最大値[us]
+				std::atomic<uint64_t> Maximum;
+			};
+
+			//! スレッドごとの回数
+			CShard m_shards[ConstShard];
+		};
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CCounter
+		/// @brief      回数を保持するクラス
+		////////////////////////////////////////////////////////////////////////////////
+		class CCounter
+		{
+		public:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			コンストラクタ
+			////////////////////////////////////////////////////////////////////////////////
+			CCounter()
+			{
+				m_count.store(0, std::memory_order_relaxed);
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			回数を追加
+			/// @detail			複数スレッドから呼び出し可能で、排他制御で待機しない
+			/// @param[in]		value	追加する回数
+			////////////////////////////////////////////////////////////////////////////////
+			void Add(int64_t value = 1)
+			{
+				m_count.fetch_add(value, std::memory_order_relaxed);
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			集計
+			/// @param[in]		reset	true:集計した分を破棄 / false:保持
+			/// @return			集計結果 ※名称は未設定
+			////////////////////////////////////////////////////////////////////////////////
+			Snapshot::CObject GetSnapshot(bool reset)
+			{
+				Snapshot::CObject ret;
+
+				ret.Kind = Snapshot::KindCounter;
+				ret.Count = reset ? m_count.exchange(0, std::memory_order_relaxed) : m_count.load(std::memory_order_relaxed);
+
+				return ret;
+			}
+
+		private:
+			//! 回数
+			std::atomic<int64_t> m_count;
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Histogram.h"
+#include "../Utility/StopWatch.h"
+
+namespace Standard
+{
+	namespace Metrics
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CScope
+		/// @brief      範囲の処理時間を計測するクラス
+		/// @detail		生成から破棄までの経過時間を処理時間の分布へ追加する
+		///				例:static Metrics::CHistogram& histogram = Transfer::GetHistogram("Axis::ReadDerived()");
+		///				   Metrics::CScope scope(histogram);
+		////////////////////////////////////////////////////////////////////////////////
+		class CScope
+		{
+		public:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			コンストラクタ
+			/// @param[in]		histogram	処理時間の分布
+			////////////////////////////////////////////////////////////////////////////////
+			CScope(CHistogram& histogram) : m_histogram(histogram)
+			{
+
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			デストラクタ
+			/// @detail			経過時間を追加する
+			////////////////////////////////////////////////////////////////////////////////
+			~CScope()
+			{
+				// 経過時間を追加
+				m_stopWatch.Record(m_histogram);
+			}
+
+		private:
+			//! 処理時間の分布
+			CHistogram& m_histogram;
+
+			//! ストップウォッチ
+			Utility::CStopWatch m_stopWatch;
+		};
+	}
+}
\ No newline at end of file
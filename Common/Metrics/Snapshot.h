@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace Standard
+{
+	namespace Metrics
+	{
+		// 集計結果
+		namespace Snapshot
+		{
+			////////////////////////////////////////////////////////////////////////////////
+			/// @enum			計測の種類
+			////////////////////////////////////////////////////////////////////////////////
+			enum EnumKind
+			{
+				KindHistogram,		// 処理時間の分布
+				KindCounter			// 回数
+			};
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CObject
+			/// @brief      名称ごとの計測の集計結果を保持するクラス
+			/// @detail		回数の場合はCountだけ有効
+			////////////////////////////////////////////////////////////////////////////////
+			class CObject
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CObject()
+				{
+					Name = "";
+					Kind = KindHistogram;
+					Count = 0;
+					Average = 0;
+					Minimum = 0;
+					Maximum = 0;
+					P50 = 0;
+					P90 = 0;
+					P99 = 0;
+					P999 = 0;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				CObject& operator = (const CObject& object) noexcept
+				{
+					// 更新
+					Update(object);
+
+					return *this;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				~CObject()
+				{
+
+				}
+
+			protected:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				void Update(const CObject& object)
+				{
+					this->Name = object.Name;
+					this->Kind = object.Kind;
+					this->Count = object.Count;
+					this->Average = object.Average;
+					this->Minimum = object.Minimum;
+					this->Maximum = object.Maximum;
+					this->P50 = object.P50;
+					this->P90 = object.P90;
+					this->P99 = object.P99;
+					this->P999 = object.P999;
+				}
+
+			public:
+				//! 名称
+				std::string Name;
+
+				//! 計測の種類
+				EnumKind Kind;
+
+				//! 回数
+				int64_t Count;
+
+				//! 平均時間[ms]
+				double Average;
+
+				//! 最小時間[ms]
+				double Minimum;
+
+				//! 最大時間[ms]
+				double Maximum;
+
+				//! 50パーセンタイル[ms]
+				double P50;
+
+				//! 90パーセンタイル[ms]
+				double P90;
+
+				//! 99パーセンタイル[ms]
+				double P99;
+
+				//! 99.9パーセンタイル[ms]
+				double P999;
+			};
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace Standard
+{
+	namespace Onnx
+	{
+		// モデルの情報
+		namespace Information
+		{
+			////////////////////////////////////////////////////////////////////////////////
+			/// @enum			モデルの状態
+			////////////////////////////////////////////////////////////////////////////////
+			enum EnumState
+			{
+				StateUnloaded = 0,			//! 未読み込み
+				StateLoading,				//! 読み込み中 ※読み込み済みのモデルがある場合は推論を継続
+				StateLoaded,				//! 読み込み済み
+				StateFailed,				//! 読み込みに失敗 ※読み込み済みのモデルがある場合は推論を継続
+			};
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CObject
+			/// @brief      読み込んだモデルの情報を保持するクラス
+			////////////////////////////////////////////////////////////////////////////////
+			class CObject
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CObject()
+				{
+					Name = "";
+					Path = "";
+					State = StateUnloaded;
+					Version = 0;
+					FileSize = 0;
+					Memory = 0;
+					LoadTime = 0;
+					Message = "";
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				CObject& operator = (const CObject& object) noexcept
+				{
+					// 更新
+					Update(object);
+
+					return *this;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				~CObject()
+				{
+
+				}
+
+			protected:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				void Update(const CObject& object)
+				{
+					this->Name = object.Name;
+					this->Path = object.Path;
+					this->State = object.State;
+					this->Version = object.Version;
+					this->FileSize = object.FileSize;
+					this->Memory = object.Memory;
+					this->LoadTime = object.LoadTime;
+					this->Message = object.Message;
+				}
+
+			public:
+				//! モデルの名称
+				std::string Name;
+
+				//! 推論に使用しているモデルのファイル
+				std::string Path;
+
+				//! 状態
+				EnumState State;
+
+				//! 入れ替えた回数 ※推論に使用しているモデルの版
+				uint64_t Version;
+
+				//! モデルのファイルのサイズ[byte]
+				uint64_t FileSize;
+
+				//! 読み込みで増えたメモリ[byte] ※空打ちまでを含み、推論で増えた分は含まない
+				uint64_t Memory;
+
+				//! 読み込み時間[ms]
+				double LoadTime;
+
+				//! 読み込みに失敗した理由
+				std::string Message;
+			};
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace Standard
+{
+	namespace Onnx
+	{
+		// 設定
+		namespace Setting
+		{
+			////////////////////////////////////////////////////////////////////////////////
+			/// @enum			グラフの最適化
+			////////////////////////////////////////////////////////////////////////////////
+			enum EnumOptimization
+			{
+				OptimizationDisable = 0,	//! 最適化しない
+				OptimizationBasic,			//! 冗長なノードの削除など
+				OptimizationExtended,		//! ノードの融合など
+				OptimizationAll,			//! レイアウトの最適化を含む全て
+			};
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CModel
+			/// @brief      モデルの設定クラス
+			/// @detail		入出力の名称と形状はモデルから取得するため、前処理と推論の方法だけ設定する
+			///				前処理は (画素値 × Scale - Mean) ÷ Deviation で正規化する
+			////////////////////////////////////////////////////////////////////////////////
+			class CModel
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CModel()
+				{
+					Path = "";
+					Width = -1;
+					Height = -1;
+					Scale = 1.0 / 255.0;
+					Mean = { 0.0, 0.0, 0.0 };
+					Deviation = { 1.0, 1.0, 1.0 };
+					SwapRB = true;
+					MaxBatch = 8;
+					BatchTimeout = 2000;			// 2ms
+					Concurrency = 1;
+					IntraThreads = 0;
+					InterThreads = 0;
+					Optimization = OptimizationAll;
+					OptimizedPath = "";
+					MemoryArena = true;
+					MemoryPattern = true;
+					WarmupCount = 3;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				CModel& operator = (const CModel& object) noexcept
+				{
+					// 更新
+					Update(object);
+
+					return *this;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				~CModel()
+				{
+
+				}
+
+			protected:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				void Update(const CModel& object)
+				{
+					this->Path = object.Path;
+					this->Width = object.Width;
+					this->Height = object.Height;
+					this->Scale = object.Scale;
+					this->Mean = object.Mean;
+					this->Deviation = object.Deviation;
+					this->SwapRB = object.SwapRB;
+					this->MaxBatch = object.MaxBatch;
+					this->BatchTimeout = object.BatchTimeout;
+					this->Concurrency = object.Concurrency;
+					this->IntraThreads = object.IntraThreads;
+					this->InterThreads = object.InterThreads;
+					this->Optimization = object.Optimization;
+					this->OptimizedPath = object.OptimizedPath;
+					this->MemoryArena = object.MemoryArena;
+					this->MemoryPattern = object.MemoryPattern;
+					this->WarmupCount = object.WarmupCount;
+				}
+
+			public:
+				//! モデルのファイル
+				std::string Path;
+
+				//! 入力の幅 ※モデルの幅が可変の場合だけ使用(-1:モデルに従う)
+				int Width;
+
+				//! 入力の高さ ※モデルの高さが可変の場合だけ使用(-1:モデルに従う)
+				int Height;
+
+				//! 画素値の倍率
+				double Scale;
+
+				//! チャンネルごとの平均 ※モデルのチャンネル順
+				std::vector<double> Mean;
+
+				//! チャンネルごとの標準偏差 ※モデルのチャンネル順
+				std::vector<double> Deviation;
+
+				//! カラー画像をBGRからRGBへ並び替えるか
+				bool SwapRB;
+
+				//! まとめて推論する最大の画像数 ※モデルのバッチが固定の場合はモデルに従う
+				int MaxBatch;
+
+				//! 他の画像を待つ時間[us]
+				int BatchTimeout;
+
+				//! 同時に推論する数
+				int Concurrency;
+
+				//! ノード内で並列に演算するスレッド数(0:ライブラリの既定)
+				int IntraThreads;
+
+				//! ノード間で並列に演算するスレッド数(0:並列にしない)
+				int InterThreads;
+
+				//! グラフの最適化
+				EnumOptimization Optimization;
+
+				//! 最適化したモデルのファイル(空:保存しない) ※モデルより新しい場合は最適化したモデルを読み込む
+				std::string OptimizedPath;
+
+				//! メモリのアリーナを使用するか
+				bool MemoryArena;
+
+				//! メモリの確保パターンを使用するか ※入力の形状が変わる場合は確保パターンも変わる
+				bool MemoryPattern;
+
+				//! 読み込み後に推論を空打ちする回数
+				int WarmupCount;
+			};
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Standard
+{
+	namespace Onnx
+	{
+		// テンソル
+		namespace Tensor
+		{
+			////////////////////////////////////////////////////////////////////////////////
+			/// @enum			要素の型
+			////////////////////////////////////////////////////////////////////////////////
+			enum EnumType
+			{
+				TypeUnknown = 0,			//! 未対応
+				TypeFloat,					//! float
+				TypeUint8,					//! uint8_t
+				TypeInt32,					//! int32_t
+				TypeInt64,					//! int64_t
+			};
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CObject
+			/// @brief      テンソルの情報を保持するクラス
+			/// @detail		モデルの入出力の情報と推論の結果で使用する
+			///				形状の-1は可変(バッチなど)を示す
+			////////////////////////////////////////////////////////////////////////////////
+			class CObject
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CObject()
+				{
+					Name = "";
+					Type = TypeUnknown;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				CObject& operator = (const CObject& object) noexcept
+				{
+					// 更新
+					Update(object);
+
+					return *this;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				~CObject()
+				{
+
+				}
+
+			protected:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				void Update(const CObject& object)
+				{
+					this->Name = object.Name;
+					this->Type = object.Type;
+					this->Shape = object.Shape;
+					this->Value = object.Value;
+				}
+
+			public:
+				//! 名称
+				std::string Name;
+
+				//! 要素の型 ※推論の結果はfloatへ変換済み
+				EnumType Type;
+
+				//! 形状 ※推論の結果は画像1枚分(バッチを除く)
+				std::vector<int64_t> Shape;
+
+				//! 値 ※推論の結果だけ
+				std::vector<float> Value;
+			};
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace Standard
+{
+	namespace Pipeline
+	{
+		// 統計
+		namespace Statistics
+		{
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CObject
+			/// @brief      段ごとの処理の統計を保持するクラス
+			////////////////////////////////////////////////////////////////////////////////
+			class CObject
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CObject()
+				{
+					Name = "";
+					Processed = 0;
+					Rejected = 0;
+					Dropped = 0;
+					Blocked = 0;
+					Errors = 0;
+					Depth = 0;
+					HighWatermark = 0;
+					Capacity = 0;
+					Average = 0;
+					Maximum = 0;
+					Throughput = 0;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				CObject& operator = (const CObject& object) noexcept
+				{
+					// 更新
+					Update(object);
+
+					return *this;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				~CObject()
+				{
+
+				}
+
+			protected:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
+				////////////////////////////////////////////////////////////////////////////////
+				void Update(const CObject& object)
+				{
+					this->Name = object.Name;
+					this->Processed = object.Processed;
+					this->Rejected = object.Rejected;
+					this->Dropped = object.Dropped;
+					this->Blocked = object.Blocked;
+					this->Errors = object.Errors;
+					this->Depth = object.Depth;
+					this->HighWatermark = object.HighWatermark;
+					this->Capacity = object.Capacity;
+					this->Average = object.Average;
+					this->Maximum = object.Maximum;
+					this->Throughput = object.Throughput;
+				}
+
+			public:
+				//! 段の名称
+				std::string Name;
+
+				//! 処理した数
+				uint64_t Processed;
+
+				//! 入力の待ち行列が上限で受け付けなかった数 ※前の段が空きを待って再試行した回数を含む
+				uint64_t Rejected;
+
+				//! 次の段が上限で破棄した数
+				uint64_t Dropped;
+
+				//! 次の段の空きを待った数
+				uint64_t Blocked;
+
+				//! 処理(取り込み)で例外が発生して破棄した数
+				uint64_t Errors;
+
+				//! 入力の待ち行列の保持数
+				uint64_t Depth;
+
+				//! 入力の待ち行列の最大の保持数
+				uint64_t HighWatermark;
+
+				//! 入力の待ち行列の容量
+				uint64_t Capacity;
+
+				//! 1件あたりの平均の処理時間[ms]
+				double Average;
+
+				//! 1件あたりの最大の処理時間[ms]
+				double Maximum;
+
+				//! 処理の速度[件/s]
+				double Throughput;
+			};
+		}
+	}
+}
\ No newline at end of file
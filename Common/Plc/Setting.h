@@ -10,13 +10,13 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CDefault
-			/// @brief      Plc̃ftHgȐݒNX
+			/// @brief      Plcのデフォルトな設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CDefault
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CDefault()
 				{
@@ -25,19 +25,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CDefault& operator = (const CDefault& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CDefault()
 				{
@@ -46,8 +46,8 @@ namespace Standard
 
 			private:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CDefault& object)
 				{
@@ -57,25 +57,25 @@ namespace Standard
 				}
 
 			public:
-				//! |[O̎[ms]
+				//! ポーリングの周期[ms]
 				int Cycle;
 
-				//! gC
+				//! リトライ回数
 				int Retry;
 
-				//! ̑
+				//! その他
 				Variant::CManager Other;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CConnect
-			/// @brief      PlcɐڑݒNX
+			/// @brief      Plcに接続する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CConnect
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CConnect()
 				{
@@ -83,19 +83,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CConnect& operator = (const CConnect& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CConnect()
 				{
@@ -104,8 +104,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CConnect& object)
 				{
@@ -113,7 +113,7 @@ namespace Standard
 				}
 
 			public:
-				//! ̑
+				//! その他
 				Variant::CManager Other;
 			};
 		}
@@ -5,7 +5,7 @@ namespace Standard
 	namespace Signal
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @enum			Ԃ̃^Cv
+		/// @enum			状態のタイプ
 		////////////////////////////////////////////////////////////////////////////////
 		enum EnumStatus
 		{
@@ -10,15 +10,15 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CTemplate
-			/// @brief      VOgev[g̃NX
-			/// @param[in]	T	VOgNX(ev[gŎw)
+			/// @brief      シングルトン化するテンプレートのクラス
+			/// @param[in]	T	シングルトン化するクラス(テンプレートで指定)
 			////////////////////////////////////////////////////////////////////////////////
 			template <class T>
 			class CTemplate
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			CX^X̎擾
+				/// @brief			インスタンスの取得
 				////////////////////////////////////////////////////////////////////////////////
 				static T& Instance()
 				{
@@ -28,11 +28,11 @@ namespace Standard
 				}
 
 			private:
-				//! CX^X
+				//! インスタンス
 				typedef std::unique_ptr<T> SingletonPointerType;
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			CX^X̍\z
+				/// @brief			インスタンスの構築
 				////////////////////////////////////////////////////////////////////////////////
 				inline static T* CreateInstance()
 				{
@@ -40,7 +40,7 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			CX^X̎擾
+				/// @brief			インスタンスの取得
 				////////////////////////////////////////////////////////////////////////////////
 				inline static T& GetReference(const SingletonPointerType& ptr)
 				{
@@ -49,14 +49,14 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate()
 				{
 
 				}
 
-				// hŃftHgRXgN^ȊOŃCX^X\zꍇACreateInstance()㏑
+				// 派生先でデフォルトコンストラクタ以外でインスタンスを構築したい場合、CreateInstance()を上書きする
 				/*
 				***(int)
 				{
@@ -71,26 +71,26 @@ namespace Standard
 
 			private:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[RXgN^
-				/// @detail			ɂ
+				/// @brief			コピーコンストラクタ
+				/// @detail			無効にする
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate(const CTemplate&) = delete;
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @detail			ɂ
+				/// @brief			コピー代入演算子
+				/// @detail			無効にする
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate& operator = (const CTemplate&) = delete;
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[RXgN^
-				/// @detail			ɂ
+				/// @brief			コピーコンストラクタ
+				/// @detail			無効にする
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate(CTemplate&&) = delete;
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @detail			ɂ
+				/// @brief			コピー代入演算子
+				/// @detail			無効にする
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate& operator = (CTemplate&&) = delete;
 			};
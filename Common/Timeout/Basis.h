@@ -4,16 +4,16 @@ namespace Standard
 {
 	namespace Timeout
 	{
-		//! J̃n[gr[g[ms]
+		//! カメラのハートビート[ms]
 		const double ConstGrabberHeatBeat = 3000000;
 
-		//! J̎荞[ms]
+		//! カメラの取り込み[ms]
 		const double ConstGrabberCapture = 1000;
 
-		//! [VApi[ms]
+		//! モーションApi[ms]
 		const int ConstMotionApi = 3000;
 
-		//! [VApĩT[{[ms]
+		//! モーションApiのサーボ[ms]
 		const unsigned short ConstMotionServo = 5000;
 	}
 }
\ No newline at end of file
@@ -7,19 +7,19 @@ namespace Standard
 	namespace Logging
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ÕNXɓ CC֐
-		/// @detail			ÕNXɒǉ̕t
-		/// @param[in]		logging	ÕNX
-		/// @param[in]		postscript	ǉ̕
+		/// @brief			ログのクラスに統合 ※インライン関数
+		/// @detail			ログのクラスに追加の文字列を付加する
+		/// @param[in]		logging	ログのクラス
+		/// @param[in]		postscript	追加の文字列
 		////////////////////////////////////////////////////////////////////////////////
 		inline Logging::CObject Join(const Logging::CObject& logging, const std::string& postscript)
 		{
 			Logging::CObject ret(logging);
 
-			// ǉ̕񂪋󂩊mF
+			// 追加の文字列が空か確認
 			if (postscript.empty() == false)
 			{
-				// ǉ̕
+				// 追加の文字列を結合
 				ret.Message << Logging::ConstSeparator << postscript;
 			}
 
@@ -27,10 +27,10 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			OÕNXɓ CC֐
-		/// @detail			ÕNXɒǉ̕ƗÕbZ[Wt
-		/// @param[in]		logging	ÕNX
-		/// @param[in]		postscript	ǉ̕
+		/// @brief			例外をログのクラスに統合 ※インライン関数
+		/// @detail			ログのクラスに追加の文字列と例外のメッセージを付加する
+		/// @param[in]		logging	ログのクラス
+		/// @param[in]		postscript	追加の文字列
 		////////////////////////////////////////////////////////////////////////////////
 		inline Logging::CObject Exception(const Logging::CObject& logging, const std::string& postscript)
 		{
@@ -42,11 +42,11 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			OÕNXɓ CC֐
-		/// @detail			ÕNXɒǉ̕ƗÕbZ[Wt
-		/// @param[in]		logging	ÕNX
-		/// @param[in]		postscript	ǉ̕
-		/// @param[in]		e	O̕
+		/// @brief			例外をログのクラスに統合 ※インライン関数
+		/// @detail			ログのクラスに追加の文字列と例外のメッセージを付加する
+		/// @param[in]		logging	ログのクラス
+		/// @param[in]		postscript	追加の文字列
+		/// @param[in]		e	例外の文字列
 		////////////////////////////////////////////////////////////////////////////////
 		inline Logging::CObject Exception(const Logging::CObject& logging, const std::string& postscript, const std::string& e)
 		{
@@ -59,11 +59,11 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			OÕNXɓ CC֐
-		/// @detail			ÕNXɒǉ̕ƗÕbZ[Wt
-		/// @param[in]		logging	ÕNX
-		/// @param[in]		postscript	ǉ̕
-		/// @param[in]		e	O
+		/// @brief			例外をログのクラスに統合 ※インライン関数
+		/// @detail			ログのクラスに追加の文字列と例外のメッセージを付加する
+		/// @param[in]		logging	ログのクラス
+		/// @param[in]		postscript	追加の文字列
+		/// @param[in]		e	例外
 		////////////////////////////////////////////////////////////////////////////////
 		inline Logging::CObject Exception(const Logging::CObject& logging, const std::string& postscript, const std::exception& e)
 		{
@@ -11,9 +11,9 @@ namespace Standard
 	namespace Text
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			wstring -> string֕ϊ CC֐
-		/// @param[in]		value	f[^
-		/// @return         string^ɕϊꂽ
+		/// @brief			wstring -> stringへ変換 ※インライン関数
+		/// @param[in]		value	元データ
+		/// @return         string型に変換された文字列
 		////////////////////////////////////////////////////////////////////////////////
 		inline std::string Convert(const std::wstring& value)
 		{
@@ -36,9 +36,9 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			string -> wstring֕ϊ CC֐
-		/// @param[in]		value	f[^
-		/// @return         wstring^ɕϊꂽ
+		/// @brief			string -> wstringへ変換 ※インライン関数
+		/// @param[in]		value	元データ
+		/// @return         wstring型に変換された文字列
 		////////////////////////////////////////////////////////////////////////////////
 		inline std::wstring Convert(const std::string& value)
 		{
@@ -61,11 +61,11 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			l10i֕ϊ CC֐
-		/// @detail			0߂\z
-		/// @param[in]		margin	
-		/// @param[in]		value	l
-		/// @return         tH[}bgꂽ
+		/// @brief			整数値を10進数文字列へ変換 ※インライン関数
+		/// @detail			左側を桁数で0埋めした文字列を構築する
+		/// @param[in]		margin	桁数
+		/// @param[in]		value	整数値
+		/// @return         フォーマットされた文字列
 		////////////////////////////////////////////////////////////////////////////////
 		inline std::string Format(int margin, int value)
 		{
@@ -77,11 +77,11 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			l10i֕ϊ CC֐
-		/// @detail			0߂\z
-		/// @param[in]		margin	
-		/// @param[in]		value	l
-		/// @return         tH[}bgꂽ
+		/// @brief			整数値を10進数文字列へ変換 ※インライン関数
+		/// @detail			左側を桁数で0埋めした文字列を構築する
+		/// @param[in]		margin	桁数
+		/// @param[in]		value	整数値
+		/// @return         フォーマットされた文字列
 		////////////////////////////////////////////////////////////////////////////////
 		inline std::string Format(unsigned long margin, unsigned long value)
 		{
@@ -93,11 +93,11 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			l16i֕ϊ CC֐
-		/// @detail			0߂\z
-		/// @param[in]		margin	
-		/// @param[in]		value	l
-		/// @return         tH[}bgꂽ
+		/// @brief			整数値を16進数文字列へ変換 ※インライン関数
+		/// @detail			左側を桁数で0埋めした文字列を構築する
+		/// @param[in]		margin	桁数
+		/// @param[in]		value	整数値
+		/// @return         フォーマットされた文字列
 		////////////////////////////////////////////////////////////////////////////////
 		inline std::string FormatX(int margin, int value, std::string header = "0x")
 		{
@@ -109,11 +109,11 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			l𕶎֕ϊ CC֐
-		/// @detail			_ȉ̌\z
-		/// @param[in]		decimal	
-		/// @param[in]		value	l
-		/// @return         tH[}bgꂽ
+		/// @brief			実数値を文字列へ変換 ※インライン関数
+		/// @detail			小数点以下の桁数だけ揃えた文字列を構築する
+		/// @param[in]		decimal	桁数
+		/// @param[in]		value	実数値
+		/// @return         フォーマットされた文字列
 		////////////////////////////////////////////////////////////////////////////////
 		inline std::string Format(int decimal, double value)
 		{
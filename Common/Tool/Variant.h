@@ -9,10 +9,10 @@ namespace Standard
 	namespace Variant
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ľ^vĂ邩mF
-		/// @param[in]		TValue	ľ^(ev[gŎw)
-		/// @param[in]		value	l
-		/// @return			true:v / false:sv
+		/// @brief			値の型が一致しているか確認
+		/// @param[in]		TValue	値の型(テンプレートで指定)
+		/// @param[in]		value	値
+		/// @return			true:一致 / false:不一致
 		////////////////////////////////////////////////////////////////////////////////
 		template <typename TValue>
 		inline bool IsValue(const boost::any& value)
@@ -21,21 +21,21 @@ namespace Standard
 
 			do
 			{
-				// l̋mF
+				// 値の空を確認
 				if (value.empty())
 				{
-					// 
+					// 空
 					break;
 				}
 
-				// ^mF
+				// 型を確認
 				if (value.type() != typeid(TValue))
 				{
-					// sv
+					// 不一致
 					break;
 				}
 
-				// v
+				// 一致
 				ret = true;
 			} while (false);
 
@@ -43,9 +43,9 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			int^vĂ邩mF
-		/// @param[in]		value	l
-		/// @return			true:v / false:sv
+		/// @brief			int型が一致しているか確認
+		/// @param[in]		value	値
+		/// @return			true:一致 / false:不一致
 		////////////////////////////////////////////////////////////////////////////////
 		inline bool IsIntValue(const boost::any& value)
 		{
@@ -53,26 +53,26 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			lϊ
-		/// @param[in]		TValue	ľ^(ev[gŎw)
-		/// @param[in]		value	l
-		/// @return			ϊl
+		/// @brief			値を変換
+		/// @param[in]		TValue	値の型(テンプレートで指定)
+		/// @param[in]		value	値
+		/// @return			変換した値
 		////////////////////////////////////////////////////////////////////////////////
 		template <typename TValue>
 		inline TValue Convert(const boost::any& value)
 		{
 			TValue ret;
 
-			// ϊ
+			// 変換
 			ret = boost::any_cast<TValue>(value);
 
 			return ret;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			lint^֕ϊ
-		/// @param[in]		value	l
-		/// @return			int^ɕϊꂽl
+		/// @brief			値をint型へ変換
+		/// @param[in]		value	値
+		/// @return			int型に変換された値
 		////////////////////////////////////////////////////////////////////////////////
 		inline int ConvertInt(const boost::any& value)
 		{
@@ -80,10 +80,10 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ľ^vĂ邩mF
-		/// @param[in]		source	r
-		/// @param[in]		destination	r
-		/// @return			true:v / false:sv
+		/// @brief			値の型が一致しているか確認
+		/// @param[in]		source	比較元
+		/// @param[in]		destination	比較先
+		/// @return			true:一致 / false:不一致
 		////////////////////////////////////////////////////////////////////////////////
 		inline bool Equal(const boost::any& source, const boost::any& destination)
 		{
@@ -91,85 +91,85 @@ namespace Standard
 
 			do
 			{
-				// l̋mF
+				// 値の空を確認
 				if (source.empty() || destination.empty())
 				{
-					// 
+					// 空
 					std::stringstream message;
-					message << "f[^";
-					message << Logging::ConstSeparator << "r:" << (source.empty() ? "" : source.type().name());
-					message << Logging::ConstSeparator << "r:" << (destination.empty() ? "" : destination.type().name());
+					message << "データが空";
+					message << Logging::ConstSeparator << "比較元:" << (source.empty() ? "" : source.type().name());
+					message << Logging::ConstSeparator << "比較先:" << (destination.empty() ? "" : destination.type().name());
 					throw std::exception(message.str().c_str());
 				}
 
-				// ľ^mF
+				// 値の型を確認
 				if (source.type() != destination.type())
 				{
-					// ^Ⴄ
+					// 型が違う
 					std::stringstream message;
-					message << "f[^̌^sv";
-					message << Logging::ConstSeparator << "r:" << source.type().name();
-					message << Logging::ConstSeparator << "r:" << destination.type().name();
+					message << "データの型が不一致";
+					message << Logging::ConstSeparator << "比較元:" << source.type().name();
+					message << Logging::ConstSeparator << "比較先:" << destination.type().name();
 					throw std::exception(message.str().c_str());
 				}
 
-				// ^mF
+				// 型を確認
 				if (source.type() == typeid(bool))
 				{
-					// rbg^  lr
+					// ビット型 ⇒ 値を比較
 					if (Convert<bool>(source) != Convert<bool>(destination))
 					{
-						// sv
+						// 不一致
 						break;
 					}
 				}
 				else if (source.type() == typeid(__int16))
 				{
-					// (2oCg)^  lr
+					// 整数(2バイト)型 ⇒ 値を比較
 					if (Convert<__int16>(source) != Convert<__int16>(destination))
 					{
-						// sv
+						// 不一致
 						break;
 					}
 				}
 				else if (source.type() == typeid(__int32))
 				{
-					// (4oCg)^  lr
+					// 整数(4バイト)型 ⇒ 値を比較
 					if (Convert<__int32>(source) != Convert<__int32>(destination))
 					{
-						// sv
+						// 不一致
 						break;
 					}
 				}
 				else if (source.type() == typeid(__int64))
 				{
-					// (8oCg)^  lr
+					// 整数(8バイト)型 ⇒ 値を比較
 					if (Convert<__int64>(source) != Convert<__int64>(destination))
 					{
-						// sv
+						// 不一致
 						break;
 					}
 				}
 				else if (source.type() == typeid(float))
 				{
-					// Px_^  lr
+					// 単精度浮動小数点実数型 ⇒ 値を比較
 					if (Convert<float>(source) != Convert<float>(destination))
 					{
-						// sv
+						// 不一致
 						break;
 					}
 				}
 				else if (source.type() == typeid(double))
 				{
-					// {x_^  lr
+					// 倍精度浮動小数点実数型 ⇒ 値を比較
 					if (Convert<double>(source) != Convert<double>(destination))
 					{
-						// sv
+						// 不一致
 						break;
 					}
 				}
 
-				// v
+				// 一致
 				ret = true;
 			} while (false);
 
@@ -177,90 +177,90 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ľ^𕶎֕ϊ
-		/// @param[in]		value	l
-		/// @return			ɕϊꂽľ^
+		/// @brief			値の型を文字列へ変換
+		/// @param[in]		value	値
+		/// @return			文字列に変換された値の型
 		////////////////////////////////////////////////////////////////////////////////
 		inline std::string FormatType(const boost::any& value)
 		{
 			std::stringstream ret;
 
-			// ^mF
+			// 型を確認
 			if (value.type() == typeid(bool))
 			{
-				ret << "rbg";
+				ret << "ビット";
 			}
 			else if (value.type() == typeid(__int16))
 			{
-				ret << "(2oCg)";
+				ret << "整数(2バイト)";
 			}
 			else if (value.type() == typeid(__int32))
 			{
-				ret << "(4oCg)";
+				ret << "整数(4バイト)";
 			}
 			else if (value.type() == typeid(__int64))
 			{
-				ret << "(8oCg)";
+				ret << "整数(8バイト)";
 			}
 			else if (value.type() == typeid(float))
 			{
-				ret << "Px_";
+				ret << "単精度浮動小数点実数";
 			}
 			else if (value.type() == typeid(double))
 			{
-				ret << "{x_";
+				ret << "倍精度浮動小数点実数";
 			}
 			else
 			{
-				ret << "Ή(" << value.type().name() << ")";
+				ret << "未対応(" << value.type().name() << ")";
 			}
 
 			return ret.str();
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			l𕶎֕ϊ
-		/// @param[in]		value	l
-		/// @return			ɕϊꂽl
+		/// @brief			値を文字列へ変換
+		/// @param[in]		value	値
+		/// @return			文字列に変換された値
 		////////////////////////////////////////////////////////////////////////////////
 		inline std::string FormatValue(const boost::any& value)
 		{
 			std::stringstream ret;
 
-			// ^mF
+			// 型を確認
 			if (value.type() == typeid(bool))
 			{
-				// rbg
+				// ビット
 				ret << Variant::Convert<bool>(value);
 			}
 			else if (value.type() == typeid(__int16))
 			{
-				// (2oCg)
+				// 整数(2バイト)
 				ret << Variant::Convert<__int16>(value);
 			}
 			else if (value.type() == typeid(__int32))
 			{
-				// (4oCg)
+				// 整数(4バイト)
 				ret << Variant::Convert<__int32>(value);
 			}
 			else if (value.type() == typeid(__int64))
 			{
-				// (8oCg)
+				// 整数(8バイト)
 				ret << Variant::Convert<__int64>(value);
 			}
 			else if (value.type() == typeid(float))
 			{
-				// Px_
+				// 単精度浮動小数点実数
 				ret << Variant::Convert<float>(value);
 			}
 			else if (value.type() == typeid(double))
 			{
-				// {x_
+				// 倍精度浮動小数点実数
 				ret << Variant::Convert<double>(value);
 			}
 			else
 			{
-				ret << "Ή(" << value.type().name() << ")";
+				ret << "未対応(" << value.type().name() << ")";
 				throw std::exception(ret.str().c_str());
 			}
 
@@ -0,0 +1,685 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/Logging/Basis.h"
+#include "Common/Tool/Text.h"
+
+namespace Standard
+{
+	namespace Transfer
+	{
+		// バイナリ形式
+		namespace Binary
+		{
+			//! 先頭の識別子 ※テキストの先頭は年の数字のため、NULで始めて区別する
+			const char ConstMagic[] = { 0x00, 'S', 'T', 'B' };
+
+			//! 形式の版 ※2:上限を超えるログの分割に対応
+			const unsigned char ConstVersion = 2;
+
+			//! レベルのフラグ(断片) ⇒ 上限を超えるログを分割した断片で、項目は分割前のメッセージの一部
+			const unsigned char ConstFragment = 0x80;
+
+			//! レベルのフラグ(続きあり) ⇒ 次のデータグラムに続きの断片がある
+			const unsigned char ConstContinued = 0x40;
+
+			//! レベルのフラグを除くマスク
+			const unsigned char ConstLevelMask = 0x3F;
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @enum			項目の種類
+			/// @detail			項目の先頭の可変長整数の下位2bitに格納し、残りのbitは種類ごとの値
+			////////////////////////////////////////////////////////////////////////////////
+			enum EnumField
+			{
+				FieldReference,		// 登録済みの文字列 ※値は文字列の番号
+				FieldDefinition,	// 文字列を登録 ※値は文字列の長さで、文字列が続く
+				FieldInteger		// 整数 ※値は符号をZigZagで変換した整数
+			};
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			可変長整数を追加 ※インライン関数
+			/// @detail			下位から7bitずつ格納し、続きがある場合は最上位bitを立てる
+			/// @param[in,out]	buffer	追加先
+			/// @param[in]		value	整数
+			////////////////////////////////////////////////////////////////////////////////
+			inline void PutVarint(std::string& buffer, uint64_t value)
+			{
+				while (0x80 <= value)
+				{
+					buffer.push_back((char)((value & 0x7F) | 0x80));
+					value >>= 7;
+				}
+
+				buffer.push_back((char)value);
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			可変長整数を取得 ※インライン関数
+			/// @param[in,out]	data	読み込む位置 ※読み込んだ分だけ進める
+			/// @param[in]		end	終端
+			/// @param[out]		value	整数
+			/// @return			true:取得 / false:データが不正
+			////////////////////////////////////////////////////////////////////////////////
+			inline bool GetVarint(const char*& data, const char* end, uint64_t& value)
+			{
+				bool ret = false;
+
+				value = 0;
+
+				// 最大で10byteまで走査
+				for (int shift = 0; data < end && shift < 64; shift += 7)
+				{
+					unsigned char byte = (unsigned char)*data++;
+
+					value |= (uint64_t)(byte & 0x7F) << shift;
+
+					if ((byte & 0x80) == 0)
+					{
+						ret = true;
+						break;
+					}
+				}
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			符号付きの整数を符号なしに変換 ※インライン関数
+			/// @detail			絶対値が小さい負の値も可変長整数で短くなるように変換する
+			/// @param[in]		value	符号付きの整数
+			/// @return			符号なしの整数
+			////////////////////////////////////////////////////////////////////////////////
+			inline uint64_t ZigZag(int64_t value)
+			{
+				return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			符号なしの整数を符号付きに戻す ※インライン関数
+			/// @param[in]		value	符号なしの整数
+			/// @return			符号付きの整数
+			////////////////////////////////////////////////////////////////////////////////
+			inline int64_t UnZigZag(uint64_t value)
+			{
+				return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			整数の文字列か確認 ※インライン関数
+			/// @detail			整数に変換して同じ文字列に戻せる場合だけ整数とする ※0埋めなどは文字列
+			/// @param[in]		value	文字列
+			/// @param[out]		number	整数
+			/// @return			true:整数 / false:文字列
+			////////////////////////////////////////////////////////////////////////////////
+			inline bool IsInteger(const std::string& value, int64_t& number)
+			{
+				bool ret = false;
+
+				do
+				{
+					size_t offset = (value.empty() == false && value.front() == '-') ? 1 : 0;
+					size_t digits = value.size() - offset;
+
+					// 桁数を確認 ⇒ 18桁までは桁あふれしない
+					if (digits == 0 || 18 < digits)
+					{
+						break;
+					}
+
+					// 先頭の0を確認 ⇒ "0"以外は文字列
+					if (value.at(offset) == '0' && (1 < digits || offset == 1))
+					{
+						break;
+					}
+
+					number = 0;
+
+					// 桁だけ走査
+					for (size_t index = offset; index < value.size(); index++)
+					{
+						if (value.at(index) < '0' || '9' < value.at(index))
+						{
+							break;
+						}
+
+						number = number * 10 + (value.at(index) - '0');
+
+						ret = (index + 1 == value.size());
+					}
+
+					if (offset == 1)
+					{
+						number = -number;
+					}
+				} while (false);
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			ログを1行の文字列に変換 ※インライン関数
+			/// @detail			先頭に年月日 時分秒を付加する ※テキスト形式と同じ並び
+			/// @param[in]		time	現地時刻(1601/1/1からのミリ秒)
+			/// @param[in]		level	ログのレベル
+			/// @param[in]		message	ログのメッセージ
+			/// @return			文字列 ※終端コードは含まない
+			////////////////////////////////////////////////////////////////////////////////
+			inline std::string Line(uint64_t time, int level, const std::string& message)
+			{
+				std::stringstream ret;
+
+				ULARGE_INTEGER ticks;
+				FILETIME local;
+				SYSTEMTIME value;
+
+				// ミリ秒 ⇒ 100ナノ秒
+				ticks.QuadPart = time * 10000;
+				local.dwLowDateTime = ticks.LowPart;
+				local.dwHighDateTime = ticks.HighPart;
+
+				::FileTimeToSystemTime(&local, &value);
+
+				// 年
+				ret << Text::Format(4, value.wYear);
+				// 月
+				ret << "-" << Text::Format(2, value.wMonth);
+				// 日
+				ret << "-" << Text::Format(2, value.wDay);
+				// 時
+				ret << "/" << Text::Format(2, value.wHour);
+				// 分
+				ret << ":" << Text::Format(2, value.wMinute);
+				// 秒
+				ret << ":" << Text::Format(2, value.wSecond);
+				// ミリ秒
+				ret << "." << Text::Format(3, value.wMilliseconds);
+
+				// レベル
+				ret << Logging::ConstSeparator << level;
+
+				// メッセージ
+				ret << Logging::ConstSeparator << message;
+
+				return ret.str();
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CEncoder
+			/// @brief      ログをバイナリ形式のデータグラムに詰めるクラス
+			/// @detail		先頭:識別子・版・基準の時刻
+			///				ログ:前のログとの時刻の差・レベル・項目数・項目
+			///				メッセージは区切り文字で項目に分け、同じ文字列は2回目から番号で参照する
+			///				文字列の番号はデータグラムごとに振り直す ⇒ データグラムが欠けても他は復元可能
+			///				空のデータグラムにも入らないログはSplit()で断片に分割し、1つずつデータグラムにする
+			////////////////////////////////////////////////////////////////////////////////
+			class CEncoder
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				/// @param[in]		limit	データグラムの上限[byte]
+				////////////////////////////////////////////////////////////////////////////////
+				CEncoder(size_t limit)
+				{
+					m_limit = limit;
+
+					// 初期化
+					Clear();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			初期化
+				/// @detail			詰めたログと登録した文字列を破棄する
+				////////////////////////////////////////////////////////////////////////////////
+				void Clear()
+				{
+					m_buffer.clear();
+					m_strings.clear();
+					m_time = 0;
+					m_count = 0;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			ログを追加
+				/// @detail			上限を超える場合は追加しない ※空の場合も追加しないため、Split()で分割する
+				/// @param[in]		time	現地時刻(1601/1/1からのミリ秒)
+				/// @param[in]		level	ログのレベル
+				/// @param[in]		message	ログのメッセージ
+				/// @return			true:追加 / false:上限のため未追加
+				////////////////////////////////////////////////////////////////////////////////
+				bool Append(uint64_t time, int level, const std::string& message)
+				{
+					bool ret = true;
+
+					// 先頭を確認
+					if (m_count == 0)
+					{
+						m_buffer.assign(ConstMagic, sizeof(ConstMagic));
+						m_buffer.push_back((char)ConstVersion);
+						PutVarint(m_buffer, time);
+						m_time = time;
+					}
+
+					size_t size = m_buffer.size();
+					std::vector<std::string> added;
+					std::vector<std::string> fields;
+
+					// 区切り文字で分割 ⇒ 連続した区切り文字は空の項目
+					size_t last = 0;
+					size_t position = 0;
+
+					while ((position = message.find(Logging::ConstSeparator, last)) != std::string::npos)
+					{
+						fields.push_back(message.substr(last, position - last));
+						last = position + 1;
+					}
+					fields.push_back(message.substr(last));
+
+					// 時刻の差・レベル・項目数
+					PutVarint(m_buffer, ZigZag((int64_t)(time - m_time)));
+					m_buffer.push_back((char)level);
+					PutVarint(m_buffer, fields.size());
+
+					// 項目だけ走査
+					for (auto& field : fields)
+					{
+						int64_t number = 0;
+
+						if (IsInteger(field, number))
+						{
+							// 整数
+							PutVarint(m_buffer, (ZigZag(number) << 2) | FieldInteger);
+							continue;
+						}
+
+						auto string = m_strings.find(field);
+
+						if (string != m_strings.end())
+						{
+							// 登録済みの文字列
+							PutVarint(m_buffer, (string->second << 2) | FieldReference);
+							continue;
+						}
+
+						// 文字列を登録
+						PutVarint(m_buffer, ((uint64_t)field.size() << 2) | FieldDefinition);
+						m_buffer.append(field);
+
+						m_strings.emplace(field, (uint64_t)m_strings.size());
+						added.push_back(field);
+					}
+
+					// 上限を確認
+					if (m_limit < m_buffer.size())
+					{
+						// 上限を超えた ⇒ 追加した分を戻す
+						m_buffer.resize(size);
+
+						for (auto& field : added)
+						{
+							m_strings.erase(field);
+						}
+
+						if (m_count == 0)
+						{
+							// 先頭も戻す
+							m_buffer.clear();
+						}
+
+						ret = false;
+					}
+					else
+					{
+						m_time = time;
+						m_count++;
+					}
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			ログを断片に分割
+				/// @detail			空のデータグラムにも入らないログを上限ごとの断片に分割して、1つずつデータグラムにする
+				///					メッセージは区切り文字で項目に分けず、そのまま分割する ※復元する側で連結
+				///					詰めたログと登録した文字列は変更しない
+				/// @param[in]		time	現地時刻(1601/1/1からのミリ秒)
+				/// @param[in]		level	ログのレベル
+				/// @param[in]		message	ログのメッセージ
+				/// @return			断片ごとのデータグラム
+				////////////////////////////////////////////////////////////////////////////////
+				std::vector<std::string> Split(uint64_t time, int level, const std::string& message) const
+				{
+					std::vector<std::string> ret;
+
+					std::string head(ConstMagic, sizeof(ConstMagic));
+
+					// 識別子・版・基準の時刻
+					head.push_back((char)ConstVersion);
+					PutVarint(head, time);
+
+					// 時刻の差・レベル・項目数・項目の先頭の最大 ⇒ 1byte・1byte・1byte・3byte
+					size_t overhead = head.size() + 6;
+					size_t room = (overhead < m_limit) ? m_limit - overhead : 1;
+
+					size_t offset = 0;
+
+					do
+					{
+						size_t length = (std::min)(room, message.size() - offset);
+						unsigned char flag = ConstFragment;
+
+						if (offset + length < message.size())
+						{
+							// 続きあり
+							flag |= ConstContinued;
+						}
+
+						std::string buffer = head;
+
+						// 時刻の差・レベル・項目数
+						PutVarint(buffer, ZigZag(0));
+						buffer.push_back((char)((level & ConstLevelMask) | flag));
+						PutVarint(buffer, 1);
+
+						// 断片 ⇒ 文字列を登録するが、番号は参照しない
+						PutVarint(buffer, ((uint64_t)length << 2) | FieldDefinition);
+						buffer.append(message, offset, length);
+
+						ret.push_back(std::move(buffer));
+
+						offset += length;
+					} while (offset < message.size());
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			詰めたログを取得
+				/// @return			データグラム
+				////////////////////////////////////////////////////////////////////////////////
+				const std::string& Get() const
+				{
+					return m_buffer;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			詰めたログの数を取得
+				/// @return			ログの数
+				////////////////////////////////////////////////////////////////////////////////
+				size_t GetCount() const
+				{
+					return m_count;
+				}
+
+			private:
+				//! データグラムの上限[byte]
+				size_t m_limit;
+
+				//! データグラム
+				std::string m_buffer;
+
+				//! 登録した文字列と番号
+				std::unordered_map<std::string, uint64_t> m_strings;
+
+				//! 前のログの時刻
+				uint64_t m_time;
+
+				//! 詰めたログの数
+				size_t m_count;
+			};
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			バイナリ形式のデータグラムか確認 ※インライン関数
+			/// @param[in]		data	データグラム
+			/// @param[in]		size	データグラムのサイズ
+			/// @return			true:バイナリ形式 / false:テキスト形式など
+			////////////////////////////////////////////////////////////////////////////////
+			inline bool IsBinary(const char* data, size_t size)
+			{
+				return sizeof(ConstMagic) < size && std::equal(ConstMagic, ConstMagic + sizeof(ConstMagic), data);
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CDecoder
+			/// @brief      バイナリ形式のデータグラムを1行ずつの文字列に変換するクラス
+			/// @detail		テキスト形式と同じ行を復元する ※終端コードは含まない
+			///				分割したログの断片は続きのデータグラムまで保持して、最後の断片で連結する
+			///				断片が欠けた場合は、次の断片でないログの前に保持した分を出力する
+			////////////////////////////////////////////////////////////////////////////////
+			class CDecoder
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CDecoder()
+				{
+					m_pending = false;
+					m_time = 0;
+					m_level = 0;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			データグラムを変換
+				/// @param[in]		data	データグラム
+				/// @param[in]		size	データグラムのサイズ
+				/// @param[out]		lines	ログごとの文字列 ※末尾に追加
+				/// @return			true:変換 / false:データが不正 ※不正な位置の前までは変換済み
+				////////////////////////////////////////////////////////////////////////////////
+				bool Decode(const char* data, size_t size, std::vector<std::string>& lines)
+				{
+					bool ret = false;
+
+					const char* end = data + size;
+					std::vector<std::string> strings;
+					uint64_t time = 0;
+
+					do
+					{
+						// 識別子と版を確認 ⇒ 古い版も復元可能
+						if (IsBinary(data, size) == false || (unsigned char)data[sizeof(ConstMagic)] == 0 || ConstVersion < (unsigned char)data[sizeof(ConstMagic)])
+						{
+							break;
+						}
+
+						data += sizeof(ConstMagic) + 1;
+
+						// 基準の時刻
+						if (GetVarint(data, end, time) == false)
+						{
+							break;
+						}
+
+						ret = true;
+
+						// ログだけ走査
+						while (ret && data < end)
+						{
+							uint64_t delta = 0;
+							uint64_t count = 0;
+
+							ret = false;
+
+							if (GetVarint(data, end, delta) == false || end <= data)
+							{
+								break;
+							}
+
+							time += (uint64_t)UnZigZag(delta);
+
+							int level = (unsigned char)*data++;
+
+							if (GetVarint(data, end, count) == false)
+							{
+								break;
+							}
+
+							std::stringstream message;
+							uint64_t index = 0;
+
+							// 項目だけ走査
+							for (; index < count; index++)
+							{
+								uint64_t head = 0;
+
+								if (GetVarint(data, end, head) == false)
+								{
+									break;
+								}
+
+								if (0 < index)
+								{
+									message << Logging::ConstSeparator;
+								}
+
+								uint64_t value = head >> 2;
+
+								switch (head & 0x03)
+								{
+								case FieldReference:
+									if (strings.size() <= value)
+									{
+										// 未登録の番号
+										index = count + 1;
+										break;
+									}
+									message << strings.at((size_t)value);
+									break;
+
+								case FieldDefinition:
+									if ((uint64_t)(end - data) < value)
+									{
+										// 文字列が途中で終わっている
+										index = count + 1;
+										break;
+									}
+									strings.emplace_back(data, (size_t)value);
+									data += value;
+									message << strings.back();
+									break;
+
+								case FieldInteger:
+									message << UnZigZag(value);
+									break;
+
+								default:
+									// 未対応の種類
+									index = count + 1;
+									break;
+								}
+							}
+
+							if (index != count)
+							{
+								break;
+							}
+
+							// ログを追加
+							Push(time, level, message.str(), lines);
+
+							ret = true;
+						}
+					} while (false);
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			保持した断片を出力
+				/// @detail			最後の断片が届かなかったログを、届いた分だけ出力する
+				/// @param[out]		lines	ログごとの文字列 ※末尾に追加
+				////////////////////////////////////////////////////////////////////////////////
+				void Flush(std::vector<std::string>& lines)
+				{
+					if (m_pending)
+					{
+						lines.push_back(Line(m_time, m_level, m_message));
+
+						m_pending = false;
+						m_message.clear();
+					}
+				}
+
+			private:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			ログを追加
+				/// @detail			断片は最後の断片まで連結して、1行にする
+				/// @param[in]		time	現地時刻(1601/1/1からのミリ秒)
+				/// @param[in]		level	ログのレベル ※フラグを含む
+				/// @param[in]		message	ログのメッセージ
+				/// @param[out]		lines	ログごとの文字列 ※末尾に追加
+				////////////////////////////////////////////////////////////////////////////////
+				void Push(uint64_t time, int level, const std::string& message, std::vector<std::string>& lines)
+				{
+					if ((level & ConstFragment) == 0)
+					{
+						// 断片でない ⇒ 保持した断片を出力
+						Flush(lines);
+
+						lines.push_back(Line(time, level, message));
+						return;
+					}
+
+					if (m_pending == false)
+					{
+						// 最初の断片
+						m_pending = true;
+						m_time = time;
+						m_level = level & ConstLevelMask;
+					}
+
+					m_message += message;
+
+					if ((level & ConstContinued) == 0)
+					{
+						// 最後の断片
+						Flush(lines);
+					}
+				}
+
+			private:
+				//! 断片を保持中
+				bool m_pending;
+
+				//! 保持した断片の時刻
+				uint64_t m_time;
+
+				//! 保持した断片のレベル
+				int m_level;
+
+				//! 保持した断片のメッセージ
+				std::string m_message;
+			};
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			バイナリ形式のデータグラムを1行ずつの文字列に変換 ※インライン関数
+			/// @detail			テキスト形式と同じ行を復元する ※終端コードは含まない
+			///					データグラムを跨ぐ断片は連結しないため、連結する場合はCDecoderを使う
+			/// @param[in]		data	データグラム
+			/// @param[in]		size	データグラムのサイズ
+			/// @param[out]		lines	ログごとの文字列 ※末尾に追加
+			/// @return			true:変換 / false:データが不正 ※不正な位置の前までは変換済み
+			////////////////////////////////////////////////////////////////////////////////
+			inline bool Decode(const char* data, size_t size, std::vector<std::string>& lines)
+			{
+				bool ret = false;
+
+				CDecoder decoder;
+
+				ret = decoder.Decode(data, size, lines);
+
+				// 断片は届いた分だけ出力
+				decoder.Flush(lines);
+
+				return ret;
+			}
+		}
+	}
+}
\ No newline at end of file
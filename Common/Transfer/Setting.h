@@ -8,37 +8,63 @@ namespace Standard
 	{
 		namespace Setting
 		{
+			////////////////////////////////////////////////////////////////////////////////
+			/// @enum			転送する形式
+			////////////////////////////////////////////////////////////////////////////////
+			enum EnumFormat
+			{
+				FormatText,			// テキスト形式 ※UTF-8に変換して終端コードで区切る
+				FormatBinary		// バイナリ形式 ※TransferDecoderで復元
+			};
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @enum			転送する先 ※組み合わせ可能
+			////////////////////////////////////////////////////////////////////////////////
+			enum EnumSink
+			{
+				SinkUdp = 0x01,		// UDP
+				SinkFile = 0x02,	// ファイル ※TransferDecoderで復元
+				SinkBoth = 0x03		// UDPとファイル
+			};
+
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CObject
-			/// @brief      ]sݒNX
+			/// @brief      転送を行う設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CObject
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CObject()
 				{
 					IpAddress = "127.0.0.1";
 					Port = 50001;
 					Lower = Logging::LevelInfomation;
+					Format = FormatText;
+					Sink = SinkUdp;
+					Directory = "Log";
+					SegmentSize = 16 * 1024 * 1024;
+					SegmentPeriod = 60;
+					SegmentCount = 64;
+					MetricsPeriod = 0;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CObject& operator = (const CObject& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CObject()
 				{
@@ -47,25 +73,53 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CObject& object)
 				{
 					this->IpAddress = object.IpAddress;
 					this->Port = object.Port;
 					this->Lower = object.Lower;
+					this->Format = object.Format;
+					this->Sink = object.Sink;
+					this->Directory = object.Directory;
+					this->SegmentSize = object.SegmentSize;
+					this->SegmentPeriod = object.SegmentPeriod;
+					this->SegmentCount = object.SegmentCount;
+					this->MetricsPeriod = object.MetricsPeriod;
 				}
 
 			public:
-				//! ]IPAhX
+				//! 転送先のIPアドレス
 				std::string IpAddress;
 
-				//! ]̃|[g
+				//! 転送先のポート
 				unsigned short Port;
 
-				//! o͂鉺x
+				//! 出力する下限レベル
 				Logging::EnumLevel Lower;
+
+				//! 転送する形式
+				EnumFormat Format;
+
+				//! 転送する先
+				EnumSink Sink;
+
+				//! ファイルを作成するフォルダ ※存在しない場合は作成
+				std::string Directory;
+
+				//! ファイルのサイズ[byte] ※作成時に確保して、超える場合は次のファイルへ切り替え
+				size_t SegmentSize;
+
+				//! ファイルを切り替える周期[分] ※0:サイズだけで切り替え
+				int SegmentPeriod;
+
+				//! 保持するファイルの数 ※超える場合は古いファイルから削除、0:削除しない
+				int SegmentCount;
+
+				//! 処理時間の分布を出力する周期[秒] ※0:出力しない
+				int MetricsPeriod;
 			};
 		}
 	}
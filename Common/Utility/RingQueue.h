@@ -0,0 +1,315 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Standard
+{
+	namespace Utility
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CRingQueue
+		/// @brief      排他制御なしで複数スレッドから追加できるリングバッファのクラス
+		///	@detail		追加は複数スレッドから、取り出しは単一スレッドから行う
+		///				容量は2のべき乗に切り上げ、生成時に要素を確保する
+		///				データの代入で例外が発生した場合は無効な要素として公開し、取り出し時に読み飛ばす
+		/// @param[in]	CData	保持するデータのクラス(テンプレートで指定)
+		////////////////////////////////////////////////////////////////////////////////
+		template <typename CData>
+		class CRingQueue
+		{
+		private:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @struct     CCell
+			/// @brief      リングバッファの要素
+			////////////////////////////////////////////////////////////////////////////////
+			struct CCell
+			{
+				//! 要素の通番
+				std::atomic<size_t> Sequence;
+
+				//! データが有効か ※代入で例外が発生した場合は無効
+				bool Valid;
+
+				//! データ
+				CData Data;
+			};
+
+		public:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			コンストラクタ
+			/// @param[in]		capacity	容量
+			////////////////////////////////////////////////////////////////////////////////
+			CRingQueue(size_t capacity)
+			{
+				size_t size = 2;
+
+				// 容量を2のべき乗に切り上げ
+				while (size < capacity)
+				{
+					size <<= 1;
+				}
+
+				m_cells.reset(new CCell[size]);
+				m_mask = size - 1;
+
+				// 要素の通番を初期化
+				for (size_t index = 0; index < size; index++)
+				{
+					m_cells[index].Sequence.store(index, std::memory_order_relaxed);
+					m_cells[index].Valid = false;
+				}
+
+				m_head.store(0, std::memory_order_relaxed);
+				m_tail.store(0, std::memory_order_relaxed);
+				m_highWatermark.store(0, std::memory_order_relaxed);
+				m_rejected.store(0, std::memory_order_relaxed);
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			コピー代入演算子
+			/// @detail			※無効にする
+			////////////////////////////////////////////////////////////////////////////////
+			CRingQueue& operator = (const CRingQueue& object) = delete;
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			デストラクタ
+			////////////////////////////////////////////////////////////////////////////////
+			~CRingQueue()
+			{
+
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			データを追加
+			/// @detail			複数スレッドから呼び出し可能
+			///					右辺値の場合はデータを移動する
+			///					データの代入で例外が発生した場合は確保した位置を無効にして公開し、例外を再送する
+			/// @param[in]		object	データ
+			/// @return			true:追加 / false:容量の上限
+			////////////////////////////////////////////////////////////////////////////////
+			template <typename CObject>
+			bool Push(CObject&& object)
+			{
+				bool ret = false;
+
+				size_t position = m_tail.load(std::memory_order_relaxed);
+				CCell* cell = nullptr;
+
+				while (true)
+				{
+					cell = &m_cells[position & m_mask];
+
+					// 要素の通番と追加する位置の差を確認
+					size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+					std::ptrdiff_t difference = (std::ptrdiff_t)sequence - (std::ptrdiff_t)position;
+
+					if (difference == 0)
+					{
+						// 空き ⇒ 追加する位置を確保
+						if (m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						{
+							ret = true;
+							break;
+						}
+					}
+					else if (difference < 0)
+					{
+						// 容量の上限
+						break;
+					}
+					else
+					{
+						// 他のスレッドが追加済み ⇒ 追加する位置を取得し直す
+						position = m_tail.load(std::memory_order_relaxed);
+					}
+				}
+
+				if (ret)
+				{
+					try
+					{
+						// データを更新
+						cell->Data = std::forward<CObject>(object);
+						cell->Valid = true;
+					}
+					catch (...)
+					{
+						// 無効として取り出し可能に更新 ⇒ 確保した位置で後続の要素が止まらないようにする
+						cell->Valid = false;
+						cell->Sequence.store(position + 1, std::memory_order_release);
+
+						// 追加できなかった数を更新
+						m_rejected.fetch_add(1, std::memory_order_relaxed);
+
+						throw;
+					}
+
+					// 取り出し可能に更新
+					cell->Sequence.store(position + 1, std::memory_order_release);
+
+					size_t head = m_head.load(std::memory_order_relaxed);
+
+					// 最大の保持数を更新
+					if (head < position + 1)
+					{
+						UpdateHighWatermark(position + 1 - head);
+					}
+				}
+				else
+				{
+					// 追加できなかった数を更新
+					m_rejected.fetch_add(1, std::memory_order_relaxed);
+				}
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			データを取り出し
+			/// @detail			単一のスレッドから呼び出す
+			///					無効な要素は読み飛ばす
+			/// @param[out]		object	データ
+			/// @return			true:取り出し / false:データなし
+			////////////////////////////////////////////////////////////////////////////////
+			bool Pop(CData& object)
+			{
+				bool ret = false;
+
+				while (ret == false)
+				{
+					size_t position = m_head.load(std::memory_order_relaxed);
+					CCell* cell = &m_cells[position & m_mask];
+
+					// 要素の通番を確認
+					if (cell->Sequence.load(std::memory_order_acquire) != position + 1)
+					{
+						// データなし
+						break;
+					}
+
+					if (cell->Valid)
+					{
+						// データを移動
+						object = std::move(cell->Data);
+
+						ret = true;
+					}
+
+					// 追加可能に更新
+					cell->Sequence.store(position + m_mask + 1, std::memory_order_release);
+					m_head.store(position + 1, std::memory_order_release);
+				}
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			データをまとめて取り出し
+			/// @detail			単一のスレッドから呼び出す
+			///					取り出したデータは末尾に追加する
+			/// @param[out]		objects	データ
+			/// @return			取り出した数
+			////////////////////////////////////////////////////////////////////////////////
+			size_t Drain(std::vector<CData>& objects)
+			{
+				size_t ret = 0;
+
+				CData object;
+
+				// データなしまで取り出し
+				while (Pop(object))
+				{
+					objects.emplace_back(std::move(object));
+					ret += 1;
+				}
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			保持数を取得
+			/// @detail			他のスレッドが追加中の場合は概算
+			/// @return			保持数
+			////////////////////////////////////////////////////////////////////////////////
+			size_t GetDepth() const
+			{
+				size_t ret = 0;
+
+				size_t head = m_head.load(std::memory_order_acquire);
+				size_t tail = m_tail.load(std::memory_order_acquire);
+
+				if (head < tail)
+				{
+					ret = tail - head;
+				}
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			最大の保持数を取得
+			/// @return			最大の保持数
+			////////////////////////////////////////////////////////////////////////////////
+			size_t GetHighWatermark() const
+			{
+				return m_highWatermark.load(std::memory_order_relaxed);
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			容量の上限で追加できなかった数を取得
+			/// @return			追加できなかった数
+			////////////////////////////////////////////////////////////////////////////////
+			size_t GetRejected() const
+			{
+				return m_rejected.load(std::memory_order_relaxed);
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			容量を取得
+			/// @return			容量
+			////////////////////////////////////////////////////////////////////////////////
+			size_t GetCapacity() const
+			{
+				return m_mask + 1;
+			}
+
+		private:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			最大の保持数を更新
+			/// @param[in]		value	保持数
+			////////////////////////////////////////////////////////////////////////////////
+			void UpdateHighWatermark(size_t value)
+			{
+				size_t current = m_highWatermark.load(std::memory_order_relaxed);
+
+				// 最大値を更新できるまで繰り返し
+				while (current < value && m_highWatermark.compare_exchange_weak(current, value, std::memory_order_relaxed) == false)
+				{
+
+				}
+			}
+
+		private:
+			//! リングバッファの要素
+			std::unique_ptr<CCell[]> m_cells;
+
+			//! 位置のマスク
+			size_t m_mask;
+
+			//! 取り出す位置
+			std::atomic<size_t> m_head;
+
+			//! 追加する位置
+			std::atomic<size_t> m_tail;
+
+			//! 最大の保持数
+			std::atomic<size_t> m_highWatermark;
+
+			//! 容量の上限で追加できなかった数
+			std::atomic<size_t> m_rejected;
+		};
+	}
+}
\ No newline at end of file
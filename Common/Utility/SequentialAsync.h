@@ -9,23 +9,23 @@ namespace Standard
 	{
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CSequentialAsync
-		/// @brief      񓯊̃NX
-		///	@detail		IOT[rXɃ|Xgꂽʂɔ񓯊ŏs
+		/// @brief      順次非同期処理のクラス
+		///	@detail		IOサービスにポストされた順序通りに非同期で処理を実行する
 		////////////////////////////////////////////////////////////////////////////////
 		class CSequentialAsync
 		{
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
-			/// @param[in]		io_service	IOT[rX
-			/// @param[in]		count	Xbh
+			/// @brief			コンストラクタ
+			/// @param[in]		io_service	IOサービス
+			/// @param[in]		count	スレッド数
 			////////////////////////////////////////////////////////////////////////////////
 			CSequentialAsync(boost::asio::io_service& io_service, std::size_t count)
 				: m_io_service(io_service)
 			{
 				m_work.reset(new boost::asio::io_service::work(m_io_service));
 
-				// Xbh
+				// スレッド数だけ走査
 				for (std::size_t index = 0; index < count; index++)
 				{
 					m_group.create_thread(boost::bind(&boost::asio::io_service::run, &m_io_service));
@@ -33,16 +33,16 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			~CSequentialAsync()
 			{
-				// IOT[rX~
+				// IOサービスを停止
 				Stop();
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			T[rX~
+			/// @brief			サービスを停止
 			////////////////////////////////////////////////////////////////////////////////
 			void Stop()
 			{
@@ -51,13 +51,13 @@ namespace Standard
 			}
 
 		private:
-			//! IOT[rX
+			//! IOサービス
 			boost::asio::io_service& m_io_service;
 
-			//! IOT[rX̃[J[
+			//! IOサービスのワーカー
 			boost::shared_ptr<boost::asio::io_service::work> m_work;
 
-			//! IOT[rX̃O[v
+			//! IOサービスのグループ
 			boost::thread_group m_group;
 		};
 	}
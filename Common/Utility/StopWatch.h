@@ -2,6 +2,7 @@
 
 #include <chrono>
 
+#include "../Metrics/Histogram.h"
 #include "../Tool/Text.h"
 
 namespace Standard
@@ -10,23 +11,23 @@ namespace Standard
 	{
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CStopWatch
-		/// @brief      XgbvEHb`̃NX
-		///	@detail		oߎԂv
+		/// @brief      ストップウォッチのクラス
+		///	@detail		経過時間を計測する
 		////////////////////////////////////////////////////////////////////////////////
 		class CStopWatch
 		{
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CStopWatch()
 			{
-				// Jn
+				// 開始
 				Start();
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			~CStopWatch()
 			{
@@ -34,7 +35,7 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			vJn
+			/// @brief			計測を開始
 			////////////////////////////////////////////////////////////////////////////////
 			void Start()
 			{
@@ -43,9 +44,9 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			vJn
-			/// @detail			~Ԃ̂ݍXV
-			/// @return			oߎ[ms]
+			/// @brief			計測を開始
+			/// @detail			停止時間のみ更新する
+			/// @return			経過時間[ms]
 			////////////////////////////////////////////////////////////////////////////////
 			float Stop()
 			{
@@ -53,22 +54,22 @@ namespace Standard
 
 				m_end = std::chrono::high_resolution_clock::now();
 
-				// oߎԂ擾
+				// 経過時間を取得
 				ret = Elapsed();
 
 				return ret;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			vJn
-			/// @detail			~ĊJn{
-			/// @return			oߎ[ms]
+			/// @brief			計測を開始し直す
+			/// @detail			停止して開始を実施する
+			/// @return			経過時間[ms]
 			////////////////////////////////////////////////////////////////////////////////
 			float Restart()
 			{
 				float ret = 0;
 
-				// ~
+				// 停止
 				ret = Stop();
 
 				m_start = m_end;
@@ -77,8 +78,8 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			oߎԂ擾
-			/// @return			oߎ[ms]
+			/// @brief			経過時間を取得
+			/// @return			経過時間[ms]
 			////////////////////////////////////////////////////////////////////////////////
 			float Elapsed()
 			{
@@ -90,25 +91,45 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			oߎԂ𕶎Ŏ擾
-			/// @detail			œn̂ƓɌvJn
-			/// @param[in]		unit	true:Pʂt / false:Pʂ̕tȂ
-			/// @return			oߎԂ̕
+			/// @brief			経過時間を処理時間の分布へ追加
+			/// @detail			停止せずに、開始からの経過時間を追加する
+			/// @param[in]		histogram	処理時間の分布
+			/// @return			経過時間[ms]
+			////////////////////////////////////////////////////////////////////////////////
+			float Record(Metrics::CHistogram& histogram)
+			{
+				float ret = 0;
+
+				auto elapsed = std::chrono::high_resolution_clock::now() - m_start;
+
+				// 経過時間を追加
+				histogram.Record((uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+
+				ret = std::chrono::duration_cast<std::chrono::duration<float, std::ratio<1, 1000>>>(elapsed).count();
+
+				return ret;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			経過時間を文字列で取得
+			/// @detail			文字列で渡すのと同時に計測を開始し直す
+			/// @param[in]		unit	true:単位を付加 / false:単位の付加しない
+			/// @return			経過時間の文字列
 			////////////////////////////////////////////////////////////////////////////////
 			std::string Format(bool unit)
 			{
 				std::stringstream ret;
 
-				// Pʂt邩mF
+				// 単位を付加するか確認
 				if (unit)
 				{
-					ret << "^Ng:";
+					ret << "タクト:";
 				}
 
-				// oߎԂ𕶎ɕϊ
+				// 経過時間を文字列に変換
 				ret << Text::Format(3, (double)Restart());
 
-				// Pʂt邩mF
+				// 単位を付加するか確認
 				if (unit)
 				{
 					ret << "[ms]";
@@ -118,10 +139,10 @@ namespace Standard
 			}
 
 		private:
-			//! Jn̎
+			//! 開始の時間
 			std::chrono::high_resolution_clock::time_point m_start;
 
-			//! ~̎
+			//! 停止の時間
 			std::chrono::high_resolution_clock::time_point m_end;
 		};
 	}
@@ -10,13 +10,13 @@ namespace Standard
 	{
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CObject
-		/// @brief      Cӂ̗vfƂɕRÂlێNX
+		/// @brief      任意の要素とそれに紐づく値を保持するクラス
 		////////////////////////////////////////////////////////////////////////////////
 		class CObject
 		{
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CObject()
 			{
@@ -24,11 +24,11 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
-			/// @param[in]		TElement	vf̌^(ev[gŎw)
-			/// @param[in]		TValue	ľ^(ev[gŎw)
-			/// @param[in]		element	vf
-			/// @param[in]		value	l
+			/// @brief			コンストラクタ
+			/// @param[in]		TElement	要素の型(テンプレートで指定)
+			/// @param[in]		TValue	値の型(テンプレートで指定)
+			/// @param[in]		element	要素
+			/// @param[in]		value	値
 			////////////////////////////////////////////////////////////////////////////////
 			template<typename TElement, typename TValue>
 			CObject(const TElement& element, const TValue& value)
@@ -38,19 +38,19 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			Rs[Zq
-			/// @return			NX
+			/// @brief			コピー代入演算子
+			/// @return			自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			CObject& operator = (const CObject& object) noexcept
 			{
-				// XV
+				// 更新
 				Update(object);
 
 				return *this;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			~CObject()
 			{
@@ -59,8 +59,8 @@ namespace Standard
 
 		protected:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			NXXV
-			/// @param[in]		object	NX
+			/// @brief			自クラスを更新
+			/// @param[in]		object	自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			void Update(const CObject& object)
 			{
@@ -69,23 +69,23 @@ namespace Standard
 			}
 
 		public:
-			//! vf
+			//! 要素
 			boost::any Element;
 
-			//! l
+			//! 値
 			boost::any Value;
 		};
 
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CManager
-		/// @brief      Cӂ̗vfƂɕRÂlێNXǗNX
-		/// @detail		Cӂ̌^֕ϊȂǂs
+		/// @brief      任意の要素とそれに紐づく値を保持するクラスを管理するクラス
+		/// @detail		任意の型へ変換なども行う
 		////////////////////////////////////////////////////////////////////////////////
 		class CManager
 		{
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CManager()
 			{
@@ -93,19 +93,19 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			Rs[Zq
-			/// @return			NX
+			/// @brief			コピー代入演算子
+			/// @return			自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			CManager& operator = (const CManager& object) noexcept
 			{
-				// XV
+				// 更新
 				Update(object);
 
 				return *this;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			~CManager()
 			{
@@ -114,28 +114,28 @@ namespace Standard
 
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			vfvlԂ
-			/// @detail			ev[gŗvf̌^w
-			/// @param[in]		TElement	vf̌^(ev[gŎw)
-			/// @param[in]		element	vf
-			/// @return			vfvl sv̏ꍇemptyԂɂȂĂ
+			/// @brief			要素が一致した値を返す
+			/// @detail			テンプレートで要素の型を指定
+			/// @param[in]		TElement	要素の型(テンプレートで指定)
+			/// @param[in]		element	要素
+			/// @return			要素が一致した値 ※不一致の場合はempty状態になっている
 			////////////////////////////////////////////////////////////////////////////////
 			template <typename TElement>
 			boost::any GetValue(const boost::any& element)
 			{
 				boost::any ret;
 
-				// 𑖍
+				// 情報を走査
 				for (const auto& object : Objects)
 				{
-					// vf̈vmF
+					// 要素の一致を確認
 					if (IsMatch<TElement>(element, object.Element) == false)
 					{
-						// sv
+						// 不一致
 						continue;
 					}
 
-					// v
+					// 一致
 					ret = object.Value;
 					break;
 				}
@@ -145,8 +145,8 @@ namespace Standard
 
 		protected:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			NXXV
-			/// @param[in]		objects	NX
+			/// @brief			自クラスを更新
+			/// @param[in]		objects	自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			void Update(const CManager& object)
 			{
@@ -156,12 +156,12 @@ namespace Standard
 
 		private:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			vf̈vmF
-			/// @detail			ev[gŗvf̌^w
-			/// @param[in]		TElement	vf̌^(ev[gŎw)
-			/// @param[in]		first	r̗vf
-			/// @param[in]		second	r̗vf
-			/// @return			true:v / false:sv
+			/// @brief			要素の一致を確認
+			/// @detail			テンプレートで要素の型を指定
+			/// @param[in]		TElement	要素の型(テンプレートで指定)
+			/// @param[in]		first	比較元の要素
+			/// @param[in]		second	比較先の要素
+			/// @return			true:一致 / false:不一致
 			////////////////////////////////////////////////////////////////////////////////
 			template <typename TElement>
 			bool IsMatch(const boost::any& first, const boost::any& second)
@@ -170,28 +170,28 @@ namespace Standard
 
 				do
 				{
-					// vf̋mF
+					// 要素の空を確認
 					if (first.empty() | second.empty())
 					{
-						// 
+						// 空
 						break;
 					}
 
-					// vf̌^mF
+					// 要素の型を確認
 					if (first.type() != second.type())
 					{
-						// sv
+						// 不一致
 						break;
 					}
 
-					// vf̒lr
+					// 要素の値を比較
 					if (boost::any_cast<TElement>(first) != boost::any_cast<TElement>(second))
 					{
-						// sv
+						// 不一致
 						break;
 					}
 
-					// v
+					// 一致
 					ret = true;
 				} while (false);
 
@@ -199,7 +199,7 @@ namespace Standard
 			}
 
 		public:
-			//! Cӂ̗vfƂɕRÂlێNX
+			//! 任意の要素とそれに紐づく値を保持するクラス
 			std::vector<Variant::CObject> Objects;
 		};
 	}
@@ -8,13 +8,13 @@ namespace Standard
 	{
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CObject
-		/// @brief      o[W̏ێNX
+		/// @brief      バージョンの情報を保持するクラス
 		////////////////////////////////////////////////////////////////////////////////
 		class CObject
 		{
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CObject()
 			{
@@ -27,7 +27,7 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			~CObject()
 			{
@@ -35,22 +35,22 @@ namespace Standard
 			}
 
 		public:
-			//! t@C
+			//! ファイル名
 			std::string FileName;
 
-			//! t@C̃o[W
+			//! ファイルのバージョン情報
 			std::string FileDescription;
 
-			//! o[Wԍ(W[)
+			//! バージョン番号(メジャー)
 			int Major;
 
-			//! o[Wԍ(}Ci[)
+			//! バージョン番号(マイナー)
 			int Minor;
 
-			//! o[Wԍ(rh)
+			//! バージョン番号(ビルド)
 			int Build;
 
-			//! o[Wԍ(rW)
+			//! バージョン番号(リビジョン)
 			int Revision;
 		};
 	}
@@ -18,15 +18,15 @@ namespace Standard
 	{
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CManager
-		/// @brief      o[W̏擾NX
-		///				 VOgev[g̃NXp
+		/// @brief      バージョンの情報を取得するクラス
+		///				⇒ シングルトン化するテンプレートのクラスから継承
 		////////////////////////////////////////////////////////////////////////////////
 		class CManager
 			: virtual public Singleton::Worker::CTemplate<CManager>
 		{
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CManager()
 			{
@@ -35,41 +35,41 @@ namespace Standard
 
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			virtual ~CManager()
 			{
-				// j
+				// 破棄
 				Destroy();
 			}
 
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			
-			/// @param[in]		hModule	W[ID
+			/// @brief			初期化
+			/// @param[in]		hModule	モジュールID
 			////////////////////////////////////////////////////////////////////////////////
 			void Initialize(HMODULE hModule)
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncModule);
 
 				m_hModule = hModule;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			j
+			/// @brief			破棄
 			////////////////////////////////////////////////////////////////////////////////
 			void Destroy()
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncModule);
 
 				m_hModule = nullptr;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			o[W̃NX擾
-			/// @return			o[W̃NX
+			/// @brief			バージョンのクラスを取得
+			/// @return			バージョンのクラス
 			////////////////////////////////////////////////////////////////////////////////
 			Version::CObject GetVersion()
 			{
@@ -77,46 +77,46 @@ namespace Standard
 
 				std::stringstream message;
 					
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncModule);
 
 				TCHAR filePath[MAX_PATH] = {};
 
-				// W[IDmF
+				// モジュールIDを確認
 				message << "HMODULE";
 				if (m_hModule == nullptr)
 				{
-					// O𔭖C
-					message << Logging::ConstSeparator << "ݒ";
+					// 例外を発砲
+					message << Logging::ConstSeparator << "未設定";
 					throw Exception::CObject(Exception::CodeVersion, message.str());
 				}
 
-				// CX^X̃pX擾
+				// インスタンスのパスを取得
 				message.str("");
 				message << "GetModuleFileName()";
 				if (::GetModuleFileName(m_hModule, filePath, sizeof(filePath)) == 0)
 				{
-					// O𔭖C
-					message << Logging::ConstSeparator << "G[:" << Text::FormatX(8, ::GetLastError());
+					// 例外を発砲
+					message << Logging::ConstSeparator << "エラー:" << Text::FormatX(8, ::GetLastError());
 					throw Exception::CObject(Exception::CodeVersion, message.str());
 				}
 
 				DWORD dwZero = 0;
 
-				// t@C̃o[WTCY擾
+				// ファイルのバージョン情報サイズを取得
 				message.str("");
 				message << "GetFileVersionInfoSize()";
 				DWORD infoSize = ::GetFileVersionInfoSize(filePath, &dwZero);
 				if (infoSize == 0)
 				{
-					// O𔭖C
-					message << Logging::ConstSeparator << "TCYȂ";
+					// 例外を発砲
+					message << Logging::ConstSeparator << "サイズなし";
 					throw Exception::CObject(Exception::CodeVersion, message.str());
 				}
 
 				std::unique_ptr<char[]> buffer = std::make_unique<char[]>(infoSize);
 
-				// t@C̃o[W擾
+				// ファイルのバージョン情報を取得
 				message.str("");
 				message << "GetFileVersionInfo()";
 				::GetFileVersionInfo(filePath, dwZero, infoSize, buffer.get());
@@ -124,13 +124,13 @@ namespace Standard
 				VS_FIXEDFILEINFO* versionInfo;
 				UINT length;
 
-				// o[W擾
+				// バージョン情報を取得
 				message.str("");
 				message << "VerQueryValue()";
 				if (::VerQueryValue(buffer.get(), _T("\\"), (void**)&versionInfo, &length) == 0)
 				{
-					// O𔭖C
-					message << Logging::ConstSeparator << "G[:" << Text::FormatX(8, ::GetLastError());
+					// 例外を発砲
+					message << Logging::ConstSeparator << "エラー:" << Text::FormatX(8, ::GetLastError());
 					throw Exception::CObject(Exception::CodeVersion, message.str());
 				}
 				ret.Major = (int)(HIWORD(versionInfo->dwFileVersionMS));
@@ -140,20 +140,20 @@ namespace Standard
 
 				WORD* languageCode;
 
-				// ꎯʎqƃR[hy[Wʎq擾
+				// 言語識別子とコードページ識別子を取得
 				message.str("");
 				message << "VerQueryValue(\\VarFileInfo\\Translation)";
 				if (::VerQueryValue(buffer.get(), _T("\\VarFileInfo\\Translation"), (void**)&languageCode, &length) == 0)
 				{
-					// O𔭖C
-					message << Logging::ConstSeparator << "G[:" << Text::FormatX(8, ::GetLastError());
+					// 例外を発砲
+					message << Logging::ConstSeparator << "エラー:" << Text::FormatX(8, ::GetLastError());
 					throw Exception::CObject(Exception::CodeVersion, message.str());
 				}
 
-				// t@C擾
+				// ファイル名を取得
 				ret.FileName = GetResourceInfomation((void**)buffer.get(), languageCode, "OriginalFilename");
 
-				// t@C̃o[W擾
+				// ファイルのバージョン情報を取得
 				ret.FileDescription = GetResourceInfomation((void**)buffer.get(), languageCode, "FileDescription");
 
 				return ret;
@@ -161,13 +161,13 @@ namespace Standard
 
 		private:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			o[W̏擾
-			/// @detail			\[XɋLڂĂ`ς݂̕擾
-			///					:)FileDescriptionAOriginalFilenameȂ
-			/// @param[in]		buffer	o[W̃|C^
-			/// @param[in]		languageCode	ꎯʎqƃR[hy[Wʎq
-			/// @param[in]		target	`ς݂̕
-			/// @return			\[XɋLڂĂ`ς݂̕
+			/// @brief			バージョンの情報を取得
+			/// @detail			リソースに記載してある定義済みの文字列を取得
+			///					例:)FileDescription、OriginalFilenameなど
+			/// @param[in]		buffer	バージョン情報のポインタ
+			/// @param[in]		languageCode	言語識別子とコードページ識別子
+			/// @param[in]		target	定義済みの文字列
+			/// @return			リソースに記載してある定義済みの文字列
 			////////////////////////////////////////////////////////////////////////////////
 			std::string GetResourceInfomation(void** buffer, WORD* languageCode, std::string target)
 			{
@@ -180,12 +180,12 @@ namespace Standard
 
 				block << "\\StringFileInfo\\" << Text::FormatX(4, languageCode[0], "") << Text::FormatX(4, languageCode[1], "") << "\\" << target;
 
-				// t@C̃o[W擾
+				// ファイルのバージョン情報を取得
 				message << "VerQueryValue(" << block.str() << ")";
 				if (::VerQueryValue(buffer, Text::Convert(block.str()).c_str(), (void**)&result, &length) == 0)
 				{
-					// O𔭖C
-					message << Logging::ConstSeparator << "G[:" << Text::FormatX(8, ::GetLastError());
+					// 例外を発砲
+					message << Logging::ConstSeparator << "エラー:" << Text::FormatX(8, ::GetLastError());
 					throw Exception::CObject(Exception::CodeVersion, message.str());
 				}
 
@@ -198,10 +198,10 @@ namespace Standard
 			}
 
 		private:
-			//! rNX(W[p)
+			//! 排他制御クラス(モジュール用)
 			std::recursive_mutex m_asyncModule;
 
-			//! W[ID
+			//! モジュールID
 			HMODULE m_hModule;
 		};
 	}
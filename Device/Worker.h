@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Exception/Worker.h"
+#include "Common/Metrics/Scope.h"
 #include "Common/Utility/StopWatch.h"
 
 namespace Standard
@@ -11,10 +12,10 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CTemplate
-			/// @brief      foCX̐sev[g̃NX
-			///				 O̐sev[g̃NXh
-			/// @param[in]	CDefault	ftHg̐ݒNX(ev[gŎw)
-			/// @param[in]	CConnect	ڑ̐ݒNX(ev[gŎw)
+			/// @brief      デバイスの制御を行うテンプレートのクラス
+			///				⇒ 例外の制御を行うテンプレートのクラスから派生
+			/// @param[in]	CDefault	デフォルトの設定クラス(テンプレートで指定)
+			/// @param[in]	CConnect	接続の設定クラス(テンプレートで指定)
 			////////////////////////////////////////////////////////////////////////////////
 			template <typename CDefault, typename CConnect>
 			class CTemplate
@@ -22,7 +23,7 @@ namespace Standard
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate() : Exception::Worker::CTemplate()
 				{
@@ -32,30 +33,30 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CTemplate()
 				{
-					// j
+					// 破棄
 					Destroy();
 				}
 
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̂XV
-				/// @param[in]		name	
+				/// @brief			名称を更新
+				/// @param[in]		name	名称
 				////////////////////////////////////////////////////////////////////////////////
 				void SetName(const std::string& name)
 				{
-					// ̂XV
+					// 名称を更新
 					m_name = name;
 					SetNameException(name + "Exception::");
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			
-				/// @detail			Cȕ܂łs
-				/// @param[in]		object	ftHg̐ݒNX
+				/// @brief			初期化
+				/// @detail			ライブラリの初期化までを行う
+				/// @param[in]		object	デフォルトの設定クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Initialize(const CDefault& object) throw(...)
 				{
@@ -64,32 +65,32 @@ namespace Standard
 
 					logging.Message << GetName() << "Initialize()" << Logging::ConstSeparator;
 
-					postscript << "ftHg̐ݒNXXV";
+					postscript << "デフォルトの設定クラスを更新";
 					SetDefaultSetting(object);
 					postscript.str("");
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
 
-					// jς݂mF
+					// 破棄済みを確認
 					IsDiscarded();
 
-					// ς݂mF
+					// 初期化済みを確認
 					IsInitialize();
 
-					// 
+					// 初期化
 					InitializeDerived();
 
-					// tOݒ
+					// 初期フラグを設定
 					m_initialize = true;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			j
+				/// @brief			破棄
 				////////////////////////////////////////////////////////////////////////////////
 				void Destroy() throw(...)
 				{
@@ -98,54 +99,54 @@ namespace Standard
 
 					logging.Message << GetName() << "Destroy()" << Logging::ConstSeparator;
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
 
 					do
 					{
-						// tOmF
+						// 初期フラグを確認
 						if (m_initialize == false)
 						{
-							postscript << "";
+							postscript << "未初期化";
 
-							// Oo
+							// ログ出力
 							Transfer::Output(Logging::Join(logging, postscript.str()));
 							postscript.str("");
 							break;
 						}
 
-						// jtOmF
+						// 破棄フラグを確認
 						if (m_destroy)
 						{
-							postscript << "jς";
+							postscript << "破棄済み";
 
-							// Oo
+							// ログ出力
 							Transfer::Output(Logging::Join(logging, postscript.str()));
 							postscript.str("");
 							break;
 						}
 
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// ؒf
+						// 切断
 						Disconnect();
 
-						// j
+						// 破棄
 						DestroyDerived();
 
-						// tO
+						// 初期フラグを解除
 						m_initialize = false;
 
-						// jtOݒ
+						// 破棄フラグを設定
 						m_destroy = true;
 					} while (false);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ڑ
-				/// @param[in]		object	ڑ̐ݒNX
+				/// @brief			接続
+				/// @param[in]		object	接続の設定クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Connect(const CConnect& object) throw(...)
 				{
@@ -154,29 +155,29 @@ namespace Standard
 
 					logging.Message << GetName() << "Connect()" << Logging::ConstSeparator;
 
-					postscript << "ڑ̐ݒNXXV";
+					postscript << "接続の設定クラスを更新";
 					SetConnectSetting(object);
 					postscript.str("");
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
 
-					// 䂪\mF
+					// 制御が可能か確認
 					IsControllable();
 
-					// ؒf
+					// 切断
 					Disconnect();
 
-					// ڑ
+					// 接続
 					ConnectDerived();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ؒf
+				/// @brief			切断
 				////////////////////////////////////////////////////////////////////////////////
 				void Disconnect() throw(...)
 				{
@@ -187,140 +188,140 @@ namespace Standard
 
 					do
 					{
-						// ڑ̏ԂmF
+						// 接続の状態を確認
 						if (GetConnected() == false)
 						{
-							// ڑ
+							// 未接続
 							break;
 						}
 
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
 
-						// 䂪\mF
+						// 制御が可能か確認
 						IsControllable();
 
-						// ؒf
+						// 切断
 						DisconnectDerived();
 					} while (false);
 				}
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ς݂̊mF
+				/// @brief			初期化済みの確認
 				////////////////////////////////////////////////////////////////////////////////
 				void IsInitialize()
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
 
-					// tOmF
+					// 初期フラグを確認
 					if (m_initialize)
 					{
-						// ς݂̗O𔭖C
+						// 初期化済みの例外を発砲
 						ExceptionInitialized();
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			䂪\mF
+				/// @brief			制御が可能か確認
 				////////////////////////////////////////////////////////////////////////////////
 				void IsControllable()
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
 
-					// jς݂mF
+					// 破棄済みを確認
 					IsDiscarded();
 
-					// mF
+					// 未初期化を確認
 					IsUninitialized();
 				}
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ftHg̐ݒNX擾
-				/// @return			ftHg̐ݒNX
+				/// @brief			デフォルトの設定クラスを取得
+				/// @return			デフォルトの設定クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CDefault GetDefaultSetting()
 				{
 					CDefault ret;
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncDefaultSetting);
 
-					// ftHg̐ݒNX擾
+					// デフォルトの設定クラスを取得
 					ret = m_defaultSetting;
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ftHg̐ݒNXXV
-				/// @param[in]		object	ftHg̐ݒNX
+				/// @brief			デフォルトの設定クラスを更新
+				/// @param[in]		object	デフォルトの設定クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void SetDefaultSetting(const CDefault& object)
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncDefaultSetting);
 
-					// ftHg̐ݒNXXV
+					// デフォルトの設定クラスを更新
 					m_defaultSetting = object;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ڑ̐ݒNX擾
-				/// @return			ڑ̐ݒNX
+				/// @brief			接続の設定クラスを取得
+				/// @return			接続の設定クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CConnect GetConnectSetting()
 				{
 					CConnect ret;
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncConnectSetting);
 
-					// ڑ̐ݒNX擾
+					// 接続の設定クラスを取得
 					ret = m_connectSetting;
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ڑ̐ݒNXXV
-				/// @param[in]		object	ڑ̐ݒNX
+				/// @brief			接続の設定クラスを更新
+				/// @param[in]		object	接続の設定クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void SetConnectSetting(const CConnect& object)
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncConnectSetting);
 
-					// ڑ̐ݒNXXV
+					// 接続の設定クラスを更新
 					m_connectSetting = object;
 				}
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̂擾
-				/// @return			
+				/// @brief			名称を取得
+				/// @return			名称
 				////////////////////////////////////////////////////////////////////////////////
 				std::string GetName()
 				{
 					std::string ret = "";
 
-					// ̂擾
+					// 名称を取得
 					ret = m_name;
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ς݂̗O𔭖C
-				///	@detail			̗O𔭖C^C~OŌĂяo
-				///					hŋLq
+				/// @brief			初期化済みの例外を発砲
+				///	@detail			初期化の例外を発砲するタイミングで呼び出される
+				///					★派生先で記述する
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void ExceptionInitialized() throw(...)
 				{
@@ -328,9 +329,9 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			jς݂̗O𔭖C
-				///	@detail			j̗O𔭖C^C~OŌĂяo
-				///					hŋLq
+				/// @brief			破棄済みの例外を発砲
+				///	@detail			破棄の例外を発砲するタイミングで呼び出される
+				///					★派生先で記述する
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void ExceptionDiscarded() throw(...)
 				{
@@ -338,9 +339,9 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̗O𔭖C
-				///	@detail			̊mFŗO𔭖C^C~OŌĂяo
-				///					hŋLq
+				/// @brief			未初期化の例外を発砲
+				///	@detail			未初期化の確認で例外を発砲するタイミングで呼び出される
+				///					★派生先で記述する
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void ExceptionUninitialized() throw(...)
 				{
@@ -348,10 +349,10 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ڑ̏Ԃ擾
-				///	@detail			ڑ̏Ԃ擾^C~OŌĂяo
-				///					hŋLq
-				/// @return			true:ڑς / false:ڑ
+				/// @brief			接続の状態を取得
+				///	@detail			接続の状態を取得するタイミングで呼び出される
+				///					★派生先で記述する
+				/// @return			true:接続済み / false:未接続
 				////////////////////////////////////////////////////////////////////////////////
 				virtual bool GetConnected() throw(...)
 				{
@@ -361,9 +362,9 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			
-				///	@detail			s^C~OŌĂяo
-				///					hŋLq
+				/// @brief			初期化
+				///	@detail			初期化を行うタイミングで呼び出される
+				///					★派生先で記述する
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void InitializeDerived() throw(...)
 				{
@@ -371,9 +372,9 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			j
-				///	@detail			js^C~OŌĂяo
-				///					hŋLq
+				/// @brief			破棄
+				///	@detail			破棄を行うタイミングで呼び出される
+				///					★派生先で記述する
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void DestroyDerived() throw(...)
 				{
@@ -381,9 +382,9 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ڑ
-				///	@detail			ڑs^C~OŌĂяo
-				///					hŋLq
+				/// @brief			接続
+				///	@detail			接続を行うタイミングで呼び出される
+				///					★派生先で記述する
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void ConnectDerived() throw(...)
 				{
@@ -391,9 +392,9 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ؒf
-				///	@detail			ؒfs^C~OŌĂяo
-				///					hŋLq
+				/// @brief			切断
+				///	@detail			切断を行うタイミングで呼び出される
+				///					★派生先で記述する
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void DisconnectDerived() throw(...)
 				{
@@ -402,61 +403,61 @@ namespace Standard
 
 			private:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			jς݂̊mF
+				/// @brief			破棄済みの確認
 				////////////////////////////////////////////////////////////////////////////////
 				void IsDiscarded()
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
 
-					// jtOmF
+					// 破棄フラグを確認
 					if (m_destroy)
 					{
-						// jς݂̗O𔭖C
+						// 破棄済みの例外を発砲
 						ExceptionDiscarded();
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̊mF
+				/// @brief			未初期化の確認
 				////////////////////////////////////////////////////////////////////////////////
 				void IsUninitialized()
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
 
-					// tOmF
+					// 初期化フラグを確認
 					if (m_initialize == false)
 					{
-						// ̗O𔭖C
+						// 未初期化の例外を発砲
 						ExceptionUninitialized();
 					}
 				}
 
 			protected:
-				//! rNX(tOp)
+				//! 排他制御クラス(フラグ用)
 				std::recursive_mutex m_asyncFlag;
 
-				//! tO
+				//! 初期フラグ
 				bool m_initialize;
 
-				//! jtO
+				//! 破棄フラグ
 				bool m_destroy;
 
 			private:
-				//! rNX(ftHg̐ݒNXp)
+				//! 排他制御クラス(デフォルトの設定クラス用)
 				std::recursive_mutex m_asyncDefaultSetting;
 
-				//! ftHg̐ݒNX
+				//! デフォルトの設定クラス
 				CDefault m_defaultSetting;
 
-				//! rNX(ڑ̐ݒNXp)
+				//! 排他制御クラス(接続の設定クラス用)
 				std::recursive_mutex m_asyncConnectSetting;
 
-				//! ڑ̐ݒNX
+				//! 接続の設定クラス
 				CConnect m_connectSetting;
 
-				//! 
+				//! 名称
 				std::string m_name;
 			};
 		}
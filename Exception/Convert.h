@@ -11,33 +11,33 @@ namespace Standard
 		namespace Convert
 		{
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			bZ[Wɕϊ
-			/// @detail			ȌtbZ[W𐶐
-			/// @param[in]		logging	ÕNX
-			/// @param[in]		postscript	ǉ̕
-			/// @param[in]		e	ÕNX
-			/// @return			bZ[W
+			/// @brief			メッセージに変換
+			/// @detail			例外の情報を付加したメッセージを生成する
+			/// @param[in]		logging	ログのクラス
+			/// @param[in]		postscript	追加の文字列
+			/// @param[in]		e	例外のクラス
+			/// @return			メッセージ
 			////////////////////////////////////////////////////////////////////////////////
 			inline std::string Message(const Logging::CObject& logging, const std::string& postscript, const std::exception& e)
 			{
 				std::stringstream ret;
 
-				// bZ[Wǉ
+				// メッセージを追加
 				ret << logging.Message.str();
 
-				// ǉ̕mF
+				// 追加の文字列を確認
 				if (postscript.empty() == false)
 				{
-					// ǉ̕ǉ
+					// 追加の文字列を追加
 					ret << Logging::ConstSeparator << postscript;
 				}
 
 				std::string buffer = e.what();
 
-				// G[̃bZ[WmF
+				// エラーのメッセージを確認
 				if (buffer.empty() == false)
 				{
-					// G[̃bZ[Wǉ
+					// エラーのメッセージを追加
 					ret << Logging::ConstSeparator << buffer;
 				}
 
@@ -45,81 +45,81 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			bZ[Wɕϊ
-			/// @detail			ȌtbZ[W𐶐
-			/// @param[in]		errorCode	ÕR[h
-			/// @param[in]		deviceErrorCode	@̃G[R[h
-			/// @param[in]		logging	ÕNX
-			/// @param[in]		postscript	ǉ̕
-			/// @param[in]		e	ÕNX
-			/// @return			bZ[W
+			/// @brief			メッセージに変換
+			/// @detail			例外の情報を付加したメッセージを生成する
+			/// @param[in]		errorCode	例外のコード
+			/// @param[in]		deviceErrorCode	機器のエラーコード
+			/// @param[in]		logging	ログのクラス
+			/// @param[in]		postscript	追加の文字列
+			/// @param[in]		e	例外のクラス
+			/// @return			メッセージ
 			////////////////////////////////////////////////////////////////////////////////
 			inline std::string Message(Exception::EnumCode errorCode, int deviceErrorCode, const Logging::CObject& logging, const std::string& postscript, const std::exception& e)
 			{
 				std::stringstream ret;
 
-				// G[R[ht
-				ret << "G[:" << Text::FormatX(4, errorCode);
+				// エラーコードを付加
+				ret << "エラー:" << Text::FormatX(4, errorCode);
 
-				// ÕNXɕϊ
+				// ログのクラスに変換
 				ret << Logging::ConstSeparator << Message(logging, postscript, e);
 
-				// @̃G[R[hmF
+				// 機器のエラーコードを確認
 				if (deviceErrorCode != Exception::DeviceCodeSuccess)
 				{
-					// @̃G[R[hǉ
-					ret << Logging::ConstSeparator << "R[h:" << Text::FormatX(8, deviceErrorCode);
+					// 機器のエラーコードを追加
+					ret << Logging::ConstSeparator << "コード:" << Text::FormatX(8, deviceErrorCode);
 				}
 
 				return ret.str();
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			ÕNXɕϊ
-			/// @detail			ȌtÕNX𐶐
-			/// @param[in]		logging	ÕNX
-			/// @param[in]		postscript	ǉ̕
-			/// @param[in]		e	ÕNX
-			/// @return			ÕNX
+			/// @brief			ログのクラスに変換
+			/// @detail			例外の情報を付加したログのクラスを生成する
+			/// @param[in]		logging	ログのクラス
+			/// @param[in]		postscript	追加の文字列
+			/// @param[in]		e	例外のクラス
+			/// @return			ログのクラス
 			////////////////////////////////////////////////////////////////////////////////
 			inline Logging::CObject Logging(const Logging::CObject& logging, const std::string& postscript, const std::exception& e)
 			{
 				Logging::CObject ret;
 
-				// ÕxXV
+				// ログのレベルを更新
 				ret.Level = Logging::LevelError;
 
-				// bZ[Wǉ
+				// メッセージを追加
 				ret.Message << Message(logging, postscript, e);
 
 				return ret;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			ÕNXɕϊ
-			/// @detail			ȌtÕNX𐶐
-			/// @param[in]		errorCode	ÕR[h
-			/// @param[in]		deviceErrorCode	@̃G[R[h
-			/// @param[in]		logging	ÕNX
-			/// @param[in]		postscript	ǉ̕
-			/// @param[in]		e	ÕNX
-			/// @return			ÕNX
+			/// @brief			ログのクラスに変換
+			/// @detail			例外の情報を付加したログのクラスを生成する
+			/// @param[in]		errorCode	例外のコード
+			/// @param[in]		deviceErrorCode	機器のエラーコード
+			/// @param[in]		logging	ログのクラス
+			/// @param[in]		postscript	追加の文字列
+			/// @param[in]		e	例外のクラス
+			/// @return			ログのクラス
 			////////////////////////////////////////////////////////////////////////////////
 			inline Logging::CObject Logging(Exception::EnumCode errorCode, int deviceErrorCode, const Logging::CObject& logging, const std::string& postscript, const std::exception& e)
 			{
 				Logging::CObject ret;
 
-				// G[R[ht
-				ret.Message << "G[:" << Text::FormatX(4, errorCode);
+				// エラーコードを付加
+				ret.Message << "エラー:" << Text::FormatX(4, errorCode);
 
-				// ÕNXɕϊ
+				// ログのクラスに変換
 				ret = Logging(logging, postscript, e);
 
-				// @̃G[R[hmF
+				// 機器のエラーコードを確認
 				if (deviceErrorCode != Exception::DeviceCodeSuccess)
 				{
-					// @̃G[R[hǉ
-					ret.Message << Logging::ConstSeparator << "R[h:" << Text::FormatX(8, deviceErrorCode);
+					// 機器のエラーコードを追加
+					ret.Message << Logging::ConstSeparator << "コード:" << Text::FormatX(8, deviceErrorCode);
 				}
 
 				return ret;
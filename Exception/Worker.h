@@ -18,27 +18,27 @@ namespace Standard
 	{
 		namespace Worker
 		{
-			//! OM֐̒`
+			//! 例外を受信する関数の定義
 			typedef void(OnException)(const Exception::CObject&);
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CTemplate
-			/// @brief      O̐sev[g̃NX
+			/// @brief      例外の制御を行うテンプレートのクラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CTemplate
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate()
 				{
-					// ̂XV
+					// 名称を更新
 					m_noticeException.SetName("Exception::Notice::");
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CTemplate()
 				{
@@ -47,54 +47,54 @@ namespace Standard
 
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Ô̖XV
-				/// @param[in]		name	O̖
+				/// @brief			例外の名称を更新
+				/// @param[in]		name	例外の名称
 				////////////////////////////////////////////////////////////////////////////////
 				void SetNameException(const std::string& name)
 				{
-					// ̂XV
+					// 名称を更新
 					m_noticeException.SetName(name);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Oʒm֐̓o^
-				/// @param[in]		object	Oʒm֐
+				/// @brief			例外を通知する関数の登録
+				/// @param[in]		object	例外を通知する関数
 				////////////////////////////////////////////////////////////////////////////////
 				void AttachFunctionException(std::function<OnException> object)
 				{
-					// Oʒm֐̓o^
+					// 例外を通知する関数の登録
 					m_noticeException.AttachFunctionCalled(object);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Oʒm֐̉
+				/// @brief			例外を通知する関数の解除
 				////////////////////////////////////////////////////////////////////////////////
 				void DetachFunctionException()
 				{
-					// Oʒm֐̉
+					// 例外を通知する関数の解除
 					m_noticeException.DetachFunctionCalled();
 				}
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Oʒm
-				/// @param[in]		object	ÕNX
+				/// @brief			例外を通知
+				/// @param[in]		object	例外のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void NotifyException(const Exception::CObject& object)
 				{
-					// Oʒm
+					// 例外を通知
 					m_noticeException.RequestNotice(object);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Ȍo
-				/// @detail			Ȍo͂ƗÕNX𐶐
-				/// @param[in]		errorCode	ÕR[h
-				/// @param[in]		deviceErrorCode	@̃G[R[h
-				/// @param[in]		logging	ÕNX
-				/// @param[in]		postscript	ǉ̕
-				/// @param[in]		e	ÕNX
-				/// @return			ÕNX
+				/// @brief			例外の出力
+				/// @detail			ログの出力と例外のクラスを生成する
+				/// @param[in]		errorCode	例外のコード
+				/// @param[in]		deviceErrorCode	機器のエラーコード
+				/// @param[in]		logging	ログのクラス
+				/// @param[in]		postscript	追加の文字列
+				/// @param[in]		e	例外のクラス
+				/// @return			例外のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				Exception::CObject OutputException(Exception::EnumCode errorCode, int deviceErrorCode, const Logging::CObject& logging, const std::string& postscript, const std::exception& e)
 				{
@@ -102,41 +102,41 @@ namespace Standard
 
 					Logging::CObject buffer;
 
-					// ÕNXɕϊ
+					// ログのクラスに変換
 					buffer = Exception::Convert::Logging(errorCode, deviceErrorCode, logging, postscript, e);
 
-					// ÕNXXV
+					// 例外のクラスを更新
 					ret.ErrorCode = errorCode;
 					ret.DeviceErrorCode = deviceErrorCode;
 					ret.Message = buffer.Message.str();
 
-					// Oo
+					// ログ出力
 					Transfer::Output(buffer);
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Ȍo
-				/// @detail			Ȍo͂ƗÕNX𐶐
-				/// @param[in]		errorCode	ÕR[h
-				/// @param[in]		logging	ÕNX
-				/// @param[in]		postscript	ǉ̕
-				/// @return			ÕNX
+				/// @brief			例外の出力
+				/// @detail			ログの出力と例外のクラスを生成する
+				/// @param[in]		errorCode	例外のコード
+				/// @param[in]		logging	ログのクラス
+				/// @param[in]		postscript	追加の文字列
+				/// @return			例外のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				Exception::CObject OutputException(Exception::EnumCode errorCode, const Logging::CObject& logging, const std::string& postscript)
 				{
-					// Ȍo
+					// 例外の出力
 					return OutputException(errorCode, Exception::CodeSuccess, logging, postscript, std::exception(""));
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Ȍo
-				/// @detail			Ȍo͂ƗÕNX𐶐
-				/// @param[in]		errorCode	ÕR[h
-				/// @param[in]		deviceErrorCode	@̃G[R[h
-				/// @param[in]		postscript	ǉ̕
-				/// @return			ÕNX
+				/// @brief			例外の出力
+				/// @detail			ログの出力と例外のクラスを生成する
+				/// @param[in]		errorCode	例外のコード
+				/// @param[in]		deviceErrorCode	機器のエラーコード
+				/// @param[in]		postscript	追加の文字列
+				/// @return			例外のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				Exception::CObject OutputException(Exception::EnumCode errorCode, int deviceErrorCode, const std::string& postscript)
 				{
@@ -144,12 +144,12 @@ namespace Standard
 
 					logging.Message << postscript;
 
-					// Ȍo
+					// 例外の出力
 					return OutputException(errorCode, deviceErrorCode, logging, "", std::exception(""));
 				}
 
 			private:
-				//! OʒmNX
+				//! 例外を通知するクラス
 				Notice::Worker::CTemplate<OnException, Exception::CObject> m_noticeException;
 			};
 		}
@@ -7,60 +7,162 @@
 #endif
 
 #include <functional>
+#include <map>
+#include <vector>
 
 #include "Common/Exception/Basis.h"
 #include "Common/Version/Basis.h"
 #include "Common/Image/Basis.h"
 #include "Common/Grabber/Condition.h"
+#include "Common/Grabber/Frame.h"
 #include "Common/Grabber/Setting.h"
 
 namespace Standard
 {
 	namespace Grabber
 	{
-		// o[W擾
+		// バージョンを取得
 		GRABBER_API Version::CObject GetVersion() throw(...);
 
-		// Oʒm֐̓o^
+		// 例外を通知する関数の登録
 		GRABBER_API void AttachFunctionException(std::function<void(const Exception::CObject&)> object);
 
-		// Oʒm֐̉
+		// 例外を通知する関数の解除
 		GRABBER_API void DetachFunctionException();
 
-		// 
+		// 初期化
 		GRABBER_API void Initialize(const Setting::CDefault& object) throw(...);
 
-		// j
+		// 破棄
 		GRABBER_API void Destroy() throw(...);
 
-		// ڑ
+		// 接続
 		GRABBER_API void Connect(const Setting::CConnect& object) throw(...);
 
-		// ؒf
+		// 切断
 		GRABBER_API void Disconnect() throw(...);
 
-		// 荞݂̏NX擾
+		// 取り込みの条件クラスを取得
 		GRABBER_API Condition::CCapture GetCaptureCondition() throw(...);
 
-		// AiOQCǂݍ
+		// アナログゲインを読み込み
 		GRABBER_API double ReadAnalogGain() throw(...);
 
-		// AiOQC
+		// アナログゲインを書き込み
 		GRABBER_API void WriteAnalogGain(double value) throw(...);
 
-		// fW^QCǂݍ
+		// デジタルゲインを読み込み
 		GRABBER_API double ReadDigitalGain() throw(...);
 
-		// fW^QC
+		// デジタルゲインを書き込み
 		GRABBER_API void WriteDigitalGain(double value) throw(...);
 
-		// IԂǂݍ
+		// 露光時間を読み込み
 		GRABBER_API double ReadExposureTime() throw(...);
 
-		// IԂ
+		// 露光時間を書き込み
 		GRABBER_API void WriteExposureTime(double value) throw(...);
 
-		// 荞
+		// パラメータを一括で書き込み
+		GRABBER_API void ApplyParameter(const Setting::CParameter& object) throw(...);
+
+		// 取り込み
 		GRABBER_API Image::CObject Capture() throw(...);
+
+		// 最新の画像を取得
+		GRABBER_API Frame::CObject GetLatestFrame() throw(...);
+
+		// 次の画像を待機
+		GRABBER_API Frame::CObject WaitNextFrame(int timeout) throw(...);
+
+		// 画像を通知する関数の登録
+		GRABBER_API void AttachFunctionFrame(std::function<void(const Frame::CObject&)> object);
+
+		// 画像を通知する関数の解除
+		GRABBER_API void DetachFunctionFrame();
+
+		// トリガの取り込みを準備
+		GRABBER_API void ArmTrigger(int count) throw(...);
+
+		// ソフトウェアトリガを発行
+		GRABBER_API void SoftwareTrigger() throw(...);
+
+		// ハンドルを生成
+		GRABBER_API int Create() throw(...);
+
+		// ハンドルを解放
+		GRABBER_API void Release(int handle) throw(...);
+
+		// ハンドルの一覧を取得
+		GRABBER_API std::vector<int> GetHandles();
+
+		// 例外を通知する関数の登録
+		GRABBER_API void AttachFunctionException(int handle, std::function<void(const Exception::CObject&)> object) throw(...);
+
+		// 例外を通知する関数の解除
+		GRABBER_API void DetachFunctionException(int handle) throw(...);
+
+		// 初期化
+		GRABBER_API void Initialize(int handle, const Setting::CDefault& object) throw(...);
+
+		// 複数のカメラを並列に初期化
+		GRABBER_API void Initialize(const std::map<int, Setting::CDefault>& objects) throw(...);
+
+		// 破棄
+		GRABBER_API void Destroy(int handle) throw(...);
+
+		// 接続
+		GRABBER_API void Connect(int handle, const Setting::CConnect& object) throw(...);
+
+		// 複数のカメラを並列に接続
+		GRABBER_API void Connect(const std::map<int, Setting::CConnect>& objects) throw(...);
+
+		// 切断
+		GRABBER_API void Disconnect(int handle) throw(...);
+
+		// 取り込みの条件クラスを取得
+		GRABBER_API Condition::CCapture GetCaptureCondition(int handle) throw(...);
+
+		// アナログゲインを読み込み
+		GRABBER_API double ReadAnalogGain(int handle) throw(...);
+
+		// アナログゲインを書き込み
+		GRABBER_API void WriteAnalogGain(int handle, double value) throw(...);
+
+		// デジタルゲインを読み込み
+		GRABBER_API double ReadDigitalGain(int handle) throw(...);
+
+		// デジタルゲインを書き込み
+		GRABBER_API void WriteDigitalGain(int handle, double value) throw(...);
+
+		// 露光時間を読み込み
+		GRABBER_API double ReadExposureTime(int handle) throw(...);
+
+		// 露光時間を書き込み
+		GRABBER_API void WriteExposureTime(int handle, double value) throw(...);
+
+		// パラメータを一括で書き込み
+		GRABBER_API void ApplyParameter(int handle, const Setting::CParameter& object) throw(...);
+
+		// 取り込み
+		GRABBER_API Image::CObject Capture(int handle) throw(...);
+
+		// 最新の画像を取得
+		GRABBER_API Frame::CObject GetLatestFrame(int handle) throw(...);
+
+		// 次の画像を待機
+		GRABBER_API Frame::CObject WaitNextFrame(int handle, int timeout) throw(...);
+
+		// 画像を通知する関数の登録
+		GRABBER_API void AttachFunctionFrame(int handle, std::function<void(const Frame::CObject&)> object) throw(...);
+
+		// 画像を通知する関数の解除
+		GRABBER_API void DetachFunctionFrame(int handle) throw(...);
+
+		// トリガの取り込みを準備
+		GRABBER_API void ArmTrigger(int handle, int count) throw(...);
+
+		// ソフトウェアトリガを発行
+		GRABBER_API void SoftwareTrigger(int handle) throw(...);
 	}
 }
\ No newline at end of file
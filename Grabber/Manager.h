@@ -0,0 +1,260 @@
+#pragma once
+
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include "Common/Exception/Basis.h"
+#include "Common/Grabber/Setting.h"
+
+namespace Standard
+{
+	namespace Grabber
+	{
+		namespace Manager
+		{
+			//! 既定のハンドル ⇒ ハンドルを指定しない関数で使用
+			const int ConstDefaultHandle = 0;
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CTemplate
+			/// @brief      複数のカメラの制御をハンドルで管理するテンプレートのクラス
+			/// @detail		カメラごとに制御するクラスを保持して、排他制御をカメラごとに分ける
+			///				既定のハンドルは構築時に生成して、解放しない
+			/// @param[in]	T	カメラの制御を行うクラス(テンプレートで指定)
+			////////////////////////////////////////////////////////////////////////////////
+			template <class T>
+			class CTemplate
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CTemplate()
+				{
+					m_next = ConstDefaultHandle;
+
+					// 既定のハンドルを生成
+					m_workers[ConstDefaultHandle] = std::make_shared<T>();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				virtual ~CTemplate()
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncWorkers);
+
+					// ハンドルだけ走査
+					for (auto& worker : m_workers)
+					{
+						try
+						{
+							// 破棄 ⇒ 派生したクラスの破棄を呼び出すため、解放する前に行う
+							worker.second->Destroy();
+						}
+						catch (...)
+						{
+							// 例外は通知済み
+						}
+					}
+
+					m_workers.clear();
+				}
+
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			ハンドルを生成
+				/// @detail			カメラの制御を行うクラスを生成する
+				/// @return			ハンドル
+				////////////////////////////////////////////////////////////////////////////////
+				int Create()
+				{
+					int ret = 0;
+
+					std::shared_ptr<T> worker = std::make_shared<T>();
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncWorkers);
+
+					ret = ++m_next;
+
+					std::stringstream name;
+
+					// 名称を更新 ⇒ ログでカメラを区別
+					name << "Grabber[" << ret << "]::";
+					worker->SetName(name.str());
+
+					m_workers[ret] = worker;
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			ハンドルを解放
+				/// @detail			カメラを破棄してから制御を行うクラスを解放する
+				/// @param[in]		handle	ハンドル
+				////////////////////////////////////////////////////////////////////////////////
+				void Release(int handle) throw(...)
+				{
+					std::shared_ptr<T> worker = Get(handle);
+
+					// 既定のハンドルを確認
+					if (handle == ConstDefaultHandle)
+					{
+						// 既定のハンドル ⇒ 解放しない
+						throw Exception::CObject(Exception::CodeGrabberHandle, "既定のハンドルは解放不可");
+					}
+
+					// 破棄 ⇒ 他のカメラを待たせないように排他制御の外で行う
+					worker->Destroy();
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncWorkers);
+
+					m_workers.erase(handle);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			カメラの制御を行うクラスを取得
+				/// @detail			解放中でも呼び出し元の参照が残る間は有効
+				/// @param[in]		handle	ハンドル
+				/// @return			カメラの制御を行うクラス
+				////////////////////////////////////////////////////////////////////////////////
+				std::shared_ptr<T> Get(int handle) throw(...)
+				{
+					std::shared_ptr<T> ret;
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncWorkers);
+
+					auto iterator = m_workers.find(handle);
+
+					// ハンドルを確認
+					if (iterator == m_workers.end())
+					{
+						std::stringstream message;
+
+						message << "ハンドルなし:" << handle;
+
+						// 例外を発砲
+						throw Exception::CObject(Exception::CodeGrabberHandle, message.str());
+					}
+
+					ret = iterator->second;
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			ハンドルの一覧を取得
+				/// @return			ハンドルの一覧
+				////////////////////////////////////////////////////////////////////////////////
+				std::vector<int> GetHandles()
+				{
+					std::vector<int> ret;
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncWorkers);
+
+					// ハンドルだけ走査
+					for (auto& worker : m_workers)
+					{
+						ret.push_back(worker.first);
+					}
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			複数のカメラを並列に初期化
+				/// @detail			全てのカメラの完了を待ってから、最初の例外を発砲する
+				/// @param[in]		objects	ハンドルごとのデフォルトな設定クラス
+				////////////////////////////////////////////////////////////////////////////////
+				void Initialize(const std::map<int, Setting::CDefault>& objects) throw(...)
+				{
+					Parallel(objects, [](T& worker, const Setting::CDefault& object) { worker.Initialize(object); });
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			複数のカメラを並列に接続
+				/// @detail			全てのカメラの完了を待ってから、最初の例外を発砲する
+				/// @param[in]		objects	ハンドルごとの接続の設定クラス
+				////////////////////////////////////////////////////////////////////////////////
+				void Connect(const std::map<int, Setting::CConnect>& objects) throw(...)
+				{
+					Parallel(objects, [](T& worker, const Setting::CConnect& object) { worker.Connect(object); });
+				}
+
+			private:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			複数のカメラで並列に実行
+				/// @param[in]		objects	ハンドルごとの設定クラス
+				/// @param[in]		function	カメラごとに実行する関数
+				////////////////////////////////////////////////////////////////////////////////
+				template <class CSetting, class FFunction>
+				void Parallel(const std::map<int, CSetting>& objects, FFunction function) throw(...)
+				{
+					std::vector<std::future<void>> futures;
+					std::exception_ptr exception;
+
+					// ハンドルだけ走査
+					for (auto& object : objects)
+					{
+						try
+						{
+							std::shared_ptr<T> worker = Get(object.first);
+							CSetting setting = object.second;
+
+							// カメラごとに実行
+							futures.push_back(std::async(std::launch::async, [worker, setting, function] { function(*worker, setting); }));
+						}
+						catch (...)
+						{
+							if (exception == nullptr)
+							{
+								exception = std::current_exception();
+							}
+						}
+					}
+
+					// 全てのカメラの完了を待機
+					for (auto& future : futures)
+					{
+						try
+						{
+							future.get();
+						}
+						catch (...)
+						{
+							if (exception == nullptr)
+							{
+								exception = std::current_exception();
+							}
+						}
+					}
+
+					if (exception != nullptr)
+					{
+						// 例外を発砲
+						std::rethrow_exception(exception);
+					}
+				}
+
+			private:
+				//! 排他制御(カメラの制御を行うクラス)
+				std::recursive_mutex m_asyncWorkers;
+
+				//! ハンドルごとのカメラの制御を行うクラス
+				std::map<int, std::shared_ptr<T>> m_workers;
+
+				//! 最後に生成したハンドル
+				int m_next;
+			};
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <functional>
+
+#include "Thread/Worker.h"
+
+namespace Standard
+{
+	namespace Grabber
+	{
+		namespace Streaming
+		{
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CWorker
+			/// @brief      連続取り込みで画像を受け取り続けるクラス
+			///				⇒ スレッドの制御を行うテンプレートのクラスから派生
+			/// @detail		メイン関数の処理で画像を受け取る関数を呼び出し続ける
+			///				受け取る関数はタイムアウト付きで待機するため、専用のスレッドで実行する
+			////////////////////////////////////////////////////////////////////////////////
+			class CWorker
+				: virtual public Thread::Worker::CTemplate
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CWorker() : Thread::Worker::CTemplate()
+				{
+					_FunctionRetrieve = nullptr;
+
+					// 名称を更新
+					SetName("Grabber::Streaming::");
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				virtual ~CWorker()
+				{
+					// 停止
+					Stop();
+				}
+
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			画像を受け取る関数の登録
+				/// @detail			開始する前に呼び出す
+				/// @param[in]		object	画像を受け取る関数 ※戻り値は次に呼び出すまでの待ち時間[ms]
+				////////////////////////////////////////////////////////////////////////////////
+				void AttachFunctionRetrieve(std::function<int()> object)
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncFunctionRetrieve);
+
+					_FunctionRetrieve = object;
+				}
+
+			protected:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			メイン関数の処理
+				///	@detail			★継承した関数
+				/// @return			タイムアウト時間[ms]
+				////////////////////////////////////////////////////////////////////////////////
+				int MainAction() override
+				{
+					int ret = 0;
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncFunctionRetrieve);
+
+					// 画像を受け取る関数を確認
+					if (_FunctionRetrieve != nullptr)
+					{
+						// 画像を受け取る
+						ret = _FunctionRetrieve();
+					}
+					else
+					{
+						// 関数なし ⇒ 周期で待機
+						ret = GetCycle();
+					}
+
+					return ret;
+				}
+
+			private:
+				//! 排他制御クラス(画像を受け取る関数用)
+				std::recursive_mutex m_asyncFunctionRetrieve;
+
+				//! 画像を受け取る関数
+				std::function<int()> _FunctionRetrieve;
+			};
+		}
+	}
+}
\ No newline at end of file
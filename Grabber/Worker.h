@@ -1,9 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <condition_variable>
+
 #include "Common/Image/Basis.h"
 #include "Common/Grabber/Condition.h"
+#include "Common/Grabber/Frame.h"
 #include "Common/Grabber/Setting.h"
 #include "Device/Worker.h"
+#include "Notice/Worker.h"
+#include "Grabber/Streaming.h"
 
 namespace Standard
 {
@@ -11,54 +17,84 @@ namespace Standard
 	{
 		namespace Worker
 		{
+			//! 画像を受信する関数の定義
+			typedef void(OnFrame)(const Frame::CObject&);
+
+			//! 通知を待つ画像の上限
+			const size_t ConstNoticeFrame = 2;
+
+			//! 保持・通知待ち以外で使用中の画像の数 ※受け取り中と通知中
+			const size_t ConstFrameInFlight = 2;
+
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CTemplate
-			/// @brief      J̐sev[g̃NX
-			///				 foCX̐sev[g̃NXh
-			/// @param[in]	CDefault	ftHgȐݒNXw
-			/// @param[in]	CConnect	ڑ̐ݒNXw
+			/// @brief      カメラの制御を行うテンプレートのクラス
+			///				⇒ デバイスの制御を行うテンプレートのクラスから派生
+			/// @param[in]	CDefault	デフォルトな設定クラスを指定
+			/// @param[in]	CConnect	接続の設定クラスを指定
 			////////////////////////////////////////////////////////////////////////////////
 			class CTemplate
 				: virtual public Device::Worker::CTemplate<Setting::CDefault, Setting::CConnect>
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate() : Device::Worker::CTemplate<Setting::CDefault, Setting::CConnect>()
 				{
-					// ̂XV
+					// 名称を更新
 					SetName("Grabber::");
+					m_noticeFrame.SetName("Grabber::Notice::");
+
+					// 画像の通知が遅れた場合は古い画像を破棄 ⇒ 連続取り込みを止めない
+					m_noticeFrame.SetCapacity(ConstNoticeFrame, Notice::Worker::OverflowDropOldest);
+
+					// 連続取り込みで画像を受け取る関数を登録
+					m_streaming.AttachFunctionRetrieve([this] { return Retrieve(); });
+
+					m_streamingStarted = false;
+					m_frameCount = 0;
+					m_frameRead = 0;
+					m_frameLost = 0;
+					m_frameId = 0;
+					m_deviceLost = 0;
+					m_trigger = false;
+					m_armed = -1;
+					m_retrieveTimeout = 100;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CTemplate()
 				{
+					// 画像を通知する関数の解除
+					DetachFunctionFrame();
 
+					// 連続取り込みを停止
+					m_streaming.Stop();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			荞݂̏NX擾
-				/// @return			荞݂̏NX
+				/// @brief			取り込みの条件クラスを取得
+				/// @return			取り込みの条件クラス
 				////////////////////////////////////////////////////////////////////////////////
 				Condition::CCapture GetCaptureCondition()
 				{
 					Condition::CCapture ret;
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncCaptureCondition);
 
-					// 荞݂̏NX擾
+					// 取り込みの条件クラスを取得
 					ret = m_captureCondition;
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			AiOQCǂݍ
-				/// @return			AiOQCl
+				/// @brief			アナログゲインを読み込み
+				/// @return			アナログゲイン値
 				////////////////////////////////////////////////////////////////////////////////
 				double ReadAnalogGain() throw(...)
 				{
@@ -69,25 +105,25 @@ namespace Standard
 
 					logging.Message << GetName() << "ReadAnalogGain()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
 
-					// 䂪\mF
+					// 制御が可能か確認
 					IsControllable();
 
-					// AiOQCǂݍ
+					// アナログゲインを読み込み
 					ret = ReadAnalogGainDerived();
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			AiOQC
-				/// @param[in]		value	AiOQCl
+				/// @brief			アナログゲインを書き込み
+				/// @param[in]		value	アナログゲイン値
 				////////////////////////////////////////////////////////////////////////////////
 				void WriteAnalogGain(double value) throw(...)
 				{
@@ -96,23 +132,23 @@ namespace Standard
 
 					logging.Message << GetName() << "WriteAnalogGain()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
 
-					// 䂪\mF
+					// 制御が可能か確認
 					IsControllable();
 
-					// AiOQC
+					// アナログゲインを書き込み
 					WriteAnalogGainDerived(value);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fW^QCǂݍ
-				/// @return			fW^QCl
+				/// @brief			デジタルゲインを読み込み
+				/// @return			デジタルゲイン値
 				////////////////////////////////////////////////////////////////////////////////
 				double ReadDigitalGain() throw(...)
 				{
@@ -123,25 +159,25 @@ namespace Standard
 
 					logging.Message << GetName() << "ReadDigitalGain()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
 
-					// 䂪\mF
+					// 制御が可能か確認
 					IsControllable();
 
-					// fW^QCǂݍ
+					// デジタルゲインを読み込み
 					ret = ReadDigitalGainDerived();
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fW^QC
-				/// @param[in]		value	fW^QCl
+				/// @brief			デジタルゲインを書き込み
+				/// @param[in]		value	デジタルゲイン値
 				////////////////////////////////////////////////////////////////////////////////
 				void WriteDigitalGain(double value) throw(...)
 				{
@@ -150,23 +186,23 @@ namespace Standard
 
 					logging.Message << GetName() << "WriteDigitalGain()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
 
-					// 䂪\mF
+					// 制御が可能か確認
 					IsControllable();
 
-					// fW^QC
+					// デジタルゲインを書き込み
 					WriteDigitalGainDerived(value);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			IԂǂݍ
-				/// @return			I
+				/// @brief			露光時間を読み込み
+				/// @return			露光時間
 				////////////////////////////////////////////////////////////////////////////////
 				double ReadExposureTime() throw(...)
 				{
@@ -177,25 +213,25 @@ namespace Standard
 
 					logging.Message << GetName() << "ReadExposureTime()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
 
-					// 䂪\mF
+					// 制御が可能か確認
 					IsControllable();
 
-					// IԂǂݍ
+					// 露光時間を読み込み
 					ret = ReadExposureTimeDerived();
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			IԂ
-				/// @param[in]		value	I
+				/// @brief			露光時間を書き込み
+				/// @param[in]		value	露光時間
 				////////////////////////////////////////////////////////////////////////////////
 				void WriteExposureTime(double value) throw(...)
 				{
@@ -204,23 +240,50 @@ namespace Standard
 
 					logging.Message << GetName() << "WriteExposureTime()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
 
-					// 䂪\mF
+					// 制御が可能か確認
 					IsControllable();
 
-					// IԂ
+					// 露光時間を書き込み
 					WriteExposureTimeDerived(value);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			荞
-				/// @return			摜̃NX
+				/// @brief			パラメータを一括で書き込み
+				/// @detail			ゲイン、露光時間、画像の範囲を1回の排他制御で書き込む
+				/// @param[in]		object	パラメータの設定クラス ※負の値の項目は書き込まない
+				////////////////////////////////////////////////////////////////////////////////
+				void ApplyParameter(const Setting::CParameter& object) throw(...)
+				{
+					Logging::CObject logging;
+					std::stringstream postscript;
+
+					logging.Message << GetName() << "ApplyParameter()" << Logging::ConstSeparator;
+
+					// ログ出力
+					Transfer::Output(Logging::Join(logging, postscript.str()));
+					postscript.str("");
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
+
+					// 制御が可能か確認
+					IsControllable();
+
+					// パラメータを一括で書き込み
+					ApplyParameterDerived(object);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			取り込み
+				/// @detail			連続取り込み中は画像の待機前に排他制御を解除する ⇒ 待機中も停止やパラメータの変更ができる
+				/// @return			画像のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				Image::CObject Capture() throw(...)
 				{
@@ -231,40 +294,390 @@ namespace Standard
 
 					logging.Message << GetName() << "Capture()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// r
+					// 排他制御
+					std::unique_lock<std::recursive_mutex> lock(m_asyncFlag);
+
+					// 制御が可能か確認
+					IsControllable();
+
+					// デフォルトな設定クラスを取得
+					Setting::CDefault defaultSetting = GetDefaultSetting();
+
+					// 連続取り込み中を確認
+					if (IsStreaming() == false)
+					{
+						// 取り込み
+						ret = CaptureDerived();
+						return ret;
+					}
+
+					// 呼び出し後に届いた画像を待機するか
+					bool fresh = true;
+
+					// トリガで取り込み中を確認
+					if (defaultSetting.Trigger)
+					{
+						// トリガで取り込み中 ⇒ 1枚だけ準備
+						ArmTrigger(1);
+
+						// トリガの入力元を確認
+						if (defaultSetting.TriggerSource == "Software")
+						{
+							// ソフトウェアトリガを発行
+							SoftwareTriggerDerived();
+						}
+
+						// 準備後に届いた画像を待機
+						fresh = false;
+					}
+
+					// 排他制御を解除 ⇒ 画像の待機は受け取った画像用の排他制御で行う
+					lock.unlock();
+
+					// 画像を待機
+					ret = WaitFrame((int)defaultSetting.CaptureTimeout, fresh).Value;
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			最新の画像を取得
+				/// @detail			連続取り込み中に受け取った最新の画像を待たずに返す
+				/// @return			画像と付帯情報のクラス
+				////////////////////////////////////////////////////////////////////////////////
+				Frame::CObject GetLatestFrame() throw(...)
+				{
+					Frame::CObject ret;
+
+					Logging::CObject logging;
+					std::stringstream postscript;
+
+					logging.Message << GetName() << "GetLatestFrame()" << Logging::ConstSeparator;
+
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_asyncFrame);
+
+					// 連続取り込み中を確認
+					if (m_streamingStarted == false)
+					{
+						postscript << "連続取り込みが未実施";
+
+						// 例外を発砲
+						throw OutputException(Exception::CodeGrabberCaptureNotStart, logging, postscript.str());
+					}
+
+					// 画像を受け取ったか確認
+					if (m_frameCount == 0)
+					{
+						postscript << "画像データなし";
+
+						// 例外を発砲
+						throw OutputException(Exception::CodeGrabberCaptureNotImage, logging, postscript.str());
+					}
+
+					// 最新の画像を取得
+					ret = m_frames[(m_frameCount - 1) % m_frames.size()];
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			次の画像を待機
+				/// @detail			連続取り込み中に受け取った画像を受け取った順に返す
+				///					保持する画像の数を超えて遅れた場合は古い画像を読み飛ばす
+				/// @param[in]		timeout	タイムアウト[ms]
+				/// @return			画像と付帯情報のクラス
+				////////////////////////////////////////////////////////////////////////////////
+				Frame::CObject WaitNextFrame(int timeout) throw(...)
+				{
+					// 次の画像を待機
+					return WaitFrame(timeout, false);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			トリガの取り込みを準備
+				/// @detail			トリガで取り込む設定の連続取り込み中に呼び出す
+				///					未読の画像を破棄し、以降のトリガで受け取る画像を指定した数だけ保持する
+				///					準備していない間にトリガで受け取った画像は破棄する
+				/// @param[in]		count	受け取る画像の数
+				////////////////////////////////////////////////////////////////////////////////
+				void ArmTrigger(int count) throw(...)
+				{
+					Logging::CObject logging;
+					std::stringstream postscript;
+
+					logging.Message << GetName() << "ArmTrigger(" << count << ")" << Logging::ConstSeparator;
+
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_asyncFrame);
+
+					// 連続取り込み中を確認
+					if (m_streamingStarted == false)
+					{
+						postscript << "連続取り込みが未実施";
+
+						// 例外を発砲
+						throw OutputException(Exception::CodeGrabberCaptureNotStart, logging, postscript.str());
+					}
+
+					// トリガで取り込む設定を確認
+					if (m_trigger == false)
+					{
+						postscript << "トリガが無効";
+
+						// 例外を発砲
+						throw OutputException(Exception::CodeGrabberTriggerDisabled, logging, postscript.str());
+					}
+
+					// 未読の画像を破棄
+					m_frameRead = m_frameCount;
+
+					// 受け取る画像の数を更新
+					m_armed = (std::max)(0, count);
+
+					// ログ出力
+					Transfer::Output(Logging::Join(logging, postscript.str()));
+					postscript.str("");
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			トリガの取り込みで残りの受け取る画像の数を取得
+				/// @return			残りの受け取る画像の数 ※トリガが無効の場合は-1
+				////////////////////////////////////////////////////////////////////////////////
+				int GetArmRemaining()
+				{
+					int ret = 0;
+
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_asyncFrame);
+
+					ret = m_armed;
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			ソフトウェアトリガを発行
+				/// @detail			トリガの入力元がソフトウェアの場合に呼び出す
+				////////////////////////////////////////////////////////////////////////////////
+				void SoftwareTrigger() throw(...)
+				{
+					Logging::CObject logging;
+					std::stringstream postscript;
+
+					logging.Message << GetName() << "SoftwareTrigger()" << Logging::ConstSeparator;
+
+					// ログ出力
+					Transfer::Output(Logging::Join(logging, postscript.str()));
+					postscript.str("");
+
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFlag);
 
-					// 䂪\mF
+					// 制御が可能か確認
 					IsControllable();
 
-					// 荞
-					ret = CaptureDerived();
+					// ソフトウェアトリガを発行
+					SoftwareTriggerDerived();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			画像を通知する関数の登録
+				/// @detail			連続取り込みで画像を受け取るたびに呼び出されたい関数を指定する
+				///					通知が遅れた場合は古い画像を破棄する
+				///					※呼び出された関数の中で切断や破棄を行わないこと
+				/// @param[in]		object	呼び出されたい関数
+				////////////////////////////////////////////////////////////////////////////////
+				void AttachFunctionFrame(std::function<OnFrame> object)
+				{
+					// 画像の通知を開始
+					m_noticeFrame.Start();
+					m_noticeFrame.RequestInitialize();
+
+					// 画像を通知する関数の登録
+					m_noticeFrame.AttachFunctionCalled(object);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			画像を通知する関数の解除
+				////////////////////////////////////////////////////////////////////////////////
+				void DetachFunctionFrame()
+				{
+					// 画像を通知する関数の解除
+					m_noticeFrame.DetachFunctionCalled();
+
+					// 画像の通知を停止
+					m_noticeFrame.RequestDestroy();
+					m_noticeFrame.Stop();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			連続取り込みで受け取った画像の数を取得
+				/// @return			受け取った画像の数
+				////////////////////////////////////////////////////////////////////////////////
+				uint64_t GetFrameCount()
+				{
+					uint64_t ret = 0;
+
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_asyncFrame);
+
+					ret = m_frameCount;
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			次の画像の待機で読み飛ばした画像の数を取得
+				/// @return			読み飛ばした画像の数
+				////////////////////////////////////////////////////////////////////////////////
+				uint64_t GetFrameLost()
+				{
+					uint64_t ret = 0;
+
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_asyncFrame);
+
+					ret = m_frameLost;
 
 					return ret;
 				}
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			荞݂̏NXXV
-				/// @param[in]		object	荞݂̏NX
+				/// @brief			取り込みの条件クラスを更新
+				/// @param[in]		object	取り込みの条件クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void SetCaptureCondition(const Condition::CCapture& object)
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncCaptureCondition);
 
-					// 荞݂̏NXXV
+					// 取り込みの条件クラスを更新
 					m_captureCondition = object;
 				}
 
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			連続取り込みを開始
+				/// @detail			派生先の接続で呼び出す
+				///					受け取る専用のスレッドでデータストリームから画像を受け取り続ける
+				////////////////////////////////////////////////////////////////////////////////
+				void StartStreaming() throw(...)
+				{
+					Logging::CObject logging;
+					std::stringstream postscript;
+
+					logging.Message << GetName() << "StartStreaming()" << Logging::ConstSeparator;
+
+					// 連続取り込みを停止
+					StopStreaming();
+
+					// デフォルトな設定クラスを取得
+					Setting::CDefault defaultSetting = GetDefaultSetting();
+
+					// 同時に使用する画像の数までプールに保持 ⇒ 定常状態で画像のデータを確保しない
+					size_t capacity = (size_t)(std::max)(1, defaultSetting.StreamingBuffer) + ConstNoticeFrame + ConstFrameInFlight;
+
+					if (Image::CPool::Instance().GetCapacity() < capacity)
+					{
+						Image::CPool::Instance().SetCapacity(capacity);
+					}
+
+					{
+						// 排他制御
+						std::lock_guard<std::mutex> lock(m_asyncFrame);
+
+						// 保持する画像を確保
+						m_frames.assign((std::max)(1, defaultSetting.StreamingBuffer), Frame::CObject());
+						m_frameCount = 0;
+						m_frameRead = 0;
+						m_frameLost = 0;
+						m_frameId = 0;
+						m_deviceLost = 0;
+						m_trigger = defaultSetting.Trigger;
+						m_armed = m_trigger ? 0 : -1;
+						m_streamingStarted = true;
+					}
+
+					postscript << "保持する画像の数:" << defaultSetting.StreamingBuffer;
+					postscript << Logging::ConstSeparator << "プールの上限:" << Image::CPool::Instance().GetCapacity();
+
+					// ログ出力
+					Transfer::Output(Logging::Join(logging, postscript.str()));
+					postscript.str("");
+
+					// 連続取り込みを開始
+					StartStreamingDerived();
+
+					// 受け取るスレッドを開始
+					m_streaming.Start();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			連続取り込みを停止
+				/// @detail			派生先の切断で、データストリームを解放する前に呼び出す
+				////////////////////////////////////////////////////////////////////////////////
+				void StopStreaming() throw(...)
+				{
+					Logging::CObject logging;
+					std::stringstream postscript;
+
+					logging.Message << GetName() << "StopStreaming()" << Logging::ConstSeparator;
+
+					// 受け取るスレッドを停止
+					m_streaming.Stop();
+
+					{
+						// 排他制御
+						std::lock_guard<std::mutex> lock(m_asyncFrame);
+
+						// 連続取り込み中を確認
+						if (m_streamingStarted == false)
+						{
+							// 停止済み
+							return;
+						}
+
+						// 保持する画像を解放 ⇒ 画像のデータはプールへ戻る
+						m_frames.clear();
+						m_streamingStarted = false;
+					}
+
+					// 待機中の呼び出し元を起床
+					m_conditionFrame.notify_all();
+
+					// ログ出力
+					Transfer::Output(Logging::Join(logging, postscript.str()));
+					postscript.str("");
+
+					// 連続取り込みを停止
+					StopStreamingDerived();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			連続取り込み中を取得
+				/// @return			true:連続取り込み中 / false:停止中
+				////////////////////////////////////////////////////////////////////////////////
+				bool IsStreaming()
+				{
+					bool ret = false;
+
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_asyncFrame);
+
+					ret = m_streamingStarted;
+
+					return ret;
+				}
+
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ς݂̗O𔭖C
-				///					p֐
+				/// @brief			初期化済みの例外を発砲
+				///					★継承した関数
 				////////////////////////////////////////////////////////////////////////////////
 				void ExceptionInitialized() override
 				{
@@ -273,13 +686,13 @@ namespace Standard
 
 					logging.Message << GetName() << "ExceptionInitialized()" << Logging::ConstSeparator;
 
-					// O𔭖C
+					// 例外を発砲
 					OutputException(Exception::CodeGrabberInitialized, logging, postscript.str());
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			jς݂̗O𔭖C
-				///					p֐
+				/// @brief			破棄済みの例外を発砲
+				///					★継承した関数
 				////////////////////////////////////////////////////////////////////////////////
 				void ExceptionDiscarded() override
 				{
@@ -288,13 +701,13 @@ namespace Standard
 
 					logging.Message << GetName() << "ExceptionDiscarded()" << Logging::ConstSeparator;
 
-					// O𔭖C
+					// 例外を発砲
 					OutputException(Exception::CodeGrabberDiscarded, logging, postscript.str());
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̗O𔭖C
-				///					p֐
+				/// @brief			未初期化の例外を発砲
+				///					★継承した関数
 				////////////////////////////////////////////////////////////////////////////////
 				void ExceptionUninitialized() override
 				{
@@ -303,14 +716,14 @@ namespace Standard
 
 					logging.Message << GetName() << "ExceptionUninitialized()" << Logging::ConstSeparator;
 
-					// O𔭖C
+					// 例外を発砲
 					OutputException(Exception::CodeGrabberUninitialized, logging, postscript.str());
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			AiOQCǂݍ
-				///	@detail			hŋLq
-				/// @return			AiOQCl
+				/// @brief			アナログゲインを読み込み
+				///	@detail			★派生先で記述する
+				/// @return			アナログゲイン値
 				////////////////////////////////////////////////////////////////////////////////
 				virtual double ReadAnalogGainDerived() throw(...)
 				{
@@ -320,9 +733,9 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			AiOQC
-				///	@detail			hŋLq
-				/// @param[in]		value	AiOQCl
+				/// @brief			アナログゲインを書き込み
+				///	@detail			★派生先で記述する
+				/// @param[in]		value	アナログゲイン値
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void WriteAnalogGainDerived(double value) throw(...)
 				{
@@ -330,9 +743,9 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fW^QCǂݍ
-				///	@detail			hŋLq
-				/// @return			fW^QCl
+				/// @brief			デジタルゲインを読み込み
+				///	@detail			★派生先で記述する
+				/// @return			デジタルゲイン値
 				////////////////////////////////////////////////////////////////////////////////
 				virtual double ReadDigitalGainDerived() throw(...)
 				{
@@ -342,9 +755,9 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fW^QC
-				///	@detail			hŋLq
-				/// @param[in]		value	fW^QCl
+				/// @brief			デジタルゲインを書き込み
+				///	@detail			★派生先で記述する
+				/// @param[in]		value	デジタルゲイン値
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void WriteDigitalGainDerived(double value) throw(...)
 				{
@@ -352,9 +765,9 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			IԂǂݍ
-				///	@detail			hŋLq
-				/// @return			I
+				/// @brief			露光時間を読み込み
+				///	@detail			★派生先で記述する
+				/// @return			露光時間
 				////////////////////////////////////////////////////////////////////////////////
 				virtual double ReadExposureTimeDerived() throw(...)
 				{
@@ -364,9 +777,9 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			IԂ
-				///	@detail			hŋLq
-				/// @param[in]		value	I
+				/// @brief			露光時間を書き込み
+				///	@detail			★派生先で記述する
+				/// @param[in]		value	露光時間
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void WriteExposureTimeDerived(double value) throw(...)
 				{
@@ -374,9 +787,51 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			荞
-				///	@detail			hŋLq
-				/// @return			摜̃NX
+				/// @brief			パラメータを一括で書き込み
+				///	@detail			★派生先で記述する
+				///					記述しない場合はゲインと露光時間を1項目ずつ書き込む
+				///					画像の範囲は書き込めないため、指定した場合は何も書き込まずに例外を発砲する
+				/// @param[in]		object	パラメータの設定クラス
+				////////////////////////////////////////////////////////////////////////////////
+				virtual void ApplyParameterDerived(const Setting::CParameter& object) throw(...)
+				{
+					// 画像の範囲を確認
+					if (0 <= object.OffsetX || 0 <= object.OffsetY || 0 <= object.Width || 0 <= object.Height)
+					{
+						Logging::CObject logging;
+						std::stringstream postscript;
+
+						logging.Message << GetName() << "ApplyParameterDerived()" << Logging::ConstSeparator;
+
+						postscript << "画像の範囲は未対応";
+
+						// 例外を発砲
+						throw OutputException(Exception::CodeGrabberParameterSet, logging, postscript.str());
+					}
+
+					// アナログゲインを確認
+					if (0 <= object.AnalogGain)
+					{
+						WriteAnalogGainDerived(object.AnalogGain);
+					}
+
+					// デジタルゲインを確認
+					if (0 <= object.DigitalGain)
+					{
+						WriteDigitalGainDerived(object.DigitalGain);
+					}
+
+					// 露光時間を確認
+					if (0 <= object.ExposureTime)
+					{
+						WriteExposureTimeDerived(object.ExposureTime);
+					}
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			取り込み
+				///	@detail			★派生先で記述する
+				/// @return			画像のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				virtual Image::CObject CaptureDerived() throw(...)
 				{
@@ -385,12 +840,305 @@ namespace Standard
 					return ret;
 				}
 
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			連続取り込みを開始
+				///	@detail			★派生先で記述する
+				////////////////////////////////////////////////////////////////////////////////
+				virtual void StartStreamingDerived() throw(...)
+				{
+
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			連続取り込みを停止
+				///	@detail			★派生先で記述する
+				////////////////////////////////////////////////////////////////////////////////
+				virtual void StopStreamingDerived() throw(...)
+				{
+
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			ソフトウェアトリガを発行
+				///	@detail			★派生先で記述する
+				////////////////////////////////////////////////////////////////////////////////
+				virtual void SoftwareTriggerDerived() throw(...)
+				{
+
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			連続取り込みで画像を受け取る
+				///	@detail			★派生先で記述する
+				///					受け取る専用のスレッドから呼び出される
+				///					画像の番号とカメラのタイムスタンプが取得できる場合は付帯情報に設定する
+				/// @param[in]		timeout	タイムアウト[ms]
+				/// @param[out]		frame	画像と付帯情報のクラス
+				/// @return			true:受け取り / false:タイムアウト
+				////////////////////////////////////////////////////////////////////////////////
+				virtual bool RetrieveDerived(int timeout, Frame::CObject& frame) throw(...)
+				{
+					bool ret = false;
+
+					// 画像なし ⇒ タイムアウトまで待機
+					std::this_thread::sleep_for(std::chrono::milliseconds(timeout));
+
+					return ret;
+				}
+
 			private:
-				//! rNX(荞݂̏NXp)
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			連続取り込みで画像を受け取る
+				/// @detail			受け取る専用のスレッドから呼び出される
+				/// @return			次に呼び出すまでの待ち時間[ms]
+				////////////////////////////////////////////////////////////////////////////////
+				int Retrieve()
+				{
+					int ret = 0;
+
+					Logging::CObject logging;
+					std::stringstream postscript;
+					Exception::EnumCode errorCode = Exception::CodeGrabberCapture;
+					int deviceErrorCode = Exception::DeviceCodeSuccess;
+
+					logging.Message << GetName() << "Retrieve()" << Logging::ConstSeparator;
+
+					try
+					{
+						Frame::CObject frame;
+
+						// 画像を受け取る
+						if (RetrieveDerived(m_retrieveTimeout, frame))
+						{
+							// ホストで受け取った時刻を確認
+							if (frame.Information.HostTimestamp == 0)
+							{
+								// 派生先で未設定 ⇒ 現在の時刻
+								frame.Information.HostTimestamp = Frame::Now();
+							}
+
+							// 画像を保持
+							PushFrame(frame);
+						}
+					}
+					catch (const Exception::CObject& e)
+					{
+						// 例外の処理 ⇒ 例外を通知して間隔を空けて再開
+						NotifyException(e);
+						ret = m_retrieveTimeout;
+					}
+					catch (const std::exception& e)
+					{
+						// 例外の処理 ⇒ 例外を通知して間隔を空けて再開
+						NotifyException(OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						ret = m_retrieveTimeout;
+					}
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			受け取った画像を保持
+				/// @detail			保持する画像の数を超えた場合は古い画像を上書きする
+				///					画像の番号の抜けから受け取れなかった画像の累計を更新する
+				/// @param[in]		frame	画像と付帯情報のクラス
+				////////////////////////////////////////////////////////////////////////////////
+				void PushFrame(Frame::CObject& frame)
+				{
+					{
+						// 排他制御
+						std::lock_guard<std::mutex> lock(m_asyncFrame);
+
+						// 停止済みを確認
+						if (m_streamingStarted == false)
+						{
+							return;
+						}
+
+						// 画像の番号の抜けを確認 ⇒ 受け取れなかった画像の累計を更新
+						if (m_frameId != 0)
+						{
+							m_deviceLost += CountFrameLost(m_frameId, frame.Information.FrameId);
+						}
+						m_frameId = frame.Information.FrameId;
+						frame.Information.Lost = m_deviceLost;
+						frame.Information.Trigger = m_trigger;
+
+						// トリガの取り込みを確認
+						if (m_trigger)
+						{
+							// 準備していない ⇒ 破棄
+							if (m_armed <= 0)
+							{
+								return;
+							}
+
+							// 残りの受け取る画像の数を更新
+							m_armed -= 1;
+						}
+
+						// 画像を保持 ⇒ 画像のデータは共有するためコピーなし
+						m_frames[m_frameCount % m_frames.size()] = frame;
+						m_frameCount += 1;
+					}
+
+					// 待機中の呼び出し元を起床
+					m_conditionFrame.notify_all();
+
+					// 画像を通知 ※取り込みのスレッドを止めないように待機しない
+					m_noticeFrame.RequestNotice(frame, false);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			画像の番号の抜けから受け取れなかった画像の数を取得
+				/// @detail			画像の番号が戻った場合は、前回の番号が収まるビット幅(16/32/64ビット)で一周したとみなす
+				///					GigEのブロックIDは0を飛ばして1から再開する
+				///					一周とみなすと抜けが範囲の半分を超える場合は、カメラ側の番号のリセットとみなして数えない
+				/// @param[in]		previous	前回の画像の番号
+				/// @param[in]		current		今回の画像の番号
+				/// @return			受け取れなかった画像の数
+				////////////////////////////////////////////////////////////////////////////////
+				static uint64_t CountFrameLost(uint64_t previous, uint64_t current)
+				{
+					uint64_t ret = 0;
+
+					do
+					{
+						// 番号が進んだ ⇒ 間の番号が抜け
+						if (current > previous)
+						{
+							ret = current - previous - 1;
+							break;
+						}
+
+						// 前回の番号が収まる範囲の最大値
+						uint64_t maximum = (previous <= 0xFFFFULL) ? 0xFFFFULL : (previous <= 0xFFFFFFFFULL) ? 0xFFFFFFFFULL : 0xFFFFFFFFFFFFFFFFULL;
+
+						// 一周した ⇒ 最大値までと0(または1)からの番号が抜け
+						uint64_t lost = (maximum - previous) + ((current > 0) ? current - 1 : 0);
+
+						// 抜けが範囲の半分を超える ⇒ 番号のリセット
+						if (lost > maximum / 2)
+						{
+							break;
+						}
+
+						ret = lost;
+					} while (false);
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			画像を待機
+				/// @param[in]		timeout	タイムアウト[ms]
+				/// @param[in]		fresh	true:呼び出し後に届いた画像を待機 / false:未読の画像を受け取った順に取得
+				/// @return			画像と付帯情報のクラス
+				////////////////////////////////////////////////////////////////////////////////
+				Frame::CObject WaitFrame(int timeout, bool fresh) throw(...)
+				{
+					Frame::CObject ret;
+
+					Logging::CObject logging;
+					std::stringstream postscript;
+
+					logging.Message << GetName() << "WaitFrame(" << timeout << ")" << Logging::ConstSeparator;
+
+					// 排他制御
+					std::unique_lock<std::mutex> lock(m_asyncFrame);
+
+					// 未読の画像を読み飛ばす
+					if (fresh)
+					{
+						m_frameRead = m_frameCount;
+					}
+
+					// 未読の画像 or 停止を待機
+					m_conditionFrame.wait_for(lock, std::chrono::milliseconds(timeout), [this] { return m_frameRead < m_frameCount || m_streamingStarted == false; });
+
+					// 連続取り込み中を確認
+					if (m_streamingStarted == false)
+					{
+						postscript << "連続取り込みが未実施";
+
+						// 例外を発砲
+						throw OutputException(Exception::CodeGrabberCaptureNotStart, logging, postscript.str());
+					}
+
+					// 未読の画像を確認
+					if (m_frameRead >= m_frameCount)
+					{
+						postscript << "タイムアウト";
+
+						// 例外を発砲
+						throw OutputException(Exception::CodeGrabberCaptureTimeout, logging, postscript.str());
+					}
+
+					uint64_t capacity = m_frames.size();
+
+					// 保持する画像の数を超えて遅れているか確認
+					if (m_frameCount - m_frameRead > capacity)
+					{
+						// 上書きされた画像を読み飛ばす
+						m_frameLost += m_frameCount - m_frameRead - capacity;
+						m_frameRead = m_frameCount - capacity;
+					}
+
+					// 未読の画像を取得
+					ret = m_frames[m_frameRead % capacity];
+					m_frameRead += 1;
+
+					return ret;
+				}
+
+			private:
+				//! 排他制御クラス(取り込みの条件クラス用)
 				std::recursive_mutex m_asyncCaptureCondition;
 
-				//! 荞݂̏NX
+				//! 取り込みの条件クラス
 				Condition::CCapture m_captureCondition;
+
+				//! 連続取り込みで画像を受け取るクラス
+				Streaming::CWorker m_streaming;
+
+				//! 連続取り込みで画像を受け取る待ち時間[ms]
+				int m_retrieveTimeout;
+
+				//! 画像を通知するクラス
+				Notice::Worker::CTemplate<OnFrame, Frame::CObject> m_noticeFrame;
+
+				//! 排他制御クラス(保持する画像用)
+				std::mutex m_asyncFrame;
+
+				//! 画像を受け取った時の起床
+				std::condition_variable m_conditionFrame;
+
+				//! 連続取り込み中フラグ
+				bool m_streamingStarted;
+
+				//! 保持する画像(リングバッファ)
+				std::vector<Frame::CObject> m_frames;
+
+				//! 受け取った画像の数
+				uint64_t m_frameCount;
+
+				//! 読み込んだ画像の数
+				uint64_t m_frameRead;
+
+				//! 読み飛ばした画像の数
+				uint64_t m_frameLost;
+
+				//! 最後に受け取った画像の番号
+				uint64_t m_frameId;
+
+				//! 画像の番号の抜けから求めた受け取れなかった画像の累計
+				uint64_t m_deviceLost;
+
+				//! トリガで取り込む設定
+				bool m_trigger;
+
+				//! トリガの取り込みで残りの受け取る画像の数 ※トリガが無効の場合は-1
+				int m_armed;
 			};
 		}
 	}
@@ -6,7 +6,7 @@ namespace Standard
 	namespace Grabber
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			RXgN^
+		/// @brief			コンストラクタ
 		////////////////////////////////////////////////////////////////////////////////
 		CWorker::CWorker() : Worker::CTemplate()
 		{
@@ -14,10 +14,12 @@ namespace Standard
 			m_analogGain = 1;
 			m_digitalGain = 5;
 			m_exposureTime = 128;
+			m_sequence = 0;
+			m_softwareTrigger = 0;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fXgN^
+		/// @brief			デストラクタ
 		////////////////////////////////////////////////////////////////////////////////
 		CWorker::~CWorker()
 		{
@@ -25,9 +27,9 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			
-		/// @detail			̃^C~OŌĂяo
-		///					p֐
+		/// @brief			初期化
+		/// @detail			初期化のタイミングで呼び出される
+		///					★継承した関数
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::InitializeDerived()
 		{
@@ -43,29 +45,29 @@ namespace Standard
 			{
 				auto defaultSetting = GetDefaultSetting();
 
-				//@@@ ^Iȑ҂
+				//@@@ 疑似的な待ち時間
 				std::this_thread::sleep_for(std::chrono::milliseconds(500));
 
-				// K{
-				//@@@ 鏈Ȃ񂩂Lq
+				// ★必須
+				//@@@ 初期化する処理なんかを記述する
 
-				postscript << "摜̕:" << defaultSetting.ImageWidth << Logging::ConstSeparator << "摜̍:" << defaultSetting.ImageHeight;
+				postscript << "画像の幅:" << defaultSetting.ImageWidth << Logging::ConstSeparator << "画像の高さ:" << defaultSetting.ImageHeight;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			j
-		/// @detail			j̃^C~OŌĂяo
-		///					p֐
+		/// @brief			破棄
+		/// @detail			破棄のタイミングで呼び出される
+		///					★継承した関数
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::DestroyDerived()
 		{
@@ -79,27 +81,27 @@ namespace Standard
 
 			try
 			{
-				//@@@ ^Iȑ҂
+				//@@@ 疑似的な待ち時間
 				std::this_thread::sleep_for(std::chrono::milliseconds(500));
 
-				// K{
-				//@@@ j鏈Ȃ񂩂Lq
+				// ★必須
+				//@@@ 破棄する処理なんかを記述する
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ڑ
-		/// @detail			ڑ̃^C~OŌĂяo
-		///					p֐
+		/// @brief			接続
+		/// @detail			接続のタイミングで呼び出される
+		///					★継承した関数
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::ConnectDerived()
 		{
@@ -115,32 +117,61 @@ namespace Standard
 			{
 				auto connectSetting = GetConnectSetting();
 
-				//@@@ ^Iȑ҂
+				//@@@ 疑似的な待ち時間
 				std::this_thread::sleep_for(std::chrono::milliseconds(500));
 
-				// K{
-				//@@@ ڑ鏈Ȃ񂩂Lq
+				// ★必須
+				//@@@ 接続する処理なんかを記述する
 
-				postscript << "JIPAhX:" << connectSetting.Identifier;
+				postscript << "カメラのIPアドレス:" << connectSetting.Identifier;
 
-				// ڑ̏ԂڑɍXV
+				auto defaultSetting = GetDefaultSetting();
+
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncDmy);
+
+					int stride = Image::Stride(8, defaultSetting.ImageWidth);
+
+					// 疑似的な画像を生成 ⇒ 横方向のグラデーション
+					m_pattern.assign(Image::Size(8, defaultSetting.ImageHeight, defaultSetting.ImageWidth), 0);
+					for (int row = 0; row < defaultSetting.ImageHeight; row++)
+					{
+						for (int column = 0; column < defaultSetting.ImageWidth; column++)
+						{
+							m_pattern[stride * row + column] = (unsigned char)(column & 0xFF);
+						}
+					}
+					m_image.Update(8, defaultSetting.ImageHeight, defaultSetting.ImageWidth, m_pattern.data());
+					m_sequence = 0;
+					m_softwareTrigger = 0;
+				}
+
+				// 接続の状態を接続に更新
 				SetConnected(true);
 
-				// Oo
+				// 連続取り込みを確認
+				if (defaultSetting.Streaming)
+				{
+					// 連続取り込みを開始
+					StartStreaming();
+				}
+
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ؒf
-		/// @detail			ؒf̃^C~OŌĂяo
-		///					p֐
+		/// @brief			切断
+		/// @detail			切断のタイミングで呼び出される
+		///					★継承した関数
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::DisconnectDerived()
 		{
@@ -154,31 +185,34 @@ namespace Standard
 
 			try
 			{
-				//@@@ ^Iȑ҂
+				// 連続取り込みを停止
+				StopStreaming();
+
+				//@@@ 疑似的な待ち時間
 				std::this_thread::sleep_for(std::chrono::milliseconds(500));
 
-				// K{
-				//@@@ ؒf鏈Ȃ񂩂Lq
+				// ★必須
+				//@@@ 切断する処理なんかを記述する
 
-				// ڑ̏Ԃ𖢐ڑɍXV
+				// 接続の状態を未接続に更新
 				SetConnected(false);
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ڑ̏Ԃ擾
-		///	@detail			ڑ̏Ԃ擾^C~OŌĂяo
-		///					p֐
-		/// @return			true:ڑς / false:ڑ
+		/// @brief			接続の状態を取得
+		///	@detail			接続の状態を取得するタイミングで呼び出される
+		///					★継承した関数
+		/// @return			true:接続済み / false:未接続
 		////////////////////////////////////////////////////////////////////////////////
 		bool CWorker::GetConnected()
 		{
@@ -193,21 +227,21 @@ namespace Standard
 
 			try
 			{
-				// K{
-				//@@@ ڑ̏Ԃ擾鏈Lq
+				// ★必須
+				//@@@ 接続の状態を取得する処理を記述
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncDmy);
 
 				ret = m_connected;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 
@@ -215,8 +249,8 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ڑ̏ԂXV
-		/// @param[in]		value	true:ڑς / false:ڑ
+		/// @brief			接続の状態を更新
+		/// @param[in]		value	true:接続済み / false:未接続
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::SetConnected(bool value)
 		{
@@ -229,29 +263,29 @@ namespace Standard
 
 			try
 			{
-				// K{
-				//@@@ ڑ̏ԂXV鏈Lq
+				// ★必須
+				//@@@ 接続の状態を更新する処理を記述
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncDmy);
 
 				m_connected = value;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			AiOQCǂݍ
-		///	@detail			p֐
-		/// @return			AiOQCl
+		/// @brief			アナログゲインを読み込み
+		///	@detail			★継承した関数
+		/// @return			アナログゲイン値
 		////////////////////////////////////////////////////////////////////////////////
 		double CWorker::ReadAnalogGainDerived()
 		{
@@ -266,24 +300,24 @@ namespace Standard
 
 			try
 			{
-				// K{
-				//@@@ AiOQC擾鏈Lq
+				// ★必須
+				//@@@ アナログゲインを取得する処理を記述
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncDmy);
 
-				// AiOQC擾
+				// アナログゲインを取得
 				ret = m_analogGain;
 
 				postscript << ret;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 
@@ -291,9 +325,9 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			AiOQC
-		///	@detail			p֐
-		/// @param[in]		value	AiOQCl
+		/// @brief			アナログゲインを書き込み
+		///	@detail			★継承した関数
+		/// @param[in]		value	アナログゲイン値
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::WriteAnalogGainDerived(double value)
 		{
@@ -306,32 +340,32 @@ namespace Standard
 
 			try
 			{
-				// K{
-				//@@@ AiOQCXV鏈Lq
+				// ★必須
+				//@@@ アナログゲインを更新する処理を記述
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncDmy);
 
-				// AiOQCXV
+				// アナログゲインを更新
 				m_analogGain = value;
 
 				postscript << m_analogGain;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fW^QCǂݍ
-		///	@detail			p֐
-		/// @return			fW^QCl
+		/// @brief			デジタルゲインを読み込み
+		///	@detail			★継承した関数
+		/// @return			デジタルゲイン値
 		////////////////////////////////////////////////////////////////////////////////
 		double CWorker::ReadDigitalGainDerived()
 		{
@@ -346,24 +380,24 @@ namespace Standard
 
 			try
 			{
-				// K{
-				//@@@ fW^QC擾鏈Lq
+				// ★必須
+				//@@@ デジタルゲインを取得する処理を記述
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncDmy);
 
-				// fW^QC擾
+				// デジタルゲインを取得
 				ret = m_digitalGain;
 
 				postscript << ret;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 
@@ -371,9 +405,9 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fW^QC
-		///	@detail			p֐
-		/// @param[in]		value	fW^QCl
+		/// @brief			デジタルゲインを書き込み
+		///	@detail			★継承した関数
+		/// @param[in]		value	デジタルゲイン値
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::WriteDigitalGainDerived(double value)
 		{
@@ -386,32 +420,32 @@ namespace Standard
 
 			try
 			{
-				// K{
-				//@@@ fW^QCXV鏈Lq
+				// ★必須
+				//@@@ デジタルゲインを更新する処理を記述
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncDmy);
 
-				// fW^QCXV
+				// デジタルゲインを更新
 				m_digitalGain = value;
 
 				postscript << m_digitalGain;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			IԂǂݍ
-		///	@detail			p֐
-		/// @return			I
+		/// @brief			露光時間を読み込み
+		///	@detail			★継承した関数
+		/// @return			露光時間
 		////////////////////////////////////////////////////////////////////////////////
 		double CWorker::ReadExposureTimeDerived()
 		{
@@ -426,24 +460,24 @@ namespace Standard
 
 			try
 			{
-				// K{
-				//@@@ IԂ擾鏈Lq
+				// ★必須
+				//@@@ 露光時間を取得する処理を記述
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncDmy);
 
-				// IԂ擾
+				// 露光時間を取得
 				ret = m_exposureTime;
 
 				postscript << ret;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 
@@ -451,9 +485,9 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			IԂ
-		///	@detail			p֐
-		/// @param[in]		value	I
+		/// @brief			露光時間を書き込み
+		///	@detail			★継承した関数
+		/// @param[in]		value	露光時間
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::WriteExposureTimeDerived(double value)
 		{
@@ -466,32 +500,32 @@ namespace Standard
 
 			try
 			{
-				// K{
-				//@@@ IԂXV鏈Lq
+				// ★必須
+				//@@@ 露光時間を更新する処理を記述
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncDmy);
 
-				// IԂXV
+				// 露光時間を更新
 				m_exposureTime = value;
 
 				postscript << m_exposureTime;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			荞
-		///	@detail			p֐
-		/// @return			摜̃NX
+		/// @brief			取り込み
+		///	@detail			★継承した関数
+		/// @return			画像のクラス
 		////////////////////////////////////////////////////////////////////////////////
 		Image::CObject CWorker::CaptureDerived()
 		{
@@ -506,26 +540,149 @@ namespace Standard
 
 			try
 			{
-				// K{
-				//@@@ 摜擾鏈Lq
+				// ★必須
+				//@@@ 画像を取得する処理を記述
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncDmy);
 
-				// 摜擾
+				// 画像を取得
 				ret = m_image;
 
-				// Oo
+				// ログ出力
+				Transfer::Output(Logging::Join(logging, postscript.str()));
+				postscript.str("");
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理 ⇒ 例外を通知＆発砲
+				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ソフトウェアトリガを発行
+		///	@detail			★継承した関数
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::SoftwareTriggerDerived()
+		{
+			Logging::CObject logging;
+			std::stringstream postscript;
+			Exception::EnumCode errorCode = Exception::CodeGrabberParameterSet;
+			int deviceErrorCode = Exception::DeviceCodeSuccess;
+
+			logging.Message << GetName() << "SoftwareTriggerDerived()" << Logging::ConstSeparator;
+
+			try
+			{
+				// ★必須
+				//@@@ ソフトウェアトリガを発行する処理を記述
+
+				// 排他制御
+				std::lock_guard<std::recursive_mutex> lock(m_asyncDmy);
+
+				// 疑似的なソフトウェアトリガを追加
+				m_softwareTrigger += 1;
+
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
+				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			連続取り込みで画像を受け取る
+		///	@detail			疑似的なカメラとして一定の周期で画像を生成する
+		///					トリガの入力元がソフトウェアの場合は発行された数だけ画像を生成する
+		///					先頭の4バイトに画像の通番を書き込む
+		///					★継承した関数
+		/// @param[in]		timeout	タイムアウト[ms]
+		/// @param[out]		frame	画像と付帯情報のクラス
+		/// @return			true:受け取り / false:タイムアウト
+		////////////////////////////////////////////////////////////////////////////////
+		bool CWorker::RetrieveDerived(int timeout, Frame::CObject& frame)
+		{
+			bool ret = false;
+
+			Logging::CObject logging;
+			std::stringstream postscript;
+			Exception::EnumCode errorCode = Exception::CodeGrabberCapture;
+			int deviceErrorCode = Exception::DeviceCodeSuccess;
+
+			logging.Message << GetName() << "RetrieveDerived()" << Logging::ConstSeparator;
+
+			try
+			{
+				// ★必須
+				//@@@ 画像を受け取る処理を記述
+
+				//@@@ 疑似的なフレームの周期(約30fps)
+				int cycle = 33;
+
+				auto defaultSetting = GetDefaultSetting();
+
+				do
+				{
+					// フレームの周期とタイムアウトを比較
+					if (timeout < cycle)
+					{
+						// タイムアウトまで待機
+						std::this_thread::sleep_for(std::chrono::milliseconds(timeout));
+						break;
+					}
+
+					// フレームの周期まで待機
+					std::this_thread::sleep_for(std::chrono::milliseconds(cycle));
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncDmy);
+
+					// 疑似的な画像を確認
+					if (m_pattern.size() < sizeof(m_sequence))
+					{
+						break;
+					}
+
+					// トリガ and トリガの入力元を確認
+					if (defaultSetting.Trigger && defaultSetting.TriggerSource == "Software")
+					{
+						// ソフトウェアトリガなし ⇒ タイムアウト
+						if (m_softwareTrigger <= 0)
+						{
+							break;
+						}
+
+						m_softwareTrigger -= 1;
+					}
+
+					// 画像の通番を書き込み
+					m_sequence += 1;
+					::memcpy(m_pattern.data(), &m_sequence, sizeof(m_sequence));
+
+					// 画像を生成
+					frame.Value.Update(8, m_image.GetHeight(), m_image.GetWidth(), m_pattern.data());
+
+					// 付帯情報を更新 ⇒ 疑似的なカメラのタイムスタンプはホストの時刻
+					frame.Information.FrameId = m_sequence;
+					frame.Information.DeviceTimestamp = (uint64_t)Frame::Now();
+
+					ret = true;
+				} while (false);
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 
 			return ret;
 		}
 	}
-}
+}
\ No newline at end of file
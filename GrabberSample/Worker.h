@@ -8,80 +8,95 @@ namespace Standard
 	{
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CWorker
-		/// @brief      QCIԂ̐ABsNX
-		///				 J̐sev[g̃NXh
-		/// @detail		QCIԂ̐ABs
+		/// @brief      ゲインや露光時間の制御、撮像を行うクラス
+		///				⇒ カメラの制御を行うテンプレートのクラスから派生
+		/// @detail		ゲインや露光時間の制御、撮像を行う
 		////////////////////////////////////////////////////////////////////////////////
 		class CWorker
 			: virtual public Worker::CTemplate
 		{
 		public:
-			// RXgN^
+			// コンストラクタ
 			CWorker();
 
-			// fXgN^
+			// デストラクタ
 			~CWorker();
 
 		public:
-			// AiOQCǂݍ
+			// アナログゲインを読み込み
 			double ReadAnalogGainDerived() override;
 
-			// AiOQC
+			// アナログゲインを書き込み
 			void WriteAnalogGainDerived(double value) override;
 
-			// fW^QCǂݍ
+			// デジタルゲインを読み込み
 			double ReadDigitalGainDerived() override;
 
-			// fW^QC
+			// デジタルゲインを書き込み
 			void WriteDigitalGainDerived(double value) override;
 
-			// IԂǂݍ
+			// 露光時間を読み込み
 			double ReadExposureTimeDerived() override;
 
-			// IԂ
+			// 露光時間を書き込み
 			void WriteExposureTimeDerived(double value) override;
 
-			// 荞
+			// 取り込み
 			Image::CObject CaptureDerived() override;
 
+			// ソフトウェアトリガを発行
+			void SoftwareTriggerDerived() override;
+
+			// 連続取り込みで画像を受け取る
+			bool RetrieveDerived(int timeout, Frame::CObject& frame) override;
+
 		protected:
-			// 
+			// 初期化
 			void InitializeDerived() override;
 
-			// j
+			// 破棄
 			void DestroyDerived() override;
 
-			// ڑ
+			// 接続
 			void ConnectDerived() override;
 
-			// ؒf
+			// 切断
 			void DisconnectDerived() override;
 
-			// ڑ̏Ԃ擾
+			// 接続の状態を取得
 			bool GetConnected() override;
 				
 		private:
-			// ڑ̏ԂXV
+			// 接続の状態を更新
 			void SetConnected(bool value);
 
 		private:
-			//! rNX(_~[̃f[^p)
+			//! 排他制御クラス(ダミーのデータ用)
 			std::recursive_mutex m_asyncDmy;
 
-			//! ڑ̏ԃtO
+			//! 接続の状態フラグ
 			bool m_connected;
 
-			//! AiOQC̒l
+			//! アナログゲインの値
 			double m_analogGain;
 
-			//! fW^QC̒l
+			//! デジタルゲインの値
 			double m_digitalGain;
 
-			//! IԂ̒l
+			//! 露光時間の値
 			double m_exposureTime;
 
-			//! 摜
+			//! 画像
 			Image::CObject m_image;
+
+			//! 疑似的な画像のデータ
+			std::vector<unsigned char> m_pattern;
+
+			//! 疑似的な画像の通番
+			uint32_t m_sequence;
+
+			//! 疑似的なソフトウェアトリガの数
+			int m_softwareTrigger;
 		};
 	}
 }
@@ -3,16 +3,17 @@
 #include "Grabber/Grabber.h"
 #include "Common/Version/Manager.h"
 #include "Worker.h"
+#include "Grabber/Manager.h"
 
 namespace Standard
 {
 	namespace Grabber
 	{
-		//! J̐sNX
-		static CWorker _device;
+		//! ハンドルごとにカメラの制御を行うクラスを管理するクラス ⇒ ハンドルなしの関数は既定のハンドルを使用
+		static Manager::CTemplate<CWorker> _manager;
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			o[W̃NX擾
+		/// @brief			バージョンのクラスを取得
 		////////////////////////////////////////////////////////////////////////////////
 		GRABBER_API Version::CObject GetVersion()
 		{
@@ -20,169 +21,578 @@ namespace Standard
 
 			Version::CManager& versionManager = Version::CManager::Instance();
 
-			// o[W̃NX擾
+			// バージョンのクラスを取得
 			ret = versionManager.GetVersion();
 
 			return ret;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			Oʒm֐̓o^
-		/// @detail			O̔ɌĂяoꂽ֐w肷
-		/// @param[in]		object	Ăяoꂽ֐
+		/// @brief			例外を通知する関数の登録
+		/// @detail			例外の発生時に呼び出されたい関数を指定する
+		/// @param[in]		object	呼び出されたい関数
 		////////////////////////////////////////////////////////////////////////////////
 		GRABBER_API void AttachFunctionException(std::function<void(const Exception::CObject&)> object)
 		{
-			// Oʒm֐̓o^
-			_device.AttachFunctionException(object);
+			// 例外を通知する関数の登録
+			_manager.Get(Manager::ConstDefaultHandle)->AttachFunctionException(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			Oʒm֐̉
-		/// @detail			O̔ɌĂяo֐
+		/// @brief			例外を通知する関数の解除
+		/// @detail			例外の発生時に呼び出される関数を解除する
 		////////////////////////////////////////////////////////////////////////////////
 		GRABBER_API void DetachFunctionException()
 		{
-			// Oʒm֐̉
-			_device.DetachFunctionException();
+			// 例外を通知する関数の解除
+			_manager.Get(Manager::ConstDefaultHandle)->DetachFunctionException();
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			
-		/// @param[in]		object	ftHgȐݒNX
+		/// @brief			初期化
+		/// @param[in]		object	デフォルトな設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		GRABBER_API void Initialize(const Setting::CDefault& object)
 		{
-			// 
-			_device.Initialize(object);
+			// 初期化
+			_manager.Get(Manager::ConstDefaultHandle)->Initialize(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			j
+		/// @brief			破棄
 		////////////////////////////////////////////////////////////////////////////////
 		GRABBER_API void Destroy()
 		{
-			// j
-			_device.Destroy();
+			// 破棄
+			_manager.Get(Manager::ConstDefaultHandle)->Destroy();
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ڑ
-		/// @param[in]		object	ڑ̐ݒNX
+		/// @brief			接続
+		/// @param[in]		object	接続の設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		GRABBER_API void Connect(const Setting::CConnect& object)
 		{
-			// ڑ
-			_device.Connect(object);
+			// 接続
+			_manager.Get(Manager::ConstDefaultHandle)->Connect(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ؒf
+		/// @brief			切断
 		////////////////////////////////////////////////////////////////////////////////
 		GRABBER_API void Disconnect()
 		{
-			// ؒf
-			_device.Disconnect();
+			// 切断
+			_manager.Get(Manager::ConstDefaultHandle)->Disconnect();
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			荞݂̏NX擾
-		/// @return			荞݂̏NX
+		/// @brief			取り込みの条件クラスを取得
+		/// @return			取り込みの条件クラス
 		////////////////////////////////////////////////////////////////////////////////
 		GRABBER_API Condition::CCapture GetCaptureCondition()
 		{
 			Condition::CCapture ret;
 
-			// 荞݂̏NX擾
-			ret = _device.GetCaptureCondition();
+			// 取り込みの条件クラスを取得
+			ret = _manager.Get(Manager::ConstDefaultHandle)->GetCaptureCondition();
 
 			return ret;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			AiOQCǂݍ
-		/// @return			AiOQCl
+		/// @brief			アナログゲインを読み込み
+		/// @return			アナログゲイン値
 		////////////////////////////////////////////////////////////////////////////////
 		GRABBER_API double ReadAnalogGain()
 		{
 			double ret = 0;
 
-			// AiOQCǂݍ
-			ret = _device.ReadAnalogGain();
+			// アナログゲインを読み込み
+			ret = _manager.Get(Manager::ConstDefaultHandle)->ReadAnalogGain();
 
 			return ret;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			AiOQC
-		/// @param[in]		value	AiOQCl
+		/// @brief			アナログゲインを書き込み
+		/// @param[in]		value	アナログゲイン値
 		////////////////////////////////////////////////////////////////////////////////
 		GRABBER_API void WriteAnalogGain(double value)
 		{
-			// AiOQC
-			_device.WriteAnalogGain(value);
+			// アナログゲインを書き込み
+			_manager.Get(Manager::ConstDefaultHandle)->WriteAnalogGain(value);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fW^QCǂݍ
-		/// @return			fW^QCl
+		/// @brief			デジタルゲインを読み込み
+		/// @return			デジタルゲイン値
 		////////////////////////////////////////////////////////////////////////////////
 		GRABBER_API double ReadDigitalGain()
 		{
 			double ret = 0;
 
-			// fW^QCǂݍ
-			ret = _device.ReadDigitalGain();
+			// デジタルゲインを読み込み
+			ret = _manager.Get(Manager::ConstDefaultHandle)->ReadDigitalGain();
 
 			return ret;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fW^QC
-		/// @param[in]		value	fW^QCl
+		/// @brief			デジタルゲインを書き込み
+		/// @param[in]		value	デジタルゲイン値
 		////////////////////////////////////////////////////////////////////////////////
 		GRABBER_API void WriteDigitalGain(double value)
 		{
-			// fW^QC
-			_device.WriteDigitalGain(value);
+			// デジタルゲインを書き込み
+			_manager.Get(Manager::ConstDefaultHandle)->WriteDigitalGain(value);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			IԂǂݍ
-		/// @return			I
+		/// @brief			露光時間を読み込み
+		/// @return			露光時間
 		////////////////////////////////////////////////////////////////////////////////
 		GRABBER_API double ReadExposureTime()
 		{
 			double ret = 0;
 
-			// IԂǂݍ
-			ret = _device.ReadExposureTime();
+			// 露光時間を読み込み
+			ret = _manager.Get(Manager::ConstDefaultHandle)->ReadExposureTime();
 
 			return ret;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			IԂ
-		/// @param[in]		value	I
+		/// @brief			露光時間を書き込み
+		/// @param[in]		value	露光時間
 		////////////////////////////////////////////////////////////////////////////////
 		GRABBER_API void WriteExposureTime(double value)
 		{
-			// IԂ
-			_device.WriteExposureTime(value);
+			// 露光時間を書き込み
+			_manager.Get(Manager::ConstDefaultHandle)->WriteExposureTime(value);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			荞
-		/// @return			摜̃NX
+		/// @brief			パラメータを一括で書き込み
+		/// @detail			ゲイン、露光時間、画像の範囲を1回の排他制御で書き込む
+		/// @param[in]		object	パラメータの設定クラス ※負の値の項目は書き込まない
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void ApplyParameter(const Setting::CParameter& object)
+		{
+			// パラメータを一括で書き込み
+			_manager.Get(Manager::ConstDefaultHandle)->ApplyParameter(object);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			取り込み
+		/// @return			画像のクラス
 		////////////////////////////////////////////////////////////////////////////////
 		GRABBER_API Image::CObject Capture()
 		{
 			Image::CObject ret;
 
-			// 荞
-			ret = _device.Capture();
+			// 取り込み
+			ret = _manager.Get(Manager::ConstDefaultHandle)->Capture();
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			最新の画像を取得
+		/// @detail			連続取り込み中に受け取った最新の画像を待たずに返す
+		/// @return			画像と付帯情報のクラス
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API Frame::CObject GetLatestFrame()
+		{
+			Frame::CObject ret;
+
+			// 最新の画像を取得
+			ret = _manager.Get(Manager::ConstDefaultHandle)->GetLatestFrame();
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			次の画像を待機
+		/// @detail			連続取り込み中に受け取った画像を受け取った順に返す
+		/// @param[in]		timeout	タイムアウト[ms]
+		/// @return			画像と付帯情報のクラス
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API Frame::CObject WaitNextFrame(int timeout)
+		{
+			Frame::CObject ret;
+
+			// 次の画像を待機
+			ret = _manager.Get(Manager::ConstDefaultHandle)->WaitNextFrame(timeout);
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			画像を通知する関数の登録
+		/// @detail			連続取り込みで画像を受け取るたびに呼び出されたい関数を指定する
+		/// @param[in]		object	呼び出されたい関数
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void AttachFunctionFrame(std::function<void(const Frame::CObject&)> object)
+		{
+			// 画像を通知する関数の登録
+			_manager.Get(Manager::ConstDefaultHandle)->AttachFunctionFrame(object);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			画像を通知する関数の解除
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void DetachFunctionFrame()
+		{
+			// 画像を通知する関数の解除
+			_manager.Get(Manager::ConstDefaultHandle)->DetachFunctionFrame();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			トリガの取り込みを準備
+		/// @detail			以降のトリガで受け取る画像を指定した数だけ保持する
+		/// @param[in]		count	受け取る画像の数
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void ArmTrigger(int count)
+		{
+			// トリガの取り込みを準備
+			_manager.Get(Manager::ConstDefaultHandle)->ArmTrigger(count);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ソフトウェアトリガを発行
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void SoftwareTrigger()
+		{
+			// ソフトウェアトリガを発行
+			_manager.Get(Manager::ConstDefaultHandle)->SoftwareTrigger();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ハンドルを生成
+		/// @detail			カメラごとに制御するクラスを生成する
+		///					以降の関数でハンドルを指定してカメラを制御する
+		/// @return			ハンドル
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API int Create()
+		{
+			int ret = 0;
+
+			// ハンドルを生成
+			ret = _manager.Create();
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ハンドルを解放
+		/// @detail			カメラを破棄してから制御するクラスを解放する
+		/// @param[in]		handle	ハンドル
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void Release(int handle)
+		{
+			// ハンドルを解放
+			_manager.Release(handle);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ハンドルの一覧を取得
+		/// @return			ハンドルの一覧
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API std::vector<int> GetHandles()
+		{
+			std::vector<int> ret;
+
+			// ハンドルの一覧を取得
+			ret = _manager.GetHandles();
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			例外を通知する関数の登録
+		/// @detail			例外の発生時に呼び出されたい関数を指定する
+		/// @param[in]		handle	ハンドル
+		/// @param[in]		object	呼び出されたい関数
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void AttachFunctionException(int handle, std::function<void(const Exception::CObject&)> object)
+		{
+			// 例外を通知する関数の登録
+			_manager.Get(handle)->AttachFunctionException(object);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			例外を通知する関数の解除
+		/// @detail			例外の発生時に呼び出される関数を解除する
+		/// @param[in]		handle	ハンドル
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void DetachFunctionException(int handle)
+		{
+			// 例外を通知する関数の解除
+			_manager.Get(handle)->DetachFunctionException();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			初期化
+		/// @param[in]		handle	ハンドル
+		/// @param[in]		object	デフォルトな設定クラス
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void Initialize(int handle, const Setting::CDefault& object)
+		{
+			// 初期化
+			_manager.Get(handle)->Initialize(object);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			複数のカメラを並列に初期化
+		/// @detail			全てのカメラの完了を待ってから、最初の例外を発砲する
+		/// @param[in]		objects	ハンドルごとのデフォルトな設定クラス
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void Initialize(const std::map<int, Setting::CDefault>& objects)
+		{
+			// 複数のカメラを並列に初期化
+			_manager.Initialize(objects);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			破棄
+		/// @param[in]		handle	ハンドル
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void Destroy(int handle)
+		{
+			// 破棄
+			_manager.Get(handle)->Destroy();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			接続
+		/// @param[in]		handle	ハンドル
+		/// @param[in]		object	接続の設定クラス
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void Connect(int handle, const Setting::CConnect& object)
+		{
+			// 接続
+			_manager.Get(handle)->Connect(object);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			複数のカメラを並列に接続
+		/// @detail			全てのカメラの完了を待ってから、最初の例外を発砲する
+		/// @param[in]		objects	ハンドルごとの接続の設定クラス
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void Connect(const std::map<int, Setting::CConnect>& objects)
+		{
+			// 複数のカメラを並列に接続
+			_manager.Connect(objects);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			切断
+		/// @param[in]		handle	ハンドル
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void Disconnect(int handle)
+		{
+			// 切断
+			_manager.Get(handle)->Disconnect();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			取り込みの条件クラスを取得
+		/// @param[in]		handle	ハンドル
+		/// @return			取り込みの条件クラス
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API Condition::CCapture GetCaptureCondition(int handle)
+		{
+			Condition::CCapture ret;
+
+			// 取り込みの条件クラスを取得
+			ret = _manager.Get(handle)->GetCaptureCondition();
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			アナログゲインを読み込み
+		/// @param[in]		handle	ハンドル
+		/// @return			アナログゲイン値
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API double ReadAnalogGain(int handle)
+		{
+			double ret = 0;
+
+			// アナログゲインを読み込み
+			ret = _manager.Get(handle)->ReadAnalogGain();
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			アナログゲインを書き込み
+		/// @param[in]		handle	ハンドル
+		/// @param[in]		value	アナログゲイン値
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void WriteAnalogGain(int handle, double value)
+		{
+			// アナログゲインを書き込み
+			_manager.Get(handle)->WriteAnalogGain(value);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			デジタルゲインを読み込み
+		/// @param[in]		handle	ハンドル
+		/// @return			デジタルゲイン値
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API double ReadDigitalGain(int handle)
+		{
+			double ret = 0;
+
+			// デジタルゲインを読み込み
+			ret = _manager.Get(handle)->ReadDigitalGain();
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			デジタルゲインを書き込み
+		/// @param[in]		handle	ハンドル
+		/// @param[in]		value	デジタルゲイン値
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void WriteDigitalGain(int handle, double value)
+		{
+			// デジタルゲインを書き込み
+			_manager.Get(handle)->WriteDigitalGain(value);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			露光時間を読み込み
+		/// @param[in]		handle	ハンドル
+		/// @return			露光時間
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API double ReadExposureTime(int handle)
+		{
+			double ret = 0;
+
+			// 露光時間を読み込み
+			ret = _manager.Get(handle)->ReadExposureTime();
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			露光時間を書き込み
+		/// @param[in]		handle	ハンドル
+		/// @param[in]		value	露光時間
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void WriteExposureTime(int handle, double value)
+		{
+			// 露光時間を書き込み
+			_manager.Get(handle)->WriteExposureTime(value);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			パラメータを一括で書き込み
+		/// @detail			ゲイン、露光時間、画像の範囲を1回の排他制御で書き込む
+		/// @param[in]		handle	ハンドル
+		/// @param[in]		object	パラメータの設定クラス ※負の値の項目は書き込まない
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void ApplyParameter(int handle, const Setting::CParameter& object)
+		{
+			// パラメータを一括で書き込み
+			_manager.Get(handle)->ApplyParameter(object);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			取り込み
+		/// @detail			カメラごとに排他制御するため、他のカメラの取り込みを待たない
+		/// @param[in]		handle	ハンドル
+		/// @return			画像のクラス
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API Image::CObject Capture(int handle)
+		{
+			Image::CObject ret;
+
+			// 取り込み
+			ret = _manager.Get(handle)->Capture();
 
 			return ret;
 		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			最新の画像を取得
+		/// @detail			連続取り込み中に受け取った最新の画像を待たずに返す
+		/// @param[in]		handle	ハンドル
+		/// @return			画像と付帯情報のクラス
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API Frame::CObject GetLatestFrame(int handle)
+		{
+			Frame::CObject ret;
+
+			// 最新の画像を取得
+			ret = _manager.Get(handle)->GetLatestFrame();
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			次の画像を待機
+		/// @detail			連続取り込み中に受け取った画像を受け取った順に返す
+		/// @param[in]		handle	ハンドル
+		/// @param[in]		timeout	タイムアウト[ms]
+		/// @return			画像と付帯情報のクラス
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API Frame::CObject WaitNextFrame(int handle, int timeout)
+		{
+			Frame::CObject ret;
+
+			// 次の画像を待機
+			ret = _manager.Get(handle)->WaitNextFrame(timeout);
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			画像を通知する関数の登録
+		/// @detail			連続取り込みで画像を受け取るたびに呼び出されたい関数を指定する
+		/// @param[in]		handle	ハンドル
+		/// @param[in]		object	呼び出されたい関数
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void AttachFunctionFrame(int handle, std::function<void(const Frame::CObject&)> object)
+		{
+			// 画像を通知する関数の登録
+			_manager.Get(handle)->AttachFunctionFrame(object);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			画像を通知する関数の解除
+		/// @param[in]		handle	ハンドル
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void DetachFunctionFrame(int handle)
+		{
+			// 画像を通知する関数の解除
+			_manager.Get(handle)->DetachFunctionFrame();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			トリガの取り込みを準備
+		/// @detail			以降のトリガで受け取る画像を指定した数だけ保持する
+		/// @param[in]		handle	ハンドル
+		/// @param[in]		count	受け取る画像の数
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void ArmTrigger(int handle, int count)
+		{
+			// トリガの取り込みを準備
+			_manager.Get(handle)->ArmTrigger(count);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ソフトウェアトリガを発行
+		/// @param[in]		handle	ハンドル
+		////////////////////////////////////////////////////////////////////////////////
+		GRABBER_API void SoftwareTrigger(int handle)
+		{
+			// ソフトウェアトリガを発行
+			_manager.Get(handle)->SoftwareTrigger();
+		}
+
 	}
 }
\ No newline at end of file
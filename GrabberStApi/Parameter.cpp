@@ -1,5 +1,7 @@
 #include "Parameter.h"
 
+#include <algorithm>
+
 #include "Common/Logging/Basis.h"
 #include "Common/Tool/Logging.h"
 #include "Transfer/Transfer.h"
@@ -11,7 +13,7 @@ namespace Standard
 	namespace Grabber
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			RXgN^
+		/// @brief			コンストラクタ
 		////////////////////////////////////////////////////////////////////////////////
 		CParameter::CParameter()
 		{
@@ -19,7 +21,7 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fXgN^
+		/// @brief			デストラクタ
 		////////////////////////////////////////////////////////////////////////////////
 		CParameter::~CParameter()
 		{
@@ -27,9 +29,9 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			p\mF
-		/// @param[in]		nodeMap	m[h
-		/// @param[in]		item	
+		/// @brief			利用可能を確認
+		/// @param[in]		nodeMap	ノード
+		/// @param[in]		item	項目
 		////////////////////////////////////////////////////////////////////////////////
 		void CParameter::IsAvailable(const GenApi::INodeMap& nodeMap, const std::string& item)
 		{
@@ -37,37 +39,37 @@ namespace Standard
 
 			try
 			{
-				// ڂ擾
+				// 項目を取得
 				postscript << "GenApi::GetNode(" << item << ")";
 				GenApi::CBasePtr node(nodeMap.GetNode(item.c_str()));
 				postscript.str("");
 
-				// p\mF
+				// 利用可能を確認
 				if (GenApi::IsAvailable(node) == false)
 				{
-					// 
-					postscript << "ps";
+					// 無効
+					postscript << "利用不可";
 
-					// O𔭖C
+					// 例外を発砲
 					throw std::exception(postscript.str().c_str());
 				}
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ
+				// 例外の処理
 				std::stringstream message;
 
 				message << postscript.str() << Logging::ConstSeparator << e.what();
 
-				// O𔭖C
+				// 例外を発砲
 				throw std::exception(message.str().c_str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ǂݍ݉\mF
-		/// @param[in]		nodeMap	m[h
-		/// @param[in]		item	
+		/// @brief			読み込み可能を確認
+		/// @param[in]		nodeMap	ノード
+		/// @param[in]		item	項目
 		////////////////////////////////////////////////////////////////////////////////
 		void CParameter::IsRead(const GenApi::INodeMap& nodeMap, const std::string& item)
 		{
@@ -75,40 +77,40 @@ namespace Standard
 
 			try
 			{
-				// p\mF
+				// 利用可能を確認
 				IsAvailable(nodeMap, item);
 
-				// ڂ擾
+				// 項目を取得
 				postscript << "GenApi::GetNode(" << item << ")";
 				GenApi::CBasePtr node(nodeMap.GetNode(item.c_str()));
 				postscript.str("");
 
-				// ǂݍ݉\mF
+				// 読み込み可能を確認
 				if (GenApi::IsReadable(node) == false)
 				{
-					// ǂݍݕs
-					postscript << "ǂݍݕs";
+					// 読み込み不可
+					postscript << "読み込み不可";
 
-					// O𔭖C
+					// 例外を発砲
 					throw std::exception(postscript.str().c_str());
 				}
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ
+				// 例外の処理
 				std::stringstream message;
 
 				message << postscript.str() << Logging::ConstSeparator << e.what();
 
-				// O𔭖C
+				// 例外を発砲
 				throw std::exception(message.str().c_str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			݉\mF
-		/// @param[in]		nodeMap	m[h
-		/// @param[in]		item	
+		/// @brief			書き込み可能を確認
+		/// @param[in]		nodeMap	ノード
+		/// @param[in]		item	項目
 		////////////////////////////////////////////////////////////////////////////////
 		void CParameter::IsWrite(const GenApi::INodeMap& nodeMap, const std::string& item)
 		{
@@ -116,42 +118,42 @@ namespace Standard
 
 			try
 			{
-				// p\mF
+				// 利用可能を確認
 				IsAvailable(nodeMap, item);
 
-				// ڂ擾
+				// 項目を取得
 				postscript << "GenApi::GetNode(" << item << ")";
 				GenApi::CBasePtr node(nodeMap.GetNode(item.c_str()));
 				postscript.str("");
 
-				// ݉\mF
+				// 書き込み可能を確認
 				if (GenApi::IsWritable(node) == false)
 				{
-					// ݕs
-					postscript << "ݕs";
+					// 書き込み不可
+					postscript << "書き込み不可";
 
-					// O𔭖C
+					// 例外を発砲
 					throw std::exception(postscript.str().c_str());
 				}
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ
+				// 例外の処理
 				std::stringstream message;
 
 				message << postscript.str() << Logging::ConstSeparator << e.what();
 
-				// O𔭖C
+				// 例外を発砲
 				throw std::exception(message.str().c_str());
 			}
 		}
 
-		// ݒI
+		// 設定を選択
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ݒI
-		/// @param[in]		nodeMap	m[h
-		/// @param[in]		item	
-		/// @param[in]		value	l
+		/// @brief			設定を選択
+		/// @param[in]		nodeMap	ノード
+		/// @param[in]		item	項目
+		/// @param[in]		value	値
 		////////////////////////////////////////////////////////////////////////////////
 		void CParameter::Selector(const GenApi::INodeMap& nodeMap, const std::string& item, const std::string& value)
 		{
@@ -162,41 +164,41 @@ namespace Standard
 
 			try
 			{
-				// ݉\mF
+				// 書き込み可能を確認
 				IsWrite(nodeMap, item);
 
-				// ڂ擾
+				// 項目を取得
 				postscript << "GenApi::GetNode(" << item << ")";
 				GenApi::CEnumerationPtr node(nodeMap.GetNode(item.c_str()));
 				postscript.str("");
 
-				// 
+				// 書き込み
 				postscript << "GenApi::FromString(" << value << ")";
 				node->FromString(value.c_str());
 				postscript.str("");
 
-				// Oo
-				postscript << ":" << item << Logging::ConstSeparator << "l:" << value;
+				// ログ出力
+				postscript << "項目:" << item << Logging::ConstSeparator << "値:" << value;
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ
+				// 例外の処理
 				std::stringstream message;
 
 				message << postscript.str() << Logging::ConstSeparator << e.what();
 
-				// O𔭖C
+				// 例外を発砲
 				throw std::exception(message.str().c_str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ǂݍ(l)
-		/// @param[in]		nodeMap	m[h
-		/// @param[in]		item	
-		/// @return			int^̒l
+		/// @brief			読み込み(整数値)
+		/// @param[in]		nodeMap	ノード
+		/// @param[in]		item	項目
+		/// @return			int型の値
 		////////////////////////////////////////////////////////////////////////////////
 		int64_t CParameter::ReadInteger(const GenApi::INodeMap& nodeMap, const std::string& item)
 		{
@@ -209,32 +211,32 @@ namespace Standard
 
 			try
 			{
-				// ǂݍ݉\mF
+				// 読み込み可能を確認
 				IsRead(nodeMap, item);
 
-				// ڂ擾
+				// 項目を取得
 				postscript << "GenApi::GetNode(" << item << ")";
 				GenApi::CIntegerPtr node(nodeMap.GetNode(item.c_str()));
 				postscript.str("");
 
-				// ǂݍ
+				// 読み込み
 				postscript << "GenApi::GetValue()";
 				ret = node->GetValue();
 				postscript.str("");
 
-				// Oo
-				postscript << ":" << item << Logging::ConstSeparator << "l:" << ret;
+				// ログ出力
+				postscript << "項目:" << item << Logging::ConstSeparator << "値:" << ret;
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ
+				// 例外の処理
 				std::stringstream message;
 
 				message << postscript.str() << Logging::ConstSeparator << e.what();
 
-				// O𔭖C
+				// 例外を発砲
 				throw std::exception(message.str().c_str());
 			}
 
@@ -242,10 +244,10 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ǂݍ(l)
-		/// @param[in]		nodeMap	m[h
-		/// @param[in]		item	
-		/// @return			double^̒l
+		/// @brief			読み込み(実数値)
+		/// @param[in]		nodeMap	ノード
+		/// @param[in]		item	項目
+		/// @return			double型の値
 		////////////////////////////////////////////////////////////////////////////////
 		double CParameter::ReadDouble(const GenApi::INodeMap& nodeMap, const std::string& item)
 		{
@@ -258,32 +260,32 @@ namespace Standard
 
 			try
 			{
-				// ǂݍ݉\mF
+				// 読み込み可能を確認
 				IsRead(nodeMap, item);
 
-				// ڂ擾
+				// 項目を取得
 				postscript << "GenApi::GetNode(" << item << ")";
 				GenApi::CFloatPtr node(nodeMap.GetNode(item.c_str()));
 				postscript.str("");
 
-				// ǂݍ
+				// 読み込み
 				postscript << "GenApi::GetValue()";
 				ret = node->GetValue();
 				postscript.str("");
 
-				// Oo
-				postscript << ":" << item << Logging::ConstSeparator << "l:" << ret;
+				// ログ出力
+				postscript << "項目:" << item << Logging::ConstSeparator << "値:" << ret;
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ
+				// 例外の処理
 				std::stringstream message;
 
 				message << postscript.str() << Logging::ConstSeparator << e.what();
 
-				// O𔭖C
+				// 例外を発砲
 				throw std::exception(message.str().c_str());
 			}
 
@@ -291,10 +293,10 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			()
-		/// @param[in]		nodeMap	m[h
-		/// @param[in]		item	
-		/// @param[in]		value	l
+		/// @brief			書き込み(文字列)
+		/// @param[in]		nodeMap	ノード
+		/// @param[in]		item	項目
+		/// @param[in]		value	値
 		////////////////////////////////////////////////////////////////////////////////
 		void CParameter::WriteText(const GenApi::INodeMap& nodeMap, const std::string& item, const std::string& value)
 		{
@@ -305,42 +307,42 @@ namespace Standard
 
 			try
 			{
-				// ݉\mF
+				// 書き込み可能を確認
 				IsWrite(nodeMap, item);
 
-				// ڂ擾
+				// 項目を取得
 				postscript << "GenApi::GetNode(" << item << ")";
 				GenApi::CEnumerationPtr node(nodeMap.GetNode(item.c_str()));
 				postscript.str("");
 
-				// 
+				// 書き込み
 				postscript << "GenApi::FromString(" << value << ")";
 				node->FromString(value.c_str());
 				postscript.str("");
 
-				// Oo
-				postscript << ":" << item << Logging::ConstSeparator << "l:" << value;
+				// ログ出力
+				postscript << "項目:" << item << Logging::ConstSeparator << "値:" << value;
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ
+				// 例外の処理
 				std::stringstream message;
 
 				message << postscript.str() << Logging::ConstSeparator << e.what();
 
-				// O𔭖C
+				// 例外を発砲
 				throw std::exception(message.str().c_str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			(l)
-		/// @param[in]		nodeMap	m[h
-		/// @param[in]		item	
-		/// @param[in]		value	l
-		/// @return			int^̒l
+		/// @brief			書き込み(整数値)
+		/// @param[in]		nodeMap	ノード
+		/// @param[in]		item	項目
+		/// @param[in]		value	値
+		/// @return			書き込んだint型の値
 		////////////////////////////////////////////////////////////////////////////////
 		int64_t CParameter::WriteInteger(const GenApi::INodeMap& nodeMap, const std::string& item, const int64_t value)
 		{
@@ -353,55 +355,55 @@ namespace Standard
 
 			try
 			{
-				// ݉\mF
+				// 書き込み可能を確認
 				IsWrite(nodeMap, item);
 
-				// ڂ擾
+				// 項目を取得
 				postscript << "GenApi::GetNode(" << item << ")";
 				GenApi::CIntegerPtr node(nodeMap.GetNode(item.c_str()));
 				postscript.str("");
 
 				int64_t shift = 0;
 
-				// CNgLmF
+				// インクリメントが有効か確認
 				if (node->GetIncMode() != GenApi::EIncMode::noIncrement)
 				{
-					// CNgVtgvZ
+					// インクリメント分をシフトを計算する
 					shift = value % node->GetInc();
 				}
 
-				// ޒl𒲐
+				// 書き込む値を調整
 				ret = value + shift;
 
-				// 
+				// 書き込み
 				postscript << "GenApi::SetValue(" << value << ")";
 				node->SetValue(ret);
 				postscript.str("");
 
-				// Oo
-				postscript << ":" << item << Logging::ConstSeparator << "l:" << ret;
+				// ログ出力
+				postscript << "項目:" << item << Logging::ConstSeparator << "値:" << ret;
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ
+				// 例外の処理
 				std::stringstream message;
 
 				message << postscript.str() << Logging::ConstSeparator << e.what();
 
-				// O𔭖C
+				// 例外を発砲
 				throw std::exception(message.str().c_str());
 			}
 
 			return ret;
 		}
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			(l)
-		/// @param[in]		nodeMap	m[h
-		/// @param[in]		item	
-		/// @param[in]		value	l
-		/// @return			double^̒l
+		/// @brief			書き込み(実数値)
+		/// @param[in]		nodeMap	ノード
+		/// @param[in]		item	項目
+		/// @param[in]		value	値
+		/// @return			書き込んだdouble型の値
 		////////////////////////////////////////////////////////////////////////////////
 		double CParameter::WriteDouble(const GenApi::INodeMap& nodeMap, const std::string& item, const double value)
 		{
@@ -414,44 +416,44 @@ namespace Standard
 
 			try
 			{
-				// ݉\mF
+				// 書き込み可能を確認
 				IsWrite(nodeMap, item);
 
-				// ڂ擾
+				// 項目を取得
 				postscript << "GenApi::GetNode(" << item << ")";
 				GenApi::CFloatPtr node(nodeMap.GetNode(item.c_str()));
 				postscript.str("");
 
 				double shift = 0;
 
-				// CNgLmF
+				// インクリメントが有効か確認
 				if (node->GetIncMode() != GenApi::EIncMode::noIncrement)
 				{
-					// CNgVtgvZ
+					// インクリメント分をシフトを計算する
 					//@@@shift = node->GetInc();
 				}
 
-				// ޒl𒲐
+				// 書き込む値を調整
 				ret = value + shift;
 
-				// 
+				// 書き込み
 				postscript << "GenApi::SetValue(" << ret << ")";
 				node->SetValue(ret);
 				postscript.str("");
 
-				// Oo
-				postscript << ":" << item << Logging::ConstSeparator << "l:" << ret;
+				// ログ出力
+				postscript << "項目:" << item << Logging::ConstSeparator << "値:" << ret;
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ
+				// 例外の処理
 				std::stringstream message;
 
 				message << postscript.str() << Logging::ConstSeparator << e.what();
 
-				// O𔭖C
+				// 例外を発砲
 				throw std::exception(message.str().c_str());
 			}
 
@@ -459,9 +461,9 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			͈͂ǂݍ()
-		/// @param[in]		nodeMap	m[h
-		/// @return			l͈̔̓NX
+		/// @brief			範囲を読み込み(実数)
+		/// @param[in]		nodeMap	ノード
+		/// @return			実数値の範囲クラス
 		////////////////////////////////////////////////////////////////////////////////
 		Condition::CRangeDouble CParameter::ReadRange(const GenApi::INodeMap& nodeMap, const std::string& item)
 		{
@@ -474,40 +476,40 @@ namespace Standard
 
 			try
 			{
-				// ǂݍ݉\mF
+				// 読み込み可能を確認
 				IsRead(nodeMap, item);
 
-				// ڂ擾
+				// 項目を取得
 				postscript << "GenApi::GetNode(" << item << ")";
 				GenApi::CFloatPtr node(nodeMap.GetNode(item.c_str()));
 				postscript.str("");
 
-				// ŏl擾
+				// 最小値を取得
 				ret.Minimum = node->GetMin();
 
-				// ől擾
+				// 最大値を取得
 				ret.Maximum = node->GetMax();
 
-				// CNgmF
+				// インクリメントを確認
 				if (node->GetIncMode() != GenApi::EIncMode::noIncrement)
 				{
-					// CNgL  CNg擾
+					// インクリメント有効 ⇒ インクリメントを取得
 					ret.Increment = node->GetInc();
 				}
 
-				// Oo
-				postscript << ":" << item << Logging::ConstSeparator << "ŏ:" << ret.Minimum << Logging::ConstSeparator << "ő:" << ret.Maximum << Logging::ConstSeparator << "CNg:" << ret.Increment;
+				// ログ出力
+				postscript << "項目:" << item << Logging::ConstSeparator << "最小:" << ret.Minimum << Logging::ConstSeparator << "最大:" << ret.Maximum << Logging::ConstSeparator << "インクリメント:" << ret.Increment;
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ
+				// 例外の処理
 				std::stringstream message;
 
 				message << postscript.str() << Logging::ConstSeparator << e.what();
 
-				// O𔭖C
+				// 例外を発砲
 				throw std::exception(message.str().c_str());
 			}
 
@@ -515,9 +517,9 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			s
-		/// @param[in]		nodeMap	m[h
-		/// @param[in]		item	
+		/// @brief			実行
+		/// @param[in]		nodeMap	ノード
+		/// @param[in]		item	項目
 		////////////////////////////////////////////////////////////////////////////////
 		void CParameter::Execute(const GenApi::INodeMap& nodeMap, const std::string& item)
 		{
@@ -528,44 +530,612 @@ namespace Standard
 
 			try
 			{
-				// p\mF
+				// 利用可能を確認
 				IsAvailable(nodeMap, item);
 
-				// ڂ擾
+				// 項目を取得
 				postscript << "GenApi::GetNode(" << item << ")";
 				GenApi::CCommandPtr node(nodeMap.GetNode(item.c_str()));
 				postscript.str("");
 
-				// ς݂mF
+				// 完了済みを確認
 				if (node->IsDone() == false)
 				{
-					// 
-					postscript << Logging::ConstSeparator << "ς";
+					// 完了
+					postscript << Logging::ConstSeparator << "完了済み";
 
-					// O𔭖C
+					// 例外を発砲
 					throw std::exception(postscript.str().c_str());
 				}
 
-				// s
+				// 実行
 				postscript << "GenApi::Execute()";
 				node->Execute();
 				postscript.str("");
 
-				// Oo
-				postscript << ":" << item;
+				// ログ出力
+				postscript << "項目:" << item;
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ
+				// 例外の処理
+				std::stringstream message;
+
+				message << postscript.str() << Logging::ConstSeparator << e.what();
+
+				// 例外を発砲
+				throw std::exception(message.str().c_str());
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ノードを取得して保持
+		/// @detail			接続した時に1回だけ呼び出して、以降は名前での検索を省略する
+		///					カメラにない項目は保持せず、使用した時に例外を発砲する
+		/// @param[in]		nodeMap	リモートのノード
+		////////////////////////////////////////////////////////////////////////////////
+		void CParameter::Attach(const GenApi::INodeMap& nodeMap)
+		{
+			std::stringstream postscript;
+
+			try
+			{
+				// 保持したノードを解放
+				Detach();
+
+				// 項目を取得
+				postscript << "GenApi::GetNode()";
+				m_gainSelector = nodeMap.GetNode("GainSelector");
+				m_gain = nodeMap.GetNode("Gain");
+				m_exposureTime = nodeMap.GetNode("ExposureTime");
+				m_offsetX = nodeMap.GetNode("OffsetX");
+				m_offsetY = nodeMap.GetNode("OffsetY");
+				m_width = nodeMap.GetNode("Width");
+				m_height = nodeMap.GetNode("Height");
+				postscript.str("");
+
+				// 露光時間の選択 ⇒ 書き込みごとに選択しないように1回だけ選択
+				GenApi::CEnumerationPtr exposureTimeSelector(nodeMap.GetNode("ExposureTimeSelector"));
+
+				if (GenApi::IsWritable(exposureTimeSelector))
+				{
+					postscript << "GenApi::FromString(ExposureTimeSelector, Common)";
+					exposureTimeSelector->FromString("Common");
+					postscript.str("");
+				}
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理
+				std::stringstream message;
+
+				message << postscript.str() << Logging::ConstSeparator << e.what();
+
+				// 例外を発砲
+				throw std::exception(message.str().c_str());
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			保持したノードを解放
+		/// @detail			切断する前に呼び出す
+		////////////////////////////////////////////////////////////////////////////////
+		void CParameter::Detach()
+		{
+			m_gainSelector = nullptr;
+			m_gain = nullptr;
+			m_exposureTime = nullptr;
+			m_offsetX = nullptr;
+			m_offsetY = nullptr;
+			m_width = nullptr;
+			m_height = nullptr;
+
+			// 選択中のゲインを不明
+			m_selectedGain.clear();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ゲインを選択
+		/// @detail			選択中のゲインと同じ場合は書き込まない
+		/// @param[in]		selector	ゲインの選択(AnalogAll、DigitalAllなど)
+		////////////////////////////////////////////////////////////////////////////////
+		void CParameter::SelectGain(const std::string& selector)
+		{
+			std::stringstream postscript;
+
+			try
+			{
+				do
+				{
+					// 選択中のゲインを確認
+					if (m_selectedGain == selector)
+					{
+						// 選択済み
+						break;
+					}
+
+					// 書き込み可能を確認
+					if (GenApi::IsWritable(m_gainSelector) == false)
+					{
+						// 書き込み不可
+						postscript << "GainSelector" << Logging::ConstSeparator << "書き込み不可";
+
+						// 例外を発砲
+						throw std::exception(postscript.str().c_str());
+					}
+
+					// 書き込み
+					postscript << "GenApi::FromString(" << selector << ")";
+					m_gainSelector->FromString(selector.c_str());
+					postscript.str("");
+
+					m_selectedGain = selector;
+				} while (false);
+			}
+			catch (const std::exception& e)
+			{
+				// 選択中のゲインを不明
+				m_selectedGain.clear();
+
+				// 例外の処理
+				std::stringstream message;
+
+				message << postscript.str() << Logging::ConstSeparator << e.what();
+
+				// 例外を発砲
+				throw std::exception(message.str().c_str());
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			保持したノードを読み込み(実数値)
+		/// @param[in]		node	保持したノード
+		/// @param[in]		item	項目 ※例外のメッセージに使用
+		/// @return			double型の値
+		////////////////////////////////////////////////////////////////////////////////
+		double CParameter::ReadNode(const GenApi::CFloatPtr& node, const std::string& item)
+		{
+			double ret = 0;
+
+			std::stringstream postscript;
+
+			try
+			{
+				// 読み込み可能を確認
+				if (GenApi::IsReadable(node) == false)
+				{
+					// 読み込み不可
+					postscript << item << Logging::ConstSeparator << "読み込み不可";
+
+					// 例外を発砲
+					throw std::exception(postscript.str().c_str());
+				}
+
+				// 読み込み
+				postscript << "GenApi::GetValue(" << item << ")";
+				ret = node->GetValue();
+				postscript.str("");
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理
 				std::stringstream message;
 
 				message << postscript.str() << Logging::ConstSeparator << e.what();
 
-				// O𔭖C
+				// 例外を発砲
 				throw std::exception(message.str().c_str());
 			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			保持したノードに書き込み(実数値)
+		/// @param[in]		node	保持したノード
+		/// @param[in]		item	項目 ※例外のメッセージに使用
+		/// @param[in]		value	値
+		/// @return			書き込んだdouble型の値
+		////////////////////////////////////////////////////////////////////////////////
+		double CParameter::WriteNode(const GenApi::CFloatPtr& node, const std::string& item, const double value)
+		{
+			double ret = 0;
+
+			std::stringstream postscript;
+
+			try
+			{
+				// 書き込み可能を確認
+				if (GenApi::IsWritable(node) == false)
+				{
+					// 書き込み不可
+					postscript << item << Logging::ConstSeparator << "書き込み不可";
+
+					// 例外を発砲
+					throw std::exception(postscript.str().c_str());
+				}
+
+				ret = value;
+
+				// 書き込み
+				postscript << "GenApi::SetValue(" << item << ":" << ret << ")";
+				node->SetValue(ret);
+				postscript.str("");
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理
+				std::stringstream message;
+
+				message << postscript.str() << Logging::ConstSeparator << e.what();
+
+				// 例外を発砲
+				throw std::exception(message.str().c_str());
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			保持したノードを読み込み(整数値)
+		/// @param[in]		node	保持したノード
+		/// @param[in]		item	項目 ※例外のメッセージに使用
+		/// @return			int型の値
+		////////////////////////////////////////////////////////////////////////////////
+		int64_t CParameter::ReadNode(const GenApi::CIntegerPtr& node, const std::string& item)
+		{
+			int64_t ret = 0;
+
+			std::stringstream postscript;
+
+			try
+			{
+				// 読み込み可能を確認
+				if (GenApi::IsReadable(node) == false)
+				{
+					// 読み込み不可
+					postscript << item << Logging::ConstSeparator << "読み込み不可";
+
+					// 例外を発砲
+					throw std::exception(postscript.str().c_str());
+				}
+
+				// 読み込み
+				postscript << "GenApi::GetValue(" << item << ")";
+				ret = node->GetValue();
+				postscript.str("");
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理
+				std::stringstream message;
+
+				message << postscript.str() << Logging::ConstSeparator << e.what();
+
+				// 例外を発砲
+				throw std::exception(message.str().c_str());
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			保持したノードに書き込み(整数値)
+		/// @detail			現在の範囲外、インクリメントに揃っていない値は書き込まずに例外を発砲する
+		/// @param[in]		node	保持したノード
+		/// @param[in]		item	項目 ※例外のメッセージに使用
+		/// @param[in]		value	値
+		/// @return			書き込んだint型の値
+		////////////////////////////////////////////////////////////////////////////////
+		int64_t CParameter::WriteNode(const GenApi::CIntegerPtr& node, const std::string& item, const int64_t value)
+		{
+			int64_t ret = 0;
+
+			std::stringstream postscript;
+
+			try
+			{
+				// 書き込み可能を確認
+				if (GenApi::IsWritable(node) == false)
+				{
+					// 書き込み不可
+					postscript << item << Logging::ConstSeparator << "書き込み不可";
+
+					// 例外を発砲
+					throw std::exception(postscript.str().c_str());
+				}
+
+				int64_t minimum = node->GetMin();
+				int64_t maximum = node->GetMax();
+
+				// 範囲を確認
+				if (value < minimum || maximum < value)
+				{
+					// 範囲外
+					postscript << item << Logging::ConstSeparator << "範囲外:" << value << "(" << minimum << "-" << maximum << ")";
+
+					// 例外を発砲
+					throw std::exception(postscript.str().c_str());
+				}
+
+				// インクリメントが有効か確認
+				if (node->GetIncMode() != GenApi::EIncMode::noIncrement && 0 < node->GetInc() && (value - minimum) % node->GetInc() != 0)
+				{
+					// 最小値からインクリメント単位に揃っていない
+					postscript << item << Logging::ConstSeparator << "インクリメント不一致:" << value << "(" << minimum << "+" << node->GetInc() << "*n)";
+
+					// 例外を発砲
+					throw std::exception(postscript.str().c_str());
+				}
+
+				ret = value;
+
+				// 書き込み
+				postscript << "GenApi::SetValue(" << item << ":" << ret << ")";
+				node->SetValue(ret);
+				postscript.str("");
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理
+				std::stringstream message;
+
+				message << postscript.str() << Logging::ConstSeparator << e.what();
+
+				// 例外を発砲
+				throw std::exception(message.str().c_str());
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ゲインを読み込み
+		/// @param[in]		selector	ゲインの選択(AnalogAll、DigitalAllなど)
+		/// @return			ゲイン値
+		////////////////////////////////////////////////////////////////////////////////
+		double CParameter::ReadGain(const std::string& selector)
+		{
+			double ret = 0;
+
+			// ゲインを選択
+			SelectGain(selector);
+
+			// 読み込み
+			ret = ReadNode(m_gain, "Gain");
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ゲインを書き込み
+		/// @param[in]		selector	ゲインの選択(AnalogAll、DigitalAllなど)
+		/// @param[in]		value	ゲイン値
+		/// @return			書き込んだゲイン値
+		////////////////////////////////////////////////////////////////////////////////
+		double CParameter::WriteGain(const std::string& selector, const double value)
+		{
+			double ret = 0;
+
+			// ゲインを選択
+			SelectGain(selector);
+
+			// 書き込み
+			ret = WriteNode(m_gain, "Gain", value);
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			露光時間を読み込み
+		/// @return			露光時間
+		////////////////////////////////////////////////////////////////////////////////
+		double CParameter::ReadExposureTime()
+		{
+			double ret = 0;
+
+			// 読み込み
+			ret = ReadNode(m_exposureTime, "ExposureTime");
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			露光時間を書き込み
+		/// @param[in]		value	露光時間
+		/// @return			書き込んだ露光時間
+		////////////////////////////////////////////////////////////////////////////////
+		double CParameter::WriteExposureTime(const double value)
+		{
+			double ret = 0;
+
+			// 書き込み
+			ret = WriteNode(m_exposureTime, "ExposureTime", value);
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			画像の範囲を1軸だけ書き込み
+		/// @detail			縮める場合はサイズから、広げる場合はオフセットから書き込み、
+		///					途中の組み合わせがセンサの範囲を超えないようにする
+		/// @param[in]		offsetNode	オフセットのノード
+		/// @param[in]		sizeNode	サイズのノード
+		/// @param[in]		item	項目 ※例外のメッセージに使用
+		/// @param[in]		offset	オフセット ※負の値は書き込まない
+		/// @param[in]		size	サイズ ※負の値は書き込まない
+		////////////////////////////////////////////////////////////////////////////////
+		void CParameter::WriteAxis(const GenApi::CIntegerPtr& offsetNode, const GenApi::CIntegerPtr& sizeNode, const std::string& item, const int offset, const int size)
+		{
+			std::stringstream postscript;
+
+			try
+			{
+				// サイズを縮めるか確認
+				bool shrink = 0 <= size && GenApi::IsReadable(sizeNode) && size < sizeNode->GetValue();
+
+				// 縮める ⇒ サイズから書き込み
+				if (shrink)
+				{
+					WriteNode(sizeNode, item + "Size", size);
+				}
+
+				// オフセットを確認
+				if (0 <= offset)
+				{
+					WriteNode(offsetNode, item + "Offset", offset);
+				}
+
+				// 広げる ⇒ オフセットの後にサイズを書き込み
+				if (shrink == false && 0 <= size)
+				{
+					WriteNode(sizeNode, item + "Size", size);
+				}
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理
+				std::stringstream message;
+
+				message << postscript.str() << Logging::ConstSeparator << e.what();
+
+				// 例外を発砲
+				throw std::exception(message.str().c_str());
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			画像の範囲を書き込み
+		/// @detail			幅と高さは取り込みを停止中のみ書き込み可能
+		/// @param[in]		offsetX	オフセットX ※負の値は書き込まない
+		/// @param[in]		offsetY	オフセットY ※負の値は書き込まない
+		/// @param[in]		width	画像の幅 ※負の値は書き込まない
+		/// @param[in]		height	画像の高さ ※負の値は書き込まない
+		////////////////////////////////////////////////////////////////////////////////
+		void CParameter::WriteRegion(const int offsetX, const int offsetY, const int width, const int height)
+		{
+			// 横方向を書き込み
+			WriteAxis(m_offsetX, m_width, "X", offsetX, width);
+
+			// 縦方向を書き込み
+			WriteAxis(m_offsetY, m_height, "Y", offsetY, height);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			パラメータを一括で読み込み
+		/// @detail			書き込む項目(負の値以外)だけ現在の値を読み込む
+		/// @param[in]		object	パラメータの設定クラス
+		/// @return			現在のパラメータの設定クラス ※読み込まない項目は負の値
+		////////////////////////////////////////////////////////////////////////////////
+		Setting::CParameter CParameter::Read(const Setting::CParameter& object)
+		{
+			Setting::CParameter ret;
+
+			// アナログゲインを確認
+			if (0 <= object.AnalogGain)
+			{
+				ret.AnalogGain = ReadGain("AnalogAll");
+			}
+
+			// デジタルゲインを確認
+			if (0 <= object.DigitalGain)
+			{
+				ret.DigitalGain = ReadGain("DigitalAll");
+			}
+
+			// 露光時間を確認
+			if (0 <= object.ExposureTime)
+			{
+				ret.ExposureTime = ReadExposureTime();
+			}
+
+			// 画像の範囲を確認 ⇒ 1軸の書き込みで縮める順序が変わるため、オフセットとサイズは揃えて読み込む
+			if (0 <= object.OffsetX || 0 <= object.Width)
+			{
+				ret.OffsetX = (int)ReadNode(m_offsetX, "XOffset");
+				ret.Width = (int)ReadNode(m_width, "XSize");
+			}
+
+			if (0 <= object.OffsetY || 0 <= object.Height)
+			{
+				ret.OffsetY = (int)ReadNode(m_offsetY, "YOffset");
+				ret.Height = (int)ReadNode(m_height, "YSize");
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			パラメータを一括で書き込み
+		/// @detail			画像の範囲から書き込み、取り込み中などで書き込めない場合は他の項目を変更しない
+		///					選択中のゲインから書き込み、ゲインの選択の書き込みを減らす
+		///					途中で失敗した場合は書き込み前の値に戻してから例外を発砲する
+		/// @param[in]		object	パラメータの設定クラス ※負の値の項目は書き込まない
+		////////////////////////////////////////////////////////////////////////////////
+		void CParameter::Apply(const Setting::CParameter& object)
+		{
+			// 書き込み前の値を読み込み
+			Setting::CParameter previous = Read(object);
+
+			try
+			{
+				// 書き込み
+				Write(object);
+			}
+			catch (const std::exception&)
+			{
+				try
+				{
+					// 書き込み前の値に戻す
+					Write(previous);
+				}
+				catch (const std::exception&)
+				{
+					// 戻せない場合も最初の例外を優先
+				}
+
+				// 例外を再送
+				throw;
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			パラメータを順に書き込み
+		/// @param[in]		object	パラメータの設定クラス ※負の値の項目は書き込まない
+		////////////////////////////////////////////////////////////////////////////////
+		void CParameter::Write(const Setting::CParameter& object)
+		{
+			// 画像の範囲を書き込み ⇒ 取り込み中は幅と高さを書き込めないため最初に行う
+			WriteRegion(object.OffsetX, object.OffsetY, object.Width, object.Height);
+
+			// デジタルゲインが選択中か確認
+			bool digitalFirst = m_selectedGain == "DigitalAll";
+
+			// デジタルゲインを先に書き込み
+			if (digitalFirst && 0 <= object.DigitalGain)
+			{
+				WriteGain("DigitalAll", object.DigitalGain);
+			}
+
+			// アナログゲインを書き込み
+			if (0 <= object.AnalogGain)
+			{
+				WriteGain("AnalogAll", object.AnalogGain);
+			}
+
+			// デジタルゲインを後に書き込み
+			if (digitalFirst == false && 0 <= object.DigitalGain)
+			{
+				WriteGain("DigitalAll", object.DigitalGain);
+			}
+
+			// 露光時間を書き込み
+			if (0 <= object.ExposureTime)
+			{
+				WriteExposureTime(object.ExposureTime);
+			}
 		}
 	}
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Common/Grabber/Condition.h"
+#include "Common/Grabber/Setting.h"
 
 #include "StApi_TL.h"
 
@@ -10,53 +11,128 @@ namespace Standard
 	{
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CParameter
-		/// @brief      J̃p[^𐧌䂷NX
+		/// @brief      カメラのパラメータを制御するクラス
 		////////////////////////////////////////////////////////////////////////////////
 		class CParameter
 		{
 		public:
-			// RXgN^
+			// コンストラクタ
 			CParameter();
 
-			// fXgN^
+			// デストラクタ
 			~CParameter();
 
 		public:
-			// p\mF
+			// 利用可能を確認
 			void IsAvailable(const GenApi::INodeMap& nodeMap, const std::string& item) throw(...);
 
-			// ǂݍ݉\mF
+			// 読み込み可能を確認
 			void IsRead(const GenApi::INodeMap& nodeMap, const std::string& item) throw(...);
 
-			// ݉\mF
+			// 書き込み可能を確認
 			void IsWrite(const GenApi::INodeMap& nodeMap, const std::string& item) throw(...);
 
 		public:
-			// ݒI
+			// 設定を選択
 			void Selector(const GenApi::INodeMap& nodeMap, const std::string& item, const std::string& value) throw(...);
 
-			// ǂݍ(l)
+			// 読み込み(整数値)
 			int64_t ReadInteger(const GenApi::INodeMap& nodeMap, const std::string& item) throw(...);
 
-			// ǂݍ(l)
+			// 読み込み(実数値)
 			double ReadDouble(const GenApi::INodeMap& nodeMap, const std::string& item) throw(...);
 
-			// ()
+			// 書き込み(文字列)
 			void WriteText(const GenApi::INodeMap& nodeMap, const std::string& item, const std::string& value) throw(...);
 
-			// (l)
+			// 書き込み(整数値)
 			int64_t WriteInteger(const GenApi::INodeMap& nodeMap, const std::string& item, const int64_t value) throw(...);
 
-			// (l)
+			// 書き込み(実数値)
 			double WriteDouble(const GenApi::INodeMap& nodeMap, const std::string& item, const double value) throw(...);
 
 		public:
-			// ͈͂ǂݍ()
+			// 範囲を読み込み(実数)
 			Condition::CRangeDouble ReadRange(const GenApi::INodeMap& nodeMap, const std::string& item) throw(...);
 
 		public:
-			// s
+			// 実行
 			void Execute(const GenApi::INodeMap& nodeMap, const std::string& item) throw(...);
+
+		public:
+			// ノードを取得して保持
+			void Attach(const GenApi::INodeMap& nodeMap) throw(...);
+
+			// 保持したノードを解放
+			void Detach();
+
+			// ゲインを読み込み
+			double ReadGain(const std::string& selector) throw(...);
+
+			// ゲインを書き込み
+			double WriteGain(const std::string& selector, const double value) throw(...);
+
+			// 露光時間を読み込み
+			double ReadExposureTime() throw(...);
+
+			// 露光時間を書き込み
+			double WriteExposureTime(const double value) throw(...);
+
+			// 画像の範囲を書き込み
+			void WriteRegion(const int offsetX, const int offsetY, const int width, const int height) throw(...);
+
+			// パラメータを一括で読み込み
+			Setting::CParameter Read(const Setting::CParameter& object) throw(...);
+
+			// パラメータを一括で書き込み
+			void Apply(const Setting::CParameter& object) throw(...);
+
+		private:
+			// ゲインを選択
+			void SelectGain(const std::string& selector) throw(...);
+
+			// 保持したノードを読み込み(実数値)
+			double ReadNode(const GenApi::CFloatPtr& node, const std::string& item) throw(...);
+
+			// 保持したノードに書き込み(実数値)
+			double WriteNode(const GenApi::CFloatPtr& node, const std::string& item, const double value) throw(...);
+
+			// 保持したノードを読み込み(整数値)
+			int64_t ReadNode(const GenApi::CIntegerPtr& node, const std::string& item) throw(...);
+
+			// 保持したノードに書き込み(整数値)
+			int64_t WriteNode(const GenApi::CIntegerPtr& node, const std::string& item, const int64_t value) throw(...);
+
+			// パラメータを順に書き込み
+			void Write(const Setting::CParameter& object) throw(...);
+
+			// 画像の範囲を1軸だけ書き込み
+			void WriteAxis(const GenApi::CIntegerPtr& offsetNode, const GenApi::CIntegerPtr& sizeNode, const std::string& item, const int offset, const int size) throw(...);
+
+		private:
+			//! ゲインの選択
+			GenApi::CEnumerationPtr m_gainSelector;
+
+			//! ゲイン
+			GenApi::CFloatPtr m_gain;
+
+			//! 露光時間
+			GenApi::CFloatPtr m_exposureTime;
+
+			//! オフセットX
+			GenApi::CIntegerPtr m_offsetX;
+
+			//! オフセットY
+			GenApi::CIntegerPtr m_offsetY;
+
+			//! 画像の幅
+			GenApi::CIntegerPtr m_width;
+
+			//! 画像の高さ
+			GenApi::CIntegerPtr m_height;
+
+			//! 選択中のゲイン ※空は不明
+			std::string m_selectedGain;
 		};
 	}
 }
@@ -0,0 +1,260 @@
+#include "System.h"
+
+#include <future>
+#include <sstream>
+#include <vector>
+
+#include "Common/Logging/Basis.h"
+
+namespace Standard
+{
+	namespace Grabber
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			コンストラクタ
+		////////////////////////////////////////////////////////////////////////////////
+		CSystem::CSystem()
+		{
+			m_reference = 0;
+			m_listed = false;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			デストラクタ
+		////////////////////////////////////////////////////////////////////////////////
+		CSystem::~CSystem()
+		{
+
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			システムを参照
+		/// @detail			最初の参照でライブラリを初期化してシステムを生成する
+		////////////////////////////////////////////////////////////////////////////////
+		void CSystem::Acquire()
+		{
+			std::stringstream postscript;
+
+			try
+			{
+				// 排他制御
+				std::lock_guard<std::recursive_mutex> lock(m_asyncSystem);
+
+				// 参照を確認
+				if (m_reference == 0)
+				{
+					// ライブラリを初期化
+					postscript << "StApi::StApiInitialize()";
+					StApi::StApiInitialize();
+					postscript.str("");
+
+					StApi::EStSystemVendor_t systemVendor = StApi::EStSystemVendor_t::StSystemVendor_Default;
+					StApi::EStInterfaceType_t interfaceType = StApi::EStInterfaceType_t::StInterfaceType_All;
+
+					// システムモジュールを開く
+					postscript << "StApi::CreateIStSystem()";
+					m_stSystem.Reset(StApi::CreateIStSystem(systemVendor, interfaceType));
+					postscript.str("");
+
+					m_listed = false;
+				}
+
+				m_reference++;
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理
+				std::stringstream message;
+
+				message << postscript.str() << Logging::ConstSeparator << e.what();
+
+				// 例外を発砲
+				throw std::exception(message.str().c_str());
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			システムの参照を解除
+		/// @detail			最後の参照でシステムを解放してライブラリを破棄する
+		////////////////////////////////////////////////////////////////////////////////
+		void CSystem::Release()
+		{
+			std::stringstream postscript;
+
+			try
+			{
+				// 排他制御
+				std::lock_guard<std::recursive_mutex> lock(m_asyncSystem);
+
+				do
+				{
+					// 参照を確認
+					if (m_reference <= 0)
+					{
+						// 参照なし
+						break;
+					}
+
+					m_reference--;
+
+					// 参照を確認
+					if (0 < m_reference)
+					{
+						// 他のカメラが参照中
+						break;
+					}
+
+					// システムを開放
+					postscript << "StApi::System::Reset()";
+					m_stSystem.Reset();
+					postscript.str("");
+
+					// ライブラリを破棄
+					postscript << "StApi::StApiTerminate()";
+					StApi::StApiTerminate();
+					postscript.str("");
+				} while (false);
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理
+				std::stringstream message;
+
+				message << postscript.str() << Logging::ConstSeparator << e.what();
+
+				// 例外を発砲
+				throw std::exception(message.str().c_str());
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			システムを取得
+		/// @return			システム
+		////////////////////////////////////////////////////////////////////////////////
+		StApi::IStSystem* CSystem::GetSystem()
+		{
+			StApi::IStSystem* ret = nullptr;
+
+			// 排他制御
+			std::lock_guard<std::recursive_mutex> lock(m_asyncSystem);
+
+			// システムを確認
+			if (m_stSystem.IsValid() == false)
+			{
+				// 例外を発砲
+				throw std::exception("システム未確定");
+			}
+
+			ret = m_stSystem;
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			カメラの検索を排他制御
+		/// @detail			インターフェースのノード(DeviceSelectorなど)は共有のため、
+		///					検索から予約までを排他制御する
+		/// @return			排他制御のロック
+		////////////////////////////////////////////////////////////////////////////////
+		std::unique_lock<std::recursive_mutex> CSystem::Lock()
+		{
+			return std::unique_lock<std::recursive_mutex>(m_asyncSearch);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			デバイスリストを更新
+		/// @detail			インターフェースごとに並列に更新する
+		///					同時に接続する他のカメラが更新した直後は更新しない
+		/// @param[in]		interval	更新しない間隔[ms]
+		////////////////////////////////////////////////////////////////////////////////
+		void CSystem::UpdateDeviceList(int interval)
+		{
+			std::stringstream postscript;
+
+			try
+			{
+				// 排他制御
+				std::lock_guard<std::recursive_mutex> lock(m_asyncSearch);
+
+				do
+				{
+					std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+					// 更新した時刻を確認
+					if (m_listed && now - m_updated < std::chrono::milliseconds(interval))
+					{
+						// 更新した直後 ⇒ 更新済みのデバイスリストを使用
+						break;
+					}
+
+					StApi::IStSystem* stSystem = GetSystem();
+
+					// インターフェース数を取得
+					uint32_t interfaceCount = stSystem->GetInterfaceCount();
+
+					std::vector<std::future<void>> futures;
+
+					// インターフェースだけ走査
+					for (uint32_t interfaceIndex = 0; interfaceIndex < interfaceCount; interfaceIndex++)
+					{
+						// インターフェースを取得
+						StApi::IStInterface *stInterface = stSystem->GetIStInterface(interfaceIndex);
+
+						// 接続されているデバイス(カメラ)を検出 ⇒ インターフェースごとに並列
+						futures.push_back(std::async(std::launch::async, [stInterface] { stInterface->UpdateDeviceList(); }));
+					}
+
+					// 全てのインターフェースの完了を待機
+					postscript << "StApi::Interface::UpdateDeviceList()";
+					for (auto& future : futures)
+					{
+						future.get();
+					}
+					postscript.str("");
+
+					m_updated = std::chrono::steady_clock::now();
+					m_listed = true;
+				} while (false);
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理
+				std::stringstream message;
+
+				message << postscript.str() << Logging::ConstSeparator << e.what();
+
+				// 例外を発砲
+				throw std::exception(message.str().c_str());
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			カメラを予約
+		/// @param[in]		identifier	カメラの識別子
+		/// @return			true:予約した / false:他のカメラが予約済み
+		////////////////////////////////////////////////////////////////////////////////
+		bool CSystem::Reserve(const std::string& identifier)
+		{
+			bool ret = false;
+
+			// 排他制御
+			std::lock_guard<std::recursive_mutex> lock(m_asyncSearch);
+
+			ret = m_reserved.insert(identifier).second;
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			カメラの予約を解除
+		/// @param[in]		identifier	カメラの識別子
+		////////////////////////////////////////////////////////////////////////////////
+		void CSystem::Cancel(const std::string& identifier)
+		{
+			// 排他制御
+			std::lock_guard<std::recursive_mutex> lock(m_asyncSearch);
+
+			m_reserved.erase(identifier);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include "Common/Singleton/Worker.h"
+
+#include "StApi_TL.h"
+
+namespace Standard
+{
+	namespace Grabber
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CSystem
+		/// @brief      複数のカメラで共有するシステムのクラス
+		///				⇒ シングルトン化するテンプレートのクラスから継承
+		/// @detail		ライブラリとシステムは最初の初期化で生成し、最後の破棄で解放する
+		///				カメラの検索だけ排他制御して、接続したカメラは重複しないように予約する
+		////////////////////////////////////////////////////////////////////////////////
+		class CSystem
+			: virtual public Singleton::Worker::CTemplate<CSystem>
+		{
+		public:
+			// コンストラクタ
+			CSystem();
+
+			// デストラクタ
+			virtual ~CSystem();
+
+		public:
+			// システムを参照
+			void Acquire() throw(...);
+
+			// システムの参照を解除
+			void Release() throw(...);
+
+			// システムを取得
+			StApi::IStSystem* GetSystem() throw(...);
+
+			// カメラの検索を排他制御
+			std::unique_lock<std::recursive_mutex> Lock();
+
+			// デバイスリストを更新
+			void UpdateDeviceList(int interval) throw(...);
+
+			// カメラを予約
+			bool Reserve(const std::string& identifier);
+
+			// カメラの予約を解除
+			void Cancel(const std::string& identifier);
+
+		private:
+			//! 排他制御(システム)
+			std::recursive_mutex m_asyncSystem;
+
+			//! 排他制御(カメラの検索)
+			std::recursive_mutex m_asyncSearch;
+
+			//! システム
+			StApi::CIStSystemPtr m_stSystem;
+
+			//! システムを参照している数
+			int m_reference;
+
+			//! デバイスリストを更新した時刻
+			std::chrono::steady_clock::time_point m_updated;
+
+			//! デバイスリストを更新済みか
+			bool m_listed;
+
+			//! 予約したカメラの識別子
+			std::set<std::string> m_reserved;
+		};
+	}
+}
\ No newline at end of file
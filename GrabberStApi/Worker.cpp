@@ -1,43 +1,52 @@
 #include "Worker.h"
 #include "Common/Utility/StopWatch.h"
+#include "Common/Image/Format.h"
 
 namespace Standard
 {
 	namespace Grabber
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			o^R[obN֐
-		/// @param[in]		node	m[h
-		/// @param[in]		me	g̃NX
+		/// @brief			登録するコールバック関数
+		/// @param[in]		node	ノード
+		/// @param[in]		me	自身のクラス
 		////////////////////////////////////////////////////////////////////////////////
 		void __stdcall OnNodeCallbackFunction(GenApi::INode* node, CWorker* me)
 		{
 			if (me)
 			{
-				// R[obNĂяo
+				// コールバックから呼び出し
 				me->ReceiveNode(node);
 			}
 		};
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			RXgN^
+		/// @brief			コンストラクタ
 		////////////////////////////////////////////////////////////////////////////////
 		CWorker::CWorker() : Worker::CTemplate()
 		{
-
+			m_listInterval = 1000;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fXgN^
+		/// @brief			デストラクタ
 		////////////////////////////////////////////////////////////////////////////////
 		CWorker::~CWorker()
 		{
-
+			try
+			{
+				// 連続取り込みを停止 ⇒ 受け取るスレッドが派生したクラスを呼び出すため、派生したクラスの破棄前に行う
+				StopStreaming();
+			}
+			catch (...)
+			{
+				// 例外は通知済み
+			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			foCXXgmF
-		/// @return			foCXXg̏
+		/// @brief			デバイスロストを確認
+		/// @return			デバイスロストの状態
 		////////////////////////////////////////////////////////////////////////////////
 		bool CWorker::IsDeviceLost()
 		{
@@ -52,32 +61,32 @@ namespace Standard
 
 			try
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
 				do
 				{
-					// C^[tF[XmF
+					// インターフェースを確認
 					if (m_stDevice.IsValid() == false)
 					{
-						// C^[tF[Xm  foCXXgȂ
+						// インターフェース未確定 ⇒ デバイスロストなし
 						break;
 					}
 
-					// f[^Xg[mF
+					// データストリームを確認
 					if (m_stDataStream.IsValid() == false)
 					{
-						// f[^Xg[m  foCXXgȂ
+						// データストリーム未確定 ⇒ デバイスロストなし
 						break;
 					}
 
-					// foCXXg̏Ԃ擾
+					// デバイスロストの状態を取得
 					ret = m_stDevice->IsDeviceLost();
 				} while (false);
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 
@@ -85,9 +94,9 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			R[obNĂяo֐
-		/// @detail			R[obNɌĂяoĂ炤
-		/// @param[in]		node	m[h
+		/// @brief			コールバックから呼び出し関数
+		/// @detail			コールバック発生時に呼び出してもらう
+		/// @param[in]		node	ノード
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::ReceiveNode(GenApi::INode* node)
 		{
@@ -100,31 +109,31 @@ namespace Standard
 
 			try
 			{
-				// foCXXg̏ԂmF
+				// デバイスロストの状態を確認
 				if (IsDeviceLost())
 				{
-					// foCXXg
+					// デバイスロスト発生
 					postscript << "DeviceLost";
 
-					// Ȍo
+					// 例外の出力
 					Exception::CObject exception = OutputException(errorCode, logging, postscript.str());
 
-					// Oʒm
+					// 例外を通知
 					NotifyException(exception);
 				}
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  Oʒm
+				// 例外の処理 ⇒ 例外を通知
 				OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			foCXmF
-		/// @param[in]		setting	ڑ̐ݒNX
-		/// @param[in]		nodeMap	C^[tF[X̃m[h
-		/// @param[in]		index	foCX̔ԍ
+		/// @brief			デバイスを確認
+		/// @param[in]		setting	接続の設定クラス
+		/// @param[in]		nodeMap	インターフェースのノード
+		/// @param[in]		index	デバイスの番号
 		////////////////////////////////////////////////////////////////////////////////
 		bool CWorker::IsDevice(const Setting::CConnect& setting, const GenApi::INodeMap& nodeMap, const uint32_t index)
 		{
@@ -137,31 +146,31 @@ namespace Standard
 
 			do
 			{
-				// J̎ʎqmF
+				// カメラの識別子を確認
 				if (setting.Identifier.empty() == false)
 				{
-					// ʎq  IPAhXőI
+					// 識別子あり ⇒ IPアドレスで選択
 					GenApi::CIntegerPtr deviceIpAddress(nodeMap.GetNode("GevDeviceIPAddress"));
 
-					// IPAhXLmF
+					// IPアドレスが有効か確認
 					if (GenApi::IsAvailable(deviceIpAddress))
 					{
 						std::string ipAddress = deviceIpAddress->ToString().c_str();
 
-						// IPAhXvĂ邩mF
+						// IPアドレスが一致しているか確認
 						if (setting.Identifier.compare(ipAddress) != 0)
 						{
-							// sv
+							// 不一致
 							break;
 						}
 					}
 				}
 				else
 				{
-					// ̑  擪ɌfoCXI
+					// その他 ⇒ 先頭に見つかったデバイスを選択
 				}
 
-				// foCXL
+				// デバイスが有効
 				ret = true;
 			} while (false);
 
@@ -169,9 +178,9 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			p[^ftHgɖ߂
-		/// @param[in]		nodeMap	C^[tF[X̃[gm[h
-		/// @param[in]		object	ftHgȐݒNX
+		/// @brief			パラメータをデフォルトに戻す
+		/// @param[in]		nodeMap	インターフェースのリモートノード
+		/// @param[in]		object	デフォルトな設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::DefaultParameter(const GenApi::INodeMap& nodeMap, const Setting::CDefault& setting)
 		{
@@ -184,103 +193,121 @@ namespace Standard
 			{
 				CParameter parameter;
 
-				// [U[ݒftHgɕύX
+				// ユーザー設定をデフォルトに変更
 				parameter.WriteText(nodeMap, "UserSetSelector", "Default");
 
-				// [Uݒ[h
+				// ユーザ設定をロード
 				parameter.Execute(nodeMap, "UserSetLoad");
 
-				// 荞݉񐔂1
-				parameter.WriteText(nodeMap, "AcquisitionMode", "SingleFrame");
+				// 連続取り込みを確認
+				if (setting.Streaming)
+				{
+					// 取り込み回数を連続
+					parameter.WriteText(nodeMap, "AcquisitionMode", "Continuous");
+				}
+				else
+				{
+					// 取り込み回数を1回
+					parameter.WriteText(nodeMap, "AcquisitionMode", "SingleFrame");
+				}
 
-				// t[JngK̑I
+				// フレーム開始トリガの選択
 				parameter.Selector(nodeMap, "TriggerSelector", "FrameStart");
 
-				// gK𖳌
-				parameter.WriteText(nodeMap, "TriggerMode", "Off");
+				// トリガを確認
+				if (setting.Trigger)
+				{
+					// トリガを有効
+					parameter.WriteText(nodeMap, "TriggerMode", "On");
 
-				//// gK\tgEFAgK
-				//parameter.WriteText(nodeMap, "TriggerSource", "Software");
+					// トリガの入力元を変更
+					parameter.WriteText(nodeMap, "TriggerSource", setting.TriggerSource);
+				}
+				else
+				{
+					// トリガを無効
+					parameter.WriteText(nodeMap, "TriggerMode", "Off");
+				}
 
-				// 荞݂̏NX擾
+				// 取り込みの条件クラスを取得
 				Condition::CCapture captureCondition = GetCaptureCondition();
 
-				// ZT̍ő啝擾
+				// センサの最大幅を取得
 				captureCondition.WidthMaximum = (int)parameter.ReadInteger(nodeMap, "WidthMax");
 
 				int64_t imageWidth = captureCondition.WidthMaximum;
 
-				// 摜̕ݒ肳Ă and ZT̍ő啝菬mF
+				// 画像の幅が設定されている and センサの最大幅より小さいか確認
 				if (0 < setting.ImageWidth && setting.ImageWidth < captureCondition.WidthMaximum)
 				{
-					// 摜̕ύX
+					// 画像の幅を変更
 					imageWidth = setting.ImageWidth;
 				}
 
-				// 摜̕ύX
+				// 画像の幅を変更
 				imageWidth = parameter.WriteInteger(nodeMap, "Width", imageWidth);
 
-				// ItZbgXvZ
+				// オフセットXを計算
 				int64_t offsetX = (int64_t)std::round((double)(captureCondition.WidthMaximum - imageWidth) / 2);
 
-				// ItZbgXύX
+				// オフセットXを変更
 				parameter.WriteInteger(nodeMap, "OffsetX", offsetX);
 
-				// ZT̍ő卂擾
+				// センサの最大高さを取得
 				captureCondition.HeightMaximum = (int)parameter.ReadInteger(nodeMap, "HeightMax");
 
 				int64_t imageHeight = captureCondition.HeightMaximum;
 
-				// 摜̍ݒ肳Ă and ZT̍ő卂菬mF
+				// 画像の高さが設定されている and センサの最大高さより小さいか確認
 				if (0 < setting.ImageHeight && setting.ImageHeight < captureCondition.HeightMaximum)
 				{
-					// 摜̍ύX
+					// 画像の高さを変更
 					imageHeight = setting.ImageHeight;
 				}
 
-				// 摜̍ύX
+				// 画像の高さを変更
 				imageHeight = parameter.WriteInteger(nodeMap, "Height", imageHeight);
 
-				// ItZbgYvZ
+				// オフセットYを計算
 				int64_t offsetY = (int64_t)std::round((double)(captureCondition.HeightMaximum - imageHeight) / 2);
 
-				// ItZbgYύX
+				// オフセットYを変更
 				parameter.WriteInteger(nodeMap, "OffsetY", offsetY);
 
-				// AiOQC̑I
+				// アナログゲインの選択
 				parameter.Selector(nodeMap, "GainSelector", "AnalogAll");
 
-				// AiOQC͈̔͂ǂݍ
+				// アナログゲインの範囲を読み込み
 				captureCondition.AnalogGain = parameter.ReadRange(nodeMap, "Gain");
 
-				// fW^QC̑I
+				// デジタルゲインの選択
 				parameter.Selector(nodeMap, "GainSelector", "DigitalAll");
 
-				// fW^QC͈̔͂ǂݍ
+				// デジタルゲインの範囲を読み込み
 				captureCondition.DigitalGain = parameter.ReadRange(nodeMap, "Gain");
 
-				// IԂ͈̔͂ǂݍ
+				// 露光時間の範囲を読み込み
 				captureCondition.ExposureTime = parameter.ReadRange(nodeMap, "ExposureTime");
 
-				// 荞݂̏XV
+				// 取り込みの条件を更新
 				SetCaptureCondition(captureCondition);
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ
+				// 例外の処理
 				std::stringstream message;
 
 				message << postscript.str() << Logging::ConstSeparator << e.what();
 
-				// O𔭖C
+				// 例外を発砲
 				throw std::exception(message.str().c_str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			HeartbeatXV
-		/// @param[in]		nodeMap	C^[tF[X̃[gm[h
-		/// @param[in]		timeout	^CAEg[us]
+		/// @brief			Heartbeatを更新
+		/// @param[in]		nodeMap	インターフェースのリモートノード
+		/// @param[in]		timeout	タイムアウト[us]
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::UpdateHeartbeat(const GenApi::INodeMap& nodeMap, double timeout)
 		{
@@ -291,53 +318,53 @@ namespace Standard
 
 			try
 			{
-				// Heartbeat^CAEg(W)擾
+				// Heartbeatタイムアウト(標準)を取得
 				GenApi::CValuePtr deviceHeartbeatTimeout(nodeMap.GetNode("DeviceLinkHeartbeatTimeout"));
 
-				// Heartbeat^CAEg(W)̗LmF
+				// Heartbeatタイムアウト(標準)の有無を確認
 				if (deviceHeartbeatTimeout == nullptr)
 				{
-					// Heartbeat^CAEg(W)Ȃ  Heartbeat^CAEg(񐄏)̗LmF
+					// Heartbeatタイムアウト(標準)なし ⇒ Heartbeatタイムアウト(非推奨)の有無を確認
 					deviceHeartbeatTimeout = nodeMap.GetNode("GevHeartbeatTimeout");
 
-					// Heartbeat^CAEg(񐄏)̗LmF
+					// Heartbeatタイムアウト(非推奨)の有無を確認
 					if (deviceHeartbeatTimeout.IsValid() == false)
 					{
-						// Heartbeat^CAEg(񐄏)Ȃ  O𔭖C
-						throw std::exception("HeartbeatȂ");
+						// Heartbeatタイムアウト(非推奨)なし ⇒ 例外を発砲
+						throw std::exception("Heartbeatなし");
 					}
 
-					// ^CAEg̒Pʂϊ [us]  [ms]
+					// タイムアウトの単位を変換 [us] → [ms]
 					timeout *= 1000;
 				}
 
 				std::stringstream buffer;
 
-				// ^CAEg𕶎ɕϊ
+				// タイムアウトを文字列に変換
 				buffer << timeout;
 
-				// Heartbeat^CAEgXV
+				// Heartbeatタイムアウトを更新
 				postscript << "GenApi::HeartbeatTimeout(" << buffer.str() << ")";
 				deviceHeartbeatTimeout->FromString(buffer.str().c_str());
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ
+				// 例外の処理
 				std::stringstream message;
 
 				message << postscript.str() << Logging::ConstSeparator << e.what();
 
-				// O𔭖C
+				// 例外を発砲
 				throw std::exception(message.str().c_str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			DeviceLost̃R[obNo^
-		/// @param[in]		nodeMap	C^[tF[X̃[Jm[h
+		/// @brief			DeviceLostのコールバックを登録
+		/// @param[in]		nodeMap	インターフェースのローカルノード
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::RegisterDeviceLost(const GenApi::INodeMap& nodeMap)
 		{
@@ -348,75 +375,75 @@ namespace Standard
 
 			try
 			{
-				// DeviceLost擾
+				// DeviceLostを取得
 				postscript << "GenApi::GetNode(EventDeviceLost)";
 				GenApi::CNodePtr nodeCallback(nodeMap.GetNode("EventDeviceLost"));
 				postscript.str("");
 
-				// DeviceLostmF
+				// DeviceLostを確認
 				if (nodeCallback)
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-					// R[obN֐o^
+					// コールバック関数を登録
 					postscript << "GenApi::RegisterCallback()";
 					StApi::RegisterCallback(nodeCallback, &OnNodeCallbackFunction, this);
 					postscript.str("");
 				}
 				else
 				{
-					// DeviceLostȂ  O𔭖C
-					throw std::exception("DeviceLostȂ");
+					// DeviceLostなし ⇒ 例外を発砲
+					throw std::exception("DeviceLostなし");
 				}
 				
-				// EventSelector擾
+				// EventSelectorを取得
 				postscript << "GenApi::GetNode(EventSelector)";
 				GenApi::CEnumerationPtr enumerationEventSelector(nodeMap.GetNode("EventSelector"));
 				postscript.str("");
 
-				// DeviceLost擾
+				// DeviceLostを取得
 				postscript << "GenApi::GetEntryByName(DeviceLost)";
 				GenApi::CEnumEntryPtr enumerationEntryEventSelectorEntry(enumerationEventSelector->GetEntryByName("DeviceLost"));
 				postscript.str("");
 
-				// DeviceLostI
+				// DeviceLostを選択
 				postscript << "GenApi::SetIntValue(DeviceLost)";
 				enumerationEventSelector->SetIntValue(enumerationEntryEventSelectorEntry->GetValue());
 				postscript.str("");
 
-				// EventNotification擾
+				// EventNotificationを取得
 				postscript << "GenApi::GetNode(EventNotification)";
 				GenApi::CEnumerationPtr enumerationEventNotification(nodeMap.GetNode("EventNotification"));
 				postscript.str("");
 
-				// On擾
+				// Onを取得
 				postscript << "GenApi::GetEntryByName(On)";
 				GenApi::CEnumEntryPtr enumerationEntryEventNotificationEntry(enumerationEventNotification->GetEntryByName("On"));
 				postscript.str("");
 
-				// OnI
+				// Onを選択
 				postscript << "GenApi::SetIntValue(On)";
 				enumerationEventNotification->SetIntValue(enumerationEntryEventNotificationEntry->GetValue());
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ
+				// 例外の処理
 				std::stringstream message;
 
 				message << postscript.str() << Logging::ConstSeparator << e.what();
 
-				// O𔭖C
+				// 例外を発砲
 				throw std::exception(message.str().c_str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			
-		/// @detail			̃^C~OŌĂяo
-		///					CȕȂǂs
-		///					p֐
+		/// @brief			初期化
+		/// @detail			初期化のタイミングで呼び出される
+		///					※ライブラリの初期化などを行う
+		///					★継承した関数
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::InitializeDerived()
 		{
@@ -430,40 +457,29 @@ namespace Standard
 
 			try
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// Cu
-				postscript << "StApi::StApiInitialize()";
-				StApi::StApiInitialize();
-				// Oo
-				postscript << Logging::ConstSeparator << stopWatch.Format(true);
-				Transfer::Output(Logging::Join(logging, postscript.str()));
-				postscript.str("");
-
-				StApi::EStSystemVendor_t systemVendor = StApi::EStSystemVendor_t::StSystemVendor_Default;
-				StApi::EStInterfaceType_t interfaceType = StApi::EStInterfaceType_t::StInterfaceType_All;
-
-				// VXeW[J
-				postscript << "StApi::CreateIStSystem()";
-				m_stSystem.Reset(StApi::CreateIStSystem(systemVendor, interfaceType));
-				// Oo
+				// システムを参照 ⇒ 最初のカメラでライブラリを初期化してシステムを生成
+				postscript << "System::Acquire()";
+				CSystem::Instance().Acquire();
+				// ログ出力
 				postscript << Logging::ConstSeparator << stopWatch.Format(true);
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			j
-		/// @detail			j̃^C~OŌĂяo
-		///					Cu̔jȂǂs
-		///					p֐
+		/// @brief			破棄
+		/// @detail			破棄のタイミングで呼び出される
+		///					※ライブラリの破棄などを行う
+		///					★継承した関数
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::DestroyDerived()
 		{
@@ -477,37 +493,29 @@ namespace Standard
 
 			try
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// VXeJ
-				postscript << "StApi::System::Reset()";
-				m_stSystem.Reset();
-				// Oo
-				postscript << Logging::ConstSeparator << stopWatch.Format(true);
-				Transfer::Output(Logging::Join(logging, postscript.str()));
-				postscript.str("");
-
-				// Cuj
-				postscript << "StApi::StApiTerminate()";
-				StApi::StApiTerminate();
-				// Oo
+				// システムの参照を解除 ⇒ 最後のカメラでシステムを解放してライブラリを破棄
+				postscript << "System::Release()";
+				CSystem::Instance().Release();
+				// ログ出力
 				postscript << Logging::ConstSeparator << stopWatch.Format(true);
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ڑ
-		/// @detail			ڑ̃^C~OŌĂяo
-		///					f[^Xg[̊JnȂǂs
-		///					p֐
+		/// @brief			接続
+		/// @detail			接続のタイミングで呼び出される
+		///					※データストリームの開始などを行う
+		///					★継承した関数
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::ConnectDerived()
 		{
@@ -521,173 +529,221 @@ namespace Standard
 
 			try
 			{
-				// ڑݒNX擾
+				// 接続設定クラスを取得
 				Setting::CConnect connectSetting = GetConnectSetting();
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// C^[tF[X擾
-				uint32_t interfaceCount = m_stSystem->GetInterfaceCount();
-				postscript << "Interface:" << interfaceCount;
-
-				// C^[tF[XmF
-				if (interfaceCount <= 0)
-				{
-					errorCode = Exception::CodeGrabberInterface;
-
-					// O𔭖C
-					throw std::exception("C^[tF[XȂ");
-				}
-				// Oo
-				postscript << Logging::ConstSeparator << stopWatch.Format(true);
-				Transfer::Output(Logging::Join(logging, postscript.str()));
-				postscript.str("");
-
-				// C^[tF[X̊mF
-				bool checkInterface = true;
+				CSystem& system = CSystem::Instance();
 
-				// C^[tF[XƐڑĂJ𑖍 C^[tF[X̊mFL̏ꍇ
-				for (uint32_t interfaceIndex = 0; interfaceIndex < interfaceCount && checkInterface; interfaceIndex++)
 				{
-					// C^[tF[X擾
-					postscript << "StApi::GetIStInterface(" << interfaceIndex << ")";
-					StApi::IStInterface *stInterface = m_stSystem->GetIStInterface(interfaceIndex);
-					postscript.str("");
+					// 排他制御 ⇒ 他のカメラと検索が重ならないように予約までを排他制御
+					std::unique_lock<std::recursive_mutex> search = system.Lock();
 
-					// ڑĂfoCX(J)oAfoCX(J)XgXV
-					postscript << "StApi::GetDeviceCount()";
-					stInterface->UpdateDeviceList();
-					postscript.str("");
+					StApi::IStSystem* stSystem = system.GetSystem();
 
-					// foCX擾
-					postscript << "StApi::GetDeviceCount(" << interfaceIndex << ")";
-					const uint32_t deviceCount = stInterface->GetDeviceCount();
-					postscript << Logging::ConstSeparator << "Device:" << deviceCount;
+					// インターフェース数を取得
+					uint32_t interfaceCount = stSystem->GetInterfaceCount();
+					postscript << "Interface:" << interfaceCount;
 
-					// foCXmF
-					if (deviceCount <= 0)
+					// インターフェース数を確認
+					if (interfaceCount <= 0)
 					{
-						// foCXȂ  ̃C^[tF[X
-						continue;
+						errorCode = Exception::CodeGrabberInterface;
+
+						// 例外を発砲
+						throw std::exception("インターフェースなし");
 					}
-					// Oo
+					// ログ出力
 					postscript << Logging::ConstSeparator << stopWatch.Format(true);
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// C^[tF[X|C^[̃m[h擾
-					postscript << "GenApi::GetINodeMap()";
-					GenApi::CNodeMapPtr nodeMap(stInterface->GetIStPort()->GetINodeMap());
-					postscript.str("");
-
-					// foCXI
-					postscript << "GenApi::DeviceSelector()";
-					GenApi::CIntegerPtr deviceSelector(nodeMap->GetNode("DeviceSelector"));
-					postscript.str("");
-
-					// foCX擾
-					postscript << "StApi::GetMax()";
-					const int64_t deviceMax = deviceSelector->GetMax();
-					postscript << Logging::ConstSeparator << "Device:" << deviceMax;
-					// Oo
+					// 接続されているデバイス(カメラ)を検出し、デバイス(カメラ)リストを更新 ⇒ 同時に接続する他のカメラと共有
+					postscript << "System::UpdateDeviceList()";
+					system.UpdateDeviceList(m_listInterval);
+					// ログ出力
 					postscript << Logging::ConstSeparator << stopWatch.Format(true);
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// foCX𑖍
-					for (uint32_t indexDevice = 0; indexDevice <= deviceMax; indexDevice++)
+					// インターフェースの確認
+					bool checkInterface = true;
+
+					// インターフェースと接続されているカメラ数分を走査 ※インターフェースの確認が有効の場合
+					for (uint32_t interfaceIndex = 0; interfaceIndex < interfaceCount && checkInterface; interfaceIndex++)
 					{
-						// foCX̑I
-						deviceSelector->SetValue(indexDevice);
+						// インターフェースを取得
+						postscript << "StApi::GetIStInterface(" << interfaceIndex << ")";
+						StApi::IStInterface *stInterface = stSystem->GetIStInterface(interfaceIndex);
+						postscript.str("");
 
-						// foCXmF
-						if (IsDevice(connectSetting, *nodeMap, indexDevice) == false)
+						// デバイス数を取得
+						postscript << "StApi::GetDeviceCount(" << interfaceIndex << ")";
+						const uint32_t deviceCount = stInterface->GetDeviceCount();
+						postscript << Logging::ConstSeparator << "Device:" << deviceCount;
+
+						// デバイス数を確認
+						if (deviceCount <= 0)
 						{
-							// sv  ̃foCX
+							// デバイスなし ⇒ 次のインターフェースへ
 							continue;
 						}
-
-						// C^[tF[XXV
-						postscript << "StApi::Interface::CreateIStDevice(" << indexDevice << ")";
-						m_stDevice.Reset(stInterface->CreateIStDevice((size_t)indexDevice));
-						// Oo
-						postscript << Logging::ConstSeparator << stopWatch.Format(true);
-						Transfer::Output(Logging::Join(logging, postscript.str()));
-						postscript.str("");
-
-						// f[^Xg[XV
-						postscript << "StApi::Interface::CreateIStDataStream()";
-						m_stDataStream.Reset(m_stDevice->CreateIStDataStream());
-						// Oo
+						// ログ出力
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// ftHg̐ݒNX擾
-						Setting::CDefault defaultSetting = GetDefaultSetting();
-
-						// [g̃m[h擾
-						GenApi::CNodeMapPtr remoteNode(m_stDevice->GetRemoteIStPort()->GetINodeMap());
-
-						// p[^ftHgɖ߂
-						postscript << "DefaultParameter()";
-						DefaultParameter(*remoteNode, defaultSetting);
-						postscript.str("");
-
-						// HeartbeatXV
-						postscript << "StApi::Interface::UpdateHeartbeat()";
-						UpdateHeartbeat(*remoteNode, defaultSetting.HeartbeatTimeout);
-						postscript.str("");
-
-						// [J̃m[h擾
-						GenApi::CNodeMapPtr localNode(m_stDevice->GetLocalIStPort()->GetINodeMap());
-
-						// DeviceLost̃R[obNo^
-						postscript << "StApi::Interface::RegisterHeartbeat()";
-						RegisterDeviceLost(*localNode);
+						// インターフェースポインターのノードを取得
+						postscript << "GenApi::GetINodeMap()";
+						GenApi::CNodeMapPtr nodeMap(stInterface->GetIStPort()->GetINodeMap());
 						postscript.str("");
 
-						// Cxg̃XbhJn
-						postscript << "StApi::Interface::StartEventAcquisitionThread()";
-						m_stDevice->StartEventAcquisitionThread();
+						// デバイスを選択
+						postscript << "GenApi::DeviceSelector()";
+						GenApi::CIntegerPtr deviceSelector(nodeMap->GetNode("DeviceSelector"));
 						postscript.str("");
 
-						// f[^Xg[̊Jn
-						postscript << "StApi::DataStream::StartAcquisition()";
-						m_stDataStream->StartAcquisition();
-						// Oo
+						// デバイス数を取得
+						postscript << "StApi::GetMax()";
+						const int64_t deviceMax = deviceSelector->GetMax();
+						postscript << Logging::ConstSeparator << "Device:" << deviceMax;
+						// ログ出力
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// C^[tF[X̊mF
-						checkInterface = false;
-						break;
+						// デバイス数分を走査
+						for (uint32_t indexDevice = 0; indexDevice <= deviceMax; indexDevice++)
+						{
+							// デバイスの選択
+							deviceSelector->SetValue(indexDevice);
+
+							// デバイスを確認
+							if (IsDevice(connectSetting, *nodeMap, indexDevice) == false)
+							{
+								// 不一致 ⇒ 次のデバイスへ
+								continue;
+							}
+
+							// デバイスの識別子を取得
+							std::string deviceId = stInterface->GetIStDeviceInfo((size_t)indexDevice)->GetID().c_str();
+
+							// デバイスを予約
+							if (system.Reserve(deviceId) == false)
+							{
+								// 他のカメラで接続済み ⇒ 次のデバイスへ
+								continue;
+							}
+
+							m_deviceId = deviceId;
+
+							// インターフェースを更新
+							postscript << "StApi::Interface::CreateIStDevice(" << indexDevice << ")";
+							m_stDevice.Reset(stInterface->CreateIStDevice((size_t)indexDevice));
+							// ログ出力
+							postscript << Logging::ConstSeparator << stopWatch.Format(true);
+							Transfer::Output(Logging::Join(logging, postscript.str()));
+							postscript.str("");
+
+							// データストリームを更新
+							postscript << "StApi::Interface::CreateIStDataStream()";
+							m_stDataStream.Reset(m_stDevice->CreateIStDataStream());
+							// ログ出力
+							postscript << Logging::ConstSeparator << stopWatch.Format(true);
+							Transfer::Output(Logging::Join(logging, postscript.str()));
+							postscript.str("");
+
+							// インターフェースの確認を解除
+							checkInterface = false;
+							break;
+						}
 					}
 				}
 
-				// C^[tF[X and f[^Xg[mF
+				// インターフェース and データストリームを確認
 				if (m_stDevice.IsValid() == false || m_stDataStream.IsValid() == false)
 				{
 					errorCode = Exception::CodeGrabberDevice;
 
-					// O𔭖C
-					throw std::exception("YJȂ");
+					// 例外を発砲
+					throw std::exception("該当するカメラなし");
+				}
+
+				// 以降はカメラごとの処理 ⇒ 他のカメラの接続と並列に行う
+
+				// デフォルトの設定クラスを取得
+				Setting::CDefault defaultSetting = GetDefaultSetting();
+
+				// リモートのノードを取得
+				GenApi::CNodeMapPtr remoteNode(m_stDevice->GetRemoteIStPort()->GetINodeMap());
+
+				// パラメータをデフォルトに戻す
+				postscript << "DefaultParameter()";
+				DefaultParameter(*remoteNode, defaultSetting);
+				postscript.str("");
+
+				// Heartbeatを更新
+				postscript << "StApi::Interface::UpdateHeartbeat()";
+				UpdateHeartbeat(*remoteNode, defaultSetting.HeartbeatTimeout);
+				postscript.str("");
+
+				// パラメータのノードを取得して保持 ⇒ 以降の読み書きで名前の検索を省略
+				postscript << "Parameter::Attach()";
+				m_parameter.Attach(*remoteNode);
+				postscript.str("");
+
+				// ローカルのノードを取得
+				GenApi::CNodeMapPtr localNode(m_stDevice->GetLocalIStPort()->GetINodeMap());
+
+				// DeviceLostのコールバックを登録
+				postscript << "StApi::Interface::RegisterHeartbeat()";
+				RegisterDeviceLost(*localNode);
+				postscript.str("");
+
+				// イベントのスレッドを開始
+				postscript << "StApi::Interface::StartEventAcquisitionThread()";
+				m_stDevice->StartEventAcquisitionThread();
+				postscript.str("");
+
+				// データストリームの開始
+				postscript << "StApi::DataStream::StartAcquisition()";
+				m_stDataStream->StartAcquisition();
+				// ログ出力
+				postscript << Logging::ConstSeparator << stopWatch.Format(true);
+				Transfer::Output(Logging::Join(logging, postscript.str()));
+				postscript.str("");
+
+				// 連続取り込みを確認
+				if (defaultSetting.Streaming)
+				{
+					// 連続取り込みを開始
+					postscript << "StartStreaming()";
+					StartStreaming();
+					postscript.str("");
 				}
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// データストリームを確認
+				if (m_stDataStream.IsValid() == false)
+				{
+					// 接続できなかった ⇒ インターフェースを開放してデバイスの予約を解除
+					m_stDevice.Reset();
+					CancelDevice();
+				}
+
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ؒf
-		/// @detail			ؒf̃^C~OŌĂяo
-		///					f[^Xg[̊JȂǂs
-		///					p֐
+		/// @brief			切断
+		/// @detail			切断のタイミングで呼び出される
+		///					※データストリームの開放などを行う
+		///					★継承した関数
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::DisconnectDerived()
 		{
@@ -701,80 +757,91 @@ namespace Standard
 
 			try
 			{
-				// r
+				// 連続取り込みを停止 ⇒ データストリームを解放する前に受け取るスレッドを停止
+				postscript << "StopStreaming()";
+				StopStreaming();
+				postscript.str("");
+
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// foCXXg
+				// デバイスロスト
 				bool deviceLost = false;
 
-				// C^[tF[XmF
+				// インターフェースを確認
 				if (m_stDevice.IsValid())
 				{
-					// foCXXg擾
+					// デバイスロストを取得
 					deviceLost = m_stDevice->IsDeviceLost();
 
-					// foCXXgmF
+					// デバイスロストを確認
 					if (deviceLost == false)
 					{
-						// foCXXgȂ  C^[tF[X̎荞݂~
+						// デバイスロストなし ⇒ インターフェースの取り込みを停止
 						postscript << "StApi::Interface::AcquisitionStop()";
 						//@@@m_stDevice->AcquisitionStop();
-						// Oo
+						// ログ出力
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 					}
 
-					// Cxg̃Xbh~
+					// イベントのスレッドを停止
 					postscript << "StApi::Interface::StopEventAcquisitionThread()";
 					m_stDevice->StopEventAcquisitionThread();
 					postscript.str("");
 				}
 
-				// f[^Xg[mF
+				// データストリームを確認
 				if (m_stDataStream.IsValid())
 				{
-					// foCXXg and BmF
+					// デバイスロスト and 撮像中を確認
 					if (deviceLost == false && m_stDataStream->IsGrabbing())
 					{
-						// foCXXgȂ  f[^Xg[̎荞݂~
+						// デバイスロストなし ⇒ データストリームの取り込みを停止
 						postscript << "StApi::DataStream::StopAcquisition()";
 						//@@@m_stDataStream->StopAcquisition();
-						// Oo
+						// ログ出力
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 					}
 				}
 
-				// f[^Xg[
+				// 保持したパラメータのノードを解放 ⇒ インターフェースを開放する前に行う
+				m_parameter.Detach();
+
+				// データストリームを解放
 				postscript << "StApi::DataStream::Reset()";
 				m_stDataStream.Reset();
-				// Oo
+				// ログ出力
 				postscript << Logging::ConstSeparator << stopWatch.Format(true);
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
-				// C^[tF[XJ
+				// インターフェースを開放
 				postscript << "StApi::Interface::Reset()";
 				m_stDevice.Reset();
-				// Oo
+				// ログ出力
 				postscript << Logging::ConstSeparator << stopWatch.Format(true);
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
+
+				// デバイスの予約を解除 ⇒ 他のカメラから接続可能
+				CancelDevice();
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ڑ̏Ԃ擾
-		///	@detail			ڑ̏Ԃ擾^C~OŌĂяo
-		///					p֐
-		/// @return			true:ڑς / false:ڑ
+		/// @brief			接続の状態を取得
+		///	@detail			接続の状態を取得するタイミングで呼び出される
+		///					★継承した関数
+		/// @return			true:接続済み / false:未接続
 		////////////////////////////////////////////////////////////////////////////////
 		bool CWorker::GetConnected()
 		{
@@ -782,20 +849,20 @@ namespace Standard
 
 			do
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// f[^Xg[mF
+				// データストリームを確認
 				if (m_stDataStream.IsValid() == false)
 				{
-					// f[^Xg[m
+					// データストリーム未確定
 					break;
 				}
 
-				// C^[tF[XmF
+				// インターフェースを確認
 				if (m_stDevice.IsValid() == false)
 				{
-					// C^[tF[Xm
+					// インターフェース未確定
 					break;
 				}
 
@@ -806,7 +873,7 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ڑς݂mF
+		/// @brief			接続済みを確認
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::IsConnected()
 		{
@@ -819,41 +886,57 @@ namespace Standard
 
 			try
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// f[^Xg[mF
+				// データストリームを確認
 				if (m_stDataStream.IsValid() == false)
 				{
 					errorCode = Exception::CodeGrabberDataStream;
 
-					// O𔭖C
-					throw std::exception("f[^Xg[m");
+					// 例外を発砲
+					throw std::exception("データストリーム未確定");
 				}
 				postscript.str("");
 
-				// C^[tF[XmF
+				// インターフェースを確認
 				if (m_stDevice.IsValid() == false)
 				{
 					errorCode = Exception::CodeGrabberInterface;
 
-					// O𔭖C
-					throw std::exception("C^[tF[Xm");
+					// 例外を発砲
+					throw std::exception("インターフェース未確定");
 				}
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			AiOQCǂݍ
-		/// @detail			AiOQClǂݍރ^C~OŌĂяo
-		///					p֐
-		/// @return			AiOQCl
+		/// @brief			デバイスの予約を解除
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::CancelDevice()
+		{
+			// 排他制御
+			std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
+
+			// 予約を確認
+			if (m_deviceId.empty() == false)
+			{
+				CSystem::Instance().Cancel(m_deviceId);
+				m_deviceId.clear();
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			アナログゲインを読み込み
+		/// @detail			アナログゲイン値を読み込むタイミングで呼び出される
+		///					★継承した関数
+		/// @return			アナログゲイン値
 		////////////////////////////////////////////////////////////////////////////////
 		double CWorker::ReadAnalogGainDerived()
 		{
@@ -868,37 +951,25 @@ namespace Standard
 
 			try
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// ڑς݂mF
+				// 接続済みを確認
 				postscript << "IsConnected()";
 				IsConnected();
 				postscript.str("");
 
-				CParameter parameter;
-
-				// [g̃m[h擾
-				postscript << "StApi::Interface::GetRemoteIStPort()::GetINodeMap()";
-				GenApi::CNodeMapPtr nodeMap(m_stDevice->GetRemoteIStPort()->GetINodeMap());
-				postscript.str("");
-
-				// AiOQC̑I
-				postscript << "Parameter::Selector(GainSelector, AnalogAll)";
-				parameter.Selector(*nodeMap, "GainSelector", "AnalogAll");
-				postscript.str("");
-
-				// AiOQCǂݍ
-				postscript << "Parameter::ReadDouble(Gain)";
-				ret = parameter.ReadDouble(*nodeMap, "Gain");
-				postscript << Logging::ConstSeparator << "l:" << ret;
-				// Oo
+				// アナログゲインを読み込み ⇒ 保持したノードを使用
+				postscript << "Parameter::ReadGain(AnalogAll)";
+				ret = m_parameter.ReadGain("AnalogAll");
+				postscript << Logging::ConstSeparator << "値:" << ret;
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 
@@ -906,10 +977,10 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			AiOQC
-		/// @detail			AiOQClރ^C~OŌĂяo
-		///					p֐
-		/// @param[in]		value	AiOQCl
+		/// @brief			アナログゲインを書き込み
+		/// @detail			アナログゲイン値を書き込むタイミングで呼び出される
+		///					★継承した関数
+		/// @param[in]		value	アナログゲイン値
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::WriteAnalogGainDerived(double value)
 		{
@@ -922,46 +993,34 @@ namespace Standard
 
 			try
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// ڑς݂mF
+				// 接続済みを確認
 				postscript << "IsConnected()";
 				IsConnected();
 				postscript.str("");
 
-				CParameter parameter;
-
-				// [g̃m[h擾
-				postscript << "StApi::Interface::GetRemoteIStPort()::GetINodeMap()";
-				GenApi::CNodeMapPtr nodeMap(m_stDevice->GetRemoteIStPort()->GetINodeMap());
-				postscript.str("");
-
-				// AiOQC̑I
-				postscript << "Parameter::Selector(GainSelector, AnalogAll)";
-				parameter.Selector(*nodeMap, "GainSelector", "AnalogAll");
-				postscript.str("");
-
-				// AiOQC
-				postscript << "Parameter::WriteDouble()";
-				parameter.WriteDouble(*nodeMap, "Gain", value);
-				postscript << Logging::ConstSeparator << "l:" << value;
-				// Oo
+				// アナログゲインを書き込み ⇒ 保持したノードを使用
+				postscript << "Parameter::WriteGain(AnalogAll)";
+				m_parameter.WriteGain("AnalogAll", value);
+				postscript << Logging::ConstSeparator << "値:" << value;
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fW^QCǂݍ
-		/// @detail			fW^QClǂݍރ^C~OŌĂяo
-		///					p֐
-		/// @return			fW^QCl
+		/// @brief			デジタルゲインを読み込み
+		/// @detail			デジタルゲイン値を読み込むタイミングで呼び出される
+		///					★継承した関数
+		/// @return			デジタルゲイン値
 		////////////////////////////////////////////////////////////////////////////////
 		double CWorker::ReadDigitalGainDerived()
 		{
@@ -976,37 +1035,25 @@ namespace Standard
 
 			try
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// ڑς݂mF
+				// 接続済みを確認
 				postscript << "IsConnected()";
 				IsConnected();
 				postscript.str("");
 
-				CParameter parameter;
-
-				// [g̃m[h擾
-				postscript << "StApi::Interface::GetRemoteIStPort()::GetINodeMap()";
-				GenApi::CNodeMapPtr nodeMap(m_stDevice->GetRemoteIStPort()->GetINodeMap());
-				postscript.str("");
-
-				// fW^QC̑I
-				postscript << "Parameter::Selector(GainSelector, DigitalAll)";
-				parameter.Selector(*nodeMap, "GainSelector", "DigitalAll");
-				postscript.str("");
-
-				// fW^QCǂݍ
-				postscript << "Parameter::ReadDouble(Gain)";
-				ret = parameter.ReadDouble(*nodeMap, "Gain");
-				postscript << Logging::ConstSeparator << "l:" << ret;
-				// Oo
+				// デジタルゲインを読み込み ⇒ 保持したノードを使用
+				postscript << "Parameter::ReadGain(DigitalAll)";
+				ret = m_parameter.ReadGain("DigitalAll");
+				postscript << Logging::ConstSeparator << "値:" << ret;
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 
@@ -1014,10 +1061,10 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fW^QC
-		/// @detail			fW^QClރ^C~OŌĂяo
-		///					p֐
-		/// @param[in]		value	fW^QCl
+		/// @brief			デジタルゲインを書き込み
+		/// @detail			デジタルゲイン値を書き込むタイミングで呼び出される
+		///					★継承した関数
+		/// @param[in]		value	デジタルゲイン値
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::WriteDigitalGainDerived(double value)
 		{
@@ -1030,46 +1077,34 @@ namespace Standard
 
 			try
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// ڑς݂mF
+				// 接続済みを確認
 				postscript << "IsConnected()";
 				IsConnected();
 				postscript.str("");
 
-				CParameter parameter;
-
-				// [g̃m[h擾
-				postscript << "StApi::Interface::GetRemoteIStPort()::GetINodeMap()";
-				GenApi::CNodeMapPtr nodeMap(m_stDevice->GetRemoteIStPort()->GetINodeMap());
-				postscript.str("");
-
-				// fW^QC̑I
-				postscript << "Parameter::Selector(GainSelector, DigitalAll)";
-				parameter.Selector(*nodeMap, "GainSelector", "DigitalAll");
-				postscript.str("");
-
-				// fW^QC
-				postscript << "Parameter::WriteDouble()";
-				parameter.WriteDouble(*nodeMap, "Gain", value);
-				postscript << Logging::ConstSeparator << "l:" << value;
-				// Oo
+				// デジタルゲインを書き込み ⇒ 保持したノードを使用
+				postscript << "Parameter::WriteGain(DigitalAll)";
+				m_parameter.WriteGain("DigitalAll", value);
+				postscript << Logging::ConstSeparator << "値:" << value;
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			IԂǂݍ
-		/// @detail			IԂǂݍރ^C~OŌĂяo
-		///					p֐
-		/// @return			I
+		/// @brief			露光時間を読み込み
+		/// @detail			露光時間を読み込むタイミングで呼び出される
+		///					★継承した関数
+		/// @return			露光時間
 		////////////////////////////////////////////////////////////////////////////////
 		double CWorker::ReadExposureTimeDerived()
 		{
@@ -1084,32 +1119,25 @@ namespace Standard
 
 			try
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// ڑς݂mF
+				// 接続済みを確認
 				postscript << "IsConnected()";
 				IsConnected();
 				postscript.str("");
 
-				CParameter parameter;
-
-				// [g̃m[h擾
-				postscript << "StApi::Interface::GetRemoteIStPort()::GetINodeMap()";
-				GenApi::CNodeMapPtr nodeMap(m_stDevice->GetRemoteIStPort()->GetINodeMap());
-				postscript.str("");
-
-				// IԂǂݍ
-				postscript << "Parameter::ReadDouble(ExposureTime)";
-				ret = parameter.ReadDouble(*nodeMap, "ExposureTime");
-				postscript << Logging::ConstSeparator << "l:" << ret;
-				// Oo
+				// 露光時間を読み込み ⇒ 保持したノードを使用
+				postscript << "Parameter::ReadExposureTime()";
+				ret = m_parameter.ReadExposureTime();
+				postscript << Logging::ConstSeparator << "値:" << ret;
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 
@@ -1117,10 +1145,10 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			IԂ
-		/// @detail			IԂރ^C~OŌĂяo
-		///					p֐
-		/// @param[in]		value	I
+		/// @brief			露光時間を書き込み
+		/// @detail			露光時間を書き込むタイミングで呼び出される
+		///					★継承した関数
+		/// @param[in]		value	露光時間
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::WriteExposureTimeDerived(double value)
 		{
@@ -1133,46 +1161,78 @@ namespace Standard
 
 			try
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// ڑς݂mF
+				// 接続済みを確認
 				postscript << "IsConnected()";
 				IsConnected();
 				postscript.str("");
 
-				CParameter parameter;
-
-				// [g̃m[h擾
-				postscript << "StApi::Interface::GetRemoteIStPort()::GetINodeMap()";
-				GenApi::CNodeMapPtr nodeMap(m_stDevice->GetRemoteIStPort()->GetINodeMap());
+				// 露光時間を書き込み ⇒ 保持したノードを使用
+				postscript << "Parameter::WriteExposureTime()";
+				m_parameter.WriteExposureTime(value);
+				postscript << Logging::ConstSeparator << "値:" << value;
+				// ログ出力
+				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理 ⇒ 例外を通知＆発砲
+				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
+			}
+		}
 
-				// fW^QC̑I
-				postscript << "Parameter::Selector(ExposureTimeSelector, Common)";
-				parameter.Selector(*nodeMap, "ExposureTimeSelector", "Common");
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			パラメータを一括で書き込み
+		/// @detail			パラメータを一括で書き込むタイミングで呼び出される
+		///					1回の排他制御で保持したノードに書き込む
+		///					★継承した関数
+		/// @param[in]		object	パラメータの設定クラス
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::ApplyParameterDerived(const Setting::CParameter& object)
+		{
+			Logging::CObject logging;
+			std::stringstream postscript;
+			Exception::EnumCode errorCode = Exception::CodeGrabberParameterSet;
+			int deviceErrorCode = Exception::DeviceCodeSuccess;
+			Utility::CStopWatch stopWatch;
+
+			logging.Message << GetName() << "ApplyParameterDerived()" << Logging::ConstSeparator;
+
+			try
+			{
+				// 排他制御
+				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
+
+				// 接続済みを確認
+				postscript << "IsConnected()";
+				IsConnected();
 				postscript.str("");
 
-				// IԂ
-				postscript << "Parameter::WriteDouble()";
-				parameter.WriteDouble(*nodeMap, "ExposureTime", value);
-				postscript << Logging::ConstSeparator << "l:" << value;
-				// Oo
+				// パラメータを一括で書き込み
+				postscript << "Parameter::Apply()";
+				m_parameter.Apply(object);
+				postscript << Logging::ConstSeparator << "アナログゲイン:" << object.AnalogGain << Logging::ConstSeparator << "デジタルゲイン:" << object.DigitalGain << Logging::ConstSeparator << "露光時間:" << object.ExposureTime;
+				postscript << Logging::ConstSeparator << "範囲:" << object.OffsetX << "," << object.OffsetY << "," << object.Width << "," << object.Height;
+				// ログ出力
+				postscript << Logging::ConstSeparator << stopWatch.Format(true);
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			荞
-		/// @detail			摜荞ރ^C~OŌĂяo
-		///					p֐
-		/// @return			摜̃NX
+		/// @brief			取り込み
+		/// @detail			画像を取り込むタイミングで呼び出される
+		///					★継承した関数
+		/// @return			画像のクラス
 		////////////////////////////////////////////////////////////////////////////////
 		Image::CObject CWorker::CaptureDerived()
 		{
@@ -1184,105 +1244,379 @@ namespace Standard
 			int deviceErrorCode = Exception::DeviceCodeSuccess;
 			Utility::CStopWatch stopWatch;
 
+			static Metrics::CHistogram& histogram = Transfer::GetHistogram("Grabber::CaptureDerived()");
+
 			logging.Message << GetName() << "CaptureDerived()" << Logging::ConstSeparator;
 
 			try
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// ڑς݂mF
+				// 接続済みを確認
 				postscript << "IsConnected()";
 				IsConnected();
 				postscript.str("");
 
-				// 荞ݒmF
+				// 取り込み中を確認
 				if (m_stDataStream->IsGrabbing() == false)
 				{
 					errorCode = Exception::CodeGrabberCaptureNotStart;
 
-					// O𔭖C
-					throw std::exception("f[^Xg[̎荞ݖ{");
+					// 例外を発砲
+					throw std::exception("データストリームの取り込み未実施");
 				}
 
-				// ftHgȐݒNX擾
+				// デフォルトな設定クラスを取得
 				Setting::CDefault defaultSetting = GetDefaultSetting();
 
-				// 荞݂v
+				// 取り込みを要求
 				postscript << "StApi::Interface::AcquisitionStart()";
 				m_stDevice->AcquisitionStart();
 				postscript.str("");
 
-				// 荞ݑ҂
+				// トリガ and トリガの入力元を確認
+				if (defaultSetting.Trigger && defaultSetting.TriggerSource == "Software")
+				{
+					// ソフトウェアトリガを発行
+					postscript << "SoftwareTriggerDerived()";
+					SoftwareTriggerDerived();
+					postscript.str("");
+				}
+
+				// 取り込み待ち
 				postscript << "StApi::DataStream::RetrieveBuffer(" << defaultSetting.CaptureTimeout << ")";
 				StApi::CIStStreamBufferPtr stStreamBuffer(m_stDataStream->RetrieveBuffer((uint32_t)defaultSetting.CaptureTimeout));
 
-				// 摜̊mF
+				// 画像の確認
 				if (stStreamBuffer.IsValid() == false)
 				{
 					errorCode = Exception::CodeGrabberCaptureTimeout;
 
-					// O𔭖C
-					throw std::exception("^CAEg");
+					// 例外を発砲
+					throw std::exception("タイムアウト");
+				}
+				postscript.str("");
+
+				// 画像データを生成
+				postscript << "UpdateImage()";
+				UpdateImage(stStreamBuffer, ret, errorCode);
+				postscript.str("");
+
+				// 処理時間を追加 ⇒ タイムアウトなどの異常は含めない
+				stopWatch.Record(histogram);
+
+				// ログ出力
+				postscript << Logging::ConstSeparator << stopWatch.Format(true);
+				Transfer::Output(Logging::Join(logging, postscript.str()));
+				postscript.str("");
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理 ⇒ 例外を通知＆発砲
+				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			連続取り込みを開始
+		/// @detail			連続取り込みを開始するタイミングで呼び出される
+		///					★継承した関数
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::StartStreamingDerived()
+		{
+			Logging::CObject logging;
+			std::stringstream postscript;
+			Exception::EnumCode errorCode = Exception::CodeGrabberCapture;
+			int deviceErrorCode = Exception::DeviceCodeSuccess;
+			Utility::CStopWatch stopWatch;
+
+			logging.Message << GetName() << "StartStreamingDerived()" << Logging::ConstSeparator;
+
+			try
+			{
+				// 排他制御
+				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
+
+				// 接続済みを確認
+				postscript << "IsConnected()";
+				IsConnected();
+				postscript.str("");
+
+				// 取り込みを要求 ⇒ 切断するまで取り込み続ける
+				postscript << "StApi::Interface::AcquisitionStart()";
+				m_stDevice->AcquisitionStart();
+				// ログ出力
+				postscript << Logging::ConstSeparator << stopWatch.Format(true);
+				Transfer::Output(Logging::Join(logging, postscript.str()));
+				postscript.str("");
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理 ⇒ 例外を通知＆発砲
+				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			連続取り込みを停止
+		/// @detail			連続取り込みを停止するタイミングで呼び出される
+		///					★継承した関数
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::StopStreamingDerived()
+		{
+			Logging::CObject logging;
+			std::stringstream postscript;
+			Exception::EnumCode errorCode = Exception::CodeGrabberCapture;
+			int deviceErrorCode = Exception::DeviceCodeSuccess;
+			Utility::CStopWatch stopWatch;
+
+			logging.Message << GetName() << "StopStreamingDerived()" << Logging::ConstSeparator;
+
+			try
+			{
+				// 排他制御
+				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
+
+				// インターフェース and デバイスロストを確認
+				if (m_stDevice.IsValid() && m_stDevice->IsDeviceLost() == false)
+				{
+					// 取り込みを停止
+					postscript << "StApi::Interface::AcquisitionStop()";
+					m_stDevice->AcquisitionStop();
+					// ログ出力
+					postscript << Logging::ConstSeparator << stopWatch.Format(true);
+					Transfer::Output(Logging::Join(logging, postscript.str()));
+					postscript.str("");
 				}
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理 ⇒ 例外を通知＆発砲
+				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ソフトウェアトリガを発行
+		/// @detail			ソフトウェアトリガを発行するタイミングで呼び出される
+		///					★継承した関数
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::SoftwareTriggerDerived()
+		{
+			Logging::CObject logging;
+			std::stringstream postscript;
+			Exception::EnumCode errorCode = Exception::CodeGrabberParameterSet;
+			int deviceErrorCode = Exception::DeviceCodeSuccess;
+
+			logging.Message << GetName() << "SoftwareTriggerDerived()" << Logging::ConstSeparator;
+
+			try
+			{
+				// 排他制御
+				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
+
+				// 接続済みを確認
+				postscript << "IsConnected()";
+				IsConnected();
 				postscript.str("");
 
-				// 摜̏擾
+				CParameter parameter;
+
+				// リモートのノードを取得
+				postscript << "StApi::Interface::GetRemoteIStPort()::GetINodeMap()";
+				GenApi::CNodeMapPtr nodeMap(m_stDevice->GetRemoteIStPort()->GetINodeMap());
+				postscript.str("");
+
+				// ソフトウェアトリガを実行
+				postscript << "Parameter::Execute(TriggerSoftware)";
+				parameter.Execute(*nodeMap, "TriggerSoftware");
+				postscript.str("");
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理 ⇒ 例外を通知＆発砲
+				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			連続取り込みで画像を受け取る
+		/// @detail			受け取る専用のスレッドから呼び出される
+		///					※ライブラリの排他制御は行わずにデータストリームから受け取る
+		///					★継承した関数
+		/// @param[in]		timeout	タイムアウト[ms]
+		/// @param[out]		frame	画像と付帯情報のクラス
+		/// @return			true:受け取り / false:タイムアウト
+		////////////////////////////////////////////////////////////////////////////////
+		bool CWorker::RetrieveDerived(int timeout, Frame::CObject& frame)
+		{
+			bool ret = false;
+
+			Logging::CObject logging;
+			std::stringstream postscript;
+			Exception::EnumCode errorCode = Exception::CodeGrabberCapture;
+			int deviceErrorCode = Exception::DeviceCodeSuccess;
+
+			logging.Message << GetName() << "RetrieveDerived()" << Logging::ConstSeparator;
+
+			try
+			{
+				do
+				{
+					// 受け取り待ち
+					postscript << "StApi::DataStream::RetrieveBuffer(" << timeout << ")";
+					StApi::CIStStreamBufferPtr stStreamBuffer(m_stDataStream->RetrieveBuffer((uint32_t)timeout));
+					postscript.str("");
+
+					// 画像の確認
+					if (stStreamBuffer.IsValid() == false)
+					{
+						// タイムアウト
+						break;
+					}
+
+					// ホストで受け取った時刻を更新
+					frame.Information.HostTimestamp = Frame::Now();
+
+					// 画像の番号とカメラのタイムスタンプを取得
+					postscript << "StApi::DataStreamBuffer::GetIStStreamBufferInfo()";
+					StApi::IStStreamBufferInfo *stStreamBufferInfo = stStreamBuffer->GetIStStreamBufferInfo();
+					frame.Information.FrameId = stStreamBufferInfo->GetFrameID();
+					frame.Information.DeviceTimestamp = stStreamBufferInfo->GetTimestamp();
+					postscript.str("");
+
+					// 画像データを生成 ⇒ 受け取ったバッファはスコープを抜けるとデータストリームへ戻る
+					postscript << "UpdateImage()";
+					UpdateImage(stStreamBuffer, frame.Value, errorCode);
+					postscript.str("");
+
+					ret = true;
+				} while (false);
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理 ⇒ 例外を通知＆発砲
+				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			受け取ったバッファから画像のクラスを更新
+		/// @param[in]		stStreamBuffer	受け取ったバッファ
+		/// @param[out]		image	画像のクラス
+		/// @param[out]		errorCode	例外のコード ※例外を発砲する場合に更新
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::UpdateImage(const StApi::CIStStreamBufferPtr& stStreamBuffer, Image::CObject& image, Exception::EnumCode& errorCode)
+		{
+			std::stringstream postscript;
+
+			try
+			{
+				// 画像の情報を取得
 				postscript << "StApi::DataStreamBuffer::IsImagePresent()";
 				if (stStreamBuffer->GetIStStreamBufferInfo()->IsImagePresent() == false)
 				{
 					errorCode = Exception::CodeGrabberCaptureNotImage;
 
-					// O𔭖C
-					throw std::exception("摜f[^Ȃ");
+					// 例外を発砲
+					throw std::exception("画像データなし");
 				}
 				postscript.str("");
 
-				// 摜f[^擾
+				// 画像データを取得
 				postscript << "StApi::DataStreamBuffer::GetIStImage()";
 				StApi::IStImage *stImage = stStreamBuffer->GetIStImage();
 
 				StApi::EStPixelFormatNamingConvention_t format = stImage->GetImagePixelFormat();
-				int depth = 0;
+				Image::Format::EnumPixel pixel = Image::Format::PixelUnknown;
 				int width = (int)stImage->GetImageWidth();
 				int height = (int)stImage->GetImageHeight();
 
-				// 摜tH[}bg
+				// 画像フォーマット
 				postscript << Logging::ConstSeparator << format;
 
 				switch (format)
 				{
 				case StApi::EStPixelFormatNamingConvention_t::StPFNC_Mono8:
-					// mN8rbg
-					depth = 8;
+					// モノクロ8ビット
+					pixel = Image::Format::PixelMono8;
+					break;
+
+				case StApi::EStPixelFormatNamingConvention_t::StPFNC_Mono10p:
+					// モノクロ10ビット(パック)
+					pixel = Image::Format::PixelMono10p;
+					break;
+
+				case StApi::EStPixelFormatNamingConvention_t::StPFNC_Mono12p:
+					// モノクロ12ビット(パック)
+					pixel = Image::Format::PixelMono12p;
+					break;
+
+				case StApi::EStPixelFormatNamingConvention_t::StPFNC_BayerRG8:
+					// ベイヤーRG8ビット
+					pixel = Image::Format::PixelBayerRG8;
+					break;
+
+				case StApi::EStPixelFormatNamingConvention_t::StPFNC_BayerGR8:
+					// ベイヤーGR8ビット
+					pixel = Image::Format::PixelBayerGR8;
+					break;
+
+				case StApi::EStPixelFormatNamingConvention_t::StPFNC_BayerBG8:
+					// ベイヤーBG8ビット
+					pixel = Image::Format::PixelBayerBG8;
+					break;
+
+				case StApi::EStPixelFormatNamingConvention_t::StPFNC_BayerGB8:
+					// ベイヤーGB8ビット
+					pixel = Image::Format::PixelBayerGB8;
+					break;
+
+				case StApi::EStPixelFormatNamingConvention_t::StPFNC_RGB8:
+					// カラーRGB8ビット
+					pixel = Image::Format::PixelRgb8;
+					break;
+
+				case StApi::EStPixelFormatNamingConvention_t::StPFNC_BGR8:
+					// カラーBGR8ビット
+					pixel = Image::Format::PixelBgr8;
 					break;
 
 				default:
-					// ̑  Ή
+					// その他 ⇒ 未対応
 					errorCode = Exception::CodeGrabberCaptureNotFormat;
 
-					// O𔭖C
-					throw std::exception("Ή");
+					// 例外を発砲
+					throw std::exception("未対応");
 				}
 				postscript.str("");
 
-				// 摜f[^𐶐
-				postscript << "Image::Update()";
-				ret.Update(depth, height, width, (const unsigned char*)stImage->GetImageBuffer());
-				postscript.str("");
+				// 画像データを生成 ⇒ 画素フォーマットを変換してプールの画像のデータへ直接書き込む
+				postscript << "Image::Format::Convert()";
+				if (Image::Format::Convert(pixel, height, width, (const unsigned char*)stImage->GetImageBuffer(), GetDefaultSetting().OutputFormat, image) == false)
+				{
+					errorCode = Exception::CodeGrabberCaptureNotFormat;
 
-				// Oo
-				postscript << Logging::ConstSeparator << stopWatch.Format(true);
-				Transfer::Output(Logging::Join(logging, postscript.str()));
+					// 例外を発砲
+					throw std::exception("未対応");
+				}
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
-				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
-			}
+				// 例外の処理
+				std::stringstream message;
 
-			return ret;
+				message << postscript.str() << Logging::ConstSeparator << e.what();
+
+				// 例外を発砲
+				throw std::exception(message.str().c_str());
+			}
 		}
 	}
 }
\ No newline at end of file
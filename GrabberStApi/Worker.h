@@ -2,6 +2,7 @@
 
 #include "Grabber/Worker.h"
 #include "Parameter.h"
+#include "System.h"
 
 namespace Standard
 {
@@ -9,91 +10,118 @@ namespace Standard
 	{
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CWorker
-		/// @brief      J̐sNX
-		///				 J̐sev[g̃NXp
+		/// @brief      カメラの制御を行うクラス
+		///				⇒ カメラの制御を行うテンプレートのクラスから継承
 		////////////////////////////////////////////////////////////////////////////////
 		class CWorker
 			: virtual public Worker::CTemplate
 		{
 		public:
-			// RXgN^
+			// コンストラクタ
 			CWorker();
 
-			// fXgN^
+			// デストラクタ
 			~CWorker() override;
 
 		public:
-			// R[obNĂяo֐
+			// コールバックから呼び出し関数
 			void ReceiveNode(GenApi::INode* node);
 
 		protected:
-			// 
+			// 初期化
 			void InitializeDerived() override;
 
-			// j
+			// 破棄
 			void DestroyDerived() override;
 
-			// ڑ
+			// 接続
 			void ConnectDerived() override;
 
-			// ؒf
+			// 切断
 			void DisconnectDerived() override;
 
-			// ڑ̏Ԃ擾
+			// 接続の状態を取得
 			bool GetConnected() override;
 
-			// AiOQCǂݍ
+			// アナログゲインを読み込み
 			double ReadAnalogGainDerived() override;
 
-			// AiOQC
+			// アナログゲインを書き込み
 			void WriteAnalogGainDerived(double value) override;
 
-			// fW^QCǂݍ
+			// デジタルゲインを読み込み
 			double ReadDigitalGainDerived() override;
 
-			// fW^QC
+			// デジタルゲインを書き込み
 			void WriteDigitalGainDerived(double value) override;
 
-			// IԂǂݍ
+			// 露光時間を読み込み
 			double ReadExposureTimeDerived() override;
 
-			// IԂ
+			// 露光時間を書き込み
 			void WriteExposureTimeDerived(double value) override;
 
-			// 荞
+			// パラメータを一括で書き込み
+			void ApplyParameterDerived(const Setting::CParameter& object) override;
+
+			// 取り込み
 			Image::CObject CaptureDerived() override;
 
+			// 連続取り込みを開始
+			void StartStreamingDerived() override;
+
+			// 連続取り込みを停止
+			void StopStreamingDerived() override;
+
+			// ソフトウェアトリガを発行
+			void SoftwareTriggerDerived() override;
+
+			// 連続取り込みで画像を受け取る
+			bool RetrieveDerived(int timeout, Frame::CObject& frame) override;
+
 		private:
-			// foCXXgmF
+			// デバイスロストを確認
 			bool IsDeviceLost();
 
-			// foCXmF
+			// デバイスを確認
 			bool IsDevice(const Setting::CConnect& setting, const GenApi::INodeMap& nodeMap, const uint32_t index);
 
-			// p[^ftHgɖ߂
+			// パラメータをデフォルトに戻す
 			void DefaultParameter(const GenApi::INodeMap& nodeMap, const Setting::CDefault& setting) throw(...);
 
-			// HeartBeatXV
+			// HeartBeatを更新
 			void UpdateHeartbeat(const GenApi::INodeMap& nodeMap, double timeout) throw(...);
 
-			// DeviceLost̃R[obNo^
+			// DeviceLostのコールバックを登録
 			void RegisterDeviceLost(const GenApi::INodeMap& nodeMap) throw(...);
 
-			// ڑς݂mF
+			// 接続済みを確認
 			void IsConnected();
 
+			// デバイスの予約を解除
+			void CancelDevice();
+
+			// 受け取ったバッファから画像のクラスを更新
+			void UpdateImage(const StApi::CIStStreamBufferPtr& stStreamBuffer, Image::CObject& image, Exception::EnumCode& errorCode) throw(...);
+
 		private:
-			//! rNX(Cup)
+			//! 排他制御クラス(ライブラリ用)
 			std::recursive_mutex m_asyncLibrary;
 
-			//! VXe
-			StApi::CIStSystemPtr m_stSystem;
-
-			//! C^[tF[X
+			//! インターフェース
 			StApi::CIStDevicePtr m_stDevice;
 
-			//! f[^Xg[
+			//! データストリーム
 			StApi::CIStDataStreamPtr m_stDataStream;
+
+			//! パラメータ ※接続中はノードを保持
+			CParameter m_parameter;
+
+			//! 予約したデバイスの識別子
+			std::string m_deviceId;
+
+			//! 他のカメラが更新したデバイスリストを使用する間隔[ms]
+			int m_listInterval;
 		};
 	}
 }
\ No newline at end of file
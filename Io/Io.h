@@ -17,40 +17,40 @@ namespace Standard
 {
 	namespace Io
 	{
-		// o[W擾
+		// バージョンを取得
 		IO_API Version::CObject GetVersion() throw(...);
 
-		// Oʒm֐̓o^
+		// 例外を通知する関数の登録
 		IO_API void AttachFunctionException(std::function<void(const Exception::CObject&)> object);
 
-		// Oʒm֐̉
+		// 例外を通知する関数の解除
 		IO_API void DetachFunctionException();
 
-		// ͂̕ωʒm֐̓o^
+		// 入力の変化を通知する関数の登録
 		IO_API void AttachFunctionInput(std::function<void(const Status::CInput&)> object);
 
-		// ͂̕ωʒm֐̉
+		// 入力の変化を通知する関数の解除
 		IO_API void DetachFunctionInput();
 
-		// 
+		// 初期化
 		IO_API void Initialize(const Setting::CDefault& object) throw(...);
 
-		// j
+		// 破棄
 		IO_API void Destroy() throw(...);
 
-		// ڑ
+		// 接続
 		IO_API void Connect(const Setting::CConnect& object) throw(...);
 
-		// ؒf
+		// 切断
 		IO_API void Disconnect() throw(...);
 
-		// 
+		// 入力
 		IO_API Status::CInput ReadInput(const Setting::CInput& object) throw(...);
 
-		// o
+		// 出力
 		IO_API void WriteOutput(const Status::COutput& object) throw(...);
 
-		// ͂̃gK҂
+		// 入力のトリガ待ち
 		IO_API void TriggerInputPending(const Setting::CInputPending& object) throw(...);
 	}
 }
\ No newline at end of file
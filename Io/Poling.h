@@ -14,21 +14,21 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CTemplate
-				/// @brief      IO̐AIO̊ĎAԂʒmev[g̃NX
-				///				 ԂĎA݁Aʒmev[ggNXh
+				/// @brief      IOの制御、IOの監視、状態を通知するテンプレートのクラス
+				///				⇒ 状態を監視、書き込み、通知するテンプレートを拡張したクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CTemplate
 					: virtual public Signal::Worker::CTemplateExpand<CSetting, Status::CInput, Status::COutput>
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CTemplate() : Signal::Worker::CTemplateExpand<CSetting, Status::CInput, Status::COutput>()
 					{
 						std::string name;
 
-						// ̂XV
+						// 名称を更新
 						name = "Io::Poling::";
 						SetName(name);
 						SetNameException(name + "Exception::");
@@ -36,7 +36,7 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					virtual ~CTemplate()
 					{
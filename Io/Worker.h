@@ -19,15 +19,15 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CInput
-				/// @brief      ͂Ďʂ̃NX
-				///				 ԂĎʂێev[g̃NXp
+				/// @brief      入力を監視した結果のクラス
+				///				⇒ 状態を監視した結果を保持するテンプレートのクラスから継承
 				////////////////////////////////////////////////////////////////////////////////
 				class CInput
 					: virtual public Signal::Result::CTemplate
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CInput() : Signal::Result::CTemplate()
 					{
@@ -35,19 +35,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CInput& operator = (const CInput& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CInput()
 					{
@@ -56,8 +56,8 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CInput& object)
 					{
@@ -65,24 +65,24 @@ namespace Standard
 					}
 
 				public:
-					//! gK[̐ݒNX
+					//! トリガーの設定クラス
 					Setting::CTrigger Setting;
 				};
 
-				//! gKʒm֐̒`
+				//! トリガを通知する関数の定義
 				typedef void(OnWakeup)(const Trigger::CInput&);
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CSetting
-				/// @brief      Ď̐ݒNX
-				///				 IO̓͂ω̂҂ݒNXp
+				/// @brief      監視の設定クラス
+				///				⇒ IOの入力が変化するのを待つ設定クラスから継承
 				////////////////////////////////////////////////////////////////////////////////
 				class CSetting
 					: virtual public Setting::CTrigger
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CSetting() : Setting::CTrigger()
 					{
@@ -90,31 +90,31 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			gK[̐ݒNX
+					/// @brief			コピー代入演算子
+					/// @return			トリガーの設定クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CSetting& operator = (const Setting::CTrigger& object) noexcept
 					{
-						// ̊֐
+						// 既定の関数
 						Io::Setting::CTrigger::Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CSetting& operator = (const CSetting& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CSetting()
 					{
@@ -123,32 +123,32 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CSetting& object)
 					{
-						// ̊֐
+						// 既定の関数
 						Io::Setting::CTrigger::Update(object);
 
 						this->Wakeup = object.Wakeup;
 					}
 
 				public:
-					//! gK[̒ʒmĂяo֐
+					//! トリガーの通知を呼び出す関数
 					std::weak_ptr<std::function<OnWakeup>> Wakeup;
 				};
 			}
 
-			//! ͂̕ωʒm֐̒`
+			//! 入力の変化を通知する関数の定義
 			typedef void(OnChange)(const Status::CInput&);
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CTemplate
-			/// @brief      Io̐sev[g̃NX
-			///				 foCX̐sev[g̃NXh
-			/// @param[in]	CDefault	ftHg̐ݒNXw
-			/// @param[in]	CConnect	ڑ̐ݒNXw
+			/// @brief      Ioの制御を行うテンプレートのクラス
+			///				⇒ デバイスの制御を行うテンプレートのクラスから派生
+			/// @param[in]	CDefault	デフォルトの設定クラスを指定
+			/// @param[in]	CConnect	接続の設定クラスを指定
 			////////////////////////////////////////////////////////////////////////////////
 			template <typename CPoling>
 			class CTemplate
@@ -156,84 +156,136 @@ namespace Standard
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate() : Device::Worker::CTemplate<Setting::CDefault, Setting::CConnect>()
 				{
-					// ̂XV
+					// 名称を更新
 					SetName("Io::");
 					m_noticeChange.SetName("Io::Notice::");
+
+					m_noticed = 0;
+
+					// 入力の変化を統合する関数を登録 ⇒ アドレスごとに最新の値へ統合
+					m_noticeChange.AttachFunctionMerge([](Status::CInput& latest, const Status::CInput& object) { latest += object; });
+
+					// 入力の変化のキーを登録 ⇒ 未通知の変化は1つに統合して、通知時に最新の状態だけ渡す
+					m_noticeChange.AttachFunctionKey([](const Status::CInput&) { return (size_t)0; });
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CTemplate()
 				{
-					// ͂̕ωʒm֐̉
+					// 入力の変化を通知する関数の解除
 					DetachFunctionInput();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Ԃ̒ʒmJn
-				/// @detail			ʒm֐o^OɌĂяo
-				/// @param[in]		cycle	Ԃ̒ʒmĎԊu[ms]
+				/// @brief			状態の通知を開始
+				/// @detail			通知する関数を登録する前に呼び出す
+				/// @param[in]		cycle	状態の通知を監視する間隔[ms]
 				////////////////////////////////////////////////////////////////////////////////
 				void StartNotice(int cycle = 60000)
 				{
-					// Ԃ̒ʒmsݒ
+					// 状態の通知を行う周期を設定
 					m_noticeChange.SetCycle(cycle);
 
-					// Ԃ̒ʒmJn
+					// 状態の通知を開始
 					m_noticeChange.Start();
 
-					// Ԃ̒ʒmŏv
+					// 状態の通知で初期化を要求
 					m_noticeChange.RequestInitialize();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Ԃ̒ʒm~
-				/// @detail			ʒm֐ɌĂяo
+				/// @brief			状態の通知を停止
+				/// @detail			通知する関数を解除後に呼び出す
 				////////////////////////////////////////////////////////////////////////////////
 				void StopNotice()
 				{
-					// Ԃ̒ʒmŔjv
+					// 状態の通知で破棄を要求
 					m_noticeChange.RequestDestroy();
 
-					// Ԃ̒ʒm~
+					// 状態の通知を停止
 					m_noticeChange.Stop();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			͂̕ωʒm֐̓o^
-				/// @detail			͂̕ωɌĂяoꂽ֐w肷
-				/// @param[in]		object	Ăяoꂽ֐
+				/// @brief			入力の変化を通知する関数の登録
+				/// @detail			入力の変化時に呼び出されたい関数を指定する
+				/// @param[in]		object	呼び出されたい関数
 				////////////////////////////////////////////////////////////////////////////////
 				void AttachFunctionInput(std::function<void(const Status::CInput&)> object)
 				{
-					// Ԃ̒ʒmJn
+					// 状態の通知を開始
 					StartNotice();
 
-					// ͂̕ωʒm֐̓o^
+					// 入力の変化を通知する関数の登録
 					m_noticeChange.AttachFunctionCalled(object);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			͂̕ωʒm֐̉
-				/// @detail			͂̕ωɌĂяo֐
+				/// @brief			入力の変化をまとめて通知する関数の登録
+				/// @detail			溜まっている入力の変化をまとめて1回で通知する
+				/// @param[in]		object	呼び出されたい関数
+				////////////////////////////////////////////////////////////////////////////////
+				void AttachFunctionInputBatch(std::function<void(const std::vector<Status::CInput>&)> object)
+				{
+					// 状態の通知を開始
+					StartNotice();
+
+					// 入力の変化をまとめて通知する関数の登録
+					m_noticeChange.AttachFunctionBatch(object);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			入力の変化を通知する上限を更新
+				/// @detail			通知が遅れた場合に溜まる入力の変化の数を制限する
+				/// @param[in]		capacity	溜める数の上限 ※0の場合は無制限
+				/// @param[in]		overflow	上限に達した場合の動作
+				////////////////////////////////////////////////////////////////////////////////
+				void SetNoticeCapacity(size_t capacity, Notice::Worker::EnumOverflow overflow)
+				{
+					// 入力の変化を通知する上限を更新
+					m_noticeChange.SetCapacity(capacity, overflow);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			入力の変化で破棄した数を取得
+				/// @return			破棄した数
+				////////////////////////////////////////////////////////////////////////////////
+				size_t GetNoticeDropped()
+				{
+					return m_noticeChange.GetDropped();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			入力の変化で統合した数を取得
+				/// @return			統合した数
+				////////////////////////////////////////////////////////////////////////////////
+				size_t GetNoticeMerged()
+				{
+					return m_noticeChange.GetMerged();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			入力の変化を通知する関数の解除
+				/// @detail			入力の変化時に呼び出される関数を解除する
 				////////////////////////////////////////////////////////////////////////////////
 				void DetachFunctionInput()
 				{
-					// ͂̕ωʒm֐̉
+					// 入力の変化を通知する関数の解除
 					m_noticeChange.DetachFunctionCalled();
 
-					// Ԃ̒ʒm~
+					// 状態の通知を停止
 					StopNotice();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			͂̃gKҋ@
-				/// @param[in]		object	IO̓͂ω̂҂ݒNX
+				/// @brief			入力のトリガを待機
+				/// @param[in]		object	IOの入力が変化するのを待つ設定クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void TriggerInputPending(const Setting::CInputPending& object)
 				{
@@ -245,80 +297,94 @@ namespace Standard
 
 					logging.Message << GetName() << "TriggerInputPending()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// 䂪\mF
+					// 制御が可能か確認
 					IsControllable();
 
+					// 短い周期の読み込みを要求中
+					bool active = false;
+
 					try
 					{
-						// gK[ҋ@NX
+						// トリガーを待機するクラス
 						Signal::Observer::CTemplate<Trigger::CInput> observer;
 
-						// gK[ʒm֐o^
+						// トリガーを通知をする関数を登録
 						postscript << "Subject::RegistrationFunction()";
 						std::shared_ptr<std::function<Trigger::OnWakeup>> onWakeup = std::make_shared<std::function<Trigger::OnWakeup>>(std::bind(&Signal::Observer::CTemplate<Trigger::CInput>::OnCalled, &observer, std::placeholders::_1));
 
-						// gK[ҋ@^CAEgXV
+						// トリガーを待機するタイムアウトを更新
 						observer.Setting.Timeout = object.Timeout;
 
 						Trigger::CSetting setting;
 
-						// gK[̐ݒRs[
+						// トリガーの設定をコピー
 						setting = object.Trigger;
 
-						// gK[ʒm֐XV
+						// トリガーを通知する関数を更新
 						setting.Wakeup = onWakeup;
 						postscript.str("");
 
-						// ͂ĎăgK̒ʒm֐o^
-						postscript << "RegistrationTrigger(AhX:" << Specify::Format(setting.Address) << ",rbg̕:" << setting.Direction << ")";
+						// 入力を監視してトリガの通知をする関数を登録
+						postscript << "RegistrationTrigger(アドレス:" << Specify::Format(setting.Address) << ",ビットの方向:" << setting.Direction << ")";
 						RegistrationTrigger(setting);
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// vN
-						postscript << "WakeupRequestAction()";
-						m_poling.WakeupRequestAction();
+						// 短い周期の読み込みを要求 ⇒ 動作要求を起床
+						postscript << "RegistrationActive()";
+						m_poling.RegistrationActive();
+						active = true;
 						postscript.str("");
 
-						// gK[҂
+						// トリガーを待つ
 						postscript << "Observer::Wait()";
 						observer.Wait();
-						// Oo
+
+						// 短い周期の読み込みの要求を解除
+						m_poling.CancellationActive();
+						active = false;
+						// ログ出力
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// ͂̌ʂ擾
+						// 入力の結果を取得
 						postscript << "Observer::GetArgument()";
 						Trigger::CInput result = observer.GetArgument();
 						postscript.str("");
 
-						// fmF
+						// 中断を確認
 						if (result.Suspension)
 						{
-							// f
-							postscript << "Observer::Trigger()" << Logging::ConstSeparator << "f";
+							// 中断
+							postscript << "Observer::Trigger()" << Logging::ConstSeparator << "中断";
 
-							// O𔭖C
+							// 例外を発砲
 							throw std::exception();
 						}
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  OʒmC
+						if (active)
+						{
+							// 短い周期の読み込みの要求を解除
+							m_poling.CancellationActive();
+						}
+
+						// 例外の処理 ⇒ 例外を通知＆発砲
 						throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			͂ǂݍ
-				/// @param[in]		object	͂̐ݒNX
-				/// @return			IȌ()NX
+				/// @brief			入力を読み込み
+				/// @param[in]		object	入力の設定クラス
+				/// @return			IOの状態(入力)クラス
 				////////////////////////////////////////////////////////////////////////////////
 				Status::CInput ReadInput(const Setting::CInput& object) throw(...)
 				{
@@ -331,35 +397,35 @@ namespace Standard
 
 					logging.Message << GetName() << "ReadInput()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// 䂪\mF
+					// 制御が可能か確認
 					IsControllable();
 
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncData);
 
-						// AhX𑖍
+						// アドレスを走査
 						for (const auto& address : object.Addresses)
 						{
-							// AhXmF
+							// アドレスを確認
 							if (m_input.Values.count(address) <= 0)
 							{
-								// AhXȂ  ̃AhX
+								// アドレスなし ⇒ 次のアドレスへ
 								continue;
 							}
 
-							// lm
+							// 値を確定
 							ret.Values[address] = m_input.Values.at(address);
 						}
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  OʒmC
+						// 例外の処理 ⇒ 例外を通知＆発砲
 						throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 					}
 
@@ -367,8 +433,8 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			o͂
-				/// @param[in]		object	IȌ(o)NX
+				/// @brief			出力を書き込み
+				/// @param[in]		object	IOの状態(出力)クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void WriteOutput(const Status::COutput& object) throw(...)
 				{
@@ -377,24 +443,24 @@ namespace Standard
 
 					logging.Message << GetName() << "WriteOutput()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// 䂪\mF
+					// 制御が可能か確認
 					IsControllable();
 
-					// o͂XV
+					// 出力を更新
 					SetOutput(object);
 
-					// o͂
+					// 出力を書き込み
 					m_poling.RequestWrite(object);
 				}
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ς݂̗O𔭖C
-				///					p֐
+				/// @brief			初期化済みの例外を発砲
+				///					★継承した関数
 				////////////////////////////////////////////////////////////////////////////////
 				void ExceptionInitialized() override
 				{
@@ -403,13 +469,13 @@ namespace Standard
 
 					logging.Message << GetName() << "ExceptionInitialized()" << Logging::ConstSeparator;
 
-					// O𔭖C
+					// 例外を発砲
 					OutputException(Exception::CodeIoInitialized, logging, postscript.str());
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			jς݂̗O𔭖C
-				///					p֐
+				/// @brief			破棄済みの例外を発砲
+				///					★継承した関数
 				////////////////////////////////////////////////////////////////////////////////
 				void ExceptionDiscarded() override
 				{
@@ -418,13 +484,13 @@ namespace Standard
 
 					logging.Message << GetName() << "ExceptionDiscarded()" << Logging::ConstSeparator;
 
-					// O𔭖C
+					// 例外を発砲
 					OutputException(Exception::CodeIoDiscarded, logging, postscript.str());
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̗O𔭖C
-				///					p֐
+				/// @brief			未初期化の例外を発砲
+				///					★継承した関数
 				////////////////////////////////////////////////////////////////////////////////
 				void ExceptionUninitialized() override
 				{
@@ -433,15 +499,15 @@ namespace Standard
 
 					logging.Message << GetName() << "ExceptionUninitialized()" << Logging::ConstSeparator;
 
-					// O𔭖C
+					// 例外を発砲
 					OutputException(Exception::CodeIoUninitialized, logging, postscript.str());
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			
-				/// @detail			̃^C~OŌĂяo
-				///					|[O̗Oʒm֐o^A̍XVȂǍs
-				///					p֐
+				/// @brief			初期化
+				/// @detail			初期化のタイミングで呼び出される
+				///					※ポーリングの例外を通知する関数を登録、周期の更新など行う
+				///					★継承した関数
 				////////////////////////////////////////////////////////////////////////////////
 				void InitializeDerived() override
 				{
@@ -453,58 +519,71 @@ namespace Standard
 
 					logging.Message << GetName() << "InitializeDerived()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
 					try
 					{
-						// OM֐̓o^
+						// 共有のスレッドプールでポーリングするかを更新
+						// ※通知する関数の登録で通知のスレッドが開始する為、先に更新する
+						postscript << "Poling::SetExecutor()";
+						m_poling.SetExecutor(GetDefaultSetting().Executor);
+						postscript.str("");
+
+						// 例外を受信する関数の登録
 						postscript << "Poling::AttachFunctionException()";
 						m_poling.AttachFunctionException(std::bind(&CTemplate::OnException, this, std::placeholders::_1));
 						postscript.str("");
 
-						// ͂M֐̓o^
+						// 入力を受信する関数の登録
 						postscript << "Poling::AttachFunctionCalled()";
 						m_poling.AttachFunctionCalled(std::bind(&CTemplate::OnInput, this, std::placeholders::_1));
 						postscript.str("");
 
-						// ftHg̐ݒNX擾
+						// デフォルトの設定クラスを取得
 						Setting::CDefault defaultSetting = GetDefaultSetting();
 
-						// |[O̎XV
+						// ポーリングの周期を更新
 						postscript << "Poling::SetCycle(" << defaultSetting.Cycle << ")";
 						m_poling.SetCycle(defaultSetting.Cycle);
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// Io|[Oׂ̐ݒ擾
+						// 変化がない間のポーリングの周期を更新
+						postscript << "Poling::SetCycleAdaptive(" << defaultSetting.CycleIdle << "," << defaultSetting.CycleHold << ")";
+						m_poling.SetCycleAdaptive(defaultSetting.CycleIdle, defaultSetting.CycleHold);
+						// ログ出力
+						Transfer::Output(Logging::Join(logging, postscript.str()));
+						postscript.str("");
+
+						// Ioをポーリングする為の設定を取得
 						postscript << "Poling::GetSetting()";
 						Poling::CSetting polingSetting = m_poling.GetSetting();
 						postscript.str("");
 
-						// ftHg̐ݒXV
+						// デフォルトの設定を更新
 						polingSetting.Default = defaultSetting;
 
-						// |[ÕgC
+						// ポーリングのリトライ回数
 						postscript << "Poling::Setting::Retry(" << polingSetting.Default.Retry << ")";
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// |[Õ^CAEg
+						// ポーリングのタイムアウト
 						postscript << "Poling::Setting::Timeout(" << polingSetting.Default.Timeout << ")";
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// Io|[Oׂ̐ݒXV
+						// Ioをポーリングする為の設定を更新
 						postscript << "Poling::SetSetting()";
 						m_poling.SetSetting(polingSetting);
 						postscript.str("");
 
-						// Iõ|[OJn
+						// Ioのポーリングを開始
 						postscript << "Poling::Start()";
 						m_poling.Start();
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
@@ -512,16 +591,16 @@ namespace Standard
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  OʒmC
+						// 例外の処理 ⇒ 例外を通知＆発砲
 						throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			j
-				/// @detail			j̃^C~OŌĂяo
-				///					|[O̗Oʒm֐̉ȂǍs
-				///					p֐
+				/// @brief			破棄
+				/// @detail			破棄のタイミングで呼び出される
+				///					※ポーリングの例外を通知する関数の解除など行う
+				///					★継承した関数
 				////////////////////////////////////////////////////////////////////////////////
 				void DestroyDerived() override
 				{
@@ -533,39 +612,39 @@ namespace Standard
 
 					logging.Message << GetName() << "DestroyDerived()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
 					try
 					{
-						// j
+						// 破棄
 						postscript << "Poling::Destroy()";
 						m_poling.Destroy();
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
 						postscript.str("");
 
-						// ͂M֐̉
+						// 入力を受信する関数の解除
 						postscript << "Poling::DetachFunctionCalled()";
 						m_poling.DetachFunctionCalled();
 						postscript.str("");
 
-						// OM֐̉
+						// 例外を受信する関数の解除
 						postscript << "Poling::DetachFunctionException()";
 						m_poling.DetachFunctionException();
 						postscript.str("");
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  OʒmC
+						// 例外の処理 ⇒ 例外を通知＆発砲
 						throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ڑ
-				///	@detail			ڑ̃^C~OŌĂяo
-				///					p֐
+				/// @brief			接続
+				///	@detail			接続のタイミングで呼び出される
+				///					★継承した関数
 				////////////////////////////////////////////////////////////////////////////////
 				void ConnectDerived() override
 				{
@@ -577,54 +656,54 @@ namespace Standard
 
 					logging.Message << GetName() << "ConnectDerived()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
 					try
 					{
-						// j
+						// 破棄
 						postscript << "Poling::Destroy()";
 						m_poling.Destroy();
 						postscript.str("");
 
-						// Io|[Oׂ̐ݒ擾
+						// Ioをポーリングする為の設定を取得
 						postscript << "Poling::GetSetting()";
 						Poling::CSetting polingSetting = m_poling.GetSetting();
 						postscript.str("");
 
-						// ڑ̐ݒNX擾
+						// 接続の設定クラスを取得
 						Setting::CConnect connectSetting = GetConnectSetting();
 
-						// ڑ̐ݒXV
+						// 接続の設定を更新
 						polingSetting.Connect = connectSetting;
 
-						// |[O@̎ʎq
+						// ポーリングする機器の識別子
 						postscript << "Poling::Setting::Identifier(" << polingSetting.Connect.Identifier << ")";
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// |[Oœǂݍޔ͈͂mF
+						// ポーリングで読み込む範囲を確認
 						for (const auto& addressRange : polingSetting.Connect.AddressRanges)
 						{
-							// ǂݍޔ͈͂Oo
+							// 読み込む範囲をログ出力
 							postscript << "Poling::Setting::AddressRange(";
 							postscript << Specify::Format(addressRange.Start);
-							postscript << "` x";
+							postscript << "～ x";
 							postscript << addressRange.Size;
-							// Oo
+							// ログ出力
 							postscript << ")";
 							Transfer::Output(Logging::Join(logging, postscript.str()));
 							postscript.str("");
 						}
 
-						// Io|[Oׂ̐ݒXV
+						// Ioをポーリングする為の設定を更新
 						postscript << "Poling::SetSetting()";
 						m_poling.SetSetting(polingSetting);
 						postscript.str("");
 
-						// 
+						// 初期化
 						postscript << "Poling::Initialize()";
 						m_poling.Initialize();
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
@@ -632,15 +711,15 @@ namespace Standard
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  OʒmC
+						// 例外の処理 ⇒ 例外を通知＆発砲
 						throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ؒf
-				///	@detail			ؒf̃^C~OŌĂяo
-				///					p֐
+				/// @brief			切断
+				///	@detail			切断のタイミングで呼び出される
+				///					★継承した関数
 				////////////////////////////////////////////////////////////////////////////////
 				void DisconnectDerived() override
 				{
@@ -652,13 +731,13 @@ namespace Standard
 
 					logging.Message << GetName() << "DisconnectDerived()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
 					try
 					{
-						// j
+						// 破棄
 						postscript << "Poling::Destroy()";
 						m_poling.Destroy();
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
@@ -666,25 +745,25 @@ namespace Standard
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  OʒmC
+						// 例外の処理 ⇒ 例外を通知＆発砲
 						throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 					}
 				}
 
 			private:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			O󂯎֐
-				/// @param[in]		object	ÕNX
+				/// @brief			例外を受け取る関数
+				/// @param[in]		object	例外のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void OnException(const Exception::CObject& object)
 				{
-					// Oʒm
+					// 例外を通知
 					NotifyException(object);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			gK[̔C
-				/// @param[in]		object	AhXwNX
+				/// @brief			トリガーの発砲
+				/// @param[in]		object	アドレス指定クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void WakeupTrigger(const Status::CEntity& object)
 				{
@@ -693,101 +772,95 @@ namespace Standard
 
 					logging.Message << GetName() << "WakeupTrigger()" << Logging::ConstSeparator;
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncTrigger);
 
 					do
 					{
-						// rbgmF
+						// ビットを確認
 						if (m_triggers.count(object) <= 0)
 						{
-							// o^Ȃ
+							// 登録なし
 							break;
 						}
 
-						// rbg̕
+						// ビットの方向
 						Status::EnumDirection direction = Status::DirectionRise;
 
-						// rbgĎԂmF
+						// ビットを監視する状態を確認
 						if (m_triggers.at(object).count(Status::DirectionRise))
 						{
-							// rbg̗オĎ  rbgオĂ邩mF
+							// ビットの立ち上がりを監視 ⇒ ビットが立ち上がっているか確認
 							if (Variant::Convert<bool>(object.Value) == false)
 							{
-								// rbgOFF
+								// ビットがOFF
 								break;
 							}
 
-							// rbg̕m
+							// ビットの方向を確定
 							direction = Status::DirectionRise;
 						}
 						else if (m_triggers.at(object).count(Status::DirectionFall))
 						{
-							// rbg̗Ď  rbgĂ邩mF
+							// ビットの立下りを監視 ⇒ ビットが立ち下がっているか確認
 							if (Variant::Convert<bool>(object.Value))
 							{
-								// rbgON
+								// ビットがON
 								break;
 							}
 
-							// rbg̕m
+							// ビットの方向を確定
 							direction = Status::DirectionFall;
 						}
 						else
 						{
-							// rbg̏Ȃ
+							// ビットの情報なし
 							break;
 						}
 
 						Trigger::CInput result;
 
-						// AhXXV
+						// アドレスを更新
 						result.Setting.Address = object;
-						// rbg̕XV
+						// ビットの方向を更新
 						result.Setting.Direction = direction;
-						// ftO
+						// 中断フラグを解除
 						result.Suspension = false;
 
-						// o^𑖍
-						postscript << "AhX:" << Specify::Format(object) << Logging::ConstSeparator << "rbg:" << Variant::FormatValue(object.Value) << Logging::ConstSeparator << "gKʒm";
-						for (auto iterator = m_triggers.at(object).at(direction).begin(); iterator != m_triggers.at(object).at(direction).end(); iterator++)
+						// 登録した関数を通知
+						postscript << "アドレス:" << Specify::Format(object) << Logging::ConstSeparator << "ビット:" << Variant::FormatValue(object.Value) << Logging::ConstSeparator << "トリガを通知";
+						try
 						{
-							Signal::Subject::CTemplate<Trigger::CInput> subject;
-
-							// ֐o^
-							subject.RegistrationFunction(*iterator);
-
-							try
-							{
-								// ֐ʒm
-								subject.CallingFunction(result);
-							}
-							catch (const std::exception& e)
-							{
-								// G[bZ[W𓝍
-								postscript << Logging::ConstSeparator << e.what();
-							}
+							// 登録した関数を全て通知 ⇒ 例外はまとめて発砲
+							m_triggers.at(object).at(direction).CallingFunction(result);
+						}
+						catch (const std::exception& e)
+						{
+							// エラーメッセージを統合
+							postscript << Logging::ConstSeparator << e.what();
 						}
 
-						// rbg̕폜
+						// ビットの方向を削除
 						m_triggers.at(object).clear();
 
-						// AhXƂɓo^Ă֐̐mF
+						// アドレスごとに登録してある関数の数を確認
 						if (m_triggers.at(object).size() <= 0)
 						{
-							// o^Ȃ  AhXƂ̓o^폜
+							// 登録なし ⇒ アドレスごとの登録を削除
 							m_triggers.erase(object);
 						}
 
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 					} while (false);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			͂̃Cxg
-				/// @param[in]		object	IȌ()̃NX
+				/// @brief			入力のイベント
+				/// @detail			監視で変化したアドレスだけ通知されるが、取りこぼし後や読み込みの失敗後は全て通知されるため、
+				///					格納済みの値と比較して変化したアドレスだけトリガーを発砲・通知する
+				/// @param[in]		object	IOの状態(入力)のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void OnInput(const Status::CInput& object)
 				{
@@ -798,69 +871,96 @@ namespace Standard
 
 					Status::CInput changedInput;
 					std::vector<Status::CEntity> triggers;
-					bool notify = false;
 
-					// AhX𑖍
-					for (const auto& value : object.Values)
 					{
-						postscript << "AhX:" << Specify::Format(value.first);
-						postscript << Logging::ConstSeparator << Variant::FormatType(value.second) << ":";
-
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncData);
 
-						// AhXo^ς݂mF
-						if (0 < m_input.Values.count(value.first))
+						// 通知の取りこぼしを確認
+						if (object.Previous != m_input.Sequence)
 						{
-							// f[^  i[ς݂̒lƔr
-							if (Variant::Equal(m_input.Values.at(value.first), value.second))
+							postscript << "連番の欠落:" << m_input.Sequence << " → " << object.Previous;
+							// ログ出力
+							Transfer::Output(Logging::Join(logging, postscript.str()));
+							postscript.str("");
+
+							// 取りこぼした変化を補うため、全ての状態の通知を要求
+							m_poling.RequestSnapshot();
+						}
+
+						// アドレスを走査
+						for (const auto& value : object.Values)
+						{
+							postscript << "アドレス:" << Specify::Format(value.first);
+							postscript << Logging::ConstSeparator << Variant::FormatType(value.second) << ":";
+
+							// アドレスが登録済みか確認
+							auto before = m_input.Values.find(value.first);
+
+							if (before != m_input.Values.end())
 							{
-								// l̕ωȂ  ̃AhX
-								postscript.str("");
-								continue;
+								// データあり ⇒ 格納済みの値と比較
+								if (Variant::Equal(before->second, value.second))
+								{
+									// 値の変化なし ⇒ 次のアドレスへ
+									postscript.str("");
+									continue;
+								}
+
+								// 変化あり
+								postscript << Variant::FormatValue(before->second) << " → ";
 							}
 
-							// ω
-							postscript << Variant::FormatValue(m_input.Values.at(value.first)) << "  ";
+							// 新規or変化あり
+							postscript << Variant::FormatValue(value.second);
+							m_input.Values[value.first] = value.second;
+							changedInput.Values[value.first] = value.second;
+							// ログ出力
+							Transfer::Output(Logging::Join(logging, postscript.str()));
+							postscript.str("");
+
+							// 型を確認
+							if (value.second.type() == typeid(bool))
+							{
+								// ビット型 ⇒ トリガーを確定
+								triggers.emplace_back(Status::CEntity(value.first, value.second));
+							}
 						}
 
-						// VKorω
-						postscript << Variant::FormatValue(value.second);
-						m_input.Values[value.first] = value.second;
-						changedInput.Values[value.first] = value.second;
-						// Oo
-						Transfer::Output(Logging::Join(logging, postscript.str()));
-						postscript.str("");
+						// 連番と時刻を更新
+						m_input.Sequence = object.Sequence;
+						m_input.Timestamp = object.Timestamp;
 
-						// ^mF
-						if (value.second.type() == typeid(bool))
+						// 変化を確認
+						if (changedInput.Values.empty() == false)
 						{
-							// rbg^  gK[m
-							triggers.emplace_back(Status::CEntity(value.first, value.second));
-						}
+							// 通知する連番を確定 ※直前の連番は変化を通知した連番
+							changedInput.Sequence = object.Sequence;
+							changedInput.Previous = m_noticed;
+							changedInput.Timestamp = object.Timestamp;
 
-						// l
-						notify = true;
+							m_noticed = object.Sequence;
+						}
 					}
 
-					// gK[𔭖C
+					// トリガーを発砲
 					for (const auto& trigger : triggers)
 					{
-						// gK[̔C
+						// トリガーの発砲
 						WakeupTrigger(trigger);
 					}
 
-					// ʒmf[^mF
-					if (notify)
+					// 通知するデータを確認
+					if (changedInput.Values.empty() == false)
 					{
-						// ʒmf[^  ͒l̕ωʒm
-						m_noticeChange.RequestNotice(changedInput);
+						// 通知するデータがある ⇒ 入力値の変化を通知 ※ポーリングを止めないように待機しない
+						m_noticeChange.RequestNotice(changedInput, false);
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			o͂XV
-				/// @param[in]		object	IȌ(o)NX
+				/// @brief			出力を更新
+				/// @param[in]		object	IOの状態(出力)クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void SetOutput(const Status::COutput& object)
 				{
@@ -869,95 +969,98 @@ namespace Standard
 
 					logging.Message << GetName() << "SetOutput()" << Logging::ConstSeparator;
 
-					// f[^𑖍
+					// データを走査
 					for (const auto& entity : object.Entitys)
 					{
-						postscript << "AhX:" << Specify::Format(entity);
+						postscript << "アドレス:" << Specify::Format(entity);
 						postscript << Logging::ConstSeparator << Variant::FormatType(entity.Value) << ":";
 
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncData);
 
-						// AhX̃f[^擾
+						// アドレスのデータを取得
 						auto element = std::find_if(m_output.Entitys.begin(), m_output.Entitys.end(), [&](const auto& element) { return Variant::Equal(element, entity); });
 
-						// AhXo^ς݂mF
+						// アドレスが登録済みか確認
 						if (element != m_output.Entitys.end())
 						{
-							// f[^
-							postscript << Variant::FormatValue(element->Value) << "  ";
+							// データあり
+							postscript << Variant::FormatValue(element->Value) << " → ";
 
-							// f[^XV
+							// データを更新
 							element->Value = entity.Value;
 						}
 						else
 						{
-							// f[^Ȃ  f[^ǉ
+							// データなし ⇒ データを追加
 							m_output.Entitys.emplace_back(entity);
 
-							// \[g
+							// ソート
 							std::sort(m_output.Entitys.begin(), m_output.Entitys.end(), [](auto const& first, auto const& second)
 							{
 								return first < second;
 							});
 						}
 
-						// ω
+						// 変化あり
 						postscript << Variant::FormatValue(entity.Value);
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			͂̃gKʒm֐o^
-				/// @param[in]		object	Ď̐ݒNX
+				/// @brief			入力のトリガを通知する関数を登録
+				/// @param[in]		object	監視の設定クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void RegistrationTrigger(const Trigger::CSetting& object)
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncTrigger);
 
-					// AhXƂɓo^Ă֐̐mF
+					// アドレスごとに登録してある関数の数を確認
 					if (m_triggers.count(object.Address) <= 0)
 					{
-						// o^Ȃ  AhXo^
+						// 登録なし ⇒ アドレスを登録
 						m_triggers[object.Address];
 					}
 
-					// rbg̓̕o^mF
+					// ビットの方向の登録を確認
 					if (m_triggers.at(object.Address).count(object.Direction) <= 0)
 					{
-						// o^Ȃ  rbg̕o^
+						// 登録なし ⇒ ビットの方向を登録
 						m_triggers.at(object.Address)[object.Direction];
 					}
 
-					// gKʒm֐o^
-					m_triggers.at(object.Address).at(object.Direction).emplace_back(object.Wakeup);
+					// トリガを通知する関数を追加
+					m_triggers.at(object.Address).at(object.Direction).AppendFunction(object.Wakeup);
 				}
 
 			private:
-				//! rNX(f[^p)
+				//! 排他制御クラス(データ用)
 				std::recursive_mutex m_asyncData;
 
-				//! IȌ()̃NX
+				//! IOの状態(入力)のクラス
 				Status::CInput m_input;
 
-				//! IȌ(o)̃NX
+				//! 入力の変化を最後に通知した連番
+				uint64_t m_noticed;
+
+				//! IOの状態(出力)のクラス
 				Status::COutput m_output;
 
-				//! IO̊ĎAIO̐AԂʒmNX
+				//! IOの監視、IOの制御、状態を通知するクラス
 				CPoling m_poling;
 
-				//! ͂̕ωʒmNX
+				//! 入力の変化を通知するクラス
 				Notice::Worker::CTemplate<OnChange, Status::CInput> m_noticeChange;
 
-				//! rNX(͂̃gKʒm֐p)
+				//! 排他制御クラス(入力のトリガを通知する関数用)
 				std::recursive_mutex m_asyncTrigger;
 
-				//! ͂̃gKʒm֐
-				std::map<Specify::CAddress, std::map<Status::EnumDirection, std::vector<std::weak_ptr<std::function<Trigger::OnWakeup>>>>> m_triggers;
+				//! 入力のトリガを通知する関数
+				std::map<Specify::CAddress, std::map<Status::EnumDirection, Signal::Subject::CTemplate<Trigger::CInput>>> m_triggers;
 			};
 		}
 	}
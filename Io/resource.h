@@ -2,7 +2,7 @@
 // Microsoft Visual C++ generated include file.
 // Used by Io.rc
 
-// VIuWFNg̎̊l
+// 新しいオブジェクトの次の既定値
 // 
 #ifdef APSTUDIO_INVOKED
 #ifndef APSTUDIO_READONLY_SYMBOLS
@@ -8,11 +8,11 @@ namespace Standard
 {
 	namespace Io
 	{
-		//! Io̐sNX
+		//! Ioの制御を行うクラス
 		static CWorker _device;
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			o[W̃NX擾
+		/// @brief			バージョンのクラスを取得
 		////////////////////////////////////////////////////////////////////////////////
 		IO_API Version::CObject GetVersion()
 		{
@@ -20,124 +20,124 @@ namespace Standard
 
 			Version::CManager& versionManager = Version::CManager::Instance();
 
-			// o[W̃NX擾
+			// バージョンのクラスを取得
 			ret = versionManager.GetVersion();
 
 			return ret;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			Oʒm֐̓o^
-		/// @detail			O̔ɌĂяoꂽ֐w肷
-		/// @param[in]		object	Ăяoꂽ֐
+		/// @brief			例外を通知する関数の登録
+		/// @detail			例外の発生時に呼び出されたい関数を指定する
+		/// @param[in]		object	呼び出されたい関数
 		////////////////////////////////////////////////////////////////////////////////
 		IO_API void AttachFunctionException(std::function<void(const Exception::CObject&)> object)
 		{
-			// Oʒm֐̓o^
+			// 例外を通知する関数の登録
 			_device.AttachFunctionException(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			Oʒm֐̉
-		/// @detail			O̔ɌĂяo֐
+		/// @brief			例外を通知する関数の解除
+		/// @detail			例外の発生時に呼び出される関数を解除する
 		////////////////////////////////////////////////////////////////////////////////
 		IO_API void DetachFunctionException()
 		{
-			// Oʒm֐̉
+			// 例外を通知する関数の解除
 			_device.DetachFunctionException();
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			͂̕ωʒm֐̓o^
-		/// @detail			͂̕ωɌĂяoꂽ֐w肷
-		/// @param[in]		object	Ăяoꂽ֐
+		/// @brief			入力の変化を通知する関数の登録
+		/// @detail			入力の変化時に呼び出されたい関数を指定する
+		/// @param[in]		object	呼び出されたい関数
 		////////////////////////////////////////////////////////////////////////////////
 		IO_API void AttachFunctionInput(std::function<void(const Status::CInput&)> object)
 		{
-			// ͂̕ωʒm֐̓o^
+			// 入力の変化を通知する関数の登録
 			_device.AttachFunctionInput(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			͂̕ωʒm֐̉
-		/// @detail			͂̕ωɌĂяo֐
+		/// @brief			入力の変化を通知する関数の解除
+		/// @detail			入力の変化時に呼び出される関数を解除する
 		////////////////////////////////////////////////////////////////////////////////
 		IO_API void DetachFunctionInput()
 		{
-			// ͂̕ωʒm֐̉
+			// 入力の変化を通知する関数の解除
 			_device.DetachFunctionInput();
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			
-		/// @param[in]		object	ftHg̐ݒNX
+		/// @brief			初期化
+		/// @param[in]		object	デフォルトの設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		IO_API void Initialize(const Setting::CDefault& object)
 		{
-			// 
+			// 初期化
 			_device.Initialize(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			j
+		/// @brief			破棄
 		////////////////////////////////////////////////////////////////////////////////
 		IO_API void Destroy()
 		{
-			// j
+			// 破棄
 			_device.Destroy();
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ڑ
-		/// @param[in]		object	ڑ̐ݒNX
+		/// @brief			接続
+		/// @param[in]		object	接続の設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		IO_API void Connect(const Setting::CConnect& object)
 		{
-			// ڑ
+			// 接続
 			_device.Connect(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ؒf
+		/// @brief			切断
 		////////////////////////////////////////////////////////////////////////////////
 		IO_API void Disconnect()
 		{
-			// ؒf
+			// 切断
 			_device.Disconnect();
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			͂ǂݍ
-		/// @param[in]		object	͂̐ݒNX
-		/// @return			IȌ()NX
+		/// @brief			入力を読み込み
+		/// @param[in]		object	入力の設定クラス
+		/// @return			IOの状態(入力)クラス
 		////////////////////////////////////////////////////////////////////////////////
 		IO_API Status::CInput ReadInput(const Setting::CInput& object)
 		{
 			Status::CInput ret;
 
-			// ͂ǂݍ
+			// 入力を読み込み
 			ret = _device.ReadInput(object);
 
 			return ret;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			o͂
-		/// @param[in]		object	IȌ(o)NX
+		/// @brief			出力を書き込み
+		/// @param[in]		object	IOの状態(出力)クラス
 		////////////////////////////////////////////////////////////////////////////////
 		IO_API void WriteOutput(const Status::COutput& object)
 		{
-			// o͂
+			// 出力を書き込み
 			_device.WriteOutput(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			͂̃gK҂
-		/// @param[in]		object	VOi̐ݒNX
+		/// @brief			入力のトリガ待ち
+		/// @param[in]		object	シグナルの設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		IO_API void TriggerInputPending(const Setting::CInputPending& object)
 		{
-			// ͂̃gK҂
+			// 入力のトリガ待ち
 			_device.TriggerInputPending(object);
 		}
 	}
@@ -1,3 +1,6 @@
+#include <chrono>
+#include <cstring>
+
 #include "Poling.h"
 #include "Common/Tool/Variant.h"
 #include "Common/Io/Setting.h"
@@ -13,15 +16,42 @@ namespace Standard
 		namespace Poling
 		{
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			前回と同じ値か確認
+			/// @detail			レジスタの値をまとめて比較する
+			/// @param[in]		before	前回の値
+			/// @param[in]		after	今回の値
+			/// @return			true:同じ / false:変化あり
+			////////////////////////////////////////////////////////////////////////////////
+			template <typename T>
+			static bool IsSame(const std::vector<T>& before, const std::vector<T>& after)
+			{
+				return before.size() == after.size() && (after.empty() || std::memcmp(before.data(), after.data(), after.size() * sizeof(T)) == 0);
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			前回と同じ値か確認
+			/// @param[in]		before	前回の値
+			/// @param[in]		after	今回の値
+			/// @param[in]		index	番号
+			/// @return			true:同じ / false:新規or変化あり
+			////////////////////////////////////////////////////////////////////////////////
+			template <typename T>
+			static bool IsSame(const std::vector<T>& before, const std::vector<T>& after, size_t index)
+			{
+				return index < before.size() && before[index] == after[index];
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CWorker::CWorker() : Worker::CTemplate()
 			{
 				m_controller.Handle = MotionApi::ConstDisconnected;
+				m_sequence = 0;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CWorker::~CWorker()
 			{
@@ -29,17 +59,17 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			ڑ̏Ԃ擾
-			/// @return			true:ڑς / false:ڑ
+			/// @brief			接続の状態を取得
+			/// @return			true:接続済み / false:未接続
 			////////////////////////////////////////////////////////////////////////////////
 			bool CWorker::GetConnected()
 			{
 				bool ret = false;
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncController);
 
-				// nhmF
+				// ハンドルを確認
 				if (m_controller.Handle != MotionApi::ConstDisconnected)
 				{
 					ret = true;
@@ -49,7 +79,7 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			ڑς݂mF
+			/// @brief			接続済みを確認
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::IsConnected()
 			{
@@ -62,26 +92,26 @@ namespace Standard
 
 				try
 				{
-					// ڑ̏Ԃ擾
+					// 接続の状態を取得
 					postscript << "GetConnected()";
 					if (GetConnected() == false)
 					{
-						// ڑ  O𔭖C
-						throw std::exception("ڑ");
+						// 未接続 ⇒ 例外を発砲
+						throw std::exception("未接続");
 					}
 					postscript.str("");
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  OʒmC
+					// 例外の処理 ⇒ 例外を通知＆発砲
 					throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			
-			/// @detail			CXbh珉̃^C~OŌĂяo
-			///					p֐
+			/// @brief			初期化
+			/// @detail			メインスレッドから初期化のタイミングで呼び出される
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::InitializeDerived()
 			{
@@ -99,68 +129,71 @@ namespace Standard
 					Poling::CSetting polingSetting = GetSetting();
 					Plc::Controller::Setting::CInitialize setting;
 
-					// ̂XV
+					// 名称を更新
 					setting.Name = GetName();
 
-					// Rg[Jݒ擾
+					// コントローラを開く設定を取得
 					postscript << "OpenController";
 					boost::any buffer = polingSetting.Connect.Other.GetValue<Plc::EnumParameter>(Plc::ParameterOpenController);
 
-					// Rg[Jݒ肪LmF
+					// コントローラを開く設定が有効か確認
 					if (Variant::IsValue<std::string>(buffer))
 					{
-						// Rg[JݒXV
+						// コントローラを開く設定を更新
 						setting.Open.Input(Variant::Convert<std::string>(buffer));
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 					}
 					postscript.str("");
 
-					// Apĩ^CAEg擾
+					// Apiのタイムアウトを取得
 					postscript << "ApiTimeout";
 					buffer = polingSetting.Connect.Other.GetValue<Plc::EnumParameter>(Plc::ParameterApiTimeout);
 
-					// Apĩ^CAEgLmF
+					// Apiのタイムアウトが有効か確認
 					if (Variant::IsValue<std::string>(buffer))
 					{
-						// Apĩ^CAEgXV
+						// Apiのタイムアウトを更新
 						setting.ApiTimeout.Input(Variant::Convert<std::string>(buffer));
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 					}
 
-					// Rg[
+					// コントローラを初期化
 					postscript << "Plc::Controller::Initialize()";
 					auto resultInitialize = Plc::Controller::Initialize(setting);
 					postscript.str("");
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncController);
 
-					// Rg[̏XV
+					// コントローラの情報を更新
 					m_controller = resultInitialize.Controller;
 
-					// ̊N
+					// 前回の値を破棄 ⇒ 接続後の最初の読み込みは全て通知
+					m_images.clear();
+
+					// 初期化の完了を起床
 					postscript << "WakeupInitializeComplete()" << Logging::ConstSeparator << stopWatch.Format(true);
 					WakeupInitializeComplete(trigger);
 					postscript.str("");
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  ̊N
+					// 例外の処理 ⇒ 初期化の完了を起床
 					trigger.Suspension = true;
 					trigger.Message = e.what();
 					WakeupInitializeComplete(trigger);
 
-					// O𔭖C
+					// 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			j
-			/// @detail			CXbhj̃^C~OŌĂяo
-			///					p֐
+			/// @brief			破棄
+			/// @detail			メインスレッドから破棄のタイミングで呼び出される
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::DestroyDerived()
 			{
@@ -177,15 +210,15 @@ namespace Standard
 				{
 					do
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncController);
 
-						// ڑ̏ԂmF
+						// 接続の状態を確認
 						if (GetConnected() == false)
 						{
-							// ڑ
-							postscript << "ڑ";
-							// Oo
+							// 未接続
+							postscript << "未接続";
+							// ログ出力
 							Transfer::Output(Logging::Join(logging, postscript.str()));
 							postscript.str("");
 							break;
@@ -193,43 +226,43 @@ namespace Standard
 
 						Plc::Controller::Setting::CDestroy setting;
 
-						// ̂XV
+						// 名称を更新
 						setting.Name = GetName();
 
-						// nhXV
+						// ハンドルを更新
 						setting.Close.Handle = m_controller.Handle;
 
-						// Rg[j
+						// コントローラを破棄
 						postscript << "Plc::Controller::Destroy()";
 						Plc::Controller::Destroy(setting);
 						postscript.str("");
 
-						// nh
+						// ハンドルを初期化
 						m_controller.Handle = MotionApi::ConstDisconnected;
 					} while (false);
 
-					// j̊N
+					// 破棄の完了を起床
 					postscript << "WakeupDestroyComplete()" << Logging::ConstSeparator << stopWatch.Format(true);
 					WakeupDestroyComplete(trigger);
 					postscript.str("");
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  j̊N
+					// 例外の処理 ⇒ 破棄の完了を起床
 					trigger.Suspension = true;
 					trigger.Message = e.what();
 					WakeupDestroyComplete(trigger);
 
-					// O𔭖C
+					// 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			gCmF
-			///	@detail			ɓǂݍ݂s܂Ő񐔂̊Ԃ̓gCL
-			///					p֐
-			/// @return			true:gCL / false:gC
+			/// @brief			リトライを確認
+			///	@detail			正常に読み込みが行われるまで制限回数の間はリトライを有効
+			///					★継承した関数
+			/// @return			true:リトライが有効 / false:リトライが無効
 			////////////////////////////////////////////////////////////////////////////////
 			bool CWorker::IsRetry()
 			{
@@ -243,21 +276,21 @@ namespace Standard
 				Poling::CSetting polingSetting = GetSetting();
 				int retry = GetRetry();
 
-				logging.Message << "gC" << retry << "" << Logging::ConstSeparator;
+				logging.Message << "リトライ" << retry << "回目" << Logging::ConstSeparator;
 
-				// gC񐔂𔻒
+				// リトライ回数を判定
 				if (retry <= polingSetting.Retry)
 				{
-					// gC񐔂ݒȉ  gCL
+					// リトライ回数が設定以下 ⇒ リトライを有効
 					ret = true;
-					logging.Message << "L";
+					logging.Message << "有効";
 				}
 				else
 				{
-					// gC񐔂ݒ傫
-					logging.Message << "";
+					// リトライ回数が設定より大きい
+					logging.Message << "無効";
 				}
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
@@ -265,9 +298,9 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			ǂݍ
-			/// @detail			CXbhǂݍ݂̃^C~OŌĂяo
-			///					p֐
+			/// @brief			読み込み
+			/// @detail			メインスレッドから読み込みのタイミングで呼び出される
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::ReadDerived()
 			{
@@ -279,16 +312,16 @@ namespace Standard
 
 				logging.Message << GetName() << "ReadDerived()" << Logging::ConstSeparator;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
 				try
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncController);
 
-					// ڑς݂mF
+					// 接続済みを確認
 					postscript << "IsConnected()";
 					IsConnected();
 					postscript.str("");
@@ -297,86 +330,149 @@ namespace Standard
 
 					Status::CInput input;
 
-					// ^͈̔͂𑖍
+					// 全ての状態の通知の要求を確認
+					if (IsRequestSnapshot())
+					{
+						// 要求あり ⇒ 前回の値を破棄
+						m_images.clear();
+					}
+
+					// 前回の値の領域を確認
+					if (m_images.size() != setting.Connect.AddressRanges.size())
+					{
+						// 範囲が変わった ⇒ 前回の値を破棄
+						m_images.clear();
+						m_images.resize(setting.Connect.AddressRanges.size());
+					}
+
+					size_t range = 0;
+
+					// 型の範囲を走査
 					for (auto addressRange : setting.Connect.AddressRanges)
 					{
+						// 前回の値
+						auto& image = m_images[range++];
+
 						Plc::Register::CSpecify specify(addressRange.Start.Category);
 						Plc::Register::Setting::CGetContent content;
 
-						// ̂XV
+						// 名称を更新
 						content.Name = GetName();
 
-						// WX^̎ʂm
+						// レジスタの種別を確定
 						content.Category = addressRange.Start.Category;
-						// WX^̔ԍm
+						// レジスタの番号を確定
 						content.Index = addressRange.Start.Index;
-						// WX^͈̔͂m
+						// レジスタの範囲を確定
 						content.Size = addressRange.Size;
 
-						// WX^̓ǂݍ
+						// レジスタの読み込み
 						postscript << "Plc::Register::Get()";
 						auto result = Plc::Register::Get(content);
 						postscript.str("");
 
-						// WX^̒li[
-						for (const auto& bit : result.Bits)
+						// 前回と同じ値か確認
+						if (IsSame(image.Bits, result.Bits) && IsSame(image.Words, result.Words) && IsSame(image.Longs, result.Longs))
 						{
-							// rbg^
+							// 変化なし ⇒ 次の範囲へ
+							continue;
+						}
+
+						// 変化したレジスタの値だけ格納
+						for (size_t index = 0; index < result.Bits.size(); index++)
+						{
+							if (IsSame(image.Bits, result.Bits, index))
+							{
+								continue;
+							}
+
+							// ビット型
 							Io::Specify::CAddress address = addressRange.Start;
 
-							// AhX̕ϊm
+							// アドレスの変換を確定
 							address.Hex = true;
 							address.Margin = specify.GetMargin() + 1;
 
-							// AhXm
-							address.Index += bit.first;
-							input.Values[address] = (bool)(bit.second != 0 ? true : false);
+							// アドレスを確定
+							address.Index += (int)index;
+							input.Values[address] = (bool)(result.Bits[index] != 0 ? true : false);
 						}
-						for (const auto& numeric : result.Words)
+						for (size_t index = 0; index < result.Words.size(); index++)
 						{
+							if (IsSame(image.Words, result.Words, index))
+							{
+								continue;
+							}
+
 							Io::Specify::CAddress address = addressRange.Start;
 
-							// AhX̕ϊm
+							// アドレスの変換を確定
 							address.Hex = true;
 							address.Margin = specify.GetMargin();
 
-							// AhXm
-							address.Index += numeric.first;
-							input.Values[address] = (__int16)numeric.second;
+							// アドレスを確定
+							address.Index += (int)index;
+							input.Values[address] = (__int16)result.Words[index];
 						}
-						for (const auto& numeric : result.Longs)
+						for (size_t index = 0; index < result.Longs.size(); index++)
 						{
+							if (IsSame(image.Longs, result.Longs, index))
+							{
+								continue;
+							}
+
 							Io::Specify::CAddress address = addressRange.Start;
 
-							// AhX̕ϊm
+							// アドレスの変換を確定
 							address.Hex = true;
 							address.Margin = specify.GetMargin();
 
-							// AhXm
-							address.Index += numeric.first;
-							input.Values[address] = (__int32)numeric.second;
+							// アドレスを確定
+							// ※ロング型は2ワードごと
+							address.Index += (int)(index * 2);
+							input.Values[address] = (__int32)result.Longs[index];
 						}
+
+						// 前回の値を更新
+						image = result;
 					}
 
-					// ǂݍ݂ʒm
-					NotifyArgument(input);
+					// 変化を確認
+					if (input.Values.empty() == false)
+					{
+						// 連番と時刻を更新 ※時刻はGrabber::Frame::Now()と同じ時計
+						input.Sequence = ++m_sequence;
+						input.Previous = input.Sequence - 1;
+						input.Timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
 
-					// Oo
+						// 読み込みを通知
+						NotifyArgument(input);
+					}
+
+					// ログ出力
 					postscript << Logging::ConstSeparator << stopWatch.Format(true);
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  O𔭖C
+					{
+						// 排他制御
+						std::lock_guard<std::recursive_mutex> lock(m_asyncController);
+
+						// 前回の値を破棄 ⇒ 更新済みの値が通知されていないため、次の読み込みは全て通知
+						m_images.clear();
+					}
+
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			
-			/// @detail			CXbh珑݂̃^C~OŌĂяo
-			///					p֐
+			/// @brief			書き込み
+			/// @detail			メインスレッドから書き込みのタイミングで呼び出される
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::WriteDerived()
 			{
@@ -388,7 +484,7 @@ namespace Standard
 
 				logging.Message << GetName() << "WriteDerived()" << Logging::ConstSeparator;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
@@ -396,63 +492,71 @@ namespace Standard
 				{
 					std::lock_guard<std::recursive_mutex> lock(m_asyncController);
 
-					// ڑς݂mF
+					// 接続済みを確認
 					postscript << "IsConnected()";
 					IsConnected();
 					postscript.str("");
 
 					do
 					{
-						// ݃NX擾
-						auto write = GetWriteFirst();
+						// 書き込みクラスをまとめて取得
+						TakeWrites(m_takeWrites);
 
-						// ݃NXmF
-						if (write == nullptr)
-						{
-							break;
-						}
+						size_t index = 0;
 
-						// WX^̒lXV
-						for (const auto& entity : write->Entitys)
+						try
 						{
-							Plc::Register::CSpecify specify(entity.Category);
-							Plc::Register::Setting::CSetContent setting;
-
-							// ̂XV
-							setting.Name = GetName();
-
-							// WX^̎ʂm
-							setting.Category = entity.Category;
-							// WX^̔ԍm
-							setting.Index = entity.Index;
-							// WX^̒lmF
-							if (entity.Value.type() == typeid(bool))
+							for (; index < m_takeWrites.size(); index++)
 							{
-								// rbg^  WX^̃f[^m
-								setting.Values.emplace_back((short)Variant::Convert<bool>(entity.Value) ? 1 : 0);
+								const auto& write = m_takeWrites[index];
+
+								// レジスタの値を更新
+								for (const auto& entity : write.Entitys)
+								{
+									Plc::Register::CSpecify specify(entity.Category);
+									Plc::Register::Setting::CSetContent setting;
+
+									// 名称を更新
+									setting.Name = GetName();
+
+									// レジスタの種別を確定
+									setting.Category = entity.Category;
+									// レジスタの番号を確定
+									setting.Index = entity.Index;
+									// レジスタの値を確認
+									if (entity.Value.type() == typeid(bool))
+									{
+										// ビット型 ⇒ レジスタのデータを確定
+										setting.Values.emplace_back((short)Variant::Convert<bool>(entity.Value) ? 1 : 0);
+									}
+									else if (entity.Value.type() == typeid(__int16))
+									{
+										// 整数(2バイト)型 ⇒ レジスタのデータを確定
+										setting.Values.emplace_back((short)Variant::Convert<__int16>(entity.Value));
+									}
+									else if (entity.Value.type() == typeid(__int32))
+									{
+										// 整数(4バイト)型 ⇒ レジスタのデータを確定
+										setting.Values.emplace_back((short)(Variant::Convert<__int32>(entity.Value) >> 0 & 0xFFFF));
+										setting.Values.emplace_back((short)(Variant::Convert<__int32>(entity.Value) >> 16 & 0xFFFF));
+									}
+
+									// レジスタを更新
+									postscript << "Plc::Register::Set()";
+									Plc::Register::Set(setting);
+									postscript.str("");
+								}
 							}
-							else if (entity.Value.type() == typeid(__int16))
-							{
-								// (2oCg)^  WX^̃f[^m
-								setting.Values.emplace_back((short)Variant::Convert<__int16>(entity.Value));
-							}
-							else if (entity.Value.type() == typeid(__int32))
-							{
-								// (4oCg)^  WX^̃f[^m
-								setting.Values.emplace_back((short)(Variant::Convert<__int32>(entity.Value) >> 0 & 0xFFFF));
-								setting.Values.emplace_back((short)(Variant::Convert<__int32>(entity.Value) >> 16 & 0xFFFF));
-							}
-
-							// WX^XV
-							postscript << "Plc::Register::Set()";
-							Plc::Register::Set(setting);
-							postscript.str("");
+						}
+						catch (const std::exception&)
+						{
+							// 未処理のデータを戻す
+							m_restoreWrites.assign(std::make_move_iterator(m_takeWrites.begin() + index), std::make_move_iterator(m_takeWrites.end()));
+							RestoreWrites(m_restoreWrites);
+							throw;
 						}
 
-						// 擪ɓo^Ăf[^폜
-						PopWriteFirst();
-
-						// Oo
+						// ログ出力
 						postscript << "Write()" << Logging::ConstSeparator << stopWatch.Format(true);
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
@@ -460,7 +564,7 @@ namespace Standard
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
@@ -3,6 +3,7 @@
 #include "Io/Poling.h"
 
 #include "WrapperMotionApi/Result.h"
+#include "PlcMotionApi/Result.h"
 
 namespace Standard
 {
@@ -12,50 +13,63 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CWorker
-			/// @brief      IO̊ĎAIO̐AԂʒmNX
-			///				 IO̐AIO̊ĎAԂʒmev[g̃NXp
-			/// @detail		IO̊ĎAIO̐AԂ̒ʒms
+			/// @brief      IOの監視、IOの制御、状態を通知するクラス
+			///				⇒ IOの制御、IOの監視、状態を通知するテンプレートのクラスから継承
+			/// @detail		IOの監視、IOの制御、状態の通知を行う
 			////////////////////////////////////////////////////////////////////////////////
 			class CWorker
 				: virtual public Worker::CTemplate
 			{
 			public:
-				// RXgN^
+				// コンストラクタ
 				CWorker();
 
-				// fXgN^
+				// デストラクタ
 				~CWorker() override;
 
 			protected:
-				// 
+				// 初期化
 				void InitializeDerived() override;
 
-				// j
+				// 破棄
 				void DestroyDerived() override;
 
-				// gCmF
+				// リトライを確認
 				bool IsRetry() override;
 
-				// ǂݍ
+				// 読み込み
 				void ReadDerived() override;
 
-				// 
+				// 書き込み
 				void WriteDerived() override;
 
 			public:
-				// ڑ̏Ԃ擾
+				// 接続の状態を取得
 				bool GetConnected();
 
 			private:
-				// ڑς݂mF
+				// 接続済みを確認
 				void IsConnected();
 
 			private:
-				//! rNX(Rg[JʃNXp)
+				//! 排他制御クラス(コントローラを開いた結果クラス用)
 				std::recursive_mutex m_asyncController;
 
-				//! Rg[JʃNX
+				//! コントローラを開いた結果クラス
 				MotionApi::Controller::Result::COpen m_controller;
+
+				//! 前回読み込んだレジスタの値 ※型の範囲ごと、コントローラの情報クラス用の排他制御で参照・更新
+				std::vector<Plc::Register::Result::CContent> m_images;
+
+				//! 通知の連番
+				uint64_t m_sequence;
+
+				//! まとめて取得した書き込むクラス
+				//! ※確保済みの領域を使い回す
+				std::vector<Status::COutput> m_takeWrites;
+
+				//! 未処理で戻す書き込むクラス
+				std::vector<Status::COutput> m_restoreWrites;
 			};
 		}
 	}
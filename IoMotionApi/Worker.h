@@ -9,18 +9,18 @@ namespace Standard
 	{
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CWorker
-		/// @brief      IO̊ĎAIO̐AԂʒmNX
-		///				 IO̊ĎAIO̐AԂʒmev[g̃NXh
-		/// @detail		IO̊ĎAIO̐AԂ̒ʒms
+		/// @brief      IOの監視、IOの制御、状態を通知するクラス
+		///				⇒ IOの監視、IOの制御、状態を通知するテンプレートのクラスから派生
+		/// @detail		IOの監視、IOの制御、状態の通知を行う
 		////////////////////////////////////////////////////////////////////////////////
 		class CWorker
 			: virtual public Worker::CTemplate<Poling::CWorker>
 		{
 		public:
-			// RXgN^
+			// コンストラクタ
 			CWorker();
 
-			// fXgN^
+			// デストラクタ
 			~CWorker() override;
 		};
 	}
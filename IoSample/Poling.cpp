@@ -7,7 +7,7 @@ namespace Standard
 		namespace Poling
 		{
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CWorker::CWorker() : Worker::CTemplate()
 			{
@@ -15,7 +15,7 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CWorker::~CWorker()
 			{
@@ -23,9 +23,9 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			
-			/// @detail			CXbh珉̃^C~OŌĂяo
-			///					p֐
+			/// @brief			初期化
+			/// @detail			メインスレッドから初期化のタイミングで呼び出される
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::InitializeDerived()
 			{
@@ -38,7 +38,7 @@ namespace Standard
 
 				logging.Message << GetName() << "InitializeDerived()" << Logging::ConstSeparator;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
@@ -46,33 +46,33 @@ namespace Standard
 				{
 					Poling::CSetting setting = GetSetting();
 
-					//@@@ ^Iȑ҂
+					//@@@ 疑似的な待ち時間
 					std::this_thread::sleep_for(std::chrono::milliseconds(500));
 
-					// K{
-					//@@@ ڑ鏈Ȃ񂩂Lq
+					// ★必須
+					//@@@ 接続する処理なんかを記述する
 
-					// K{
-					// ̊N
+					// ★必須
+					// 初期化の完了を起床
 					postscript << "WakeupInitializeComplete()" << Logging::ConstSeparator << stopWatch.Format(true);
 					WakeupInitializeComplete(trigger);
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  ̊N
+					// 例外の処理 ⇒ 初期化の完了を起床
 					trigger.Suspension = true;
 					trigger.Message = e.what();
 					WakeupInitializeComplete(trigger);
 
-					// OʒmC
+					// 例外を通知＆発砲
 					throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			j
-			/// @detail			CXbhj̃^C~OŌĂяo
-			///					p֐
+			/// @brief			破棄
+			/// @detail			メインスレッドから破棄のタイミングで呼び出される
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::DestroyDerived()
 			{
@@ -85,39 +85,39 @@ namespace Standard
 
 				logging.Message << GetName() << "DestroyDerived()" << Logging::ConstSeparator;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
 				try
 				{
-					//@@@ ^Iȑ҂
+					//@@@ 疑似的な待ち時間
 					std::this_thread::sleep_for(std::chrono::milliseconds(700));
 
-					// K{
-					//@@@ ؒf鏈Ȃ񂩂Lq
+					// ★必須
+					//@@@ 切断する処理なんかを記述する
 
-					// K{
-					// j̊N
+					// ★必須
+					// 破棄の完了を起床
 					postscript << "WakeupDestroyComplete()" << Logging::ConstSeparator << stopWatch.Format(true);
 					WakeupDestroyComplete(trigger);
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  j̊N
+					// 例外の処理 ⇒ 破棄の完了を起床
 					trigger.Suspension = true;
 					trigger.Message = e.what();
 					WakeupDestroyComplete(trigger);
 
-					// OʒmC
+					// 例外を通知＆発砲
 					throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			ǂݍ
-			/// @detail			CXbhǂݍ݂̃^C~OŌĂяo
-			///					p֐
+			/// @brief			読み込み
+			/// @detail			メインスレッドから読み込みのタイミングで呼び出される
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::ReadDerived()
 			{
@@ -129,7 +129,7 @@ namespace Standard
 
 				logging.Message << GetName() << "ReadDerived()" << Logging::ConstSeparator;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
@@ -137,36 +137,37 @@ namespace Standard
 				{
 					Poling::CSetting setting = GetSetting();
 
-					//@@@ ^Iȑ҂
+					//@@@ 疑似的な待ち時間
 					std::this_thread::sleep_for(std::chrono::milliseconds(100));
 
-					// K{
-					//@@@ ǂݍ݂鏈Ȃ񂩂Lq
+					// ★必須
+					//@@@ 読み込みする処理なんかを記述する
 					Status::CInput input;
 					Setting::CAddressRange addressRange;
 
-					// K{
-					// ǂݍ݂ʒm
+					// ★必須
+					// 読み込みを通知 ※変化したアドレスだけ格納して、連番(Sequence/Previous)と時刻(Timestamp)を付加する
+					// ※IsRequestSnapshot()で全ての状態の通知を要求された場合は、変化していないアドレスも格納する
 					NotifyArgument(input);
 
-					// ǂݍ
+					// 読み込み
 					postscript << "Read()" << Logging::ConstSeparator << stopWatch.Format(true);
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  OʒmC
+					// 例外の処理 ⇒ 例外を通知＆発砲
 					throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			
-			/// @detail			CXbh珑݂̃^C~OŌĂяo
-			///					p֐
+			/// @brief			書き込み
+			/// @detail			メインスレッドから書き込みのタイミングで呼び出される
+			///					★継承した関数
 			////////////////////////////////////////////////////////////////////////////////
 			void CWorker::WriteDerived()
 			{
@@ -178,7 +179,7 @@ namespace Standard
 
 				logging.Message << GetName() << "WriteDerived()" << Logging::ConstSeparator;
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
@@ -186,36 +187,36 @@ namespace Standard
 				{
 					Poling::CSetting setting = GetSetting();
 
-					//@@@ ^Iȑ҂
+					//@@@ 疑似的な待ち時間
 					std::this_thread::sleep_for(std::chrono::milliseconds(200));
 
 					do
 					{
-						// K{
-						//@@@ ݂鏈Ȃ񂩂Lq
+						// ★必須
+						//@@@ 書き込みする処理なんかを記述する
 						auto write = GetWriteFirst();
 
-						// ݃NXmF
+						// 書き込みクラスを確認
 						if (write == nullptr)
 						{
 							break;
 						}
 
-						// K{
-						// 擪ɓo^Ăf[^폜
+						// ★必須
+						// 先頭に登録してあるデータを削除
 						PopWriteFirst();
 					} while (false);
 
-					// 
+					// 書き込み
 					postscript << "Write()" << Logging::ConstSeparator << stopWatch.Format(true);
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  OʒmC
+					// 例外の処理 ⇒ 例外を通知＆発砲
 					throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 				}
 			}
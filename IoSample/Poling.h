@@ -10,31 +10,31 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CWorker
-			/// @brief      IO̊ĎAIO̐AԂʒmNX
-			///				 IO̐AIO̊ĎAԂʒmev[g̃NXh
-			/// @detail		IO̊ĎAIO̐AԂ̒ʒms
+			/// @brief      IOの監視、IOの制御、状態を通知するクラス
+			///				⇒ IOの制御、IOの監視、状態を通知するテンプレートのクラスから派生
+			/// @detail		IOの監視、IOの制御、状態の通知を行う
 			////////////////////////////////////////////////////////////////////////////////
 			class CWorker
 				: virtual public Worker::CTemplate
 			{
 			public:
-				// RXgN^
+				// コンストラクタ
 				CWorker();
 
-				// fXgN^
+				// デストラクタ
 				~CWorker();
 
 			protected:
-				// 
+				// 初期化
 				void InitializeDerived() override;
 
-				// j
+				// 破棄
 				void DestroyDerived() override;
 
-				// ǂݍ
+				// 読み込み
 				void ReadDerived() override;
 
-				// 
+				// 書き込み
 				void WriteDerived() override;
 			};
 		}
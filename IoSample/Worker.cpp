@@ -5,7 +5,7 @@ namespace Standard
 	namespace Io
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			RXgN^
+		/// @brief			コンストラクタ
 		////////////////////////////////////////////////////////////////////////////////
 		CWorker::CWorker() : Worker::CTemplate<Poling::CWorker>()
 		{
@@ -13,7 +13,7 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fXgN^
+		/// @brief			デストラクタ
 		////////////////////////////////////////////////////////////////////////////////
 		CWorker::~CWorker()
 		{
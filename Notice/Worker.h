@@ -1,6 +1,7 @@
 #pragma once
 
 #include <deque>
+#include <condition_variable>
 
 #include "Thread/Worker.h"
 
@@ -10,12 +11,22 @@ namespace Standard
 	{
 		namespace Worker
 		{
+			////////////////////////////////////////////////////////////////////////////////
+			/// @enum			通知する情報が上限に達した場合の動作
+			////////////////////////////////////////////////////////////////////////////////
+			enum EnumOverflow
+			{
+				OverflowDropOldest,	// 古い情報を破棄
+				OverflowMerge,		// 最新の情報に統合
+				OverflowBlock		// 空きが出るまで待機 ※待機しない要求は統合か古い情報を破棄
+			};
+
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CTemplate
-			/// @brief      ʒmev[g̃NX
-			///				 Xbh̐sev[g̃NXh
-			/// @param[in]	FCalled	ʒmĂяo֐|C^(ev[gŎw)
-			/// @param[in]	CNotice	ʒm̃NX(ev[gŎw)
+			/// @brief      通知するテンプレートのクラス
+			///				⇒ スレッドの制御を行うテンプレートのクラスから派生
+			/// @param[in]	FCalled	通知を呼び出す関数ポインタ(テンプレートで指定)
+			/// @param[in]	CNotice	通知する情報のクラス(テンプレートで指定)
 			////////////////////////////////////////////////////////////////////////////////
 			template <typename FCalled, typename CNotice>
 			class CTemplate
@@ -23,19 +34,19 @@ namespace Standard
 			{
 			private:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @enum			̏
+				/// @enum			処理の順序
 				////////////////////////////////////////////////////////////////////////////////
 				enum EnumOrder
 				{
-					OrderWait,			// ҋ@
-					OrderInitialize,	// 
-					OrderDestroy,		// j
-					OrderNotice			// ʒm
+					OrderWait,			// 待機
+					OrderInitialize,	// 初期化
+					OrderDestroy,		// 破棄
+					OrderNotice			// 通知
 				};
 
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate() : Thread::Worker::CTemplate()
 				{
@@ -43,157 +54,314 @@ namespace Standard
 					m_requestInitialize = false;
 					m_requestDestroy = false;
 					_FunctionCalled = nullptr;
-
-					// ̂XV
+					_FunctionBatch = nullptr;
+					_FunctionMerge = nullptr;
+					_FunctionKey = nullptr;
+					m_capacity = 0;
+					m_overflow = OverflowDropOldest;
+					m_blockTimeout = 1000;
+					m_dropped = 0;
+					m_merged = 0;
+
+					// 名称を更新
 					SetName("Notice::");
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CTemplate()
 				{
-					// ʒm֐̉
+					// 通知する関数の解除
 					DetachFunctionCalled();
 				}
 
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ʒm֐̓o^
-				/// @param[in]		object	ʒm֐
+				/// @brief			通知する関数の登録
+				/// @param[in]		object	通知する関数
 				////////////////////////////////////////////////////////////////////////////////
 				void AttachFunctionCalled(std::function<void(const CNotice&)> object)
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFcalled);
 
 					_FunctionCalled = object;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ʒm֐̉
+				/// @brief			通知する関数の解除
 				////////////////////////////////////////////////////////////////////////////////
 				void DetachFunctionCalled()
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncFcalled);
 
 					_FunctionCalled = nullptr;
+					_FunctionBatch = nullptr;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			まとめて通知する関数の登録
+				/// @detail			登録した場合は溜まっている通知する情報をまとめて1回で通知する
+				/// @param[in]		object	まとめて通知する関数
+				////////////////////////////////////////////////////////////////////////////////
+				void AttachFunctionBatch(std::function<void(const std::vector<CNotice>&)> object)
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncFcalled);
+
+					_FunctionBatch = object;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			通知する情報を統合する関数の登録
+				/// @detail			上限に達した場合の動作が統合の場合に呼び出される
+				///					第1引数の最新の情報に第2引数の情報を統合する
+				/// @param[in]		object	統合する関数
+				////////////////////////////////////////////////////////////////////////////////
+				void AttachFunctionMerge(std::function<void(CNotice&, const CNotice&)> object)
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncNotice);
+
+					_FunctionMerge = object;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			通知する情報のキーを取得する関数の登録
+				/// @detail			統合する関数と合わせて登録した場合は、通知を要求した時点で
+				///					同じキーの未通知の情報に統合する ⇒ 溜まる数はキーの数まで
+				/// @param[in]		object	キーを取得する関数
+				////////////////////////////////////////////////////////////////////////////////
+				void AttachFunctionKey(std::function<size_t(const CNotice&)> object)
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncNotice);
+
+					_FunctionKey = object;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			v
+				/// @brief			通知する情報の上限を更新
+				/// @param[in]		capacity	通知する情報を保持する数の上限 ※0の場合は無制限
+				/// @param[in]		overflow	上限に達した場合の動作
+				/// @param[in]		timeout	空きが出るまで待機する時間[ms] ※上限に達した場合の動作が待機の場合
+				///							タイムアウトした場合は古い情報を破棄する
+				////////////////////////////////////////////////////////////////////////////////
+				void SetCapacity(size_t capacity, EnumOverflow overflow, int timeout = 1000)
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncNotice);
+
+					m_capacity = capacity;
+					m_overflow = overflow;
+					m_blockTimeout = timeout;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			破棄した通知する情報の数を取得
+				/// @return			破棄した数
+				////////////////////////////////////////////////////////////////////////////////
+				size_t GetDropped()
+				{
+					size_t ret = 0;
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncNotice);
+
+					ret = m_dropped;
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			統合した通知する情報の数を取得
+				/// @return			統合した数
+				////////////////////////////////////////////////////////////////////////////////
+				size_t GetMerged()
+				{
+					size_t ret = 0;
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncNotice);
+
+					ret = m_merged;
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			初期化を要求
 				////////////////////////////////////////////////////////////////////////////////
 				void RequestInitialize()
 				{
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					postscript << GetName() << "RequestInitialize()";
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncRequestInitialize);
 
-						// ̗vݒ
+						// 初期化の要求を設定
 						m_requestInitialize = true;
 
-						// vN
+						// 動作要求を起床
 						WakeupRequestAction();
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ
+						std::stringstream postscript;
+
+						// 例外の処理 ⇒ 例外の発生時だけ文字列を生成
+						postscript << GetName() << "RequestInitialize()";
 						postscript << Logging::ConstSeparator << e.what();
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(errorCode, deviceErrorCode, postscript.str());
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			jv
+				/// @brief			破棄を要求
 				////////////////////////////////////////////////////////////////////////////////
 				void RequestDestroy()
 				{
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					postscript << GetName() << "RequestDestroy()";
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncRequestDestroy);
 
-						// j̗vݒ
+						// 破棄の要求を設定
 						m_requestDestroy = true;
 
-						// vN
+						// 動作要求を起床
 						WakeupRequestAction();
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ
+						std::stringstream postscript;
+
+						// 例外の処理 ⇒ 例外の発生時だけ文字列を生成
+						postscript << GetName() << "RequestDestroy()";
 						postscript << Logging::ConstSeparator << e.what();
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(errorCode, deviceErrorCode, postscript.str());
 					}
 				}
 
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ʒmv
-				/// @param[in]		object	ʒm̃NX
+				/// @brief			通知を要求
+				/// @detail			キーを取得する関数がある場合は同じキーの未通知の情報に統合する
+				///					ポーリングのスレッドなど待機できない場合は、上限に達しても待機しない
+				/// @param[in]		object	通知する情報のクラス
+				/// @param[in]		block	true:上限に達した場合の動作が待機なら待機 / false:待機せずに統合か古い情報を破棄
 				////////////////////////////////////////////////////////////////////////////////
-				void RequestNotice(const CNotice object)
+				void RequestNotice(const CNotice object, bool block = true)
 				{
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					postscript << GetName() << "RequestNotice()";
-
 					try
 					{
-						// r
-						std::lock_guard<std::recursive_mutex> lock(m_asyncNotice);
+						// 排他制御
+						std::unique_lock<std::recursive_mutex> lock(m_asyncNotice);
 
-						// ʒm̃NXǉ
-						m_notices.push_back(object);
+						do
+						{
+							// 同じキーの未通知の情報に統合
+							if (MergeNotice(object))
+							{
+								break;
+							}
+
+							// 上限を確認
+							if (IsFullNotice() == false)
+							{
+								// 通知する情報のクラスを追加
+								m_notices.push_back(object);
+								break;
+							}
+
+							// 上限に達した ⇒ 上限に達した場合の動作を確認
+							EnumOverflow overflow = m_overflow;
+
+							if (overflow == OverflowBlock && block == false)
+							{
+								// 待機できない ⇒ 統合する関数がある場合は統合
+								overflow = (_FunctionMerge != nullptr) ? OverflowMerge : OverflowDropOldest;
+							}
+
+							switch (overflow)
+							{
+							case OverflowMerge:
+								// 統合 ⇒ 統合する関数を確認
+								if (_FunctionMerge != nullptr && m_notices.empty() == false)
+								{
+									// 最新の情報に統合
+									_FunctionMerge(m_notices.back(), object);
+									m_merged += 1;
+									break;
+								}
+
+								// 統合する関数なし ⇒ 古い情報を破棄
+								PopNoticeOldest();
+								m_notices.push_back(object);
+								break;
+
+							case OverflowBlock:
+								// 待機 ⇒ 空きが出るまで待機
+								m_releaseNotice.wait_for(lock, std::chrono::milliseconds(m_blockTimeout), [this] { return IsFullNotice() == false; });
+
+								// 待機後も空きなし ⇒ 古い情報を破棄
+								if (IsFullNotice())
+								{
+									PopNoticeOldest();
+								}
+
+								m_notices.push_back(object);
+								break;
+
+							default:
+								// 古い情報を破棄
+								PopNoticeOldest();
+								m_notices.push_back(object);
+								break;
+							}
+						} while (false);
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ
+						std::stringstream postscript;
+
+						// 例外の処理 ⇒ 例外の発生時だけ文字列を生成
+						postscript << GetName() << "RequestNotice()";
 						postscript << Logging::ConstSeparator << e.what();
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(errorCode, deviceErrorCode, postscript.str());
 					}
 
-					// vN
+					// 動作要求を起床
 					WakeupRequestAction();
 				}
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			C֐̏
-				/// @return			^CAEg[ms]
+				/// @brief			メイン関数の処理
+				/// @return			タイムアウト時間[ms]
 				////////////////////////////////////////////////////////////////////////////////
 				int MainAction() override
 				{
-					Logging::CObject logging;
-					std::stringstream postscript;
-
-					logging.Message << GetName() << "MainAction()" << Logging::ConstSeparator;
-
 					int ret = 0;
 
-					// ̊֐
+					// 既定の関数
 					ret = Thread::Worker::CTemplate::MainAction();
 
 					try
@@ -201,88 +369,92 @@ namespace Standard
 						switch (GetOrder())
 						{
 						case OrderWait:
-							// ҋ@  ̗vmF
+							// 待機 ⇒ 初期化の要求を確認
 							if (IsRequestInitialize())
 							{
-								// ^]XV
+								// 運転中を更新
 								SetRunning(true);
 
-								// ֈڍs
+								// 初期化へ移行
 								SetOrder(OrderInitialize);
 
-								// ^CAEg
+								// タイムアウトを初期化
 								ret = 0;
 								break;
 							}
 
-							// ^]
+							// 運転中を解除
 							SetRunning(false);
 							break;
 
 						case OrderInitialize:
-							//   ʒmֈڍs
+							// 初期化 ⇒ 通知へ移行
 							SetOrder(OrderNotice);
 
-							// ^CAEg
+							// タイムアウトを初期化
 							ret = 0;
 							break;
 
 						case OrderDestroy:
-							// j  ҋ@ֈڍs
+							// 破棄 ⇒ 待機へ移行
 							SetOrder(OrderWait);
 
-							// ^CAEg
+							// タイムアウトを初期化
 							ret = 0;
 							break;
 
 						case OrderNotice:
-							// ʒm  ʒmf[^̗LmF
+							// 通知 ⇒ 通知するデータの有無を確認
 							if (IsNotice())
 							{
-								// ʒmf[^  ʒm
+								// 通知するデータあり ⇒ 通知
 								Notice();
 
-								// ^CAEg
+								// タイムアウトを初期化
 								ret = 0;
 								break;
 							}
 
-							// ~̗v or j̗vmF
+							// 停止の要求 or 破棄の要求を確認
 							if (GetRequestStop() || IsRequestDestroy())
 							{
-								// ~v  jֈڍs
+								// 停止要求 ⇒ 破棄へ移行
 								SetOrder(OrderDestroy);
 
-								// ^CAEg
+								// タイムアウトを初期化
 								ret = 0;
 								break;
 							}
 
-							// ʒmf[^Ȃ  C֐̎Ń^CAEgݒ
+							// 通知するデータなし ⇒ メイン関数の周期でタイムアウトを設定
 							ret = GetCycle();
 							break;
 						}
 					}
 					catch (const Exception::CObject& e)
 					{
-						// Ȍ  ÕNXɕϊďo
-						Transfer::Output(Exception::Convert::Logging(logging, postscript.str(), e));
-						postscript.str("");
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "MainAction()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ ログのクラスに変換して出力
+						Transfer::Output(Exception::Convert::Logging(logging, "", e));
 
 						switch (GetOrder())
 						{
 						case OrderDestroy:
-							// j  ҋ@ֈڍs
+							// 破棄 ⇒ 待機へ移行
 							SetOrder(OrderWait);
 							break;
 
 						default:
-							// ̑  jֈڍs
+							// その他 ⇒ 破棄へ移行
 							SetOrder(OrderDestroy);
 							break;
 						}
 
-						// ^CAEg
+						// タイムアウトを初期化
 						ret = 0;
 					}
 
@@ -291,32 +463,32 @@ namespace Standard
 
 			private:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̏擾
-				/// @return			̏
+				/// @brief			処理の順序を取得
+				/// @return			処理の順序
 				////////////////////////////////////////////////////////////////////////////////
 				EnumOrder GetOrder()
 				{
 					EnumOrder ret = OrderWait;
 
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					postscript << GetName() << "GetOrder()";
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncOrder);
 
 						ret = m_order;
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ
+						std::stringstream postscript;
+
+						// 例外の処理 ⇒ 例外の発生時だけ文字列を生成
+						postscript << GetName() << "GetOrder()";
 						postscript << Logging::ConstSeparator << e.what();
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(errorCode, deviceErrorCode, postscript.str());
 					}
 
@@ -324,66 +496,66 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̏XV
-				/// @param[in]		value	̏
+				/// @brief			処理の順序を更新
+				/// @param[in]		value	処理の順序
 				////////////////////////////////////////////////////////////////////////////////
 				void SetOrder(EnumOrder value)
 				{
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					postscript << GetName() << "SetOrder()";
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncOrder);
 
 						m_order = value;
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ
+						std::stringstream postscript;
+
+						// 例外の処理 ⇒ 例外の発生時だけ文字列を生成
+						postscript << GetName() << "SetOrder()";
 						postscript << Logging::ConstSeparator << e.what();
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(errorCode, deviceErrorCode, postscript.str());
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̗vmF
-				/// @detail			mFɏ̗v͉
-				/// @return			true:v / false:͖v
+				/// @brief			初期化の要求を確認
+				/// @detail			確認後に初期化の要求は解除する
+				/// @return			true:初期化を要求 / false:初期化は未要求
 				////////////////////////////////////////////////////////////////////////////////
 				bool IsRequestInitialize()
 				{
 					bool ret = false;
 
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					postscript << GetName() << "IsRequestInitialize()";
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncRequestInitialize);
 
-						// ̗v擾
+						// 初期化の要求を取得
 						ret = m_requestInitialize;
 
-						// ̗v
+						// 初期化の要求を解除
 						m_requestInitialize = false;
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ
+						std::stringstream postscript;
+
+						// 例外の処理 ⇒ 例外の発生時だけ文字列を生成
+						postscript << GetName() << "IsRequestInitialize()";
 						postscript << Logging::ConstSeparator << e.what();
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(errorCode, deviceErrorCode, postscript.str());
 					}
 
@@ -391,37 +563,37 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			j̗vmF
-				/// @detail			mFɔj̗v͉
-				/// @return			true:jv / false:j͖v
+				/// @brief			破棄の要求を確認
+				/// @detail			確認後に破棄の要求は解除する
+				/// @return			true:破棄を要求 / false:破棄は未要求
 				////////////////////////////////////////////////////////////////////////////////
 				bool IsRequestDestroy()
 				{
 					bool ret = false;
 
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					postscript << GetName() << "IsRequestDestroy()";
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncRequestDestroy);
 
-						// j̗v擾
+						// 破棄の要求を取得
 						ret = m_requestDestroy;
 
-						// j̗v
+						// 破棄の要求を解除
 						m_requestDestroy = false;
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ
+						std::stringstream postscript;
+
+						// 例外の処理 ⇒ 例外の発生時だけ文字列を生成
+						postscript << GetName() << "IsRequestDestroy()";
 						postscript << Logging::ConstSeparator << e.what();
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(errorCode, deviceErrorCode, postscript.str());
 					}
 
@@ -429,37 +601,37 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ʒmf[^̗LmF
-				/// @return			true:ʒmf[^ / false:ʒmf[^Ȃ
+				/// @brief			通知するデータの有無を確認
+				/// @return			true:通知するデータあり / false:通知するデータなし
 				////////////////////////////////////////////////////////////////////////////////
 				bool IsNotice()
 				{
 					bool ret = false;
 
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					postscript << GetName() << "IsNotice()";
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncNotice);
 
-						// ʒm̃NXmF
+						// 通知する情報のクラス数を確認
 						if (0 < m_notices.size())
 						{
-							// ʒm񂠂
+							// 通知する情報あり
 							ret = true;
 						}
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ
+						std::stringstream postscript;
+
+						// 例外の処理 ⇒ 例外の発生時だけ文字列を生成
+						postscript << GetName() << "IsNotice()";
 						postscript << Logging::ConstSeparator << e.what();
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(errorCode, deviceErrorCode, postscript.str());
 					}
 
@@ -467,37 +639,42 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ʒm̃NXŐ擪̃f[^擾
-				/// @return			ʒm̃NX
+				/// @brief			通知する情報のクラスで先頭のデータを取り出し
+				/// @detail			取り出した後に空きを通知する
+				/// @return			通知する情報のクラス
 				////////////////////////////////////////////////////////////////////////////////
-				std::shared_ptr<CNotice> GetsNoticeFront()
+				std::shared_ptr<CNotice> PopNoticeFront()
 				{
 					std::shared_ptr<CNotice> ret = nullptr;
 
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					postscript << GetName() << "GetsNoticeFront()";
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncNotice);
 
-						// ʒm̃NXmF
+						// 通知する情報のクラス数を確認
 						if (0 < m_notices.size())
 						{
-							// ʒm̃NX  擪̒ʒm̃NX擾
-							ret = std::make_shared<CNotice>(m_notices.front());
+							// 通知する情報のクラスあり ⇒ 先頭の通知する情報のクラスを取り出し
+							ret = std::make_shared<CNotice>(std::move(m_notices.front()));
+							m_notices.pop_front();
+
+							// 空きを通知
+							m_releaseNotice.notify_all();
 						}
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ
+						std::stringstream postscript;
+
+						// 例外の処理 ⇒ 例外の発生時だけ文字列を生成
+						postscript << GetName() << "PopNoticeFront()";
 						postscript << Logging::ConstSeparator << e.what();
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(errorCode, deviceErrorCode, postscript.str());
 					}
 
@@ -505,124 +682,302 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ʒmĂяo
-				/// @param[in]		object	ʒm̃NX
+				/// @brief			通知を呼び出し
+				/// @param[in]		object	通知する情報のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Call(CNotice object)
 				{
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					postscript << GetName() << "Call()";
-
 					try
 					{
 						do
 						{
-							// r
+							// 排他制御
 							std::lock_guard<std::recursive_mutex> lock(m_asyncFcalled);
 
-							// ʒm֐mF
+							// 通知する関数を確認
 							if (_FunctionCalled == nullptr)
 							{
-								// ʒm֐Ȃ
+								// 通知する関数なし
 								break;
 							}
 
-							// ʒmĂяo
+							// 通知を呼び出し
 							_FunctionCalled(object);
 						} while (false);
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ
+						std::stringstream postscript;
+
+						// 例外の処理 ⇒ 例外の発生時だけ文字列を生成
+						postscript << GetName() << "Call()";
 						postscript << Logging::ConstSeparator << e.what();
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(errorCode, deviceErrorCode, postscript.str());
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ʒms
+				/// @brief			通知を実行
 				////////////////////////////////////////////////////////////////////////////////
 				void Notice()
 				{
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					postscript << GetName() << "Notice()";
-
 					try
 					{
 						do
 						{
-							// ʒm̃NXŐ擪̃f[^擾
-							std::shared_ptr<CNotice> notice = GetsNoticeFront();
+							// まとめて通知する関数を確認
+							if (IsFunctionBatch())
+							{
+								// まとめて通知
+								NoticeBatch();
+								break;
+							}
 
-							// ʒm̃NXmF
+							// 通知する情報のクラスで先頭のデータを取り出し
+							// ※通知中の情報に統合されないように、呼び出す前に取り出す
+							std::shared_ptr<CNotice> notice = PopNoticeFront();
+
+							// 通知する情報のクラスを確認
 							if (notice == nullptr)
 							{
-								// ʒm̃NXȂ
+								// 通知する情報のクラスなし
 								break;
 							}
 
-							// ʒmĂяo
+							// 通知を呼び出し
 							Call(*notice);
+						} while (false);
+					}
+					catch (const std::exception& e)
+					{
+						std::stringstream postscript;
+
+						// 例外の処理 ⇒ 例外の発生時だけ文字列を生成
+						postscript << GetName() << "Notice()";
+						postscript << Logging::ConstSeparator << e.what();
+
+						// 例外を発砲
+						throw Exception::CObject(errorCode, deviceErrorCode, postscript.str());
+					}
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			まとめて通知する関数の登録を確認
+				/// @return			true:登録あり / false:登録なし
+				////////////////////////////////////////////////////////////////////////////////
+				bool IsFunctionBatch()
+				{
+					bool ret = false;
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncFcalled);
+
+					if (_FunctionBatch != nullptr)
+					{
+						ret = true;
+					}
 
-							// r
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			まとめて通知を実行
+				/// @detail			溜まっている通知する情報のクラスを全て取り出して通知する
+				////////////////////////////////////////////////////////////////////////////////
+				void NoticeBatch()
+				{
+					Exception::EnumCode errorCode = Exception::CodeUnknown;
+					int deviceErrorCode = Exception::DeviceCodeSuccess;
+
+					try
+					{
+						// 前回の通知した情報を破棄 ⇒ 確保済みの領域は使い回す
+						m_batches.clear();
+
+						{
+							// 排他制御
 							std::lock_guard<std::recursive_mutex> lock(m_asyncNotice);
 
-							// ʒm̃NXmF
-							if (0 < m_notices.size())
+							// 通知する情報のクラスを全て取り出し
+							m_batches.insert(m_batches.end(), std::make_move_iterator(m_notices.begin()), std::make_move_iterator(m_notices.end()));
+							m_notices.clear();
+
+							// 空きを通知
+							m_releaseNotice.notify_all();
+						}
+
+						do
+						{
+							// 通知する情報のクラスを確認
+							if (m_batches.empty())
+							{
+								// 通知する情報のクラスなし
+								break;
+							}
+
+							// 排他制御
+							std::lock_guard<std::recursive_mutex> lock(m_asyncFcalled);
+
+							// まとめて通知する関数を確認
+							if (_FunctionBatch == nullptr)
 							{
-								// ʒm̃NX  擪̒ʒm̃NX폜
-								m_notices.erase(m_notices.begin());
+								// 通知する関数なし
+								break;
 							}
+
+							// まとめて通知を呼び出し
+							_FunctionBatch(m_batches);
 						} while (false);
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ
+						std::stringstream postscript;
+
+						// 例外の処理 ⇒ 例外の発生時だけ文字列を生成
+						postscript << GetName() << "NoticeBatch()";
 						postscript << Logging::ConstSeparator << e.what();
 
-						// O𔭖C
+						// 例外を発砲
 						throw Exception::CObject(errorCode, deviceErrorCode, postscript.str());
 					}
 				}
 
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			通知する情報のクラスの上限を確認
+				/// @detail			排他制御の中で呼び出す
+				/// @return			true:上限に達した / false:空きあり
+				////////////////////////////////////////////////////////////////////////////////
+				bool IsFullNotice()
+				{
+					bool ret = false;
+
+					// 上限の有無と保持数を確認
+					if (0 < m_capacity && m_capacity <= m_notices.size())
+					{
+						// 上限に達した
+						ret = true;
+					}
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			同じキーの未通知の情報に統合
+				/// @detail			排他制御の中で呼び出す
+				///					キーを取得する関数と統合する関数の両方がある場合だけ統合する
+				/// @param[in]		object	通知する情報のクラス
+				/// @return			true:統合 / false:同じキーの情報なし
+				////////////////////////////////////////////////////////////////////////////////
+				bool MergeNotice(const CNotice& object)
+				{
+					bool ret = false;
+
+					if (_FunctionKey != nullptr && _FunctionMerge != nullptr)
+					{
+						size_t key = _FunctionKey(object);
+
+						// 新しい情報から走査 ⇒ 溜まる数はキーの数までのため線形探索
+						for (auto notice = m_notices.rbegin(); notice != m_notices.rend(); ++notice)
+						{
+							if (_FunctionKey(*notice) == key)
+							{
+								// 同じキーの情報に統合
+								_FunctionMerge(*notice, object);
+								m_merged += 1;
+
+								ret = true;
+								break;
+							}
+						}
+					}
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			最も古い通知する情報のクラスを破棄
+				/// @detail			排他制御の中で呼び出す
+				////////////////////////////////////////////////////////////////////////////////
+				void PopNoticeOldest()
+				{
+					// 通知する情報のクラス数を確認
+					if (0 < m_notices.size())
+					{
+						// 先頭の通知する情報のクラスを削除
+						m_notices.pop_front();
+						m_dropped += 1;
+					}
+				}
+
 			private:
-				//! rNX(̏p)
+				//! 排他制御クラス(処理の順序用)
 				std::recursive_mutex m_asyncOrder;
 
-				//! ̏
+				//! 処理の順序
 				EnumOrder m_order;
 
-				//! rNX(̗vp)
+				//! 排他制御クラス(初期化の要求用)
 				std::recursive_mutex m_asyncRequestInitialize;
 
-				//! ̗v
+				//! 初期化の要求
 				bool m_requestInitialize;
 
-				//! rNX(j̗vp)
+				//! 排他制御クラス(破棄の要求用)
 				std::recursive_mutex m_asyncRequestDestroy;
 
-				//! j̗v
+				//! 破棄の要求
 				bool m_requestDestroy;
 
-				//! rNX(ʒm֐p)
+				//! 排他制御クラス(通知する関数用)
 				std::recursive_mutex m_asyncFcalled;
 
-				//! ʒm֐
+				//! 通知する関数
 				std::function<void(const CNotice&)> _FunctionCalled;
 
-				//! rNX(ʒm̃NXp)
+				//! まとめて通知する関数
+				std::function<void(const std::vector<CNotice>&)> _FunctionBatch;
+
+				//! 排他制御クラス(通知する情報のクラス用)
 				std::recursive_mutex m_asyncNotice;
 
-				//! ʒm̃NX
+				//! 通知する情報のクラス
 				std::deque<CNotice> m_notices;
+
+				//! 通知する情報のクラスの空きを通知
+				std::condition_variable_any m_releaseNotice;
+
+				//! 通知する情報を統合する関数
+				std::function<void(CNotice&, const CNotice&)> _FunctionMerge;
+
+				//! 通知する情報のキーを取得する関数
+				std::function<size_t(const CNotice&)> _FunctionKey;
+
+				//! 通知する情報のクラスを保持する数の上限 ※0の場合は無制限
+				size_t m_capacity;
+
+				//! 上限に達した場合の動作
+				EnumOverflow m_overflow;
+
+				//! 空きが出るまで待機する時間[ms]
+				int m_blockTimeout;
+
+				//! 破棄した通知する情報の数
+				size_t m_dropped;
+
+				//! 統合した通知する情報の数
+				size_t m_merged;
+
+				//! まとめて通知する情報のクラス
+				//! ※通知のスレッドのみで使用
+				std::vector<CNotice> m_batches;
 			};
 		}
 	}
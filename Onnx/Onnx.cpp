@@ -1,26 +1,111 @@
 #include "Onnx.h"
 
 #include "Common/Tool/Text.h"
-#include "Worker.h"
+#include "Registry.h"
 
 namespace Standard
 {
 	namespace Onnx
 	{
-		static CWorker _worker;
+		//! 名称を指定しない場合のモデルの名称
+		static const std::string ConstDefault = "";
+
+		static CRegistry _registry;
 
 		ONNX_API void Initialize()
 		{
-			_worker.LoadModel("D:\\model.onnx");
+			Setting::CModel object;
+
+			object.Path = "D:\\model.onnx";
+
+			_registry.Load(ConstDefault, object);
+		}
+
+		ONNX_API void Destroy()
+		{
+			_registry.Destroy();
 		}
 
 		ONNX_API void Test(const std::string& path)
 		{
-			//cv::Mat image;
+			cv::Mat image;
+
+			image = cv::imread(path);
+
+			_registry.Get(ConstDefault)->Search(image);
+		}
+
+		ONNX_API void LoadModel(const Setting::CModel& object)
+		{
+			_registry.Load(ConstDefault, object);
+		}
+
+		ONNX_API std::vector<Tensor::CObject> GetInputs()
+		{
+			return _registry.Get(ConstDefault)->GetInputs();
+		}
+
+		ONNX_API std::vector<Tensor::CObject> GetOutputs()
+		{
+			return _registry.Get(ConstDefault)->GetOutputs();
+		}
+
+		ONNX_API std::vector<Tensor::CObject> Search(const Image::CObject& object)
+		{
+			return Search(ConstDefault, object);
+		}
+
+		ONNX_API std::vector<std::vector<Tensor::CObject>> Search(const std::vector<Image::CObject>& objects)
+		{
+			return Search(ConstDefault, objects);
+		}
+
+		ONNX_API void LoadModel(const std::string& name, const Setting::CModel& object)
+		{
+			_registry.Load(name, object);
+		}
+
+		ONNX_API void LoadModelAsync(const std::string& name, const Setting::CModel& object)
+		{
+			_registry.LoadAsync(name, object);
+		}
+
+		ONNX_API void UnloadModel(const std::string& name)
+		{
+			_registry.Unload(name);
+		}
+
+		ONNX_API std::vector<Tensor::CObject> GetInputs(const std::string& name)
+		{
+			return _registry.Get(name)->GetInputs();
+		}
+
+		ONNX_API std::vector<Tensor::CObject> GetOutputs(const std::string& name)
+		{
+			return _registry.Get(name)->GetOutputs();
+		}
+
+		ONNX_API std::vector<Tensor::CObject> Search(const std::string& name, const Image::CObject& object)
+		{
+			return _registry.Get(name)->Search(object.Convert());
+		}
+
+		ONNX_API std::vector<std::vector<Tensor::CObject>> Search(const std::string& name, const std::vector<Image::CObject>& objects)
+		{
+			std::vector<cv::Mat> images;
+
+			// 画像だけ走査 ⇒ 画像のデータはコピーせずに参照
+			for (auto& object : objects)
+			{
+				images.push_back(object.Convert());
+			}
 
-			//image = cv::imread(path);
-			//
-			//_worker.Search(image);
+			return _registry.Get(name)->Search(images);
+		}
+
+		ONNX_API std::vector<Information::CObject> GetModels()
+		{
+			return _registry.GetInformation();
 		}
 	}
 }
\ No newline at end of file
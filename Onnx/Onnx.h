@@ -7,6 +7,12 @@
 #endif
 
 #include <string>
+#include <vector>
+
+#include "Common/Image/Basis.h"
+#include "Common/Onnx/Information.h"
+#include "Common/Onnx/Setting.h"
+#include "Common/Onnx/Tensor.h"
 
 namespace Standard
 {
@@ -14,6 +20,48 @@ namespace Standard
 	{
 		ONNX_API void Initialize();
 
+		// 破棄 ⇒ バックグラウンドの読み込みの完了を待機
+		ONNX_API void Destroy();
+
 		ONNX_API void Test(const std::string& path);
+
+		// モデル読み込み
+		ONNX_API void LoadModel(const Setting::CModel& object) throw(...);
+
+		// 入力の情報を取得
+		ONNX_API std::vector<Tensor::CObject> GetInputs() throw(...);
+
+		// 出力の情報を取得
+		ONNX_API std::vector<Tensor::CObject> GetOutputs() throw(...);
+
+		// 推論 ⇒ 複数のスレッドから同時に呼び出した画像はまとめて推論
+		ONNX_API std::vector<Tensor::CObject> Search(const Image::CObject& object) throw(...);
+
+		// 複数の画像を推論
+		ONNX_API std::vector<std::vector<Tensor::CObject>> Search(const std::vector<Image::CObject>& objects) throw(...);
+
+		// 名称を指定してモデル読み込み ⇒ 同じ名称のモデルは推論を止めずに入れ替え
+		ONNX_API void LoadModel(const std::string& name, const Setting::CModel& object) throw(...);
+
+		// 名称を指定してモデルをバックグラウンドで読み込み
+		ONNX_API void LoadModelAsync(const std::string& name, const Setting::CModel& object);
+
+		// 名称を指定してモデルを解放
+		ONNX_API void UnloadModel(const std::string& name);
+
+		// 名称を指定して入力の情報を取得
+		ONNX_API std::vector<Tensor::CObject> GetInputs(const std::string& name) throw(...);
+
+		// 名称を指定して出力の情報を取得
+		ONNX_API std::vector<Tensor::CObject> GetOutputs(const std::string& name) throw(...);
+
+		// 名称を指定して推論
+		ONNX_API std::vector<Tensor::CObject> Search(const std::string& name, const Image::CObject& object) throw(...);
+
+		// 名称を指定して複数の画像を推論
+		ONNX_API std::vector<std::vector<Tensor::CObject>> Search(const std::string& name, const std::vector<Image::CObject>& objects) throw(...);
+
+		// 読み込んだモデルの情報を取得
+		ONNX_API std::vector<Information::CObject> GetModels();
 	}
 }
\ No newline at end of file
@@ -0,0 +1,217 @@
+#include "Registry.h"
+
+#include <sstream>
+#include <thread>
+
+#include "Common/Exception/Basis.h"
+#include "Common/Logging/Basis.h"
+#include "Exception/Convert.h"
+#include "Transfer/Transfer.h"
+
+#pragma comment(lib, "Transfer.lib")
+
+namespace Standard
+{
+	namespace Onnx
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			コンストラクタ
+		////////////////////////////////////////////////////////////////////////////////
+		CRegistry::CRegistry()
+			: m_loading(std::make_shared<CLoading>())
+		{
+
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			デストラクタ
+		/// @detail			DLLの解放中に呼ばれるため待機しない ⇒ 読み込みの完了はDestroy()で待機する
+		////////////////////////////////////////////////////////////////////////////////
+		CRegistry::~CRegistry()
+		{
+
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			破棄
+		/// @detail			バックグラウンドの読み込みの完了を待機して、全てのモデルを解放する
+		////////////////////////////////////////////////////////////////////////////////
+		void CRegistry::Destroy()
+		{
+			{
+				// 排他制御
+				std::unique_lock<std::mutex> lock(m_loading->Async);
+
+				m_loading->Condition.wait(lock, [this] { return m_loading->Count == 0; });
+			}
+
+			std::map<std::string, std::shared_ptr<CWorker>> workers;
+
+			{
+				// 排他制御
+				std::lock_guard<std::mutex> lock(m_asyncWorker);
+
+				workers.swap(m_workers);
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			モデル読み込み
+		/// @detail			同じ名称のモデルがある場合は読み込みが完了した時点で入れ替える
+		///					読み込みに失敗した場合は読み込み済みのモデルで推論を続ける
+		/// @param[in]		name	モデルの名称
+		/// @param[in]		object	モデルの設定クラス
+		////////////////////////////////////////////////////////////////////////////////
+		void CRegistry::Load(const std::string& name, const Setting::CModel& object)
+		{
+			std::shared_ptr<CWorker> worker = Create(name);
+
+			worker->LoadModel(object);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			モデルをバックグラウンドで読み込み
+		/// @detail			読み込みの結果はGetInformation()で確認する ※失敗した場合はログを出力
+		/// @param[in]		name	モデルの名称
+		/// @param[in]		object	モデルの設定クラス
+		////////////////////////////////////////////////////////////////////////////////
+		void CRegistry::LoadAsync(const std::string& name, const Setting::CModel& object)
+		{
+			std::shared_ptr<CWorker> worker = Create(name);
+			std::shared_ptr<CLoading> loading = m_loading;
+
+			{
+				// 排他制御
+				std::lock_guard<std::mutex> lock(loading->Async);
+
+				loading->Count++;
+			}
+
+			// 読み込みを開始 ⇒ 解放した場合も読み込み中のクラスは完了まで有効
+			std::thread([loading, name, object, worker]
+			{
+				Logging::CObject logging;
+				std::stringstream postscript;
+
+				logging.Message << "Onnx::LoadAsync()" << Logging::ConstSeparator;
+				postscript << "名称:" << name;
+
+				try
+				{
+					worker->LoadModel(object);
+				}
+				catch (const std::exception& e)
+				{
+					// 例外の処理
+					Transfer::Output(Exception::Convert::Logging(logging, postscript.str(), e));
+				}
+
+				{
+					// 排他制御
+					std::lock_guard<std::mutex> lock(loading->Async);
+
+					loading->Count--;
+				}
+
+				loading->Condition.notify_all();
+			}).detach();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			モデルを解放
+		/// @detail			推論中のモデルは推論が終わると解放する
+		/// @param[in]		name	モデルの名称
+		////////////////////////////////////////////////////////////////////////////////
+		void CRegistry::Unload(const std::string& name)
+		{
+			// 排他制御
+			std::lock_guard<std::mutex> lock(m_asyncWorker);
+
+			m_workers.erase(name);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			推論を行うクラスを取得
+		/// @param[in]		name	モデルの名称
+		/// @return			推論を行うクラス
+		////////////////////////////////////////////////////////////////////////////////
+		std::shared_ptr<CWorker> CRegistry::Get(const std::string& name)
+		{
+			std::shared_ptr<CWorker> ret;
+
+			// 排他制御
+			std::lock_guard<std::mutex> lock(m_asyncWorker);
+
+			auto worker = m_workers.find(name);
+
+			// モデルを確認
+			if (worker == m_workers.end())
+			{
+				std::stringstream message;
+
+				message << "モデル未登録:" << name;
+
+				// 例外を発砲
+				throw Exception::CObject(Exception::CodeOnnxUnloaded, message.str());
+			}
+
+			ret = worker->second;
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			モデルの情報を取得
+		/// @return			名称ごとのモデルの情報
+		////////////////////////////////////////////////////////////////////////////////
+		std::vector<Information::CObject> CRegistry::GetInformation()
+		{
+			std::vector<Information::CObject> ret;
+
+			std::map<std::string, std::shared_ptr<CWorker>> workers;
+
+			{
+				// 排他制御
+				std::lock_guard<std::mutex> lock(m_asyncWorker);
+
+				workers = m_workers;
+			}
+
+			// モデルだけ走査
+			for (auto& worker : workers)
+			{
+				Information::CObject information = worker.second->GetInformation();
+
+				information.Name = worker.first;
+
+				ret.push_back(information);
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			推論を行うクラスを取得(なければ生成)
+		/// @param[in]		name	モデルの名称
+		/// @return			推論を行うクラス
+		////////////////////////////////////////////////////////////////////////////////
+		std::shared_ptr<CWorker> CRegistry::Create(const std::string& name)
+		{
+			std::shared_ptr<CWorker> ret;
+
+			// 排他制御
+			std::lock_guard<std::mutex> lock(m_asyncWorker);
+
+			std::shared_ptr<CWorker>& worker = m_workers[name];
+
+			if (worker == nullptr)
+			{
+				worker = std::make_shared<CWorker>();
+			}
+
+			ret = worker;
+
+			return ret;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Common/Onnx/Information.h"
+#include "Common/Onnx/Setting.h"
+#include "Worker.h"
+
+namespace Standard
+{
+	namespace Onnx
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CRegistry
+		/// @brief      名称ごとにモデルを保持するクラス
+		/// @detail		品種の切り替えなどで複数のモデルを同時に読み込み、名称を指定して推論する
+		///				読み込み直しは読み込み済みのモデルで推論を続けながら行い、完了した時点で入れ替える
+		////////////////////////////////////////////////////////////////////////////////
+		class CRegistry
+		{
+		public:
+			// コンストラクタ
+			CRegistry();
+
+			// デストラクタ
+			~CRegistry();
+
+			// 破棄
+			void Destroy();
+
+			// モデル読み込み
+			void Load(const std::string& name, const Setting::CModel& object) throw(...);
+
+			// モデルをバックグラウンドで読み込み
+			void LoadAsync(const std::string& name, const Setting::CModel& object);
+
+			// モデルを解放
+			void Unload(const std::string& name);
+
+			// 推論を行うクラスを取得
+			std::shared_ptr<CWorker> Get(const std::string& name) throw(...);
+
+			// モデルの情報を取得
+			std::vector<Information::CObject> GetInformation();
+
+		private:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @struct     CLoading
+			/// @brief      バックグラウンドの読み込みの数
+			/// @detail		読み込みのスレッドと共有し、破棄されたクラスを参照しない
+			////////////////////////////////////////////////////////////////////////////////
+			struct CLoading
+			{
+				//! 排他制御
+				std::mutex Async;
+
+				//! 読み込みの完了を通知
+				std::condition_variable Condition;
+
+				//! 読み込み中の数
+				int Count = 0;
+			};
+
+			// 推論を行うクラスを取得(なければ生成)
+			std::shared_ptr<CWorker> Create(const std::string& name);
+
+		private:
+			//! 排他制御(モデル)
+			std::mutex m_asyncWorker;
+
+			//! 名称ごとの推論を行うクラス
+			std::map<std::string, std::shared_ptr<CWorker>> m_workers;
+
+			//! バックグラウンドの読み込み
+			std::shared_ptr<CLoading> m_loading;
+		};
+	}
+}
\ No newline at end of file
@@ -1,32 +1,233 @@
 #include "Worker.h"
 
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <sstream>
+
+#include <sys/stat.h>
+
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+
+#include "Common/Exception/Basis.h"
+#include "Common/Logging/Basis.h"
+#include "Common/Tool/Logging.h"
 #include "Common/Tool/Text.h"
+#include "Common/Utility/StopWatch.h"
+#include "Transfer/Transfer.h"
+
+#pragma comment(lib, "Transfer.lib")
+#pragma comment(lib, "psapi.lib")
 
 namespace Standard
 {
 	namespace Onnx
 	{
-////////////////////////////////////////////////////////////////////////////////
-		/// @brief			RXgN^
 		////////////////////////////////////////////////////////////////////////////////
-		CWorker::CWorker()
+		/// @brief			要素の型を変換
+		/// @param[in]		type	推論のライブラリの要素の型
+		/// @return			要素の型
+		////////////////////////////////////////////////////////////////////////////////
+		static Tensor::EnumType ConvertType(ONNXTensorElementDataType type)
+		{
+			Tensor::EnumType ret = Tensor::TypeUnknown;
+
+			switch (type)
+			{
+			case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
+				ret = Tensor::TypeFloat;
+				break;
+			case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8:
+				ret = Tensor::TypeUint8;
+				break;
+			case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
+				ret = Tensor::TypeInt32;
+				break;
+			case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
+				ret = Tensor::TypeInt64;
+				break;
+			default:
+				break;
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			チャンネルごとの値を取得
+		/// @detail			設定が足りない場合は最後の値を使用する
+		/// @param[in]		values	チャンネルごとの値
+		/// @param[in]		channel	チャンネル
+		/// @param[in]		value	設定がない場合の値
+		/// @return			チャンネルの値
+		////////////////////////////////////////////////////////////////////////////////
+		static double ChannelValue(const std::vector<double>& values, int channel, double value)
+		{
+			double ret = value;
+
+			if (values.empty() == false)
+			{
+				ret = values.at(std::min<size_t>(channel, values.size() - 1));
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			推論の結果をコピー
+		/// @param[in]		value	推論の結果
+		/// @param[in]		offset	コピーする先頭の要素
+		/// @param[in]		count	コピーする要素数
+		/// @param[out]		object	コピー先
+		////////////////////////////////////////////////////////////////////////////////
+		template <class T>
+		static void CopyValue(const Ort::Value& value, size_t offset, size_t count, std::vector<float>& object)
+		{
+			const T* source = value.GetTensorData<T>() + offset;
+
+			object.resize(count);
+
+			std::transform(source, source + count, object.begin(), [](T element) { return static_cast<float>(element); });
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			最適化したモデルを使用するか判定
+		/// @detail			最適化したモデルがモデルより新しい場合だけ使用する
+		/// @param[in]		object	モデルの設定クラス
+		/// @return			true:最適化したモデルを使用 / false:モデルを最適化
+		////////////////////////////////////////////////////////////////////////////////
+		static bool IsOptimized(const Setting::CModel& object)
+		{
+			bool ret = false;
+
+			do
+			{
+				struct _stat64 optimized;
+				struct _stat64 model;
+
+				// 最適化したモデルのファイルを確認
+				if (object.OptimizedPath.empty() || ::_wstat64(Text::Convert(object.OptimizedPath).c_str(), &optimized) != 0)
+				{
+					// 保存しない、または未保存
+					break;
+				}
+
+				// 更新日時を確認 ⇒ モデルがない場合も最適化したモデルを使用
+				if (::_wstat64(Text::Convert(object.Path).c_str(), &model) != 0 || model.st_mtime <= optimized.st_mtime)
+				{
+					ret = true;
+				}
+			} while (false);
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			プロセスの専用のメモリを取得
+		/// @return			専用のメモリ[byte] ※取得に失敗した場合は0
+		////////////////////////////////////////////////////////////////////////////////
+		static uint64_t PrivateMemory()
 		{
-			m_session.release();
-			m_input_shape.at(0) = 1;
-			m_input_shape.at(1) = 1;
-			m_input_shape.at(2) = ConstImageWidth;
-			m_input_shape.at(3) = ConstImageHeight;
-			m_output_shape.at(0) = 1;
-			m_output_shape.at(1) = 10;
+			uint64_t ret = 0;
+
+			PROCESS_MEMORY_COUNTERS_EX counters = {};
 
-			auto memory_info = Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU);
+			// メモリの使用量を取得
+			if (::GetProcessMemoryInfo(::GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters), sizeof(counters)) != FALSE)
+			{
+				ret = counters.PrivateUsage;
+			}
 
-			m_input_tensor = Ort::Value::CreateTensor<float>(memory_info, m_input_image.data(), m_input_image.size(), m_input_shape.data(), m_input_shape.size());
-			m_output_tensor = Ort::Value::CreateTensor<float>(memory_info, m_results.data(), m_results.size(), m_output_shape.data(), m_output_shape.size());
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			モデルの読み込みの設定を生成
+		/// @param[in]		object	モデルの設定クラス
+		/// @param[in]		optimized	最適化したモデルを読み込むか
+		/// @return			モデルの読み込みの設定
+		////////////////////////////////////////////////////////////////////////////////
+		static Ort::SessionOptions CreateOptions(const Setting::CModel& object, bool optimized)
+		{
+			Ort::SessionOptions ret;
+
+			// スレッド数を更新
+			ret.SetIntraOpNumThreads(std::max(0, object.IntraThreads));
+
+			if (0 < object.InterThreads)
+			{
+				// ノード間を並列に演算
+				ret.SetExecutionMode(ExecutionMode::ORT_PARALLEL);
+				ret.SetInterOpNumThreads(object.InterThreads);
+			}
+
+			// 最適化したモデルを確認
+			if (optimized)
+			{
+				// 最適化済み ⇒ 読み込み時間を短くするため最適化しない
+				ret.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_DISABLE_ALL);
+			}
+			else
+			{
+				switch (object.Optimization)
+				{
+				case Setting::OptimizationDisable:
+					ret.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_DISABLE_ALL);
+					break;
+				case Setting::OptimizationBasic:
+					ret.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_BASIC);
+					break;
+				case Setting::OptimizationExtended:
+					ret.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_EXTENDED);
+					break;
+				default:
+					ret.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_ALL);
+					break;
+				}
+
+				if (object.OptimizedPath.empty() == false)
+				{
+					// 最適化したモデルを保存
+					ret.SetOptimizedModelFilePath(Text::Convert(object.OptimizedPath).c_str());
+				}
+			}
+
+			// メモリのアリーナを更新
+			if (object.MemoryArena)
+			{
+				ret.EnableCpuMemArena();
+			}
+			else
+			{
+				ret.DisableCpuMemArena();
+			}
+
+			// メモリの確保パターンを更新
+			if (object.MemoryPattern)
+			{
+				ret.EnableMemPattern();
+			}
+			else
+			{
+				ret.DisableMemPattern();
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			コンストラクタ
+		////////////////////////////////////////////////////////////////////////////////
+		CWorker::CWorker()
+		{
+			m_preparing = 0;
+			m_running = 0;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fXgN^
+		/// @brief			デストラクタ
 		////////////////////////////////////////////////////////////////////////////////
 		CWorker::~CWorker()
 		{
@@ -34,41 +235,722 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fǂݍ
-		/// @param[in]		f̃t@C
+		/// @brief			モデル読み込み
+		/// @detail			入出力の名称・形状・型はモデルから取得する
+		///					入力は画像1つ(NCHWまたはNHWC)のモデルだけ対応する
+		///					読み込み中も読み込み済みのモデルで推論し、空打ちまで済ませてから入れ替える
+		/// @param[in]		object	モデルの設定クラス
 		////////////////////////////////////////////////////////////////////////////////
-		void CWorker::LoadModel(const std::string& path)
+		void CWorker::LoadModel(const Setting::CModel& object)
 		{
-			// r
-			std::unique_lock<std::mutex> lock(m_asyncOrt);
+			Logging::CObject logging;
+			std::stringstream postscript;
+
+			logging.Message << "Onnx::LoadModel()" << Logging::ConstSeparator;
+
+			// 排他制御
+			std::lock_guard<std::mutex> load(m_asyncLoad);
+
+			{
+				// 排他制御
+				std::lock_guard<std::mutex> lock(m_asyncOrt);
+
+				m_information.State = Information::StateLoading;
+			}
+
+			try
+			{
+				Utility::CStopWatch stopWatch;
+
+				std::shared_ptr<CSession> session = std::make_shared<CSession>();
+				std::stringstream message;
+
+				session->Setting = object;
+
+				bool optimized = IsOptimized(object);
+				const std::string& path = optimized ? object.OptimizedPath : object.Path;
+
+				struct _stat64 status;
+
+				// ファイルのサイズを取得
+				session->FileSize = (::_wstat64(Text::Convert(path).c_str(), &status) == 0) ? (uint64_t)status.st_size : 0;
+
+				// 読み込み前のメモリを取得 ⇒ 他の推論や読み込みで増えた分も含むため目安
+				uint64_t memory = PrivateMemory();
+
+				// モデルを読み込み
+				postscript << "Ort::Session():" << path;
+				session->Session = std::make_unique<Ort::Session>(m_env, Text::Convert(path).c_str(), CreateOptions(object, optimized));
+				postscript.str("");
+
+				Ort::AllocatorWithDefaultOptions allocator;
+
+				// 入力数を確認
+				if (session->Session->GetInputCount() != 1)
+				{
+					message << "入力が画像1つのモデルだけ対応:" << session->Session->GetInputCount();
+
+					// 例外を発砲
+					throw Exception::CObject(Exception::CodeOnnxLoadNotFormat, message.str());
+				}
+
+				// 入力の情報を取得
+				postscript << "Ort::Session::GetInputTypeInfo()";
+				char* inputName = session->Session->GetInputName(0, allocator);
+				session->Input.Name = inputName;
+				allocator.Free(inputName);
+
+				Ort::TypeInfo inputInfo = session->Session->GetInputTypeInfo(0);
+				Ort::Unowned<Ort::TensorTypeAndShapeInfo> inputTensor = inputInfo.GetTensorTypeAndShapeInfo();
+
+				session->InputType = inputTensor.GetElementType();
+				session->Input.Type = ConvertType(session->InputType);
+				session->Input.Shape = inputTensor.GetShape();
+				postscript.str("");
+
+				std::vector<int64_t>& shape = session->Input.Shape;
+
+				// 入力の形状と型を確認
+				if (shape.size() != 4 || (session->Input.Type != Tensor::TypeFloat && session->Input.Type != Tensor::TypeUint8))
+				{
+					message << "入力の形状または型が未対応:" << session->Input.Name;
+
+					// 例外を発砲
+					throw Exception::CObject(Exception::CodeOnnxLoadNotFormat, message.str());
+				}
+
+				// チャンネルの位置を判定 ⇒ 2番目がチャンネル数でなく、4番目がチャンネル数の場合だけNHWC
+				session->Planar = !((shape.at(1) != 1 && shape.at(1) != 3) && (shape.at(3) == 1 || shape.at(3) == 3));
+
+				int64_t& channels = session->Planar ? shape.at(1) : shape.at(3);
+				int64_t& height = session->Planar ? shape.at(2) : shape.at(1);
+				int64_t& width = session->Planar ? shape.at(3) : shape.at(2);
+
+				// 可変のサイズを設定で確定
+				height = (height <= 0) ? object.Height : height;
+				width = (width <= 0) ? object.Width : width;
+
+				// チャンネル数とサイズを確認
+				if ((channels != 1 && channels != 3) || height <= 0 || width <= 0)
+				{
+					message << "入力のチャンネル数またはサイズが未対応:" << channels << "x" << height << "x" << width;
+
+					// 例外を発砲
+					throw Exception::CObject(Exception::CodeOnnxLoadNotFormat, message.str());
+				}
+
+				session->Channels = (int)channels;
+				session->Height = (int)height;
+				session->Width = (int)width;
+
+				// 固定のバッチを確認 ⇒ 固定の場合はモデルに従う
+				session->Batch = (0 < shape.at(0)) ? (int)shape.at(0) : -1;
+				session->MaxBatch = (0 < session->Batch) ? session->Batch : std::max(1, object.MaxBatch);
+
+				// 出力だけ走査
+				postscript << "Ort::Session::GetOutputTypeInfo()";
+				for (size_t index = 0; index < session->Session->GetOutputCount(); index++)
+				{
+					Tensor::CObject output;
+
+					char* outputName = session->Session->GetOutputName(index, allocator);
+					output.Name = outputName;
+					allocator.Free(outputName);
+
+					Ort::TypeInfo outputInfo = session->Session->GetOutputTypeInfo(index);
+					Ort::Unowned<Ort::TensorTypeAndShapeInfo> outputTensor = outputInfo.GetTensorTypeAndShapeInfo();
+
+					output.Type = ConvertType(outputTensor.GetElementType());
+					output.Shape = outputTensor.GetShape();
 
-			m_session.release();
+					session->Outputs.push_back(output);
+				}
+				postscript.str("");
 
-			m_session = std::make_unique<Ort::Session>(m_env, Text::Convert(path).c_str(), Ort::SessionOptions{nullptr});
+				// 出力の名称を参照 ⇒ 読み込み後は変更しないため、名称のポインタは有効
+				for (auto& output : session->Outputs)
+				{
+					session->OutputNames.push_back(output.Name.c_str());
+				}
 
+				float load = stopWatch.Restart();
 
+				std::vector<float> elapsed;
+
+				// 推論を空打ち ⇒ 初回の推論の遅延初期化を入れ替え前に済ませる
+				postscript << "Onnx::Warmup()";
+				for (int count = 0; count < object.WarmupCount; count++)
+				{
+					Warmup(*session, 1);
+
+					if (1 < session->MaxBatch)
+					{
+						// 最大の画像数でも空打ち ⇒ バッチの形状ごとに確保するメモリを準備
+						Warmup(*session, session->MaxBatch);
+					}
+
+					elapsed.push_back(stopWatch.Restart());
+				}
+				postscript.str("");
+
+				uint64_t current = PrivateMemory();
+
+				session->Memory = (memory < current) ? current - memory : 0;
+				session->LoadTime = load + std::accumulate(elapsed.begin(), elapsed.end(), 0.0);
+
+				{
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_asyncOrt);
+
+					// モデルを入れ替え ⇒ 推論中のモデルは推論が終わると解放
+					m_session = session;
+
+					m_information.Path = path;
+					m_information.State = Information::StateLoaded;
+					m_information.Version++;
+					m_information.FileSize = session->FileSize;
+					m_information.Memory = session->Memory;
+					m_information.LoadTime = session->LoadTime;
+					m_information.Message = "";
+				}
+
+				// ログ出力
+				postscript << "モデル:" << path << Logging::ConstSeparator;
+				postscript << "読み込み:" << Text::Format(3, (double)load) << "[ms]" << Logging::ConstSeparator;
+				postscript << "メモリ:" << Text::Format(3, session->Memory / 1048576.0) << "[MB]";
+
+				if (elapsed.empty() == false)
+				{
+					postscript << Logging::ConstSeparator << "初回:" << Text::Format(3, (double)elapsed.front()) << "[ms]";
+				}
+
+				if (1 < elapsed.size())
+				{
+					double steady = std::accumulate(elapsed.begin() + 1, elapsed.end(), 0.0) / (elapsed.size() - 1);
+
+					postscript << Logging::ConstSeparator << "定常:" << Text::Format(3, steady) << "[ms]";
+				}
+
+				Transfer::Output(Logging::Join(logging, postscript.str()));
+				postscript.str("");
+			}
+			catch (const Exception::CObject& e)
+			{
+				// 排他制御
+				std::lock_guard<std::mutex> lock(m_asyncOrt);
+
+				m_information.State = Information::StateFailed;
+				m_information.Message = e.what();
+
+				// 例外を発砲
+				throw;
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理
+				std::stringstream message;
+
+				message << postscript.str() << Logging::ConstSeparator << e.what();
+
+				{
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_asyncOrt);
+
+					m_information.State = Information::StateFailed;
+					m_information.Message = message.str();
+				}
+
+				// 例外を発砲
+				throw Exception::CObject(Exception::CodeOnnxLoad, message.str());
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			入力の情報を取得
+		/// @return			入力の情報
+		////////////////////////////////////////////////////////////////////////////////
+		std::vector<Tensor::CObject> CWorker::GetInputs()
+		{
+			std::vector<Tensor::CObject> ret;
+
+			ret.push_back(GetSession()->Input);
+
+			return ret;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fT
-		/// @param[in]		摜̏ێNX
+		/// @brief			出力の情報を取得
+		/// @return			出力の情報
 		////////////////////////////////////////////////////////////////////////////////
-		void CWorker::Search(const cv::Mat& object)
+		std::vector<Tensor::CObject> CWorker::GetOutputs()
 		{
-			// r
-			std::unique_lock<std::mutex> lock(m_asyncOrt);
+			std::vector<Tensor::CObject> ret;
 
+			ret = GetSession()->Outputs;
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			モデルの情報を取得
+		/// @return			モデルの情報 ※読み込みに失敗した場合も、読み込み済みのモデルの情報を保持
+		////////////////////////////////////////////////////////////////////////////////
+		Information::CObject CWorker::GetInformation()
+		{
+			Information::CObject ret;
+
+			// 排他制御
+			std::lock_guard<std::mutex> lock(m_asyncOrt);
+
+			ret = m_information;
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			推論
+		/// @param[in]		object	画像
+		/// @return			出力ごとの推論の結果
+		////////////////////////////////////////////////////////////////////////////////
+		std::vector<Tensor::CObject> CWorker::Search(const cv::Mat& object)
+		{
+			std::vector<Tensor::CObject> ret;
+
+			std::vector<std::vector<Tensor::CObject>> results = Search(std::vector<cv::Mat>{ object });
+
+			ret = results.front();
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			複数の画像を推論
+		/// @detail			他のスレッドから要求された画像とまとめて推論する
+		///					推論中の数が上限未満なら要求したスレッドで推論し、それ以外は完了を待機する
+		/// @param[in]		objects	画像
+		/// @return			画像ごと・出力ごとの推論の結果
+		////////////////////////////////////////////////////////////////////////////////
+		std::vector<std::vector<Tensor::CObject>> CWorker::Search(const std::vector<cv::Mat>& objects)
+		{
+			std::vector<std::vector<Tensor::CObject>> ret;
+
+			std::shared_ptr<const CSession> session = GetSession();
+			std::vector<std::shared_ptr<CRequest>> requests;
+
+			{
+				// 排他制御
+				std::lock_guard<std::mutex> lock(m_asyncRequest);
+
+				m_preparing++;
+			}
+
+			try
+			{
+				// 画像だけ走査
+				for (auto& object : objects)
+				{
+					std::shared_ptr<CRequest> request = std::make_shared<CRequest>();
+
+					// 前処理 ⇒ 要求したスレッドで並列に行う
+					request->Session = session;
+					request->Input = Preprocess(*session, object);
+
+					requests.push_back(request);
+				}
+			}
+			catch (...)
+			{
+				// 排他制御
+				std::lock_guard<std::mutex> lock(m_asyncRequest);
+
+				m_preparing--;
+				m_conditionRequest.notify_all();
+
+				// 例外を発砲
+				throw;
+			}
+
+			// 排他制御
+			std::unique_lock<std::mutex> lock(m_asyncRequest);
+
+			m_preparing--;
+
+			// 推論の要求を追加
+			m_requests.insert(m_requests.end(), requests.begin(), requests.end());
+			m_conditionRequest.notify_all();
+
+			// 全ての要求の完了を待機
+			while (std::any_of(requests.begin(), requests.end(), [](const std::shared_ptr<CRequest>& request) { return request->Done == false; }))
+			{
+				// 推論中の数を確認
+				if (m_requests.empty() == false && m_running < std::max(1, m_requests.front()->Session->Setting.Concurrency))
+				{
+					// まとめて推論
+					Dispatch(lock);
+				}
+				else
+				{
+					// 他のスレッドの推論を待機
+					m_conditionRequest.wait(lock);
+				}
+			}
+
+			lock.unlock();
+
+			// 要求だけ走査
+			for (auto& request : requests)
+			{
+				// 例外を確認
+				if (request->Exception != nullptr)
+				{
+					// 例外を発砲
+					std::rethrow_exception(request->Exception);
+				}
+
+				ret.push_back(std::move(request->Output));
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			読み込んだモデルを取得
+		/// @return			読み込んだモデル
+		////////////////////////////////////////////////////////////////////////////////
+		std::shared_ptr<const CSession> CWorker::GetSession()
+		{
+			std::shared_ptr<const CSession> ret;
+
+			// 排他制御
+			std::lock_guard<std::mutex> lock(m_asyncOrt);
+
+			// モデルを確認
 			if (m_session == nullptr)
 			{
-				throw std::exception("Not loaded");
+				// 例外を発砲
+				throw Exception::CObject(Exception::CodeOnnxUnloaded, "モデル未読み込み");
 			}
 
-			const char* input_names[] = { "Input3" };
-			const char* output_names[] = { "Plus214_Output_0" };
+			ret = m_session;
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			前処理
+		/// @detail			チャンネル数・サイズをモデルに合わせて、正規化しながらモデルの並び(NCHW/NHWC)へ変換する
+		///					入力がuint8のモデルは正規化しない
+		/// @param[in]		session	読み込んだモデル
+		/// @param[in]		object	画像
+		/// @return			前処理した画像(1枚分の連続したデータ)
+		////////////////////////////////////////////////////////////////////////////////
+		cv::Mat CWorker::Preprocess(const CSession& session, const cv::Mat& object)
+		{
+			cv::Mat ret;
+
+			std::stringstream message;
+
+			// 画像を確認
+			if (object.empty() || (object.channels() != 1 && object.channels() != 3 && object.channels() != 4))
+			{
+				message << "画像が空またはチャンネル数が未対応:" << object.channels();
+
+				// 例外を発砲
+				throw Exception::CObject(Exception::CodeOnnxSearchImage, message.str());
+			}
+
+			// 呼び出し元の画素を参照 ※プールした画像を共有している場合があるため、変換は別の領域へ出力する
+			cv::Mat image = object;
+			int code = -1;
+
+			// チャンネル数をモデルに合わせる
+			if (session.Channels == 1)
+			{
+				if (image.channels() == 3)
+				{
+					code = cv::COLOR_BGR2GRAY;
+				}
+				else if (image.channels() == 4)
+				{
+					code = cv::COLOR_BGRA2GRAY;
+				}
+			}
+			else
+			{
+				if (image.channels() == 1)
+				{
+					code = cv::COLOR_GRAY2BGR;
+				}
+				else if (image.channels() == 4)
+				{
+					code = session.Setting.SwapRB ? cv::COLOR_BGRA2RGB : cv::COLOR_BGRA2BGR;
+				}
+				else if (session.Setting.SwapRB)
+				{
+					code = cv::COLOR_BGR2RGB;
+				}
+			}
+
+			if (0 <= code)
+			{
+				cv::Mat converted;
+
+				// 別の領域へ変換 ⇒ 同じサイズ・型でも呼び出し元の画素は書き換えない
+				cv::cvtColor(object, converted, code);
+				image = converted;
+			}
+
+			// サイズをモデルに合わせる
+			if (image.cols != session.Width || image.rows != session.Height)
+			{
+				cv::Mat resized;
+
+				cv::resize(image, resized, cv::Size(session.Width, session.Height), 0, 0, cv::INTER_LINEAR);
+				image = resized;
+			}
 
-			m_session->Run(Ort::RunOptions{ nullptr }, input_names, &m_input_tensor, 1, output_names, &m_output_tensor, 1);
+			bool normalize = (session.Input.Type == Tensor::TypeFloat);
+			int depth = normalize ? CV_32F : CV_8U;
+			int size = session.Height * session.Width;
 
-			int64_t result = std::distance(m_results.begin(), std::max_element(m_results.begin(), m_results.end()));
+			ret.create(1, size * session.Channels, depth);
+
+			// 並びを確認
+			if (session.Planar)
+			{
+				std::vector<cv::Mat> planes;
+
+				// HWC ⇒ CHW
+				cv::split(image, planes);
+
+				// チャンネルだけ走査
+				for (int channel = 0; channel < session.Channels; channel++)
+				{
+					double deviation = ChannelValue(session.Setting.Deviation, channel, 1.0);
+					double alpha = normalize ? session.Setting.Scale / deviation : 1.0;
+					double beta = normalize ? -ChannelValue(session.Setting.Mean, channel, 0.0) / deviation : 0.0;
+
+					// 出力先を直接参照 ⇒ 正規化と並び替えをまとめて行う
+					cv::Mat plane(session.Height, session.Width, depth, ret.ptr() + ret.elemSize() * size * channel);
+
+					planes.at(channel).convertTo(plane, depth, alpha, beta);
+				}
+			}
+			else
+			{
+				cv::Mat interleave(session.Height, session.Width, CV_MAKETYPE(depth, session.Channels), ret.ptr());
+
+				if (normalize)
+				{
+					cv::Scalar mean;
+					cv::Scalar deviation;
+
+					// チャンネルだけ走査
+					for (int channel = 0; channel < session.Channels; channel++)
+					{
+						mean[channel] = ChannelValue(session.Setting.Mean, channel, 0.0);
+						deviation[channel] = ChannelValue(session.Setting.Deviation, channel, 1.0);
+					}
+
+					image.convertTo(interleave, depth, session.Setting.Scale);
+					cv::subtract(interleave, mean, interleave);
+					cv::divide(interleave, deviation, interleave);
+				}
+				else
+				{
+					image.convertTo(interleave, depth);
+				}
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			推論を空打ち
+		/// @param[in]		session	読み込んだモデル
+		/// @param[in]		batch	画像数 ※固定のバッチの場合はモデルに従う
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::Warmup(const CSession& session, int batch)
+		{
+			std::vector<int64_t> shape = session.Input.Shape;
+
+			shape.at(0) = (0 < session.Batch) ? session.Batch : batch;
+
+			size_t length = (session.Input.Type == Tensor::TypeFloat) ? sizeof(float) : sizeof(uint8_t);
+
+			// 画像数だけ確保 ⇒ 値はゼロ
+			std::vector<unsigned char> buffer(length * session.Channels * session.Height * session.Width * shape.at(0), 0);
+
+			Ort::MemoryInfo memoryInfo = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+			Ort::Value input = Ort::Value::CreateTensor(memoryInfo, buffer.data(), buffer.size(), shape.data(), shape.size(), session.InputType);
+
+			const char* inputName = session.Input.Name.c_str();
+
+			// 推論
+			session.Session->Run(Ort::RunOptions{ nullptr }, &inputName, &input, 1, session.OutputNames.data(), session.OutputNames.size());
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			まとめて推論
+		/// @detail			前処理中の要求元がある場合だけ、最大の画像数まで他の画像を待つ
+		///					推論中は排他制御を解除して、他のスレッドの要求を受け付ける
+		/// @param[in]		lock	排他制御(推論の要求)のロック
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::Dispatch(std::unique_lock<std::mutex>& lock)
+		{
+			std::shared_ptr<const CSession> session = m_requests.front()->Session;
+			std::vector<std::shared_ptr<CRequest>> requests;
+
+			m_running++;
+
+			std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(session->Setting.BatchTimeout);
+
+			// 他の画像を待機 ⇒ 最大の画像数がそろうか、前処理中の要求元がなくなるまで
+			m_conditionRequest.wait_until(lock, deadline, [this, &session] { return (int)m_requests.size() >= session->MaxBatch || m_preparing == 0; });
+
+			// 同じモデルの要求だけ先頭から取得
+			while (m_requests.empty() == false && (int)requests.size() < session->MaxBatch && m_requests.front()->Session == session)
+			{
+				requests.push_back(m_requests.front());
+				m_requests.pop_front();
+			}
+
+			lock.unlock();
+
+			try
+			{
+				if (requests.empty() == false)
+				{
+					// 推論を実行
+					Run(*session, requests);
+				}
+			}
+			catch (...)
+			{
+				std::exception_ptr exception = std::current_exception();
+
+				// 要求だけ走査
+				for (auto& request : requests)
+				{
+					request->Exception = exception;
+				}
+			}
+
+			lock.lock();
+
+			// 要求だけ走査
+			for (auto& request : requests)
+			{
+				request->Done = true;
+			}
+
+			m_running--;
+			m_conditionRequest.notify_all();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			推論を実行
+		/// @detail			要求をバッチにまとめて推論し、結果を要求ごとに分ける
+		///					固定のバッチに足りない分はゼロで埋める
+		/// @param[in]		session	読み込んだモデル
+		/// @param[in]		requests	推論の要求
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::Run(const CSession& session, const std::vector<std::shared_ptr<CRequest>>& requests)
+		{
+			std::stringstream postscript;
+
+			try
+			{
+				int count = (int)requests.size();
+				int batch = (0 < session.Batch) ? session.Batch : count;
+				size_t length = requests.front()->Input.total() * requests.front()->Input.elemSize();
+
+				std::vector<unsigned char> buffer(length * batch, 0);
+
+				// 要求だけ走査 ⇒ バッチにまとめる
+				for (int index = 0; index < count; index++)
+				{
+					::memcpy(buffer.data() + length * index, requests.at(index)->Input.ptr(), length);
+				}
+
+				std::vector<int64_t> shape = session.Input.Shape;
+
+				shape.at(0) = batch;
+
+				Ort::MemoryInfo memoryInfo = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+				Ort::Value input = Ort::Value::CreateTensor(memoryInfo, buffer.data(), buffer.size(), shape.data(), shape.size(), session.InputType);
+
+				const char* inputName = session.Input.Name.c_str();
+
+				// 推論 ⇒ 推論のライブラリはスレッドセーフのため、排他制御しない
+				postscript << "Ort::Session::Run():" << batch;
+				std::vector<Ort::Value> outputs = session.Session->Run(Ort::RunOptions{ nullptr }, &inputName, &input, 1, session.OutputNames.data(), session.OutputNames.size());
+				postscript.str("");
+
+				// 要求ごとの結果を準備
+				for (auto& request : requests)
+				{
+					request->Output.resize(outputs.size());
+				}
+
+				// 出力だけ走査
+				for (size_t index = 0; index < outputs.size(); index++)
+				{
+					Ort::TensorTypeAndShapeInfo information = outputs.at(index).GetTensorTypeAndShapeInfo();
+					std::vector<int64_t> result = information.GetShape();
+					size_t total = information.GetElementCount();
+
+					// バッチの有無を判定 ⇒ バッチがない出力は全ての要求へ同じ値を返す
+					bool batched = (result.empty() == false && result.front() == batch);
+					size_t element = batched ? total / batch : total;
+
+					if (batched)
+					{
+						result.erase(result.begin());
+					}
+
+					// 要求だけ走査
+					for (int position = 0; position < count; position++)
+					{
+						Tensor::CObject& output = requests.at(position)->Output.at(index);
+						size_t offset = batched ? element * position : 0;
+
+						output.Name = session.Outputs.at(index).Name;
+						output.Type = ConvertType(information.GetElementType());
+						output.Shape = result;
+
+						switch (information.GetElementType())
+						{
+						case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
+							CopyValue<float>(outputs.at(index), offset, element, output.Value);
+							break;
+						case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8:
+							CopyValue<uint8_t>(outputs.at(index), offset, element, output.Value);
+							break;
+						case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
+							CopyValue<int32_t>(outputs.at(index), offset, element, output.Value);
+							break;
+						case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
+							CopyValue<int64_t>(outputs.at(index), offset, element, output.Value);
+							break;
+						default:
+							// 未対応の型 ⇒ 値は返さない
+							output.Value.clear();
+							break;
+						}
+					}
+				}
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理
+				std::stringstream message;
+
+				message << postscript.str() << Logging::ConstSeparator << e.what();
+
+				// 例外を発砲
+				throw Exception::CObject(Exception::CodeOnnxSearch, message.str());
+			}
 		}
 	}
 }
\ No newline at end of file
@@ -1,65 +1,182 @@
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 #include <onnxruntime_cxx_api.h>
 
 #include "opencv2/opencv.hpp"
 
+#include "Common/Onnx/Information.h"
+#include "Common/Onnx/Setting.h"
+#include "Common/Onnx/Tensor.h"
+
 #pragma comment(lib,"onnxruntime.lib")
 
 namespace Standard
 {
 	namespace Onnx
 	{
-		//! 摜̕
-		static constexpr const int ConstImageWidth = 28;
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CSession
+		/// @brief      読み込んだモデルを保持するクラス
+		/// @detail		入出力の情報はモデルから取得して、読み込み後は変更しない
+		///				推論中にモデルを読み込み直しても、推論中のモデルは参照が残る間は有効
+		////////////////////////////////////////////////////////////////////////////////
+		class CSession
+		{
+		public:
+			//! モデル
+			std::unique_ptr<Ort::Session> Session;
+
+			//! モデルの設定
+			Setting::CModel Setting;
+
+			//! 入力の情報 ※形状のバッチは-1(可変)または固定の値
+			Tensor::CObject Input;
+
+			//! 入力の要素の型
+			ONNXTensorElementDataType InputType;
+
+			//! 出力の情報
+			std::vector<Tensor::CObject> Outputs;
+
+			//! 出力の名称 ※Outputsの名称を参照
+			std::vector<const char*> OutputNames;
+
+			//! 入力がNCHWか(false:NHWC)
+			bool Planar;
+
+			//! 入力のチャンネル数
+			int Channels;
+
+			//! 入力の高さ
+			int Height;
+
+			//! 入力の幅
+			int Width;
+
+			//! 固定のバッチ(-1:可変)
+			int Batch;
+
+			//! まとめて推論する最大の画像数
+			int MaxBatch;
+
+			//! モデルのファイルのサイズ[byte]
+			uint64_t FileSize;
+
+			//! 読み込みで増えたメモリ[byte]
+			uint64_t Memory;
+
+			//! 読み込み時間[ms] ※空打ちを含む
+			double LoadTime;
+		};
 
-		//! 摜̍
-		static constexpr const int ConstImageHeight = 28;
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CRequest
+		/// @brief      推論の要求を保持するクラス
+		////////////////////////////////////////////////////////////////////////////////
+		class CRequest
+		{
+		public:
+			//! 推論するモデル
+			std::shared_ptr<const CSession> Session;
+
+			//! 前処理した画像 ※1枚分の連続したデータ
+			cv::Mat Input;
+
+			//! 推論の結果
+			std::vector<Tensor::CObject> Output;
+
+			//! 推論の例外
+			std::exception_ptr Exception;
 
+			//! 推論が完了したか
+			bool Done = false;
+		};
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CWorker
+		/// @brief      推論を行うクラス
+		/// @detail		複数のスレッドから同時に要求された画像をまとめて1回で推論する
+		///				前処理は要求したスレッドで行い、推論中はモデルを排他制御しない
+		////////////////////////////////////////////////////////////////////////////////
 		class CWorker
 		{
 		public:
-			// RXgN^
+			// コンストラクタ
 			CWorker();
 
-			// fXgN^
+			// デストラクタ
 			~CWorker();
 
-			// fǂݍ
-			void LoadModel(const std::string& path);
+			// モデル読み込み
+			void LoadModel(const Setting::CModel& object) throw(...);
+
+			// 入力の情報を取得
+			std::vector<Tensor::CObject> GetInputs() throw(...);
+
+			// 出力の情報を取得
+			std::vector<Tensor::CObject> GetOutputs() throw(...);
 
-			// fT
-			void Search(const cv::Mat& object);
+			// モデルの情報を取得
+			Information::CObject GetInformation();
+
+			// 推論
+			std::vector<Tensor::CObject> Search(const cv::Mat& object) throw(...);
+
+			// 複数の画像を推論
+			std::vector<std::vector<Tensor::CObject>> Search(const std::vector<cv::Mat>& objects) throw(...);
 
 		private:
-			//! 
+			// 読み込んだモデルを取得
+			std::shared_ptr<const CSession> GetSession() throw(...);
+
+			// 前処理
+			cv::Mat Preprocess(const CSession& session, const cv::Mat& object) throw(...);
+
+			// 推論を空打ち
+			void Warmup(const CSession& session, int batch) throw(...);
+
+			// まとめて推論
+			void Dispatch(std::unique_lock<std::mutex>& lock);
+
+			// 推論を実行
+			void Run(const CSession& session, const std::vector<std::shared_ptr<CRequest>>& requests) throw(...);
+
+		private:
+			//! 推論の環境
 			Ort::Env m_env;
 
-			//! rNX(???p)
+			//! 排他制御(読み込み) ⇒ 同じモデルの読み込みだけ1つずつ行う
+			std::mutex m_asyncLoad;
+
+			//! 排他制御(モデル)
 			std::mutex m_asyncOrt;
 
-			//!
-			std::unique_ptr<Ort::Session> m_session{ nullptr };
+			//! 読み込んだモデル
+			std::shared_ptr<const CSession> m_session;
 
-			//!
-			Ort::Value m_input_tensor{ nullptr };
+			//! モデルの情報
+			Information::CObject m_information;
 
-			//!
-			std::array<int64_t, 4> m_input_shape{};
+			//! 排他制御(推論の要求)
+			std::mutex m_asyncRequest;
 
-			//!
-			std::array<float, ConstImageWidth * ConstImageHeight> m_input_image{};
+			//! 推論の要求を通知
+			std::condition_variable m_conditionRequest;
 
-			//!
-			Ort::Value m_output_tensor{ nullptr };
+			//! 推論の要求
+			std::deque<std::shared_ptr<CRequest>> m_requests;
 
-			//!
-			std::array<int64_t, 2> m_output_shape{};
+			//! 前処理中の要求元の数 ⇒ 0の場合は他の画像を待たない
+			int m_preparing;
 
-			//!
-			std::array<float, 10> m_results{};
+			//! 推論中の数
+			int m_running;
 		};
 	}
 }
\ No newline at end of file
@@ -0,0 +1,670 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+
+#include "Common/Pipeline/Statistics.h"
+#include "Common/Utility/RingQueue.h"
+#include "Common/Utility/StopWatch.h"
+#include "Thread/Worker.h"
+
+namespace Standard
+{
+	namespace Pipeline
+	{
+		namespace Stage
+		{
+			//! 次の段の空きを待つタイムアウト[ms] ※∞ ⇒ 次の段が入力を取り出した時と停止要求で起床
+			const int ConstBlocked = -1;
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @enum			次の段が上限に達した場合の動作
+			////////////////////////////////////////////////////////////////////////////////
+			enum EnumBackpressure
+			{
+				BackpressureBlock,	// 空きが出るまで待機 ⇒ 前の段も順に待機する
+				BackpressureDrop	// 破棄
+			};
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CCounter
+			/// @brief      段ごとの処理の統計を集計するクラス
+			////////////////////////////////////////////////////////////////////////////////
+			class CCounter
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CCounter()
+				{
+					// 初期化
+					Reset();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				~CCounter()
+				{
+
+				}
+
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			初期化
+				////////////////////////////////////////////////////////////////////////////////
+				void Reset()
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncCounter);
+
+					m_processed = 0;
+					m_dropped = 0;
+					m_blocked = 0;
+					m_errors = 0;
+					m_total = 0;
+					m_maximum = 0;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			処理した時間を追加
+				/// @param[in]		elapsed	処理時間[ms]
+				////////////////////////////////////////////////////////////////////////////////
+				void Record(float elapsed)
+				{
+					std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncCounter);
+
+					// 最初の処理を確認
+					if (m_processed == 0)
+					{
+						m_first = now;
+					}
+
+					m_last = now;
+					m_processed += 1;
+					m_total += elapsed;
+					m_maximum = (std::max)(m_maximum, (double)elapsed);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			次の段が上限で破棄した数を追加
+				////////////////////////////////////////////////////////////////////////////////
+				void Drop()
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncCounter);
+
+					m_dropped += 1;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			空きを待った数を追加
+				////////////////////////////////////////////////////////////////////////////////
+				void Block()
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncCounter);
+
+					m_blocked += 1;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			例外で破棄した数を追加
+				////////////////////////////////////////////////////////////////////////////////
+				void Error()
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncCounter);
+
+					m_errors += 1;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			統計を取得
+				/// @param[out]		object	統計のクラス ※待ち行列の情報は更新しない
+				////////////////////////////////////////////////////////////////////////////////
+				void Get(Statistics::CObject& object)
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncCounter);
+
+					object.Processed = m_processed;
+					object.Dropped = m_dropped;
+					object.Blocked = m_blocked;
+					object.Errors = m_errors;
+					object.Average = (0 < m_processed) ? m_total / m_processed : 0;
+					object.Maximum = m_maximum;
+					object.Throughput = 0;
+
+					// 2件以上の処理を確認 ⇒ 最初から最後の処理までの間隔で速度を計算
+					if (1 < m_processed)
+					{
+						double second = std::chrono::duration_cast<std::chrono::duration<double>>(m_last - m_first).count();
+
+						if (0 < second)
+						{
+							object.Throughput = (m_processed - 1) / second;
+						}
+					}
+				}
+
+			private:
+				//! 排他制御クラス(統計用)
+				std::recursive_mutex m_asyncCounter;
+
+				//! 処理した数
+				uint64_t m_processed;
+
+				//! 破棄した数
+				uint64_t m_dropped;
+
+				//! 空きを待った数
+				uint64_t m_blocked;
+
+				//! 例外で破棄した数
+				uint64_t m_errors;
+
+				//! 処理時間の合計[ms]
+				double m_total;
+
+				//! 最大の処理時間[ms]
+				double m_maximum;
+
+				//! 最初に処理した時刻
+				std::chrono::steady_clock::time_point m_first;
+
+				//! 最後に処理した時刻
+				std::chrono::steady_clock::time_point m_last;
+			};
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      COutlet
+			/// @brief      次の段へ出力するテンプレートのクラス
+			///				⇒ スレッドの制御を行うテンプレートのクラスから派生
+			/// @detail		次の段が上限の場合は、空きが出るまで出力を保持して次の入力を処理しない
+			///				空きは次の段が入力を取り出した時の起床で確認する ⇒ 空きの確認でポーリングしない
+			/// @param[in]	COutput	出力のクラス(テンプレートで指定)
+			////////////////////////////////////////////////////////////////////////////////
+			template <typename COutput>
+			class COutlet
+				: virtual public Thread::Worker::CTemplate
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				COutlet() : Thread::Worker::CTemplate()
+				{
+					_FunctionOutput = nullptr;
+					m_backpressure = BackpressureBlock;
+					m_pending = false;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				virtual ~COutlet()
+				{
+
+				}
+
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			次の段へ出力する関数の登録
+				/// @detail			開始する前に呼び出す
+				/// @param[in]		object	出力する関数 ※戻り値はfalse:次の段が上限
+				////////////////////////////////////////////////////////////////////////////////
+				void AttachFunctionOutput(std::function<bool(const COutput&)> object)
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncFunctionOutput);
+
+					_FunctionOutput = object;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			次の段が上限に達した場合の動作を更新
+				/// @param[in]		value	次の段が上限に達した場合の動作
+				////////////////////////////////////////////////////////////////////////////////
+				void SetBackpressure(EnumBackpressure value)
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncFunctionOutput);
+
+					m_backpressure = value;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			統計を取得
+				/// @return			統計のクラス
+				////////////////////////////////////////////////////////////////////////////////
+				virtual Statistics::CObject GetStatistics()
+				{
+					Statistics::CObject ret;
+
+					ret.Name = GetName();
+
+					m_counter.Get(ret);
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			統計を初期化
+				////////////////////////////////////////////////////////////////////////////////
+				void ResetStatistics()
+				{
+					m_counter.Reset();
+				}
+
+			protected:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			保持している出力を次の段へ出力
+				/// @return			true:保持なし / false:次の段が上限のため保持を継続
+				////////////////////////////////////////////////////////////////////////////////
+				bool Flush()
+				{
+					bool ret = true;
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncFunctionOutput);
+
+					// 保持を確認
+					if (m_pending)
+					{
+						// 次の段へ出力
+						if (_FunctionOutput == nullptr || _FunctionOutput(m_output))
+						{
+							m_pending = false;
+						}
+						else
+						{
+							ret = false;
+						}
+					}
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			次の段へ出力
+				/// @param[in]		object	出力 ※次の段が上限で待機する場合は保持するため移動する
+				/// @return			true:出力または破棄 / false:次の段が上限のため保持
+				////////////////////////////////////////////////////////////////////////////////
+				bool Forward(COutput& object)
+				{
+					bool ret = true;
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncFunctionOutput);
+
+					// 次の段へ出力
+					if (_FunctionOutput != nullptr && _FunctionOutput(object) == false)
+					{
+						// 次の段が上限 ⇒ 上限に達した場合の動作を確認
+						if (m_backpressure == BackpressureBlock)
+						{
+							// 空きが出るまで保持
+							m_output = std::move(object);
+							m_pending = true;
+							m_counter.Block();
+							ret = false;
+						}
+						else
+						{
+							// 破棄
+							m_counter.Drop();
+						}
+					}
+
+					return ret;
+				}
+
+			protected:
+				//! 統計
+				CCounter m_counter;
+
+			private:
+				//! 排他制御クラス(次の段へ出力する関数用)
+				std::recursive_mutex m_asyncFunctionOutput;
+
+				//! 次の段へ出力する関数
+				std::function<bool(const COutput&)> _FunctionOutput;
+
+				//! 次の段が上限に達した場合の動作
+				EnumBackpressure m_backpressure;
+
+				//! 次の段の空きを待っている出力を保持しているか
+				bool m_pending;
+
+				//! 次の段の空きを待っている出力
+				COutput m_output;
+			};
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CTemplate
+			/// @brief      入力を処理して次の段へ出力するテンプレートのクラス
+			///				⇒ 次の段へ出力するテンプレートのクラスから派生
+			/// @detail		入力は容量が固定の待ち行列で受け取り、専用のスレッドで処理する
+			///				入力は単一の前の段から追加して、自クラスのスレッドのみで取り出す
+			/// @param[in]	CInput	入力のクラス(テンプレートで指定)
+			/// @param[in]	COutput	出力のクラス(テンプレートで指定)
+			////////////////////////////////////////////////////////////////////////////////
+			template <typename CInput, typename COutput>
+			class CTemplate
+				: public COutlet<COutput>
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				/// @param[in]		capacity	入力の待ち行列の容量
+				////////////////////////////////////////////////////////////////////////////////
+				CTemplate(size_t capacity) : Thread::Worker::CTemplate(), COutlet<COutput>(), m_queue(capacity)
+				{
+					_FunctionProcess = nullptr;
+					m_upstream = nullptr;
+
+					// 名称を更新
+					this->SetName("Pipeline::Stage::");
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				virtual ~CTemplate()
+				{
+					// 停止
+					this->Stop();
+				}
+
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			入力を処理する関数の登録
+				/// @detail			開始する前に呼び出す
+				/// @param[in]		object	処理する関数 ※戻り値はfalse:出力なし
+				////////////////////////////////////////////////////////////////////////////////
+				void AttachFunctionProcess(std::function<bool(const CInput&, COutput&)> object)
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncFunctionProcess);
+
+					_FunctionProcess = object;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			前の段を更新
+				/// @detail			開始する前に呼び出す
+				///					入力を取り出すたびに起床して、空きを待っている前の段を再開させる
+				///					※前の段が空きを待つ(BackpressureBlock)場合は必ず更新する ⇒ 更新しないと前の段が再開しない
+				/// @param[in]		object	前の段
+				////////////////////////////////////////////////////////////////////////////////
+				void SetUpstream(Thread::Worker::CTemplate* object)
+				{
+					m_upstream = object;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			入力を追加
+				/// @detail			前の段のスレッドから呼び出す
+				/// @param[in]		object	入力
+				/// @return			true:追加 / false:待ち行列が上限
+				////////////////////////////////////////////////////////////////////////////////
+				bool Push(const CInput& object)
+				{
+					bool ret = false;
+
+					ret = m_queue.Push(object);
+
+					if (ret)
+					{
+						// 動作要求を起床
+						this->WakeupRequestAction();
+					}
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			統計を取得
+				/// @return			統計のクラス
+				////////////////////////////////////////////////////////////////////////////////
+				Statistics::CObject GetStatistics() override
+				{
+					Statistics::CObject ret = COutlet<COutput>::GetStatistics();
+
+					ret.Rejected = m_queue.GetRejected();
+					ret.Depth = m_queue.GetDepth();
+					ret.HighWatermark = m_queue.GetHighWatermark();
+					ret.Capacity = m_queue.GetCapacity();
+
+					return ret;
+				}
+
+			protected:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			メイン関数の処理
+				///	@detail			★継承した関数
+				///					待ち行列が空になるか、次の段が上限になるまで処理する
+				/// @return			タイムアウト時間[ms]
+				////////////////////////////////////////////////////////////////////////////////
+				int MainAction() override
+				{
+					int ret = this->GetCycle();
+
+					Logging::CObject logging;
+					std::stringstream postscript;
+
+					logging.Message << this->GetName() << "MainAction()" << Logging::ConstSeparator;
+
+					do
+					{
+						// 保持している出力を確認
+						if (this->Flush() == false)
+						{
+							// 次の段が上限 ⇒ 入力を取り出さずに、次の段が取り出した時の起床を待機
+							ret = ConstBlocked;
+							break;
+						}
+
+						// 排他制御
+						std::lock_guard<std::recursive_mutex> lock(m_asyncFunctionProcess);
+
+						CInput input;
+
+						// 入力だけ処理
+						while (m_queue.Pop(input))
+						{
+							// 前の段を起床 ⇒ 空きを待っている場合は再開
+							if (m_upstream != nullptr)
+							{
+								m_upstream->WakeupRequestAction();
+							}
+
+							COutput output;
+							bool produced = false;
+
+							Utility::CStopWatch stopWatch;
+
+							try
+							{
+								// 処理
+								produced = (_FunctionProcess != nullptr) && _FunctionProcess(input, output);
+							}
+							catch (const std::exception& e)
+							{
+								// 例外の処理 ⇒ 入力を破棄して次の入力を処理
+								Transfer::Output(Exception::Convert::Logging(logging, postscript.str(), e));
+								this->m_counter.Error();
+								continue;
+							}
+
+							this->m_counter.Record(stopWatch.Stop());
+
+							// 次の段へ出力
+							if (produced && this->Forward(output) == false)
+							{
+								// 次の段が上限 ⇒ 残りの入力は次の段が取り出した時の起床を待って処理
+								ret = ConstBlocked;
+								break;
+							}
+						}
+					} while (false);
+
+					return ret;
+				}
+
+			private:
+				//! 入力の待ち行列
+				Utility::CRingQueue<CInput> m_queue;
+
+				//! 排他制御クラス(入力を処理する関数用)
+				std::recursive_mutex m_asyncFunctionProcess;
+
+				//! 入力を処理する関数
+				std::function<bool(const CInput&, COutput&)> _FunctionProcess;
+
+				//! 前の段
+				Thread::Worker::CTemplate* m_upstream;
+			};
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CSource
+			/// @brief      取り込んで次の段へ出力するテンプレートのクラス
+			///				⇒ 次の段へ出力するテンプレートのクラスから派生
+			/// @detail		取り込む関数を専用のスレッドで呼び出し続ける
+			///				次の段が上限の場合は、取り込みを止めないように既定で破棄する
+			/// @param[in]	COutput	出力のクラス(テンプレートで指定)
+			////////////////////////////////////////////////////////////////////////////////
+			template <typename COutput>
+			class CSource
+				: public COutlet<COutput>
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CSource() : Thread::Worker::CTemplate(), COutlet<COutput>()
+				{
+					_FunctionCapture = nullptr;
+
+					// 名称を更新
+					this->SetName("Pipeline::Source::");
+
+					// 次の段が上限の場合は破棄
+					this->SetBackpressure(BackpressureDrop);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				virtual ~CSource()
+				{
+					// 停止
+					this->Stop();
+				}
+
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			取り込む関数の登録
+				/// @detail			開始する前に呼び出す
+				/// @param[in]		object	取り込む関数 ※戻り値はfalse:取り込みなし ⇒ 周期で待機して取り込み直す
+				////////////////////////////////////////////////////////////////////////////////
+				void AttachFunctionCapture(std::function<bool(COutput&)> object)
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncFunctionCapture);
+
+					_FunctionCapture = object;
+				}
+
+			protected:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			メイン関数の処理
+				///	@detail			★継承した関数
+				/// @return			タイムアウト時間[ms]
+				////////////////////////////////////////////////////////////////////////////////
+				int MainAction() override
+				{
+					int ret = 0;
+
+					Logging::CObject logging;
+					std::stringstream postscript;
+
+					logging.Message << this->GetName() << "MainAction()" << Logging::ConstSeparator;
+
+					do
+					{
+						// 保持している出力を確認
+						if (this->Flush() == false)
+						{
+							// 次の段が上限 ⇒ 取り込まずに、次の段が取り出した時の起床を待機
+							ret = ConstBlocked;
+							break;
+						}
+
+						// 排他制御
+						std::lock_guard<std::recursive_mutex> lock(m_asyncFunctionCapture);
+
+						// 取り込む関数を確認
+						if (_FunctionCapture == nullptr)
+						{
+							// 関数なし ⇒ 周期で待機
+							ret = this->GetCycle();
+							break;
+						}
+
+						COutput output;
+						bool captured = false;
+
+						Utility::CStopWatch stopWatch;
+
+						try
+						{
+							// 取り込み
+							captured = _FunctionCapture(output);
+						}
+						catch (const std::exception& e)
+						{
+							// 例外の処理 ⇒ 周期で待機して取り込み直す
+							Transfer::Output(Exception::Convert::Logging(logging, postscript.str(), e));
+							this->m_counter.Error();
+							ret = this->GetCycle();
+							break;
+						}
+
+						// 取り込みを確認
+						if (captured == false)
+						{
+							// 取り込みなし ⇒ 周期で待機して取り込み直す
+							ret = this->GetCycle();
+							break;
+						}
+
+						this->m_counter.Record(stopWatch.Stop());
+
+						// 次の段へ出力
+						if (this->Forward(output) == false)
+						{
+							// 次の段が上限 ⇒ 次の段が取り出した時の起床を待機
+							ret = ConstBlocked;
+						}
+					} while (false);
+
+					return ret;
+				}
+
+			private:
+				//! 排他制御クラス(取り込む関数用)
+				std::recursive_mutex m_asyncFunctionCapture;
+
+				//! 取り込む関数
+				std::function<bool(COutput&)> _FunctionCapture;
+			};
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <vector>
+
+#include "Common/Pipeline/Statistics.h"
+#include "Notice/Worker.h"
+#include "Pipeline/Stage.h"
+
+namespace Standard
+{
+	namespace Pipeline
+	{
+		namespace Worker
+		{
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CTemplate
+			/// @brief      取り込み→前処理→推論→通知を段ごとのスレッドで並列に行うテンプレートのクラス
+			/// @detail		段の間は容量が固定の待ち行列でつなぎ、処理の速度は最も遅い段に律速する
+			///				前処理と推論は次の段が上限の場合に待機し、待機は前の段へ順に伝わる
+			///				取り込みは取り込みを止めないように、前処理が上限の場合は破棄する
+			/// @param[in]	CCapture	取り込んだ情報のクラス(テンプレートで指定)
+			/// @param[in]	CPrepared	前処理した情報のクラス(テンプレートで指定)
+			/// @param[in]	CResult	推論の結果のクラス(テンプレートで指定)
+			////////////////////////////////////////////////////////////////////////////////
+			template <typename CCapture, typename CPrepared, typename CResult>
+			class CTemplate
+			{
+			public:
+				//! 推論の結果を受信する関数の定義
+				typedef void(OnResult)(const CResult&);
+
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				/// @param[in]		capacity	段の間の待ち行列の容量
+				////////////////////////////////////////////////////////////////////////////////
+				CTemplate(size_t capacity = 4) : m_preprocess(capacity), m_infer(capacity)
+				{
+					// 名称を更新
+					m_capture.SetName("Pipeline::Capture::");
+					m_preprocess.SetName("Pipeline::Preprocess::");
+					m_infer.SetName("Pipeline::Infer::");
+					m_noticeResult.SetName("Pipeline::Publish::");
+
+					// 段の間をつなぐ
+					m_capture.AttachFunctionOutput([this](const CCapture& object) { return m_preprocess.Push(object); });
+					m_preprocess.AttachFunctionOutput([this](const CPrepared& object) { return m_infer.Push(object); });
+					m_infer.AttachFunctionOutput([this](const CResult& object) { m_noticeResult.RequestNotice(object); return true; });
+
+					// 空きを待っている前の段を再開させる
+					m_preprocess.SetUpstream(&m_capture);
+					m_infer.SetUpstream(&m_preprocess);
+
+					// 通知が遅れた場合は空きが出るまで推論を待機
+					m_noticeResult.SetCapacity(capacity, Notice::Worker::OverflowBlock);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コピー代入演算子
+				/// @detail			※無効にする
+				////////////////////////////////////////////////////////////////////////////////
+				CTemplate& operator = (const CTemplate& object) = delete;
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				virtual ~CTemplate()
+				{
+					// 停止
+					Stop();
+				}
+
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			取り込む関数の登録
+				/// @detail			開始する前に呼び出す
+				///					登録しない場合はPush()で取り込んだ情報を追加する
+				/// @param[in]		object	取り込む関数 ※戻り値はfalse:取り込みなし ⇒ 周期で待機して取り込み直す
+				////////////////////////////////////////////////////////////////////////////////
+				void AttachFunctionCapture(std::function<bool(CCapture&)> object)
+				{
+					m_capture.AttachFunctionCapture(object);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			前処理する関数の登録
+				/// @detail			開始する前に呼び出す
+				/// @param[in]		object	前処理する関数 ※戻り値はfalse:推論しない
+				////////////////////////////////////////////////////////////////////////////////
+				void AttachFunctionPreprocess(std::function<bool(const CCapture&, CPrepared&)> object)
+				{
+					m_preprocess.AttachFunctionProcess(object);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			推論する関数の登録
+				/// @detail			開始する前に呼び出す
+				/// @param[in]		object	推論する関数 ※戻り値はfalse:通知しない
+				////////////////////////////////////////////////////////////////////////////////
+				void AttachFunctionInfer(std::function<bool(const CPrepared&, CResult&)> object)
+				{
+					m_infer.AttachFunctionProcess(object);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			推論の結果を通知する関数の登録
+				/// @param[in]		object	呼び出されたい関数
+				////////////////////////////////////////////////////////////////////////////////
+				void AttachFunctionResult(std::function<OnResult> object)
+				{
+					// 通知の時間を集計
+					m_noticeResult.AttachFunctionCalled([this, object](const CResult& result)
+					{
+						Utility::CStopWatch stopWatch;
+
+						object(result);
+
+						m_publish.Record(stopWatch.Stop());
+					});
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			推論の結果を通知する関数の解除
+				////////////////////////////////////////////////////////////////////////////////
+				void DetachFunctionResult()
+				{
+					m_noticeResult.DetachFunctionCalled();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			開始
+				/// @detail			待機する側から順に開始する
+				////////////////////////////////////////////////////////////////////////////////
+				void Start() throw(...)
+				{
+					m_noticeResult.Start();
+					m_noticeResult.RequestInitialize();
+					m_infer.Start();
+					m_preprocess.Start();
+					m_capture.Start();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			停止
+				/// @detail			取り込みから順に停止する ※待ち行列に残った情報は破棄する
+				////////////////////////////////////////////////////////////////////////////////
+				void Stop() throw(...)
+				{
+					m_capture.Stop();
+					m_preprocess.Stop();
+					m_infer.Stop();
+					m_noticeResult.RequestDestroy();
+					m_noticeResult.Stop();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			取り込んだ情報を追加
+				/// @detail			取り込む関数を登録しない場合に、取り込みのスレッド(画像を受信する関数など)から呼び出す
+				/// @param[in]		object	取り込んだ情報
+				/// @return			true:追加 / false:前処理が上限のため破棄
+				////////////////////////////////////////////////////////////////////////////////
+				bool Push(const CCapture& object)
+				{
+					return m_preprocess.Push(object);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			段ごとの統計を取得
+				/// @return			取り込み・前処理・推論・通知の順の統計
+				////////////////////////////////////////////////////////////////////////////////
+				std::vector<Statistics::CObject> GetStatistics()
+				{
+					std::vector<Statistics::CObject> ret;
+
+					ret.push_back(m_capture.GetStatistics());
+					ret.push_back(m_preprocess.GetStatistics());
+					ret.push_back(m_infer.GetStatistics());
+
+					Statistics::CObject publish;
+
+					publish.Name = "Pipeline::Publish::";
+					m_publish.Get(publish);
+					publish.Dropped = m_noticeResult.GetDropped();
+
+					ret.push_back(publish);
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			段ごとの統計を初期化
+				/// @detail			待ち行列の統計は初期化しない
+				////////////////////////////////////////////////////////////////////////////////
+				void ResetStatistics()
+				{
+					m_capture.ResetStatistics();
+					m_preprocess.ResetStatistics();
+					m_infer.ResetStatistics();
+					m_publish.Reset();
+				}
+
+			private:
+				//! 取り込み
+				Stage::CSource<CCapture> m_capture;
+
+				//! 前処理
+				Stage::CTemplate<CCapture, CPrepared> m_preprocess;
+
+				//! 推論
+				Stage::CTemplate<CPrepared, CResult> m_infer;
+
+				//! 推論の結果の通知
+				Notice::Worker::CTemplate<OnResult, CResult> m_noticeResult;
+
+				//! 推論の結果の通知の統計
+				Stage::CCounter m_publish;
+			};
+		}
+	}
+}
\ No newline at end of file
@@ -16,25 +16,25 @@ namespace Standard
 {
 	namespace Plc
 	{
-		// o[W擾
+		// バージョンを取得
 		PLC_API Version::CObject GetVersion() throw(...);
 
-		// Oʒm֐̓o^
+		// 例外を通知する関数の登録
 		PLC_API void AttachFunctionException(std::function<void(const Exception::CObject&)> object);
 
-		// Oʒm֐̉
+		// 例外を通知する関数の解除
 		PLC_API void DetachFunctionException();
 
-		// 
+		// 初期化
 		PLC_API void Initialize(const Setting::CDefault& object) throw(...);
 
-		// j
+		// 破棄
 		PLC_API void Destroy() throw(...);
 
-		// ڑ
+		// 接続
 		PLC_API void Connect(const Setting::CConnect& object) throw(...);
 
-		// ؒf
+		// 切断
 		PLC_API void Disconnect() throw(...);
 	}
 }
\ No newline at end of file
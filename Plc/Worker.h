@@ -11,26 +11,26 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CTemplate
-			/// @brief      Plc̐sev[g̃NX
-			///				 foCX̐sev[g̃NXp
-			/// @param[in]	CDefault	ftHg̐ݒNXw
-			/// @param[in]	CConnect	ڑ̐ݒNXw
+			/// @brief      Plcの制御を行うテンプレートのクラス
+			///				⇒ デバイスの制御を行うテンプレートのクラスから継承
+			/// @param[in]	CDefault	デフォルトの設定クラスを指定
+			/// @param[in]	CConnect	接続の設定クラスを指定
 			////////////////////////////////////////////////////////////////////////////////
 			class CTemplate
 				: virtual public Device::Worker::CTemplate<Setting::CDefault, Setting::CConnect>
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate() : Device::Worker::CTemplate<Setting::CDefault, Setting::CConnect>()
 				{
-					// ̂XV
+					// 名称を更新
 					SetName("Plc::");
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CTemplate()
 				{
@@ -39,7 +39,7 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ς݂̗O𔭖C
+				/// @brief			初期化済みの例外を発砲
 				////////////////////////////////////////////////////////////////////////////////
 				void ExceptionInitialized() override
 				{
@@ -48,12 +48,12 @@ namespace Standard
 
 					logging.Message << GetName() << "ExceptionInitialized()" << Logging::ConstSeparator;
 
-					// O𔭖C
+					// 例外を発砲
 					OutputException(Exception::CodePlcInitialized, logging, postscript.str());
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			jς݂̗O𔭖C
+				/// @brief			破棄済みの例外を発砲
 				////////////////////////////////////////////////////////////////////////////////
 				void ExceptionDiscarded() override
 				{
@@ -62,12 +62,12 @@ namespace Standard
 
 					logging.Message << GetName() << "ExceptionDiscarded()" << Logging::ConstSeparator;
 
-					// O𔭖C
+					// 例外を発砲
 					OutputException(Exception::CodePlcDiscarded, logging, postscript.str());
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̗O𔭖C
+				/// @brief			未初期化の例外を発砲
 				////////////////////////////////////////////////////////////////////////////////
 				void ExceptionUninitialized() override
 				{
@@ -76,7 +76,7 @@ namespace Standard
 
 					logging.Message << GetName() << "ExceptionUninitialized()" << Logging::ConstSeparator;
 
-					// O𔭖C
+					// 例外を発砲
 					OutputException(Exception::CodePlcUninitialized, logging, postscript.str());
 				}
 			};
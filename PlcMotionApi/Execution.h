@@ -2,6 +2,7 @@
 
 #include "Common/Tool/Text.h"
 #include "Common/Tool/Logging.h"
+#include "Common/Metrics/Scope.h"
 #include "Common/Utility/StopWatch.h"
 #include "Exception/Convert.h"
 #include "Transfer/Transfer.h"
@@ -18,15 +19,15 @@ namespace Standard
 	namespace Plc
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			nh𕶎֕ϊ
-		/// @param[in]		value nh̒l
-		/// @return			ɕϊnh
+		/// @brief			ハンドルを文字列へ変換
+		/// @param[in]		value ハンドルの値
+		/// @return			文字列に変換したハンドル
 		////////////////////////////////////////////////////////////////////////////////
 		inline std::string FormatHandle(unsigned long value)
 		{
 			std::string ret = "";
 
-			// nh𕶎֕ϊ
+			// ハンドルを文字列へ変換
 			ret = Text::FormatX(8, value);
 
 			return ret;
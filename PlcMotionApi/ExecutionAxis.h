@@ -11,9 +11,9 @@ namespace Standard
 		namespace Axis
 		{
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			
-			/// @param[in]		object ݒNX
-			/// @return			ʃNX
+			/// @brief			軸を初期化
+			/// @param[in]		object 軸を初期化する設定クラス
+			/// @return			軸を初期化した結果クラス
 			////////////////////////////////////////////////////////////////////////////////
 			inline Result::CInitialize Initialize(const Setting::CInitialize& object)
 			{
@@ -29,30 +29,30 @@ namespace Standard
 
 				try
 				{
-					// ̃nh쐬ݒNX
+					// 軸のハンドルを作成する設定クラス
 					MotionApi::Axis::Setting::CDeclare setting = object.Declare;
 
-					// ̃nh쐬
+					// 軸のハンドルを作成
 					postscript << "MotionApi::DeclareAxis()";
-					postscript << Logging::ConstSeparator << "XbgNo:" << object.Declare.SlotNo;
-					postscript << Logging::ConstSeparator << "TuXbgNo:" << object.Declare.SubSlotNo;
-					postscript << Logging::ConstSeparator << "Xe[VNo:" << object.Declare.StationNo;
-					postscript << Logging::ConstSeparator << "_No:" << object.Declare.LogicalNo;
-					postscript << Logging::ConstSeparator << "^Cv:" << object.Declare.Type;
+					postscript << Logging::ConstSeparator << "スロットNo:" << object.Declare.SlotNo;
+					postscript << Logging::ConstSeparator << "サブスロットNo:" << object.Declare.SubSlotNo;
+					postscript << Logging::ConstSeparator << "ステーションNo:" << object.Declare.StationNo;
+					postscript << Logging::ConstSeparator << "論理軸No:" << object.Declare.LogicalNo;
+					postscript << Logging::ConstSeparator << "軸タイプ:" << object.Declare.Type;
 					ret.Axis = MotionApi::DeclareAxis(setting);
-					// Oo
-					postscript << Logging::ConstSeparator << "nh:" << FormatHandle(ret.Axis.Handle) << Logging::ConstSeparator << stopWatch.Format(true);
+					// ログ出力
+					postscript << Logging::ConstSeparator << "ハンドル:" << FormatHandle(ret.Axis.Handle) << Logging::ConstSeparator << stopWatch.Format(true);
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 				}
 				catch (const MotionApi::CException& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, e.ErrorCode, logging, postscript.str(), e));
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 
@@ -60,8 +60,8 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			j
-			/// @param[in]		object jݒNX
+			/// @brief			軸を破棄
+			/// @param[in]		object 軸を破棄する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			inline void Destroy(const Setting::CDestroy& object)
 			{
@@ -75,21 +75,21 @@ namespace Standard
 
 				try
 				{
-					// ̃nhj
+					// 軸のハンドルを破棄
 					postscript << "MotionApi::ClearAllAxis()";
 					MotionApi::ClearAllAxis();
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 				}
 				catch (const MotionApi::CException& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, e.ErrorCode, logging, postscript.str(), e));
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
@@ -11,9 +11,9 @@ namespace Standard
 		namespace Controller
 		{
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			Rg[
-			/// @param[in]		object Rg[ݒNX
-			/// @return			Rg[ʂێNX
+			/// @brief			コントローラを初期化
+			/// @param[in]		object コントローラを初期化する設定クラス
+			/// @return			コントローラを初期化した結果を保持するクラス
 			////////////////////////////////////////////////////////////////////////////////
 			inline Result::CInitialize Initialize(const Setting::CInitialize& object)
 			{
@@ -29,36 +29,36 @@ namespace Standard
 
 				try
 				{
-					// Rg[JݒNX
+					// コントローラを開く設定クラス
 					MotionApi::Controller::Setting::COpen setting = object.Open;
 
-					// Rg[Ɛڑ
+					// コントローラと接続
 					postscript << "MotionApi::OpenController()";
 					ret.Controller = MotionApi::OpenController(setting);
-					// Oo
-					postscript << Logging::ConstSeparator << "nh:" << FormatHandle(ret.Controller.Handle) << Logging::ConstSeparator << stopWatch.Format(true);
+					// ログ出力
+					postscript << Logging::ConstSeparator << "ハンドル:" << FormatHandle(ret.Controller.Handle) << Logging::ConstSeparator << stopWatch.Format(true);
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// Api^CAEg̐ݒNX
+					// Apiタイムアウトの設定クラス
 					MotionApi::Controller::Setting::CApiTimeout apiTimeout = object.ApiTimeout;
 
-					// Apĩ^CAEgݒ
-					postscript << "MotionApi::SetApiTimeout()" << Logging::ConstSeparator << "^CAEg:" << apiTimeout.Value;
+					// Apiのタイムアウトを設定
+					postscript << "MotionApi::SetApiTimeout()" << Logging::ConstSeparator << "タイムアウト:" << apiTimeout.Value;
 					MotionApi::SetApiTimeout(apiTimeout);
-					// Oo
+					// ログ出力
 					postscript << Logging::ConstSeparator << stopWatch.Format(true);
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 				}
 				catch (const MotionApi::CException& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, e.ErrorCode, logging, postscript.str(), e));
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 
@@ -66,8 +66,8 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			Rg[j
-			/// @param[in]		object Rg[jݒNX
+			/// @brief			コントローラを破棄
+			/// @param[in]		object コントローラを破棄する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			inline void Destroy(const Setting::CDestroy& object)
 			{
@@ -83,36 +83,36 @@ namespace Standard
 				{
 					do
 					{
-						// Rg[ݒNX
+						// コントローラを閉じる設定クラス
 						MotionApi::Controller::Setting::CClose setting = object.Close;
 
-						// nhmF
+						// ハンドルを確認
 						if (setting.Handle == MotionApi::ConstDisconnected)
 						{
-							// Oo
-							postscript << Logging::ConstSeparator << "";
+							// ログ出力
+							postscript << Logging::ConstSeparator << "未初期化";
 							Transfer::Output(Logging::Join(logging, postscript.str()));
 							postscript.str("");
 							break;
 						}
 
-						// Rg[Ɛؒf
+						// コントローラと切断
 						postscript << "MotionApi::CloseController()";
 						MotionApi::CloseController(setting);
-						// Oo
-						postscript << Logging::ConstSeparator << "nh:" << FormatHandle(setting.Handle) << Logging::ConstSeparator << stopWatch.Format(true);
+						// ログ出力
+						postscript << Logging::ConstSeparator << "ハンドル:" << FormatHandle(setting.Handle) << Logging::ConstSeparator << stopWatch.Format(true);
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 					} while (false);
 				}
 				catch (const MotionApi::CException& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, e.ErrorCode, logging, postscript.str(), e));
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
@@ -15,22 +15,22 @@ namespace Standard
 		namespace Device
 		{
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			foCX̃nh쐬
-			/// @param[in]		logging ȌێNX
-			/// @param[in]		object foCX̃nh쐬ݒNX
-			/// @return			foCX̃nh쐬ʃNX
+			/// @brief			デバイスのハンドルを作成
+			/// @param[in]		logging ログの情報を保持するクラス
+			/// @param[in]		object デバイスのハンドルを作成する設定クラス
+			/// @return			デバイスのハンドルを作成した結果クラス
 			////////////////////////////////////////////////////////////////////////////////
 			MotionApi::Device::Result::CDeclare DeclareDevice(const Logging::CObject& logging, const MotionApi::Device::Setting::CDeclare& object)
 			{
 				MotionApi::Device::Result::CDeclare ret;
 				std::stringstream postscript;
 
-				// foCX̃nh쐬
+				// デバイスのハンドルを作成
 				postscript << "MotionApi::DeclareDevice()";
-				postscript << Logging::ConstSeparator << "nh:";
+				postscript << Logging::ConstSeparator << "軸ハンドル:";
 				for (auto iterator = object.Handles.begin(); iterator != object.Handles.end(); iterator++)
 				{
-					// nh̏Ԃ擪ォmF
+					// ハンドルの順番が先頭より後か確認
 					if (0 < std::distance(object.Handles.begin(), iterator))
 					{
 						postscript << Logging::ConstSeparator;
@@ -38,8 +38,8 @@ namespace Standard
 					postscript << FormatHandle(*iterator);
 				}
 				ret = MotionApi::DeclareDevice(object);
-				// Oo
-				postscript << Logging::ConstSeparator << "foCXnh:" << FormatHandle(ret.Handle);
+				// ログ出力
+				postscript << Logging::ConstSeparator << "デバイスハンドル:" << FormatHandle(ret.Handle);
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 
@@ -47,9 +47,9 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			foCX̃nhNA
-			/// @param[in]		logging ȌێNX
-			/// @param[in]		object ̃nh쐬ʃNX
+			/// @brief			デバイスのハンドルをクリア
+			/// @param[in]		logging ログの情報を保持するクラス
+			/// @param[in]		object 軸のハンドルを作成した結果クラス
 			////////////////////////////////////////////////////////////////////////////////
 			void ClearDevice(const Logging::CObject& logging, const MotionApi::Device::Result::CDeclare& object)
 			{
@@ -57,21 +57,21 @@ namespace Standard
 
 				MotionApi::Device::Setting::CClear setting;
 
-				// nhXV
+				// ハンドルを更新
 				setting.Handle = object.Handle;
 
-				// foCX̃nhNA
+				// デバイスのハンドルをクリア
 				postscript << "MotionApi::ClearDevice()";
-				postscript << Logging::ConstSeparator << "nh:" << FormatHandle(setting.Handle);
+				postscript << Logging::ConstSeparator << "ハンドル:" << FormatHandle(setting.Handle);
 				MotionApi::ClearDevice(setting);
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			~
-			/// @param[in]		object ~ݒNX
+			/// @brief			制御を停止
+			/// @param[in]		object 制御を停止する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			inline void Suspend(const Device::Setting::CSuspend& object)
 			{
@@ -85,75 +85,78 @@ namespace Standard
 
 				try
 				{
-					// 𑖍
+					// 軸を走査
 					for (const auto& axis : object.Axises)
 					{
 						MotionApi::Register::Setting::CDeclare declare;
 
-						postscript << Logging::ConstSeparator << "nh:" << FormatHandle(axis.Handle);
+						postscript << Logging::ConstSeparator << "ハンドル:" << FormatHandle(axis.Handle);
 						Io::Specify::CAddress address;
 						address.Category = Plc::Register::ConstCategoryO;
 						address.Category += Plc::Register::ConstTypeWord;
 						address.Hex = true;
 						address.Margin = 4;
 						address.Index = axis.Address + 8;
-						postscript << Logging::ConstSeparator << "AhX:" << Io::Specify::Format(address);
-						// Oo
+						postscript << Logging::ConstSeparator << "アドレス:" << Io::Specify::Format(address);
+						// ログ出力
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// WX^̃AhXXV
+						// レジスタのアドレスを更新
 						Register::CSpecify specify(address.Category);
 						specify.Index = address.Index;
 						postscript << "Register::CSpecify::GetAddress()";
 						declare.Address = specify.GetAddress();
 						postscript.str("");
 
-						// WX^̃nh쐬
+						// 更新するワード数を更新
+						declare.Size = 1;
+
+						// レジスタのハンドルを作成
 						postscript << "MotionApi::DeclareRegister()";
-						postscript << Logging::ConstSeparator << "AhX:" << declare.Address;
+						postscript << Logging::ConstSeparator << "アドレス:" << declare.Address;
 						auto result = MotionApi::DeclareRegister(declare);
-						// Oo
-						postscript << Logging::ConstSeparator << "nh:" << FormatHandle(result.Handle);
+						// ログ出力
+						postscript << Logging::ConstSeparator << "ハンドル:" << FormatHandle(result.Handle);
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
 						MotionApi::Register::Setting::CSetContent setting;
 
-						// nhXV
+						// ハンドルを更新
 						setting.Handle = result.Handle;
 
-						// f[^i[
+						// データを格納
 						setting.Buffers.emplace_back(0);
 
-						// f[^XV
+						// データ数を更新
 						setting.Size = 1;
 
-						// WX^̒lXV
-						postscript << "MotionApi::SetRegisterData()" << Logging::ConstSeparator << "nh:" << FormatHandle(setting.Handle);
-						postscript << Logging::ConstSeparator << "XVTCY:" << setting.Size;
+						// レジスタの値を更新
+						postscript << "MotionApi::SetRegisterData()" << Logging::ConstSeparator << "ハンドル:" << FormatHandle(setting.Handle);
+						postscript << Logging::ConstSeparator << "更新サイズ:" << setting.Size;
 						MotionApi::SetRegisterData(setting);
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 					}
 				}
 				catch (const MotionApi::CException& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, e.ErrorCode, logging, postscript.str(), e));
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			T[{𐧌
-			/// @param[in]		object T[{̐sݒNX
+			/// @brief			サーボを制御
+			/// @param[in]		object サーボの制御を行う設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			inline void Servo(const Device::Setting::CServo& object)
 			{
@@ -167,57 +170,57 @@ namespace Standard
 
 				try
 				{
-					// foCX̃nh쐬
+					// デバイスのハンドルを作成
 					postscript << "DeclareDevice()";
 					auto result = DeclareDevice(logging, object);
 					postscript.str("");
 
 					try
 					{
-						// T[{̐sݒNX
+						// サーボの制御を行う設定クラス
 						MotionApi::Device::Setting::CServo setting = object;
 
-						// nhXV
+						// ハンドルを更新
 						setting.Handle = result.Handle;
 
-						// T[{𐧌
+						// サーボを制御
 						postscript << "MotionApi::ServoControl()";
-						postscript << Logging::ConstSeparator << "nh:" << Plc::FormatHandle(setting.Handle);
-						postscript << Logging::ConstSeparator << ":" << (setting.Mode == Signal::StatusOn ? "ON" : "OFF");
-						postscript << Logging::ConstSeparator << "^CAEg:" << setting.Timeout;
+						postscript << Logging::ConstSeparator << "ハンドル:" << Plc::FormatHandle(setting.Handle);
+						postscript << Logging::ConstSeparator << "状態:" << (setting.Mode == Signal::StatusOn ? "ON" : "OFF");
+						postscript << Logging::ConstSeparator << "タイムアウト:" << setting.Timeout;
 						MotionApi::ServoControl(setting);
-						// Oo
+						// ログ出力
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// foCX̃nhNA
+						// デバイスのハンドルをクリア
 						postscript << "ClearDevie()";
 						ClearDevice(logging, result);
 						postscript.str("");
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  foCX̃nhNA
+						// 例外の処理 ⇒ デバイスのハンドルをクリア
 						ClearDevice(logging, result);
 						throw;
 					}
 				}
 				catch (const MotionApi::CException& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, e.ErrorCode, logging, postscript.str(), e));
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			_As
-			/// @param[in]		object _AsݒNX
+			/// @brief			原点復帰を実行
+			/// @param[in]		object 原点復帰を実行する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			inline void MoveOrigin(const Device::Setting::CMoveOrigin& object)
 			{
@@ -233,65 +236,65 @@ namespace Standard
 				{
 					MotionApi::Device::Setting::CMoveOrigin setting = object;
 
-					// foCX̃nh쐬
+					// デバイスのハンドルを作成
 					postscript << "DeclareDevice()";
 					auto result = DeclareDevice(logging, setting.GetDeclare());
 					postscript.str("");
 
 					try
 					{
-						// nhXV
+						// ハンドルを更新
 						setting.Handle = result.Handle;
 
-						// 𑖍
+						// 軸を走査
 						for (const auto& axis : setting.Axises)
 						{
-							postscript << Logging::ConstSeparator << "nh:" << FormatHandle(axis.Handle);
+							postscript << Logging::ConstSeparator << "ハンドル:" << FormatHandle(axis.Handle);
 							postscript << Logging::ConstSeparator << MotionApi::Message::Convert((MotionApi::Device::Setting::Motion::CTemplate)axis);
 							postscript << Logging::ConstSeparator << MotionApi::Message::Convert((MotionApi::Device::Setting::Position::CTemplate)axis);
 							postscript << Logging::ConstSeparator << MotionApi::Message::Convert(axis.Method);
 							postscript << Logging::ConstSeparator << MotionApi::Message::Convert(axis.Direction);
-							// Oo
+							// ログ出力
 							Transfer::Output(Logging::Join(logging, postscript.str()));
 							postscript.str("");
 						}
 
-						// _As
+						// 原点復帰を実行
 						postscript << "MotionApi::MoveOrigin()";
-						postscript << Logging::ConstSeparator << "nh:" << Plc::FormatHandle(setting.Handle);
+						postscript << Logging::ConstSeparator << "ハンドル:" << Plc::FormatHandle(setting.Handle);
 						MotionApi::MoveOrigin(setting);
-						// Oo
+						// ログ出力
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// foCX̃nhNA
+						// デバイスのハンドルをクリア
 						postscript << "ClearDevie()";
 						ClearDevice(logging, result);
 						postscript.str("");
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  foCX̃nhNA
+						// 例外の処理 ⇒ デバイスのハンドルをクリア
 						ClearDevice(logging, result);
 						throw;
 					}
 				}
 				catch (const MotionApi::CException& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, e.ErrorCode, logging, postscript.str(), e));
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			WOJn
-			/// @param[in]		object WOJnݒNX
+			/// @brief			ジョグを開始
+			/// @param[in]		object ジョグを開始する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			inline void StartJog(const Device::Setting::CStartJog& object)
 			{
@@ -307,65 +310,65 @@ namespace Standard
 				{
 					MotionApi::Device::Setting::CStartJog setting = object;
 
-					// foCX̃nh쐬
+					// デバイスのハンドルを作成
 					postscript << "DeclareDevice()";
 					auto result = DeclareDevice(logging, setting.GetDeclare());
 					postscript.str("");
 
 					try
 					{
-						// nhXV
+						// ハンドルを更新
 						setting.Handle = result.Handle;
 
-						// 𑖍
+						// 軸を走査
 						for (const auto& axis : setting.Axises)
 						{
-							postscript << Logging::ConstSeparator << "nh:" << FormatHandle(axis.Handle);
+							postscript << Logging::ConstSeparator << "ハンドル:" << FormatHandle(axis.Handle);
 							postscript << Logging::ConstSeparator << MotionApi::Message::Convert(axis);
-							postscript << Logging::ConstSeparator << ":" << axis.Direction;
-							postscript << Logging::ConstSeparator << "^CAEg:" << axis.Timeout;
-							// Oo
+							postscript << Logging::ConstSeparator << "方向:" << axis.Direction;
+							postscript << Logging::ConstSeparator << "タイムアウト:" << axis.Timeout;
+							// ログ出力
 							postscript << Logging::ConstSeparator << stopWatch.Format(true);
 							Transfer::Output(Logging::Join(logging, postscript.str()));
 							postscript.str("");
 						}
 
-						// WOs
+						// ジョグを実行
 						postscript << "MotionApi::StartJog()";
-						postscript << Logging::ConstSeparator << "nh:" << Plc::FormatHandle(setting.Handle);
+						postscript << Logging::ConstSeparator << "ハンドル:" << Plc::FormatHandle(setting.Handle);
 						MotionApi::StartJog(setting);
-						// Oo
+						// ログ出力
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// foCX̃nhNA
+						// デバイスのハンドルをクリア
 						postscript << "ClearDevie()";
 						ClearDevice(logging, result);
 						postscript.str("");
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  foCX̃nhNA
+						// 例外の処理 ⇒ デバイスのハンドルをクリア
 						ClearDevice(logging, result);
 						throw;
 					}
 				}
 				catch (const MotionApi::CException& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, e.ErrorCode, logging, postscript.str(), e));
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			WO~
-			/// @param[in]		object WO~ݒNX
+			/// @brief			ジョグを停止
+			/// @param[in]		object ジョグを停止する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			inline void StopJog(const Device::Setting::CStopJog& object)
 			{
@@ -381,56 +384,56 @@ namespace Standard
 				{
 					MotionApi::Device::Setting::CStopJog setting = object;
 
-					// foCX̃nh쐬
+					// デバイスのハンドルを作成
 					postscript << "DeclareDevice()";
 					auto result = DeclareDevice(logging, setting.GetDeclare());
 					postscript.str("");
 
 					try
 					{
-						// nhXV
+						// ハンドルを更新
 						setting.Handle = result.Handle;
 
-						// 𑖍
+						// 軸を走査
 						for (const auto& axis : setting.Axises)
 						{
-							postscript << Logging::ConstSeparator << ":" << FormatHandle(axis.Handle);
-							postscript << Logging::ConstSeparator << ":" << axis.Complete;
-							// Oo
+							postscript << Logging::ConstSeparator << "軸:" << FormatHandle(axis.Handle);
+							postscript << Logging::ConstSeparator << "完了:" << axis.Complete;
+							// ログ出力
 							postscript << Logging::ConstSeparator << stopWatch.Format(true);
 							Transfer::Output(Logging::Join(logging, postscript.str()));
 							postscript.str("");
 						}
 
-						// WO~
+						// ジョグを停止
 						postscript << "MotionApi::StopJog()";
-						postscript << Logging::ConstSeparator << "nh:" << Plc::FormatHandle(setting.Handle);
+						postscript << Logging::ConstSeparator << "ハンドル:" << Plc::FormatHandle(setting.Handle);
 						MotionApi::StopJog(setting);
-						// Oo
+						// ログ出力
 						postscript << Logging::ConstSeparator << stopWatch.Format(true);
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 
-						// foCX̃nhNA
+						// デバイスのハンドルをクリア
 						postscript << "ClearDevie()";
 						ClearDevice(logging, result);
 						postscript.str("");
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  foCX̃nhNA
+						// 例外の処理 ⇒ デバイスのハンドルをクリア
 						ClearDevice(logging, result);
 						throw;
 					}
 				}
 				catch (const MotionApi::CException& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, e.ErrorCode, logging, postscript.str(), e));
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
@@ -12,8 +12,8 @@ namespace Standard
 		namespace Register
 		{
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			WX^̒l擾
-			/// @param[in]		object WX^̒l擾ݒNX
+			/// @brief			レジスタの値を取得
+			/// @param[in]		object レジスタの値を取得する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			inline Result::CContent Get(const Setting::CGetContent& object)
 			{
@@ -25,145 +25,140 @@ namespace Standard
 				int deviceErrorCode = Exception::DeviceCodeSuccess;
 				Utility::CStopWatch stopWatch;
 
+				// 処理時間を計測
+				static Metrics::CHistogram& histogram = Transfer::GetHistogram("Plc::Register::Get()");
+				Metrics::CScope scope(histogram);
+
 				logging.Message << object.Name << "Get()" << Logging::ConstSeparator;
 
 				try
 				{
 					Register::CSpecify specify(object.Category);
 
-					// ԍXV
+					// 番号を更新
 					specify.Index = object.Index;
 
-					// f[^̃^Cv
+					// データのタイプ
 					auto type = specify.GetType();
-					// 擾鐔
+					// 取得する数
 					unsigned long size = object.Size;
-					// AhX
+					// アドレス
 					std::string address = specify.GetAddress();
 
-					// WX^̃f[^^CvmF
+					// レジスタのデータタイプを確認
 					if (Register::ConstTypeBit == type)
 					{
-						// rbg^  WX^擾TCY[h^̃TCYōXV
+						// ビット型 ⇒ レジスタを取得するサイズをワード型のサイズで更新
 						size /= 16;
-						// 擪0rbgȊOl2]Ɋm
+						// ※先頭が0ビット以外を考慮して2つ余分に確保
 						size += 2;
 					}
 					else if (Register::ConstTypeLong == type)
 					{
-						// O^  WX^擾TCY[h^̃TCYōXV
+						// ロング型 ⇒ レジスタを取得するサイズをワード型のサイズで更新
 						size *= 2;
 					}
 
-					// f[^̃^Cv[h^ɍXV
+					// データのタイプをワード型に更新
 					postscript << "Register::CSpecify::ChangeType(Register::ConstTypeWord)";
 					specify.ChangeType(Register::ConstTypeWord);
 					postscript.str("");
 
 					MotionApi::Register::Setting::CDeclare declare;
 
-					// WX^̃AhXXV
+					// レジスタのアドレスを更新
 					postscript << "Register::CSpecify::GetAddress()";
 					declare.Address = specify.GetAddress();
 					postscript.str("");
 
-					// WX^̃nh쐬
+					// 取得するワード数を更新
+					declare.Size = size;
+
+					// レジスタのハンドルを作成
 					postscript << "MotionApi::DeclareRegister()";
-					postscript << Logging::ConstSeparator << "AhX:" << declare.Address;
+					postscript << Logging::ConstSeparator << "アドレス:" << declare.Address;
 					auto result = MotionApi::DeclareRegister(declare);
-					// Oo
-					postscript << Logging::ConstSeparator << "nh:" << FormatHandle(result.Handle);
+					// ログ出力
+					postscript << Logging::ConstSeparator << "ハンドル:" << FormatHandle(result.Handle);
 					//@@@Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
 					MotionApi::Register::Setting::CGetContent setting;
 
-					// nhXV
+					// ハンドルを更新
 					setting.Handle = result.Handle;
 
-					// f[^XV
+					// データ数を更新
 					setting.Size = size;
 
-					// WX^̒l擾
-					postscript << "MotionApi::GetRegisterData()" << Logging::ConstSeparator << "nh:" << FormatHandle(setting.Handle);
-					postscript << Logging::ConstSeparator << "vTCY:" << setting.Size;
+					// レジスタの値を取得
+					postscript << "MotionApi::GetRegisterData()" << Logging::ConstSeparator << "ハンドル:" << FormatHandle(setting.Handle);
+					postscript << Logging::ConstSeparator << "要求サイズ:" << setting.Size;
 					auto content = MotionApi::GetRegisterData(setting);
-					// Oo
-					postscript << Logging::ConstSeparator << "擾TCY:" << content.Size;
+					// ログ出力
+					postscript << Logging::ConstSeparator << "取得サイズ:" << content.Size;
 					//@@@Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// f[^𑖍
-					for (unsigned long index = 0; index < content.Size; index++)
+					// レジスタのデータタイプを確認
+					if (Register::ConstTypeBit == type)
 					{
-						unsigned long target = index;
+						// ビット型 ⇒ レジスタの先頭ビット番号を取得
+						unsigned long first = std::stoul(std::string(&address.back()), nullptr, 16);
 
-						// WX^̃f[^^CvmF
-						if (Register::ConstTypeBit == type)
+						// 格納先を確保
+						ret.Bits.reserve(object.Size);
+
+						// データを走査
+						for (unsigned long index = 0; index < content.Size && ret.Bits.size() < object.Size; index++)
 						{
-							// rbg^  WX^̐擪rbgԍ擾
-							auto first = std::stoi(std::string(&address.back()), nullptr, 16);
-							// 擪̃WX^ȊO0rbgڂ擪
-							auto bit = index == 0 ? first : 0;
+							// ※先頭のレジスタ以外は0ビット目が先頭
+							unsigned long bit = index == 0 ? first : 0;
+							unsigned short buffer = (unsigned short)content.Buffers.at(index);
 
-							// 1[h𑖍
-							while (bit < 16)
+							// 1ワード内を走査 ⇒ サイズを超えた場合は処理を抜ける
+							for (; bit < 16 && ret.Bits.size() < object.Size; bit++)
 							{
-								// f[^̊i[m
-								target = (index * 16) + bit - first;
-
-								// i[mF
-								if (object.Size <= target)
-								{
-									// TCY𒴂  𔲂
-									break;
-								}
-
-								// f[^i[
-								ret.Bits[target] = content.Buffers.at(index) >> bit & 0x1;
-
-								// ̃rbg
-								bit++;
+								// データを格納
+								ret.Bits.push_back(buffer >> bit & 0x1);
 							}
 						}
-						else if (Register::ConstTypeWord == type)
-						{
-							// [h^  f[^i[
-							ret.Words[target] = content.Buffers.at(index);
-						}
-						else if (Register::ConstTypeLong == type)
-						{
-							// O^  f[^̊i[m
-							target = index / 2 * 2;
-							// f[^mF
-							if (ret.Longs.count(target) <= 0)
-							{
-								// o^
-								ret.Longs[target];
-							}
+					}
+					else if (Register::ConstTypeWord == type)
+					{
+						// ワード型 ⇒ データを格納
+						ret.Words.assign(content.Buffers.begin(), content.Buffers.begin() + content.Size);
+					}
+					else if (Register::ConstTypeLong == type)
+					{
+						// 格納先を確保
+						ret.Longs.reserve(content.Size / 2 + 1);
 
-							// i[mF
+						// データを走査
+						for (unsigned long index = 0; index < content.Size; index++)
+						{
+							// 格納先を確認
 							if (index % 2)
 							{
-								// ʃ[h  1[hVtgčXV
-								ret.Longs[target] |= ((unsigned long)content.Buffers.at(index)) << 16;
+								// 上位ワード ⇒ 1ワード分シフトして更新
+								ret.Longs.back() |= ((unsigned long)content.Buffers.at(index)) << 16;
 							}
 							else
 							{
-								// ʃ[h
-								ret.Longs[target] |= (unsigned long)content.Buffers.at(index);
+								// 下位ワード
+								ret.Longs.push_back((long)content.Buffers.at(index));
 							}
 						}
 					}
 				}
 				catch (const MotionApi::CException& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, e.ErrorCode, logging, postscript.str(), e));
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 
@@ -171,8 +166,8 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			WX^̒lXV
-			/// @param[in]		object	WX^̒lXVݒNX
+			/// @brief			レジスタの値を更新
+			/// @param[in]		object	レジスタの値を更新する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			inline void Set(const Setting::CSetContent& object)
 			{
@@ -188,92 +183,90 @@ namespace Standard
 				{
 					Register::CSpecify specify(object.Category);
 
-					// ԍXV
+					// 番号を更新
 					specify.Index = object.Index;
 
-					// f[^̃^Cv
+					// データのタイプ
 					auto type = specify.GetType();
-					// XV鐔
+					// 更新する数
 					unsigned long size = (unsigned long)object.Values.size();
-					// މ
+					// 書き込む回数
 					unsigned long loop = 1;
 
-					// WX^̃f[^^CvmF
+					// レジスタのデータタイプを確認
 					if (Register::ConstTypeBit == type)
 					{
-						// rbg^  1f[^̃TCYōXV
+						// ビット型 ⇒ 1データ毎のサイズで更新
 						size = 1;
-						// JԂ񐔂m
+						// 繰り返し回数を確定
 						loop = size;
 					}
 					else if (Register::ConstTypeLong == type)
 					{
-						// O^  WX^XVTCY[h^̃TCYōXV
+						// ロング型 ⇒ レジスタを更新するサイズをワード型のサイズで更新
 						size *= 2;
-						// f[^̃^Cv[h^ɍXV
+						// データのタイプをワード型に更新
 						specify.ChangeType(Register::ConstTypeWord);
 					}
 
-					for (unsigned long index = 0; index < loop; index++)
-					{
-						MotionApi::Register::Setting::CDeclare declare;
+					MotionApi::Register::Setting::CDeclare declare;
 
-						// WX^̃AhXXV
-						postscript << "Register::CSpecify::GetAddress()";
-						declare.Address = specify.GetAddress();
-						postscript.str("");
+					// レジスタのアドレスを更新
+					postscript << "Register::CSpecify::GetAddress()";
+					declare.Address = specify.GetAddress();
+					postscript.str("");
 
-						// WX^̃nh쐬
-						postscript << "MotionApi::DeclareRegister()";
-						postscript << Logging::ConstSeparator << "AhX:" << declare.Address;
-						auto result = MotionApi::DeclareRegister(declare);
-						// Oo
-						postscript << Logging::ConstSeparator << "nh:" << FormatHandle(result.Handle);
-						Transfer::Output(Logging::Join(logging, postscript.str()));
-						postscript.str("");
+					// 更新するワード数を更新
+					declare.Size = size;
+
+					// レジスタのハンドルを作成 ⇒ 書き込む回数に関わらず1回だけ
+					postscript << "MotionApi::DeclareRegister()";
+					postscript << Logging::ConstSeparator << "アドレス:" << declare.Address;
+					auto result = MotionApi::DeclareRegister(declare);
+					// ログ出力
+					postscript << Logging::ConstSeparator << "ハンドル:" << FormatHandle(result.Handle);
+					Transfer::Output(Logging::Join(logging, postscript.str()));
+					postscript.str("");
 
+					for (unsigned long index = 0; index < loop; index++)
+					{
 						MotionApi::Register::Setting::CSetContent setting;
 
-						// nhXV
+						// ハンドルを更新
 						setting.Handle = result.Handle;
 
-						// WX^̃f[^^CvmF
+						// レジスタのデータタイプを確認
 						if (Register::ConstTypeBit == type)
 						{
-							// rbg^	 WX^̃rbgԍ擾
-							auto first = std::stoi(std::string(&specify.GetAddress().back()), nullptr, 16);
-							// 擪̃WX^ȊO0rbgڂ擪
-							auto bit = index == 0 ? first : 0;
-
-							// f[^i[
+							// ビット型 ⇒ データを格納
 							setting.Buffers.emplace_back(object.Values[index]);
 						}
 						else if (Register::ConstTypeWord == type || Register::ConstTypeLong == type)
 						{
-							// [h^ or O^  f[^i[
+							// ワード型 or ロング型 ⇒ データを格納
 							std::copy(object.Values.begin(), object.Values.end(), std::back_inserter(setting.Buffers));
 						}
 
-						// f[^XV
+						// データ数を更新
 						setting.Size = size;
 
-						// WX^̒lXV
-						postscript << "MotionApi::SetRegisterData()" << Logging::ConstSeparator << "nh:" << FormatHandle(setting.Handle);
-						postscript << Logging::ConstSeparator << "XVTCY:" << setting.Size;
+						// レジスタの値を更新
+						postscript << "MotionApi::SetRegisterData()" << Logging::ConstSeparator << "ハンドル:" << FormatHandle(setting.Handle);
+						postscript << Logging::ConstSeparator << "更新サイズ:" << setting.Size;
 						MotionApi::SetRegisterData(setting);
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 					}
 				}
 				catch (const MotionApi::CException& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, e.ErrorCode, logging, postscript.str(), e));
 				}
 				catch (const std::exception& e)
 				{
-					// Ȍ  O𔭖C
+					// 例外の処理 ⇒ 例外を発砲
 					throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
 				}
 			}
@@ -6,18 +6,18 @@ namespace Standard
 {
 	namespace Plc
 	{
-		//! p[^̒`
+		//! パラメータの定義
 		enum EnumParameter
 		{
-			ParameterOpenController,		// Rg[JݒNX
-			ParameterApiTimeout,			// Api^CAEg̐ݒNX
-			ParameterDeclareAxis,			// ̃nh쐬ݒNX
-			ParameterSuspendTimeout,		// ̒~^CAEg[ms]
-			ParameterServoTimeout,			// T[{̃^CAEg[ms]
-			ParameterOriginAxis,			// ̌_Aݒ肷NX
-			ParameterMoveOriginTimeout,		// _Ã^CAEg[ms]
-			ParameterStartJog,				// WO̊Jnݒ肷NX
-			ParameterStopJog				// WO̒~ݒ肷NX
+			ParameterOpenController,		// コントローラを開く設定クラス
+			ParameterApiTimeout,			// Apiタイムアウトの設定クラス
+			ParameterDeclareAxis,			// 軸のハンドルを作成する設定クラス
+			ParameterSuspendTimeout,		// 制御の停止タイムアウト[ms]
+			ParameterServoTimeout,			// サーボ制御のタイムアウト[ms]
+			ParameterOriginAxis,			// 軸の原点復帰を設定するクラス
+			ParameterMoveOriginTimeout,		// 原点復帰のタイムアウト[ms]
+			ParameterStartJog,				// ジョグの開始を設定するクラス
+			ParameterStopJog				// ジョグの停止を設定するクラス
 		};
 	}
 }
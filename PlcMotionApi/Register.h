@@ -10,39 +10,39 @@ namespace Standard
 	{
 		namespace Register
 		{
-			//! SWX^
+			//! Sレジスタ
 			const char ConstCategoryS = 'S';
 
-			//! MWX^
+			//! Mレジスタ
 			const char ConstCategoryM = 'M';
 
-			//! IWX^
+			//! Iレジスタ
 			const char ConstCategoryI = 'I';
 
-			//! OWX^
+			//! Oレジスタ
 			const char ConstCategoryO = 'O';
 
-			//! CWX^
+			//! Cレジスタ
 			const char ConstCategoryC = 'C';
 
-			//! rbg^
+			//! ビット型
 			const char ConstTypeBit = 'B';
 
-			//! [h^
+			//! ワード型
 			const char ConstTypeWord = 'W';
 
-			//! O^
+			//! ロング型
 			const char ConstTypeLong = 'L';
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CSpecify
-			/// @brief      WX^̎wf[^ێNX
+			/// @brief      レジスタの指定データを保持するクラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CSpecify
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CSpecify()
 				{
@@ -51,41 +51,41 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
-				/// @param[in]		
+				/// @brief			コンストラクタ
+				/// @param[in]		種別
 				////////////////////////////////////////////////////////////////////////////////
 				CSpecify(std::string category) : CSpecify()
 				{
 					std::stringstream postscript;
 
-					postscript << ":" << category;
+					postscript << "種別:" << category;
 
-					// ʂmF
+					// 種別を確認
 					if (category.size() < 1)
 					{
-						// ʂw
-						postscript << "w";
+						// 種別が未指定
+						postscript << "が未指定";
 						throw std::exception(postscript.str().c_str());
 					}
 
-					// ʂXV
+					// 種別を更新
 					_category = category;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CSpecify& operator = (const CSpecify& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CSpecify()
 				{
@@ -93,47 +93,47 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			f[^̃^CvύX
-				/// @param[in]		type f[^̃^Cv
+				/// @brief			データのタイプを変更
+				/// @param[in]		type データのタイプ
 				////////////////////////////////////////////////////////////////////////////////
 				void ChangeType(const char& type)
 				{
 					std::stringstream postscript;
 					std::stringstream category;
 
-					postscript << ":" << _category;
+					postscript << "種別:" << _category;
 
-					// ʂ擾
+					// 種別を取得
 					category << GetCategory();
-					// f[^̃^CvmF
+					// データのタイプを確認
 					if (ConstTypeBit == GetType())
 					{
-						// rbg^  f[^̃^CvmF
+						// ビット型 ⇒ データのタイプを確認
 						if (ConstTypeBit != type)
 						{
-							// [h^ or O^  rbǧ폜
+							// ワード型 or ロング型 ⇒ ビットの桁を削除
 							Index >>= 4;
 						}
 					}
 					else
 					{
-						// [h^ or O^  f[^̃^CvmF
+						// ワード型 or ロング型 ⇒ データのタイプを確認
 						if (ConstTypeBit == type)
 						{
-							// rbg^  rbǧǉ
+							// ビット型 ⇒ ビットの桁を追加
 							Index <<= 4;
 						}
 					}
-					// f[^̃^CvXV
+					// データのタイプを更新
 					category << type;
 
-					// ʂXV
+					// 種別を更新
 					_category = category.str();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ʂ擾
-				/// @return			
+				/// @brief			種別を取得
+				/// @return			種別
 				////////////////////////////////////////////////////////////////////////////////
 				char GetCategory()
 				{
@@ -141,17 +141,17 @@ namespace Standard
 
 					std::stringstream postscript;
 
-					postscript << ":" << _category;
+					postscript << "種別:" << _category;
 
-					// ʂmF
+					// 種別を確認
 					if (_category.size() < 1)
 					{
-						// ʂw
-						postscript << "w";
+						// 種別が未指定
+						postscript << "が未指定";
 						throw std::exception(postscript.str().c_str());
 					}
 
-					// ʂ擾
+					// 種別を取得
 					ret = _category.at(0);
 
 					switch (ret)
@@ -161,12 +161,12 @@ namespace Standard
 					case ConstCategoryI:
 					case ConstCategoryO:
 					case ConstCategoryC:
-						// SAMAIAOACWX^
+						// S、M、I、O、Cレジスタ
 						break;
 
 					default:
-						// ̑
-						postscript << "sK";
+						// その他
+						postscript << "が不適切";
 						throw std::exception(postscript.str().c_str());
 					}
 
@@ -174,8 +174,8 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			f[^̃^Cv擾
-				/// @return			^Cv
+				/// @brief			データのタイプを取得
+				/// @return			タイプ
 				////////////////////////////////////////////////////////////////////////////////
 				char GetType()
 				{
@@ -183,17 +183,17 @@ namespace Standard
 
 					std::stringstream postscript;
 
-					postscript << ":" << _category;
+					postscript << "種別:" << _category;
 
-					// ʂmF
+					// 種別を確認
 					if (_category.size() < 2)
 					{
-						// f[^^Cvw
-						postscript << "Ńf[^̃^Cvw";
+						// データタイプが未指定
+						postscript << "でデータのタイプが未指定";
 						throw std::exception(postscript.str().c_str());
 					}
 
-					// f[^̃^Cv擾
+					// データのタイプを取得
 					ret = _category.at(1);
 
 					switch (ret)
@@ -201,12 +201,12 @@ namespace Standard
 					case ConstTypeBit:
 					case ConstTypeWord:
 					case ConstTypeLong:
-						// rbgA[hAO^
+						// ビット、ワード、ロング型
 						break;
 
 					default:
-						// ̑
-						postscript << "Ńf[^̃^CvsK";
+						// その他
+						postscript << "でデータのタイプが不適切";
 						throw std::exception(postscript.str().c_str());
 					}
 
@@ -214,18 +214,18 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			f[^̌擾
-				///					rbǧ͏Ȃ
-				/// @return			f[^̌
+				/// @brief			データの桁数を取得
+				///					※ビットの桁は省く
+				/// @return			データの桁数
 				////////////////////////////////////////////////////////////////////////////////
 				int GetMargin()
 				{
 					int ret = 5;
 
-					// WX^̎ʂmF
+					// レジスタの種別を確認
 					if (ConstCategoryI == GetCategory() || ConstCategoryO == GetCategory())
 					{
-						// IAOWX^  f[^^Cvȍ~4WX^ԍƂĎ擾
+						// I、Oレジスタ ⇒ データタイプ以降の4文字をレジスタ番号として取得
 						ret = 4;
 					}
 
@@ -233,27 +233,27 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			AhX擾
-				/// @return			AhX
+				/// @brief			アドレスを取得
+				/// @return			アドレス
 				////////////////////////////////////////////////////////////////////////////////
 				std::string GetAddress()
 				{
 					std::stringstream ret;
 					int margin;
 
-					// ʂ擾
+					// 種別を取得
 					ret << GetCategory();
-					// f[^̃^Cv擾
+					// データのタイプを取得
 					ret << GetType();
-					// f[^̌擾
+					// データの桁数を取得
 					margin = GetMargin();
-					// f[^̃^CvmF
+					// データのタイプを確認
 					if (ConstTypeBit == GetType())
 					{
-						// rbg^  rbǧǉ
+						// ビット型 ⇒ ビットの桁を追加
 						margin += 1;
 					}
-					// ԍm
+					// 番号を確定
 					ret << Text::FormatX(margin, Index, "");
 
 					return ret.str();
@@ -261,8 +261,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CSpecify& object)
 				{
@@ -271,11 +271,11 @@ namespace Standard
 				}
 
 			private:
-				//! 
+				//! 種別
 				std::string _category;
 
 			public:
-				//! ԍ
+				//! 番号
 				unsigned long Index;
 			};
 		}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "WrapperMotionApi/Result.h"
 
 namespace Standard
@@ -12,13 +14,13 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CInitialize
-				/// @brief      Rg[ʃNX
+				/// @brief      コントローラを初期化した結果クラス
 				////////////////////////////////////////////////////////////////////////////////
 				class CInitialize
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CInitialize()
 					{
@@ -26,19 +28,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CInitialize& operator = (const CInitialize& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CInitialize()
 					{
@@ -47,8 +49,8 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CInitialize& object)
 					{
@@ -56,7 +58,7 @@ namespace Standard
 					}
 
 				public:
-					//! Rg[JʃNX
+					//! コントローラを開いた結果クラス
 					MotionApi::Controller::Result::COpen Controller;
 				};
 			}
@@ -68,13 +70,13 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CContent
-				/// @brief      WX^̒lNX
+				/// @brief      レジスタの値クラス
 				////////////////////////////////////////////////////////////////////////////////
 				class CContent
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CContent()
 					{
@@ -82,19 +84,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CContent& operator = (const CContent& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CContent()
 					{
@@ -103,28 +105,25 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CContent& object)
 					{
-						this->Bits.clear();
-						this->Bits.insert(object.Bits.begin(), object.Bits.end());
-						this->Words.clear();
-						this->Words.insert(object.Words.begin(), object.Words.end());
-						this->Longs.clear();
-						this->Longs.insert(object.Longs.begin(), object.Longs.end());
+						this->Bits = object.Bits;
+						this->Words = object.Words;
+						this->Longs = object.Longs;
 					}
 
 				public:
-					//! rbg^̃f[^
-					std::map<unsigned long, short> Bits;
+					//! ビット型のデータ ※番号は先頭からのビット数
+					std::vector<short> Bits;
 
-					//! [h^̃f[^
-					std::map<unsigned long, short> Words;
+					//! ワード型のデータ ※番号は先頭からのワード数
+					std::vector<short> Words;
 
-					//! O^̃f[^
-					std::map<unsigned long, long> Longs;
+					//! ロング型のデータ ※番号は先頭からのワード数の1/2
+					std::vector<long> Longs;
 				};
 			}
 		}
@@ -135,13 +134,13 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CInitialize
-				/// @brief      ʃNX
+				/// @brief      軸を初期化した結果クラス
 				////////////////////////////////////////////////////////////////////////////////
 				class CInitialize
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CInitialize()
 					{
@@ -149,19 +148,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CInitialize& operator = (const CInitialize& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CInitialize()
 					{
@@ -170,8 +169,8 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CInitialize& object)
 					{
@@ -179,7 +178,7 @@ namespace Standard
 					}
 
 				public:
-					//! ̃nh쐬ʃNX
+					//! 軸のハンドルを作成した結果クラス
 					MotionApi::Axis::Result::CDeclare Axis;
 				};
 			}
@@ -191,13 +190,13 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CInitialize
-				/// @brief      foCXʃNX
+				/// @brief      デバイスを初期化した結果クラス
 				////////////////////////////////////////////////////////////////////////////////
 				class CInitialize
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CInitialize()
 					{
@@ -205,19 +204,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CInitialize& operator = (const CInitialize& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CInitialize()
 					{
@@ -226,8 +225,8 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CInitialize& object)
 					{
@@ -235,7 +234,7 @@ namespace Standard
 					}
 
 				public:
-					//! foCX̃nh쐬ʃNX
+					//! デバイスのハンドルを作成した結果クラス
 					MotionApi::Device::Result::CDeclare Device;
 				};
 			}
@@ -6,13 +6,13 @@ namespace Standard
 	{
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CTemplate
-		/// @brief      ݒ肷ev[g̃NX
+		/// @brief      設定するテンプレートのクラス
 		////////////////////////////////////////////////////////////////////////////////
 		class CTemplate
 		{
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CTemplate()
 			{
@@ -20,19 +20,19 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			Rs[Zq
-			/// @return			NX
+			/// @brief			コピー代入演算子
+			/// @return			自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			CTemplate& operator = (const CTemplate& object) noexcept
 			{
-				// XV
+				// 更新
 				Update(object);
 
 				return *this;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			virtual ~CTemplate()
 			{
@@ -41,8 +41,8 @@ namespace Standard
 
 		protected:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			NXXV
-			/// @param[in]		object	NX
+			/// @brief			自クラスを更新
+			/// @param[in]		object	自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			void Update(const CTemplate& object)
 			{
@@ -50,7 +50,7 @@ namespace Standard
 			}
 
 		public:
-			//! @̖O
+			//! 機器の名前
 			std::string Name;
 		};
 	}
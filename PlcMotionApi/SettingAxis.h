@@ -13,15 +13,15 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CInitialize
-				/// @brief      ݒNX
-				///				 ݒ肷ev[g̃NXh
+				/// @brief      軸を初期化する設定クラス
+				///				⇒ 設定するテンプレートのクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CInitialize
 					: virtual public CTemplate
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CInitialize() : CTemplate()
 					{
@@ -29,19 +29,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CInitialize& operator = (const CInitialize& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CInitialize()
 					{
@@ -50,33 +50,33 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CInitialize& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 
 						this->Declare = object.Declare;
 					}
 
 				public:
-					//! ̃nh쐬ݒNX
+					//! 軸のハンドルを作成する設定クラス
 					MotionApi::Axis::Setting::CDeclare Declare;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CDestroy
-				/// @brief      jݒNX
-				///				 ݒ肷ev[g̃NXh
+				/// @brief      軸を破棄する設定クラス
+				///				⇒ 設定するテンプレートのクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CDestroy
 					: virtual public CTemplate
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CDestroy() : CTemplate()
 					{
@@ -84,19 +84,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CDestroy& operator = (const CDestroy& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CDestroy()
 					{
@@ -105,12 +105,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CDestroy& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 					}
 				};
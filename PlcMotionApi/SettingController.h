@@ -13,15 +13,15 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CInitialize
-				/// @brief      Rg[ݒNX
-				///				 ݒ肷ev[g̃NXh
+				/// @brief      コントローラを初期化する設定クラス
+				///				⇒ 設定するテンプレートのクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CInitialize
 					: virtual public CTemplate
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CInitialize() : CTemplate()
 					{
@@ -29,19 +29,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CInitialize& operator = (const CInitialize& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CInitialize()
 					{
@@ -50,12 +50,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CInitialize& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 
 						this->Open = object.Open;
@@ -63,24 +63,24 @@ namespace Standard
 					}
 
 				public:
-					//! Rg[Jݒ̃NX
+					//! コントローラを開く設定のクラス
 					MotionApi::Controller::Setting::COpen Open;
 
-					//! Api^CAEg̐ݒNX
+					//! Apiタイムアウトの設定クラス
 					MotionApi::Controller::Setting::CApiTimeout ApiTimeout;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CDestroy
-				/// @brief      Rg[jݒNX
-				///				 ݒ肷ev[g̃NXh
+				/// @brief      コントローラを破棄する設定クラス
+				///				⇒ 設定するテンプレートのクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CDestroy
 					: virtual public CTemplate
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CDestroy() : CTemplate()
 					{
@@ -88,19 +88,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CDestroy& operator = (const CDestroy& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CDestroy()
 					{
@@ -109,19 +109,19 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CDestroy& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 
 						this->Close = object.Close;
 					}
 
 				public:
-					//! Rg[ݒ̃NX
+					//! コントローラを閉じる設定のクラス
 					MotionApi::Controller::Setting::CClose Close;
 				};
 			}
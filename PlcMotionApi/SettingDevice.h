@@ -13,16 +13,16 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CSuspend
-				/// @brief      ~ݒNX
-				///				 ݒ肷ev[g̃NXh
-				///				 ̒~ݒ肷NXh
+				/// @brief      制御を停止する設定クラス
+				///				⇒ 設定するテンプレートのクラスから派生
+				///				⇒ 制御の停止を設定するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CSuspend
 					: virtual public CTemplate, virtual public MotionApi::Device::Setting::CSuspend
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CSuspend() : CTemplate(), MotionApi::Device::Setting::CSuspend()
 					{
@@ -30,19 +30,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CSuspend& operator = (const CSuspend& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CSuspend()
 					{
@@ -51,12 +51,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CSuspend& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 						MotionApi::Device::Setting::CSuspend::Update(object);
 
@@ -64,22 +64,22 @@ namespace Standard
 					}
 
 				public:
-					//! ^CAEg[ms]
+					//! タイムアウト[ms]
 					unsigned short Timeout;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CServo
-				/// @brief      T[{𐧌䂷ݒNX
-				///				 ݒ肷ev[g̃NXh
-				///				 T[{̐sݒNXh
+				/// @brief      サーボを制御する設定クラス
+				///				⇒ 設定するテンプレートのクラスから派生
+				///				⇒ サーボの制御を行う設定クラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CServo
 					: virtual public CTemplate, virtual public MotionApi::Device::Setting::CServo
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CServo() : CTemplate(), MotionApi::Device::Setting::CServo()
 					{
@@ -87,19 +87,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CServo& operator = (const CServo& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CServo()
 					{
@@ -108,12 +108,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CServo& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 						MotionApi::Device::Setting::CServo::Update(object);
 					}
@@ -121,16 +121,16 @@ namespace Standard
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CMoveOrigin
-				/// @brief      _AsݒNX
-				///				 ݒ肷ev[g̃NXh
-				///				 _AsݒNXh
+				/// @brief      原点復帰を実行する設定クラス
+				///				⇒ 設定するテンプレートのクラスから派生
+				///				⇒ 原点復帰を実行する設定クラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CMoveOrigin
 					: virtual public CTemplate, virtual public MotionApi::Device::Setting::CMoveOrigin
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CMoveOrigin() : CTemplate(), MotionApi::Device::Setting::CMoveOrigin()
 					{
@@ -138,19 +138,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CMoveOrigin& operator = (const CMoveOrigin& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CMoveOrigin()
 					{
@@ -159,12 +159,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CMoveOrigin& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 						MotionApi::Device::Setting::CMoveOrigin::Update(object);
 					}
@@ -172,16 +172,16 @@ namespace Standard
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CStartJog
-				/// @brief      WOJnݒNX
-				///				 ݒ肷ev[g̃NXh
-				///				 WO̊Jnݒ肷NXh
+				/// @brief      ジョグを開始する設定クラス
+				///				⇒ 設定するテンプレートのクラスから派生
+				///				⇒ ジョグの開始を設定するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CStartJog
 					: virtual public CTemplate, virtual public MotionApi::Device::Setting::CStartJog
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CStartJog() : CTemplate(), MotionApi::Device::Setting::CStartJog()
 					{
@@ -189,19 +189,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CStartJog& operator = (const CStartJog& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CStartJog()
 					{
@@ -210,12 +210,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CStartJog& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 						MotionApi::Device::Setting::CStartJog::Update(object);
 					}
@@ -223,16 +223,16 @@ namespace Standard
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CStopJog
-				/// @brief      WO~ݒNX
-				///				 ݒ肷ev[g̃NXh
-				///				 WO̒~ݒ肷NXh
+				/// @brief      ジョグを停止する設定クラス
+				///				⇒ 設定するテンプレートのクラスから派生
+				///				⇒ ジョグの停止を設定するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CStopJog
 					: virtual public CTemplate, virtual public MotionApi::Device::Setting::CStopJog
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CStopJog() : CTemplate(), MotionApi::Device::Setting::CStopJog()
 					{
@@ -240,19 +240,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CStopJog& operator = (const CStopJog& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CStopJog()
 					{
@@ -261,12 +261,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CStopJog& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 						MotionApi::Device::Setting::CStopJog::Update(object);
 					}
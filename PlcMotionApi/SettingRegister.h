@@ -12,15 +12,15 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CTemplate
-				/// @brief      WX^ݒ肷ev[g̃NX
-				///				 ݒ肷ev[g̃NXp
+				/// @brief      レジスタを設定するテンプレートのクラス
+				///				⇒ 設定するテンプレートのクラスから継承
 				////////////////////////////////////////////////////////////////////////////////
 				class CTemplate
 					: virtual public Plc::CTemplate
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CTemplate() : Plc::CTemplate()
 					{
@@ -29,19 +29,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CTemplate& operator = (const CTemplate& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					virtual ~CTemplate()
 					{
@@ -50,12 +50,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CTemplate& object)
 					{
-						// ̊֐
+						// 既定の関数
 						Plc::CTemplate::Update(object);
 
 						this->Declare = object.Declare;
@@ -64,27 +64,27 @@ namespace Standard
 					}
 
 				public:
-					//! WX^̃nh쐬ݒNX
+					//! レジスタのハンドルを作成する設定クラス
 					MotionApi::Register::Setting::CDeclare Declare;
 
-					//! 
+					//! 種別
 					std::string Category;
 
-					//! ԍ
+					//! 番号
 					unsigned long Index;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CGetContent
-				/// @brief      WX^̒l擾ݒNX
-				///				 WX^ݒ肷ev[g̃NXp
+				/// @brief      レジスタの値を取得する設定クラス
+				///				⇒ レジスタを設定するテンプレートのクラスから継承
 				////////////////////////////////////////////////////////////////////////////////
 				class CGetContent
 					: virtual public CTemplate
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CGetContent() : CTemplate()
 					{
@@ -92,19 +92,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CGetContent& operator = (const CGetContent& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CGetContent()
 					{
@@ -113,33 +113,33 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CGetContent& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 
 						this->Size = object.Size;
 					}
 
 				public:
-					//! WX^ǂݍރTCY
+					//! レジスタを読み込むサイズ
 					unsigned long Size;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CSetContent
-				/// @brief      WX^̒lXVݒNX
-				///				 WX^ݒ肷ev[g̃NXp
+				/// @brief      レジスタの値を更新する設定クラス
+				///				⇒ レジスタを設定するテンプレートのクラスから継承
 				////////////////////////////////////////////////////////////////////////////////
 				class CSetContent
 					: virtual public CTemplate
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CSetContent() : CTemplate()
 					{
@@ -147,19 +147,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CSetContent& operator = (const CSetContent& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CSetContent()
 					{
@@ -168,12 +168,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CSetContent& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CTemplate::Update(object);
 
 						this->Values.clear();
@@ -181,7 +181,7 @@ namespace Standard
 					}
 
 				public:
-					//! l
+					//! 値
 					std::vector<short> Values;
 				};
 			}
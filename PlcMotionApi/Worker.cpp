@@ -13,7 +13,7 @@ namespace Standard
 	namespace Plc
 	{
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			RXgN^
+		/// @brief			コンストラクタ
 		////////////////////////////////////////////////////////////////////////////////
 		CWorker::CWorker() : Worker::CTemplate()
 		{
@@ -21,7 +21,7 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			fXgN^
+		/// @brief			デストラクタ
 		////////////////////////////////////////////////////////////////////////////////
 		CWorker::~CWorker()
 		{
@@ -29,10 +29,10 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			
-		/// @detail			̃^C~OŌĂяo
-		///					Apĩ^CAEgȂǂݒ肷
-		///					p֐
+		/// @brief			初期化
+		/// @detail			初期化のタイミングで呼び出される
+		///					※Apiのタイムアウトなどを設定する
+		///					★継承した関数
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::InitializeDerived()
 		{
@@ -46,42 +46,42 @@ namespace Standard
 
 			try
 			{
-				// ftHgȐݒNX擾
+				// デフォルトな設定クラスを取得
 				Setting::CDefault defaultSetting = GetDefaultSetting();
 
-				// Apĩ^CAEg擾
+				// Apiのタイムアウトを取得
 				boost::any buffer = defaultSetting.Other.GetValue<EnumParameter>(ParameterApiTimeout);
 
-				// Apĩ^CAEgLmF
+				// Apiのタイムアウトが有効か確認
 				if (Variant::IsValue<std::string>(buffer))
 				{
-					// Api^CAEg̐ݒ
+					// Apiタイムアウトの設定
 					MotionApi::Controller::Setting::CApiTimeout apiTimeout;
 
-					// Apĩ^CAEg擾
+					// Apiのタイムアウトを取得
 					apiTimeout.Input(Variant::Convert<std::string>(buffer));
 
-					// Apĩ^CAEgݒ
+					// Apiのタイムアウトを設定
 					postscript << "MotionApi::SetApiTimeout(" << apiTimeout.Value << ")";
 					MotionApi::SetApiTimeout(apiTimeout);
 				}
 
-				// Oo
+				// ログ出力
 				postscript << Logging::ConstSeparator << stopWatch.Format(true);
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			j
-		/// @detail			j̃^C~OŌĂяo
-		///					p֐
+		/// @brief			破棄
+		/// @detail			破棄のタイミングで呼び出される
+		///					★継承した関数
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::DestroyDerived()
 		{
@@ -95,25 +95,25 @@ namespace Standard
 
 			try
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// Oo
+				// ログ出力
 				postscript << Logging::ConstSeparator << stopWatch.Format(true);
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ڑ
-		/// @detail			ڑ̃^C~OŌĂяo
-		///					p֐
+		/// @brief			接続
+		/// @detail			接続のタイミングで呼び出される
+		///					★継承した関数
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::ConnectDerived()
 		{
@@ -127,28 +127,28 @@ namespace Standard
 
 			try
 			{
-				// ڑݒNX擾
+				// 接続設定クラスを取得
 				Setting::CConnect connectSetting = GetConnectSetting();
 
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// Oo
+				// ログ出力
 				postscript << Logging::ConstSeparator << stopWatch.Format(true);
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ؒf
-		/// @detail			ؒf̃^C~OŌĂяo
-		///					p֐
+		/// @brief			切断
+		/// @detail			切断のタイミングで呼び出される
+		///					★継承した関数
 		////////////////////////////////////////////////////////////////////////////////
 		void CWorker::DisconnectDerived()
 		{
@@ -162,26 +162,26 @@ namespace Standard
 
 			try
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// Oo
+				// ログ出力
 				postscript << Logging::ConstSeparator << stopWatch.Format(true);
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			ڑ̏Ԃ擾
-		///	@detail			ڑ̏Ԃ擾^C~OŌĂяo
-		///					p֐
-		/// @return			true:ڑς / false:ڑ
+		/// @brief			接続の状態を取得
+		///	@detail			接続の状態を取得するタイミングで呼び出される
+		///					★継承した関数
+		/// @return			true:接続済み / false:未接続
 		////////////////////////////////////////////////////////////////////////////////
 		bool CWorker::GetConnected()
 		{
@@ -196,16 +196,16 @@ namespace Standard
 
 			try
 			{
-				// r
+				// 排他制御
 				std::lock_guard<std::recursive_mutex> lock(m_asyncLibrary);
 
-				// Oo
+				// ログ出力
 				Transfer::Output(Logging::Join(logging, postscript.str()));
 				postscript.str("");
 			}
 			catch (const std::exception& e)
 			{
-				// Ȍ  OʒmC
+				// 例外の処理 ⇒ 例外を通知＆発砲
 				throw OutputException(errorCode, deviceErrorCode, logging, postscript.str(), e);
 			}
 
@@ -8,37 +8,37 @@ namespace Standard
 	{
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CWorker
-		/// @brief      PLC̐sNX
-		///				 PLC̐sev[g̃NXp
+		/// @brief      PLCの制御を行うクラス
+		///				⇒ PLCの制御を行うテンプレートのクラスから継承
 		////////////////////////////////////////////////////////////////////////////////
 		class CWorker
 			: virtual public Worker::CTemplate
 		{
 		public:
-			// RXgN^
+			// コンストラクタ
 			CWorker();
 
-			// fXgN^
+			// デストラクタ
 			~CWorker() override;
 
 		protected:
-			// 
+			// 初期化
 			void InitializeDerived() override;
 
-			// j
+			// 破棄
 			void DestroyDerived() override;
 
-			// ڑ
+			// 接続
 			void ConnectDerived() override;
 
-			// ؒf
+			// 切断
 			void DisconnectDerived() override;
 
-			// ڑ̏Ԃ擾
+			// 接続の状態を取得
 			bool GetConnected() override;
 
 		private:
-			//! rNX(Cup)
+			//! 排他制御クラス(ライブラリ用)
 			std::recursive_mutex m_asyncLibrary;
 		};
 	}
@@ -451,6 +451,19 @@ void CSampleMfcDlg::OnDestroy()
 		MessageBox(NULL, Text::Convert(std::regex_replace(message.str(), std::regex("\t"), "\r\n")).c_str());
 	}
 
+	try
+	{
+		// 推論を破棄
+		Onnx::Destroy();
+	}
+	catch (const std::exception& e)
+	{
+		std::stringstream message;
+
+		message << e.what();
+		MessageBox(NULL, Text::Convert(std::regex_replace(message.str(), std::regex("\t"), "\r\n")).c_str());
+	}
+
 	try
 	{
 		// カメラを破棄
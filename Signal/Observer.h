@@ -8,13 +8,13 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CSetting
-			/// @brief      M̎Mҋ@ݒNX
+			/// @brief      信号の受信を待機する設定クラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CSetting
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CSetting()
 				{
@@ -22,19 +22,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CSetting& operator = (const CSetting& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CSetting()
 				{
@@ -43,8 +43,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CSetting& object)
 				{
@@ -52,21 +52,21 @@ namespace Standard
 				}
 
 			public:
-				//! ^CAEg[ms]
+				//! タイムアウト[ms]
 				int Timeout;
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CObserver
-			/// @brief      M̎Mҋ@ev[g̃NX
-			/// @param[in]	CArgument	M̃NX(ev[gŎw)
+			/// @brief      信号の受信を待機するテンプレートのクラス
+			/// @param[in]	CArgument	受信する情報のクラス(テンプレートで指定)
 			////////////////////////////////////////////////////////////////////////////////
 			template <typename CArgument>
 			class CTemplate
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate()
 				{
@@ -74,18 +74,18 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
+				/// @brief			コピー代入演算子
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate& operator = (const CTemplate& object)
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CTemplate()
 				{
@@ -94,38 +94,38 @@ namespace Standard
 
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ʒmĂяo
-				/// @param[in]		object	Mf[^̃NX
+				/// @brief			通知を呼び出される
+				/// @param[in]		object	受信データのクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void OnCalled(const CArgument& object) noexcept
 				{
 					try
 					{
-						// Mf[^̃NXXV
+						// 受信データのクラスを更新
 						SetArgument(object);
 
-						// Mf[^̏
+						// 受信データの処理
 						ReceiveDerived(object);
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  ÕNXXV
+						// 例外の処理 ⇒ 例外のクラスを更新
 						SetException(Exception::CodeUnknown, e.what());
 					}
 
-					// CxgN
+					// イベント発生を起床
 					m_occurrence.notify_one();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Mf[^̃NX擾
-				/// @return			Mf[^̃NX
+				/// @brief			受信データのクラスを取得
+				/// @return			受信データのクラス
 				////////////////////////////////////////////////////////////////////////////////
 				CArgument GetArgument()
 				{
 					CArgument ret;
 
-					// r
+					// 排他制御
 					std::unique_lock<std::mutex> lock(m_asyncArgument);
 
 					ret = m_argument;
@@ -134,44 +134,44 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Ăяo҂
+				/// @brief			呼び出され待ち
 				////////////////////////////////////////////////////////////////////////////////
 				void Wait() throw(...)
 				{
 					CSetting setting = Setting;
 
-					// r
+					// 排他制御
 					std::unique_lock<std::mutex> lock(m_asyncOccurrence);
 
-					// ^CAEǵmF
+					// タイムアウトの∞を確認
 					if (setting.Timeout < 0)
 					{
-						// ^CAEgȂ  Cxg҂
+						// タイムアウトなし ⇒ イベント発生待ち
 						m_occurrence.wait(lock);
 					}
 					else
 					{
-						// ^CAEg  Cxg҂
+						// タイムアウトあり ⇒ イベント発生待ち
 						if (m_occurrence.wait_for(lock, std::chrono::milliseconds(setting.Timeout)) == std::cv_status::timeout)
 						{
 							std::stringstream postscript;
 
-							postscript << "^CAEg:" << setting.Timeout << "[ms]";
+							postscript << "タイムアウト:" << setting.Timeout << "[ms]";
 
-							// O𔭖C
+							// 例外を発砲
 							throw std::exception(postscript.str().c_str());
 						}
 
-						// ÕNX
+						// 例外のクラス
 						Exception::CObject exception;
 
-						// ÕNX擾
+						// 例外のクラスを取得
 						exception = GetException();
 
-						// OmF
+						// 例外が発生したか確認
 						if (exception.ErrorCode != Exception::CodeSuccess)
 						{
-							// O𔭖C
+							// 例外を発砲
 							throw std::exception(exception.Message.c_str());
 						}
 					}
@@ -179,8 +179,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CTemplate& object)
 				{
@@ -188,9 +188,9 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Mf[^̏
-				/// @detail			hŋLq
-				/// @param[in]		object	Mf[^̃NX
+				/// @brief			受信データの処理
+				/// @detail			★派生先で記述
+				/// @param[in]		object	受信データのクラス
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void ReceiveDerived(const CArgument& object)
 				{
@@ -199,13 +199,13 @@ namespace Standard
 
 			private:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ÕNXXV
-				/// @param[in]		code	OR[h
-				/// @param[in]		message	bZ[W
+				/// @brief			例外のクラスを更新
+				/// @param[in]		code	例外コード
+				/// @param[in]		message	メッセージ
 				////////////////////////////////////////////////////////////////////////////////
 				void SetException(Exception::EnumCode code, const std::string& message)
 				{
-					// r
+					// 排他制御
 					std::unique_lock<std::mutex> lock(m_asyncException);
 
 					m_exception.ErrorCode = code;
@@ -213,14 +213,14 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ÕNX擾
-				/// @return			ÕNX
+				/// @brief			例外のクラスを取得
+				/// @return			例外のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				Exception::CObject GetException()
 				{
 					Exception::CObject ret;
 
-					// r
+					// 排他制御
 					std::unique_lock<std::mutex> lock(m_asyncException);
 
 					ret = m_exception;
@@ -229,38 +229,38 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Mf[^̃NXXV
-				/// @param[in]		object	Mf[^̃NX
+				/// @brief			受信データのクラスを更新
+				/// @param[in]		object	受信データのクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void SetArgument(const CArgument& object)
 				{
-					// r
+					// 排他制御
 					std::unique_lock<std::mutex> lock(m_asyncArgument);
 
 					m_argument = object;
 				}
 
 			public:
-				//! M̎Mҋ@ݒNX
+				//! 信号の受信を待機する設定クラス
 				CSetting Setting;
 
 			private:
-				//! rNX(ÕNXp)
+				//! 排他制御クラス(例外のクラス用)
 				std::mutex m_asyncException;
 
-				//! ÕNX
+				//! 例外のクラス
 				Exception::CObject m_exception;
 
-				//! rNX(VOip)
+				//! 排他制御クラス(シグナル発生用)
 				std::mutex m_asyncOccurrence;
 
-				//! Cxg
+				//! イベント発生
 				std::condition_variable m_occurrence;
 
-				//! rNX(Mf[^̃NXp)
+				//! 排他制御クラス(受信データのクラス用)
 				std::mutex m_asyncArgument;
 
-				//! Mf[^̃NX
+				//! 受信データのクラス
 				CArgument m_argument;
 			};
 		}
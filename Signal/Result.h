@@ -8,13 +8,13 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CTemplate
-			/// @brief      ԂĎʂێev[g̃NX
+			/// @brief      状態を監視した結果を保持するテンプレートのクラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CTemplate
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate()
 				{
@@ -23,19 +23,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate& operator = (const CTemplate& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CTemplate()
 				{
@@ -44,8 +44,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CTemplate& object)
 				{
@@ -54,10 +54,10 @@ namespace Standard
 				}
 
 			public:
-				//! ftO
+				//! 中断フラグ
 				bool Suspension;
 
-				//! bZ[W
+				//! メッセージ
 				std::string Message;
 			};
 		}
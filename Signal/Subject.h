@@ -1,8 +1,10 @@
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <mutex>
-
-#include "boost/signals2.hpp"
+#include <string>
+#include <vector>
 
 namespace Standard
 {
@@ -12,18 +14,25 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CTemplate
-			/// @brief      MʒmNX
-			/// @param[in]	CArgument	ʒm̃NX(ev[gŎw)
+			/// @brief      信号を通知するクラス
+			/// @detail		登録した関数の一覧は登録・解除のたびに作り直し、通知は作成済みの一覧を取得した後は排他制御しない
+			///				関数は弱い参照で保持し、通知する時点で有効な関数だけ直接呼び出す
+			///				通知は呼び出したスレッドで行い、複数のスレッドから通知した場合は関数が同時に呼ばれる
+			///				※通知をまとめて1つずつ呼び出さないため、関数の側で排他制御する
+			/// @param[in]	CArgument	通知する情報のクラス(テンプレートで指定)
 			////////////////////////////////////////////////////////////////////////////////
 			template <typename CArgument>
 			class CTemplate
 			{
 			public:
-				//! ʒm֐̒`
+				//! 通知する関数の定義
 				typedef void(OnCall)(const CArgument&);
 
+				//! 通知する関数の一覧の定義
+				typedef std::vector<std::weak_ptr<std::function<OnCall>>> CFunctions;
+
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate()
 				{
@@ -31,103 +40,206 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
+				/// @brief			コピーコンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CTemplate(const CTemplate& object)
+				{
+					// 更新
+					Update(object);
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コピー代入演算子
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate& operator = (const CTemplate& object)
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CTemplate()
 				{
-					// ʒm֐̉
+					// 通知をする関数の解除
 					CancellationFunction();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ʒm֐̓o^
-				/// @param[in]		object	ʒm֐
+				/// @brief			通知をする関数の登録
+				/// @detail			登録済みの関数は解除して、指定した関数だけにする
+				/// @param[in]		object	通知をする関数
 				////////////////////////////////////////////////////////////////////////////////
 				void RegistrationFunction(std::weak_ptr<std::function<OnCall>> object)
 				{
-					// r
-					std::lock_guard<std::recursive_mutex> lock(m_asyncFunction);
+					std::shared_ptr<const CFunctions> functions = std::make_shared<const CFunctions>(1, object);
+
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_async);
+
+					// 一覧を入れ替え
+					m_functions = functions;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			通知をする関数の追加
+				/// @detail			登録済みの関数に追加する ※無効になった関数は削除
+				/// @param[in]		object	通知をする関数
+				////////////////////////////////////////////////////////////////////////////////
+				void AppendFunction(std::weak_ptr<std::function<OnCall>> object)
+				{
+					std::shared_ptr<CFunctions> functions = std::make_shared<CFunctions>();
+
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_async);
+
+					if (m_functions != nullptr)
+					{
+						// 有効な関数だけ走査
+						for (auto& function : *m_functions)
+						{
+							if (function.expired() == false)
+							{
+								functions->push_back(function);
+							}
+						}
+					}
+
+					functions->push_back(object);
 
-					_Function = object;
+					// 一覧を入れ替え ⇒ 通知中の一覧は変更しない
+					m_functions = functions;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ʒm֐̉
+				/// @brief			通知をする関数の解除
 				////////////////////////////////////////////////////////////////////////////////
 				void CancellationFunction()
 				{
-					// r
-					std::lock_guard<std::recursive_mutex> lock(m_asyncFunction);
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_async);
 
-					_Function.reset();
+					// 一覧を破棄
+					m_functions.reset();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ʒmĂяo
-				/// @param[in]		object	ʒmf[^̃NX
+				/// @brief			通知を呼び出し
+				/// @detail			登録した関数を順番に直接呼び出す
+				///					関数が例外を発砲した場合も残りの関数を呼び出し、最後にまとめて例外を発砲する
+				/// @param[in]		object	通知するデータのクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void CallingFunction(const CArgument& object)
 				{
-					// ֐̃VOi
-					boost::signals2::signal<OnCall> signal;
+					bool called = false;
+					std::string message;
 
-					// r
-					std::lock_guard<std::recursive_mutex> lock(m_asyncFunction);
+					// 作成済みの一覧を取得 ⇒ 通知中に登録・解除されても影響なし
+					std::shared_ptr<const CFunctions> functions = GetFunctions();
 
-					// ֐̃|C^
-					std::shared_ptr<std::function<OnCall>> function = _Function.lock();
-
-					// ֐mF
-					if (function == nullptr)
+					if (functions != nullptr)
 					{
-						// ֐̎ԂȂ
-						throw std::exception("֐̎ԂȂ");
+						// 関数だけ走査
+						for (auto& function : *functions)
+						{
+							// 関数のポインタ
+							std::shared_ptr<std::function<OnCall>> pointer = function.lock();
+
+							if (pointer != nullptr && *pointer)
+							{
+								called = true;
+
+								try
+								{
+									// 呼び出し
+									(*pointer)(object);
+								}
+								catch (const std::exception& e)
+								{
+									// エラーメッセージを統合
+									message += (message.empty() ? "" : "\t") + std::string(e.what());
+								}
+							}
+						}
 					}
 
-					// ֐֐ڑ
-					boost::signals2::connection connection = signal.connect(*function);
+					// 関数を確認
+					if (called == false)
+					{
+						// 関数の実態なし
+						throw std::exception("関数の実態なし");
+					}
 
-					// ڑmF
-					if (connection.connected() == false)
+					// 例外を確認
+					if (message.empty() == false)
 					{
-						// ڑ
-						throw std::exception("֐ڑ");
+						// 例外を発砲
+						throw std::exception(message.c_str());
 					}
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			通知を呼び出し ※静的関数
+				/// @detail			要求ごとに1回だけ通知する関数を、登録せずに直接呼び出す
+				///					登録したまま複数回通知する関数は、クラスに登録してCallingFunction(object)で通知する
+				/// @param[in]		function	通知をする関数
+				/// @param[in]		object	通知するデータのクラス
+				////////////////////////////////////////////////////////////////////////////////
+				static void CallingFunction(const std::weak_ptr<std::function<OnCall>>& function, const CArgument& object)
+				{
+					// 関数のポインタ
+					std::shared_ptr<std::function<OnCall>> pointer = function.lock();
 
-					// Ăяo
-					signal(object);
+					// 関数を確認
+					if (pointer == nullptr || !(*pointer))
+					{
+						// 関数の実態なし
+						throw std::exception("関数の実態なし");
+					}
 
-					// ؒf
-					connection.disconnect();
+					// 呼び出し
+					(*pointer)(object);
 				}
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CTemplate& object)
 				{
-					this->_Function = object._Function;
+					std::shared_ptr<const CFunctions> functions = object.GetFunctions();
+
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_async);
+
+					this->m_functions = functions;
+				}
+
+			private:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			作成済みの一覧を取得
+				/// @detail			参照を複製する間だけ排他制御する
+				///					※std::atomic_load()はMSVCでは全てのshared_ptrで共有するロックを使うため、クラスごとに排他制御
+				/// @return			通知する関数の一覧
+				////////////////////////////////////////////////////////////////////////////////
+				std::shared_ptr<const CFunctions> GetFunctions() const
+				{
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_async);
+
+					return m_functions;
 				}
 
 			private:
-				//! rNX(ʒm֐p)
-				std::recursive_mutex m_asyncFunction;
+				//! 排他制御クラス(一覧の参照・入れ替え用) ⇒ 関数の呼び出し中は排他制御しない
+				mutable std::mutex m_async;
 
-				//! ʒm֐
-				std::weak_ptr<std::function<OnCall>> _Function;
+				//! 通知する関数の一覧 ※作成後は変更しない
+				std::shared_ptr<const CFunctions> m_functions;
 			};
 		}
 	}
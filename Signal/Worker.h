@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 #include "boost/any.hpp"
 
 #include "Thread/Worker.h"
@@ -8,6 +10,7 @@
 #include "Signal/Subject.h"
 #include "Signal/Result.h"
 #include "Common/Utility/StopWatch.h"
+#include "Common/Utility/RingQueue.h"
 
 namespace Standard
 {
@@ -17,15 +20,15 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CInitialize
-			/// @brief      ̌ʃNX
-			///				 ԂĎʂێev[g̃NXp
+			/// @brief      初期化の結果クラス
+			///				⇒ 状態を監視した結果を保持するテンプレートのクラスから継承
 			////////////////////////////////////////////////////////////////////////////////
 			class CInitialize
 				: virtual public Result::CTemplate
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CInitialize() : Result::CTemplate()
 				{
@@ -33,19 +36,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CInitialize& operator = (const CInitialize& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CInitialize()
 				{
@@ -54,8 +57,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CInitialize& object)
 				{
@@ -65,15 +68,15 @@ namespace Standard
 
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CDestroy
-			/// @brief      ǰʃNX
-			///				 ԂĎʂێev[g̃NXp
+			/// @brief      破棄の結果クラス
+			///				⇒ 状態を監視した結果を保持するテンプレートのクラスから継承
 			////////////////////////////////////////////////////////////////////////////////
 			class CDestroy
 				: virtual public Result::CTemplate
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CDestroy() : Result::CTemplate()
 				{
@@ -81,19 +84,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CDestroy& operator = (const CDestroy& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				~CDestroy()
 				{
@@ -102,8 +105,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CDestroy& object)
 				{
@@ -111,23 +114,26 @@ namespace Standard
 				}
 			};
 
-			//! ʒm֐̒`
+			//! 初期化を通知する関数の定義
 			typedef void(OnWakeupInitialize)(const CInitialize&);
 
-			//! jʒm֐̒`
+			//! 破棄を通知する関数の定義
 			typedef void(OnWakeupDestroy)(const CDestroy&);
 		}
 
 		namespace Worker
 		{
+			//! 書き込みを要求できる数の上限
+			const size_t ConstWriteCapacity = 1024;
+
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CTemplate
-			/// @brief      ԂĎA݁Aʒmev[g̃NX
-			///				 Xbh̐sev[g̃NXh
-			///				 O̐sev[g̃NXh
-			/// @param[in]	CSetting	ԂĎAʒmݒNX(ev[gŎw)
-			/// @param[in]	CArgument	ʒm̃NX(ev[gŎw)
-			/// @param[in]	CWrite	ޏ̃NX(ev[gŎw)
+			/// @brief      状態を監視、書き込み、通知するテンプレートのクラス
+			///				⇒ スレッドの制御を行うテンプレートのクラスから派生
+			///				⇒ 例外の制御を行うテンプレートのクラスから派生
+			/// @param[in]	CSetting	状態を監視、通知する設定クラス(テンプレートで指定)
+			/// @param[in]	CArgument	通知する情報のクラス(テンプレートで指定)
+			/// @param[in]	CWrite	書き込む情報のクラス(テンプレートで指定)
 			////////////////////////////////////////////////////////////////////////////////
 			template <typename CSetting, typename CArgument, typename CWrite>
 			class CTemplate
@@ -135,322 +141,496 @@ namespace Standard
 			{
 			private:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @enum			̏
+				/// @enum			処理の順序
 				////////////////////////////////////////////////////////////////////////////////
 				enum EnumOrder
 				{
-					OrderWait,			// ҋ@
-					OrderInitialize,	// 
-					OrderDestroy,		// j
-					OrderRetry,			// gC
-					OrderRead,			// ǂݍ
-					OrderWrite			// 
+					OrderWait,			// 待機
+					OrderInitialize,	// 初期化
+					OrderDestroy,		// 破棄
+					OrderRetry,			// リトライ
+					OrderRead,			// 読み込み
+					OrderWrite			// 書き込み
 				};
 
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
-				CTemplate() : Thread::Worker::CTemplate(), Exception::Worker::CTemplate()
+				CTemplate() : Thread::Worker::CTemplate(), Exception::Worker::CTemplate(), m_requestWrites(ConstWriteCapacity)
 				{
 					m_order = OrderWait;
 					m_requestInitialize = false;
 					m_requestDestroy = false;
 					m_retry = 0;
+					m_cycleIdle = 0;
+					m_cycleHold = 0;
+					m_cycleRead = 0;
+					m_active = 0;
+					m_snapshot = false;
+					m_counterRead = nullptr;
 
 					std::string name;
 
-					// ̂XV
+					// 名称を更新
 					name = "Signal::";
 					SetNameException(name + "Exception::");
 					SetNameArgument(name + "Notice::");
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CTemplate()
 				{
-					// ʒm֐
+					// 通知する関数を解除
 					DetachFunctionCalled();
 				}
 
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ʒm̖̂XV
-				/// @param[in]		name	ʒm̖
+				/// @brief			通知の名称を更新
+				/// @param[in]		name	通知の名称
 				////////////////////////////////////////////////////////////////////////////////
 				void SetNameArgument(const std::string& name)
 				{
-					// ̂XV
+					// 名称を更新
 					m_noticeArgument.SetName(name);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Ԃ̒ʒmJn
-				/// @detail			ʒm֐o^OɌĂяo
-				/// @param[in]		cycle	Ԃ̒ʒmĎԊu[ms]
+				/// @brief			状態の通知を開始
+				/// @detail			通知する関数を登録する前に呼び出す
+				/// @param[in]		cycle	状態の通知を監視する間隔[ms]
 				////////////////////////////////////////////////////////////////////////////////
 				void StartNotice(int cycle = 60000)
 				{
-					// Ԃ̒ʒmsݒ
+					// 状態の通知を行う周期を設定
 					m_noticeArgument.SetCycle(cycle);
 
-					// Ԃ̒ʒmJn
+					// 状態の通知も共有のスレッドプールで実行するかを合わせる
+					m_noticeArgument.SetExecutor(GetExecutor());
+
+					// 状態の通知を開始
 					m_noticeArgument.Start();
 
-					// Ԃ̒ʒmŏv
+					// 状態の通知で初期化を要求
 					m_noticeArgument.RequestInitialize();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Ԃ̒ʒm~
-				/// @detail			ʒm֐ɌĂяo
+				/// @brief			状態の通知を停止
+				/// @detail			通知する関数を解除後に呼び出す
 				////////////////////////////////////////////////////////////////////////////////
 				void StopNotice()
 				{
-					// Ԃ̒ʒmŔjv
+					// 状態の通知で破棄を要求
 					m_noticeArgument.RequestDestroy();
 
-					// Ԃ̒ʒm~
+					// 状態の通知を停止
 					m_noticeArgument.Stop();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ʒm֐̓o^
-				/// @detail			ʒmɌĂяoꂽ֐w肷
-				/// @param[in]		object	Ăяoꂽ֐
+				/// @brief			通知する関数の登録
+				/// @detail			通知時に呼び出されたい関数を指定する
+				/// @param[in]		object	呼び出されたい関数
 				////////////////////////////////////////////////////////////////////////////////
 				void AttachFunctionCalled(std::function<void(const CArgument&)> object)
 				{
-					// Ԃ̒ʒmJn
+					// 状態の通知を開始
 					StartNotice();
 
-					// ʒm֐o^
+					// 通知する関数を登録
 					m_noticeArgument.AttachFunctionCalled(object);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ʒm֐̉
-				/// @detail			ʒmɌĂяo֐
+				/// @brief			通知する関数の解除
+				/// @detail			通知時に呼び出される関数を解除する
 				////////////////////////////////////////////////////////////////////////////////
 				void DetachFunctionCalled()
 				{
-					// ʒm֐
+					// 通知する関数を解除
 					m_noticeArgument.DetachFunctionCalled();
 
-					// Ԃ̒ʒm~
+					// 状態の通知を停止
 					StopNotice();
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ݒ̃NX擾
-				/// @return			ݒ̃NX
+				/// @brief			設定のクラスを取得
+				/// @return			設定のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				CSetting GetSetting()
 				{
 					CSetting ret;
 
-					Logging::CObject logging;
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					logging.Message << GetName() << "GetSetting()" << Logging::ConstSeparator;
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncSetting);
 
-						// ݒ̃NX擾
+						// 設定のクラスを取得
 						ret = m_setting;
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O𔭖C
-						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "GetSetting()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
 					}
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ݒ̃NXXV
-				/// @param[in]		object	ݒ̃NX
+				/// @brief			設定のクラスを更新
+				/// @param[in]		object	設定のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void SetSetting(const CSetting& object)
 				{
-					Logging::CObject logging;
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					logging.Message << GetName() << "SetSetting()" << Logging::ConstSeparator;
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncSetting);
 
-						// ݒ̃NXXV
+						// 設定のクラスを更新
 						m_setting = object;
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O𔭖C
-						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "SetSetting()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			v
+				/// @brief			初期化を要求
 				////////////////////////////////////////////////////////////////////////////////
 				void RequestInitialize()
 				{
-					Logging::CObject logging;
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					logging.Message << GetName() << "RequestInitialize()" << Logging::ConstSeparator;
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncRequestInitialize);
 
-						// ̗vݒ
+						// 初期化の要求を設定
 						m_requestInitialize = true;
 
-						// vN
+						// 動作要求を起床
 						WakeupRequestAction();
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O𔭖C
-						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "RequestInitialize()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			jv
+				/// @brief			破棄を要求
 				////////////////////////////////////////////////////////////////////////////////
 				void RequestDestroy()
 				{
-					Logging::CObject logging;
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					logging.Message << GetName() << "RequestDestroy()" << Logging::ConstSeparator;
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncRequestDestroy);
 
-						// j̗vݒ
+						// 破棄の要求を設定
 						m_requestDestroy = true;
 
-						// vN
+						// 動作要求を起床
 						WakeupRequestAction();
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O𔭖C
-						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "RequestDestroy()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			݂v
-				/// @param[in]		object	ޏ̃NX
+				/// @brief			書き込みを要求
+				/// @param[in]		object	書き込む情報のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void RequestWrite(const CWrite& object)
 				{
-					Logging::CObject logging;
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					logging.Message << GetName() << "RequestWrite()" << Logging::ConstSeparator;
-
 					try
 					{
-						// r
-						std::lock_guard<std::recursive_mutex> lock(m_asyncWrite);
-
-						// ޏ̃NXǉ
-						m_writes.push_back(object);
+						// 書き込む情報のクラスを追加
+						// ※読み込みのスレッドと排他せずに追加する
+						if (m_requestWrites.Push(object) == false)
+						{
+							// 登録数の上限
+							throw std::exception("書き込む情報の登録数が上限");
+						}
 
-						// vN
+						// 動作要求を起床
 						WakeupRequestAction();
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O𔭖C
-						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "RequestWrite()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
 					}
 				}
 
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			書き込みを要求した数を取得
+				/// @detail			未処理の数
+				/// @return			書き込みを要求した数
+				////////////////////////////////////////////////////////////////////////////////
+				size_t GetWriteDepth()
+				{
+					size_t ret = 0;
+
+					// 要求を受け付けた数を取得
+					ret = m_requestWrites.GetDepth();
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncWrite);
+
+					// 取り出し済みで未処理の数を加算
+					ret += m_writes.size();
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			書き込みを要求した数の最大値を取得
+				/// @return			書き込みを要求した数の最大値
+				////////////////////////////////////////////////////////////////////////////////
+				size_t GetWriteHighWatermark()
+				{
+					return m_requestWrites.GetHighWatermark();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			上限で受け付けなかった書き込みの要求数を取得
+				/// @return			受け付けなかった書き込みの要求数
+				////////////////////////////////////////////////////////////////////////////////
+				size_t GetWriteRejected()
+				{
+					return m_requestWrites.GetRejected();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			読み込みの周期を可変に設定
+				/// @detail			短い周期はメイン関数の周期で、変化がない間は読み込みごとに2倍して上限まで延ばす
+				/// @param[in]		idle	変化がない間の周期の上限[ms] ※メイン関数の周期以下:周期を固定
+				/// @param[in]		hold	値の変化後に短い周期を続ける時間[ms]
+				////////////////////////////////////////////////////////////////////////////////
+				void SetCycleAdaptive(int idle, int hold)
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncCycleRead);
+
+					m_cycleIdle = idle;
+					m_cycleHold = hold;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			現在の読み込みの周期を取得
+				/// @return			読み込みの周期[ms]
+				////////////////////////////////////////////////////////////////////////////////
+				int GetCycleRead()
+				{
+					int ret = 0;
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncCycleRead);
+
+					ret = m_cycleRead;
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			短い周期の読み込みを要求
+				/// @detail			トリガーの待機を開始する時に呼び出し、CancellationActive()で解除する
+				////////////////////////////////////////////////////////////////////////////////
+				void RegistrationActive()
+				{
+					{
+						// 排他制御
+						std::lock_guard<std::recursive_mutex> lock(m_asyncCycleRead);
+
+						m_active += 1;
+					}
+
+					// 延ばした周期の待機を解除
+					WakeupRequestAction();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			短い周期の読み込みの要求を解除
+				////////////////////////////////////////////////////////////////////////////////
+				void CancellationActive()
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncCycleRead);
+
+					if (0 < m_active)
+					{
+						m_active -= 1;
+					}
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			全ての状態の通知を要求
+				/// @detail			通知の取りこぼしを検出した時に呼び出し、次の読み込みで変化していない状態も通知させる
+				////////////////////////////////////////////////////////////////////////////////
+				void RequestSnapshot()
+				{
+					{
+						// 排他制御
+						std::lock_guard<std::recursive_mutex> lock(m_asyncCycleRead);
+
+						m_snapshot = true;
+					}
+
+					// 延ばした周期の待機を解除
+					WakeupRequestAction();
+				}
+
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Ԃʒm
-				/// @param[in]		object	ÕNX
+				/// @brief			状態を通知
+				/// @param[in]		object	例外のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				void NotifyArgument(const CArgument& object)
 				{
-					// Ԃʒm
-					m_noticeArgument.RequestNotice(object);
+					{
+						// 排他制御
+						std::lock_guard<std::recursive_mutex> lock(m_asyncCycleRead);
+
+						// 変化した時刻を更新 ⇒ 通知は値の変化時だけ
+						m_changed = std::chrono::steady_clock::now();
+					}
+
+					// 状態を通知 ※読み込みのスレッドを止めないように待機しない
+					m_noticeArgument.RequestNotice(object, false);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			gC񐔂
+				/// @brief			短い周期の読み込みが必要か確認
+				///	@detail			※初期値は不要
+				///					★派生先で記述する
+				/// @return			true:必要 / false:不要
+				////////////////////////////////////////////////////////////////////////////////
+				virtual bool IsActive()
+				{
+					bool ret = false;
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			全ての状態の通知が要求されたか確認
+				///	@detail			確認すると要求を解除する
+				///					★派生先の読み込みで呼び出し、要求されたら前回の値を破棄する
+				/// @return			true:要求あり / false:要求なし
+				////////////////////////////////////////////////////////////////////////////////
+				bool IsRequestSnapshot()
+				{
+					bool ret = false;
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncCycleRead);
+
+					ret = m_snapshot;
+					m_snapshot = false;
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			リトライ回数を初期化
 				////////////////////////////////////////////////////////////////////////////////
 				void InitializeRetry()
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncRetry);
 
-					// gC񐔂
+					// リトライ回数を初期化
 					m_retry = 0;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			gC񐔂XV
+				/// @brief			リトライ回数を更新
 				////////////////////////////////////////////////////////////////////////////////
 				void CountupRetry()
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncRetry);
 
-					// gC񐔂XV
+					// リトライ回数を更新
 					m_retry += 1;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			gC񐔂擾
-				/// @return			gC
+				/// @brief			リトライ回数を取得
+				/// @return			リトライ回数
 				////////////////////////////////////////////////////////////////////////////////
 				int GetRetry()
 				{
 					int ret = 0;
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncRetry);
 
-					// gC񐔂擾
+					// リトライ回数を取得
 					ret = m_retry;
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			gCmF
-				///	@detail			l͖
-				///					hŋLq
-				/// @return			true:gCL / false:gC
+				/// @brief			リトライを確認
+				///	@detail			※初期値は無効
+				///					★派生先で記述する
+				/// @return			true:リトライが有効 / false:リトライが無効
 				////////////////////////////////////////////////////////////////////////////////
 				virtual bool IsRetry()
 				{
@@ -460,10 +640,10 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			gC̒xԂ擾
-				///	@detail			l1000ms
-				///					hŋLq
-				/// @return			gC̒x[ms]
+				/// @brief			リトライの遅延時間を取得
+				///	@detail			※初期値は1000ms
+				///					★派生先で記述する
+				/// @return			リトライの遅延時間[ms]
 				////////////////////////////////////////////////////////////////////////////////
 				virtual int GetDelayRetry()
 				{
@@ -473,219 +653,307 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ޏ̃NX擾
-				/// @return			ޏ̃NX
+				/// @brief			書き込む情報のクラス数を取得
+				/// @return			書き込む情報のクラス数
 				////////////////////////////////////////////////////////////////////////////////
 				size_t GetWriteSize()
 				{
 					size_t ret = 0;
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncWrite);
 
-					// ރf[^̃NX擾
+					// 要求を受け付けた書き込む情報のクラスを取り出し
+					m_requestWrites.Drain(m_writes);
+
+					// 書き込むデータのクラス数を取得
 					ret = m_writes.size();
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			݂mF
-				///	@detail			ރf[^̃NX݂邩ȊO͔̔hŋLq
-				///					hŋLq
-				/// @return			true:ރf[^ / false:ރf[^Ȃ
+				/// @brief			書き込む情報のクラスをまとめて取得
+				///	@detail			登録してあるデータを全て移動して取得する
+				///					処理しなかったデータはRestoreWrites()で戻す
+				/// @param[out]		objects	書き込む情報のクラス
+				/// @return			書き込む情報のクラス数
+				////////////////////////////////////////////////////////////////////////////////
+				size_t TakeWrites(std::vector<CWrite>& objects)
+				{
+					size_t ret = 0;
+
+					Exception::EnumCode errorCode = Exception::CodeUnknown;
+					int deviceErrorCode = Exception::DeviceCodeSuccess;
+
+					try
+					{
+						// 排他制御
+						std::lock_guard<std::recursive_mutex> lock(m_asyncWrite);
+
+						// 取り出し済みのデータと入れ替え ⇒ 確保済みの領域は使い回す
+						objects.clear();
+						objects.swap(m_writes);
+
+						// 要求を受け付けた書き込む情報のクラスを取り出し
+						m_requestWrites.Drain(objects);
+
+						ret = objects.size();
+					}
+					catch (const std::exception& e)
+					{
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "TakeWrites()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
+					}
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			書き込む情報のクラスを戻す
+				///	@detail			TakeWrites()で取得して処理しなかったデータを先頭に戻す
+				/// @param[in,out]	objects	書き込む情報のクラス ※戻した後は空になる
+				////////////////////////////////////////////////////////////////////////////////
+				void RestoreWrites(std::vector<CWrite>& objects)
+				{
+					Exception::EnumCode errorCode = Exception::CodeUnknown;
+					int deviceErrorCode = Exception::DeviceCodeSuccess;
+
+					try
+					{
+						// 排他制御
+						std::lock_guard<std::recursive_mutex> lock(m_asyncWrite);
+
+						// 取得した順序を保って先頭に戻す
+						m_writes.insert(m_writes.begin(), std::make_move_iterator(objects.begin()), std::make_move_iterator(objects.end()));
+
+						objects.clear();
+					}
+					catch (const std::exception& e)
+					{
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "RestoreWrites()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
+					}
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			書き込みを確認
+				///	@detail			書き込むデータのクラスが存在するか以外の判定は派生先で記述する
+				///					★派生先で記述する
+				/// @return			true:書き込むデータあり / false:書き込むデータなし
 				////////////////////////////////////////////////////////////////////////////////
 				virtual bool IsWrite()
 				{
 					bool ret = false;
 
-					Logging::CObject logging;
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					logging.Message << GetName() << "IsWrite()" << Logging::ConstSeparator;
-
 					try
 					{
-						// ޏ̃NXmF
+						// 書き込む情報のクラス数を確認
 						if (0 < GetWriteSize())
 						{
-							// ރf[^
+							// 書き込むデータあり
 							ret = true;
 						}
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O𔭖C
-						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "IsWrite()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
 					}
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ޏ̃NX擾
-				/// @param[in]		ޏ̃CfbNXԍ
-				/// @return			ޏ̃NX
+				/// @brief			書き込む情報のクラスを取得
+				/// @param[in]		書き込む情報のインデックス番号
+				/// @return			書き込む情報のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				std::shared_ptr<CWrite> GetWrite(size_t index)
 				{
 					std::shared_ptr<CWrite> ret = nullptr;
 
-					Logging::CObject logging;
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					logging.Message << GetName() << "GetWrite()" << Logging::ConstSeparator;
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncWrite);
 
-						// ރf[^̃NXmF
+						// 要求を受け付けた書き込む情報のクラスを取り出し
+						m_requestWrites.Drain(m_writes);
+
+						// 書き込むデータのクラス数を確認
 						if (m_writes.size() <= index)
 						{
-							// ރf[^Ȃ
+							// 書き込むデータなし
 							std::stringstream message;
-							message << "o^:" << m_writes.size() << Logging::ConstSeparator << "w:" << index;
+							message << "登録数:" << m_writes.size() << Logging::ConstSeparator << "指定:" << index;
 							throw message.str();
 						}
 
-						// ރf[^
+						// 書き込むデータあり
 						ret = std::make_shared<CWrite>(*(m_writes.begin() + index));
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O𔭖C
-						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "GetWrite()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
 					}
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ޏ̃NX폜
-				/// @param[in]		indexs	ޏ̃CfbNXԍ
+				/// @brief			書き込む情報のクラスを削除
+				/// @param[in]		indexs	書き込む情報のインデックス番号
 				////////////////////////////////////////////////////////////////////////////////
 				void PopWrite(const std::vector<size_t>& indexs)
 				{
-					Logging::CObject logging;
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					logging.Message << GetName() << "PopWrite()" << Logging::ConstSeparator;
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncWrite);
 
 						std::vector<size_t> targets;
 
-						// CfbNXԍRs[
+						// インデックス番号をコピー
 						std::copy(indexs.begin(), indexs.end(), std::back_inserter(targets));
 
-						// CfbNXԍ~Ń\[g
+						// インデックス番号を降順でソート
 						std::sort(targets.begin(), targets.end(), std::greater<size_t>());
 
-						// CfbNXԍ𑖍
+						// インデックス番号を走査
 						for (const auto& index : targets)
 						{
-							// ރf[^̃NXmF
+							// 書き込むデータのクラス数を確認
 							if (m_writes.size() <= index)
 							{
-								// ރf[^͈̔͊O
+								// 書き込むデータの範囲外
 								continue;
 							}
 
-							// f[^폜
+							// データを削除
 							m_writes.erase(m_writes.begin() + index);
 						}
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O𔭖C
-						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "PopWrite()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ޏ̃NX擾
-				///	@detail			擪ɓo^Ăf[^擾
-				/// @return			ޏ̃NX
+				/// @brief			書き込む情報のクラスを取得
+				///	@detail			先頭に登録してあるデータを取得する
+				/// @return			書き込む情報のクラス
 				////////////////////////////////////////////////////////////////////////////////
 				std::shared_ptr<CWrite> GetWriteFirst()
 				{
 					std::shared_ptr<CWrite> ret = nullptr;
 
-					Logging::CObject logging;
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					logging.Message << GetName() << "GetWriteFirst()" << Logging::ConstSeparator;
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncWrite);
 
-						// ރf[^̃NXmF
+						// 要求を受け付けた書き込む情報のクラスを取り出し
+						m_requestWrites.Drain(m_writes);
+
+						// 書き込むデータのクラス数を確認
 						if (0 < m_writes.size())
 						{
-							// ރf[^
+							// 書き込むデータあり
 							ret = std::make_shared<CWrite>(m_writes.front());
 						}
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O𔭖C
-						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "GetWriteFirst()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
 					}
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ޏ̃NX폜
-				///	@detail			擪ɓo^Ăf[^폜
+				/// @brief			書き込む情報のクラスを削除
+				///	@detail			先頭に登録してあるデータを削除する
 				////////////////////////////////////////////////////////////////////////////////
 				void PopWriteFirst()
 				{
-					Logging::CObject logging;
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					logging.Message << GetName() << "PopWriteFirst()" << Logging::ConstSeparator;
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncWrite);
 
-						// ރf[^̃NXmF
+						// 書き込むデータのクラス数を確認
 						if (0 < m_writes.size())
 						{
-							// ރf[^  擪̃f[^폜
-							m_writes.pop_front();
+							// 書き込むデータあり ⇒ 先頭のデータを削除
+							m_writes.erase(m_writes.begin());
 						}
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O𔭖C
-						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "PopWriteFirst()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			
-				///	@detail			s^C~OŌĂяo
-				///					hŋLq
+				/// @brief			初期化
+				///	@detail			初期化を行うタイミングで呼び出される
+				///					★派生先で記述する
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void InitializeDerived() throw(...)
 				{
@@ -693,9 +961,9 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			j
-				///	@detail			js^C~OŌĂяo
-				///					hŋLq
+				/// @brief			破棄
+				///	@detail			破棄を行うタイミングで呼び出される
+				///					★派生先で記述する
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void DestroyDerived() throw(...)
 				{
@@ -703,9 +971,9 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			ǂݍ
-				///	@detail			ǂݍ݂s^C~OŌĂяo
-				///					hŋLq
+				/// @brief			読み込み
+				///	@detail			読み込みを行うタイミングで呼び出される
+				///					★派生先で記述する
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void ReadDerived() throw(...)
 				{
@@ -713,9 +981,9 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			
-				///	@detail			݂s^C~OŌĂяo
-				///					hŋLq
+				/// @brief			書き込み
+				///	@detail			書き込みを行うタイミングで呼び出される
+				///					★派生先で記述する
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void WriteDerived() throw(...)
 				{
@@ -723,170 +991,170 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			C֐̏
-				/// @return			^CAEg[ms]
+				/// @brief			メイン関数の処理
+				/// @return			タイムアウト時間[ms]
 				////////////////////////////////////////////////////////////////////////////////
 				int MainAction() override
 				{
 					int ret = 0;
 
-					// ̊֐
+					// 既定の関数
 					ret = Thread::Worker::CTemplate::MainAction();
 
 					try
 					{
-						// ݃tO
+						// 書き込みフラグ
 						bool write = false;
 
 						switch (GetOrder())
 						{
 						case OrderWait:
-							// ҋ@  ̗vmF
+							// 待機 ⇒ 初期化の要求を確認
 							if (IsRequestInitialize())
 							{
-								// ^]XV
+								// 運転中を更新
 								SetRunning(true);
 
-								// ֈڍs
+								// 初期化へ移行
 								SetOrder(OrderInitialize);
 
-								// ^CAEg
+								// タイムアウトを初期化
 								ret = 0;
 								break;
 							}
 
-							// j̗vmF
+							// 破棄の要求を確認
 							if (IsRequestDestroy())
 							{
-								// ^]XV
+								// 運転中を更新
 								SetRunning(true);
 
-								// ~v  jֈڍs
+								// 停止要求 ⇒ 破棄へ移行
 								SetOrder(OrderDestroy);
 
-								// ^CAEg
+								// タイムアウトを初期化
 								ret = 0;
 								break;
 							}
 
-							// ^]
+							// 運転中を解除
 							SetRunning(false);
 							break;
 
 						case OrderInitialize:
-							// 
+							// 初期化
 							InitializeDerived();
 
-							// j̗v
+							// 破棄の要求を解除
 							ReleaseDestroy();
 
-							// ǂݍ݂ֈڍs
+							// 読み込みへ移行
 							SetOrder(OrderRead);
 
-							// ^CAEg
+							// タイムアウトを初期化
 							ret = 0;
 							break;
 
 						case OrderDestroy:
-							// j
+							// 破棄
 							DestroyDerived();
 
-							// ҋ@ֈڍs
+							// 待機へ移行
 							SetOrder(OrderWait);
 
-							// ^CAEg
+							// タイムアウトを初期化
 							ret = 0;
 							break;
 
 						case OrderRetry:
-							// gC  ֈڍs
+							// リトライ ⇒ 初期化へ移行
 							SetOrder(OrderInitialize);
 
-							// ^CAEg
+							// タイムアウトを初期化
 							ret = 0;
 							break;
 
 						case OrderRead:
-							// ǂݍ  ރf[^̃NXmF
+							// 読み込み ⇒ 書き込むデータのクラスを確認
 							write = IsWrite();
 
-							// ރf[^Ȃ and ~̗v or j̗vmF
+							// 書き込むデータがない and 停止の要求 or 破棄の要求を確認
 							if (write == false && (GetRequestStop() || IsRequestDestroy()))
 							{
-								// ~v  jֈڍs
+								// 停止要求 ⇒ 破棄へ移行
 								SetOrder(OrderDestroy);
 
-								// ^CAEg
+								// タイムアウトを初期化
 								ret = 0;
 								break;
 							}
 
-							// ǂݍ
+							// 読み込み
 							ReadDerived();
 
-							// gC
+							// リトライを初期化
 							InitializeRetry();
 
 							if (write)
 							{
-								// ݃f[^  ݂ֈڍs
+								// 書き込みデータあり ⇒ 書き込みへ移行
 								SetOrder(OrderWrite);
 
-								// ^CAEg
+								// タイムアウトを初期化
 								ret = 0;
 								break;
 							}
 
-							// C֐̎Ń^CAEgݒ
-							ret = GetCycle();
+							// 読み込みの周期でタイムアウトを設定
+							ret = GetCycleNext();
 							break;
 
 						case OrderWrite:
-							// 
+							// 書き込み
 							WriteDerived();
 
-							// gC
+							// リトライを初期化
 							InitializeRetry();
 
-							// ǂݍ݂ֈڍs
+							// 読み込みへ移行
 							SetOrder(OrderRead);
 
-							// ^CAEg
+							// タイムアウトを初期化
 							ret = 0;
 							break;
 						}
 					}
 					catch (const Exception::CObject& e)
 					{
-						// Ȍ  Oʒm
+						// 例外の処理 ⇒ 例外を通知
 						OutputException((Exception::EnumCode)e.ErrorCode, e.DeviceErrorCode, e.Message.c_str());
 
-						// ^CAEg
+						// タイムアウトを初期化
 						ret = 0;
 
 						switch (GetOrder())
 						{
 						case OrderDestroy:
-							// j  ҋ@ֈڍs
+							// 破棄 ⇒ 待機へ移行
 							SetOrder(OrderWait);
 							break;
 
 						default:
-							// ̑  gC񐔂XV
+							// その他 ⇒ リトライ回数を更新
 							CountupRetry();
 
-							// gCmF
+							// リトライを確認
 							if (IsRetry())
 							{
-								// gC̒xԂ擾
+								// リトライの遅延時間を取得
 								ret = GetDelayRetry();
 
-								// gCֈڍs
+								// リトライへ移行
 								SetOrder(OrderRetry);
 							}
 							else
 							{
-								// jֈڍs
+								// 破棄へ移行
 								SetOrder(OrderDestroy);
 							}
 							break;
@@ -898,201 +1166,286 @@ namespace Standard
 
 			private:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̏擾
-				/// @return			̏
+				/// @brief			処理の順序を取得
+				/// @return			処理の順序
 				////////////////////////////////////////////////////////////////////////////////
 				EnumOrder GetOrder()
 				{
 					EnumOrder ret = OrderWait;
 
-					Logging::CObject logging;
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					logging.Message << GetName() << "GetOrder()" << Logging::ConstSeparator;
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncOrder);
 
 						ret = m_order;
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O𔭖C
-						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "GetOrder()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
 					}
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̏XV
-				/// @param[in]		value	̏
+				/// @brief			処理の順序を更新
+				/// @param[in]		value	処理の順序
 				////////////////////////////////////////////////////////////////////////////////
 				void SetOrder(EnumOrder value)
 				{
-					Logging::CObject logging;
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					logging.Message << GetName() << "SetOrder()" << Logging::ConstSeparator;
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncOrder);
 
 						m_order = value;
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O𔭖C
-						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "SetOrder()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̗vmF
-				/// @detail			mFɏ̗v͉
-				/// @return			true:v / false:͖v
+				/// @brief			初期化の要求を確認
+				/// @detail			確認後に初期化の要求は解除する
+				/// @return			true:初期化を要求 / false:初期化は未要求
 				////////////////////////////////////////////////////////////////////////////////
 				bool IsRequestInitialize()
 				{
 					bool ret = false;
 
-					Logging::CObject logging;
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					logging.Message << GetName() << "IsRequestInitialize()" << Logging::ConstSeparator;
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncRequestInitialize);
 
-						// ̗v擾
+						// 初期化の要求を取得
 						ret = m_requestInitialize;
 
-						// ̗v
+						// 初期化の要求を解除
 						m_requestInitialize = false;
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O𔭖C
-						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "IsRequestInitialize()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
 					}
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			j̗vmF
-				/// @detail			mFɔj̗v͉
-				/// @return			true:jv / false:j͖v
+				/// @brief			破棄の要求を確認
+				/// @detail			確認後に破棄の要求は解除する
+				/// @return			true:破棄を要求 / false:破棄は未要求
 				////////////////////////////////////////////////////////////////////////////////
 				bool IsRequestDestroy()
 				{
 					bool ret = false;
 
-					Logging::CObject logging;
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					logging.Message << GetName() << "IsRequestDestroy()" << Logging::ConstSeparator;
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncRequestDestroy);
 
-						// j̗v擾
+						// 破棄の要求を取得
 						ret = m_requestDestroy;
 
-						// j̗v
+						// 破棄の要求を解除
 						m_requestDestroy = false;
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O𔭖C
-						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "IsRequestDestroy()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
 					}
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			j̗v
+				/// @brief			破棄の要求を解除
 				////////////////////////////////////////////////////////////////////////////////
 				void ReleaseDestroy()
 				{
-					Logging::CObject logging;
-					std::stringstream postscript;
 					Exception::EnumCode errorCode = Exception::CodeUnknown;
 					int deviceErrorCode = Exception::DeviceCodeSuccess;
 
-					logging.Message << GetName() << "ReleaseDestroy()" << Logging::ConstSeparator;
-
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncRequestDestroy);
 
-						// j̗v
+						// 破棄の要求を解除
 						m_requestDestroy = false;
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O𔭖C
-						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, postscript.str(), e));
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成
+						logging.Message << GetName() << "ReleaseDestroy()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ 例外を発砲
+						throw Exception::CObject(errorCode, Exception::Convert::Message(errorCode, deviceErrorCode, logging, "", e));
+					}
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			次の読み込みの周期を取得
+				/// @detail			要求中・監視中か値の変化後は短い周期、それ以外は前回の2倍で上限まで延ばす
+				///					読み込みの回数を計測して、周期ごとの実際の読み込みの頻度として出力する ※名称は"名称+Read"
+				/// @return			読み込みの周期[ms]
+				////////////////////////////////////////////////////////////////////////////////
+				int GetCycleNext()
+				{
+					int ret = 0;
+
+					// 短い周期
+					int minimum = GetCycle();
+
+					// 派生先の監視状態を確認
+					bool active = IsActive();
+
+					{
+						// 排他制御
+						std::lock_guard<std::recursive_mutex> lock(m_asyncCycleRead);
+
+						// 周期の上限
+						int maximum = (minimum < m_cycleIdle) ? m_cycleIdle : minimum;
+
+						// 値の変化後の時間を確認
+						active = active || (0 < m_active) || (std::chrono::steady_clock::now() - m_changed < std::chrono::milliseconds(m_cycleHold));
+
+						if (active || m_cycleRead < minimum)
+						{
+							ret = minimum;
+						}
+						else
+						{
+							// 変化なし ⇒ 周期を延ばす
+							ret = (maximum / 2 < m_cycleRead) ? maximum : m_cycleRead * 2;
+							ret = (ret < minimum) ? minimum : ret;
+						}
+
+						m_cycleRead = ret;
+
+						if (m_counterRead == nullptr)
+						{
+							m_counterRead = &Transfer::GetCounter(GetName() + "Read");
+						}
 					}
+
+					// 読み込みの回数を計測
+					m_counterRead->Add();
+
+					return ret;
 				}
 
 			private:
-				//! rNX(̏p)
+				//! 排他制御クラス(処理の順序用)
 				std::recursive_mutex m_asyncOrder;
 
-				//! ̏
+				//! 処理の順序
 				EnumOrder m_order;
 
-				//! rNX(̗vp)
+				//! 排他制御クラス(初期化の要求用)
 				std::recursive_mutex m_asyncRequestInitialize;
 
-				//! ̗v
+				//! 初期化の要求
 				bool m_requestInitialize;
 
-				//! rNX(j̗vp)
+				//! 排他制御クラス(破棄の要求用)
 				std::recursive_mutex m_asyncRequestDestroy;
 
-				//! j̗v
+				//! 破棄の要求
 				bool m_requestDestroy;
 
-				//! rNX(ݒp)
+				//! 排他制御クラス(設定用)
 				std::recursive_mutex m_asyncSetting;
 
-				//! ݒ̃NX
+				//! 設定のクラス
 				CSetting m_setting;
 
-				//! rNX(gCp)
+				//! 排他制御クラス(リトライ用)
 				std::recursive_mutex m_asyncRetry;
 
-				//! gC̉
+				//! リトライの回数
 				int m_retry;
 
-				//! rNX(ރf[^̃NXp)
+				//! 書き込みを要求されたデータのクラス
+				//! ※要求したスレッドと排他せずに追加する
+				Utility::CRingQueue<CWrite> m_requestWrites;
+
+				//! 排他制御クラス(書き込むデータのクラス用)
+				//! ※読み込みのスレッドで取り出し済みのデータ用
 				std::recursive_mutex m_asyncWrite;
 
-				//! ރf[^̃NX
-				std::deque<CWrite> m_writes;
+				//! 書き込むデータのクラス
+				std::vector<CWrite> m_writes;
 
-				//! ԂʒmNX
+				//! 状態を通知するクラス
 				Notice::Worker::CTemplate<void(const CArgument&), CArgument> m_noticeArgument;
+
+				//! 排他制御クラス(読み込みの周期用)
+				std::recursive_mutex m_asyncCycleRead;
+
+				//! 変化がない間の周期の上限[ms]
+				int m_cycleIdle;
+
+				//! 値の変化後に短い周期を続ける時間[ms]
+				int m_cycleHold;
+
+				//! 現在の読み込みの周期[ms]
+				int m_cycleRead;
+
+				//! 短い周期の読み込みを要求している数
+				int m_active;
+
+				//! 最後に値が変化した時刻
+				std::chrono::steady_clock::time_point m_changed;
+
+				//! 全ての状態の通知の要求
+				bool m_snapshot;
+
+				//! 読み込みの回数
+				Metrics::CCounter* m_counterRead;
 			};
 		}
 	}
@@ -10,12 +10,12 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CTemplateExpand
-			/// @brief      ԂĎA݁Aʒmev[ggNX
-			///				 ԂĎA݁Aʒmev[g̃NXh
-			///				Aj̊֐ǉ
-			/// @param[in]	CSetting	ԂĎAʒmݒNX(ev[gŎw)
-			/// @param[in]	CArgument	ʒm̃NX(ev[gŎw)
-			/// @param[in]	CWrite	ޏ̃NX(ev[gŎw)
+			/// @brief      状態を監視、書き込み、通知するテンプレートを拡張したクラス
+			///				⇒ 状態を監視、書き込み、通知するテンプレートのクラスから派生
+			///				※初期化、破棄の関数を追加
+			/// @param[in]	CSetting	状態を監視、通知する設定クラス(テンプレートで指定)
+			/// @param[in]	CArgument	通知する情報のクラス(テンプレートで指定)
+			/// @param[in]	CWrite	書き込む情報のクラス(テンプレートで指定)
 			////////////////////////////////////////////////////////////////////////////////
 			template <typename CSetting, typename CArgument, typename CWrite>
 			class CTemplateExpand
@@ -23,7 +23,7 @@ namespace Standard
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplateExpand() : CTemplate<CSetting, CArgument, CWrite>()
 				{
@@ -31,7 +31,7 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CTemplateExpand()
 				{
@@ -39,7 +39,7 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			
+				/// @brief			初期化
 				////////////////////////////////////////////////////////////////////////////////
 				void Initialize()
 				{
@@ -50,44 +50,44 @@ namespace Standard
 
 					logging.Message << GetName() << "Initialize()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// gK[ҋ@NX
+					// トリガーを待機するクラス
 					Observer::CTemplate<Trigger::CInitialize> observer;
 
-					// gK[ʒm֐o^
+					// トリガーを通知をする関数を登録
 					postscript << "Subject::RegistrationFunction()";
 					std::shared_ptr<std::function<Trigger::OnWakeupInitialize>> onWakeup = std::make_shared<std::function<Trigger::OnWakeupInitialize>>(std::bind(&Observer::CTemplate<Trigger::CInitialize>::OnCalled, &observer, std::placeholders::_1));
 					postscript.str("");
 
-					// gK[ҋ@^CAEgXV
+					// トリガーを待機するタイムアウトを更新
 					observer.Setting.Timeout = GetInitializeTimeout();
 
-					// ĎăgK̒ʒm֐o^
+					// 初期化を監視してトリガの通知をする関数を登録
 					postscript << "AdditionWakeupInitialize()";
 					AdditionWakeupInitialize(onWakeup);
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// v
+					// 初期化を要求
 					postscript << "RequestInitialize()";
 					this->RequestInitialize();
 					postscript.str("");
 
-					// gK[҂
+					// トリガーを待つ
 					postscript << "Observer::Wait()";
 					observer.Wait();
-					// Oo
+					// ログ出力
 					postscript << Logging::ConstSeparator << stopWatch.Format(true);
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			j
+				/// @brief			破棄
 				////////////////////////////////////////////////////////////////////////////////
 				void Destroy()
 				{
@@ -98,73 +98,73 @@ namespace Standard
 
 					logging.Message << GetName() << "Destroy()" << Logging::ConstSeparator;
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// gK[ҋ@NX
+					// トリガーを待機するクラス
 					Observer::CTemplate<Trigger::CDestroy> observer;
 
-					// gK[ʒm֐o^
+					// トリガーを通知をする関数を登録
 					postscript << "Subject::RegistrationFunction()";
 					std::shared_ptr<std::function<Trigger::OnWakeupDestroy>> onWakeup = std::make_shared<std::function<Trigger::OnWakeupDestroy>>(std::bind(&Observer::CTemplate<Trigger::CDestroy>::OnCalled, &observer, std::placeholders::_1));
 					postscript.str("");
 
-					// gK[ҋ@^CAEgXV
+					// トリガーを待機するタイムアウトを更新
 					observer.Setting.Timeout = GetDestroyTimeout();
 
-					// jĎăgK̒ʒm֐o^
+					// 破棄を監視してトリガの通知をする関数を登録
 					postscript << "AdditionWakeupDestroy()";
 					AdditionWakeupDestroy(onWakeup);
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// jv
+					// 破棄を要求
 					postscript << "RequestDestroy()";
 					this->RequestDestroy();
 					postscript.str("");
 
-					// gK[҂
+					// トリガーを待つ
 					postscript << "Observer::Wait()";
 					observer.Wait();
-					// Oo
+					// ログ出力
 					postscript << Logging::ConstSeparator << stopWatch.Format(true);
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 
-					// ʂ擾
+					// 結果を取得
 					auto result = observer.GetArgument();
 
-					// ʂmF
+					// 結果を確認
 					if (result.Suspension)
 					{
-						// f  O𔭖C
+						// 中断が発生 ⇒ 例外を発砲
 
 					}
 				}
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̂擾
-				/// 				Xbh̃NXŕێĂ閼̂擾悤ɒǉ
-				/// @return			
+				/// @brief			名称を取得
+				/// 				※スレッドのクラスで保持している名称を取得するように追加
+				/// @return			名称
 				////////////////////////////////////////////////////////////////////////////////
 				std::string GetName()
 				{
 					std::string ret = "";
 
-					// ̂擾
+					// 名称を取得
 					ret = Thread::Worker::CTemplate::GetName();
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̃^CAEgԂ擾
-				///	@detail			l1000ms
-				///					hŋLq
-				/// @return			^CAEg[ms]
+				/// @brief			初期化のタイムアウト時間を取得
+				///	@detail			※初期値は1000ms
+				///					★派生先で記述する
+				/// @return			タイムアウト時間[ms]
 				////////////////////////////////////////////////////////////////////////////////
 				virtual int GetInitializeTimeout()
 				{
@@ -174,10 +174,10 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			j̃^CAEgԂ擾
-				///	@detail			l1000ms
-				///					hŋLq
-				/// @return			^CAEg[ms]
+				/// @brief			破棄のタイムアウト時間を取得
+				///	@detail			※初期値は1000ms
+				///					★派生先で記述する
+				/// @return			タイムアウト時間[ms]
 				////////////////////////////////////////////////////////////////////////////////
 				virtual int GetDestroyTimeout()
 				{
@@ -187,8 +187,8 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̊N
-				/// @param[in]		object	̌ʃNX
+				/// @brief			初期化の完了を起床
+				/// @param[in]		object	初期化の結果クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void WakeupInitializeComplete(const Trigger::CInitialize& object) noexcept
 				{
@@ -198,29 +198,24 @@ namespace Standard
 
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncInitialize);
 
-						Subject::CTemplate<Trigger::CInitialize> subject;
-
-						// ֐o^
-						subject.RegistrationFunction(m_initialize);
-
-						// ֐ʒm
-						subject.CallingFunction(object);
+						// 関数を通知
+						m_initialize.CallingFunction(object);
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O֒ǋL
+						// 例外の処理 ⇒ ログへ追記
 						logging.Message << e.what();
-						// Oۑ
+						// ログを保存
 						Transfer::Output(logging);
 					}
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			j̊N
-				/// @param[in]		object	ǰʃNX
+				/// @brief			破棄の完了を起床
+				/// @param[in]		object	破棄の結果クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void WakeupDestroyComplete(const Trigger::CDestroy& object) noexcept
 				{
@@ -230,65 +225,60 @@ namespace Standard
 
 					try
 					{
-						// r
+						// 排他制御
 						std::lock_guard<std::recursive_mutex> lock(m_asyncDestroy);
 
-						Subject::CTemplate<Trigger::CDestroy> subject;
-
-						// ֐o^
-						subject.RegistrationFunction(m_destroy);
-
-						// ֐ʒm
-						subject.CallingFunction(object);
+						// 関数を通知
+						m_destroy.CallingFunction(object);
 					}
 					catch (const std::exception& e)
 					{
-						// Ȍ  O֒ǋL
+						// 例外の処理 ⇒ ログへ追記
 						logging.Message << e.what();
-						// Oۑ
+						// ログを保存
 						Transfer::Output(logging);
 					}
 				}
 
 			private:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̒ʒmo^
-				/// param[in]		object	ʒm֐
+				/// @brief			初期化の通知を登録
+				/// param[in]		object	通知する関数
 				////////////////////////////////////////////////////////////////////////////////
 				void AdditionWakeupInitialize(std::weak_ptr<std::function<Trigger::OnWakeupInitialize>> object)
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncInitialize);
 
-					// ֐XV
-					m_initialize = object;
+					// 関数を更新
+					m_initialize.RegistrationFunction(object);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			j̒ʒmo^
-				/// param[in]		object	ʒm֐
+				/// @brief			破棄の通知を登録
+				/// param[in]		object	通知する関数
 				////////////////////////////////////////////////////////////////////////////////
 				void AdditionWakeupDestroy(std::weak_ptr<std::function<Trigger::OnWakeupDestroy>> object)
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncDestroy);
 
-					// ֐XV
-					m_destroy = object;
+					// 関数を更新
+					m_destroy.RegistrationFunction(object);
 				}
 
 			private:
-				//! rNX(̊ʒm֐p)
+				//! 排他制御クラス(初期化の完了を通知する関数用)
 				std::recursive_mutex m_asyncInitialize;
 
-				//! ̊ʒm֐
-				std::weak_ptr<std::function<Trigger::OnWakeupInitialize>> m_initialize;
+				//! 初期化の完了を通知する関数
+				Subject::CTemplate<Trigger::CInitialize> m_initialize;
 
-				//! rNX(j̊ʒm֐p)
+				//! 排他制御クラス(破棄の完了を通知する関数用)
 				std::recursive_mutex m_asyncDestroy;
 
-				//! j̊ʒm֐
-				std::weak_ptr<std::function<Trigger::OnWakeupDestroy>> m_destroy;
+				//! 破棄の完了を通知する関数
+				Subject::CTemplate<Trigger::CDestroy> m_destroy;
 			};
 		}
 	}
@@ -10,16 +10,16 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CBasis
-			/// @brief      ԂĎ̊bNX
-			/// @param[in]	CArgument	ʒm̃NX(ev[gŎw)
-			/// @param[in]	FCalled	ʒmĂяo֐|C^(ev[gŎw)
+			/// @brief      状態を監視する情報の基礎クラス
+			/// @param[in]	CArgument	通知する情報のクラス(テンプレートで指定)
+			/// @param[in]	FCalled	通知を呼び出す関数ポインタ(テンプレートで指定)
 			////////////////////////////////////////////////////////////////////////////////
 			template <typename CArgument, typename FCalled>
 			class CBasis
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CBasis()
 				{
@@ -27,19 +27,19 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @return			NX
+				/// @brief			コピー代入演算子
+				/// @return			自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				CBasis& operator = (const CBasis& object) noexcept
 				{
-					// XV
+					// 更新
 					Update(object);
 
 					return *this;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CBasis()
 				{
@@ -48,8 +48,8 @@ namespace Standard
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			NXXV
-				/// @param[in]		object	NX
+				/// @brief			自クラスを更新
+				/// @param[in]		object	自クラス
 				////////////////////////////////////////////////////////////////////////////////
 				void Update(const CBasis& object)
 				{
@@ -57,7 +57,7 @@ namespace Standard
 				}
 
 			public:
-				//! ĎɒʒmNX
+				//! 監視後に通知するクラス
 				Signal::CSubject<CArgument, FCalled> Subject;
 			};
 		}
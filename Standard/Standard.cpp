@@ -6,19 +6,19 @@
 namespace Standard
 {
 	////////////////////////////////////////////////////////////////////////////////
-	/// @brief			AvP[ṼGg|Cg
-	/// @param[in]		hModule	nh
-	/// @param[in]		ul_reason_for_call	Ăяo
-	/// @param[in]		lpReserved	߂l
+	/// @brief			アプリケーションのエントリポイントを処理
+	/// @param[in]		hModule	ハンドル
+	/// @param[in]		ul_reason_for_call	呼び出し
+	/// @param[in]		lpReserved	戻り値
 	////////////////////////////////////////////////////////////////////////////////
 	STANDARD_API void EntryPoint(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserved)
 	{
-		// AvP[ṼGg|Cg
+		// アプリケーションのエントリポイントを処理
 		Dll::Main(hModule, ul_reason_for_call, lpReserved);
 	}
 
 	////////////////////////////////////////////////////////////////////////////////
-	/// @brief			o[W̃NX擾
+	/// @brief			バージョンのクラスを取得
 	////////////////////////////////////////////////////////////////////////////////
 	STANDARD_API Version::CObject GetVersion()
 	{
@@ -26,7 +26,7 @@ namespace Standard
 
 		Version::CManager& versionManager = Version::CManager::Instance();
 
-		// o[W̃NX擾
+		// バージョンのクラスを取得
 		ret = versionManager.GetVersion();
 
 		return ret;
@@ -12,9 +12,9 @@
 
 namespace Standard
 {
-	// AvP[ṼGg|Cg
+	// アプリケーションのエントリポイントを処理
 	STANDARD_API void EntryPoint(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserved) throw(...);
 
-	// o[W擾
+	// バージョンを取得
 	STANDARD_API Version::CObject GetVersion() throw(...);
 }
\ No newline at end of file
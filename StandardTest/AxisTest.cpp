@@ -0,0 +1,187 @@
+#include <map>
+#include <vector>
+
+#include "Test.h"
+#include "AxisMotionApi/Convert.h"
+
+namespace Standard
+{
+	namespace Test
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ロング型の値をワード型のレジスタへ書き込み
+		/// @param[out]		words	ワード型のレジスタ
+		/// @param[in]		index	下位のワードの番号
+		/// @param[in]		value	ロング型の値
+		////////////////////////////////////////////////////////////////////////////////
+		static void SetLong(std::vector<short>& words, size_t index, long value)
+		{
+			words[index] = (short)((unsigned long)value & 0xFFFF);
+			words[index + 1] = (short)((unsigned long)value >> 16 & 0xFFFF);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			軸の状態を作成
+		/// @param[in]		addresses	軸の識別子とレジスタの先頭アドレス
+		/// @return			軸の識別子ごとの状態
+		////////////////////////////////////////////////////////////////////////////////
+		static std::map<int, Axis::Poling::CStatus> CreateStatus(const std::vector<std::pair<int, unsigned short>>& addresses)
+		{
+			std::map<int, Axis::Poling::CStatus> ret;
+
+			for (const auto& address : addresses)
+			{
+				ret[address.first].Address = address.second;
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			軸のレジスタの変換を計測
+		/// @detail			1周期分として、全軸の入力・出力レジスタを変換して前回からの変化を取得する
+		/// @param[in]		axes	軸の数
+		////////////////////////////////////////////////////////////////////////////////
+		static void MeasureDecode(int axes)
+		{
+			const int count = 10000;
+
+			Plc::Register::Result::CContent inputs;
+			Plc::Register::Result::CContent outputs;
+
+			inputs.Words.assign(axes * Axis::Poling::ConstRegisterSize, 0);
+			outputs.Words.assign(axes * Axis::Poling::ConstRegisterSize, 0);
+
+			std::vector<Axis::Status::Input::CDriver> previous(axes);
+			size_t changed = 0;
+
+			auto start = std::chrono::steady_clock::now();
+
+			for (int cycle = 0; cycle < count; cycle++)
+			{
+				// 全軸の現在の座標を更新
+				for (int axis = 0; axis < axes; axis++)
+				{
+					SetLong(inputs.Words, axis * Axis::Poling::ConstRegisterSize + 0x16, cycle);
+				}
+
+				// 全軸のレジスタを変換
+				for (int axis = 0; axis < axes; axis++)
+				{
+					unsigned long offset = axis * Axis::Poling::ConstRegisterSize;
+
+					auto driver = Axis::Poling::Convert::Input(inputs, offset);
+
+					driver += Axis::Poling::Convert::Output(outputs, offset);
+					driver.Id = axis;
+
+					if (driver.GetChange(previous[axis]).IsValid())
+					{
+						changed += 1;
+					}
+
+					previous[axis] = driver;
+				}
+			}
+
+			Report("Axis:" + std::to_string(axes) + "軸のレジスタを変換(1周期)", count, Elapsed(start));
+
+			Check(changed == (size_t)count * axes, "Axis:" + std::to_string(axes) + "軸の変化");
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			軸のレジスタの変換とまとめて読み込む範囲
+		////////////////////////////////////////////////////////////////////////////////
+		void TestAxis()
+		{
+			{
+				// 入力レジスタ ⇒ 信号と座標
+				Plc::Register::Result::CContent inputs;
+
+				inputs.Words.assign(Axis::Poling::ConstRegisterSize * 2, 0);
+
+				// 2軸目のレジスタ
+				unsigned long offset = Axis::Poling::ConstRegisterSize;
+
+				inputs.Words[offset + 0x00] = 1 << MotionApi::Status::RunningServo;
+				SetLong(inputs.Words, offset + 0x02, 1L << MotionApi::Status::WarningServoStop);
+				SetLong(inputs.Words, offset + 0x04, 1L << MotionApi::Status::AlarmDeviation);
+				inputs.Words[offset + 0x09] = 1 << MotionApi::Status::CommandCompleted;
+				inputs.Words[offset + 0x0C] = 1 << MotionApi::Status::PositionOriginCompleted;
+				SetLong(inputs.Words, offset + 0x16, -123456);
+
+				auto driver = Axis::Poling::Convert::Input(inputs, offset);
+
+				Check(driver.Motion.Get(Axis::Status::Input::MotionServo) && driver.Motion.Get(Axis::Status::Input::MotionOrigin), "Axis:運転と位置のステータス");
+				Check(driver.Motion.Get(Axis::Status::Input::MotionCompleted) && driver.Motion.Get(Axis::Status::Input::MotionRunning) == false, "Axis:モーションコマンドのステータス");
+				Check(driver.Warning.Get(MotionApi::Status::WarningServoStop) && driver.Warning.Get(MotionApi::Status::WarningDeviation) == false, "Axis:ワーニング");
+				Check(driver.Alarm.Get(MotionApi::Status::AlarmDeviation) && driver.Alarm.Get(MotionApi::Status::AlarmDriver) == false, "Axis:アラーム");
+				Check(driver.Coordinate.Get(Axis::Status::Input::CoordinateCurrent) == -123456.0, "Axis:現在の座標");
+
+				// 1軸目は全てOFF
+				Check(Axis::Poling::Convert::Input(inputs, 0).Motion.Get(Axis::Status::Input::MotionServo) == false, "Axis:隣の軸のレジスタ");
+			}
+
+			{
+				// 出力レジスタ ⇒ ソフトリミット
+				Plc::Register::Result::CContent outputs;
+
+				outputs.Words.assign(Axis::Poling::ConstRegisterSize, 0);
+				SetLong(outputs.Words, 0x66, 70000);
+				SetLong(outputs.Words, 0x68, -70000);
+
+				auto driver = Axis::Poling::Convert::Output(outputs, 0);
+
+				Check(driver.Coordinate.Get(Axis::Status::Input::CoordinatePositiveLimit) == 70000.0, "Axis:正方向ソフトリミット");
+				Check(driver.Coordinate.Get(Axis::Status::Input::CoordinateNegativeLimit) == -70000.0, "Axis:負方向ソフトリミット");
+
+				// 範囲外のレジスタ ⇒ 変換しない
+				outputs.Words.resize(0x67);
+
+				Check(Axis::Poling::Convert::Output(outputs, 0).Coordinate.IsValid(Axis::Status::Input::CoordinatePositiveLimit) == false, "Axis:読み込んでいないレジスタ");
+			}
+
+			{
+				// 隣接する軸 ⇒ 識別子の順に関係なく先頭アドレス順に1つの範囲
+				const unsigned long size = Axis::Poling::ConstRegisterSize;
+
+				auto scans = Axis::Poling::Convert::Scan(CreateStatus({ { 1, 0x8100 }, { 2, 0x8000 }, { 3, 0x8080 } }));
+
+				Check(scans.size() == 1 && scans[0].Address == 0x8000 && scans[0].Size == size * 3, "Axis:隣接する軸の範囲");
+				Check(scans[0].Offsets.at(2) == 0 && scans[0].Offsets.at(3) == size && scans[0].Offsets.at(1) == size * 2, "Axis:隣接する軸の位置");
+
+				// 離れた軸 ⇒ 範囲を分ける
+				scans = Axis::Poling::Convert::Scan(CreateStatus({ { 1, 0x8000 }, { 2, 0x8080 }, { 3, 0x8200 } }));
+
+				Check(scans.size() == 2 && scans[0].Size == size * 2 && scans[1].Address == 0x8200 && scans[1].Size == size, "Axis:離れた軸の範囲");
+				Check(scans[1].Offsets.size() == 1 && scans[1].Offsets.at(3) == 0, "Axis:離れた軸の位置");
+
+				// 同じアドレスの軸 ⇒ 同じ範囲の同じ位置
+				scans = Axis::Poling::Convert::Scan(CreateStatus({ { 1, 0x8000 }, { 2, 0x8000 } }));
+
+				Check(scans.size() == 1 && scans[0].Size == size && scans[0].Offsets.at(1) == 0 && scans[0].Offsets.at(2) == 0, "Axis:重複する軸の範囲");
+
+				// 17軸が隣接 ⇒ 16軸(最大ワード数)で範囲を分ける
+				std::vector<std::pair<int, unsigned short>> addresses;
+
+				for (int axis = 0; axis < 17; axis++)
+				{
+					addresses.emplace_back(axis, (unsigned short)(0x8000 + size * axis));
+				}
+
+				scans = Axis::Poling::Convert::Scan(CreateStatus(addresses));
+
+				Check(scans.size() == 2 && scans[0].Size == Axis::Poling::ConstScanMaximum && scans[0].Offsets.size() == 16, "Axis:最大ワード数の範囲");
+				Check(scans[1].Address == 0x8000 + size * 16 && scans[1].Offsets.size() == 1 && scans[1].Offsets.at(16) == 0, "Axis:最大ワード数を超えた軸");
+
+				// 軸なし ⇒ 範囲なし
+				Check(Axis::Poling::Convert::Scan(std::map<int, Axis::Poling::CStatus>()).empty(), "Axis:軸なしの範囲");
+			}
+
+			// 計測 ⇒ 1周期で全軸を変換
+			MeasureDecode(8);
+			MeasureDecode(16);
+			MeasureDecode(32);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,280 @@
+#include <string>
+#include <vector>
+
+#include "Test.h"
+#include "Common/Transfer/Binary.h"
+
+namespace Standard
+{
+	namespace Test
+	{
+		//! データグラムの上限[byte] ※転送と同じサイズ
+		static const size_t ConstDatagram = 1472;
+
+		//! 基準の時刻(1601/1/1からのミリ秒) ※2021/01/01 00:00:00.000
+		static const uint64_t ConstTime = 13253932800000ULL;
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CLog
+		/// @brief      確認に使うログのクラス
+		////////////////////////////////////////////////////////////////////////////////
+		class CLog
+		{
+		public:
+			//! 現地時刻(1601/1/1からのミリ秒)
+			uint64_t Time;
+
+			//! ログのレベル
+			int Level;
+
+			//! ログのメッセージ
+			std::string Message;
+		};
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ログを詰めて変換した行を確認
+		/// @detail			上限で詰めきれない場合はデータグラムを分ける ※転送と同じ手順
+		/// @param[in]		objects	ログ
+		/// @param[in]		name	確認の名称
+		////////////////////////////////////////////////////////////////////////////////
+		static void CheckRoundTrip(const std::vector<CLog>& objects, const std::string& name)
+		{
+			Transfer::Binary::CEncoder encoder(ConstDatagram);
+			Transfer::Binary::CDecoder decoder;
+
+			std::vector<std::string> datagrams;
+			std::vector<std::string> lines;
+			bool valid = true;
+
+			// ログだけ走査
+			for (auto& object : objects)
+			{
+				if (encoder.Append(object.Time, object.Level, object.Message) == false)
+				{
+					if (0 < encoder.GetCount())
+					{
+						datagrams.push_back(encoder.Get());
+						encoder.Clear();
+					}
+
+					if (encoder.Append(object.Time, object.Level, object.Message) == false)
+					{
+						for (auto& datagram : encoder.Split(object.Time, object.Level, object.Message))
+						{
+							datagrams.push_back(datagram);
+						}
+					}
+				}
+			}
+
+			if (0 < encoder.GetCount())
+			{
+				datagrams.push_back(encoder.Get());
+			}
+
+			// データグラムだけ走査
+			for (auto& datagram : datagrams)
+			{
+				valid &= (datagram.size() <= ConstDatagram);
+				valid &= decoder.Decode(datagram.data(), datagram.size(), lines);
+			}
+
+			decoder.Flush(lines);
+
+			Check(valid, name + ":データグラム");
+			Check(lines.size() == objects.size(), name + ":行数");
+
+			for (size_t index = 0; index < lines.size() && index < objects.size(); index++)
+			{
+				Check(lines.at(index) == Transfer::Binary::Line(objects.at(index).Time, objects.at(index).Level, objects.at(index).Message), name + ":行" + std::to_string(index));
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ログのバイナリ形式
+		////////////////////////////////////////////////////////////////////////////////
+		void TestBinary()
+		{
+			{
+				// 可変長整数とZigZag
+				std::vector<int64_t> values = { 0, 1, -1, 63, -64, 64, 127, 128, 16383, 16384, INT64_MAX, INT64_MIN };
+				bool valid = true;
+
+				for (auto value : values)
+				{
+					std::string buffer;
+
+					Transfer::Binary::PutVarint(buffer, Transfer::Binary::ZigZag(value));
+
+					const char* data = buffer.data();
+					uint64_t result = 0;
+
+					valid &= Transfer::Binary::GetVarint(data, buffer.data() + buffer.size(), result);
+					valid &= (data == buffer.data() + buffer.size());
+					valid &= (Transfer::Binary::UnZigZag(result) == value);
+				}
+
+				Check(valid, "Binary:可変長整数");
+
+				// 途中で終わった可変長整数
+				std::string buffer;
+				uint64_t result = 0;
+
+				Transfer::Binary::PutVarint(buffer, 16384);
+
+				const char* data = buffer.data();
+
+				Check(Transfer::Binary::GetVarint(data, buffer.data() + 2, result) == false, "Binary:可変長整数の途中");
+			}
+
+			{
+				// 整数の文字列 ⇒ 同じ文字列に戻せる場合だけ
+				int64_t number = 0;
+
+				Check(Transfer::Binary::IsInteger("0", number) && number == 0, "Binary:整数(0)");
+				Check(Transfer::Binary::IsInteger("-25", number) && number == -25, "Binary:整数(負)");
+				Check(Transfer::Binary::IsInteger("123456789012345678", number) && number == 123456789012345678, "Binary:整数(18桁)");
+				Check(Transfer::Binary::IsInteger("1234567890123456789", number) == false, "Binary:整数(19桁)");
+				Check(Transfer::Binary::IsInteger("007", number) == false, "Binary:整数(0埋め)");
+				Check(Transfer::Binary::IsInteger("-0", number) == false, "Binary:整数(-0)");
+				Check(Transfer::Binary::IsInteger("-", number) == false, "Binary:整数(符号だけ)");
+				Check(Transfer::Binary::IsInteger("12a", number) == false, "Binary:整数(文字)");
+				Check(Transfer::Binary::IsInteger("", number) == false, "Binary:整数(空)");
+			}
+
+			{
+				// 項目・整数・登録済みの文字列・時刻の前後を含むログ
+				std::vector<CLog> objects;
+
+				objects.push_back({ ConstTime, 2, "Grabber::Capture()\t番号:\t12\t時間:\t-3" });
+				objects.push_back({ ConstTime + 15, 2, "Grabber::Capture()\t番号:\t13\t時間:\t007" });
+				objects.push_back({ ConstTime + 10, 3, "\t\t" });
+				objects.push_back({ ConstTime + 10, 0, "" });
+				objects.push_back({ ConstTime + 86400000, 1, "Io::Read()\tGrabber::Capture()" });
+
+				CheckRoundTrip(objects, "Binary:復元");
+			}
+
+			{
+				// 上限まで詰めて複数のデータグラムに分ける
+				std::vector<CLog> objects;
+
+				for (int index = 0; index < 500; index++)
+				{
+					objects.push_back({ ConstTime + index, 1, "Axis::Read()\t軸:\t" + std::to_string(index % 8) + "\t位置:\t" + std::to_string(index * 1000) + "\t項目" + std::to_string(index) });
+				}
+
+				CheckRoundTrip(objects, "Binary:複数");
+			}
+
+			{
+				// 空のデータグラムにも入らないログ
+				Transfer::Binary::CEncoder encoder(ConstDatagram);
+
+				std::string message = "Transfer::Output()\t";
+
+				for (int index = 0; message.size() < ConstDatagram * 3; index++)
+				{
+					message += "値" + std::to_string(index) + "\t";
+				}
+
+				Check(encoder.Append(ConstTime, 3, message) == false, "Binary:上限(空)");
+				Check(encoder.GetCount() == 0 && encoder.Get().empty(), "Binary:上限(空)は未追加");
+
+				std::vector<std::string> datagrams = encoder.Split(ConstTime, 3, message);
+
+				Check(3 < datagrams.size(), "Binary:分割数");
+
+				bool valid = true;
+
+				for (auto& datagram : datagrams)
+				{
+					valid &= (datagram.size() <= ConstDatagram);
+				}
+
+				Check(valid, "Binary:分割の上限");
+
+				// 前後のログと混在
+				std::vector<CLog> objects;
+
+				objects.push_back({ ConstTime - 1, 1, "前" });
+				objects.push_back({ ConstTime, 3, message });
+				objects.push_back({ ConstTime + 1, 1, "後" });
+
+				CheckRoundTrip(objects, "Binary:分割");
+
+				// 最後の断片が欠けた ⇒ 次のログの前に届いた分だけ出力
+				Transfer::Binary::CDecoder decoder;
+				std::vector<std::string> lines;
+
+				for (size_t index = 0; index + 1 < datagrams.size(); index++)
+				{
+					decoder.Decode(datagrams.at(index).data(), datagrams.at(index).size(), lines);
+				}
+
+				Check(lines.empty(), "Binary:断片は保持");
+
+				Transfer::Binary::CEncoder next(ConstDatagram);
+
+				next.Append(ConstTime + 1, 1, "後");
+				decoder.Decode(next.Get().data(), next.Get().size(), lines);
+
+				Check(lines.size() == 2, "Binary:欠けた断片の行数");
+
+				if (lines.size() == 2)
+				{
+					Check(lines.at(0).size() < Transfer::Binary::Line(ConstTime, 3, message).size(), "Binary:欠けた断片");
+					Check(lines.at(1) == Transfer::Binary::Line(ConstTime + 1, 1, "後"), "Binary:欠けた断片の次");
+				}
+			}
+
+			{
+				// 不正なデータグラム
+				Transfer::Binary::CEncoder encoder(ConstDatagram);
+				std::vector<std::string> lines;
+
+				encoder.Append(ConstTime, 1, "Grabber::Capture()\t番号:\t12");
+				encoder.Append(ConstTime, 1, "Grabber::Capture()\t番号:\t13");
+
+				std::string datagram = encoder.Get();
+
+				Check(Transfer::Binary::Decode(datagram.data(), datagram.size() - 1, lines) == false && lines.size() == 1, "Binary:途中で終わったデータグラム");
+
+				datagram.at(sizeof(Transfer::Binary::ConstMagic)) = (char)(Transfer::Binary::ConstVersion + 1);
+				lines.clear();
+
+				Check(Transfer::Binary::Decode(datagram.data(), datagram.size(), lines) == false && lines.empty(), "Binary:未対応の版");
+				Check(Transfer::Binary::IsBinary("2021-01-01", 10) == false, "Binary:テキスト形式");
+			}
+
+			{
+				// 計測 ⇒ 同じ項目が続くログを詰める
+				const int count = 100000;
+
+				Transfer::Binary::CEncoder encoder(ConstDatagram);
+				size_t datagrams = 0;
+				size_t bytes = 0;
+
+				auto start = std::chrono::steady_clock::now();
+
+				for (int index = 0; index < count; index++)
+				{
+					std::string message = "Io::Read()\t番号:\t" + std::to_string(index) + "\t入力:\t" + std::to_string(index & 0xFF);
+
+					if (encoder.Append(ConstTime + index, 1, message) == false)
+					{
+						datagrams++;
+						bytes += encoder.Get().size();
+						encoder.Clear();
+
+						encoder.Append(ConstTime + index, 1, message);
+					}
+				}
+
+				Report("Binary::CEncoder::Append()", count, Elapsed(start));
+
+				Check(0 < datagrams && bytes / datagrams <= ConstDatagram, "Binary:計測のデータグラム");
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,177 @@
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Test.h"
+#include "Common/Image/Format.h"
+
+namespace Standard
+{
+	namespace Test
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			パックされた画素の展開をスカラーの処理と比較
+		/// @param[in]		src		パックされた画素
+		/// @param[in]		bit		先頭の画素のビット位置
+		/// @param[in]		count	画素の数
+		/// @param[in]		bits	1画素のビット数(10 or 12)
+		/// @return			比較結果(true:一致 / false:不一致)
+		////////////////////////////////////////////////////////////////////////////////
+		static bool CompareUnpack(const std::vector<unsigned char>& src, int64_t bit, int count, int bits)
+		{
+			bool ret = true;
+
+			std::vector<unsigned char> expected(count + 1, 0xA5);
+			std::vector<unsigned char> result(count + 1, 0xA5);
+
+			Image::Format::UnpackScalar(src.data(), bit, expected.data(), count, bits);
+			Image::Format::Unpack(src.data(), bit, result.data(), count, bits);
+
+			// 画素の数を超えて書き込まない
+			ret = (expected == result);
+
+			// SIMD命令ごとにも比較 ⇒ CPUが対応する命令だけ
+			if ((bit & 7) == 0)
+			{
+				const unsigned char* begin = src.data() + (bit >> 3);
+
+				if (Image::Format::GetSimd() >= Image::Format::SimdSsse3)
+				{
+					std::vector<unsigned char> simd(count + 1, 0xA5);
+
+					int done = Image::Format::UnpackSsse3(begin, simd.data(), count, bits);
+					Image::Format::UnpackScalar(src.data(), bit + (int64_t)done * bits, simd.data() + done, count - done, bits);
+
+					ret = ret && (expected == simd);
+				}
+
+				if (Image::Format::GetSimd() >= Image::Format::SimdAvx2)
+				{
+					std::vector<unsigned char> simd(count + 1, 0xA5);
+
+					int done = Image::Format::UnpackAvx2(begin, simd.data(), count, bits);
+					Image::Format::UnpackScalar(src.data(), bit + (int64_t)done * bits, simd.data() + done, count - done, bits);
+
+					ret = ret && (expected == simd);
+				}
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			画素フォーマットの変換
+		/// @detail			SIMD命令の処理がスカラーの処理とビット単位で一致するか確認する
+		////////////////////////////////////////////////////////////////////////////////
+		void TestFormat()
+		{
+			std::mt19937 random(12345);
+
+			for (int bits : { 10, 12 })
+			{
+				std::string name = "Format:Mono" + std::to_string(bits) + "p";
+
+				// 端数を含む画素の数とビット位置の組み合わせ
+				std::vector<unsigned char> src(((300 + 8) * bits) / 8 + 2);
+
+				for (auto& value : src)
+				{
+					value = (unsigned char)random();
+				}
+
+				bool match = true;
+
+				for (int count = 0; count <= 300; count++)
+				{
+					for (int64_t bit : { 0, bits * 1, 8, bits * 3, 16 })
+					{
+						match = match && CompareUnpack(src, bit, count, bits);
+					}
+				}
+
+				Check(match, name + ":スカラーと一致");
+
+				// 全ての値の上位8ビットを取り出す
+				std::vector<unsigned char> all(((1 << bits) * bits) / 8 + 2, 0);
+				std::vector<unsigned char> top(1 << bits);
+
+				for (int value = 0; value < (1 << bits); value++)
+				{
+					for (int index = 0; index < bits; index++)
+					{
+						if (value & (1 << index))
+						{
+							int64_t bit = (int64_t)value * bits + index;
+
+							all[bit >> 3] |= (unsigned char)(1 << (bit & 7));
+						}
+					}
+				}
+
+				Image::Format::Unpack(all.data(), 0, top.data(), 1 << bits, bits);
+
+				bool value = true;
+
+				for (int index = 0; index < (1 << bits); index++)
+				{
+					value = value && (top[index] == (index >> (bits - 8)));
+				}
+
+				Check(value, name + ":上位8ビット");
+
+				// 1ラインのパディングあり
+				const int height = 5;
+				const int width = 37;
+				const int stride = Image::Stride(8, width);
+
+				std::vector<unsigned char> image((height * width * bits) / 8 + 2);
+				std::vector<unsigned char> expected(stride * height, 0);
+				std::vector<unsigned char> result(stride * height, 0);
+
+				for (auto& value : image)
+				{
+					value = (unsigned char)random();
+				}
+
+				for (int row = 0; row < height; row++)
+				{
+					Image::Format::UnpackScalar(image.data(), (int64_t)width * bits * row, expected.data() + stride * row, width, bits);
+				}
+
+				Image::Format::ConvertMono((bits == 10) ? Image::Format::PixelMono10p : Image::Format::PixelMono12p, height, width, image.data(), result.data(), stride);
+
+				Check(expected == result, name + ":1ラインのパディング");
+
+				// 計測 ⇒ 5Mピクセルの画像
+				const int count = 2448 * 2048;
+				const int repeat = 20;
+
+				std::vector<unsigned char> frame(((int64_t)count * bits) / 8 + 2);
+				std::vector<unsigned char> output(count);
+
+				for (auto& value : frame)
+				{
+					value = (unsigned char)random();
+				}
+
+				auto start = std::chrono::steady_clock::now();
+
+				for (int index = 0; index < repeat; index++)
+				{
+					Image::Format::UnpackScalar(frame.data(), 0, output.data(), count, bits);
+				}
+
+				Report(name + ":スカラー", (size_t)repeat, Elapsed(start));
+
+				start = std::chrono::steady_clock::now();
+
+				for (int index = 0; index < repeat; index++)
+				{
+					Image::Format::Unpack(frame.data(), 0, output.data(), count, bits);
+				}
+
+				Report(name + ":SIMD命令(" + std::to_string((int)Image::Format::GetSimd()) + ")", (size_t)repeat, Elapsed(start));
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+#include "Test.h"
+#include "GrabberSample/Worker.h"
+
+namespace Standard
+{
+	namespace Test
+	{
+		//! 受け取らない画像の間隔 ⇒ 画像の番号が5の倍数の画像を受け取らない
+		const uint32_t ConstSkipFrame = 5;
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CSkipWorker
+		/// @brief      一定の間隔で画像を受け取らない疑似的なカメラのクラス
+		///				⇒ サンプルのカメラの制御を行うクラスから派生
+		/// @detail		画像の番号の抜けから受け取れなかった画像の累計を確認する
+		////////////////////////////////////////////////////////////////////////////////
+		class CSkipWorker
+			: public Grabber::CWorker
+		{
+		public:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			連続取り込みで画像を受け取る
+			/// @detail			サンプルの画像を受け取り、画像の番号が間隔の倍数の場合は受け取らない
+			/// @param[in]		timeout	タイムアウト[ms]
+			/// @param[out]		frame	画像と付帯情報のクラス
+			/// @return			true:受け取り / false:タイムアウト
+			////////////////////////////////////////////////////////////////////////////////
+			bool RetrieveDerived(int timeout, Grabber::Frame::CObject& frame) override
+			{
+				bool ret = false;
+
+				ret = Grabber::CWorker::RetrieveDerived(timeout, frame);
+
+				if (ret && frame.Information.FrameId % ConstSkipFrame == 0)
+				{
+					ret = false;
+				}
+
+				return ret;
+			}
+		};
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			画像の先頭に書き込まれた通番を取得
+		/// @param[in]		frame	画像と付帯情報のクラス
+		/// @return			画像の通番
+		////////////////////////////////////////////////////////////////////////////////
+		static uint32_t GetSequence(const Grabber::Frame::CObject& frame)
+		{
+			uint32_t ret = 0;
+
+			::memcpy(&ret, frame.Value.GetValue(), sizeof(ret));
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			カメラの連続取り込み
+		/// @detail			サンプルのカメラで、次の画像の待機、最新の画像の取得、画像の通知、
+		///					受け取れなかった画像と読み飛ばした画像の数を確認する
+		////////////////////////////////////////////////////////////////////////////////
+		void TestGrabber()
+		{
+			CSkipWorker worker;
+			Grabber::Setting::CDefault defaultSetting;
+			Grabber::Setting::CConnect connectSetting;
+
+			defaultSetting.ImageWidth = 64;
+			defaultSetting.ImageHeight = 48;
+			defaultSetting.Streaming = true;
+			defaultSetting.StreamingBuffer = 4;
+			connectSetting.Identifier = "StandardTest";
+
+			std::atomic<int> noticed(0);
+			std::atomic<uint64_t> noticedId(0);
+			std::atomic<bool> noticedValid(true);
+
+			// 画像の通知 ⇒ 番号と通番が一致し、抜けた番号を通知しない
+			worker.AttachFunctionFrame([&](const Grabber::Frame::CObject& frame)
+			{
+				if (GetSequence(frame) != frame.Information.FrameId || frame.Information.FrameId % ConstSkipFrame == 0)
+				{
+					noticedValid = false;
+				}
+
+				noticedId = frame.Information.FrameId;
+				noticed += 1;
+			});
+
+			try
+			{
+				worker.Initialize(defaultSetting);
+				worker.Connect(connectSetting);
+
+				{
+					// 次の画像の待機 ⇒ 受け取った順に番号が進み、抜けた番号の累計を保持
+					const int count = 12;
+
+					bool ordered = true;
+					bool sequence = true;
+					bool lost = true;
+					uint64_t previous = 0;
+
+					auto start = std::chrono::steady_clock::now();
+
+					for (int index = 0; index < count; index++)
+					{
+						Grabber::Frame::CObject frame = worker.WaitNextFrame((int)defaultSetting.CaptureTimeout);
+
+						if (frame.Information.FrameId <= previous)
+						{
+							ordered = false;
+						}
+
+						if (GetSequence(frame) != frame.Information.FrameId)
+						{
+							sequence = false;
+						}
+
+						if (frame.Information.Lost != (frame.Information.FrameId - 1) / ConstSkipFrame)
+						{
+							lost = false;
+						}
+
+						previous = frame.Information.FrameId;
+					}
+
+					Report("Grabber:次の画像の待機", count, Elapsed(start));
+
+					Check(ordered, "Grabber:次の画像の順序");
+					Check(sequence, "Grabber:画像の通番");
+					Check(lost, "Grabber:受け取れなかった画像の累計");
+					Check(worker.GetFrameLost() == 0, "Grabber:遅れずに待機した場合の読み飛ばし");
+
+					// 最新の画像 ⇒ 待機した画像以降
+					Grabber::Frame::CObject latest = worker.GetLatestFrame();
+
+					Check(latest.Information.FrameId >= previous && GetSequence(latest) == latest.Information.FrameId, "Grabber:最新の画像");
+				}
+
+				{
+					// 保持する画像の数を超えて遅れる ⇒ 古い画像を読み飛ばす
+					uint64_t received = worker.GetFrameCount();
+
+					while (worker.GetFrameCount() < received + defaultSetting.StreamingBuffer * 2)
+					{
+						std::this_thread::sleep_for(std::chrono::milliseconds(10));
+					}
+
+					Grabber::Frame::CObject frame = worker.WaitNextFrame((int)defaultSetting.CaptureTimeout);
+					Grabber::Frame::CObject latest = worker.GetLatestFrame();
+
+					Check(worker.GetFrameLost() > 0, "Grabber:遅れた場合の読み飛ばし");
+					Check(latest.Information.FrameId - frame.Information.FrameId < (uint64_t)defaultSetting.StreamingBuffer * 2, "Grabber:読み飛ばした後の画像");
+				}
+
+				worker.Disconnect();
+				worker.Destroy();
+			}
+			catch (const std::exception&)
+			{
+				Check(false, "Grabber:連続取り込みの例外");
+			}
+
+			worker.DetachFunctionFrame();
+
+			Check(noticed > 0 && noticedId > 0, "Grabber:画像の通知");
+			Check(noticedValid, "Grabber:通知した画像");
+		}
+	}
+}
\ No newline at end of file
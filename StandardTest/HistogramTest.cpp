@@ -0,0 +1,172 @@
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Test.h"
+#include "Common/Metrics/Histogram.h"
+
+namespace Standard
+{
+	namespace Test
+	{
+		//! パーセンタイルの相対誤差の上限 ※区間の幅の半分
+		static const double ConstError = 1.0 / 32 + 1e-9;
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			相対誤差の範囲内か確認
+		/// @param[in]		value	集計した値[ms]
+		/// @param[in]		expected	期待する値[us]
+		/// @return			true:範囲内 / false:範囲外
+		////////////////////////////////////////////////////////////////////////////////
+		static bool IsNear(double value, double expected)
+		{
+			return std::fabs(value * 1000.0 - expected) <= expected * ConstError;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			処理時間の分布
+		////////////////////////////////////////////////////////////////////////////////
+		void TestHistogram()
+		{
+			{
+				// 計測なし
+				Metrics::CHistogram histogram;
+
+				Metrics::Snapshot::CObject snapshot = histogram.GetSnapshot(false);
+
+				Check(snapshot.Kind == Metrics::Snapshot::KindHistogram, "Histogram:種類");
+				Check(snapshot.Count == 0 && snapshot.Maximum == 0 && snapshot.P50 == 0, "Histogram:計測なし");
+			}
+
+			{
+				// 32[us]までは1[us]ごと
+				Metrics::CHistogram histogram;
+
+				for (uint64_t value = 0; value < 32; value++)
+				{
+					histogram.Record(value);
+				}
+
+				Metrics::Snapshot::CObject snapshot = histogram.GetSnapshot(false);
+
+				Check(snapshot.Count == 32, "Histogram:回数(1us)");
+				Check(snapshot.Minimum == 0 && snapshot.Maximum == 0.031, "Histogram:最小値と最大値(1us)");
+				Check(snapshot.P50 == 0.015, "Histogram:中央値(1us)");
+				Check(std::fabs(snapshot.Average - 0.0155) < 1e-9, "Histogram:平均(1us)");
+			}
+
+			{
+				// 桁の違う処理時間 ⇒ 正確な値と比べて区間の幅の半分まで
+				Metrics::CHistogram histogram;
+				std::vector<uint64_t> values;
+				uint64_t seed = 1;
+
+				for (int index = 0; index < 100000; index++)
+				{
+					// 線形合同法 ⇒ 1[us]～約17[分]で桁ごとに同じ割合
+					seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+
+					int magnitude = (int)((seed >> 33) % 30);
+					uint64_t value = ((uint64_t)1 << magnitude) + ((seed >> 8) & (((uint64_t)1 << magnitude) - 1));
+
+					values.push_back(value);
+					histogram.Record(value);
+				}
+
+				std::sort(values.begin(), values.end());
+
+				Metrics::Snapshot::CObject snapshot = histogram.GetSnapshot(false);
+
+				// 割合から正確な値を取得
+				auto exact = [&values](double rate) { return (double)values.at((size_t)(rate * values.size() + 0.5) - 1); };
+
+				Check(snapshot.Count == (int64_t)values.size(), "Histogram:回数");
+				Check(snapshot.Minimum * 1000.0 == values.front() && snapshot.Maximum * 1000.0 == values.back(), "Histogram:最小値と最大値");
+				Check(IsNear(snapshot.P50, exact(0.5)), "Histogram:P50");
+				Check(IsNear(snapshot.P90, exact(0.9)), "Histogram:P90");
+				Check(IsNear(snapshot.P99, exact(0.99)), "Histogram:P99");
+				Check(IsNear(snapshot.P999, exact(0.999)), "Histogram:P99.9");
+			}
+
+			{
+				// 上限を超える処理時間 ⇒ 最大値に制限
+				Metrics::CHistogram histogram;
+
+				histogram.Record((uint64_t)1 << 50);
+
+				Metrics::Snapshot::CObject snapshot = histogram.GetSnapshot(false);
+
+				Check(snapshot.Count == 1 && snapshot.P50 == snapshot.Maximum && snapshot.Maximum == ((uint64_t)1 << 50) / 1000.0, "Histogram:上限");
+			}
+
+			{
+				// 集計した分を破棄
+				Metrics::CHistogram histogram;
+
+				histogram.Record(100);
+				histogram.Record(300);
+
+				Check(histogram.GetSnapshot(false).Count == 2, "Histogram:保持");
+				Check(histogram.GetSnapshot(true).Count == 2, "Histogram:破棄する集計");
+
+				Metrics::Snapshot::CObject snapshot = histogram.GetSnapshot(false);
+
+				Check(snapshot.Count == 0 && snapshot.Maximum == 0, "Histogram:破棄");
+
+				histogram.Record(200);
+
+				snapshot = histogram.GetSnapshot(false);
+
+				Check(snapshot.Minimum == 0.2 && snapshot.Maximum == 0.2, "Histogram:破棄後の最小値と最大値");
+			}
+
+			{
+				// 回数
+				Metrics::CCounter counter;
+
+				counter.Add();
+				counter.Add(4);
+
+				Check(counter.GetSnapshot(false).Kind == Metrics::Snapshot::KindCounter, "Counter:種類");
+				Check(counter.GetSnapshot(true).Count == 5, "Counter:回数");
+				Check(counter.GetSnapshot(false).Count == 0, "Counter:破棄");
+			}
+
+			{
+				// 計測 ⇒ 複数スレッドから追加
+				const int threads = 4;
+				const int count = 1000000;
+
+				Metrics::CHistogram histogram;
+				std::vector<std::thread> workers;
+
+				auto start = std::chrono::steady_clock::now();
+
+				for (int thread = 0; thread < threads; thread++)
+				{
+					workers.emplace_back([&histogram, count]
+					{
+						for (int index = 0; index < count; index++)
+						{
+							histogram.Record((uint64_t)(index & 0xFFFF));
+						}
+					});
+				}
+
+				for (auto& worker : workers)
+				{
+					worker.join();
+				}
+
+				Report("Histogram:" + std::to_string(threads) + "スレッドから追加", (size_t)threads * count, Elapsed(start));
+
+				Metrics::Snapshot::CObject snapshot = histogram.GetSnapshot(false);
+
+				Check(snapshot.Count == (int64_t)threads * count, "Histogram:複数スレッドの回数");
+				Check(snapshot.Maximum == 0xFFFF / 1000.0, "Histogram:複数スレッドの最大値");
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,168 @@
+#include <deque>
+#include <vector>
+
+#include "Test.h"
+#include "Common/Image/Basis.h"
+
+namespace Standard
+{
+	namespace Test
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			画像
+		/// @detail			画像のサイズごとにプールを使うため、確認ごとにサイズを変える
+		////////////////////////////////////////////////////////////////////////////////
+		void TestImage()
+		{
+			Image::CPool& pool = Image::CPool::Instance();
+
+			{
+				// 定常状態 ⇒ 画像のデータを確保せず、コピーは1回だけ
+				const int height = 48;
+				const int width = 64;
+				const int count = 1000;
+
+				std::vector<unsigned char> frame(Image::Size(8, height, width), 1);
+				std::vector<Image::CObject> queue(4);
+
+				// 慣らし ⇒ 保持する数だけ確保
+				for (int index = 0; index < (int)queue.size(); index++)
+				{
+					queue[index].Update(8, height, width, frame.data());
+				}
+
+				size_t allocated = pool.GetAllocated();
+				size_t reused = pool.GetReused();
+
+				auto start = std::chrono::steady_clock::now();
+
+				for (int index = 0; index < count; index++)
+				{
+					// 古い画像を解放してから取得 ⇒ 最大で4枚を保持
+					Image::CObject& object = queue[index % queue.size()];
+
+					object.Clear();
+					object.Update(8, height, width, frame.data());
+
+					// コピーは画像のデータを共有
+					Image::CObject copy = object;
+
+					Check(copy.GetValue() == object.GetValue(), "Image:コピーで共有");
+				}
+
+				Report("Image:プールから取得", (size_t)count, Elapsed(start));
+
+				Check(pool.GetAllocated() == allocated, "Image:定常状態で確保なし");
+				Check(pool.GetReused() == reused + count, "Image:使い回した数");
+			}
+
+			{
+				// Matクラスが画像のデータの参照を保持 ⇒ 自クラスの破棄後も使い回さない
+				const int height = 24;
+				const int width = 32;
+
+				std::vector<unsigned char> frame(Image::Size(8, height, width), 7);
+				cv::Mat mat;
+
+				{
+					Image::CObject object(8, height, width, frame.data());
+
+					mat = object.Convert();
+
+					Check(mat.data == object.GetValue(), "Image:Matクラスはコピーなし");
+				}
+
+				size_t allocated = pool.GetAllocated();
+
+				std::vector<unsigned char> other(Image::Size(8, height, width), 9);
+				Image::CObject object(8, height, width, other.data());
+
+				Check(object.GetValue() != mat.data, "Image:Matクラスの使用中は使い回さない");
+				Check(pool.GetAllocated() == allocated + 1, "Image:Matクラスの使用中は確保");
+				Check(mat.ptr(height - 1)[width - 1] == 7, "Image:Matクラスの画像のデータ");
+
+				// Matクラスの解放 ⇒ プールへ戻る
+				const unsigned char* value = mat.data;
+
+				mat.release();
+
+				Image::CObject next(8, height, width, other.data());
+
+				Check(next.GetValue() == value, "Image:Matクラスの解放後に使い回し");
+				Check(pool.GetAllocated() == allocated + 1, "Image:Matクラスの解放後は確保なし");
+			}
+
+			{
+				// 連続取り込み ⇒ 保持する8枚・通知待ち2枚・受け取り中と通知中の2枚を同時に使用
+				const int height = 12;
+				const int width = 16;
+				const size_t ring = 8;
+				const size_t notice = 2;
+				const size_t inflight = 2;
+				const int count = 1000;
+
+				std::vector<unsigned char> frame(Image::Size(8, height, width), 3);
+				size_t capacity = pool.GetCapacity();
+
+				// 連続取り込みの画像の流れを再現 ⇒ 確保した数を取得
+				auto stream = [&]()
+				{
+					std::vector<Image::CObject> frames(ring);
+					std::deque<Image::CObject> notices;
+					Image::CObject delivering;
+
+					auto push = [&](int index)
+					{
+						// 受け取り中
+						Image::CObject retrieved(8, height, width, frame.data());
+
+						// 保持 ⇒ 古い画像を置き換え
+						frames[index % ring] = retrieved;
+
+						// 通知待ち ⇒ 上限を超えたら古い画像を破棄
+						notices.push_back(retrieved);
+
+						if (notice < notices.size())
+						{
+							notices.pop_front();
+						}
+
+						// 通知中 ⇒ 通知が遅れて、1周ごとに取り出す
+						if (index % (int)ring == 0)
+						{
+							delivering = notices.front();
+							notices.pop_front();
+						}
+					};
+
+					// 慣らし ⇒ 保持と通知中が2周するまで
+					for (int index = 0; index < (int)ring * 3; index++)
+					{
+						push(index);
+					}
+
+					size_t allocated = pool.GetAllocated();
+
+					for (int index = (int)ring * 3; index < count; index++)
+					{
+						push(index);
+					}
+
+					return pool.GetAllocated() - allocated;
+				};
+
+				// 既定の上限 ⇒ 同時に使用する数が上限を超えるため確保が続く
+				pool.SetCapacity(ring);
+
+				Check(0 < stream(), "Image:連続取り込み(上限不足)は確保あり");
+
+				// 同時に使用する数まで上限を拡大 ⇒ Grabber::Worker::StartStreaming()と同じ
+				pool.SetCapacity(ring + notice + inflight);
+
+				Check(stream() == 0, "Image:連続取り込みで確保なし");
+
+				pool.SetCapacity(capacity);
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,231 @@
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Test.h"
+#include "Notice/Worker.h"
+
+namespace Standard
+{
+	namespace Test
+	{
+		//! 通知する情報 ⇒ キーと値
+		typedef std::pair<size_t, int> CKeyValue;
+
+		//! 通知するクラス
+		typedef Notice::Worker::CTemplate<void(const CKeyValue&), CKeyValue> CKeyValueNotice;
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			溜まっている通知を受け取る
+		/// @detail			通知のスレッドを開始して、指定した数を受け取るか1秒経過するまで待機してから停止する
+		/// @param[in]		worker	通知するクラス ※開始する前に通知を要求しておく
+		/// @param[in]		count	受け取る数
+		/// @return			受け取った値(通知の順)
+		////////////////////////////////////////////////////////////////////////////////
+		static std::vector<int> Receive(CKeyValueNotice& worker, size_t count)
+		{
+			std::vector<int> ret;
+			std::mutex async;
+
+			worker.AttachFunctionCalled([&](const CKeyValue& object)
+			{
+				// 排他制御
+				std::lock_guard<std::mutex> lock(async);
+
+				ret.push_back(object.second);
+			});
+
+			worker.Start();
+			worker.RequestInitialize();
+
+			auto start = std::chrono::steady_clock::now();
+
+			while (Elapsed(start) < 1000)
+			{
+				{
+					// 排他制御
+					std::lock_guard<std::mutex> lock(async);
+
+					if (count <= ret.size())
+					{
+						break;
+					}
+				}
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+
+			worker.RequestDestroy();
+			worker.Stop();
+			worker.DetachFunctionCalled();
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			値を合計して統合
+		/// @param[in,out]	object	統合先の情報
+		/// @param[in]		merge	統合する情報
+		////////////////////////////////////////////////////////////////////////////////
+		static void MergeSum(CKeyValue& object, const CKeyValue& merge)
+		{
+			object.second += merge.second;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			通知する情報が上限に達した場合の動作
+		/// @detail			通知のスレッドを開始する前に要求して溜まった状態を作り、開始してから受け取った順序と値を確認する
+		////////////////////////////////////////////////////////////////////////////////
+		void TestNotice()
+		{
+			{
+				// 古い情報を破棄 ⇒ 新しい方から上限の数だけ通知
+				CKeyValueNotice worker;
+
+				worker.SetCapacity(3, Notice::Worker::OverflowDropOldest);
+
+				for (int value = 1; value <= 5; value++)
+				{
+					worker.RequestNotice(CKeyValue(0, value));
+				}
+
+				Check(worker.GetDropped() == 2 && worker.GetMerged() == 0, "Notice:古い情報の破棄の数");
+				Check(Receive(worker, 3) == std::vector<int>({ 3, 4, 5 }), "Notice:古い情報を破棄した通知");
+			}
+
+			{
+				// 最新の情報に統合 ⇒ 上限を超えた分は最後の情報に合計
+				CKeyValueNotice worker;
+
+				worker.SetCapacity(3, Notice::Worker::OverflowMerge);
+				worker.AttachFunctionMerge(MergeSum);
+
+				for (int value = 1; value <= 5; value++)
+				{
+					worker.RequestNotice(CKeyValue(0, value));
+				}
+
+				Check(worker.GetMerged() == 2 && worker.GetDropped() == 0, "Notice:統合の数");
+				Check(Receive(worker, 3) == std::vector<int>({ 1, 2, 12 }), "Notice:統合した通知");
+			}
+
+			{
+				// 統合する関数なし ⇒ 古い情報を破棄
+				CKeyValueNotice worker;
+
+				worker.SetCapacity(2, Notice::Worker::OverflowMerge);
+
+				for (int value = 1; value <= 4; value++)
+				{
+					worker.RequestNotice(CKeyValue(0, value));
+				}
+
+				Check(worker.GetDropped() == 2 && worker.GetMerged() == 0, "Notice:統合する関数なしの破棄");
+				Check(Receive(worker, 2) == std::vector<int>({ 3, 4 }), "Notice:統合する関数なしの通知");
+			}
+
+			{
+				// 空きが出るまで待機 ⇒ 通知のスレッドが取り出すまで要求が戻らず、破棄しない
+				const int delay = 100;
+
+				CKeyValueNotice worker;
+
+				worker.SetCapacity(2, Notice::Worker::OverflowBlock);
+				worker.RequestNotice(CKeyValue(0, 1));
+				worker.RequestNotice(CKeyValue(0, 2));
+
+				float blocked = 0;
+
+				std::thread requester([&]
+				{
+					auto start = std::chrono::steady_clock::now();
+
+					worker.RequestNotice(CKeyValue(0, 3));
+
+					blocked = Elapsed(start);
+				});
+
+				// 要求したスレッドが待機している間に通知のスレッドを開始
+				std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+
+				std::vector<int> received = Receive(worker, 3);
+
+				requester.join();
+
+				Check(blocked >= delay * 0.9f, "Notice:空きが出るまで待機");
+				Check(worker.GetDropped() == 0 && received == std::vector<int>({ 1, 2, 3 }), "Notice:待機した通知");
+			}
+
+			{
+				// 待機がタイムアウト ⇒ 古い情報を破棄
+				const int timeout = 50;
+
+				CKeyValueNotice worker;
+
+				worker.SetCapacity(1, Notice::Worker::OverflowBlock, timeout);
+				worker.RequestNotice(CKeyValue(0, 1));
+
+				auto start = std::chrono::steady_clock::now();
+
+				worker.RequestNotice(CKeyValue(0, 2));
+
+				float blocked = Elapsed(start);
+
+				Check(blocked >= timeout * 0.9f && worker.GetDropped() == 1, "Notice:待機のタイムアウト");
+
+				// 待機しない要求 ⇒ 統合する関数があれば統合
+				worker.AttachFunctionMerge(MergeSum);
+
+				start = std::chrono::steady_clock::now();
+
+				worker.RequestNotice(CKeyValue(0, 3), false);
+
+				Check(Elapsed(start) < timeout && worker.GetMerged() == 1, "Notice:待機しない要求の統合");
+				Check(Receive(worker, 1) == std::vector<int>({ 5 }), "Notice:タイムアウトした通知");
+			}
+
+			{
+				// キーごとに統合 ⇒ 上限に関係なく同じキーの未通知の情報に統合して、順序は最初の要求の順
+				CKeyValueNotice worker;
+
+				worker.AttachFunctionMerge(MergeSum);
+				worker.AttachFunctionKey([](const CKeyValue& object) { return object.first; });
+
+				worker.RequestNotice(CKeyValue(1, 1));
+				worker.RequestNotice(CKeyValue(2, 10));
+				worker.RequestNotice(CKeyValue(1, 2));
+				worker.RequestNotice(CKeyValue(2, 20));
+				worker.RequestNotice(CKeyValue(3, 100));
+				worker.RequestNotice(CKeyValue(1, 4));
+
+				Check(worker.GetMerged() == 3 && worker.GetDropped() == 0, "Notice:キーごとの統合の数");
+				Check(Receive(worker, 3) == std::vector<int>({ 7, 30, 100 }), "Notice:キーごとに統合した通知");
+			}
+
+			{
+				// 計測 ⇒ キーごとに統合しながら要求
+				const int count = 100000;
+				const size_t keys = 8;
+
+				CKeyValueNotice worker;
+
+				worker.AttachFunctionMerge(MergeSum);
+				worker.AttachFunctionKey([](const CKeyValue& object) { return object.first; });
+
+				auto start = std::chrono::steady_clock::now();
+
+				for (int index = 0; index < count; index++)
+				{
+					worker.RequestNotice(CKeyValue(index % keys, 1));
+				}
+
+				Report("Notice:8キーごとに統合して要求", count, Elapsed(start));
+
+				std::vector<int> received = Receive(worker, keys);
+
+				Check(received.size() == keys && received.front() == count / (int)keys, "Notice:計測の統合");
+			}
+		}
+	}
+}
\ No newline at end of file
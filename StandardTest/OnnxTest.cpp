@@ -0,0 +1,86 @@
+#include <vector>
+
+#include "Test.h"
+#include "Onnx/Onnx.h"
+
+#pragma comment(lib, "Onnx.lib")
+
+namespace Standard
+{
+	namespace Test
+	{
+		//! 計測に使うモデル ⇒ 入力:batch×3×32×32 / 出力:batch×8 (ビルド後に実行ファイルと同じフォルダへコピー)
+		const char* ConstTinyModel = "Tiny.onnx";
+
+		//! 1回の計測で推論する画像の数 ※計測するバッチサイズの公倍数
+		const int ConstSearchImage = 512;
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			バッチサイズごとの推論を計測
+		/// @detail			指定した数の画像をまとめて推論し、1画像あたりのスループットを出力する
+		/// @param[in]		batch	1回の推論で渡す画像の数
+		/// @return			true:推論の結果が画像の数と一致 / false:不一致
+		////////////////////////////////////////////////////////////////////////////////
+		static bool MeasureSearch(int batch)
+		{
+			bool ret = true;
+
+			std::vector<unsigned char> frame(Image::Size(24, 48, 64), 128);
+			std::vector<Image::CObject> objects(batch, Image::CObject(24, 48, 64, frame.data()));
+
+			auto start = std::chrono::steady_clock::now();
+
+			for (int index = 0; index < ConstSearchImage / batch; index++)
+			{
+				std::vector<std::vector<Onnx::Tensor::CObject>> results = Onnx::Search(objects);
+
+				if (results.size() != objects.size())
+				{
+					ret = false;
+				}
+			}
+
+			float elapsed = Elapsed(start);
+
+			std::cout << "計測:Onnx::Search():バッチ" << batch << ":" << ConstSearchImage << "画像:" << elapsed << "ms:" << (ConstSearchImage / elapsed) << "画像/ms" << std::endl;
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			推論
+		/// @detail			小さなモデルでバッチサイズごとのスループットを計測する
+		////////////////////////////////////////////////////////////////////////////////
+		void TestOnnx()
+		{
+			Onnx::Initialize();
+
+			try
+			{
+				Onnx::Setting::CModel setting;
+
+				// バッチサイズの上限 ⇒ 計測する最大のバッチサイズ
+				setting.Path = ConstTinyModel;
+				setting.MaxBatch = 8;
+
+				Onnx::LoadModel(setting);
+
+				std::vector<Onnx::Tensor::CObject> outputs = Onnx::GetOutputs();
+
+				Check(outputs.size() == 1, "Onnx:出力の数");
+
+				// 計測 ⇒ 同じ画像の数をバッチサイズを変えて推論
+				for (int batch : { 1, 2, 4, 8 })
+				{
+					Check(MeasureSearch(batch), "Onnx:バッチ" + std::to_string(batch) + "の推論の結果");
+				}
+			}
+			catch (const std::exception&)
+			{
+				Check(false, "Onnx:モデルの読み込みと推論");
+			}
+
+			Onnx::Destroy();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "Test.h"
+#include "Pipeline/Worker.h"
+
+namespace Standard
+{
+	namespace Test
+	{
+		//! 計測する時間[ms]
+		const int ConstPipelineMeasure = 1000;
+
+		//! 取り込みなしで待機する周期[ms]
+		const int ConstPipelineCycle = 10;
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			段ごとの処理時間を指定して、定常の速度を計測
+		/// @detail			各段は指定した時間だけ待機して、最も遅い段の平均の処理時間から求めた速度と
+		///					通知した速度を比較する ※待機の精度に依らないよう、期待値は実際の処理時間から求める
+		/// @param[in]		name	計測の名称
+		/// @param[in]		capture	取り込みの処理時間[ms]
+		/// @param[in]		preprocess	前処理の処理時間[ms]
+		/// @param[in]		infer	推論の処理時間[ms]
+		/// @return			最も遅い段の番号(0:取り込み / 1:前処理 / 2:推論)
+		////////////////////////////////////////////////////////////////////////////////
+		static int MeasurePipeline(const std::string& name, int capture, int preprocess, int infer)
+		{
+			int ret = 0;
+
+			Pipeline::Worker::CTemplate<int, int, int> pipeline;
+			std::atomic<int> sequence(0);
+
+			pipeline.AttachFunctionCapture([&](int& object)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(capture));
+				object = ++sequence;
+				return true;
+			});
+			pipeline.AttachFunctionPreprocess([&](const int& input, int& output)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(preprocess));
+				output = input;
+				return true;
+			});
+			pipeline.AttachFunctionInfer([&](const int& input, int& output)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(infer));
+				output = input;
+				return true;
+			});
+			pipeline.AttachFunctionResult([](const int&) {});
+
+			pipeline.Start();
+
+			// 待ち行列が埋まるまで待機してから、定常の統計を集計
+			std::this_thread::sleep_for(std::chrono::milliseconds(200));
+			pipeline.ResetStatistics();
+			std::this_thread::sleep_for(std::chrono::milliseconds(ConstPipelineMeasure));
+
+			std::vector<Pipeline::Statistics::CObject> statistics = pipeline.GetStatistics();
+
+			pipeline.Stop();
+
+			// 最も遅い段 ⇒ 平均の処理時間が最大の段
+			for (int stage = 1; stage < 3; stage++)
+			{
+				if (statistics[ret].Average < statistics[stage].Average)
+				{
+					ret = stage;
+				}
+			}
+
+			double expected = 1000.0 / statistics[ret].Average;
+			double sustained = statistics[3].Throughput;
+
+			std::cout << "計測:" << name << ":最も遅い段:" << statistics[ret].Name << ":" << statistics[ret].Average << "ms:期待値:" << expected << "fps:通知:" << sustained << "fps:取り込みの破棄:" << statistics[0].Dropped << "回" << std::endl;
+
+			Check(expected * 0.85 < sustained && sustained < expected * 1.05, name + ":最も遅い段に律速");
+			Check(statistics[0].Dropped > 0, name + ":遅れた取り込みの破棄");
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			段ごとのパイプライン
+		////////////////////////////////////////////////////////////////////////////////
+		void TestPipeline()
+		{
+			{
+				// 取り込みなし ⇒ 直ちに取り込み直さずに周期で待機
+				Pipeline::Stage::CSource<int> source;
+				std::atomic<int> called(0);
+
+				source.AttachFunctionCapture([&](int&)
+				{
+					called += 1;
+					return false;
+				});
+
+				source.SetCycle(ConstPipelineCycle);
+				source.Start();
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+				source.Stop();
+
+				// 周期ごとの呼び出し回数 + 起床の誤差
+				Check(0 < called && called <= 200 / ConstPipelineCycle + 5, "Pipeline:取り込みなしの周期");
+			}
+
+			// 推論が最も遅い ⇒ 前処理も推論を待機して、推論の速度で通知
+			Check(MeasurePipeline("Pipeline:推論が律速", 2, 4, 10) == 2, "Pipeline:推論が律速の段");
+
+			// 前処理が最も遅い ⇒ 推論は前処理を待って、前処理の速度で通知
+			Check(MeasurePipeline("Pipeline:前処理が律速", 2, 12, 4) == 1, "Pipeline:前処理が律速の段");
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Test.h"
+#include "Common/Utility/RingQueue.h"
+
+namespace Standard
+{
+	namespace Test
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CThrowing
+		/// @brief      代入で例外を発生させるデータのクラス
+		////////////////////////////////////////////////////////////////////////////////
+		class CThrowing
+		{
+		public:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			コンストラクタ
+			////////////////////////////////////////////////////////////////////////////////
+			CThrowing()
+			{
+				Value = 0;
+				Fail = false;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			コピー代入演算子
+			/// @detail			失敗を指定した場合は例外を発砲
+			/// @return			自クラス
+			////////////////////////////////////////////////////////////////////////////////
+			CThrowing& operator = (const CThrowing& object)
+			{
+				if (object.Fail)
+				{
+					throw std::runtime_error("代入の失敗");
+				}
+
+				this->Value = object.Value;
+				this->Fail = object.Fail;
+
+				return *this;
+			}
+
+		public:
+			//! 値
+			int Value;
+
+			//! 代入を失敗させるか
+			bool Fail;
+		};
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			リングバッファ
+		////////////////////////////////////////////////////////////////////////////////
+		void TestRingQueue()
+		{
+			{
+				// 容量は2のべき乗に切り上げ
+				Utility::CRingQueue<int> queue(5);
+
+				Check(queue.GetCapacity() == 8, "RingQueue:容量");
+
+				// 容量まで追加 ⇒ 上限を超えた分は追加できない
+				for (int index = 0; index < 8; index++)
+				{
+					Check(queue.Push(index), "RingQueue:追加");
+				}
+
+				Check(queue.Push(8) == false, "RingQueue:上限");
+				Check(queue.GetRejected() == 1, "RingQueue:追加できなかった数");
+				Check(queue.GetDepth() == 8, "RingQueue:保持数");
+				Check(queue.GetHighWatermark() == 8, "RingQueue:最大の保持数");
+
+				// 追加した順に取り出し
+				int value = -1;
+
+				for (int index = 0; index < 8; index++)
+				{
+					Check(queue.Pop(value) && value == index, "RingQueue:取り出しの順序");
+				}
+
+				Check(queue.Pop(value) == false, "RingQueue:データなし");
+
+				// 1周した後も追加・取り出しできる
+				std::vector<int> values;
+
+				Check(queue.Push(10) && queue.Push(11), "RingQueue:2周目の追加");
+				Check(queue.Drain(values) == 2 && values[0] == 10 && values[1] == 11, "RingQueue:まとめて取り出し");
+			}
+
+			{
+				// 代入の例外 ⇒ 例外を再送して、後続の要素は取り出せる
+				Utility::CRingQueue<CThrowing> queue(4);
+
+				CThrowing object;
+				bool thrown = false;
+
+				object.Value = 1;
+				queue.Push(object);
+
+				try
+				{
+					object.Fail = true;
+					queue.Push(object);
+				}
+				catch (const std::exception&)
+				{
+					thrown = true;
+				}
+
+				Check(thrown, "RingQueue:代入の例外を再送");
+
+				object.Fail = false;
+				object.Value = 3;
+				Check(queue.Push(object), "RingQueue:例外後の追加");
+
+				CThrowing result;
+
+				Check(queue.Pop(result) && result.Value == 1, "RingQueue:例外前の要素");
+				Check(queue.Pop(result) && result.Value == 3, "RingQueue:無効な要素を読み飛ばし");
+				Check(queue.Pop(result) == false, "RingQueue:例外後のデータなし");
+
+				// 無効な要素の位置も再利用できる
+				for (int index = 0; index < 4; index++)
+				{
+					object.Value = index;
+					Check(queue.Push(object), "RingQueue:例外後の容量");
+				}
+			}
+
+			{
+				// 複数スレッドから追加 ⇒ スレッドごとの順序を保って全て取り出せる
+				const int producer = 4;
+				const int count = 100000;
+
+				Utility::CRingQueue<int> queue(1024);
+				std::vector<std::thread> threads;
+				std::vector<int> nexts(producer, 0);
+
+				auto start = std::chrono::steady_clock::now();
+
+				for (int thread = 0; thread < producer; thread++)
+				{
+					threads.emplace_back([&queue, thread, count]()
+					{
+						for (int index = 0; index < count; index++)
+						{
+							// 上限の場合は取り出しを待つ
+							while (queue.Push(thread * count + index) == false)
+							{
+								std::this_thread::yield();
+							}
+						}
+					});
+				}
+
+				int total = 0;
+				bool order = true;
+
+				while (total < producer * count)
+				{
+					int value = 0;
+
+					if (queue.Pop(value))
+					{
+						int thread = value / count;
+
+						order = order && (value % count == nexts[thread]);
+						nexts[thread] += 1;
+						total += 1;
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+				}
+
+				for (auto& thread : threads)
+				{
+					thread.join();
+				}
+
+				Report("RingQueue:4スレッドから追加", (size_t)total, Elapsed(start));
+
+				Check(order, "RingQueue:スレッドごとの順序");
+				Check(queue.GetDepth() == 0, "RingQueue:全て取り出し");
+			}
+		}
+	}
+}
\ No newline at end of file
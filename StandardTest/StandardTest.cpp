@@ -0,0 +1,59 @@
+#include <iostream>
+
+#include "Test.h"
+
+using namespace Standard;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief			メイン関数
+/// @detail			ハードウェアに依存しない部品の確認と計測を行う
+/// @return			失敗した確認の数 ※0:全て成功
+////////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	// リングバッファ
+	Test::TestRingQueue();
+
+	// 画像
+	Test::TestImage();
+
+	// 画素フォーマットの変換
+	Test::TestFormat();
+
+	// ログのバイナリ形式
+	Test::TestBinary();
+
+	// 処理時間の分布
+	Test::TestHistogram();
+
+	// 信号の通知
+	Test::TestSubject();
+
+	// 通知する情報が上限に達した場合の動作
+	Test::TestNotice();
+
+	// 軸とIOの状態
+	Test::TestStatus();
+
+	// カメラの連続取り込み
+	Test::TestGrabber();
+
+	// 軸のレジスタの変換とまとめて読み込む範囲
+	Test::TestAxis();
+
+	// スレッドの制御
+	Test::TestThread();
+
+	// 段ごとのパイプライン
+	Test::TestPipeline();
+
+	// 推論
+	Test::TestOnnx();
+
+	// ログの転送 ※破棄した後は出力できないため最後に呼び出す
+	Test::TestTransfer();
+
+	std::cout << ((Test::GetFailure() == 0) ? "OK" : "NG") << ":失敗" << Test::GetFailure() << std::endl;
+
+	return Test::GetFailure();
+}
\ No newline at end of file
@@ -0,0 +1,253 @@
+#include <stdexcept>
+#include <string>
+
+#include "Test.h"
+#include "Common/Axis/Status.h"
+#include "Common/Io/Status.h"
+
+namespace Standard
+{
+	namespace Test
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			軸の状態(入力)の通知を作成
+		/// @param[in]		sequence	通知の連番
+		/// @param[in]		previous	直前に通知した連番
+		/// @param[in]		id	軸の識別子
+		/// @param[in]		position	現在の座標
+		/// @return			軸の状態(入力)
+		////////////////////////////////////////////////////////////////////////////////
+		static Axis::Status::CInput CreateAxis(uint64_t sequence, uint64_t previous, int id, double position)
+		{
+			Axis::Status::CInput ret;
+
+			ret.Sequence = sequence;
+			ret.Previous = previous;
+			ret.Timestamp = (int64_t)sequence * 1000;
+			ret.AddDriver(id).Coordinate.Set(Axis::Status::Input::CoordinateCurrent, position);
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			軸とIOの状態
+		////////////////////////////////////////////////////////////////////////////////
+		void TestStatus()
+		{
+			{
+				// 信号 ⇒ 有効な信号だけ保持
+				Axis::Status::Input::CSignal signal;
+
+				signal.Set(Axis::Status::Input::MotionServo, true);
+				signal.Set(Axis::Status::Input::MotionRunning, false);
+				signal.Set(Axis::Status::Input::ConstSignal, true);
+
+				Check(signal.IsValid(Axis::Status::Input::MotionServo) && signal.Get(Axis::Status::Input::MotionServo), "Status:信号の値");
+				Check(signal.IsValid(Axis::Status::Input::MotionRunning) && signal.Get(Axis::Status::Input::MotionRunning) == false, "Status:信号のOFF");
+				Check(signal.IsValid(Axis::Status::Input::MotionOrigin) == false, "Status:未取得の信号");
+				Check(signal.IsValid(Axis::Status::Input::ConstSignal) == false && signal.Valid == 0x0A, "Status:範囲外の信号");
+			}
+
+			{
+				// 変化した信号 ⇒ 新規or変化ありだけ有効
+				Axis::Status::Input::CSignal before;
+				Axis::Status::Input::CSignal after;
+
+				before.Set(0, true);
+				before.Set(1, false);
+				before.Set(2, true);
+
+				after.Set(0, true);
+				after.Set(1, true);
+				after.Set(2, false);
+				after.Set(3, false);
+
+				Axis::Status::Input::CSignal change = after.GetChange(before);
+
+				Check(change.IsValid(0) == false, "Status:変化なしの信号");
+				Check(change.IsValid(1) && change.Get(1), "Status:OFF→ONの信号");
+				Check(change.IsValid(2) && change.Get(2) == false, "Status:ON→OFFの信号");
+				Check(change.IsValid(3) && change.Get(3) == false, "Status:新規の信号");
+				Check(change.Valid == 0x0E && change.Values == 0x02, "Status:変化した信号のビット");
+
+				// 変化前が全て無効 ⇒ 有効な信号は全て新規
+				Check(after.GetChange(Axis::Status::Input::CSignal()).Valid == after.Valid, "Status:初回の信号");
+
+				// 今回が無効な信号は通知しない
+				Check(before.GetChange(after).IsValid(3) == false, "Status:無効になった信号");
+			}
+
+			{
+				// 信号の追加 ⇒ 有効な信号だけ上書き
+				Axis::Status::Input::CSignal signal;
+				Axis::Status::Input::CSignal change;
+
+				signal.Set(0, true);
+				signal.Set(1, true);
+
+				change.Set(1, false);
+				change.Set(2, true);
+
+				signal += change;
+
+				Check(signal.Get(0) && signal.Get(1) == false && signal.Get(2), "Status:信号の追加");
+				Check(signal.Valid == 0x07, "Status:追加した信号の有効");
+			}
+
+			{
+				// 座標の変化と追加
+				Axis::Status::Input::CCoordinate before;
+				Axis::Status::Input::CCoordinate after;
+
+				before.Set(Axis::Status::Input::CoordinatePositiveLimit, 100.0);
+				before.Set(Axis::Status::Input::CoordinateCurrent, 1.5);
+
+				after.Set(Axis::Status::Input::CoordinatePositiveLimit, 100.0);
+				after.Set(Axis::Status::Input::CoordinateNegativeLimit, -100.0);
+				after.Set(Axis::Status::Input::CoordinateCurrent, 2.5);
+
+				Axis::Status::Input::CCoordinate change = after.GetChange(before);
+
+				Check(change.IsValid(Axis::Status::Input::CoordinatePositiveLimit) == false, "Status:変化なしの座標");
+				Check(change.IsValid(Axis::Status::Input::CoordinateNegativeLimit) && change.Get(Axis::Status::Input::CoordinateNegativeLimit) == -100.0, "Status:新規の座標");
+				Check(change.IsValid(Axis::Status::Input::CoordinateCurrent) && change.Get(Axis::Status::Input::CoordinateCurrent) == 2.5, "Status:変化した座標");
+
+				before += change;
+
+				Check(before.Get(Axis::Status::Input::CoordinatePositiveLimit) == 100.0 && before.Get(Axis::Status::Input::CoordinateCurrent) == 2.5, "Status:座標の追加");
+				Check(before.Valid == after.Valid && after.GetChange(before).Valid == 0, "Status:追加後は変化なし");
+			}
+
+			{
+				// 機器の状態の変化
+				Axis::Status::Input::CDriver before;
+				Axis::Status::Input::CDriver after;
+
+				before.Id = after.Id = 3;
+				before.Motion.Set(Axis::Status::Input::MotionServo, true);
+				after.Motion.Set(Axis::Status::Input::MotionServo, true);
+
+				Check(after.GetChange(before).IsValid() == false, "Status:機器の変化なし");
+
+				after.Alarm.Set(5, true);
+
+				Axis::Status::Input::CDriver change = after.GetChange(before);
+
+				Check(change.IsValid() && change.Id == 3 && change.Alarm.Get(5) && change.Motion.Valid == 0, "Status:機器の変化");
+			}
+
+			{
+				// 通知の統合 ⇒ 軸の識別子ごとに追加して、直前の連番は最初の通知
+				Axis::Status::CInput merged;
+
+				merged += CreateAxis(5, 4, 1, 10.0);
+				merged += CreateAxis(6, 5, 2, 20.0);
+				merged += CreateAxis(7, 6, 1, 11.0);
+
+				Check(merged.Drivers.size() == 2, "Status:軸の数");
+				Check(merged.GetDriver(1).Coordinate.Get(Axis::Status::Input::CoordinateCurrent) == 11.0, "Status:軸の最新の座標");
+				Check(merged.GetDriver(2).Coordinate.Get(Axis::Status::Input::CoordinateCurrent) == 20.0, "Status:軸の座標");
+				Check(merged.Sequence == 7 && merged.Previous == 4 && merged.Timestamp == 7000, "Status:統合した連番");
+
+				bool thrown = false;
+
+				try
+				{
+					merged.GetDriver(9);
+				}
+				catch (const std::exception&)
+				{
+					thrown = true;
+				}
+
+				Check(thrown, "Status:未登録の軸");
+
+				// 代入は置き換え
+				merged = CreateAxis(8, 7, 3, 30.0);
+
+				Check(merged.Drivers.size() == 1 && merged.FindDriver(3) == 0 && merged.Previous == 7, "Status:軸の代入");
+			}
+
+			{
+				// IOの通知の統合 ⇒ アドレスごとに最新の値、直前の連番は最初の通知
+				Io::Specify::CAddress first;
+				Io::Specify::CAddress second;
+
+				first.Category = "X";
+				first.Index = 1;
+				second.Category = "X";
+				second.Index = 2;
+
+				Io::Status::CInput notice1;
+				Io::Status::CInput notice2;
+				Io::Status::CInput merged;
+
+				notice1.Sequence = 10;
+				notice1.Previous = 9;
+				notice1.Values[first] = true;
+
+				notice2.Sequence = 11;
+				notice2.Previous = 10;
+				notice2.Timestamp = 11000;
+				notice2.Values[first] = false;
+				notice2.Values[second] = true;
+
+				merged += notice1;
+				merged += notice2;
+
+				Check(merged.Values.size() == 2, "Status:IOのアドレス数");
+				Check(boost::any_cast<bool>(merged.Values.at(first)) == false && boost::any_cast<bool>(merged.Values.at(second)), "Status:IOの最新の値");
+				Check(merged.Sequence == 11 && merged.Previous == 9 && merged.Timestamp == 11000, "Status:IOの統合した連番");
+
+				// 代入は置き換え
+				merged = notice1;
+
+				Check(merged.Values.size() == 1 && merged.Sequence == 10 && merged.Previous == 9, "Status:IOの代入");
+			}
+
+			{
+				// 計測 ⇒ 8軸の変化を取得して統合
+				const int count = 100000;
+
+				Axis::Status::CInput before;
+				Axis::Status::CInput after;
+				Axis::Status::CInput merged;
+
+				for (int id = 0; id < 8; id++)
+				{
+					before.AddDriver(id).Motion.Set(Axis::Status::Input::MotionServo, true);
+					after.AddDriver(id).Motion.Set(Axis::Status::Input::MotionServo, true);
+				}
+
+				size_t changed = 0;
+
+				auto start = std::chrono::steady_clock::now();
+
+				for (int index = 0; index < count; index++)
+				{
+					Axis::Status::CInput change;
+
+					after.Drivers[index % 8].Coordinate.Set(Axis::Status::Input::CoordinateCurrent, index);
+
+					for (size_t driver = 0; driver < after.Drivers.size(); driver++)
+					{
+						Axis::Status::Input::CDriver value = after.Drivers[driver].GetChange(before.Drivers[driver]);
+
+						if (value.IsValid())
+						{
+							change.Drivers.push_back(value);
+						}
+					}
+
+					changed += change.Drivers.size();
+					merged += change;
+					before = after;
+				}
+
+				Report("Status:8軸の変化を取得して統合", count, Elapsed(start));
+
+				Check(changed == (size_t)count && merged.Drivers.size() == 8, "Status:計測の変化");
+			}
+		}
+	}
+}
\ No newline at end of file
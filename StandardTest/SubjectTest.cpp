@@ -0,0 +1,217 @@
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Test.h"
+#include "Signal/Subject.h"
+
+namespace Standard
+{
+	namespace Test
+	{
+		//! 通知する関数の定義
+		typedef std::function<void(const int&)> CFunction;
+
+		//! 通知するクラスの定義
+		typedef Signal::Subject::CTemplate<int> CSubject;
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			通知を呼び出して例外を確認
+		/// @param[in]		subject	通知するクラス
+		/// @param[in]		value	通知するデータ
+		/// @return			例外のメッセージ ※空:例外なし
+		////////////////////////////////////////////////////////////////////////////////
+		static std::string Call(CSubject& subject, int value)
+		{
+			std::string ret;
+
+			try
+			{
+				subject.CallingFunction(value);
+			}
+			catch (const std::exception& e)
+			{
+				ret = e.what();
+
+				if (ret.empty())
+				{
+					ret = "例外";
+				}
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			信号の通知
+		////////////////////////////////////////////////////////////////////////////////
+		void TestSubject()
+		{
+			{
+				// 登録・追加・解除
+				CSubject subject;
+				std::vector<int> called;
+
+				auto first = std::make_shared<CFunction>([&called](const int& value) { called.push_back(value); });
+				auto second = std::make_shared<CFunction>([&called](const int& value) { called.push_back(value * 10); });
+
+				Check(Call(subject, 1).empty() == false, "Subject:登録なし");
+
+				subject.RegistrationFunction(first);
+				subject.AppendFunction(second);
+
+				Check(Call(subject, 2).empty() && called == std::vector<int>({ 2, 20 }), "Subject:登録順に通知");
+
+				// 登録は置き換え
+				called.clear();
+				subject.RegistrationFunction(second);
+
+				Check(Call(subject, 3).empty() && called == std::vector<int>({ 30 }), "Subject:登録で置き換え");
+
+				// 無効になった関数は呼ばない
+				called.clear();
+				second.reset();
+
+				Check(Call(subject, 4).empty() == false && called.empty(), "Subject:無効な関数");
+
+				// 複製した一覧は元の解除に影響されない
+				subject.RegistrationFunction(first);
+
+				CSubject copy(subject);
+
+				subject.CancellationFunction();
+				called.clear();
+
+				Check(Call(subject, 5).empty() == false && Call(copy, 5).empty() && called == std::vector<int>({ 5 }), "Subject:複製");
+			}
+
+			{
+				// 関数の例外 ⇒ 残りの関数も通知して、最後に発砲
+				CSubject subject;
+				int count = 0;
+
+				auto throwing = std::make_shared<CFunction>([](const int&) { throw std::runtime_error("失敗"); });
+				auto counting = std::make_shared<CFunction>([&count](const int&) { count++; });
+
+				subject.RegistrationFunction(throwing);
+				subject.AppendFunction(counting);
+
+				Check(Call(subject, 1).empty() == false && count == 1, "Subject:例外後の通知");
+			}
+
+			{
+				// 静的関数 ⇒ 登録せずに直接呼び出し
+				int count = 0;
+
+				auto function = std::make_shared<CFunction>([&count](const int& value) { count += value; });
+				std::weak_ptr<CFunction> weak = function;
+
+				CSubject::CallingFunction(weak, 3);
+
+				Check(count == 3, "Subject:静的関数");
+
+				function.reset();
+
+				bool thrown = false;
+
+				try
+				{
+					CSubject::CallingFunction(weak, 3);
+				}
+				catch (const std::exception&)
+				{
+					thrown = true;
+				}
+
+				Check(thrown, "Subject:静的関数の無効な関数");
+			}
+
+			{
+				// 通知中の登録・解除 ⇒ 通知は取得済みの一覧で続ける
+				const int threads = 4;
+				const int count = 100000;
+
+				CSubject subject;
+				std::atomic<int> called(0);
+				std::atomic<bool> stop(false);
+
+				auto function = std::make_shared<CFunction>([&called](const int&) { called.fetch_add(1, std::memory_order_relaxed); });
+
+				subject.RegistrationFunction(function);
+
+				std::thread updater([&subject, &stop, function]
+				{
+					while (stop.load() == false)
+					{
+						auto other = std::make_shared<CFunction>([](const int&) {});
+
+						subject.AppendFunction(other);
+						subject.RegistrationFunction(function);
+					}
+				});
+
+				std::vector<std::thread> workers;
+
+				auto start = std::chrono::steady_clock::now();
+
+				for (int thread = 0; thread < threads; thread++)
+				{
+					workers.emplace_back([&subject, count]
+					{
+						for (int index = 0; index < count; index++)
+						{
+							subject.CallingFunction(index);
+						}
+					});
+				}
+
+				for (auto& worker : workers)
+				{
+					worker.join();
+				}
+
+				Report("Subject:" + std::to_string(threads) + "スレッドから通知(登録の入れ替え中)", (size_t)threads * count, Elapsed(start));
+
+				stop.store(true);
+				updater.join();
+
+				Check(called.load() == threads * count, "Subject:同時に通知");
+			}
+
+			{
+				// 計測 ⇒ 1スレッドから通知
+				const int count = 1000000;
+
+				CSubject subject;
+				int total = 0;
+
+				auto function = std::make_shared<CFunction>([&total](const int& value) { total += value & 1; });
+				std::weak_ptr<CFunction> weak = function;
+
+				subject.RegistrationFunction(function);
+
+				auto start = std::chrono::steady_clock::now();
+
+				for (int index = 0; index < count; index++)
+				{
+					subject.CallingFunction(index);
+				}
+
+				Report("Subject::CallingFunction()", count, Elapsed(start));
+
+				start = std::chrono::steady_clock::now();
+
+				for (int index = 0; index < count; index++)
+				{
+					CSubject::CallingFunction(weak, index);
+				}
+
+				Report("Subject::CallingFunction()(静的関数)", count, Elapsed(start));
+
+				Check(total == count, "Subject:計測の通知");
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+namespace Standard
+{
+	namespace Test
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			失敗した確認の数を取得
+		/// @return			失敗した確認の数
+		////////////////////////////////////////////////////////////////////////////////
+		inline int& GetFailure()
+		{
+			static int ret = 0;
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			結果を確認
+		/// @detail			失敗した場合は名称を出力して、失敗した確認の数を更新する
+		/// @param[in]		condition	確認する条件
+		/// @param[in]		name	確認の名称
+		////////////////////////////////////////////////////////////////////////////////
+		inline void Check(bool condition, const std::string& name)
+		{
+			if (condition == false)
+			{
+				std::cout << "NG:" << name << std::endl;
+
+				GetFailure() += 1;
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			経過時間を取得
+		/// @param[in]		start	開始時刻
+		/// @return			経過時間[ms]
+		////////////////////////////////////////////////////////////////////////////////
+		inline float Elapsed(std::chrono::steady_clock::time_point start)
+		{
+			return std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			計測結果を出力
+		/// @param[in]		name	計測の名称
+		/// @param[in]		count	処理した回数
+		/// @param[in]		elapsed	経過時間[ms]
+		////////////////////////////////////////////////////////////////////////////////
+		inline void Report(const std::string& name, size_t count, float elapsed)
+		{
+			std::cout << "計測:" << name << ":" << count << "回:" << elapsed << "ms";
+
+			if (0 < elapsed)
+			{
+				std::cout << ":" << (count / elapsed) << "回/ms";
+			}
+
+			std::cout << std::endl;
+		}
+
+		// リングバッファ
+		void TestRingQueue();
+
+		// 画像
+		void TestImage();
+
+		// 画素フォーマットの変換
+		void TestFormat();
+
+		// ログのバイナリ形式
+		void TestBinary();
+
+		// 処理時間の分布
+		void TestHistogram();
+
+		// 信号の通知
+		void TestSubject();
+
+		// 通知する情報が上限に達した場合の動作
+		void TestNotice();
+
+		// 軸とIOの状態
+		void TestStatus();
+
+		// カメラの連続取り込み
+		void TestGrabber();
+
+		// 軸のレジスタの変換とまとめて読み込む範囲
+		void TestAxis();
+
+		// スレッドの制御
+		void TestThread();
+
+		// 段ごとのパイプライン
+		void TestPipeline();
+
+		// 推論
+		void TestOnnx();
+
+		// ログの転送 ※破棄した後は出力できないため最後に呼び出す
+		void TestTransfer();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,331 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "Test.h"
+#include "Common/Metrics/Histogram.h"
+#include "Thread/Worker.h"
+
+namespace Standard
+{
+	namespace Test
+	{
+		//! メイン関数の周期[ms]
+		const int ConstWakeCycle = 50;
+
+		//! メイン関数の処理時間[ms]
+		const int ConstWakeWork = 2;
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			現在時刻を取得
+		/// @return			現在時刻[us]
+		////////////////////////////////////////////////////////////////////////////////
+		static int64_t NowWake()
+		{
+			return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CWakeAction
+		/// @brief      メイン関数の処理を記録するクラス
+		////////////////////////////////////////////////////////////////////////////////
+		class CWakeAction
+		{
+		public:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			コンストラクタ
+			////////////////////////////////////////////////////////////////////////////////
+			CWakeAction()
+			{
+				Count = 0;
+				Start = 0;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			メイン関数の処理
+			/// @detail			開始時刻を記録してから回数を更新し、一定時間だけ処理する
+			////////////////////////////////////////////////////////////////////////////////
+			void Act()
+			{
+				Start = NowWake();
+				Count += 1;
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(ConstWakeWork));
+			}
+
+		public:
+			//! 処理した回数
+			std::atomic<uint64_t> Count;
+
+			//! 最後に処理を開始した時刻[us]
+			std::atomic<int64_t> Start;
+		};
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CWakeWorker
+		/// @brief      動作要求で起床するスレッドのクラス
+		///				⇒ スレッドの制御を行うテンプレートのクラスから派生
+		////////////////////////////////////////////////////////////////////////////////
+		class CWakeWorker
+			: public Thread::Worker::CTemplate
+		{
+		public:
+			//! メイン関数の処理の記録
+			CWakeAction Action;
+
+		protected:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			メイン関数の処理
+			/// @return			タイムアウト時間[ms]
+			////////////////////////////////////////////////////////////////////////////////
+			int MainAction() override
+			{
+				Action.Act();
+
+				return ConstWakeCycle;
+			}
+		};
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CLegacyWakeWorker
+		/// @brief      変更前の動作要求の待機を再現するクラス
+		/// @detail		通番を確認せずに条件変数で待機するため、処理中の起床は失われてタイムアウトまで待つ
+		////////////////////////////////////////////////////////////////////////////////
+		class CLegacyWakeWorker
+		{
+		public:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			コンストラクタ
+			////////////////////////////////////////////////////////////////////////////////
+			CLegacyWakeWorker()
+			{
+				m_stop = false;
+				m_thread = std::thread([this] { Main(); });
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			デストラクタ
+			////////////////////////////////////////////////////////////////////////////////
+			~CLegacyWakeWorker()
+			{
+				m_stop = true;
+				m_thread.join();
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			動作要求を起床
+			////////////////////////////////////////////////////////////////////////////////
+			void WakeupRequestAction()
+			{
+				m_requestAction.notify_one();
+			}
+
+		private:
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			メイン関数
+			////////////////////////////////////////////////////////////////////////////////
+			void Main()
+			{
+				while (m_stop == false)
+				{
+					{
+						// 排他制御
+						std::unique_lock<std::mutex> lock(m_asyncRequestAction);
+
+						// 動作要求待ち
+						m_requestAction.wait_for(lock, std::chrono::milliseconds(ConstWakeCycle));
+					}
+
+					Action.Act();
+				}
+			}
+
+		public:
+			//! メイン関数の処理の記録
+			CWakeAction Action;
+
+		private:
+			//! 停止要求
+			std::atomic<bool> m_stop;
+
+			//! 排他制御クラス(動作要求用)
+			std::mutex m_asyncRequestAction;
+
+			//! 動作要求
+			std::condition_variable m_requestAction;
+
+			//! メイン関数のスレッド
+			std::thread m_thread;
+		};
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			起床の遅延を計測
+		/// @detail			メイン関数の処理中と待機中に交互に起床して、
+		///					起床してから次のメイン関数の処理が始まるまでの時間を集計する
+		/// @param[in]		name	計測の名称
+		/// @param[in]		wakeup	動作要求を起床する関数
+		/// @param[in]		action	メイン関数の処理の記録
+		/// @return			集計結果
+		////////////////////////////////////////////////////////////////////////////////
+		static Metrics::Snapshot::CObject MeasureWake(const std::string& name, std::function<void()> wakeup, CWakeAction& action)
+		{
+			const int count = 60;
+
+			Metrics::CHistogram histogram;
+
+			// 最初のメイン関数の処理を待機
+			while (action.Count == 0)
+			{
+				std::this_thread::yield();
+			}
+
+			for (int index = 0; index < count; index++)
+			{
+				// 奇数回目は処理の終了後の待機中に起床 ⇒ 偶数回目は処理を開始した直後の処理中に起床
+				if (index % 2 == 1)
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(ConstWakeWork * 3));
+				}
+
+				uint64_t before = action.Count;
+				int64_t start = NowWake();
+
+				wakeup();
+
+				// 次のメイン関数の処理を待機
+				while (action.Count == before)
+				{
+					std::this_thread::yield();
+				}
+
+				histogram.Record((uint64_t)(std::max)((int64_t)0, action.Start - start));
+			}
+
+			Metrics::Snapshot::CObject ret = histogram.GetSnapshot(false);
+
+			std::cout << "計測:" << name << ":" << ret.Count << "回:p50:" << ret.P50 << "ms:p99:" << ret.P99 << "ms:max:" << ret.Maximum << "ms" << std::endl;
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			スレッドの制御
+		////////////////////////////////////////////////////////////////////////////////
+		void TestThread()
+		{
+			{
+				// 起床の遅延 ⇒ 変更前は処理中の起床が失われて周期まで待つ
+				CLegacyWakeWorker legacy;
+
+				MeasureWake("Thread:起床の遅延(変更前)", [&] { legacy.WakeupRequestAction(); }, legacy.Action);
+			}
+
+			{
+				// 起床の遅延 ⇒ 処理中の起床も処理後に直ちに扱う
+				CWakeWorker worker;
+
+				worker.Start();
+
+				auto snapshot = MeasureWake("Thread:起床の遅延", [&] { worker.WakeupRequestAction(); }, worker.Action);
+
+				worker.Stop();
+
+				Check(snapshot.P99 < ConstWakeCycle / 2.0, "Thread:起床の遅延(p99)");
+			}
+
+			{
+				// 共有のスレッドプール ⇒ 停止は登録済みの処理が全て戻るまで待機
+				// ※スレッドプールの全スレッドを塞いで、メイン関数の処理が未処理のまま停止する
+				const size_t threads = (std::max)(2U, std::thread::hardware_concurrency());
+
+				boost::asio::io_service& service = Thread::Executor::GetService();
+				std::atomic<size_t> blocking(0);
+				std::atomic<bool> release(false);
+
+				for (size_t thread = 0; thread < threads; thread++)
+				{
+					service.post([&]
+					{
+						blocking += 1;
+
+						while (release == false)
+						{
+							std::this_thread::sleep_for(std::chrono::milliseconds(1));
+						}
+					});
+				}
+
+				while (blocking < threads)
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+
+				CWakeWorker worker;
+				std::atomic<bool> stopped(false);
+
+				worker.SetExecutor(true);
+				worker.Start();
+
+				std::thread stopper([&]
+				{
+					worker.Stop();
+					stopped = true;
+				});
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(ConstWakeCycle * 2));
+
+				Check(stopped == false && worker.Action.Count == 0, "Thread:未処理の登録がある間は停止を待機");
+
+				release = true;
+				stopper.join();
+
+				uint64_t count = worker.Action.Count;
+
+				Check(count == 1, "Thread:登録済みの処理を実行してから停止");
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(ConstWakeCycle * 2));
+
+				Check(worker.Action.Count == count, "Thread:停止後は処理しない");
+			}
+
+			{
+				// 計測 ⇒ タイマーで待機中に停止して直ちに破棄 ※取り消したタイマーの処理が戻るまで停止を待機
+				const int count = 100;
+
+				bool prompt = true;
+
+				auto start = std::chrono::steady_clock::now();
+
+				for (int index = 0; index < count; index++)
+				{
+					CWakeWorker worker;
+
+					worker.SetExecutor(true);
+					worker.Start();
+
+					while (worker.Action.Count == 0)
+					{
+						std::this_thread::yield();
+					}
+
+					auto stop = std::chrono::steady_clock::now();
+
+					worker.Stop();
+
+					// タイマーの満了を待たずに停止
+					if (ConstWakeCycle <= Elapsed(stop))
+					{
+						prompt = false;
+					}
+				}
+
+				Report("Thread:共有のスレッドプールで開始して停止", count, Elapsed(start));
+
+				Check(prompt, "Thread:待機中のタイマーを取り消して停止");
+			}
+		}
+	}
+}
\ No newline at end of file
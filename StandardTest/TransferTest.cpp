@@ -0,0 +1,125 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Test.h"
+#include "Transfer/Transfer.h"
+
+namespace Standard
+{
+	namespace Test
+	{
+		//! 1回で出力するログの数 ※保持するログの容量(8192)以下
+		const int ConstOutputRound = 8000;
+
+		//! 出力を繰り返す回数
+		const int ConstOutputRepeat = 10;
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ログの出力を計測
+		/// @detail			指定したスレッド数から同時に出力して、1スレッドの1回あたりの時間を出力する
+		///					繰り返しの間は送信するスレッドが保持するログを送信し終えるまで待機する
+		/// @param[in]		name	計測の名称
+		/// @param[in]		threads	出力するスレッド数
+		/// @return			true:例外なし / false:例外あり
+		////////////////////////////////////////////////////////////////////////////////
+		static bool MeasureOutput(const std::string& name, int threads)
+		{
+			bool ret = true;
+
+			float elapsed = 0;
+			uint64_t dropped = Transfer::GetDropped();
+
+			for (int repeat = 0; repeat < ConstOutputRepeat; repeat++)
+			{
+				std::vector<std::thread> producers;
+				std::atomic<int> ready(0);
+				std::atomic<bool> start(false);
+				std::atomic<bool> thrown(false);
+
+				for (int thread = 0; thread < threads; thread++)
+				{
+					producers.emplace_back([&, thread]
+					{
+						Logging::CObject logging;
+
+						logging.Level = Logging::LevelInfomation;
+						logging.Message << "StandardTest:Transfer::Output():" << thread;
+
+						ready += 1;
+
+						while (start == false)
+						{
+							std::this_thread::yield();
+						}
+
+						try
+						{
+							for (int index = 0; index < ConstOutputRound / threads; index++)
+							{
+								Transfer::Output(logging);
+							}
+						}
+						catch (...)
+						{
+							thrown = true;
+						}
+					});
+				}
+
+				// 全スレッドの準備を待機
+				while (ready < threads)
+				{
+					std::this_thread::yield();
+				}
+
+				auto begin = std::chrono::steady_clock::now();
+
+				start = true;
+
+				for (auto& producer : producers)
+				{
+					producer.join();
+				}
+
+				elapsed += Elapsed(begin);
+
+				if (thrown)
+				{
+					ret = false;
+				}
+
+				// 保持するログの送信を待機
+				std::this_thread::sleep_for(std::chrono::milliseconds(100));
+			}
+
+			size_t count = (size_t)ConstOutputRound * ConstOutputRepeat;
+
+			std::cout << "計測:" << name << ":" << count << "回:" << elapsed << "ms:" << (elapsed * 1000000.0 * threads / count) << "ns/回:破棄" << (Transfer::GetDropped() - dropped) << "回" << std::endl;
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ログの転送
+		/// @detail			破棄した後は出力できないため、最後に呼び出す
+		////////////////////////////////////////////////////////////////////////////////
+		void TestTransfer()
+		{
+			try
+			{
+				// 既定の設定 ⇒ ローカルへUDPで送信
+				Transfer::Initialize(Transfer::Setting::CObject());
+
+				Check(MeasureOutput("Transfer::Output():1スレッド", 1), "Transfer:1スレッドから出力");
+				Check(MeasureOutput("Transfer::Output():4スレッドから同時", 4), "Transfer:4スレッドから同時に出力");
+
+				Transfer::Destroy();
+			}
+			catch (const std::exception&)
+			{
+				Check(false, "Transfer:初期化と破棄");
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <algorithm>
+#include <thread>
+
+#include "boost/asio.hpp"
+#include "boost/asio/steady_timer.hpp"
+#include "boost/thread.hpp"
+
+#include "Transfer/Transfer.h"
+
+namespace Standard
+{
+	namespace Thread
+	{
+		namespace Executor
+		{
+			////////////////////////////////////////////////////////////////////////////////
+			/// @class      CWorker
+			/// @brief      複数のスレッドの制御で共有するスレッドプールのクラス
+			///	@detail		CPUのコア数だけスレッドを起動してIOサービスを実行する
+			///				スレッドの制御ごとの直列化はストランドで行う
+			///				プロセスで1つだけTransferのDLLが保持し、GetService()で参照する
+			////////////////////////////////////////////////////////////////////////////////
+			class CWorker
+			{
+			public:
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コンストラクタ
+				////////////////////////////////////////////////////////////////////////////////
+				CWorker()
+				{
+					// スレッド数をCPUのコア数で確定 ⇒ 最低でも2スレッド
+					std::size_t count = (std::max)(2U, std::thread::hardware_concurrency());
+
+					m_work.reset(new boost::asio::io_service::work(m_service));
+
+					// スレッド数だけ走査
+					for (std::size_t index = 0; index < count; index++)
+					{
+						m_group.create_thread(boost::bind(&boost::asio::io_service::run, &m_service));
+					}
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			コピー代入演算子
+				/// @detail			※無効にする
+				////////////////////////////////////////////////////////////////////////////////
+				CWorker& operator = (const CWorker& object) = delete;
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			デストラクタ
+				/// @detail			スレッドの終了を待つため、ローダーロックの中(DLLの解放時)では呼び出さない
+				////////////////////////////////////////////////////////////////////////////////
+				virtual ~CWorker()
+				{
+					// IOサービスを停止
+					m_work.reset();
+					m_group.join_all();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			IOサービスを取得
+				/// @return			IOサービス
+				////////////////////////////////////////////////////////////////////////////////
+				boost::asio::io_service& GetService()
+				{
+					return m_service;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			スレッド数を取得
+				/// @return			スレッド数
+				////////////////////////////////////////////////////////////////////////////////
+				std::size_t GetSize()
+				{
+					return m_group.size();
+				}
+
+			private:
+				//! IOサービス
+				boost::asio::io_service m_service;
+
+				//! IOサービスのワーカー
+				boost::shared_ptr<boost::asio::io_service::work> m_work;
+
+				//! IOサービスを実行するスレッドのグループ
+				boost::thread_group m_group;
+			};
+
+			// 共有のスレッドプールのIOサービスを取得 ※未生成の場合は生成
+			TRANSFER_API boost::asio::io_service& GetService();
+
+			// 共有のスレッドプールを破棄 ※全てのスレッドの制御を停止してから呼び出す
+			TRANSFER_API void Destroy();
+		}
+	}
+}
\ No newline at end of file
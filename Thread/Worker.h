@@ -3,6 +3,7 @@
 #include <mutex>
 
 #include "Common/Tool/Logging.h"
+#include "Thread/Executor.h"
 #include "Exception/Convert.h"
 #include "Transfer/Transfer.h"
 
@@ -16,30 +17,37 @@ namespace Standard
 		{
 			////////////////////////////////////////////////////////////////////////////////
 			/// @class      CTemplate
-			/// @brief      Xbh̐sev[g̃NX
+			/// @brief      スレッドの制御を行うテンプレートのクラス
 			////////////////////////////////////////////////////////////////////////////////
 			class CTemplate
 			{
 			public:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			RXgN^
+				/// @brief			コンストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate()
 				{
 					m_requestStop = false;
 					m_running = false;
 					m_cycle = 10;
+					m_sequenceRequestAction = 0;
+					m_sequenceConfirmed = 0;
+					m_executor = false;
+					m_executing = false;
+					m_waitingExecutor = false;
+					m_generationExecutor = 0;
+					m_pendingExecutor = 0;
 					m_name = "Thread::";
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Rs[Zq
-				/// @detail			ɂ
+				/// @brief			コピー代入演算子
+				/// @detail			※無効にする
 				////////////////////////////////////////////////////////////////////////////////
 				CTemplate& operator = (const CTemplate& object) = delete;
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			fXgN^
+				/// @brief			デストラクタ
 				////////////////////////////////////////////////////////////////////////////////
 				virtual ~CTemplate()
 				{
@@ -48,39 +56,70 @@ namespace Standard
 
 					logging.Message << GetName() << "~CTemplate()" << Logging::ConstSeparator;
 
-					// ~
+					// 停止
 					Stop();
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			C֐̎XV
-				/// @param[in]		value	C֐̎[ms]
+				/// @brief			メイン関数の周期を更新
+				/// @param[in]		value	メイン関数の周期[ms]
 				////////////////////////////////////////////////////////////////////////////////
 				void SetCycle(int value)
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncCycle);
 
-					// C֐̎XV
+					// メイン関数の周期を更新
 					m_cycle = value;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̂XV
-				/// @param[in]		name	
+				/// @brief			共有のスレッドプールで実行するかを更新
+				/// @detail			開始する前に呼び出す
+				///					メイン関数の処理で長時間ブロックする場合は使用しない
+				/// @param[in]		value	true:共有のスレッドプールで実行 / false:専用のスレッドで実行
+				////////////////////////////////////////////////////////////////////////////////
+				void SetExecutor(bool value)
+				{
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncMainThread);
+
+					// 共有のスレッドプールで実行するかを更新
+					m_executor = value;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			共有のスレッドプールで実行するかを取得
+				/// @return			true:共有のスレッドプールで実行 / false:専用のスレッドで実行
+				////////////////////////////////////////////////////////////////////////////////
+				bool GetExecutor()
+				{
+					bool ret = false;
+
+					// 排他制御
+					std::lock_guard<std::recursive_mutex> lock(m_asyncMainThread);
+
+					ret = m_executor;
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			名称を更新
+				/// @param[in]		name	名称
 				////////////////////////////////////////////////////////////////////////////////
 				void SetName(const std::string& name)
 				{
-					// ̂XV
+					// 名称を更新
 					m_name = name;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Jn
+				/// @brief			開始
 				////////////////////////////////////////////////////////////////////////////////
 				void Start() throw(...)
 				{
@@ -89,19 +128,19 @@ namespace Standard
 
 					logging.Message << GetName() << "Start()" << Logging::ConstSeparator;
 
-					// ~
+					// 停止
 					Stop();
 
-					// C֐̊Jn
+					// メイン関数の開始
 					StartMain();
 
-					// Oo
+					// ログ出力
 					Transfer::Output(Logging::Join(logging, postscript.str()));
 					postscript.str("");
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			~
+				/// @brief			停止
 				////////////////////////////////////////////////////////////////////////////////
 				void Stop() throw(...)
 				{
@@ -112,92 +151,109 @@ namespace Standard
 
 					do
 					{
-						// C֐̒~mF
+						// メイン関数の停止を確認
 						if (IsStopMain())
 						{
-							// ~
+							// 停止中
 							break;
 						}
 
-						// ~vON
+						// 停止要求をON
 						SetRequestStop(true);
 
-						// vN
+						// 動作要求を起床
 						WakeupRequestAction();
 
-						// C֐̒~҂
+						// メイン関数の停止待ち
 						StopMain();
 
-						// ~vOFF
+						// 停止要求をOFF
 						SetRequestStop(false);
 
-						// Oo
+						// ログ出力
 						Transfer::Output(Logging::Join(logging, postscript.str()));
 						postscript.str("");
 					} while (false);
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			vN
+				/// @brief			動作要求を起床
 				////////////////////////////////////////////////////////////////////////////////
 				void WakeupRequestAction()
 				{
-					// vN
+					{
+						// 排他制御
+						std::lock_guard<std::mutex> lock(m_asyncRequestAction);
+
+						// 動作要求の通番を更新
+						// ※待機に入る直前の要求も取りこぼさないように排他の中で更新する
+						m_sequenceRequestAction += 1;
+
+						// 共有のスレッドプールで待機中か確認
+						if (m_waitingExecutor)
+						{
+							// 待機を解除 ⇒ ストランドでメイン関数の処理を起床
+							m_waitingExecutor = false;
+							PostExecutor([this] { WakeupExecutor(); });
+						}
+					}
+
+					// 動作要求を起床
 					m_requestAction.notify_one();
 				}
 
 			protected:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			̂擾
-				/// @return			
+				/// @brief			名称を取得
+				/// @return			名称
 				////////////////////////////////////////////////////////////////////////////////
 				std::string GetName()
 				{
 					std::string ret = "";
 
-					// ̂擾
+					// 名称を取得
 					ret = m_name;
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			~v擾
-				/// @return			~vtO
+				/// @brief			停止要求を取得
+				/// @return			停止要求フラグ
 				////////////////////////////////////////////////////////////////////////////////
 				bool GetRequestStop()
 				{
 					bool ret = false;
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncRequestStop);
 
-					// ~vtO擾
+					// 停止要求フラグを取得
 					ret = m_requestStop;
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			C֐̎擾
-				/// @return			C֐̎[ms]
+				/// @brief			メイン関数の周期を取得
+				/// @return			メイン関数の周期[ms]
 				////////////////////////////////////////////////////////////////////////////////
 				int GetCycle()
 				{
 					int ret = 0;
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncCycle);
 
-					// C֐̎擾
+					// メイン関数の周期を取得
 					ret = m_cycle;
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			Ȉ
-				///	@detail			hŋLq
+				/// @brief			終了の処理
+				///	@detail			★派生先で記述する
 				////////////////////////////////////////////////////////////////////////////////
 				virtual void Finish() throw(...)
 				{
@@ -205,10 +261,10 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			C֐̏
-				///	@detail			hŋLq
-				/// @return			^CAEg[ms]
-				///					l10000ms
+				/// @brief			メイン関数の処理
+				///	@detail			★派生先で記述する
+				/// @return			タイムアウト時間[ms]
+				///					※初期値は10000ms
 				////////////////////////////////////////////////////////////////////////////////
 				virtual int MainAction() throw(...)
 				{
@@ -216,223 +272,521 @@ namespace Standard
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			^]XV
-				/// @param[in]		value	true:^] / false:~
+				/// @brief			運転中を更新
+				/// @param[in]		value	true:運転中 / false:停止中
 				////////////////////////////////////////////////////////////////////////////////
 				void SetRunning(bool value)
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncRunning);
 
-					// ^]tOXV
+					// 運転中フラグを更新
 					m_running = value;
 				}
 
 			private:
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			~vXV
-				/// @param[in]		value	true:~vݒ / false:~v
+				/// @brief			停止要求を更新
+				/// @param[in]		value	true:停止要求を設定 / false:停止要求を解除
 				////////////////////////////////////////////////////////////////////////////////
 				void SetRequestStop(bool value)
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncRequestStop);
 
-					// ~vtOXV
+					// 停止要求フラグを更新
 					m_requestStop = value;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			^]擾
-				/// @return			^]tO
+				/// @brief			運転中を取得
+				/// @return			運転中フラグ
 				////////////////////////////////////////////////////////////////////////////////
 				bool GetRunning()
 				{
 					bool ret = false;
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncRunning);
 
-					// ^]tO擾
+					// 運転中フラグを取得
 					ret = m_running;
 
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			C֐XbhJn
+				/// @brief			メイン関数スレッドを開始
 				////////////////////////////////////////////////////////////////////////////////
 				void StartMain()
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncMainThread);
 
-					// C֐X^[g
+					// 共有のスレッドプールで実行するか確認
+					if (m_executor)
+					{
+						// 共有のスレッドプールでメイン関数スタート
+						StartExecutor();
+						return;
+					}
+
+					// メイン関数スタート
 					m_mainThread = std::thread([this] { Main(); });
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			C֐Xbh̒~擾
-				/// @return			true:~ / false:쒆
+				/// @brief			メイン関数スレッドの停止を取得
+				/// @return			true:停止中 / false:動作中
 				////////////////////////////////////////////////////////////////////////////////
 				bool IsStopMain()
 				{
 					bool ret = true;
 
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncMainThread);
 
-					// C֐̋NmF
+					// メイン関数の起床を確認
 					if (m_mainThread.joinable())
 					{
 						ret = false;
 					}
 
+					// 排他制御
+					std::lock_guard<std::mutex> lockExecutor(m_asyncExecutor);
+
+					// 共有のスレッドプールでの実行と未処理の登録を確認
+					if (m_executing || 0 < m_pendingExecutor)
+					{
+						ret = false;
+					}
+
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			C֐Xbh~
+				/// @brief			メイン関数スレッドを停止
 				////////////////////////////////////////////////////////////////////////////////
 				void StopMain()
 				{
-					// r
+					// 排他制御
 					std::lock_guard<std::recursive_mutex> lock(m_asyncMainThread);
 
-					// C֐̋NmF
+					// メイン関数の起床を確認
 					if (m_mainThread.joinable())
 					{
-						// C֐̒~҂
+						// メイン関数の停止待ち
 						m_mainThread.join();
 					}
+
+					// 排他制御
+					std::unique_lock<std::mutex> lockExecutor(m_asyncExecutor);
+
+					// 共有のスレッドプールでの終了待ち
+					// ※取り消したタイマーなど登録済みの処理が全て戻るまで待つ ⇒ 停止後に自クラスを参照しない
+					m_finishExecutor.wait(lockExecutor, [this] { return m_executing == false && m_pendingExecutor == 0; });
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			未処理の動作要求を確認
+				/// @detail			排他制御の中で呼び出す
+				/// @return			true:未処理の動作要求あり / false:未処理の動作要求なし
+				////////////////////////////////////////////////////////////////////////////////
+				bool IsPendingRequestAction()
+				{
+					bool ret = false;
+
+					// 動作要求の通番を確認
+					if (m_sequenceConfirmed != m_sequenceRequestAction)
+					{
+						// 未処理の動作要求あり
+						ret = true;
+					}
+
+					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			v̊Ď҂
-				/// @param[in]		timeout	^CAEg[ms] 0菬ꍇ́
+				/// @brief			動作要求の監視待ち
+				/// @detail			未処理の動作要求がある場合は待たずに戻る
+				/// @param[in]		timeout	タイムアウト[ms] ※0より小さい場合は∞
 				////////////////////////////////////////////////////////////////////////////////
 				std::cv_status WaitRequestAction(int timeout)
 				{
 					std::cv_status ret = std::cv_status::timeout;
 
+					// 排他制御
+					std::unique_lock<std::mutex> lock(m_asyncRequestAction);
+
 					do
 					{
-						// ^CAEgmF
-						if (timeout == 0)
+						// 未処理の動作要求を確認
+						if (IsPendingRequestAction())
 						{
-							// ^CAEgȂ
+							// 動作要求あり
+							ret = std::cv_status::no_timeout;
 							break;
 						}
 
-						// r
-						std::unique_lock<std::mutex> lock(m_asyncRequestAction);
+						// タイムアウトを確認
+						if (timeout == 0)
+						{
+							// タイムアウトなし
+							break;
+						}
 
-						// ^CAEǵmF
+						// タイムアウトの∞を確認
 						if (timeout < 0)
 						{
-							// v҂
-							m_requestAction.wait(lock);
+							// 動作要求待ち
+							m_requestAction.wait(lock, [this] { return IsPendingRequestAction(); });
 
-							// 
+							// 正常
 							ret = std::cv_status::no_timeout;
 							break;
 						}
 
-						// v҂
-						ret = m_requestAction.wait_for(lock, std::chrono::milliseconds(timeout));
+						// 動作要求待ち
+						if (m_requestAction.wait_for(lock, std::chrono::milliseconds(timeout), [this] { return IsPendingRequestAction(); }))
+						{
+							// 正常
+							ret = std::cv_status::no_timeout;
+						}
 					} while (false);
 
+					// 確認済みの通番を更新 ⇒ ここまでの動作要求はメイン関数の処理で扱う
+					m_sequenceConfirmed = m_sequenceRequestAction;
+
 					return ret;
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
-				/// @brief			C֐
+				/// @brief			メイン関数の処理を実行
+				/// @param[in,out]	timeout	次の動作要求の監視待ちのタイムアウト[ms]
+				/// @return			true:継続 / false:終了
 				////////////////////////////////////////////////////////////////////////////////
-				void Main()
+				bool Action(int& timeout)
 				{
-					Logging::CObject logging;
-					std::stringstream postscript;
-					Exception::EnumCode errorCode = Exception::CodeUnknown;
-					int deviceErrorCode = Exception::DeviceCodeSuccess;
-
-					logging.Message << GetName() << "Main()" << Logging::ConstSeparator;
-
-					int timeout;
-
-					// ^CAEg
-					timeout = 0;
+					bool ret = false;
 
-					while (true)
+					try
 					{
-						try
+						do
 						{
-							// v̊Ď҂
-							std::cv_status result = WaitRequestAction(timeout);
-
-							// C֐̏
+							// メイン関数の処理
 							timeout = MainAction();
 
-							// ~vmF
+							// 停止要求を確認
 							if (GetRequestStop() == false)
 							{
-								continue;
+								ret = true;
+								break;
 							}
 
-							// ^]mF
+							// 運転中を確認
 							if (GetRunning())
 							{
-								// ^CAEg
+								// タイムアウトを初期化
 								timeout = 0;
-								continue;
+								ret = true;
+								break;
 							}
 
-							// I
+							// 終了
 							Finish();
+						} while (false);
+					}
+					catch (const std::exception& e)
+					{
+						Logging::CObject logging;
+
+						// 例外の発生時だけログのクラスを生成 ⇒ 周期ごとに文字列を生成しない
+						logging.Message << GetName() << "Main()" << Logging::ConstSeparator;
+
+						// 例外の処理 ⇒ ログのクラスに変換して出力
+						Transfer::Output(Exception::Convert::Logging(logging, "", e));
+						ret = false;
+					}
+
+					return ret;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			メイン関数
+				////////////////////////////////////////////////////////////////////////////////
+				void Main()
+				{
+					int timeout;
+
+					// タイムアウトを初期化
+					timeout = 0;
+
+					while (true)
+					{
+						// 動作要求の監視待ち
+						WaitRequestAction(timeout);
+
+						// メイン関数の処理を実行
+						if (Action(timeout) == false)
+						{
+							// 終了
 							break;
 						}
-						catch (const std::exception& e)
+					}
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			共有のスレッドプールでメイン関数を開始
+				////////////////////////////////////////////////////////////////////////////////
+				void StartExecutor()
+				{
+					boost::asio::io_service& service = Executor::GetService();
+
+					// ストランドとタイマーを生成 ⇒ 自クラスの処理は同時に実行されない
+					// ※停止済みで登録済みの処理はないため、破棄後に生成し直したスレッドプールにも対応する
+					m_timer.reset(new boost::asio::steady_timer(service));
+					m_strand.reset(new boost::asio::io_service::strand(service));
+
+					{
+						// 排他制御
+						std::lock_guard<std::mutex> lock(m_asyncExecutor);
+
+						// 実行中を更新
+						m_executing = true;
+					}
+
+					// メイン関数の処理を登録
+					PostExecutor([this] { StepExecutor(); });
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			共有のスレッドプールへ処理を登録
+				/// @detail			登録した処理が戻るまでは停止を完了しない
+				/// @param[in]		function	ストランドで実行する処理
+				////////////////////////////////////////////////////////////////////////////////
+				template <typename FFunction>
+				void PostExecutor(FFunction function)
+				{
+					// 未処理の登録数を更新
+					AcquireExecutor();
+
+					m_strand->post([this, function]
+					{
+						function();
+
+						// 未処理の登録数を更新
+						ReleaseExecutor();
+					});
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			共有のスレッドプールへの未処理の登録数を加算
+				////////////////////////////////////////////////////////////////////////////////
+				void AcquireExecutor()
+				{
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_asyncExecutor);
+
+					m_pendingExecutor += 1;
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			共有のスレッドプールへの未処理の登録数を減算
+				/// @detail			登録した処理の最後に呼び出す ⇒ 以降は自クラスを参照しない
+				////////////////////////////////////////////////////////////////////////////////
+				void ReleaseExecutor()
+				{
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_asyncExecutor);
+
+					m_pendingExecutor -= 1;
+
+					// 停止待ちに通知
+					m_finishExecutor.notify_all();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			共有のスレッドプールでメイン関数の処理を1回実行
+				/// @detail			ストランドの中で呼び出される
+				////////////////////////////////////////////////////////////////////////////////
+				void StepExecutor()
+				{
+					int timeout = 0;
+
+					{
+						// 排他制御
+						std::lock_guard<std::mutex> lock(m_asyncRequestAction);
+
+						// 確認済みの通番を更新 ⇒ ここまでの動作要求はメイン関数の処理で扱う
+						m_sequenceConfirmed = m_sequenceRequestAction;
+					}
+
+					// メイン関数の処理を実行
+					if (Action(timeout))
+					{
+						// 継続 ⇒ 次の処理を登録
+						ScheduleExecutor(timeout);
+						return;
+					}
+
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_asyncExecutor);
+
+					// 実行中を解除して終了を通知
+					m_executing = false;
+					m_finishExecutor.notify_all();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			共有のスレッドプールで次の処理を登録
+				/// @detail			ストランドの中で呼び出される
+				/// @param[in]		timeout	タイムアウト[ms] ※0より小さい場合は∞
+				////////////////////////////////////////////////////////////////////////////////
+				void ScheduleExecutor(int timeout)
+				{
+					// 排他制御
+					std::lock_guard<std::mutex> lock(m_asyncRequestAction);
+
+					// 未処理の動作要求 or タイムアウトなしを確認
+					if (IsPendingRequestAction() || timeout == 0)
+					{
+						// 直ちに次の処理を登録
+						PostExecutor([this] { StepExecutor(); });
+						return;
+					}
+
+					// 動作要求の待機を開始
+					m_waitingExecutor = true;
+					m_generationExecutor += 1;
+
+					// タイムアウトの∞を確認
+					if (timeout < 0)
+					{
+						// 動作要求のみで起床
+						return;
+					}
+
+					unsigned long long generation = m_generationExecutor;
+
+					// 未処理の登録数を更新 ⇒ 取り消した場合もタイマーの処理は呼び出される
+					AcquireExecutor();
+
+					// タイムアウトで起床するタイマーを登録
+					m_timer->expires_from_now(std::chrono::milliseconds(timeout));
+					m_timer->async_wait(m_strand->wrap([this, generation](const boost::system::error_code&)
+					{
+						TimeoutExecutor(generation);
+
+						// 未処理の登録数を更新
+						ReleaseExecutor();
+					}));
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			共有のスレッドプールで動作要求を受信
+				/// @detail			ストランドの中で呼び出される
+				////////////////////////////////////////////////////////////////////////////////
+				void WakeupExecutor()
+				{
+					// 待機中のタイマーを解除 ⇒ タイマーの処理は世代の確認で無視される
+					m_timer->cancel();
+
+					// メイン関数の処理を実行
+					StepExecutor();
+				}
+
+				////////////////////////////////////////////////////////////////////////////////
+				/// @brief			共有のスレッドプールでタイムアウトを受信
+				/// @detail			ストランドの中で呼び出される
+				/// @param[in]		generation	待機の世代
+				////////////////////////////////////////////////////////////////////////////////
+				void TimeoutExecutor(unsigned long long generation)
+				{
+					{
+						// 排他制御
+						std::lock_guard<std::mutex> lock(m_asyncRequestAction);
+
+						// 待機中で同じ世代か確認
+						if (m_waitingExecutor == false || m_generationExecutor != generation)
 						{
-							// Ȍ  ÕNXɕϊďo
-							Transfer::Output(Exception::Convert::Logging(logging, postscript.str(), e));
-							postscript.str("");
-							break;
+							// 動作要求で起床済み or 古いタイマー
+							return;
 						}
+
+						// 待機を解除
+						m_waitingExecutor = false;
 					}
+
+					// メイン関数の処理を実行
+					StepExecutor();
 				}
 
 			protected:
-				//! rNX(~vtOp)
+				//! 排他制御クラス(停止要求フラグ用)
 				std::recursive_mutex m_asyncRequestStop;
 
-				//! ~vtO
+				//! 停止要求フラグ
 				bool m_requestStop;
 
-				//! rNX(^]tOp)
+				//! 排他制御クラス(運転中フラグ用)
 				std::recursive_mutex m_asyncRunning;
 
-				//! ^]tO
+				//! 運転中フラグ
 				bool m_running;
 
-				//! rNX(C֐̎p)
+				//! 排他制御クラス(メイン関数の周期用)
 				std::recursive_mutex m_asyncCycle;
 
-				//! C֐̎[ms]
+				//! メイン関数の周期[ms]
 				int m_cycle;
 
 			private:
-				//! rNX(vp)
+				//! 排他制御クラス(動作要求用)
 				std::mutex m_asyncRequestAction;
 
-				//! v
+				//! 動作要求
 				std::condition_variable m_requestAction;
 
-				//! rNX(C֐Xbhp)
+				//! 動作要求の通番
+				unsigned long long m_sequenceRequestAction;
+
+				//! 確認済みの動作要求の通番
+				unsigned long long m_sequenceConfirmed;
+
+				//! 排他制御クラス(メイン関数スレッド用)
 				std::recursive_mutex m_asyncMainThread;
 
-				//! C֐Xbh
+				//! メイン関数スレッド
 				std::thread m_mainThread;
 
-				//! 
+				//! 共有のスレッドプールで実行するか
+				bool m_executor;
+
+				//! 排他制御クラス(共有のスレッドプールでの実行中用)
+				std::mutex m_asyncExecutor;
+
+				//! 共有のスレッドプールでの実行中
+				bool m_executing;
+
+				//! 共有のスレッドプールでの終了
+				std::condition_variable m_finishExecutor;
+
+				//! 共有のスレッドプールで動作要求を待機中 ※動作要求用の排他制御で保護
+				bool m_waitingExecutor;
+
+				//! 共有のスレッドプールで待機した世代 ※動作要求用の排他制御で保護
+				unsigned long long m_generationExecutor;
+
+				//! 共有のスレッドプールへ登録して未処理の数 ※共有のスレッドプールでの実行中用の排他制御で保護
+				int m_pendingExecutor;
+
+				//! 自クラスの処理を直列化するストランド
+				std::unique_ptr<boost::asio::io_service::strand> m_strand;
+
+				//! 動作要求の監視待ちのタイマー
+				std::unique_ptr<boost::asio::steady_timer> m_timer;
+
+				//! 名称
 				std::string m_name;
 			};
 		}
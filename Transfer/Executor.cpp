@@ -0,0 +1,63 @@
+#include "pch.h"
+
+#include <memory>
+#include <mutex>
+
+#include "Thread/Executor.h"
+
+namespace Standard
+{
+	namespace Thread
+	{
+		namespace Executor
+		{
+			//! 排他制御クラス(共有のスレッドプール用)
+			static std::mutex _asyncExecutor;
+
+			//! 共有のスレッドプール
+			//! ※DLLの解放時にスレッドの終了を待たないように、Destroy()でのみ破棄する
+			static CWorker* _executor = nullptr;
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			共有のスレッドプールのIOサービスを取得
+			/// @detail			プロセスで1つのスレッドプールを全てのDLLで共有する
+			///					未生成の場合は生成する
+			/// @return			IOサービス
+			////////////////////////////////////////////////////////////////////////////////
+			TRANSFER_API boost::asio::io_service& GetService()
+			{
+				// 排他制御
+				std::lock_guard<std::mutex> lock(_asyncExecutor);
+
+				if (_executor == nullptr)
+				{
+					// スレッドプールを生成
+					_executor = new CWorker();
+				}
+
+				return _executor->GetService();
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/// @brief			共有のスレッドプールを破棄
+			/// @detail			スレッドの終了を待つ ※全てのスレッドの制御を停止してから呼び出す
+			///					破棄後にGetService()を呼び出した場合は生成し直す
+			////////////////////////////////////////////////////////////////////////////////
+			TRANSFER_API void Destroy()
+			{
+				std::unique_ptr<CWorker> executor;
+
+				{
+					// 排他制御
+					std::lock_guard<std::mutex> lock(_asyncExecutor);
+
+					executor.reset(_executor);
+					_executor = nullptr;
+				}
+
+				// スレッドの終了待ち ⇒ 排他制御の外で待つ
+				executor.reset();
+			}
+		}
+	}
+}
\ No newline at end of file
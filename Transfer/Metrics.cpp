@@ -0,0 +1,139 @@
+#include "pch.h"
+
+#include <sstream>
+
+#include "Metrics.h"
+#include "Common/Logging/Basis.h"
+#include "Common/Tool/Text.h"
+
+namespace Standard
+{
+	namespace Transfer
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			コンストラクタ
+		////////////////////////////////////////////////////////////////////////////////
+		CMetrics::CMetrics()
+		{
+
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			デストラクタ
+		////////////////////////////////////////////////////////////////////////////////
+		CMetrics::~CMetrics()
+		{
+
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			処理時間の分布を取得
+		/// @detail			名称が未登録の場合は登録する
+		/// @param[in]		name	名称
+		/// @return			処理時間の分布 ※破棄されないため保持して使用する
+		////////////////////////////////////////////////////////////////////////////////
+		Metrics::CHistogram& CMetrics::GetHistogram(const std::string& name)
+		{
+			// 排他制御
+			std::lock_guard<std::mutex> lock(m_asyncMetrics);
+
+			std::unique_ptr<Metrics::CHistogram>& ret = m_histograms[name];
+
+			if (ret == nullptr)
+			{
+				ret.reset(new Metrics::CHistogram());
+			}
+
+			return *ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			回数を取得
+		/// @detail			名称が未登録の場合は登録する
+		/// @param[in]		name	名称
+		/// @return			回数 ※破棄されないため保持して使用する
+		////////////////////////////////////////////////////////////////////////////////
+		Metrics::CCounter& CMetrics::GetCounter(const std::string& name)
+		{
+			// 排他制御
+			std::lock_guard<std::mutex> lock(m_asyncMetrics);
+
+			std::unique_ptr<Metrics::CCounter>& ret = m_counters[name];
+
+			if (ret == nullptr)
+			{
+				ret.reset(new Metrics::CCounter());
+			}
+
+			return *ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			集計
+		/// @param[in]		reset	true:集計した分を破棄 / false:保持
+		/// @return			名称ごとの集計結果 ※処理時間の分布 ⇒ 回数の順
+		////////////////////////////////////////////////////////////////////////////////
+		std::vector<Metrics::Snapshot::CObject> CMetrics::GetSnapshot(bool reset)
+		{
+			std::vector<Metrics::Snapshot::CObject> ret;
+
+			// 排他制御
+			std::lock_guard<std::mutex> lock(m_asyncMetrics);
+
+			// 処理時間の分布だけ走査
+			for (auto& histogram : m_histograms)
+			{
+				Metrics::Snapshot::CObject snapshot = histogram.second->GetSnapshot(reset);
+
+				snapshot.Name = histogram.first;
+
+				ret.push_back(snapshot);
+			}
+
+			// 回数だけ走査
+			for (auto& counter : m_counters)
+			{
+				Metrics::Snapshot::CObject snapshot = counter.second->GetSnapshot(reset);
+
+				snapshot.Name = counter.first;
+
+				ret.push_back(snapshot);
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			集計結果を文字列に変換
+		/// @detail			回数は集計した時間で割った頻度も出力する
+		/// @param[in]		object	集計結果
+		/// @param[in]		period	集計した時間[ms] ※0:頻度なし
+		/// @return			ログのメッセージ
+		////////////////////////////////////////////////////////////////////////////////
+		std::string CMetrics::Format(const Metrics::Snapshot::CObject& object, int64_t period)
+		{
+			std::stringstream ret;
+
+			ret << "Transfer::Metrics()" << Logging::ConstSeparator << "名称:" << object.Name;
+			ret << Logging::ConstSeparator << "回数:" << object.Count;
+
+			if (object.Kind == Metrics::Snapshot::KindHistogram && 0 < object.Count)
+			{
+				ret << Logging::ConstSeparator << "平均:" << Text::Format(3, object.Average);
+				ret << Logging::ConstSeparator << "最小:" << Text::Format(3, object.Minimum);
+				ret << Logging::ConstSeparator << "最大:" << Text::Format(3, object.Maximum);
+				ret << Logging::ConstSeparator << "p50:" << Text::Format(3, object.P50);
+				ret << Logging::ConstSeparator << "p90:" << Text::Format(3, object.P90);
+				ret << Logging::ConstSeparator << "p99:" << Text::Format(3, object.P99);
+				ret << Logging::ConstSeparator << "p99.9:" << Text::Format(3, object.P999) << "[ms]";
+			}
+
+			if (object.Kind == Metrics::Snapshot::KindCounter && 0 < period)
+			{
+				ret << Logging::ConstSeparator << "頻度:" << Text::Format(3, object.Count * 1000.0 / period) << "[回/s]";
+			}
+
+			return ret.str();
+		}
+	}
+}
\ No newline at end of file
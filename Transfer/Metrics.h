@@ -0,0 +1,53 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Common/Metrics/Histogram.h"
+#include "Common/Metrics/Snapshot.h"
+
+namespace Standard
+{
+	namespace Transfer
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CMetrics
+		/// @brief      名称ごとに処理時間の分布と回数を保持するクラス
+		/// @detail		登録したクラスは破棄しないため、呼び出し側は参照を保持して排他制御せずに追加する
+		////////////////////////////////////////////////////////////////////////////////
+		class CMetrics
+		{
+		public:
+			// コンストラクタ
+			CMetrics();
+
+			// デストラクタ
+			~CMetrics();
+
+			// 処理時間の分布を取得
+			Metrics::CHistogram& GetHistogram(const std::string& name);
+
+			// 回数を取得
+			Metrics::CCounter& GetCounter(const std::string& name);
+
+			// 集計
+			std::vector<Metrics::Snapshot::CObject> GetSnapshot(bool reset);
+
+			// 集計結果を文字列に変換
+			static std::string Format(const Metrics::Snapshot::CObject& object, int64_t period);
+
+		private:
+			//! 排他制御(登録)
+			std::mutex m_asyncMetrics;
+
+			//! 名称ごとの処理時間の分布
+			std::map<std::string, std::unique_ptr<Metrics::CHistogram>> m_histograms;
+
+			//! 名称ごとの回数
+			std::map<std::string, std::unique_ptr<Metrics::CCounter>> m_counters;
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,410 @@
+#include "pch.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "Segment.h"
+#include "Common/Logging/Basis.h"
+#include "Common/Tool/Text.h"
+
+namespace Standard
+{
+	namespace Transfer
+	{
+		//! データグラムのサイズのバイト数
+		static const size_t ConstHeader = sizeof(uint32_t);
+
+		//! ファイルの拡張子
+		static const wchar_t ConstExtension[] = L".log";
+
+		//! 作成に失敗した後に作成し直すまで待機する時間の初期値[ms]
+		static const int ConstBackoffFirst = 1000;
+
+		//! 作成に失敗した後に作成し直すまで待機する時間の上限[ms]
+		static const int ConstBackoffLimit = 60000;
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			Win32 APIのエラーを例外に変換
+		/// @param[in]		function	関数名
+		/// @param[in]		path	ファイルのパス
+		////////////////////////////////////////////////////////////////////////////////
+		static void ThrowLastError(const std::string& function, const std::wstring& path)
+		{
+			std::stringstream message;
+
+			message << function << Logging::ConstSeparator << Text::Convert(path) << Logging::ConstSeparator << "Error:" << ::GetLastError();
+
+			// 例外を発砲
+			throw std::runtime_error(message.str());
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			コンストラクタ
+		////////////////////////////////////////////////////////////////////////////////
+		CSegment::CSegment()
+		{
+			m_size = 0;
+			m_period = 0;
+			m_count = 0;
+			m_file = INVALID_HANDLE_VALUE;
+			m_mapping = nullptr;
+			m_view = nullptr;
+			m_offset = 0;
+			m_sequence = 0;
+			m_backoff = 0;
+			m_skipped = 0;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			デストラクタ
+		////////////////////////////////////////////////////////////////////////////////
+		CSegment::~CSegment()
+		{
+			// 閉じる
+			Close();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			開く
+		/// @detail			フォルダがない場合は作成して、異常終了したファイルを復旧する
+		///					ファイルは最初のデータグラムを書き込む時に作成する
+		/// @param[in]		directory	ファイルを作成するフォルダ
+		/// @param[in]		size	ファイルのサイズ[byte]
+		/// @param[in]		period	ファイルを切り替える周期[分] ※0:サイズだけで切り替え
+		/// @param[in]		count	保持するファイルの数 ※0:削除しない
+		////////////////////////////////////////////////////////////////////////////////
+		void CSegment::Open(const std::string& directory, size_t size, int period, int count)
+		{
+			// 閉じる
+			Close();
+
+			m_directory = Text::Convert(directory);
+			m_size = size;
+			m_period = period;
+			m_count = count;
+			m_files.clear();
+			m_backoff = 0;
+			m_skipped = 0;
+
+			// フォルダを作成
+			if (::CreateDirectoryW(m_directory.c_str(), nullptr) == FALSE && ::GetLastError() != ERROR_ALREADY_EXISTS)
+			{
+				ThrowLastError("CreateDirectory()", m_directory);
+			}
+
+			// 異常終了したファイルを復旧
+			Recover();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			閉じる
+		/// @detail			書き込んだサイズまで切り詰める
+		////////////////////////////////////////////////////////////////////////////////
+		void CSegment::Close()
+		{
+			// ファイルを解放
+			Release();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			データグラムを書き込み
+		/// @detail			データを書き込んでから先頭のサイズを書き込む ※サイズが0の位置が終端
+		///					作成に失敗した後は作成し直す時刻まで書き込まずに破棄する
+		/// @param[in]		value	データグラム
+		////////////////////////////////////////////////////////////////////////////////
+		void CSegment::Write(const std::string& value)
+		{
+			size_t frame = ConstHeader + value.size();
+
+			// サイズを確認
+			if (m_size < frame)
+			{
+				std::stringstream message;
+
+				message << "サイズ超過:" << value.size();
+
+				// 例外を発砲
+				throw std::runtime_error(message.str());
+			}
+
+			bool create = (m_view == nullptr) || (m_size < m_offset + frame);
+
+			// 周期を確認
+			if (create == false && 0 < m_period)
+			{
+				create = (std::chrono::minutes(m_period) <= std::chrono::steady_clock::now() - m_created);
+			}
+
+			if (create)
+			{
+				// 次のファイルへ切り替え
+				Release();
+
+				// 作成し直す時刻を確認 ⇒ 書き込むごとに作成しない
+				if (0 < m_backoff && std::chrono::steady_clock::now() < m_retry)
+				{
+					m_skipped++;
+					return;
+				}
+
+				Create();
+			}
+
+			uint32_t size = (uint32_t)value.size();
+
+			// データ ⇒ サイズの順に書き込み
+			std::memcpy(m_view + m_offset + ConstHeader, value.data(), value.size());
+			std::memcpy(m_view + m_offset, &size, ConstHeader);
+
+			m_offset += frame;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			次のファイルを作成
+		/// @detail			ファイル名は作成した現地時刻と連番で、名前順が作成順になる
+		////////////////////////////////////////////////////////////////////////////////
+		void CSegment::Create()
+		{
+			std::wstringstream path;
+
+			SYSTEMTIME time;
+
+			::GetLocalTime(&time);
+
+			path << m_directory << L"\\";
+			path << Text::Convert(Text::Format(4, time.wYear) + Text::Format(2, time.wMonth) + Text::Format(2, time.wDay));
+			path << L"_" << Text::Convert(Text::Format(2, time.wHour) + Text::Format(2, time.wMinute) + Text::Format(2, time.wSecond));
+			path << L"_" << Text::Convert(Text::Format(4, (int)(m_sequence++ % 10000)));
+			path << ConstExtension;
+
+			do
+			{
+				// ファイルを作成
+				m_file = ::CreateFileW(path.str().c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+				if (m_file == INVALID_HANDLE_VALUE)
+				{
+					break;
+				}
+
+				LARGE_INTEGER size;
+
+				size.QuadPart = (LONGLONG)m_size;
+
+				// サイズを確保 ⇒ 0で初期化される
+				if (::SetFilePointerEx(m_file, size, nullptr, FILE_BEGIN) == FALSE || ::SetEndOfFile(m_file) == FALSE)
+				{
+					break;
+				}
+
+				// メモリにマップ
+				m_mapping = ::CreateFileMappingW(m_file, nullptr, PAGE_READWRITE, size.HighPart, size.LowPart, nullptr);
+
+				if (m_mapping == nullptr)
+				{
+					break;
+				}
+
+				m_view = (char*)::MapViewOfFile(m_mapping, FILE_MAP_WRITE, 0, 0, m_size);
+
+				if (m_view == nullptr)
+				{
+					break;
+				}
+
+				m_offset = 0;
+				m_created = std::chrono::steady_clock::now();
+			} while (false);
+
+			if (m_view == nullptr)
+			{
+				std::wstring name = path.str();
+				std::stringstream function;
+
+				// エラーを取得してから解放
+				DWORD error = ::GetLastError();
+
+				Release();
+
+				// 作成し直すまで待機する時間を延ばす
+				m_backoff = (m_backoff == 0) ? ConstBackoffFirst : (std::min)(m_backoff * 2, ConstBackoffLimit);
+				m_retry = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_backoff);
+
+				function << "CreateFile()" << Logging::ConstSeparator << "破棄:" << m_skipped << Logging::ConstSeparator << "待機:" << m_backoff << "ms";
+				m_skipped = 0;
+
+				::SetLastError(error);
+
+				ThrowLastError(function.str(), name);
+			}
+
+			m_backoff = 0;
+			m_skipped = 0;
+
+			// 作成したファイルを追加して、古いファイルを削除
+			m_files.push_back(path.str());
+
+			Prune();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			異常終了したファイルを復旧
+		/// @detail			最後に作成したファイルを走査して、サイズが0か不正な位置で切り詰める
+		///					正常に閉じたファイルは切り詰め済みのため変わらない
+		///					既存のファイルも保持するファイルの数に含めて、超える分は削除する
+		////////////////////////////////////////////////////////////////////////////////
+		void CSegment::Recover()
+		{
+			WIN32_FIND_DATAW data;
+			std::vector<std::wstring> names;
+
+			// 作成したファイルを検索
+			HANDLE find = ::FindFirstFileW((m_directory + L"\\*" + ConstExtension).c_str(), &data);
+
+			if (find != INVALID_HANDLE_VALUE)
+			{
+				do
+				{
+					if ((data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+					{
+						names.push_back(data.cFileName);
+					}
+				} while (::FindNextFileW(find, &data));
+
+				::FindClose(find);
+			}
+
+			// 名前順 ⇒ 作成順
+			std::sort(names.begin(), names.end());
+
+			for (auto& name : names)
+			{
+				m_files.push_back(m_directory + L"\\" + name);
+			}
+
+			// 古いファイルを削除
+			Prune();
+
+			if (m_files.empty() == false)
+			{
+				std::wstring path = m_files.back();
+
+				HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+				if (file == INVALID_HANDLE_VALUE)
+				{
+					ThrowLastError("CreateFile()", path);
+				}
+
+				LARGE_INTEGER size;
+				LARGE_INTEGER offset;
+
+				size.QuadPart = 0;
+				offset.QuadPart = 0;
+
+				::GetFileSizeEx(file, &size);
+
+				if (0 < size.QuadPart)
+				{
+					HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+					const char* view = (mapping != nullptr) ? (const char*)::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+					if (view != nullptr)
+					{
+						// データグラムだけ走査
+						while (offset.QuadPart + (LONGLONG)ConstHeader <= size.QuadPart)
+						{
+							uint32_t frame = 0;
+
+							std::memcpy(&frame, view + offset.QuadPart, ConstHeader);
+
+							// 終端を確認
+							if (frame == 0 || size.QuadPart < offset.QuadPart + (LONGLONG)ConstHeader + frame)
+							{
+								break;
+							}
+
+							offset.QuadPart += ConstHeader + frame;
+						}
+
+						::UnmapViewOfFile(view);
+					}
+					else
+					{
+						// 走査できない ⇒ 変更しない
+						offset = size;
+					}
+
+					if (mapping != nullptr)
+					{
+						::CloseHandle(mapping);
+					}
+				}
+
+				// 書き込んだサイズまで切り詰め
+				if (offset.QuadPart < size.QuadPart)
+				{
+					::SetFilePointerEx(file, offset, nullptr, FILE_BEGIN);
+					::SetEndOfFile(file);
+				}
+
+				::CloseHandle(file);
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			古いファイルを削除
+		/// @detail			保持するファイルの数を超える分を古いファイルから削除する
+		///					削除できないファイル(他のプロセスが開いているなど)は保持の対象から外す
+		////////////////////////////////////////////////////////////////////////////////
+		void CSegment::Prune()
+		{
+			while (0 < m_count && (size_t)m_count < m_files.size())
+			{
+				// 削除 ⇒ エラーは無視
+				::DeleteFileW(m_files.front().c_str());
+
+				m_files.pop_front();
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ファイルを解放
+		/// @detail			書き込んだサイズまで切り詰める
+		////////////////////////////////////////////////////////////////////////////////
+		void CSegment::Release()
+		{
+			if (m_view != nullptr)
+			{
+				::UnmapViewOfFile(m_view);
+				m_view = nullptr;
+			}
+
+			if (m_mapping != nullptr)
+			{
+				::CloseHandle(m_mapping);
+				m_mapping = nullptr;
+			}
+
+			if (m_file != INVALID_HANDLE_VALUE)
+			{
+				LARGE_INTEGER offset;
+
+				offset.QuadPart = (LONGLONG)m_offset;
+
+				// 書き込んだサイズまで切り詰め
+				::SetFilePointerEx(m_file, offset, nullptr, FILE_BEGIN);
+				::SetEndOfFile(m_file);
+
+				::CloseHandle(m_file);
+				m_file = INVALID_HANDLE_VALUE;
+			}
+
+			m_offset = 0;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+
+namespace Standard
+{
+	namespace Transfer
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CSegment
+		/// @brief      ログをファイルへ書き込むクラス
+		/// @detail		ファイルは作成時にサイズを確保してメモリにマップし、データグラムごとに先頭へ4byteのサイズを付加して追記する
+		///				サイズを最後に書き込むため、異常終了した場合もサイズが0の位置までは有効なデータ
+		///				サイズか周期を超える場合は次のファイルへ切り替え、閉じる時に書き込んだサイズまで切り詰める
+		///				保持するファイルの数を超える場合は古いファイルから削除する
+		///				作成に失敗した場合は待機する時間を延ばしながら作成し直し、待機中のデータグラムは破棄する
+		///				送信するスレッドだけが呼び出すため、排他制御しない
+		////////////////////////////////////////////////////////////////////////////////
+		class CSegment
+		{
+		public:
+			// コンストラクタ
+			CSegment();
+
+			// デストラクタ
+			~CSegment();
+
+			// 開く
+			void Open(const std::string& directory, size_t size, int period, int count) throw(...);
+
+			// 閉じる
+			void Close();
+
+			// データグラムを書き込み
+			void Write(const std::string& value) throw(...);
+
+		private:
+			// 次のファイルを作成
+			void Create() throw(...);
+
+			// 異常終了したファイルを復旧
+			void Recover() throw(...);
+
+			// 古いファイルを削除
+			void Prune();
+
+			// ファイルを解放
+			void Release();
+
+		private:
+			//! ファイルを作成するフォルダ
+			std::wstring m_directory;
+
+			//! ファイルのサイズ[byte]
+			size_t m_size;
+
+			//! ファイルを切り替える周期[分]
+			int m_period;
+
+			//! 保持するファイルの数 ※0:削除しない
+			int m_count;
+
+			//! 保持しているファイルのパス ※作成順
+			std::deque<std::wstring> m_files;
+
+			//! ファイルのハンドル
+			HANDLE m_file;
+
+			//! ファイルマッピングのハンドル
+			HANDLE m_mapping;
+
+			//! マップしたファイルの先頭
+			char* m_view;
+
+			//! 書き込んだサイズ[byte]
+			size_t m_offset;
+
+			//! ファイルを作成した時刻
+			std::chrono::steady_clock::time_point m_created;
+
+			//! ファイルの連番 ※同じ時刻に作成した場合の区別
+			unsigned int m_sequence;
+
+			//! 作成し直すまで待機する時間[ms] ※0:失敗していない
+			int m_backoff;
+
+			//! 作成し直す時刻
+			std::chrono::steady_clock::time_point m_retry;
+
+			//! 作成し直すまで破棄したデータグラムの数
+			uint64_t m_skipped;
+		};
+	}
+}
\ No newline at end of file
@@ -1,35 +1,44 @@
 #include "pch.h"
 
+#include <atomic>
 #include <mutex>
 
 #include "Transfer.h"
+#include "Metrics.h"
+#include "Worker.h"
 #include "Common/Version/Manager.h"
-#include "Common/Communication/Udp.h"
+#include "Thread/Executor.h"
 
 namespace Standard
 {
 	namespace Transfer
 	{
-		//! I[R[h ETX(eLXgI)
-		const char ConstTerminum = 0x03;
+		//! 保持するログの容量
+		const size_t ConstCapacity = 8192;
 
-		//! rNX(tOp)
+		//! 排他制御クラス(フラグ用)
 		std::recursive_mutex _asyncFlag;
 
-		//! tO
+		//! 初期フラグ
 		static bool _initialize = false;
 
-		//! jtO
-		static bool _destroy = false;
+		//! 破棄フラグ ⇒ 出力は排他制御せずに参照
+		static std::atomic<bool> _destroy(false);
 
-		//! ]sݒNX
+		//! 出力する下限レベル ⇒ 出力は排他制御せずに参照
+		static std::atomic<int> _lower(Logging::LevelInfomation);
+
+		//! 転送を行う設定クラス
 		static Setting::CObject _setting;
 
-		//! UdpʐM̃NX
-		static Communication::Udp::CWorker _udp;
+		//! 処理時間の分布を保持するクラス ⇒ ログを転送するクラスより先に生成
+		static CMetrics _metrics;
+
+		//! ログを転送するクラス
+		static CWorker _worker(ConstCapacity, _metrics);
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			o[W̃NX擾
+		/// @brief			バージョンのクラスを取得
 		////////////////////////////////////////////////////////////////////////////////
 		TRANSFER_API Version::CObject GetVersion()
 		{
@@ -37,173 +46,252 @@ namespace Standard
 
 			Version::CManager& versionManager = Version::CManager::Instance();
 
-			// o[W̃NX擾
+			// バージョンのクラスを取得
 			ret = versionManager.GetVersion();
 
 			return ret;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			O̒ʒm֐o^
-		/// @detail			O̔ɌĂяoꂽ֐w肷
-		/// @param[in]		object	Ăяoꂽ֐
+		/// @brief			例外の通知する関数を登録
+		/// @detail			例外の発生時に呼び出されたい関数を指定する
+		/// @param[in]		object	呼び出されたい関数
 		////////////////////////////////////////////////////////////////////////////////
 		TRANSFER_API void AttachFunctionException(std::function<void(const Exception::CObject&)> object)
 		{
-			// O̒ʒm֐o^
-			_udp.AttachFunctionException(object);
+			// 例外の通知する関数を登録
+			_worker.AttachFunctionException(object);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			O̒ʒm֐
-		/// @detail			O̔ɌĂяo֐
+		/// @brief			例外の通知する関数を解除
+		/// @detail			例外の発生時に呼び出される関数を解除する
 		////////////////////////////////////////////////////////////////////////////////
 		TRANSFER_API void DetachFunctionException()
 		{
-			// O̒ʒm֐
-			_udp.DetachFunctionException();
+			// 例外の通知する関数を解除
+			_worker.DetachFunctionException();
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			
-		/// @detail			]ւ̐ڑ܂ōs
-		/// @param[in]		object	]sݒNX
+		/// @brief			初期化
+		/// @detail			転送先への接続まで行う
+		/// @param[in]		object	転送を行う設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		TRANSFER_API void Initialize(const Setting::CObject& object)
 		{
-			// r
+			// 排他制御
 			std::lock_guard<std::recursive_mutex> lock(_asyncFlag);
 
-			// jtOmF
+			// 破棄フラグを確認
 			if (_destroy)
 			{
-				// O𔭖C
+				// 例外を発砲
 				throw Exception::CObject(Exception::CodeTransferDiscarded);
 			}
 
-			// tOmF
+			// 初期フラグを確認
 			if (_initialize)
 			{
-				// O𔭖C
+				// 例外を発砲
 				throw Exception::CObject(Exception::CodeTransferInitialized);
 			}
 
-			// ]̐ݒNXRs[
+			// 転送の設定クラスをコピー
 			_setting = object;
+			_lower.store(_setting.Lower, std::memory_order_relaxed);
 
-			// M֐ڑ
-			_udp.AsyncConnect(_setting.IpAddress, _setting.Port);
+			// 送信先へ接続、ファイルを開いて送信を開始
+			_worker.Start(_setting);
 
-			// tOݒ
+			// 初期フラグを設定
 			_initialize = true;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			j
-		/// @detail			]Ɛؒf܂ōs
+		/// @brief			破棄
+		/// @detail			転送先と切断まで行う
+		///					共有のスレッドプールも破棄するため、全てのスレッドの制御を停止してから呼び出す
 		////////////////////////////////////////////////////////////////////////////////
 		TRANSFER_API void Destroy()
 		{
-			// r
+			// 排他制御
 			std::lock_guard<std::recursive_mutex> lock(_asyncFlag);
 
 			do
 			{
-				// tOmF
+				// 初期フラグを確認
 				if (_initialize == false)
 				{
 					break;
 				}
 
-				// jtOmF
+				// 破棄フラグを確認
 				if (_destroy)
 				{
 					break;
 				}
 
-				// j
-				_udp.Destroy();
+				// 破棄 ⇒ 保持しているログを送信してから停止
+				_worker.Stop();
 
-				// tO
+				// 初期フラグを解除
 				_initialize = false;
 
-				// jtOݒ
+				// 破棄フラグを設定
 				_destroy = true;
 			} while (false);
+
+			// 共有のスレッドプールを破棄 ⇒ DLLの解放時にスレッドの終了を待たない
+			Thread::Executor::Destroy();
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			O]
-		/// @detail			o͂鉺xȏ̂ݓ]
-		///					擪ɔN bt
-		/// @param[in]		object	ÕNX
+		/// @brief			ログを転送
+		/// @detail			出力する下限レベル以上のみ転送する
+		///					時刻を取得して追加するだけで、文字列への変換と送信は送信するスレッドで行う
+		///					初期化前はデバッグ出力だけ呼び出したスレッドで行い、ログは初期化後に送信する
+		///					排他制御で待機しないため、保持するログが容量の上限の場合は破棄する
+		/// @param[in]		object	ログのクラス
 		////////////////////////////////////////////////////////////////////////////////
 		TRANSFER_API void Output(const Logging::CObject& object)
 		{
-			// r
-			std::lock_guard<std::recursive_mutex> lock(_asyncFlag);
-
-			// jtOmF
-			if (_destroy)
+			// 破棄フラグを確認
+			if (_destroy.load(std::memory_order_relaxed))
 			{
-				// O𔭖C
+				// 例外を発砲
 				throw Exception::CObject(Exception::CodeTransferDiscarded);
 			}
 
 			do
 			{
-				// o͂郌xmF
-				if (object.Level < _setting.Lower)
+				// 出力するレベルを確認
+				if (object.Level < _lower.load(std::memory_order_relaxed))
 				{
-					// lႢ  ]Ȃ
+					// 下限値より低い ⇒ 転送をしない
 					break;
 				}
 
-				std::stringstream message;
-				SYSTEMTIME time;
-
-				// ݎ擾
-				::GetLocalTime(&time);
-
-				// N
-				message << Text::Format(4, time.wYear);
-				// 
-				message << "-" << Text::Format(2, time.wMonth);
-				// 
-				message << "-" << Text::Format(2, time.wDay);
-				// 
-				message << "/" << Text::Format(2, time.wHour);
-				// 
-				message << ":" << Text::Format(2, time.wMinute);
-				// b
-				message << ":" << Text::Format(2, time.wSecond);
-				// ~b
-				message << "." << Text::Format(3, time.wMilliseconds);
-
-				// x
-				message << Logging::ConstSeparator << object.Level;
-
-				// bZ[W
-				message << Logging::ConstSeparator << object.Message.str();
-
-				// I[R[h ETX(eLXgI)
-				message << (char)0x03;
-
-				// o
-				_udp.AsyncMessagePush(message.str());
-				// fobOo
-				message << "\n";
-				::OutputDebugString(Text::Convert(message.str()).c_str());
+				CRecord record;
+
+				// 現在時刻を取得
+				::GetSystemTimeAsFileTime(&record.Time);
+
+				record.Level = object.Level;
+				record.Message = object.Message.str();
+
+				// 出力 ⇒ 容量の上限の場合は破棄した数を更新
+				_worker.Push(std::move(record));
 			} while (false);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			O]
-		/// @param[in]		object	ÕNX
+		/// @brief			破棄したログの数を取得
+		/// @detail			保持するログが容量の上限で破棄した数
+		/// @return			破棄した数
+		////////////////////////////////////////////////////////////////////////////////
+		TRANSFER_API uint64_t GetDropped()
+		{
+			return _worker.GetDropped();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			出力する下限レベルを更新
+		/// @detail			初期化後も変更可能で、出力中のスレッドにも反映する
+		/// @param[in]		level	出力する下限レベル
+		////////////////////////////////////////////////////////////////////////////////
+		TRANSFER_API void SetLower(Logging::EnumLevel level)
+		{
+			// 排他制御
+			std::lock_guard<std::recursive_mutex> lock(_asyncFlag);
+
+			_setting.Lower = level;
+			_lower.store(level, std::memory_order_relaxed);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			出力する下限レベルを取得
+		/// @detail			IsOutput()が排他制御せずに参照する
+		/// @return			出力する下限レベル
+		////////////////////////////////////////////////////////////////////////////////
+		TRANSFER_API const std::atomic<int>* GetLower()
+		{
+			return &_lower;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			処理時間の分布を取得
+		/// @detail			名称が未登録の場合は登録する ※破棄されないため、呼び出し側で参照を保持する
+		///					例:static Metrics::CHistogram& histogram = Transfer::GetHistogram("Axis::ReadDerived()");
+		/// @param[in]		name	名称
+		/// @return			処理時間の分布
+		////////////////////////////////////////////////////////////////////////////////
+		TRANSFER_API Metrics::CHistogram& GetHistogram(const std::string& name)
+		{
+			return _metrics.GetHistogram(name);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			回数を取得
+		/// @detail			名称が未登録の場合は登録する ※破棄されないため、呼び出し側で参照を保持する
+		/// @param[in]		name	名称
+		/// @return			回数
+		////////////////////////////////////////////////////////////////////////////////
+		TRANSFER_API Metrics::CCounter& GetCounter(const std::string& name)
+		{
+			return _metrics.GetCounter(name);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			処理時間の分布と回数を集計
+		/// @param[in]		reset	true:集計した分を破棄 / false:保持
+		/// @return			名称ごとの集計結果
+		////////////////////////////////////////////////////////////////////////////////
+		TRANSFER_API std::vector<Metrics::Snapshot::CObject> GetMetrics(bool reset)
+		{
+			return _metrics.GetSnapshot(reset);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			処理時間の分布と回数をログとして転送
+		/// @detail			出力する下限レベルに関わらず転送する
+		/// @param[in]		reset	true:集計した分を破棄 / false:保持
+		////////////////////////////////////////////////////////////////////////////////
+		TRANSFER_API void OutputMetrics(bool reset)
+		{
+			// 破棄フラグを確認
+			if (_destroy.load(std::memory_order_relaxed))
+			{
+				// 例外を発砲
+				throw Exception::CObject(Exception::CodeTransferDiscarded);
+			}
+
+			FILETIME time;
+
+			// 現在時刻を取得
+			::GetSystemTimeAsFileTime(&time);
+
+			// 集計結果だけ走査
+			for (auto& snapshot : _metrics.GetSnapshot(reset))
+			{
+				CRecord record;
+
+				record.Time = time;
+				record.Level = Logging::LevelInfomation;
+				record.Message = CMetrics::Format(snapshot, 0);
+
+				// 出力 ⇒ 容量の上限の場合は破棄した数を更新
+				_worker.Push(std::move(record));
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ログを転送
+		/// @param[in]		object	ログのクラス
 		////////////////////////////////////////////////////////////////////////////////
 		TRANSFER_API void Output(Logging::EnumLevel level, const std::string& message)
 		{
-			// O]
+			// ログを転送
 			Output(Logging::CObject(level, message));
 		}
 	}
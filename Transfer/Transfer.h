@@ -6,10 +6,18 @@
 #define TRANSFER_API __declspec(dllimport)
 #endif
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include "Common/Exception/Basis.h"
 #include "Common/Logging/Basis.h"
+#include "Common/Metrics/Histogram.h"
+#include "Common/Metrics/Snapshot.h"
+#include "Common/Tool/Logging.h"
 #include "Common/Version/Basis.h"
 #include "Common/Transfer/Setting.h"
 
@@ -17,25 +25,88 @@ namespace Standard
 {
 	namespace Transfer
 	{
-		// o[W擾
+		// バージョンを取得
 		TRANSFER_API Version::CObject GetVersion() throw(...);
 
-		// O̒ʒm֐o^
+		// 例外の通知する関数を登録
 		TRANSFER_API void AttachFunctionException(std::function<void(const Exception::CObject&)> object);
 
-		// O̒ʒm֐
+		// 例外の通知する関数を解除
 		TRANSFER_API void DetachFunctionException();
 
-		// 
+		// 初期化
 		TRANSFER_API void Initialize(const Setting::CObject& object) throw(...);
 
-		// j
+		// 破棄
 		TRANSFER_API void Destroy() throw(...);
 
-		// o
+		// 出力
 		TRANSFER_API void Output(const Logging::CObject& value) throw(...);
 
-		// o
+		// 出力
 		TRANSFER_API void Output(Logging::EnumLevel level, const std::string& message) throw(...);
+
+		// 破棄したログの数を取得
+		TRANSFER_API uint64_t GetDropped();
+
+		// 出力する下限レベルを更新
+		TRANSFER_API void SetLower(Logging::EnumLevel level);
+
+		// 出力する下限レベルを取得 ⇒ IsOutput()から参照
+		TRANSFER_API const std::atomic<int>* GetLower();
+
+		// 処理時間の分布を取得
+		TRANSFER_API Metrics::CHistogram& GetHistogram(const std::string& name);
+
+		// 回数を取得
+		TRANSFER_API Metrics::CCounter& GetCounter(const std::string& name);
+
+		// 処理時間の分布と回数を集計
+		TRANSFER_API std::vector<Metrics::Snapshot::CObject> GetMetrics(bool reset = false);
+
+		// 処理時間の分布と回数をログとして転送
+		TRANSFER_API void OutputMetrics(bool reset = false) throw(...);
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			出力するレベルか確認 ※インライン関数
+		/// @detail			メッセージを生成する前に確認して、出力しないログの文字列を生成しない
+		///					下限レベルは排他制御せずに参照する
+		/// @param[in]		level	ログのレベル
+		/// @return			true:出力する / false:下限レベルより低い
+		////////////////////////////////////////////////////////////////////////////////
+		inline bool IsOutput(Logging::EnumLevel level)
+		{
+			static const std::atomic<int>* lower = GetLower();
+
+			return lower->load(std::memory_order_relaxed) <= level;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			出力 ※インライン関数
+		/// @detail			出力するレベルの場合だけ、追加の文字列を生成して出力する
+		///					例:Transfer::Output(Logging::LevelDebug, logging, [&](std::ostream& postscript) { postscript << "値:" << value; });
+		/// @param[in]		level	ログのレベル
+		/// @param[in]		logging	ログのクラス
+		/// @param[in]		object	追加の文字列を生成する関数 ※引数のストリームへ出力する
+		////////////////////////////////////////////////////////////////////////////////
+		template <typename FPostscript>
+		inline void Output(Logging::EnumLevel level, const Logging::CObject& logging, FPostscript object) throw(...)
+		{
+			// 出力するレベルを確認
+			if (IsOutput(level))
+			{
+				std::stringstream postscript;
+
+				// 追加の文字列を生成
+				object(postscript);
+
+				Logging::CObject buffer = Logging::Join(logging, postscript.str());
+
+				buffer.Level = level;
+
+				// 出力
+				Output(buffer);
+			}
+		}
 	}
 }
\ No newline at end of file
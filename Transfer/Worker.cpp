@@ -0,0 +1,631 @@
+#include "pch.h"
+
+#include <chrono>
+#include <sstream>
+
+#include "Worker.h"
+#include "Common/Communication/Udp.h"
+#include "Common/Tool/Exception.h"
+#include "Common/Tool/Text.h"
+#include "Common/Transfer/Binary.h"
+
+namespace Standard
+{
+	namespace Transfer
+	{
+		//! 終端コード ※ETX(テキスト終了)
+		static const char ConstTerminum = 0x03;
+
+		//! データグラムの上限[byte] ※Ethernetで分割されないサイズ
+		static const size_t ConstDatagram = 1472;
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ログの時刻を現地時刻に変換
+		/// @param[in]		object	転送するログ
+		/// @return			現地時刻(1601/1/1からのミリ秒)
+		////////////////////////////////////////////////////////////////////////////////
+		static uint64_t Local(const CRecord& object)
+		{
+			ULARGE_INTEGER ret;
+
+			FILETIME local;
+
+			// 現地時刻に変換
+			::FileTimeToLocalFileTime(&object.Time, &local);
+
+			ret.LowPart = local.dwLowDateTime;
+			ret.HighPart = local.dwHighDateTime;
+
+			// 100ナノ秒 ⇒ ミリ秒
+			return ret.QuadPart / 10000;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ログを文字列に変換
+		/// @detail			先頭に年月日 時分秒を付加する
+		/// @param[in]		object	転送するログ
+		/// @return			文字列 ※終端コードを含む
+		////////////////////////////////////////////////////////////////////////////////
+		static std::string Format(const CRecord& object)
+		{
+			std::string ret = Binary::Line(Local(object), object.Level, object.Message);
+
+			// 終端コード ※ETX(テキスト終了)
+			ret += ConstTerminum;
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			コンストラクタ
+		/// @param[in]		capacity	保持するログの容量
+		/// @param[in]		metrics	処理時間の分布を保持するクラス
+		////////////////////////////////////////////////////////////////////////////////
+		CWorker::CWorker(size_t capacity, CMetrics& metrics) : m_records(capacity), m_metrics(metrics), m_socket(m_io_service)
+		{
+			_FunctionException = nullptr;
+			m_format = Setting::FormatText;
+			m_sink = Setting::SinkUdp;
+			m_metricsPeriod = 0;
+			m_dropped.store(0, std::memory_order_relaxed);
+			m_reported = 0;
+			m_stop = false;
+			m_signal = false;
+			m_waiting.store(false, std::memory_order_relaxed);
+			m_running.store(false, std::memory_order_relaxed);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			デストラクタ
+		////////////////////////////////////////////////////////////////////////////////
+		CWorker::~CWorker()
+		{
+			// 停止
+			Stop();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			例外を通知する関数の登録
+		/// @detail			例外の発生時に呼び出されたい関数を指定する
+		/// @param[in]		object	呼び出されたい関数
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::AttachFunctionException(std::function<void(const Exception::CObject&)> object)
+		{
+			// 排他制御
+			std::lock_guard<std::recursive_mutex> lock(m_asyncException);
+
+			// 例外の通知を登録
+			_FunctionException = object;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			例外を通知する関数の解除
+		/// @detail			例外の発生時に呼び出される関数を解除する
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::DetachFunctionException()
+		{
+			// 排他制御
+			std::lock_guard<std::recursive_mutex> lock(m_asyncException);
+
+			// 例外の通知を解除
+			_FunctionException = nullptr;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			開始
+		/// @detail			送信先へ接続、ファイルを開いて、送信するスレッドを開始する
+		///					開始する前に追加したログは容量の上限まで保持して、開始後に送信する
+		/// @param[in]		object	転送を行う設定クラス
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::Start(const Setting::CObject& object)
+		{
+			std::stringstream postscript;
+
+			m_format = object.Format;
+			m_sink = object.Sink;
+			m_metricsPeriod = object.MetricsPeriod;
+
+			if (m_sink & Setting::SinkUdp)
+			{
+				try
+				{
+					boost::system::error_code error;
+
+					// 接続
+					postscript << "m_socket.connect()";
+					m_socket.connect(boost::asio::ip::udp::endpoint(boost::asio::ip::address::from_string(object.IpAddress), object.Port), error);
+
+					// エラーを確認
+					if (error)
+					{
+						std::stringstream message;
+						message << "Error:" << error;
+
+						// 例外を発砲
+						throw std::runtime_error(message.str());
+					}
+					postscript.str("");
+				}
+				catch (const std::exception& e)
+				{
+					// 例外の処理 ⇒ 例外を転送
+					TransferException(Exception::CodeUdpConnect, postscript.str(), e);
+				}
+			}
+
+			if (m_sink & Setting::SinkFile)
+			{
+				postscript.str("");
+
+				try
+				{
+					// ファイルを開く
+					postscript << "m_segment.Open()";
+					m_segment.Open(object.Directory, object.SegmentSize, object.SegmentPeriod, object.SegmentCount);
+					postscript.str("");
+				}
+				catch (const std::exception& e)
+				{
+					// 例外の処理 ⇒ 例外を転送して、UDPだけ送信
+					TransferException(Exception::CodeTransferFileOpen, postscript.str(), e);
+
+					m_sink = (Setting::EnumSink)(m_sink & ~Setting::SinkFile);
+				}
+			}
+
+			{
+				// 排他制御
+				std::lock_guard<std::mutex> lock(m_asyncThread);
+
+				m_stop = false;
+			}
+
+			m_running.store(true, std::memory_order_release);
+
+			// 送信するスレッドを開始
+			m_thread = std::thread(&CWorker::Run, this);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			停止
+		/// @detail			保持しているログを送信してから停止する
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::Stop()
+		{
+			// 以降に追加したログはデバッグ出力を追加したスレッドで行う
+			m_running.store(false, std::memory_order_release);
+
+			{
+				// 排他制御
+				std::lock_guard<std::mutex> lock(m_asyncThread);
+
+				m_stop = true;
+				m_conditionThread.notify_all();
+			}
+
+			// 送信するスレッドの終了を待機
+			if (m_thread.joinable())
+			{
+				m_thread.join();
+			}
+
+			boost::system::error_code error;
+
+			// 切断 ⇒ エラーは無視
+			m_socket.close(error);
+
+			// ファイルを閉じる ⇒ 書き込んだサイズまで切り詰め
+			m_segment.Close();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			ログを追加
+		/// @detail			複数スレッドから呼び出し可能で、送信するスレッドが待機中の場合だけ通知する
+		///					送信するスレッドの停止中はログが失われないように、デバッグ出力をここで行う
+		/// @param[in]		object	転送するログ
+		/// @return			true:追加 / false:容量の上限のため破棄
+		////////////////////////////////////////////////////////////////////////////////
+		bool CWorker::Push(CRecord&& object)
+		{
+			bool ret = false;
+
+			if (m_running.load(std::memory_order_acquire) == false)
+			{
+				// デバッグ出力 ⇒ 開始後に送信する場合は再度出力しない
+				::OutputDebugString(Text::Convert(Binary::Line(Local(object), object.Level, object.Message) + "\n").c_str());
+
+				object.Debugged = true;
+			}
+
+			ret = m_records.Push(std::move(object));
+
+			if (ret == false)
+			{
+				// 破棄した数を更新
+				m_dropped.fetch_add(1, std::memory_order_relaxed);
+			}
+			else
+			{
+				// 送信するスレッドを起床
+				Wakeup();
+			}
+
+			return ret;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			送信するスレッドを起床
+		/// @detail			待機中の場合だけ排他制御して通知する ⇒ 送信中に追加したログは次の取り出しで送信
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::Wakeup()
+		{
+			// 追加したログを送信するスレッドの確認より先に参照させる
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			if (m_waiting.load(std::memory_order_relaxed) && m_waiting.exchange(false, std::memory_order_relaxed))
+			{
+				// 排他制御
+				std::lock_guard<std::mutex> lock(m_asyncThread);
+
+				m_signal = true;
+				m_conditionThread.notify_one();
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			破棄した数を取得
+		/// @return			破棄した数
+		////////////////////////////////////////////////////////////////////////////////
+		uint64_t CWorker::GetDropped() const
+		{
+			return m_dropped.load(std::memory_order_relaxed);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			送信するスレッド
+		/// @detail			ログの追加で起床して、まとめて取り出して送信する
+		///					停止する場合は残っているログを送信してから終了する
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::Run()
+		{
+			std::vector<CRecord> records;
+			bool stop = false;
+
+			auto exported = std::chrono::steady_clock::now();
+
+			while (stop == false)
+			{
+				{
+					// 排他制御
+					std::unique_lock<std::mutex> lock(m_asyncThread);
+
+					m_waiting.store(true, std::memory_order_relaxed);
+
+					// 待機中の設定を追加したスレッドの確認より先に参照させる
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+
+					// 追加したログがない場合だけ待機
+					if (m_stop == false && m_records.GetDepth() == 0)
+					{
+						auto ready = [this] { return m_stop || m_signal; };
+
+						if (0 < m_metricsPeriod)
+						{
+							// 追加の通知か、処理時間の分布を出力する時刻まで待機
+							m_conditionThread.wait_until(lock, exported + std::chrono::seconds(m_metricsPeriod), ready);
+						}
+						else
+						{
+							// 追加の通知まで待機
+							m_conditionThread.wait(lock, ready);
+						}
+					}
+
+					m_waiting.store(false, std::memory_order_relaxed);
+					m_signal = false;
+
+					stop = m_stop;
+				}
+
+				// まとめて取り出し
+				records.clear();
+				m_records.Drain(records);
+
+				// 破棄した数を確認
+				uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+
+				if (m_reported < dropped)
+				{
+					CRecord record;
+					std::stringstream message;
+
+					::GetSystemTimeAsFileTime(&record.Time);
+					record.Level = Logging::LevelError;
+					message << "Transfer::Run()" << Logging::ConstSeparator << "破棄:" << (dropped - m_reported);
+					record.Message = message.str();
+
+					records.push_back(std::move(record));
+
+					m_reported = dropped;
+				}
+
+				// 処理時間の分布を出力する周期を確認
+				if (0 < m_metricsPeriod && std::chrono::seconds(m_metricsPeriod) <= std::chrono::steady_clock::now() - exported)
+				{
+					auto now = std::chrono::steady_clock::now();
+
+					// 処理時間の分布を集計して追加 ※前回から実際に経過した時間で頻度を算出
+					Export(records, std::chrono::duration_cast<std::chrono::milliseconds>(now - exported).count());
+
+					exported = now;
+				}
+
+				if (records.empty() == false)
+				{
+					// まとめて送信
+					Send(records);
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			処理時間の分布を集計して追加
+		/// @detail			周期ごとの値にするため、集計した分は破棄する
+		///					出力する下限レベルに関わらず出力する
+		/// @param[in,out]	objects	転送するログ
+		/// @param[in]		period	集計した時間[ms]
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::Export(std::vector<CRecord>& objects, int64_t period)
+		{
+			FILETIME time;
+
+			::GetSystemTimeAsFileTime(&time);
+
+			// 集計結果だけ走査
+			for (auto& snapshot : m_metrics.GetSnapshot(true))
+			{
+				if (snapshot.Count == 0)
+				{
+					// 周期の間に計測なし
+					continue;
+				}
+
+				CRecord record;
+
+				record.Time = time;
+				record.Level = Logging::LevelInfomation;
+				record.Message = CMetrics::Format(snapshot, period);
+
+				objects.push_back(std::move(record));
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			まとめて送信
+		/// @detail			データグラムの上限までログを詰めて送信する
+		///					上限を超えるログは単独で上限ごとに分割して送信する ※受信側は終端コードで連結
+		/// @param[in]		objects	転送するログ
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::Send(const std::vector<CRecord>& objects)
+		{
+			// 転送する形式を確認
+			if (m_format == Setting::FormatBinary)
+			{
+				// バイナリ形式
+				SendBinary(objects);
+				return;
+			}
+
+			std::string packet;
+
+			packet.reserve(ConstDatagram);
+
+			// ログだけ走査
+			for (auto& object : objects)
+			{
+				std::string message = Format(object);
+
+				if (object.Debugged == false)
+				{
+					// デバッグ出力
+					::OutputDebugString(Text::Convert(message + "\n").c_str());
+				}
+
+				std::string value = Communication::ShiftJisToUtf8(message);
+
+				// データグラムの上限を確認
+				if (ConstDatagram < packet.size() + value.size() && packet.empty() == false)
+				{
+					// 詰めたログを送信
+					Write(packet);
+					packet.clear();
+				}
+
+				if (ConstDatagram < value.size())
+				{
+					// 上限ごとに分割して送信
+					for (size_t offset = 0; offset < value.size(); offset += ConstDatagram)
+					{
+						Write(value.substr(offset, ConstDatagram));
+					}
+				}
+				else
+				{
+					packet += value;
+				}
+			}
+
+			if (packet.empty() == false)
+			{
+				// 残りを送信
+				Write(packet);
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			まとめて送信(バイナリ形式)
+		/// @detail			データグラムの上限までログを詰めて送信する ※上限を超えるログは断片に分割して送信
+		///					文字列はShift-JISのまま送信して、UTF-8への変換は復元する側で行う
+		///					デバッグ出力はデバッガが接続されている場合だけ行う
+		/// @param[in]		objects	転送するログ
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::SendBinary(const std::vector<CRecord>& objects)
+		{
+			Binary::CEncoder encoder(ConstDatagram);
+
+			bool debug = (::IsDebuggerPresent() != FALSE);
+
+			// ログだけ走査
+			for (auto& object : objects)
+			{
+				uint64_t time = Local(object);
+
+				if (debug && object.Debugged == false)
+				{
+					// デバッグ出力
+					::OutputDebugString(Text::Convert(Binary::Line(time, object.Level, object.Message) + "\n").c_str());
+				}
+
+				// データグラムの上限を確認
+				if (encoder.Append(time, object.Level, object.Message) == false)
+				{
+					if (0 < encoder.GetCount())
+					{
+						// 詰めたログを送信
+						Write(encoder.Get());
+						encoder.Clear();
+					}
+
+					if (encoder.Append(time, object.Level, object.Message) == false)
+					{
+						// 空のデータグラムにも入らない ⇒ 断片に分割して送信
+						for (auto& datagram : encoder.Split(time, object.Level, object.Message))
+						{
+							Write(datagram);
+						}
+					}
+				}
+			}
+
+			if (0 < encoder.GetCount())
+			{
+				// 残りを送信
+				Write(encoder.Get());
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			データグラムを送信
+		/// @detail			転送する先ごとに送信する
+		/// @param[in]		value	送信データ
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::Write(const std::string& value)
+		{
+			if (m_sink & Setting::SinkUdp)
+			{
+				// UDPで送信
+				WriteUdp(value);
+			}
+
+			if (m_sink & Setting::SinkFile)
+			{
+				// ファイルへ書き込み
+				WriteFile(value);
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			データグラムをUDPで送信
+		/// @param[in]		value	送信データ
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::WriteUdp(const std::string& value)
+		{
+			std::stringstream postscript;
+
+			try
+			{
+				boost::system::error_code error;
+
+				// 送信
+				postscript << "m_socket.send()";
+				m_socket.send(boost::asio::buffer(value.c_str(), value.size()), 0, error);
+
+				// エラーを確認
+				if (error)
+				{
+					std::stringstream message;
+					message << "Error:" << error;
+
+					// 例外を発砲
+					throw std::runtime_error(message.str());
+				}
+				postscript.str("");
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理 ⇒ 例外を転送
+				TransferException(Exception::CodeUdpWrite, postscript.str(), e);
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			データグラムをファイルへ書き込み
+		/// @param[in]		value	送信データ
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::WriteFile(const std::string& value)
+		{
+			std::stringstream postscript;
+
+			try
+			{
+				// 書き込み
+				postscript << "m_segment.Write()";
+				m_segment.Write(value);
+				postscript.str("");
+			}
+			catch (const std::exception& e)
+			{
+				// 例外の処理 ⇒ 例外を転送
+				TransferException(Exception::CodeTransferFileWrite, postscript.str(), e);
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			例外の通知を転送
+		/// @param[in]		errorCode	エラーコード
+		/// @param[in]		postscript	追加の文字列
+		/// @param[in]		e	例外
+		////////////////////////////////////////////////////////////////////////////////
+		void CWorker::TransferException(Exception::EnumCode errorCode, const std::string& postscript, const std::exception& e)
+		{
+			Logging::CObject logging;
+
+			logging.Message << "Transfer::CWorker" << Logging::ConstSeparator;
+
+			try
+			{
+				Exception::CObject object;
+
+				std::stringstream message;
+
+				object.ErrorCode = errorCode;
+				message << logging.Message.str() << postscript << Logging::ConstSeparator << e.what();
+				object.Message = message.str();
+
+				// 排他制御
+				std::lock_guard<std::recursive_mutex> lock(m_asyncException);
+
+				if (_FunctionException != nullptr)
+				{
+					// 例外を通知する関数が有効 ⇒ 例外を通知
+					_FunctionException(object);
+				}
+			}
+			catch (const std::exception& exception)
+			{
+				// 例外の処理 ⇒ デバッグ出力
+				Exception::OutputDebug(logging, "_FunctionException()", exception);
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "boost/asio.hpp"
+
+#include "Common/Exception/Basis.h"
+#include "Common/Logging/Basis.h"
+#include "Common/Transfer/Setting.h"
+#include "Common/Utility/RingQueue.h"
+#include "Metrics.h"
+#include "Segment.h"
+
+namespace Standard
+{
+	namespace Transfer
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CRecord
+		/// @brief      転送するログを保持するクラス
+		/// @detail		時刻は取得だけ行い、文字列への変換は送信するスレッドで行う
+		////////////////////////////////////////////////////////////////////////////////
+		class CRecord
+		{
+		public:
+			//! 時刻(UTC)
+			FILETIME Time;
+
+			//! ログのレベル
+			Logging::EnumLevel Level;
+
+			//! ログのメッセージ
+			std::string Message;
+
+			//! デバッグ出力済み ⇒ 送信するスレッドの停止中に追加したログ
+			bool Debugged = false;
+		};
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @class      CWorker
+		/// @brief      ログを転送するクラス
+		/// @detail		出力したスレッドは容量が固定のリングバッファへ追加するだけで、排他制御で待機しない
+		///				送信するスレッドは追加の通知で起床し、まとめて取り出してデータグラムの上限まで詰めて送信する
+		///				送信するスレッドの停止中は、出力したスレッドでデバッグ出力も行う
+		///				容量の上限を超えたログは破棄して、破棄した数を次の送信で通知する
+		////////////////////////////////////////////////////////////////////////////////
+		class CWorker
+		{
+		public:
+			// コンストラクタ
+			CWorker(size_t capacity, CMetrics& metrics);
+
+			// デストラクタ
+			~CWorker();
+
+			// 例外を通知する関数の登録
+			void AttachFunctionException(std::function<void(const Exception::CObject&)> object);
+
+			// 例外を通知する関数の解除
+			void DetachFunctionException();
+
+			// 開始
+			void Start(const Setting::CObject& object);
+
+			// 停止
+			void Stop();
+
+			// ログを追加
+			bool Push(CRecord&& object);
+
+			// 破棄した数を取得
+			uint64_t GetDropped() const;
+
+		private:
+			// 送信するスレッドを起床
+			void Wakeup();
+
+			// 送信するスレッド
+			void Run();
+
+			// 処理時間の分布を集計して追加
+			void Export(std::vector<CRecord>& objects, int64_t period);
+
+			// まとめて送信
+			void Send(const std::vector<CRecord>& objects);
+
+			// まとめて送信(バイナリ形式)
+			void SendBinary(const std::vector<CRecord>& objects);
+
+			// データグラムを送信
+			void Write(const std::string& value);
+
+			// データグラムをUDPで送信
+			void WriteUdp(const std::string& value);
+
+			// データグラムをファイルへ書き込み
+			void WriteFile(const std::string& value);
+
+			// 例外の通知を転送
+			void TransferException(Exception::EnumCode errorCode, const std::string& postscript, const std::exception& e);
+
+		private:
+			//! 排他制御クラス(例外を通知する関数用)
+			std::recursive_mutex m_asyncException;
+
+			//! 例外を通知する関数
+			std::function<void(const Exception::CObject&)> _FunctionException;
+
+			//! 転送するログ
+			Utility::CRingQueue<CRecord> m_records;
+
+			//! 転送する形式 ※開始後は送信するスレッドだけ参照
+			Setting::EnumFormat m_format;
+
+			//! 転送する先 ※開始後は送信するスレッドだけ参照
+			Setting::EnumSink m_sink;
+
+			//! ファイルへ書き込むクラス ※送信するスレッドだけ参照
+			CSegment m_segment;
+
+			//! 処理時間の分布を保持するクラス
+			CMetrics& m_metrics;
+
+			//! 処理時間の分布を出力する周期[秒] ※開始後は送信するスレッドだけ参照
+			int m_metricsPeriod;
+
+			//! 破棄した数
+			std::atomic<uint64_t> m_dropped;
+
+			//! 破棄を通知した数 ※送信するスレッドだけ参照
+			uint64_t m_reported;
+
+			//! 排他制御(送信するスレッド)
+			std::mutex m_asyncThread;
+
+			//! 送信するスレッドの停止を通知
+			std::condition_variable m_conditionThread;
+
+			//! 送信するスレッドの停止フラグ
+			bool m_stop;
+
+			//! 送信するスレッドの起床フラグ
+			bool m_signal;
+
+			//! 送信するスレッドが待機中 ⇒ 追加したスレッドは待機中の場合だけ通知
+			std::atomic<bool> m_waiting;
+
+			//! 送信するスレッドが動作中 ⇒ 停止中はデバッグ出力を追加したスレッドで行う
+			std::atomic<bool> m_running;
+
+			//! 送信するスレッド
+			std::thread m_thread;
+
+			//! IOサービス
+			boost::asio::io_service m_io_service;
+
+			//! ソケットのクラス
+			boost::asio::ip::udp::socket m_socket;
+		};
+	}
+}
\ No newline at end of file
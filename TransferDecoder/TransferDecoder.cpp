@@ -0,0 +1,280 @@
+#define NOMINMAX
+#include <winsock2.h>
+#include <windows.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Common/Transfer/Binary.h"
+#include "Common/Tool/Text.h"
+
+#pragma comment(lib, "ws2_32.lib")
+
+using namespace Standard;
+
+//! 受信するデータグラムの上限[byte]
+static const int ConstReceive = 65536;
+
+//! 終端コード ※ETX(テキスト終了)
+static const char ConstTerminum = 0x03;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief			Shift-JIS -> UTF-8へ変換
+/// @param[in]		value	元データ
+/// @return			UTF-8に変換された文字列
+////////////////////////////////////////////////////////////////////////////////
+static std::string ToUtf8(const std::string& value)
+{
+	std::string ret;
+
+	std::wstring wide = Text::Convert(value);
+
+	int size = ::WideCharToMultiByte(CP_UTF8, 0, wide.c_str(), (int)wide.size(), nullptr, 0, nullptr, nullptr);
+
+	if (0 < size)
+	{
+		ret.resize(size);
+		::WideCharToMultiByte(CP_UTF8, 0, wide.c_str(), (int)wide.size(), &ret[0], size, nullptr, nullptr);
+	}
+
+	return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief			データグラムを出力
+/// @detail			バイナリ形式は1行ずつの文字列に復元して出力する
+///					テキスト形式は終端コードを改行に置き換えて出力する ※UTF-8に変換済み
+///					分割したログの断片は最後の断片まで保持して、連結して出力する
+/// @param[in,out]	decoder	バイナリ形式を変換するクラス
+/// @param[in]		data	データグラム
+/// @param[in]		size	データグラムのサイズ
+/// @return			true:出力 / false:データが不正
+////////////////////////////////////////////////////////////////////////////////
+static bool Print(Transfer::Binary::CDecoder& decoder, const char* data, size_t size)
+{
+	bool ret = true;
+
+	if (Transfer::Binary::IsBinary(data, size))
+	{
+		std::vector<std::string> lines;
+
+		// バイナリ形式 ⇒ 不正な位置の前までは出力
+		ret = decoder.Decode(data, size, lines);
+
+		for (auto& line : lines)
+		{
+			std::cout << ToUtf8(line) << "\n";
+		}
+	}
+	else
+	{
+		std::vector<std::string> lines;
+
+		// 保持した断片を出力
+		decoder.Flush(lines);
+
+		for (auto& line : lines)
+		{
+			std::cout << ToUtf8(line) << "\n";
+		}
+
+		std::string text(data, size);
+
+		// テキスト形式
+		for (auto& character : text)
+		{
+			if (character == ConstTerminum)
+			{
+				character = '\n';
+			}
+		}
+
+		std::cout << text;
+	}
+
+	std::cout.flush();
+
+	return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief			ファイルを復元
+/// @detail			データグラムごとに先頭の4byteにサイズ(リトルエンディアン)を付加したファイル
+///					サイズが0の位置は書き込み途中で終了したファイルの終端
+/// @param[in]		path	ファイルのパス
+/// @return			終了コード
+////////////////////////////////////////////////////////////////////////////////
+static int DecodeFile(const std::string& path)
+{
+	int ret = 0;
+
+	std::ifstream file(path, std::ios::binary);
+
+	do
+	{
+		if (file.is_open() == false)
+		{
+			std::cerr << "ファイルを開けません:" << path << std::endl;
+			ret = 1;
+			break;
+		}
+
+		std::vector<char> buffer;
+		std::vector<std::string> lines;
+		Transfer::Binary::CDecoder decoder;
+
+		// データグラムだけ走査
+		while (true)
+		{
+			unsigned char head[4];
+
+			if (file.read((char*)head, sizeof(head)).gcount() != sizeof(head))
+			{
+				// ファイルの終端
+				break;
+			}
+
+			uint32_t size = (uint32_t)head[0] | ((uint32_t)head[1] << 8) | ((uint32_t)head[2] << 16) | ((uint32_t)head[3] << 24);
+
+			if (size == 0)
+			{
+				// 書き込んでいない領域
+				break;
+			}
+
+			buffer.resize(size);
+
+			if (file.read(buffer.data(), size).gcount() != (std::streamsize)size)
+			{
+				std::cerr << "ファイルが途中で終わっています:" << path << std::endl;
+				ret = 1;
+				break;
+			}
+
+			if (Print(decoder, buffer.data(), buffer.size()) == false)
+			{
+				std::cerr << "不正なデータグラム:" << size << "byte" << std::endl;
+				ret = 1;
+			}
+		}
+
+		// 最後の断片が届かなかったログを出力
+		decoder.Flush(lines);
+
+		for (auto& line : lines)
+		{
+			std::cout << ToUtf8(line) << "\n";
+		}
+	} while (false);
+
+	return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief			受信したデータグラムを復元
+/// @detail			停止するまで受信を続ける
+/// @param[in]		port	ポート(受信)
+/// @return			終了コード
+////////////////////////////////////////////////////////////////////////////////
+static int DecodeUdp(unsigned short port)
+{
+	int ret = 0;
+
+	WSADATA data;
+	SOCKET socket = INVALID_SOCKET;
+
+	::WSAStartup(MAKEWORD(2, 2), &data);
+
+	do
+	{
+		socket = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+		if (socket == INVALID_SOCKET)
+		{
+			std::cerr << "socket():" << ::WSAGetLastError() << std::endl;
+			ret = 1;
+			break;
+		}
+
+		sockaddr_in address = {};
+
+		address.sin_family = AF_INET;
+		address.sin_port = ::htons(port);
+		address.sin_addr.s_addr = INADDR_ANY;
+
+		if (::bind(socket, (sockaddr*)&address, sizeof(address)) == SOCKET_ERROR)
+		{
+			std::cerr << "bind():" << ::WSAGetLastError() << std::endl;
+			ret = 1;
+			break;
+		}
+
+		std::vector<char> buffer(ConstReceive);
+		Transfer::Binary::CDecoder decoder;
+
+		// 停止するまで受信
+		while (true)
+		{
+			int size = ::recv(socket, buffer.data(), (int)buffer.size(), 0);
+
+			if (size == SOCKET_ERROR)
+			{
+				std::cerr << "recv():" << ::WSAGetLastError() << std::endl;
+				ret = 1;
+				break;
+			}
+
+			if (Print(decoder, buffer.data(), size) == false)
+			{
+				std::cerr << "不正なデータグラム:" << size << "byte" << std::endl;
+			}
+		}
+	} while (false);
+
+	if (socket != INVALID_SOCKET)
+	{
+		::closesocket(socket);
+	}
+
+	::WSACleanup();
+
+	return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief			転送したログをテキストに復元
+/// @detail			TransferDecoder.exe <ファイルのパス>	⇒ ファイルを復元
+///					TransferDecoder.exe -udp <ポート>		⇒ 受信したデータグラムを復元
+///					復元した行はUTF-8で標準出力へ出力する ※テキスト形式と同じ行
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+	int ret = 0;
+
+	do
+	{
+		if (argc == 3 && std::string(argv[1]) == "-udp")
+		{
+			// 受信したデータグラムを復元
+			ret = DecodeUdp((unsigned short)std::stoi(argv[2]));
+			break;
+		}
+
+		if (argc == 2)
+		{
+			// ファイルを復元
+			ret = DecodeFile(argv[1]);
+			break;
+		}
+
+		std::cerr << "TransferDecoder.exe <ファイルのパス>" << std::endl;
+		std::cerr << "TransferDecoder.exe -udp <ポート>" << std::endl;
+		ret = 1;
+	} while (false);
+
+	return ret;
+}
\ No newline at end of file
@@ -14,15 +14,15 @@ namespace Standard
 	{
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CException
-		/// @brief      ȌێNX
-		///				 std::exceptionh
+		/// @brief      例外の情報を保持するクラス
+		///				⇒ std::exceptionから派生
 		////////////////////////////////////////////////////////////////////////////////
 		class CException
 			: virtual public std::exception
 		{
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CException() : std::exception("")
 			{
@@ -31,46 +31,46 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
-			/// @param[in]		errorCode	G[R[h
+			/// @brief			コンストラクタ
+			/// @param[in]		errorCode	エラーコード
 			////////////////////////////////////////////////////////////////////////////////
 			CException(int errorCode) : std::exception("")
 			{
-				// XV
+				// 更新
 				Update(errorCode, "");
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
-			/// @param[in]		errorCode	G[R[h
-			/// @param[in]		message	bZ[W
+			/// @brief			コンストラクタ
+			/// @param[in]		errorCode	エラーコード
+			/// @param[in]		message	メッセージ
 			////////////////////////////////////////////////////////////////////////////////
 			CException(int errorCode, const std::string& message) : std::exception(message.c_str())
 			{
 				std::stringstream buffer;
 
-				// G[R[hƃbZ[W
+				// エラーコードとメッセージを結合
 				buffer << message;
 				//@@@buffer << ":" << Text::FormatX(8, errorCode);
 
-				// XV
+				// 更新
 				Update(errorCode, buffer.str());
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			Rs[Zq
-			/// @return			NX
+			/// @brief			コピー代入演算子
+			/// @return			自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			CException& operator = (const CException& object) noexcept
 			{
-				// XV
+				// 更新
 				Update(object.ErrorCode, object.Message);
 
 				return *this;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			~CException()
 			{
@@ -78,9 +78,9 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			bZ[W擾
-			///					p֐
-			/// @return			bZ[W
+			/// @brief			メッセージを取得
+			///					★継承した関数
+			/// @return			メッセージ
 			////////////////////////////////////////////////////////////////////////////////
 			virtual const char* what() const throw()
 			{
@@ -89,9 +89,9 @@ namespace Standard
 
 		private:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			NXXV
-			/// @param[in]		errorCode	G[R[h
-			/// @param[in]		message	bZ[W
+			/// @brief			自クラスを更新
+			/// @param[in]		errorCode	エラーコード
+			/// @param[in]		message	メッセージ
 			////////////////////////////////////////////////////////////////////////////////
 			void Update(int errorCode, const std::string& message)
 			{
@@ -100,10 +100,10 @@ namespace Standard
 			}
 
 		public:
-			//! G[R[h
+			//! エラーコード
 			int ErrorCode;
 
-			//! bZ[W
+			//! メッセージ
 			std::string Message;
 		};
 	}
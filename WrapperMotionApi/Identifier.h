@@ -1,24 +1,24 @@
 #pragma once
 
-// 1oCgACgɕύX
+// 1バイトアラインメントに変更
 #pragma pack(1)
 
 namespace Standard
 {
 	namespace MotionApi
 	{
-		//! ڑ
+		//! 未接続
 		const unsigned long ConstDisconnected = 0;
 
 		////////////////////////////////////////////////////////////////////////////////
 		/// @class      CIdentifier
-		/// @brief      ʎqێNX
+		/// @brief      識別子を保持するクラス
 		////////////////////////////////////////////////////////////////////////////////
 		class CIdentifier
 		{
 		public:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			RXgN^
+			/// @brief			コンストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			CIdentifier()
 			{
@@ -26,19 +26,19 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			Rs[Zq
-			/// @return			NX
+			/// @brief			コピー代入演算子
+			/// @return			自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			CIdentifier& operator = (const CIdentifier& object) noexcept
 			{
-				// XV
+				// 更新
 				Update(object);
 
 				return *this;
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			fXgN^
+			/// @brief			デストラクタ
 			////////////////////////////////////////////////////////////////////////////////
 			virtual ~CIdentifier()
 			{
@@ -47,8 +47,8 @@ namespace Standard
 
 		protected:
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			NXXV
-			/// @param[in]		object	NX
+			/// @brief			自クラスを更新
+			/// @param[in]		object	自クラス
 			////////////////////////////////////////////////////////////////////////////////
 			void Update(const CIdentifier& object)
 			{
@@ -56,11 +56,11 @@ namespace Standard
 			}
 
 		public:
-			//! nh
+			//! ハンドル
 			unsigned long Handle;
 		};
 	}
 }
 
-// oCgACg߂
+// バイトアラインメントを戻す
 #pragma pack()
@@ -10,55 +10,55 @@ namespace Standard
 		namespace Message
 		{
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			[V̐ݒ𕶎ɕϊ
-			/// @param[in]		object [V̐ݒێev[g̃NX
-			/// @return			[V̐ݒ𕶎ɕϊf[^
+			/// @brief			モーションの設定を文字列に変換
+			/// @param[in]		object モーションの設定を保持するテンプレートのクラス
+			/// @return			モーションの設定を文字列に変換したデータ
 			////////////////////////////////////////////////////////////////////////////////
 			inline std::string Convert(const MotionApi::Device::Setting::Motion::CTemplate& object)
 			{
 				std::stringstream ret;
 
-				ret << "Wn:";
+				ret << "座標系:";
 				switch (object.Coordinate)
 				{
 				case MotionApi::Device::CoodinateWork:
-					ret << "[N";
+					ret << "ワーク";
 					break;
 
 				case MotionApi::Device::CoodinateMachine:
-					ret << "@B";
+					ret << "機械";
 					break;
 				}
 
-				ret << Logging::ConstSeparator << ":";
+				ret << Logging::ConstSeparator << "動作:";
 				switch (object.MoveType)
 				{
 				case MotionApi::Device::MoveRelative:
-					ret << "";
+					ret << "相対";
 					break;
 
 				case MotionApi::Device::MoveAbsolute:
-					ret << "";
+					ret << "絶対";
 					break;
 
 				case MotionApi::Device::MoveRotaryShort:
-					ret << "](߉)";
+					ret << "回転(近回り)";
 					break;
 
 				case MotionApi::Device::MoveRotaryPositive:
-					ret << "](])";
+					ret << "回転(正転)";
 					break;
 
 				case MotionApi::Device::MoveRotaryNegative:
-					ret << "](t])";
+					ret << "回転(逆転)";
 					break;
 				}
 
-				ret << Logging::ConstSeparator << "x:";
+				ret << Logging::ConstSeparator << "速度:";
 				switch (object.VelocityType)
 				{
 				case MotionApi::Device::VelocityUnit:
-					ret << "wߒP/s";
+					ret << "指令単位/s";
 					break;
 
 				case MotionApi::Device::VelocityPercent:
@@ -66,133 +66,133 @@ namespace Standard
 					break;
 				}
 
-				ret << Logging::ConstSeparator << ":";
+				ret << Logging::ConstSeparator << "加減速:";
 				switch (object.AccDecType)
 				{
 				case MotionApi::Device::AccDecUnit:
-					ret << "wߒP/s^2";
+					ret << "指令単位/s^2";
 					break;
 
 				case MotionApi::Device::AccDecTime:
-					ret << "萔[ms]";
+					ret << "時定数[ms]";
 					break;
 
 				case MotionApi::Device::AccDecKeep:
-					ret << "݂̐ݒ";
+					ret << "現在の設定";
 					break;
 				}
 
-				ret << Logging::ConstSeparator << "tB^:";
+				ret << Logging::ConstSeparator << "加減速フィルタ:";
 				switch (object.FilterType)
 				{
 				case MotionApi::Device::FilterCurve:
-					ret << "ړ";
+					ret << "移動平均";
 					break;
 
 				case MotionApi::Device::FilterExp:
-					ret << "w";
+					ret << "指数";
 					break;
 
 				case MotionApi::Device::FilterNothing:
-					ret << "Ȃ";
+					ret << "なし";
 					break;
 
 				case MotionApi::Device::FilterKeep:
-					ret << "݂̐ݒ";
+					ret << "現在の設定";
 					break;
 				}
 
-				ret << Logging::ConstSeparator << "x̏l";
+				ret << Logging::ConstSeparator << "速度の上限値";
 				if (object.MaxVelocity.Indirect)
 				{
-					ret << "(Ԑ):" << "OW" << Text::FormatX(4, object.MaxVelocity.Value, "");
+					ret << "(間接):" << "OW" << Text::FormatX(4, object.MaxVelocity.Value, "");
 				}
 				else
 				{
-					ret << "():" << object.MaxVelocity.Value;
+					ret << "(直接):" << object.MaxVelocity.Value;
 				}
 
-				ret << Logging::ConstSeparator << "x";
+				ret << Logging::ConstSeparator << "加速度";
 				if (object.Acceleration.Indirect)
 				{
-					ret << "(Ԑ):" << "OW" << Text::FormatX(4, object.Acceleration.Value, "");
+					ret << "(間接):" << "OW" << Text::FormatX(4, object.Acceleration.Value, "");
 				}
 				else
 				{
-					ret << "():" << object.Acceleration.Value;
+					ret << "(直接):" << object.Acceleration.Value;
 				}
 
-				ret << Logging::ConstSeparator << "x";
+				ret << Logging::ConstSeparator << "減速度";
 				if (object.Deceleration.Indirect)
 				{
-					ret << "(Ԑ):" << "OW" << Text::FormatX(4, object.Deceleration.Value, "");
+					ret << "(間接):" << "OW" << Text::FormatX(4, object.Deceleration.Value, "");
 				}
 				else
 				{
-					ret << "():" << object.Deceleration.Value;
+					ret << "(直接):" << object.Deceleration.Value;
 				}
 
-				ret << Logging::ConstSeparator << "tB^";
+				ret << Logging::ConstSeparator << "フィルタ時間";
 				if (object.FilterTime.Indirect)
 				{
-					ret << "(Ԑ):" << "OW" << Text::FormatX(4, object.FilterTime.Value, "");
+					ret << "(間接):" << "OW" << Text::FormatX(4, object.FilterTime.Value, "");
 				}
 				else
 				{
-					ret << "():" << object.FilterTime.Value;
+					ret << "(直接):" << object.FilterTime.Value;
 				}
 
-				ret << Logging::ConstSeparator << "x";
+				ret << Logging::ConstSeparator << "速度";
 				if (object.Velocity.Indirect)
 				{
-					ret << "(Ԑ):" << "OW" << Text::FormatX(4, object.Velocity.Value, "");
+					ret << "(間接):" << "OW" << Text::FormatX(4, object.Velocity.Value, "");
 				}
 				else
 				{
-					ret << "():" << object.Velocity.Value;
+					ret << "(直接):" << object.Velocity.Value;
 				}
 
-				ret << Logging::ConstSeparator << "_ÃAv[`x";
+				ret << Logging::ConstSeparator << "原点復帰のアプローチ速度";
 				if (object.ApproachVelocity.Indirect)
 				{
-					ret << "(Ԑ):" << "OW" << Text::FormatX(4, object.ApproachVelocity.Value, "");
+					ret << "(間接):" << "OW" << Text::FormatX(4, object.ApproachVelocity.Value, "");
 				}
 				else
 				{
-					ret << "():" << object.ApproachVelocity.Value;
+					ret << "(直接):" << object.ApproachVelocity.Value;
 				}
 
-				ret << Logging::ConstSeparator << "_ÃN[vx";
+				ret << Logging::ConstSeparator << "原点復帰のクリープ速度";
 				if (object.CreepVelocity.Indirect)
 				{
-					ret << "(Ԑ):" << "OW" << Text::FormatX(4, object.CreepVelocity.Value, "");
+					ret << "(間接):" << "OW" << Text::FormatX(4, object.CreepVelocity.Value, "");
 				}
 				else
 				{
-					ret << "():" << object.CreepVelocity.Value;
+					ret << "(直接):" << object.CreepVelocity.Value;
 				}
 
 				return ret.str();
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			|WV̐ݒ𕶎ɕϊ
-			/// @param[in]		object |WV̐ݒێev[g̃NX
-			/// @return			|WV̐ݒ𕶎ɕϊf[^
+			/// @brief			ポジションの設定を文字列に変換
+			/// @param[in]		object ポジションの設定を保持するテンプレートのクラス
+			/// @return			ポジションの設定を文字列に変換したデータ
 			////////////////////////////////////////////////////////////////////////////////
 			inline std::string Convert(const MotionApi::Device::Setting::Position::CTemplate& object)
 			{
 				std::stringstream ret;
 
-				ret << "ʒu";
+				ret << "位置";
 				switch (object.PositionType)
 				{
 				case MotionApi::Device::PositionImmediate:
-					ret << "():" << object.PositionData;
+					ret << "(直接):" << object.PositionData;
 					break;
 
 				case MotionApi::Device::PositionIndirect:
-					ret << "(Ԑ):" << "OW" << Text::FormatX(4, object.PositionData, "");
+					ret << "(間接):" << "OW" << Text::FormatX(4, object.PositionData, "");
 					break;
 				}
 
@@ -200,83 +200,83 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			_A̕𕶎ɕϊ
-			/// @param[in]		object _A̕
-			/// @return			_A̕𕶎ɕϊf[^
+			/// @brief			原点復帰の方式を文字列に変換
+			/// @param[in]		object 原点復帰の方式
+			/// @return			原点復帰の方式を文字列に変換したデータ
 			////////////////////////////////////////////////////////////////////////////////
 			inline std::string Convert(MotionApi::Device::EnumOrigin object)
 			{
 				std::stringstream ret;
 
-				ret << Logging::ConstSeparator << "_A:";
+				ret << Logging::ConstSeparator << "原点復帰:";
 				switch (object)
 				{
 				case MotionApi::Device::OriginDec1_C:
-					ret << "DEC1 + CpX";
+					ret << "DEC1 + C相パルス方式";
 					break;
 
 				case MotionApi::Device::OriginZero:
-					ret << "ZEROM";
+					ret << "ZERO信号方式";
 					break;
 
 				case MotionApi::Device::OriginDec1_Zero:
-					ret << "DEC1 + ZEROM";
+					ret << "DEC1 + ZERO信号方式";
 					break;
 
 				case MotionApi::Device::OriginC:
-					ret << "CpX";
+					ret << "C相パルス方式";
 					break;
 
 				case MotionApi::Device::OriginDec2_Zero:
-					ret << "DEC2 + ZEROM";
+					ret << "DEC2 + ZERO信号方式";
 					break;
 
 				case MotionApi::Device::OriginDec1_L_Zero:
-					ret << "DEC1 + LMT + ZEROM";
+					ret << "DEC1 + LMT + ZERO信号方式";
 					break;
 
 				case MotionApi::Device::OriginDec2_C:
-					ret << "DEC2 + CM";
+					ret << "DEC2 + C相信号方式";
 					break;
 
 				case MotionApi::Device::OriginDec1_L_C:
-					ret << "DEC1 + LMT + CM";
+					ret << "DEC1 + LMT + C相信号方式";
 					break;
 
 				case MotionApi::Device::OriginC_Only:
-					ret << "VCpX";
+					ret << "新C相パルス方式";
 					break;
 
 				case MotionApi::Device::OriginPot_C:
-					ret << "POT & CpX";
+					ret << "POT & C相パルス方式";
 					break;
 
 				case MotionApi::Device::OriginPot_Only:
-					ret << "POT";
+					ret << "POT方式";
 					break;
 
 				case MotionApi::Device::OriginHomeLs_C:
-					ret << "HOME LS & CpX";
+					ret << "HOME LS & C相パルス方式";
 					break;
 
 				case MotionApi::Device::OriginHomeLs_Only:
-					ret << "HOME LS";
+					ret << "HOME LS方式";
 					break;
 
 				case MotionApi::Device::OriginNot_C:
-					ret << "NOT & CpX";
+					ret << "NOT & C相パルス方式";
 					break;
 
 				case MotionApi::Device::OriginNot_Only:
-					ret << "NOT";
+					ret << "NOT方式";
 					break;
 
 				case MotionApi::Device::OriginInput_C:
-					ret << "INPUT & CpX";
+					ret << "INPUT & C相パルス方式";
 					break;
 
 				case MotionApi::Device::OriginInput_Only:
-					ret << "INPUT";
+					ret << "INPUT方式";
 					break;
 				}
 
@@ -284,23 +284,23 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			ړ̕𕶎ɕϊ
-			/// @param[in]		object ړ̕
-			/// @return			ړ̕𕶎ɕϊf[^
+			/// @brief			移動の方向を文字列に変換
+			/// @param[in]		object 移動の方向
+			/// @return			移動の方向を文字列に変換したデータ
 			////////////////////////////////////////////////////////////////////////////////
 			inline std::string Convert(MotionApi::Device::EnumDirection object)
 			{
 				std::stringstream ret;
 
-				ret << Logging::ConstSeparator << "ړ:";
+				ret << Logging::ConstSeparator << "移動:";
 				switch (object)
 				{
 				case MotionApi::Device::DirectionPositive:
-					ret << "";
+					ret << "正方向";
 					break;
 
 				case MotionApi::Device::DirectionNegative:
-					ret << "t";
+					ret << "逆方向";
 					break;
 				}
 
@@ -308,27 +308,27 @@ namespace Standard
 			}
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @brief			̑𕶎ɕϊ
-			/// @param[in]		object ̑
-			/// @return			̑𕶎ɕϊf[^
+			/// @brief			完了の属性を文字列に変換
+			/// @param[in]		object 完了の属性
+			/// @return			完了の属性を文字列に変換したデータ
 			////////////////////////////////////////////////////////////////////////////////
 			inline std::string Convert(MotionApi::Device::EnumComplete object)
 			{
 				std::stringstream ret;
 
-				ret << Logging::ConstSeparator << "̑:";
+				ret << Logging::ConstSeparator << "完了の属性:";
 				switch (object)
 				{
 				case MotionApi::Device::CompleteDistribution:
-					ret << "o";
+					ret << "払い出し完了";
 					break;
 
 				case MotionApi::Device::CompletePositioning:
-					ret << "ʒuߊ";
+					ret << "位置決め完了";
 					break;
 
 				case MotionApi::Device::CompleteStart:
-					ret << "wߊJn";
+					ret << "指令開始";
 					break;
 				}
 
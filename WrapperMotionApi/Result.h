@@ -2,7 +2,7 @@
 
 #include "Identifier.h"
 
-// 1oCgACgɕύX
+// 1バイトアラインメントに変更
 #pragma pack(1)
 
 namespace Standard
@@ -15,15 +15,15 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      COpen
-				/// @brief      Rg[JʃNX
-				///				 ʎqێNXh
+				/// @brief      コントローラを開いた結果クラス
+				///				⇒ 識別子を保持するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class COpen
 					: virtual public CIdentifier
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					COpen() : CIdentifier()
 					{
@@ -31,19 +31,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					COpen& operator = (const COpen& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~COpen()
 					{
@@ -52,12 +52,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const COpen& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CIdentifier::Update(object);
 					}
 				};
@@ -70,15 +70,15 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CDeclare
-				/// @brief      WX^̃nh쐬ʃNX
-				///				 ʎqێNXh
+				/// @brief      レジスタのハンドルを作成した結果クラス
+				///				⇒ 識別子を保持するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CDeclare
 					: virtual public CIdentifier
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare() : CIdentifier()
 					{
@@ -86,19 +86,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare& operator = (const CDeclare& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CDeclare()
 					{
@@ -107,25 +107,25 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CDeclare& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CIdentifier::Update(object);
 					}
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CContent
-				/// @brief      WX^̒lNX
+				/// @brief      レジスタの値クラス
 				////////////////////////////////////////////////////////////////////////////////
 				class CContent
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CContent()
 					{
@@ -133,19 +133,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CContent& operator = (const CContent& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CContent()
 					{
@@ -154,8 +154,8 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CContent& object)
 					{
@@ -165,10 +165,10 @@ namespace Standard
 					}
 
 				public:
-					//! WX^̃f[^
+					//! レジスタのデータ
 					std::vector<unsigned short> Buffers;
 
-					//! WX^̑삵f[^
+					//! レジスタの操作したデータ数
 					unsigned long Size;
 				};
 			}
@@ -180,15 +180,15 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CDeclare
-				/// @brief      ̃nh쐬ʃNX
-				///				 ʎqێNXh
+				/// @brief      軸のハンドルを作成した結果クラス
+				///				⇒ 識別子を保持するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CDeclare
 					: virtual public CIdentifier
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare() : CIdentifier()
 					{
@@ -196,19 +196,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare& operator = (const CDeclare& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CDeclare()
 					{
@@ -217,12 +217,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CDeclare& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CIdentifier::Update(object);
 					}
 				};
@@ -235,15 +235,15 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CDevice
-				/// @brief      foCX̃nh쐬ʃNX
-				///				 ʎqێNXh
+				/// @brief      デバイスのハンドルを作成した結果クラス
+				///				⇒ 識別子を保持するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CDeclare
 					: virtual public CIdentifier
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare() : CIdentifier()
 					{
@@ -251,19 +251,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare& operator = (const CDeclare& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CDeclare()
 					{
@@ -272,12 +272,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CDeclare& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CIdentifier::Update(object);
 					}
 				};
@@ -286,5 +286,5 @@ namespace Standard
 	}
 }
 
-// oCgACg߂
+// バイトアラインメントを戻す
 #pragma pack()
\ No newline at end of file
@@ -2,7 +2,7 @@
 
 #include "Identifier.h"
 
-// 1oCgACgɕύX
+// 1バイトアラインメントに変更
 #pragma pack(1)
 
 namespace Standard
@@ -12,32 +12,32 @@ namespace Standard
 		namespace Axis
 		{
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			̃^Cv
+			/// @enum			軸のタイプ
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumAxis
 			{
-				AxisReal = 1,		// T[{
-				AxisVirtual = 2,	// zT[{
-				AxisExternal = 3	// OGR[_
+				AxisReal = 1,		// 実サーボ軸
+				AxisVirtual = 2,	// 仮想サーボ軸
+				AxisExternal = 3	// 外部エンコーダ
 			};
 
 			namespace Setting
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CDeclare
-				/// @brief      ̃nh쐬ݒNX
-				///				MP3100SVC()FXbg=0,TuXbg=3
-				///				MP3100SVR(z)FXbg=0,TuXbg=4
+				/// @brief      軸のハンドルを作成する設定クラス
+				///				※MP3100のSVC(実物)：スロット=0,サブスロット=3
+				///				※MP3100のSVR(仮想)：スロット=0,サブスロット=4
 				////////////////////////////////////////////////////////////////////////////////
 				class CDeclare
 				{
 				private:
-					//! VACỸ^Cg
+					//! シリアライズのタイトル
 					const std::string ConstHeader = "Declare";
 
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare()
 					{
@@ -51,19 +51,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare& operator = (const CDeclare& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CDeclare()
 					{
@@ -71,7 +71,7 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			VACY
+					/// @brief			シリアライズ
 					////////////////////////////////////////////////////////////////////////////////
 					friend class cereal::access;
 					template<class T>
@@ -85,24 +85,24 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Json`ɃVACY񂩂XV
-					/// @param[in]		object	Json`ɃVACY
+					/// @brief			Json形式にシリアライズした文字列から更新
+					/// @param[in]		object	Json形式にシリアライズした文字列
 					////////////////////////////////////////////////////////////////////////////////
 					void Input(std::string object)
 					{
-						// Json`ϊ
+						// Json形式から変換
 						Update(Archive::Input<CDeclare>(ConstHeader, object));
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Json`ɃVACY擾
-					/// @return			VACY
+					/// @brief			Json形式にシリアライズした文字列を取得
+					/// @return			シリアライズした文字列
 					////////////////////////////////////////////////////////////////////////////////
 					std::string Output()
 					{
 						std::string ret;
 
-						// Json`ɕϊ
+						// Json形式に変換
 						ret = Archive::Output<CDeclare>(ConstHeader, *this);
 
 						return ret;
@@ -110,8 +110,8 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CDeclare& object)
 					{
@@ -125,39 +125,39 @@ namespace Standard
 					}
 
 				public:
-					//! Xbgԍ
+					//! スロット番号
 					unsigned short SlotNo;
 
-					//! TuXbgԍ
+					//! サブスロット番号
 					unsigned short SubSlotNo;
 
-					//! `ĂXe[Vԍ
+					//! 軸が定義されているステーション番号
 					unsigned short StationNo;
 
-					//! ̘_ԍ
+					//! 軸の論理番号
 					unsigned short LogicalNo;
 
-					//! ̃^Cv
+					//! 軸のタイプ
 					EnumAxis Type;
 
-					//! WX^̐擪AhX
+					//! レジスタの先頭アドレス
 					unsigned short Address;
 
-					//! ʒu̕\
+					//! 位置の分解能
 					double Resolution;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CClear
-				/// @brief      ̃nhjݒNX
-				///				 ʎqێNXh
+				/// @brief      軸のハンドルを破棄する設定クラス
+				///				⇒ 識別子を保持するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CClear
 					: virtual public CIdentifier
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CClear()
 					{
@@ -165,19 +165,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CClear& operator = (const CClear& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CClear()
 					{
@@ -186,12 +186,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CClear& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CIdentifier::Update(object);
 					}
 				};
@@ -200,5 +200,5 @@ namespace Standard
 	}
 }
 
-// oCgACg߂
+// バイトアラインメントを戻す
 #pragma pack()
\ No newline at end of file
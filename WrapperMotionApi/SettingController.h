@@ -3,7 +3,7 @@
 #include "Common/Archive/Convert.h"
 #include "Identifier.h"
 
-// 1oCgACgɕύX
+// 1バイトアラインメントに変更
 #pragma pack(1)
 
 namespace Standard
@@ -13,29 +13,29 @@ namespace Standard
 		namespace Controller
 		{
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			ʐM̎
+			/// @enum			通信の種別
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumDevice
 			{
 				DevicePci = 4,		// PCI bus (910)
-				DevicePciE = 6		// PCIeoX(Mp3100)
+				DevicePciE = 6		// PCIeバス(Mp3100)
 			};
 
 			namespace Setting
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      COpen
-				/// @brief      Rg[JݒNX
+				/// @brief      コントローラを開く設定クラス
 				////////////////////////////////////////////////////////////////////////////////
 				class COpen
 				{
 				private:
-					//! VACỸ^Cg
+					//! シリアライズのタイトル
 					const std::string ConstHeader = "OpenController";
 
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					COpen()
 					{
@@ -43,19 +43,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					COpen& operator = (const COpen& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~COpen()
 					{
@@ -64,7 +64,7 @@ namespace Standard
 
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			VACY
+					/// @brief			シリアライズ
 					////////////////////////////////////////////////////////////////////////////////
 					friend class cereal::access;
 					template<class T>
@@ -74,24 +74,24 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Json`ɃVACY񂩂XV
-					/// @param[in]		object	Json`ɃVACY
+					/// @brief			Json形式にシリアライズした文字列から更新
+					/// @param[in]		object	Json形式にシリアライズした文字列
 					////////////////////////////////////////////////////////////////////////////////
 					void Input(std::string object)
 					{
-						// Json`ϊ
+						// Json形式から変換
 						Update(Archive::Input<COpen>(ConstHeader, object));
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Json`ɃVACY擾
-					/// @return			VACY
+					/// @brief			Json形式にシリアライズした文字列を取得
+					/// @return			シリアライズした文字列
 					////////////////////////////////////////////////////////////////////////////////
 					std::string Output()
 					{
 						std::string ret;
 
-						// Json`ɕϊ
+						// Json形式に変換
 						ret = Archive::Output<COpen>(ConstHeader, *this);
 
 						return ret;
@@ -99,8 +99,8 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const COpen& object)
 					{
@@ -108,23 +108,23 @@ namespace Standard
 					}
 
 				public:
-					//! ʐM̎
+					//! 通信の種別
 					EnumDevice Device;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CApiTimeout
-				/// @brief      Api^CAEg̐ݒNX
+				/// @brief      Apiタイムアウトの設定クラス
 				////////////////////////////////////////////////////////////////////////////////
 				class CApiTimeout
 				{
 				private:
-					//! VACỸ^Cg
+					//! シリアライズのタイトル
 					const std::string ConstHeader = "ApiTimeout";
 
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CApiTimeout()
 					{
@@ -132,19 +132,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CApiTimeout& operator = (const CApiTimeout& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CApiTimeout()
 					{
@@ -153,7 +153,7 @@ namespace Standard
 
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			VACY
+					/// @brief			シリアライズ
 					////////////////////////////////////////////////////////////////////////////////
 					friend class cereal::access;
 					template<class T>
@@ -163,24 +163,24 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Json`ɃVACY񂩂XV
-					/// @param[in]		object	Json`ɃVACY
+					/// @brief			Json形式にシリアライズした文字列から更新
+					/// @param[in]		object	Json形式にシリアライズした文字列
 					////////////////////////////////////////////////////////////////////////////////
 					void Input(std::string object)
 					{
-						// Json`ϊ
+						// Json形式から変換
 						Update(Archive::Input<CApiTimeout>(ConstHeader, object));
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Json`ɃVACY擾
-					/// @return			VACY
+					/// @brief			Json形式にシリアライズした文字列を取得
+					/// @return			シリアライズした文字列
 					////////////////////////////////////////////////////////////////////////////////
 					std::string Output()
 					{
 						std::string ret;
 
-						// Json`ɕϊ
+						// Json形式に変換
 						ret = Archive::Output<CApiTimeout>(ConstHeader, *this);
 
 						return ret;
@@ -188,8 +188,8 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CApiTimeout& object)
 					{
@@ -197,21 +197,21 @@ namespace Standard
 					}
 
 				public:
-					//! Apĩ^CAEg[ms]
+					//! Apiのタイムアウト[ms]
 					long Value;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CClose
-				/// @brief      Rg[ݒNX
-				///				 ʎqێNXh
+				/// @brief      コントローラを閉じる設定クラス
+				///				⇒ 識別子を保持するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CClose
 					: virtual public CIdentifier
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CClose()
 					{
@@ -219,19 +219,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CClose& operator = (const CClose& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CClose()
 					{
@@ -240,12 +240,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CClose& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CIdentifier::Update(object);
 					}
 				};
@@ -254,5 +254,5 @@ namespace Standard
 	}
 }
 
-// oCgACg߂
+// バイトアラインメントを戻す
 #pragma pack()
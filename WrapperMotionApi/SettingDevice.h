@@ -9,7 +9,7 @@
 
 #include "cereal/types/map.hpp"
 
-// 1oCgACgɕύX
+// 1バイトアラインメントに変更
 #pragma pack(1)
 
 namespace Standard
@@ -19,119 +19,119 @@ namespace Standard
 		namespace Device
 		{
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			Wn
+			/// @enum			座標系
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumCoordinate
 			{
-				CoodinateWork = 0,			// [NWn
-				CoodinateMachine = 1		// @BWn
+				CoodinateWork = 0,			// ワーク座標系
+				CoodinateMachine = 1		// 機械座標系
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			^Cv
+			/// @enum			動作タイプ
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumMove
 			{
-				MoveRelative = 0,			// lwAor]
-				MoveAbsolute = 1,			// ΒlwA
-				MoveRotaryShort = 2,		// ΒlwA](߉)
-				MoveRotaryPositive = 3,		// ΒlwA](])
-				MoveRotaryNegative = 4		// ΒlwA](t])
+				MoveRelative = 0,			// 増分値指定、直線軸or回転軸
+				MoveAbsolute = 1,			// 絶対値指定、直線軸
+				MoveRotaryShort = 2,		// 絶対値指定、回転軸(近回り)
+				MoveRotaryPositive = 3,		// 絶対値指定、回転軸(正転)
+				MoveRotaryNegative = 4		// 絶対値指定、回転軸(逆転)
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			x^Cv
+			/// @enum			速度タイプ
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumVelocity
 			{
-				VelocityUnit = 0,			// x[wߒP/sec]
-				VelocityPercent = 1			// [^̒i]iixjA܂́Aōx%w(Velocity= 1̂ƂA0.01%)
+				VelocityUnit = 0,			// 速度[指令単位/sec]
+				VelocityPercent = 1			// モータの定格回転数（定格速度）、または、送り最高速度の%指定(Velocity= 1のとき、0.01%)
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			^Cv
+			/// @enum			加減速タイプ
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumAccDec
 			{
-				AccDecUnit = 0,				// xw[wߒP/sec^2]
-				AccDecTime = 1,				// 萔w[ms]
-				AccDecKeep = 2				// ݂̐ݒێ
+				AccDecUnit = 0,				// 加減速度指定[指令単位/sec^2]
+				AccDecTime = 1,				// 時定数指定[ms]
+				AccDecKeep = 2				// 現在の設定を保持
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			tB^^Cv
+			/// @enum			加減速フィルタタイプ
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumFilter
 			{
-				FilterCurve = 0,			// ړσtB^iȈSj
-				FilterExp = 1,				// wtB^
-				FilterNothing = 2,			// tB^Ȃ
-				FilterKeep = 3				// ݂̐ݒێ
+				FilterCurve = 0,			// 移動平均フィルタ（簡易S字）
+				FilterExp = 1,				// 指数フィルタ
+				FilterNothing = 2,			// フィルタなし
+				FilterKeep = 3				// 現在の設定を保持
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			̕
+			/// @enum			軸の方向
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumDirection
 			{
-				DirectionPositive = 0,		// 
-				DirectionNegative = 1		// t
+				DirectionPositive = 0,		// 正方向
+				DirectionNegative = 1		// 逆方向
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			̑
+			/// @enum			完了の属性
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumComplete
 			{
-				CompleteDistribution = 0,	// o
-				CompletePositioning = 1,	// ʒuߊ
-				CompleteStart = 2			// wߊJn
+				CompleteDistribution = 0,	// 払い出し完了
+				CompletePositioning = 1,	// 位置決め完了
+				CompleteStart = 2			// 指令開始
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			|WṼf[^^Cv
+			/// @enum			ポジションのデータタイプ
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumPositionData
 			{
-				PositionImmediate = 0,		// ڎw |WVf[^w
-				PositionIndirect = 1		// ֐ߎw |WVf[^i[Ă郌WX^nhw
+				PositionImmediate = 0,		// 直接指定 ※ポジションデータを指定
+				PositionIndirect = 1		// 関節指定 ※ポジションデータを格納しているレジスタハンドルを指定
 			};
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			_A̕
+			/// @enum			原点復帰の方式
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumOrigin
 			{
-				OriginDec1_C = 0,			// DEC1 + CpX
-				OriginZero = 1,				// ZEROM
-				OriginDec1_Zero = 2,		// DEC1 + ZEROM
-				OriginC = 3,				// CpX
-				OriginDec2_Zero = 4,		// DEC2 + ZEROM
-				OriginDec1_L_Zero = 5,		// DEC1 + LMT + ZEROM
-				OriginDec2_C = 6,			// DEC2 + CM
-				OriginDec1_L_C = 7,			// DEC1 + LMT + CM
-				OriginC_Only = 8,			// VCpX
-				OriginPot_C = 9,			// POT & CpX
-				OriginPot_Only = 10,		// POT
-				OriginHomeLs_C = 11,		// HOME LS & CpX
-				OriginHomeLs_Only = 12,		// HOME LS
-				OriginNot_C = 13,			// NOT & CpX
-				OriginNot_Only = 14,		// NOT
-				OriginInput_C = 15,			// INPUT & CpX
-				OriginInput_Only = 16		// INPUT
+				OriginDec1_C = 0,			// DEC1 + C相パルス方式
+				OriginZero = 1,				// ZERO信号方式
+				OriginDec1_Zero = 2,		// DEC1 + ZERO信号方式
+				OriginC = 3,				// C相パルス方式
+				OriginDec2_Zero = 4,		// DEC2 + ZERO信号方式
+				OriginDec1_L_Zero = 5,		// DEC1 + LMT + ZERO信号方式
+				OriginDec2_C = 6,			// DEC2 + C相信号方式
+				OriginDec1_L_C = 7,			// DEC1 + LMT + C相信号方式
+				OriginC_Only = 8,			// 新C相パルス方式
+				OriginPot_C = 9,			// POT & C相パルス方式
+				OriginPot_Only = 10,		// POT方式
+				OriginHomeLs_C = 11,		// HOME LS & C相パルス方式
+				OriginHomeLs_Only = 12,		// HOME LS方式
+				OriginNot_C = 13,			// NOT & C相パルス方式
+				OriginNot_Only = 14,		// NOT方式
+				OriginInput_C = 15,			// INPUT & C相パルス方式
+				OriginInput_Only = 16		// INPUT方式
 			};
 
 			namespace Setting
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CTemplate
-				/// @brief      ݒ肷ev[g̃NX
+				/// @brief      設定するテンプレートのクラス
 				////////////////////////////////////////////////////////////////////////////////
 				class CTemplate
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CTemplate()
 					{
@@ -139,19 +139,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CTemplate& operator = (const CTemplate& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					virtual ~CTemplate()
 					{
@@ -160,8 +160,8 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CTemplate& object)
 					{
@@ -169,19 +169,19 @@ namespace Standard
 					}
 
 				public:
-					//! @̃nh
+					//! 機器のハンドル
 					unsigned long Handle;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CDeclare
-				/// @brief      foCX̃nh쐬ݒNX
+				/// @brief      デバイスのハンドルを作成する設定クラス
 				////////////////////////////////////////////////////////////////////////////////
 				class CDeclare
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare()
 					{
@@ -189,19 +189,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare& operator = (const CDeclare& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CDeclare()
 					{
@@ -210,8 +210,8 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CDeclare& object)
 					{
@@ -220,21 +220,21 @@ namespace Standard
 					}
 
 				public:
-					//! ̃nh
+					//! 軸のハンドル
 					std::vector<unsigned long> Handles;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CClear
-				/// @brief      foCX̃nhjݒNX
-				///				 ʎqێNXh
+				/// @brief      デバイスのハンドルを破棄する設定クラス
+				///				⇒ 識別子を保持するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CClear
 					: virtual public CIdentifier
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CClear()
 					{
@@ -242,19 +242,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CClear& operator = (const CClear& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CClear()
 					{
@@ -263,12 +263,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CClear& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CIdentifier::Update(object);
 					}
 				};
@@ -277,15 +277,15 @@ namespace Standard
 				{
 					////////////////////////////////////////////////////////////////////////////////
 					/// @class      CAxis
-					/// @brief      ~鎲̐ݒNX
-					///				 ʎqێNXh
+					/// @brief      制御を停止する軸の設定クラス
+					///				⇒ 識別子を保持するクラスから派生
 					////////////////////////////////////////////////////////////////////////////////
 					class CAxis
 						: virtual public CIdentifier
 					{
 					public:
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			RXgN^
+						/// @brief			コンストラクタ
 						////////////////////////////////////////////////////////////////////////////////
 						CAxis() : CIdentifier()
 						{
@@ -293,19 +293,19 @@ namespace Standard
 						}
 
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			Rs[Zq
-						/// @return			NX
+						/// @brief			コピー代入演算子
+						/// @return			自クラス
 						////////////////////////////////////////////////////////////////////////////////
 						CAxis& operator = (const CAxis& object) noexcept
 						{
-							// XV
+							// 更新
 							Update(object);
 
 							return *this;
 						}
 
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			fXgN^
+						/// @brief			デストラクタ
 						////////////////////////////////////////////////////////////////////////////////
 						~CAxis()
 						{
@@ -314,34 +314,34 @@ namespace Standard
 
 					protected:
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			NXXV
-						/// @param[in]		object	NX
+						/// @brief			自クラスを更新
+						/// @param[in]		object	自クラス
 						////////////////////////////////////////////////////////////////////////////////
 						void Update(const CAxis& object)
 						{
-							// ̊֐
+							// 既定の関数
 							CIdentifier::Update(object);
 
 							this->Address = object.Address;
 						}
 
 					public:
-						//! ̃WX^擪AhX
+						//! 軸のレジスタ先頭アドレス
 						unsigned short Address;
 					};
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CSuspend
-				/// @brief      ̒~ݒ肷NX
-				///				 ʎqێNXh
+				/// @brief      制御の停止を設定するクラス
+				///				⇒ 識別子を保持するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CSuspend
 					: virtual public CIdentifier
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CSuspend() : CIdentifier()
 					{
@@ -349,19 +349,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CSuspend& operator = (const CSuspend& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CSuspend()
 					{
@@ -370,17 +370,17 @@ namespace Standard
 
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			foCX̃nh쐬ݒNX擾
-					/// @param[in]		object	NX
+					/// @brief			デバイスのハンドルを作成する設定クラスを取得
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare GetDeclare()
 					{
 						CDeclare ret;
 
-						// 𑖍
+						// 軸を走査
 						for (const auto& axis : Axises)
 						{
-							// nhǉ
+							// ハンドルを追加
 							ret.Handles.emplace_back(axis.Handle);
 						}
 
@@ -389,12 +389,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CSuspend& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CIdentifier::Update(object);
 
 						this->Axises.clear();
@@ -402,21 +402,21 @@ namespace Standard
 					}
 
 				public:
-					//! ~鎲̏ԃNX
+					//! 制御を停止する軸の状態クラス
 					std::vector<Suspend::CAxis> Axises;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CServo
-				/// @brief      T[{̐sݒNX
-				///				 ʎqێNXh
+				/// @brief      サーボの制御を行う設定クラス
+				///				⇒ 識別子を保持するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CServo
 					: virtual public CIdentifier, virtual public CDeclare
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CServo() : CIdentifier(), CDeclare()
 					{
@@ -425,19 +425,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CServo& operator = (const CServo& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CServo()
 					{
@@ -446,12 +446,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CServo& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CIdentifier::Update(object);
 						CDeclare::Update(object);
 
@@ -460,10 +460,10 @@ namespace Standard
 					}
 
 				public:
-					//! T[{̏
+					//! サーボの状態
 					Signal::EnumStatus Mode;
 
-					//! ^CAEg[ms]
+					//! タイムアウト[ms]
 					unsigned short Timeout;
 				};
 
@@ -471,13 +471,13 @@ namespace Standard
 				{
 					////////////////////////////////////////////////////////////////////////////////
 					/// @class      CContent
-					/// @brief      [Ṽf[^ێNX
+					/// @brief      モーションのデータを保持するクラス
 					////////////////////////////////////////////////////////////////////////////////
 					class CContent
 					{
 					public:
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			RXgN^
+						/// @brief			コンストラクタ
 						////////////////////////////////////////////////////////////////////////////////
 						CContent()
 						{
@@ -486,19 +486,19 @@ namespace Standard
 						}
 
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			Rs[Zq
-						/// @return			NX
+						/// @brief			コピー代入演算子
+						/// @return			自クラス
 						////////////////////////////////////////////////////////////////////////////////
 						CContent& operator = (const CContent& object) noexcept
 						{
-							// XV
+							// 更新
 							Update(object);
 
 							return *this;
 						}
 
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			fXgN^
+						/// @brief			デストラクタ
 						////////////////////////////////////////////////////////////////////////////////
 						~CContent()
 						{
@@ -507,8 +507,8 @@ namespace Standard
 
 					protected:
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			NXXV
-						/// @param[in]		object	NX
+						/// @brief			自クラスを更新
+						/// @param[in]		object	自クラス
 						////////////////////////////////////////////////////////////////////////////////
 						void Update(const CContent& object)
 						{
@@ -517,22 +517,22 @@ namespace Standard
 						}
 
 					public:
-						//! ֐ߎw
+						//! 関節指定
 						bool Indirect;
 
-						//! f[^̒l
+						//! データの値
 						unsigned long Value;
 					};
 
 					////////////////////////////////////////////////////////////////////////////////
 					/// @class      CTemplate
-					/// @brief      [V̐ݒێev[g̃NX
+					/// @brief      モーションの設定を保持するテンプレートのクラス
 					////////////////////////////////////////////////////////////////////////////////
 					class CTemplate
 					{
 					public:
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			RXgN^
+						/// @brief			コンストラクタ
 						////////////////////////////////////////////////////////////////////////////////
 						CTemplate()
 						{
@@ -544,19 +544,19 @@ namespace Standard
 						}
 
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			Rs[Zq
-						/// @return			NX
+						/// @brief			コピー代入演算子
+						/// @return			自クラス
 						////////////////////////////////////////////////////////////////////////////////
 						CTemplate& operator = (const CTemplate& object) noexcept
 						{
-							// XV
+							// 更新
 							Update(object);
 
 							return *this;
 						}
 
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			fXgN^
+						/// @brief			デストラクタ
 						////////////////////////////////////////////////////////////////////////////////
 						~CTemplate()
 						{
@@ -565,48 +565,48 @@ namespace Standard
 
 					public:
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			֐ߎw̃f[^WX^̐擪AhX̒lɍXV
-						/// @param[in]		address	WX^̐擪AhX
+						/// @brief			関節指定のデータをレジスタの先頭アドレスからの値に更新
+						/// @param[in]		address	レジスタの先頭アドレス
 						////////////////////////////////////////////////////////////////////////////////
 						void Reflection(unsigned short address)
 						{
-							// x̏lAōx
+							// 速度の上限値、送り最高速度
 							if (MaxVelocity.Indirect)
 							{
 								MaxVelocity.Value = address + 0x10;
 							}
 
-							// x[wߒP/sec^2]^萔[ms]
+							// 加速度[指令単位/sec^2]／加速時定数[ms]
 							if (Acceleration.Indirect)
 							{
 								Acceleration.Value = address + 0x36;
 							}
 
-							// x[wߒP/sec^2]^萔[ms]
+							// 減速度[指令単位/sec^2]／減速時定数[ms]
 							if (Deceleration.Indirect)
 							{
 								Deceleration.Value = address + 0x38;
 							}
 
-							// tB^ 0.1[ms]
+							// フィルタ時間 ※0.1[ms]
 							if (FilterTime.Indirect)
 							{
 								FilterTime.Value = address + 0x3A;
 							}
 
-							// x
+							// 速度
 							if (Velocity.Indirect)
 							{
 								Velocity.Value = address + 0x10;
 							}
 
-							// _ÃAv[`x
+							// 原点復帰のアプローチ速度
 							if (ApproachVelocity.Indirect)
 							{
 								ApproachVelocity.Value = address + 0x3E;
 							}
 
-							// _ÃN[vx
+							// 原点復帰のクリープ速度
 							if (CreepVelocity.Indirect)
 							{
 								CreepVelocity.Value = address + 0x40;
@@ -615,8 +615,8 @@ namespace Standard
 
 					protected:
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			NXXV
-						/// @param[in]		object	NX
+						/// @brief			自クラスを更新
+						/// @param[in]		object	自クラス
 						////////////////////////////////////////////////////////////////////////////////
 						void Update(const CTemplate& object)
 						{
@@ -635,40 +635,40 @@ namespace Standard
 						}
 
 					public:
-						//! Wn
+						//! 座標系
 						EnumCoordinate Coordinate;
 
-						//! ^Cv
+						//! 動作タイプ
 						EnumMove MoveType;
 
-						//! x^Cv
+						//! 速度タイプ
 						EnumVelocity VelocityType;
 
-						//! ^Cv
+						//! 加減速タイプ
 						EnumAccDec AccDecType;
 
-						//! tB^^Cv
+						//! 加減速フィルタタイプ
 						EnumFilter FilterType;
 
-						//! x̏lAōx
+						//! 速度の上限値、送り最高速度
 						CContent MaxVelocity;
 
-						//! x[wߒP/sec^2]^萔[ms]
+						//! 加速度[指令単位/sec^2]／加速時定数[ms]
 						CContent Acceleration;
 
-						//! x[wߒP/sec^2]^萔[ms]
+						//! 減速度[指令単位/sec^2]／減速時定数[ms]
 						CContent Deceleration;
 
-						//! tB^ 0.1[ms]
+						//! フィルタ時間 ※0.1[ms]
 						CContent FilterTime;
 
-						//! x
+						//! 速度
 						CContent Velocity;
 
-						//! _ÃAv[`x
+						//! 原点復帰のアプローチ速度
 						CContent ApproachVelocity;
 
-						//! _ÃN[vx
+						//! 原点復帰のクリープ速度
 						CContent CreepVelocity;
 					};
 				}
@@ -677,13 +677,13 @@ namespace Standard
 				{
 					////////////////////////////////////////////////////////////////////////////////
 					/// @class      CTemplate
-					/// @brief      |WV̐ݒێev[g̃NX
+					/// @brief      ポジションの設定を保持するテンプレートのクラス
 					////////////////////////////////////////////////////////////////////////////////
 					class CTemplate
 					{
 					public:
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			RXgN^
+						/// @brief			コンストラクタ
 						////////////////////////////////////////////////////////////////////////////////
 						CTemplate()
 						{
@@ -692,19 +692,19 @@ namespace Standard
 						}
 
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			Rs[Zq
-						/// @return			NX
+						/// @brief			コピー代入演算子
+						/// @return			自クラス
 						////////////////////////////////////////////////////////////////////////////////
 						CTemplate& operator = (const CTemplate& object) noexcept
 						{
-							// XV
+							// 更新
 							Update(object);
 
 							return *this;
 						}
 
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			fXgN^
+						/// @brief			デストラクタ
 						////////////////////////////////////////////////////////////////////////////////
 						~CTemplate()
 						{
@@ -713,8 +713,8 @@ namespace Standard
 
 					protected:
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			NXXV
-						/// @param[in]		object	NX
+						/// @brief			自クラスを更新
+						/// @param[in]		object	自クラス
 						////////////////////////////////////////////////////////////////////////////////
 						void Update(const CTemplate& object)
 						{
@@ -723,10 +723,10 @@ namespace Standard
 						}
 
 					public:
-						//! |WṼ^Cv
+						//! ポジションのタイプ
 						EnumPositionData PositionType;
 
-						//! |WṼf[^
+						//! ポジションのデータ
 						long PositionData;
 					};
 				}
@@ -735,17 +735,17 @@ namespace Standard
 				{
 					////////////////////////////////////////////////////////////////////////////////
 					/// @class      CAxis
-					/// @brief      ̌_AsݒNX
-					///				 ʎqێNXh
-					///				 [V̐ݒێev[g̃NXh
-					///				 |WV̐ݒێev[g̃NXh
+					/// @brief      軸の原点復帰を行う設定クラス
+					///				⇒ 識別子を保持するクラスから派生
+					///				⇒ モーションの設定を保持するテンプレートのクラスから派生
+					///				⇒ ポジションの設定を保持するテンプレートのクラスから派生
 					////////////////////////////////////////////////////////////////////////////////
 					class CAxis
 						: virtual public CIdentifier, virtual public Motion::CTemplate, virtual public Position::CTemplate
 					{
 					public:
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			RXgN^
+						/// @brief			コンストラクタ
 						////////////////////////////////////////////////////////////////////////////////
 						CAxis() : CIdentifier(), Motion::CTemplate(), Position::CTemplate()
 						{
@@ -755,19 +755,19 @@ namespace Standard
 						}
 
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			Rs[Zq
-						/// @return			NX
+						/// @brief			コピー代入演算子
+						/// @return			自クラス
 						////////////////////////////////////////////////////////////////////////////////
 						CAxis& operator = (const CAxis& object) noexcept
 						{
-							// XV
+							// 更新
 							Update(object);
 
 							return *this;
 						}
 
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			fXgN^
+						/// @brief			デストラクタ
 						////////////////////////////////////////////////////////////////////////////////
 						~CAxis()
 						{
@@ -776,12 +776,12 @@ namespace Standard
 
 					protected:
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			NXXV
-						/// @param[in]		object	NX
+						/// @brief			自クラスを更新
+						/// @param[in]		object	自クラス
 						////////////////////////////////////////////////////////////////////////////////
 						void Update(const CAxis& object)
 						{
-							// ̊֐
+							// 既定の関数
 							CIdentifier::Update(object);
 							Motion::CTemplate::Update(object);
 							Position::CTemplate::Update(object);
@@ -792,13 +792,13 @@ namespace Standard
 						}
 
 					public:
-						//! _A̕
+						//! 原点復帰の方式
 						EnumOrigin Method;
 
-						//! ړ
+						//! 移動する方向
 						EnumDirection Direction;
 
-						//! ̑
+						//! 完了の属性
 						EnumComplete Complete;
 					};
 				}
@@ -807,16 +807,16 @@ namespace Standard
 				{
 					////////////////////////////////////////////////////////////////////////////////
 					/// @class      CStart
-					/// @brief      WO̊JnsݒNX
-					///				 ʎqێNXh
-					///				 [V̐ݒێev[g̃NXh
+					/// @brief      ジョグの開始を行う設定クラス
+					///				⇒ 識別子を保持するクラスから派生
+					///				⇒ モーションの設定を保持するテンプレートのクラスから派生
 					////////////////////////////////////////////////////////////////////////////////
 					class CStart
 						: virtual public CIdentifier, virtual public Motion::CTemplate
 					{
 					public:
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			RXgN^
+						/// @brief			コンストラクタ
 						////////////////////////////////////////////////////////////////////////////////
 						CStart() : CIdentifier(), Motion::CTemplate()
 						{
@@ -825,19 +825,19 @@ namespace Standard
 						}
 
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			Rs[Zq
-						/// @return			NX
+						/// @brief			コピー代入演算子
+						/// @return			自クラス
 						////////////////////////////////////////////////////////////////////////////////
 						CStart& operator = (const CStart& object) noexcept
 						{
-							// XV
+							// 更新
 							Update(object);
 
 							return *this;
 						}
 
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			fXgN^
+						/// @brief			デストラクタ
 						////////////////////////////////////////////////////////////////////////////////
 						~CStart()
 						{
@@ -846,12 +846,12 @@ namespace Standard
 
 					protected:
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			NXXV
-						/// @param[in]		object	NX
+						/// @brief			自クラスを更新
+						/// @param[in]		object	自クラス
 						////////////////////////////////////////////////////////////////////////////////
 						void Update(const CStart& object)
 						{
-							// ̊֐
+							// 既定の関数
 							CIdentifier::Update(object);
 							Motion::CTemplate::Update(object);
 
@@ -860,24 +860,24 @@ namespace Standard
 						}
 
 					public:
-						//! 
+						//! 方向
 						EnumDirection Direction;
 
-						//! ^CAEg[ms]
+						//! タイムアウト[ms]
 						unsigned short Timeout;
 					};
 
 					////////////////////////////////////////////////////////////////////////////////
 					/// @class      CStop
-					/// @brief      WO̒~sݒNX
-					///				 ʎqێNXh
+					/// @brief      ジョグの停止を行う設定クラス
+					///				⇒ 識別子を保持するクラスから派生
 					////////////////////////////////////////////////////////////////////////////////
 					class CStop
 						: virtual public CIdentifier
 					{
 					public:
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			RXgN^
+						/// @brief			コンストラクタ
 						////////////////////////////////////////////////////////////////////////////////
 						CStop() : CIdentifier()
 						{
@@ -885,19 +885,19 @@ namespace Standard
 						}
 
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			Rs[Zq
-						/// @return			NX
+						/// @brief			コピー代入演算子
+						/// @return			自クラス
 						////////////////////////////////////////////////////////////////////////////////
 						CStop& operator = (const CStop& object) noexcept
 						{
-							// XV
+							// 更新
 							Update(object);
 
 							return *this;
 						}
 
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			fXgN^
+						/// @brief			デストラクタ
 						////////////////////////////////////////////////////////////////////////////////
 						~CStop()
 						{
@@ -906,34 +906,34 @@ namespace Standard
 
 					protected:
 						////////////////////////////////////////////////////////////////////////////////
-						/// @brief			NXXV
-						/// @param[in]		object	NX
+						/// @brief			自クラスを更新
+						/// @param[in]		object	自クラス
 						////////////////////////////////////////////////////////////////////////////////
 						void Update(const CStop& object)
 						{
-							// ̊֐
+							// 既定の関数
 							CIdentifier::Update(object);
 
 							this->Complete = object.Complete;
 						}
 
 					public:
-						//! ̑
+						//! 完了の属性
 						EnumComplete Complete;
 					};
 				}
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CMoveOrigin
-				/// @brief      _AsݒNX
-				///				 ʎqێNXh
+				/// @brief      原点復帰を実行する設定クラス
+				///				⇒ 識別子を保持するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CMoveOrigin
 					: virtual public CIdentifier
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CMoveOrigin() : CIdentifier()
 					{
@@ -941,19 +941,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CMoveOrigin& operator = (const CMoveOrigin& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CMoveOrigin()
 					{
@@ -962,17 +962,17 @@ namespace Standard
 
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			foCX̃nh쐬ݒNX擾
-					/// @param[in]		object	NX
+					/// @brief			デバイスのハンドルを作成する設定クラスを取得
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare GetDeclare()
 					{
 						CDeclare ret;
 
-						// 𑖍
+						// 軸を走査
 						for (const auto& axis : Axises)
 						{
-							// nhǉ
+							// ハンドルを追加
 							ret.Handles.emplace_back(axis.Handle);
 						}
 
@@ -981,12 +981,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CMoveOrigin& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CIdentifier::Update(object);
 
 						this->Axises.clear();
@@ -995,24 +995,24 @@ namespace Standard
 					}
 
 				public:
-					//! ̌_AsݒNX
+					//! 軸の原点復帰を行う設定クラス
 					std::vector<Origin::CAxis> Axises;
 
-					//! ^CAEg[ms]
+					//! タイムアウト[ms]
 					unsigned short Timeout;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CStartJog
-				/// @brief      WO̊Jnݒ肷NX
-				///				 ʎqێNXh
+				/// @brief      ジョグの開始を設定するクラス
+				///				⇒ 識別子を保持するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CStartJog
 					: virtual public CIdentifier
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CStartJog() : CIdentifier()
 					{
@@ -1020,19 +1020,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CStartJog& operator = (const CStartJog& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CStartJog()
 					{
@@ -1041,17 +1041,17 @@ namespace Standard
 
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			foCX̃nh쐬ݒNX擾
-					/// @param[in]		object	NX
+					/// @brief			デバイスのハンドルを作成する設定クラスを取得
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare GetDeclare()
 					{
 						CDeclare ret;
 
-						// 𑖍
+						// 軸を走査
 						for (const auto& axis : Axises)
 						{
-							// nhǉ
+							// ハンドルを追加
 							ret.Handles.emplace_back(axis.Handle);
 						}
 
@@ -1060,12 +1060,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CStartJog& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CIdentifier::Update(object);
 
 						this->Axises.clear();
@@ -1073,21 +1073,21 @@ namespace Standard
 					}
 
 				public:
-					//! WO̊JnsݒNX
+					//! ジョグの開始を行う設定クラス
 					std::vector<Jog::CStart> Axises;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CStopJog
-				/// @brief      WO̒~ݒ肷NX
-				///				 ʎqێNXh
+				/// @brief      ジョグの停止を設定するクラス
+				///				⇒ 識別子を保持するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CStopJog
 					: virtual public CIdentifier
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CStopJog() : CIdentifier()
 					{
@@ -1095,19 +1095,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CStopJog& operator = (const CStopJog& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CStopJog()
 					{
@@ -1116,17 +1116,17 @@ namespace Standard
 
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			foCX̃nh쐬ݒNX擾
-					/// @param[in]		object	NX
+					/// @brief			デバイスのハンドルを作成する設定クラスを取得
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare GetDeclare()
 					{
 						CDeclare ret;
 
-						// 𑖍
+						// 軸を走査
 						for (const auto& axis : Axises)
 						{
-							// nhǉ
+							// ハンドルを追加
 							ret.Handles.emplace_back(axis.Handle);
 						}
 
@@ -1135,12 +1135,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CStopJog& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CIdentifier::Update(object);
 
 						this->Axises.clear();
@@ -1148,7 +1148,7 @@ namespace Standard
 					}
 
 				public:
-					//! ̃WO~sݒNX
+					//! 軸のジョグ停止を行う設定クラス
 					std::vector<Jog::CStop> Axises;
 				};
 			}
@@ -1156,5 +1156,5 @@ namespace Standard
 	}
 }
 
-// oCgACg߂
+// バイトアラインメントを戻す
 #pragma pack()
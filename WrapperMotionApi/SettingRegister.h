@@ -4,7 +4,7 @@
 
 #include "Identifier.h"
 
-// 1oCgACgɕύX
+// 1バイトアラインメントに変更
 #pragma pack(1)
 
 namespace Standard
@@ -17,33 +17,34 @@ namespace Standard
 			{
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CDeclare
-				/// @brief      WX^̃nh쐬ݒNX
+				/// @brief      レジスタのハンドルを作成する設定クラス
 				////////////////////////////////////////////////////////////////////////////////
 				class CDeclare
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare()
 					{
 						Address = "";
+						Size = 0;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CDeclare& operator = (const CDeclare& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CDeclare()
 					{
@@ -52,30 +53,34 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CDeclare& object)
 					{
 						this->Address = object.Address;
+						this->Size = object.Size;
 					}
 
 				public:
-					//! AhX
+					//! アドレス
 					std::string Address;
+
+					//! 取得・更新するワード数 ※作成済みのハンドルを再利用するキー
+					unsigned long Size;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CGetContent
-				/// @brief      WX^̒l擾ݒNX
-				///				 ʎqێNXh
+				/// @brief      レジスタの値を取得する設定クラス
+				///				⇒ 識別子を保持するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CGetContent
 					: virtual public CIdentifier
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CGetContent() : CIdentifier()
 					{
@@ -83,19 +88,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CGetContent& operator = (const CGetContent& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CGetContent()
 					{
@@ -104,33 +109,33 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CGetContent& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CIdentifier::Update(object);
 
 						this->Size = object.Size;
 					}
 
 				public:
-					//! WX^𑀍삷f[^
+					//! レジスタを操作するデータ数
 					unsigned long Size;
 				};
 
 				////////////////////////////////////////////////////////////////////////////////
 				/// @class      CSetContent
-				/// @brief      WX^̒lXVݒNX
-				///				 ʎqێNXh
+				/// @brief      レジスタの値を更新する設定クラス
+				///				⇒ 識別子を保持するクラスから派生
 				////////////////////////////////////////////////////////////////////////////////
 				class CSetContent
 					: virtual public CIdentifier
 				{
 				public:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			RXgN^
+					/// @brief			コンストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					CSetContent() : CIdentifier()
 					{
@@ -138,19 +143,19 @@ namespace Standard
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			Rs[Zq
-					/// @return			NX
+					/// @brief			コピー代入演算子
+					/// @return			自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					CSetContent& operator = (const CSetContent& object) noexcept
 					{
-						// XV
+						// 更新
 						Update(object);
 
 						return *this;
 					}
 
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			fXgN^
+					/// @brief			デストラクタ
 					////////////////////////////////////////////////////////////////////////////////
 					~CSetContent()
 					{
@@ -159,12 +164,12 @@ namespace Standard
 
 				protected:
 					////////////////////////////////////////////////////////////////////////////////
-					/// @brief			NXXV
-					/// @param[in]		object	NX
+					/// @brief			自クラスを更新
+					/// @param[in]		object	自クラス
 					////////////////////////////////////////////////////////////////////////////////
 					void Update(const CSetContent& object)
 					{
-						// ̊֐
+						// 既定の関数
 						CIdentifier::Update(object);
 
 						this->Buffers.clear();
@@ -173,10 +178,10 @@ namespace Standard
 					}
 
 				public:
-					//! WX^̃f[^
+					//! レジスタのデータ
 					std::vector<unsigned short> Buffers;
 
-					//! WX^XVf[^
+					//! レジスタを更新するデータ数
 					unsigned long Size;
 				};
 			}
@@ -184,5 +189,5 @@ namespace Standard
 	}
 }
 
-// oCgACg߂
+// バイトアラインメントを戻す
 #pragma pack()
@@ -2,7 +2,7 @@
 
 #include "Common/Iterator/Basis.h"
 
-// 1oCgACgɕύX
+// 1バイトアラインメントに変更
 #pragma pack(1)
 
 namespace Standard
@@ -12,74 +12,74 @@ namespace Standard
 		namespace Status
 		{
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			^]Xe[^X
+			/// @enum			運転ステータス
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumRunning
 			{
-				RunningReady = 0x00,				// ^]
-				RunningServo = 0x01,				// ^](T[{ON)
-				RunningServoReady = 0x03,			// T[{fB
-				RunningOrigin = 0xFF				// _A
+				RunningReady = 0x00,				// 運転準備完了
+				RunningServo = 0x01,				// 運転中(サーボON)
+				RunningServoReady = 0x03,			// サーボレディ
+				RunningOrigin = 0xFF				// 原点復帰完了
 			};
 			typedef Iterator::CWorker<EnumRunning, RunningReady, RunningServoReady> RunningIterator;
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			[jO
+			/// @enum			ワーニング
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumWarning
 			{
-				WarningDeviation = 0x00,			// ΍ُ
-				WarningSettingParameter = 0x01,		// ݒp[^ُ
-				WarningFixParameter = 0x02,			// Œp[^ُ
-				WarningDriver = 0x03,				// T[{hCoُ
-				WarningCommand = 0x04,				// [VR}hݒُ
-				WarningServoUnfinished = 0x08,		// T[{ON
-				WarningServoCommunication = 0x09,	// T[{hCoʐMx
-				WarningServoStop = 0x0A				// T[{hCo~M͒
+				WarningDeviation = 0x00,			// 偏差異常
+				WarningSettingParameter = 0x01,		// 設定パラメータ異常
+				WarningFixParameter = 0x02,			// 固定パラメータ異常
+				WarningDriver = 0x03,				// サーボドライバ異常
+				WarningCommand = 0x04,				// モーションコマンド設定異常
+				WarningServoUnfinished = 0x08,		// サーボON未完
+				WarningServoCommunication = 0x09,	// サーボドライバ通信警告
+				WarningServoStop = 0x0A				// サーボドライバ停止信号入力中
 			};
 			typedef Iterator::CWorker<EnumWarning, WarningDeviation, WarningServoStop> WarningIterator;
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			A[
+			/// @enum			アラーム
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumAlarm
 			{
-				AlarmDriver = 0x00,					// T[{hCoُ
-				AlarmPositiveSoftLimit = 0x03,		// \tg~bg
-				AlarmNegativeSoftLimit = 0x04,		// \tg~bg
-				AlarmServoOff = 0x05,				// T[{OFF
-				AlarmPositionTimeover = 0x06,		// ʒu߃^CI[o[
-				AlarmExcessivePosition = 0x07,		// ʒu߈ړʉߑ
-				AlarmExcessiveSpeed = 0x08,			// xߑ
-				AlarmDeviation = 0x09				// ΍ُ
+				AlarmDriver = 0x00,					// サーボドライバ異常
+				AlarmPositiveSoftLimit = 0x03,		// 正方向ソフトリミット
+				AlarmNegativeSoftLimit = 0x04,		// 負方向ソフトリミット
+				AlarmServoOff = 0x05,				// サーボOFF
+				AlarmPositionTimeover = 0x06,		// 位置決めタイムオーバー
+				AlarmExcessivePosition = 0x07,		// 位置決め移動量過大
+				AlarmExcessiveSpeed = 0x08,			// 速度過大
+				AlarmDeviation = 0x09				// 偏差異常
 			};
 			typedef Iterator::CWorker<EnumAlarm, AlarmDriver, AlarmDeviation> AlarmIterator;
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			[VR}h
+			/// @enum			モーションコマンド
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumCommand
 			{
-				CommandRunning = 0x00,				// s
-				CommandPause = 0x01,				// ꎞ~
-				CommandAbnormalFinish = 0x03,		// ُI
-				CommandCompleted = 0x08				// s
+				CommandRunning = 0x00,				// 実行中
+				CommandPause = 0x01,				// 一時停止完了
+				CommandAbnormalFinish = 0x03,		// 異常終了状態
+				CommandCompleted = 0x08				// 実行完了
 			};
 			typedef Iterator::CWorker<EnumCommand, CommandRunning, CommandCompleted> CommandIterator;
 
 			////////////////////////////////////////////////////////////////////////////////
-			/// @enum			ʒu
+			/// @enum			位置
 			////////////////////////////////////////////////////////////////////////////////
 			enum EnumPosition
 			{
-				PositionPayoutCompleted = 0x00,		// o
-				PositionCompleted = 0x01,			// ʒuߊ
-				PositionOriginCompleted = 0x05		// _A
+				PositionPayoutCompleted = 0x00,		// 払い出し完了
+				PositionCompleted = 0x01,			// 位置決め完了
+				PositionOriginCompleted = 0x05		// 原点復帰完了
 			};
 			typedef Iterator::CWorker<EnumPosition, PositionPayoutCompleted, PositionOriginCompleted> PositionIterator;
 		}
 	}
 }
 
-// oCgACg߂
+// バイトアラインメントを戻す
 #pragma pack()
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "pch.h"
 
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <utility>
 
 #include "Common/Tool/Text.h"
 
@@ -19,96 +22,147 @@ namespace Standard
 {
 	namespace MotionApi
 	{
+		//! レジスタのハンドルの排他制御
+		static std::mutex _asyncRegister;
+
+		//! レジスタのハンドルを作成するコントローラ ※最後に開いたコントローラのハンドル
+		static unsigned long _controller = ConstDisconnected;
+
+		//! 作成済みのレジスタのハンドル ※キーはコントローラのハンドル ⇒ アドレスとワード数
+		static std::map<unsigned long, std::map<std::pair<std::string, unsigned long>, unsigned long>> _registers;
+
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			Rg[ɐڑ
-		/// @param[in]		object	Rg[Jݒ̃NX
-		/// @return			Rg[JʃNX
+		/// @brief			レジスタのハンドルを作成するコントローラを更新
+		/// @detail			ハンドルはコントローラとの接続ごとに有効なため、開いたコントローラの作成済みのハンドルを破棄する
+		///					※同じハンドルの値で開き直した場合に、前回の接続のハンドルを再利用しない
+		/// @param[in]		controller	開いたコントローラのハンドル
+		////////////////////////////////////////////////////////////////////////////////
+		static void OpenRegister(unsigned long controller)
+		{
+			// 排他制御
+			std::lock_guard<std::mutex> lock(_asyncRegister);
+
+			_registers.erase(controller);
+			_controller = controller;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			作成済みのレジスタのハンドルを破棄
+		/// @detail			閉じるコントローラのハンドルだけ破棄し、他のコントローラのハンドルは保持する
+		/// @param[in]		controller	閉じるコントローラのハンドル
+		////////////////////////////////////////////////////////////////////////////////
+		static void CloseRegister(unsigned long controller)
+		{
+			// 排他制御
+			std::lock_guard<std::mutex> lock(_asyncRegister);
+
+			_registers.erase(controller);
+
+			// 閉じるコントローラを確認
+			if (_controller == controller)
+			{
+				_controller = ConstDisconnected;
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/// @brief			コントローラに接続
+		/// @param[in]		object	コントローラを開く設定のクラス
+		/// @return			コントローラを開いた結果クラス
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_API Controller::Result::COpen OpenController(const Controller::Setting::COpen& object)
 		{
 			Controller::Result::COpen ret;
 			std::stringstream postscript;
 
-			// COM_DEVICE\
+			// COM_DEVICE構造体
 			COM_DEVICE device;
 
-			// \̂
+			// 構造体を初期化
 			::memset(&device, 0, sizeof(COM_DEVICE));
 
-			// ʐM
+			// 通信種別
 			device.ComDeviceType = (WORD)object.Device;
 
-			// |[gԍ
+			// ポート番号
 			device.PortNumber = 1;
 
-			// CPUԍ
+			// CPU番号
 			device.CpuNumber = 1;
 
-			// ʐM^CAEg
+			// 通信タイムアウト
 			device.Timeout = 10000;
 
 			HCONTROLLER result;
 
-			// Rg[Ɛڑ
+			// コントローラと接続
 			postscript << "ymcOpenController()";
 			result = ymcOpenController(&device, &ret.Handle);
 
-			// ڑmF
+			// 接続を確認
 			if (result != MP_SUCCESS)
 			{
-				// ڑɎs  O𔭖C
+				// 接続に失敗 ⇒ 例外を発砲
 				throw CException(result, postscript.str());
 			}
 
+			// レジスタのハンドルを作成するコントローラを更新
+			OpenRegister(ret.Handle);
+
 			return ret;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			Apĩ^CAEgݒ
-		/// @param[in]		object	Apĩ^CAEgݒ̃NX
+		/// @brief			Apiのタイムアウトを設定
+		/// @param[in]		object	Apiのタイムアウト設定のクラス
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_API void SetApiTimeout(const Controller::Setting::CApiTimeout& object)
 		{
 			unsigned long result = MP_SUCCESS;
 			std::stringstream postscript;
 
-			// [VApĩ^CAEgݒ
+			// モーションApiのタイムアウトを設定
 			postscript << "ymcSetAPITimeoutValue()";
 			result = ymcSetAPITimeoutValue((LONG)object.Value);
 
-			// ݒmF
+			// 設定を確認
 			if (result != MP_SUCCESS)
 			{
-				// ݒɎs  O𔭖C
+				// 設定に失敗 ⇒ 例外を発砲
 				throw CException(result, postscript.str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			Rg[Ɛؒf
-		/// @param[in]		object	Rg[ݒNX
+		/// @brief			コントローラと切断
+		/// @param[in]		object	コントローラを閉じる設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_API void CloseController(const Controller::Setting::CClose& object)
 		{
 			unsigned long result = MP_SUCCESS;
 			std::stringstream postscript;
 
-			// Rg[Ɛؒf
+			// 作成済みのレジスタのハンドルを破棄
+			CloseRegister(object.Handle);
+
+			// コントローラと切断
 			postscript << "ymcCloseController()";
 			result = ymcCloseController(object.Handle);
 
-			// ؒfmF
+			// 切断を確認
 			if (result != MP_SUCCESS)
 			{
-				// ؒfɎs  O𔭖C
+				// 切断に失敗 ⇒ 例外を発砲
 				throw CException(result, postscript.str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			WX^̃nh쐬
-		/// @param[in]		object	WX^̃nh쐬ݒ̃NX
-		/// @return			WX^̃nh쐬ʃNX
+		/// @brief			レジスタのハンドルを作成
+		/// @detail			最後に開いたコントローラで、作成済みのアドレスとワード数はハンドルを再利用する
+		///					※コントローラを閉じるか、同じハンドルで開き直すまで有効
+		/// @param[in]		object	レジスタのハンドルを作成する設定のクラス
+		/// @return			レジスタのハンドルを作成した結果クラス
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_API Register::Result::CDeclare DeclareRegister(const Register::Setting::CDeclare& object)
 		{
@@ -116,24 +170,44 @@ namespace Standard
 			unsigned long result = MP_SUCCESS;
 			std::stringstream postscript;
 
-			// WX^̃nh擾
-			postscript << "ymcGetRegisterDataHandle()";
-			result = ymcGetRegisterDataHandle((unsigned char *)object.Address.c_str(), &ret.Handle);
+			// 排他制御
+			std::lock_guard<std::mutex> lock(_asyncRegister);
 
-			// 擾mF
-			if (result != MP_SUCCESS)
+			// 開いたコントローラの作成済みのハンドル
+			auto& registers = _registers[_controller];
+			auto key = std::make_pair(object.Address, object.Size);
+			auto registered = registers.find(key);
+
+			// 作成済みを確認
+			if (registered != registers.end())
 			{
-				// 擾Ɏs  O𔭖C
-				throw CException(result, postscript.str());
+				// 作成済み ⇒ 再利用
+				ret.Handle = registered->second;
+			}
+			else
+			{
+				// レジスタのハンドルを取得
+				postscript << "ymcGetRegisterDataHandle()";
+				result = ymcGetRegisterDataHandle((unsigned char *)object.Address.c_str(), &ret.Handle);
+
+				// 取得を確認
+				if (result != MP_SUCCESS)
+				{
+					// 取得に失敗 ⇒ 例外を発砲
+					throw CException(result, postscript.str());
+				}
+
+				// 作成したハンドルを登録
+				registers[key] = ret.Handle;
 			}
 
 			return ret;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			WX^̒l擾
-		/// @param[in]		object	WX^̒l擾ݒNX
-		/// @return			WX^̒lNX
+		/// @brief			レジスタの値を取得
+		/// @param[in]		object	レジスタの値を取得する設定クラス
+		/// @return			レジスタの値クラス
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_API Register::Result::CContent GetRegisterData(const Register::Setting::CGetContent& object)
 		{
@@ -141,17 +215,17 @@ namespace Standard
 			unsigned long result = MP_SUCCESS;
 			std::stringstream postscript;
 
-			// obt@XV
+			// バッファ数を更新
 			ret.Buffers.resize(object.Size);
 
-			// WX^̒l擾
+			// レジスタの値を取得
 			postscript << "ymcGetRegisterData()";
 			result = ymcGetRegisterData(object.Handle, object.Size, ret.Buffers.data(), &ret.Size);
 
-			// 擾mF
+			// 取得を確認
 			if (result != MP_SUCCESS)
 			{
-				// 擾Ɏs  O𔭖C
+				// 取得に失敗 ⇒ 例外を発砲
 				throw CException(result, postscript.str());
 			}
 
@@ -159,50 +233,50 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			WX^̒lXV
-		/// @param[in]		object	WX^̒lXVݒNX
+		/// @brief			レジスタの値を更新
+		/// @param[in]		object	レジスタの値を更新する設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_API void SetRegisterData(const Register::Setting::CSetContent& object)
 		{
 			unsigned long result = MP_SUCCESS;
 			std::stringstream postscript;
 
-			// WX^̒lXV
+			// レジスタの値を更新
 			postscript << "ymcSetRegisterData()";
 			result = ymcSetRegisterData(object.Handle, object.Size, (void*)object.Buffers.data());
 
-			// 擾mF
+			// 取得を確認
 			if (result != MP_SUCCESS)
 			{
-				// 擾Ɏs  O𔭖C
+				// 取得に失敗 ⇒ 例外を発砲
 				throw CException(result, postscript.str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			̃nh
+		/// @brief			軸のハンドルを消去
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_API void ClearAllAxis()
 		{
 			unsigned long result = MP_SUCCESS;
 			std::stringstream postscript;
 
-			// ̃nh
+			// 軸のハンドルを消去
 			postscript << "ymcClearAllAxes()";
 			result = ymcClearAllAxes();
 
-			// mF
+			// 消去を確認
 			if (result != MP_SUCCESS)
 			{
-				// Ɏs  O𔭖C
+				// 消去に失敗 ⇒ 例外を発砲
 				throw CException(result, postscript.str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			̃nh쐬
-		/// @param[in]		object	̃nh쐬ݒ̃NX
-		/// @return			̃nh쐬ʃNX
+		/// @brief			軸のハンドルを作成
+		/// @param[in]		object	軸のハンドルを作成する設定のクラス
+		/// @return			軸のハンドルを作成した結果クラス
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_API Axis::Result::CDeclare DeclareAxis(const Axis::Setting::CDeclare& object)
 		{
@@ -213,14 +287,14 @@ namespace Standard
 
 			name << "Axis" << Text::Format(2, object.LogicalNo);
 
-			// ̃nh擾
+			// 軸のハンドルを取得
 			postscript << "ymcDeclareAxis()";
 			result = ymcDeclareAxis(1, object.SlotNo, object.SubSlotNo, object.StationNo, object.LogicalNo, (WORD)object.Type, (LPBYTE)name.str().c_str(), &ret.Handle);
 
-			// 擾mF
+			// 取得を確認
 			if (result != MP_SUCCESS)
 			{
-				// 擾Ɏs  O𔭖C
+				// 取得に失敗 ⇒ 例外を発砲
 				throw CException(result, postscript.str());
 			}
 
@@ -228,30 +302,30 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			̃nhNA
-		/// @param[in]		object	̃nhjݒ̃NX
+		/// @brief			軸のハンドルをクリア
+		/// @param[in]		object	軸のハンドルを破棄する設定のクラス
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_API void ClearAxis(const Axis::Setting::CClear& object)
 		{
 			unsigned long result = MP_SUCCESS;
 			std::stringstream postscript;
 
-			// ̃nhNA
+			// 軸のハンドルをクリア
 			postscript << "ymcClearAxis()";
 			result = ymcClearAxis(object.Handle);
 
-			// jmF
+			// 破棄を確認
 			if (result != MP_SUCCESS)
 			{
-				// jɎs  O𔭖C
+				// 破棄に失敗 ⇒ 例外を発砲
 				throw CException(result, postscript.str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			foCX̃nh쐬
-		/// @param[in]		object	foCX̃nh쐬ݒ̃NX
-		/// @return			foCX̃nh쐬ʃNX
+		/// @brief			デバイスのハンドルを作成
+		/// @param[in]		object	デバイスのハンドルを作成する設定のクラス
+		/// @return			デバイスのハンドルを作成した結果クラス
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_API Device::Result::CDeclare DeclareDevice(const Device::Setting::CDeclare& object)
 		{
@@ -261,21 +335,21 @@ namespace Standard
 
 			std::vector<HAXIS> axises;
 
-			// 𑖍
+			// 軸を走査
 			for (const auto& handle : object.Handles)
 			{
-				// ̃nhǉ
+				// 軸のハンドルを追加
 				axises.emplace_back(handle);
 			}
 
-			// foCX̃nh擾
+			// デバイスのハンドルを取得
 			postscript << "ymcDeclareDevice()";
 			result = ymcDeclareDevice((WORD)axises.size(), axises.data(), &ret.Handle);
 
-			// 擾mF
+			// 取得を確認
 			if (result != MP_SUCCESS)
 			{
-				// 擾Ɏs  O𔭖C
+				// 取得に失敗 ⇒ 例外を発砲
 				throw CException(result, postscript.str());
 			}
 
@@ -283,125 +357,125 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			foCX̃nhNA
-		/// @param[in]		object	foCX̃nhjݒ̃NX
+		/// @brief			デバイスのハンドルをクリア
+		/// @param[in]		object	デバイスのハンドルを破棄する設定のクラス
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_API void ClearDevice(const Device::Setting::CClear& object)
 		{
 			unsigned long result = MP_SUCCESS;
 			std::stringstream postscript;
 
-			// foCX̃nhNA
+			// デバイスのハンドルをクリア
 			postscript << "ymcClearDevice()";
 			result = ymcClearDevice(object.Handle);
 
-			// jmF
+			// 破棄を確認
 			if (result != MP_SUCCESS)
 			{
-				// jɎs  O𔭖C
+				// 破棄に失敗 ⇒ 例外を発砲
 				throw CException(result, postscript.str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			T[{𐧌
-		/// @param[in]		object T[{̐sݒNX
+		/// @brief			サーボを制御
+		/// @param[in]		object サーボの制御を行う設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_API void ServoControl(const Device::Setting::CServo& object)
 		{
 			unsigned long result = MP_SUCCESS;
 			std::stringstream postscript;
 
-			// T[{𐧌
+			// サーボを制御
 			postscript << "ymcServoControl()";
 			result = ymcServoControl(object.Handle, object.Mode == Signal::StatusOn ? SERVO_ON : SERVO_OFF, object.Timeout);
 
-			// mF
+			// 制御を確認
 			if (result != MP_SUCCESS)
 			{
-				// Ɏs  O𔭖C
+				// 制御に失敗 ⇒ 例外を発砲
 				throw CException(result, postscript.str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			̐sev[g̐ݒNX烉Cu֓nϐ֕ϊ
-		/// @param[in]		object ̐sev[g̐ݒNX
+		/// @brief			軸の制御を行うテンプレートの設定クラスからライブラリへ渡す変数へ変換
+		/// @param[in]		object 軸の制御を行うテンプレートの設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_DATA Convert(const Device::Setting::Motion::CTemplate& object)
 		{
 			MOTION_DATA ret;
 
-			// Wn
+			// 座標系
 			ret.CoordinateSystem = (WORD)object.Coordinate;
 
-			// ^Cv
+			// 動作タイプ
 			ret.MoveType = (SHORT)object.MoveType;
 
-			// x^Cv
+			// 速度タイプ
 			ret.VelocityType = (SHORT)object.VelocityType;
 
-			// ^Cv
+			// 加減速タイプ
 			ret.AccDecType = (SHORT)object.AccDecType;
 
-			// tB^^Cv
+			// 加減速フィルタタイプ
 			ret.FilterType = (SHORT)object.FilterType;
 
-			// f[^tO
+			// データフラグを初期化
 			ret.DataType = 0;
 
-			// x̏lAōx
+			// 速度の上限値、送り最高速度
 			if (object.MaxVelocity.Indirect)
 			{
-				// f[^tÕrbgON
+				// データフラグのビットをON
 				ret.DataType |= 0x01 << 0;
 			}
 			ret.MaxVelocity = (LONG)object.MaxVelocity.Value;
 
-			// x[wߒP/sec^2]^萔[ms]
+			// 加速度[指令単位/sec^2]／加速時定数[ms]
 			if (object.Acceleration.Indirect)
 			{
-				// f[^tÕrbgON
+				// データフラグのビットをON
 				ret.DataType |= 0x01 << 1;
 			}
 			ret.Acceleration = (LONG)object.Acceleration.Value;
 
-			// x[wߒP/sec^2]^萔[ms]
+			// 減速度[指令単位/sec^2]／減速時定数[ms]
 			if (object.Deceleration.Indirect)
 			{
-				// f[^tÕrbgON
+				// データフラグのビットをON
 				ret.DataType |= 0x01 << 2;
 			}
 			ret.Deceleration = (LONG)object.Deceleration.Value;
 
-			// tB^ 0.1[ms]
+			// フィルタ時間 ※0.1[ms]
 			if (object.FilterTime.Indirect)
 			{
-				// f[^tÕrbgON
+				// データフラグのビットをON
 				ret.DataType |= 0x01 << 3;
 			}
 			ret.FilterTime = (LONG)object.FilterTime.Value;
 
-			// x
+			// 速度
 			if (object.Velocity.Indirect)
 			{
-				// f[^tÕrbgON
+				// データフラグのビットをON
 				ret.DataType |= 0x01 << 4;
 			}
 			ret.Velocity = (LONG)object.Velocity.Value;
 
-			// _ÃAv[`x
+			// 原点復帰のアプローチ速度
 			if (object.ApproachVelocity.Indirect)
 			{
-				// f[^tÕrbgON
+				// データフラグのビットをON
 				ret.DataType |= 0x01 << 5;
 			}
 			ret.ApproachVelocity = (LONG)object.ApproachVelocity.Value;
 
-			// _ÃN[vx
+			// 原点復帰のクリープ速度
 			if (object.CreepVelocity.Indirect)
 			{
-				// f[^tÕrbgON
+				// データフラグのビットをON
 				ret.DataType |= 0x01 << 6;
 			}
 			ret.CreepVelocity = (LONG)object.CreepVelocity.Value;
@@ -410,8 +484,8 @@ namespace Standard
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			̌_As
-		/// @param[in]		object ̌_AsݒNX
+		/// @brief			軸の原点復帰を実行
+		/// @param[in]		object 軸の原点復帰を実行する設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_API void MoveOrigin(const Device::Setting::CMoveOrigin& object)
 		{
@@ -424,43 +498,43 @@ namespace Standard
 			std::vector<WORD> directions;
 			std::vector<WORD> completions;
 
-			// 𑖍
+			// 軸を走査
 			for (const auto& axis : object.Axises)
 			{
-				// ̐sԂێNX烉Cu֓nϐ֕ϊ
+				// 軸の制御を行う状態を保持するクラスからライブラリへ渡す変数へ変換
 				motions.emplace_back(Convert(axis));
 
-				// _A̍ŏIsǉ
+				// 原点復帰の最終走行距離を追加
 				POSITION_DATA position;
 				position.DataType = (LONG)axis.PositionType;
 				position.PositionData = (LONG)axis.PositionData;
 				positions.emplace_back(position);
 
-				// _A̕ǉ
+				// 原点復帰の方式を追加
 				methods.emplace_back((WORD)axis.Method);
 
-				// ړǉ
+				// 移動する方向を追加
 				directions.emplace_back((WORD)axis.Direction);
 
-				// ̑ǉ
+				// 完了の属性を追加
 				completions.emplace_back((WORD)axis.Complete);
 			}
 
-			// ̌_As
+			// 軸の原点復帰を実行
 			postscript << "ymcMoveHomePosition()";
 			result = ymcMoveHomePosition(object.Handle, motions.data(), positions.data(), methods.data(), directions.data(), 0, NULL, completions.data(), 0);
 
-			// mF
+			// 制御を確認
 			if (result != MP_SUCCESS)
 			{
-				// Ɏs  O𔭖C
+				// 制御に失敗 ⇒ 例外を発砲
 				throw CException(result, postscript.str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			̃WOs
-		/// @param[in]		object ̃WOsݒNX
+		/// @brief			軸のジョグ送りを実行
+		/// @param[in]		object 軸のジョグを実行する設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_API void StartJog(const Device::Setting::CStartJog& object)
 		{
@@ -471,34 +545,34 @@ namespace Standard
 			std::vector<WORD> directions;
 			std::vector<WORD> timeouts;
 
-			// 𑖍
+			// 軸を走査
 			for (const auto& axis : object.Axises)
 			{
-				// ̐sԂێNX烉Cu֓nϐ֕ϊ
+				// 軸の制御を行う状態を保持するクラスからライブラリへ渡す変数へ変換
 				datas.emplace_back(Convert(axis));
 
-				// ǉ
+				// 方向を追加
 				directions.emplace_back((WORD)axis.Direction);
 
-				// ^CAEgǉ
+				// タイムアウトを追加
 				timeouts.emplace_back((WORD)axis.Timeout);
 			}
 
-			// ̃WOs
+			// 軸のジョグ送りを実行
 			postscript << "ymcMoveJOG()";
 			result = ymcMoveJOG(object.Handle, datas.data(), directions.data(), timeouts.data(), 0, NULL, 0);
 
-			// mF
+			// 制御を確認
 			if (result != MP_SUCCESS)
 			{
-				// Ɏs  O𔭖C
+				// 制御に失敗 ⇒ 例外を発砲
 				throw CException(result, postscript.str());
 			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
-		/// @brief			̃WO~
-		/// @param[in]		object ̃WO~ݒNX
+		/// @brief			軸のジョグ送りを停止
+		/// @param[in]		object 軸のジョグを停止する設定クラス
 		////////////////////////////////////////////////////////////////////////////////
 		MOTION_API void StopJog(const Device::Setting::CStopJog& object)
 		{
@@ -507,21 +581,21 @@ namespace Standard
 
 			std::vector<WORD> completeds;
 
-			// 𑖍
+			// 軸を走査
 			for (const auto& axis : object.Axises)
 			{
-				// ̑
+				// 完了の属性
 				completeds.emplace_back((WORD)axis.Complete);
 			}
 
-			// ̃WO~
+			// 軸のジョグ送りを停止
 			postscript << "ymcStopJOG()";
 			result = ymcStopJOG(object.Handle, 0, NULL, completeds.data(), 0);
 
-			// mF
+			// 制御を確認
 			if (result != MP_SUCCESS)
 			{
-				// Ɏs  O𔭖C
+				// 制御に失敗 ⇒ 例外を発砲
 				throw CException(result, postscript.str());
 			}
 		}
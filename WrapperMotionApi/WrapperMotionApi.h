@@ -16,49 +16,49 @@ namespace Standard
 {
 	namespace MotionApi
 	{
-		// Rg[ɐڑ
+		// コントローラに接続
 		MOTION_API Controller::Result::COpen OpenController(const Controller::Setting::COpen& object) throw(...);
 
-		// Apĩ^CAEgݒ
+		// Apiのタイムアウトを設定
 		MOTION_API void SetApiTimeout(const Controller::Setting::CApiTimeout& object) throw(...);
 
-		// Rg[Ɛؒf
+		// コントローラと切断
 		MOTION_API void CloseController(const Controller::Setting::CClose& object) throw(...);
 
-		// WX^̃nh擾
+		// レジスタのハンドルを取得
 		MOTION_API Register::Result::CDeclare DeclareRegister(const Register::Setting::CDeclare& object) throw(...);
 
-		// WX^̒l擾
+		// レジスタの値を取得
 		MOTION_API Register::Result::CContent GetRegisterData(const Register::Setting::CGetContent& object) throw(...);
 
-		// WX^̒lXV
+		// レジスタの値を更新
 		MOTION_API void SetRegisterData(const Register::Setting::CSetContent& object) throw(...);
 
-		// ̃nh
+		// 軸のハンドルを消去
 		MOTION_API void ClearAllAxis() throw(...);
 
-		// ̃nh쐬
+		// 軸のハンドルを作成
 		MOTION_API Axis::Result::CDeclare DeclareAxis(const Axis::Setting::CDeclare& object) throw(...);
 
-		// ̃nhNA
+		// 軸のハンドルをクリア
 		MOTION_API void ClearAxis(const Axis::Setting::CClear& object) throw(...);
 
-		// foCX̃nh쐬
+		// デバイスのハンドルを作成
 		MOTION_API Device::Result::CDeclare DeclareDevice(const Device::Setting::CDeclare& object);
 
-		// foCX̃nhNA
+		// デバイスのハンドルをクリア
 		MOTION_API void ClearDevice(const Device::Setting::CClear& object);
 
-		// ̃T[{𐧌
+		// 軸のサーボを制御
 		MOTION_API void ServoControl(const Device::Setting::CServo& object);
 
-		// ̌_As
+		// 軸の原点復帰を実行
 		MOTION_API void MoveOrigin(const Device::Setting::CMoveOrigin& object);
 
-		// ̃WOs
+		// 軸のジョグ送りを実行
 		MOTION_API void StartJog(const Device::Setting::CStartJog& object);
 
-		// ̃WO~
+		// 軸のジョグ送りを停止
 		MOTION_API void StopJog(const Device::Setting::CStopJog& object);
 	}
 }
\ No newline at end of file
@@ -10,7 +10,7 @@ END_MESSAGE_MAP()
 
 void CButtonExpand::OnLButtonDown(UINT nFlags, CPoint point)
 {
-	// TODO: ɃbZ[W nh[ R[hǉ邩ȀĂяo܂B
+	// TODO: ここにメッセージ ハンドラー コードを追加するか、既定の処理を呼び出します。
 	CRect window;
 
 	this->GetWindowRect(window);
@@ -22,7 +22,7 @@ void CButtonExpand::OnLButtonDown(UINT nFlags, CPoint point)
 
 void CButtonExpand::OnLButtonUp(UINT nFlags, CPoint point)
 {
-	// TODO: ɃbZ[W nh[ R[hǉ邩ȀĂяo܂B
+	// TODO: ここにメッセージ ハンドラー コードを追加するか、既定の処理を呼び出します。
 	CRect window;
 
 	this->GetWindowRect(window);
@@ -34,7 +34,7 @@ void CButtonExpand::OnLButtonUp(UINT nFlags, CPoint point)
 
 void CButtonExpand::OnMouseLeave()
 {
-	// TODO: ɃbZ[W nh[ R[hǉ邩ȀĂяo܂B
+	// TODO: ここにメッセージ ハンドラー コードを追加するか、既定の処理を呼び出します。
 	this->GetParent()->SendMessage(WM_MOUSELEAVE, 0, 0);
 
 	CButton::OnMouseLeave();
@@ -208,6 +208,9 @@ BOOL CSamplePlcDlg::OnInitDialog()
 		// ポーリングの周期[ms]
 		settingDefault.Cycle = 100;
 
+		// 変化がない間のポーリングの周期の上限[ms] ⇒ 変化がない間は100→200→…→1000msまで延ばす
+		settingDefault.CycleIdle = 1000;
+
 		// IOを初期化
 		Io::Initialize(settingDefault);
 
@@ -506,9 +509,9 @@ void CSamplePlcDlg::OnPaint()
 			color = RGB(0, 255, 0);
 			for (const auto& driver : m_inputAxis.Drivers)
 			{
-				if (driver.second.Motion.count(Axis::Status::Input::MotionServo))
+				if (driver.Motion.IsValid(Axis::Status::Input::MotionServo))
 				{
-					if (driver.second.Motion.at(Axis::Status::Input::MotionServo) == false)
+					if (driver.Motion.Get(Axis::Status::Input::MotionServo) == false)
 					{
 						color = offColor;
 					}
@@ -520,9 +523,9 @@ void CSamplePlcDlg::OnPaint()
 			color = RGB(0, 255, 0);
 			for (const auto& driver : m_inputAxis.Drivers)
 			{
-				if (driver.second.Motion.count(Axis::Status::Input::MotionOrigin))
+				if (driver.Motion.IsValid(Axis::Status::Input::MotionOrigin))
 				{
-					if (driver.second.Motion.at(Axis::Status::Input::MotionOrigin) == false)
+					if (driver.Motion.Get(Axis::Status::Input::MotionOrigin) == false)
 					{
 						color = offColor;
 					}
@@ -534,20 +537,14 @@ void CSamplePlcDlg::OnPaint()
 			color = offColor;
 			for (const auto& driver : m_inputAxis.Drivers)
 			{
-				for (const auto& warning : driver.second.Warning)
+				if (driver.Warning.Values & driver.Warning.Valid)
 				{
-					if (warning.second)
-					{
-						color = RGB(255, 0, 0);
-					}
+					color = RGB(255, 0, 0);
 				}
 
-				for (const auto& alarm : driver.second.Alarm)
+				if (driver.Alarm.Values & driver.Alarm.Valid)
 				{
-					if (alarm.second)
-					{
-						color = RGB(255, 0, 0);
-					}
+					color = RGB(255, 0, 0);
 				}
 			}
 			DrawCircle(IDC_STATIC_EMERGENCY, color);
@@ -1523,22 +1520,22 @@ void CSamplePlcDlg::DrawCurrent(int id)
 		originY -= area.top;
 #else
 		// -リミットX軸
-		area.left = m_inputAxis.Drivers.at(AxisX).Coordinate.at(Axis::Status::Input::CoordinateNegativeLimit);
+		area.left = m_inputAxis.GetDriver(AxisX).Coordinate.Get(Axis::Status::Input::CoordinateNegativeLimit);
 		// +リミットX軸
-		area.right = m_inputAxis.Drivers.at(AxisX).Coordinate.at(Axis::Status::Input::CoordinatePositiveLimit);
+		area.right = m_inputAxis.GetDriver(AxisX).Coordinate.Get(Axis::Status::Input::CoordinatePositiveLimit);
 		// -リミットY軸
-		area.top = m_inputAxis.Drivers.at(AxisY).Coordinate.at(Axis::Status::Input::CoordinateNegativeLimit);
+		area.top = m_inputAxis.GetDriver(AxisY).Coordinate.Get(Axis::Status::Input::CoordinateNegativeLimit);
 		// +リミットY軸
-		area.bottom = m_inputAxis.Drivers.at(AxisY).Coordinate.at(Axis::Status::Input::CoordinatePositiveLimit);
+		area.bottom = m_inputAxis.GetDriver(AxisY).Coordinate.Get(Axis::Status::Input::CoordinatePositiveLimit);
 
 		float ratioX = (float)control.Width() / (float)area.Width();
 		float ratioY = (float)control.Height() / (float)area.Height();
 
 		// 現在のX軸
-		long currentX = m_inputAxis.Drivers.at(AxisX).Coordinate.at(Axis::Status::Input::CoordinateCurrent);
+		long currentX = m_inputAxis.GetDriver(AxisX).Coordinate.Get(Axis::Status::Input::CoordinateCurrent);
 
 		// 現在のY軸
-		long currentY = m_inputAxis.Drivers.at(AxisY).Coordinate.at(Axis::Status::Input::CoordinateCurrent);
+		long currentY = m_inputAxis.GetDriver(AxisY).Coordinate.Get(Axis::Status::Input::CoordinateCurrent);
 
 		float originX;
 		float originY;
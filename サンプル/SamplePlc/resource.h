@@ -1,6 +1,6 @@
 //{{NO_DEPENDENCIES}}
-// Microsoft Visual C++ ŐꂽCN[h t@CB
-// SamplePlc.rc Ŏgp
+// Microsoft Visual C++ で生成されたインクルード ファイル。
+// SamplePlc.rc で使用
 //
 #define IDD_SAMPLEPLC_DIALOG            102
 #define IDR_MAINFRAME                   128